@@ -162,6 +162,49 @@ namespace hh::common
     }
   }
 
+  void run_on_all_processors_concurrently(all_cpus_callback callback, void* context)
+  {
+    if (get_active_processors_count() == 1)
+    {
+      callback(context);
+      return;
+    }
+
+    EFI_EVENT all_aps_finished = {};
+    auto status = gBS->CreateEvent(0, TPL_CALLBACK, nullptr, nullptr, &all_aps_finished);
+
+    if (EFI_ERROR(status))
+    {
+      throw std::exception{ __FUNCTION__": ""CreateEvent failed." };
+    }
+
+    // Non-blocking mode, the event is signaled when every AP has returned from the callback.
+    status = globals::gEfiMpServiceProtocol->StartupAllAPs(globals::gEfiMpServiceProtocol,
+      callback,
+      false,
+      all_aps_finished,
+      0,
+      context,
+      nullptr);
+
+    if (EFI_ERROR(status))
+    {
+      gBS->CloseEvent(all_aps_finished);
+      throw std::exception{ __FUNCTION__": ""StartupAllAPs failed." };
+    }
+
+    callback(context);
+
+    UINTN event_index;
+    status = gBS->WaitForEvent(1, &all_aps_finished, &event_index);
+    gBS->CloseEvent(all_aps_finished);
+
+    if (EFI_ERROR(status))
+    {
+      throw std::exception{ __FUNCTION__": ""WaitForEvent failed." };
+    }
+  }
+
   void* physical_address_to_virtual_address(uint64_t physical_address)
   {
     // 1 to 1 mapping
@@ -230,71 +273,46 @@ namespace hh::common
     return static_cast<uint8_t*>(address)[byte] & (1 << k);
   }
 
-  uint64_t get_physical_address_for_virtual_address_by_cr3(x86::cr3_t guest_cr3, void* virtual_address_guest)
+  uint32_t try_walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+    uint64_t& physical_address, uint64_t& page_size, guest_walk_path& path) noexcept
   {
-    virtual_address va_parts = { .all = reinterpret_cast<uint64_t>(virtual_address_guest) };
-    uint64_t final_ptr;
-
-    do
-    {
-      const auto pml4 = static_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(guest_cr3.flags.page_frame_number << page_shift));
-
-      if (!pml4[va_parts.pml4_index].fields.present)
-      {
-        PRINT(("address = 0x%llx\n", virtual_address_guest));
-        throw std::exception{ __FUNCTION__": ""PML4 isn't present." };
-      }
-
-      const auto pml3 = static_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml4[va_parts.pml4_index].fields.page_frame_number << page_shift));
-
-      if (!pml3[va_parts.pdpt_index].fields.present)
-      {
-        throw std::exception{ __FUNCTION__": ""PML3 isn't present." };
-      }
-
-      if (pml3[va_parts.pdpt_index].fields.large_page)
-      {
-        final_ptr = reinterpret_cast<uint64_t>(physical_address_to_virtual_address
-        (pml3[va_parts.pdpt_index].pdpt_large.page_frame_number << page_shift_1gb));
-
-        final_ptr += va_parts.all & page_1gb_offset_mask;
-
-        break;
-      }
+    // With CR4.LA57 linear addresses are 57 bits wide and translation starts from PML5.
+    const uint32_t levels = guest_cr4.flags.linear_addresses_57_bit ? 5 : 4;
 
-      const auto pml2 = static_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml3[va_parts.pdpt_index].fields.page_frame_number << page_shift));
+    path.count = 0;
 
-      if (!pml2[va_parts.pd_index].pd.present)
+    return pt::walk_page_tables(guest_cr3.flags.page_frame_number << page_shift, levels, virtual_address,
+      [](uint64_t table_address, uint64_t index) -> const volatile uint64_t*
       {
-        throw std::exception{ __FUNCTION__": ""PML2 isn't present." };
-      }
-
-      if (pml2[va_parts.pd_index].pd.large_page)
+        return static_cast<const volatile uint64_t*>(physical_address_to_virtual_address(table_address)) + index;
+      },
+      [&path](const volatile uint64_t* entry, uint64_t value)
       {
-        final_ptr = reinterpret_cast<uint64_t>(physical_address_to_virtual_address
-        (pml2[va_parts.pd_index].pd_large.page_frame_number << page_shift_2mb));
-
-        final_ptr += va_parts.all & page_2mb_offset_mask;
-
-        break;
-      }
+        path.entries[path.count] = entry;
+        path.values[path.count] = value;
+        path.count++;
+      },
+      physical_address, page_size);
+  }
 
-      const auto pml1 = static_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml2[va_parts.pd_index].fields.page_frame_number << page_shift));
+  uint64_t walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+    uint64_t& page_size, guest_walk_path& path)
+  {
+    uint64_t physical_address;
 
-      if (!pml1[va_parts.pt_index].fields.present)
-      {
-        throw std::exception{ __FUNCTION__": ""PML1 isn't present." };
-      }
+    if (const uint32_t missing_level = try_walk_guest_page_tables(guest_cr3, guest_cr4, virtual_address, physical_address, page_size, path))
+    {
+      throw std::exception{ pt::not_present_messages[missing_level - 1] };
+    }
 
-      final_ptr = reinterpret_cast<uint64_t>(physical_address_to_virtual_address(pml1[va_parts.pt_index].fields.page_frame_number << page_shift));
-      final_ptr += va_parts.page_offset;
+    return physical_address;
+  }
 
-    } while (false);
+  uint64_t get_physical_address_for_virtual_address_by_cr3(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, void* virtual_address_guest)
+  {
+    uint64_t page_size;
+    guest_walk_path path;
 
-    return final_ptr;
+    return walk_guest_page_tables(guest_cr3, guest_cr4, reinterpret_cast<uint64_t>(virtual_address_guest), page_size, path);
   }
 }
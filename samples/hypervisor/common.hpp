@@ -6,6 +6,7 @@
 #include <type_traits>
 #include "asm.hpp"
 #include "x86.hpp"
+#include "page_walk.hpp"
 
 #define DECLSPEC_ALIGN(x)   __declspec(align(x))
 #define PANIC globals::panic_status = true; __halt
@@ -89,7 +90,7 @@ namespace hh::common
 
   struct guest_regs
   {
-    fxsave_area* fx_area;
+    void* extended_state_area;
     uint64_t rax;                  // 0x00         
     uint64_t rcx;
     uint64_t rdx;                  // 0x10
@@ -251,7 +252,10 @@ namespace hh::common
       uint64_t pd_index : 9;
       uint64_t pdpt_index : 9;
       uint64_t pml4_index : 9;
-      uint64_t unused : 16;
+
+      // Used only with 5-level paging.
+      uint64_t pml5_index : 9;
+      uint64_t unused : 7;
     };
 
     uint64_t all;
@@ -293,6 +297,9 @@ namespace hh::common
   // Use it only in boot stage. Usage after exit from boot services is prohibited.
   void run_on_all_processors(all_cpus_callback callback, void* context);
 
+  // Same as above but APs run the callback simultaneously while BSP runs it too. The callback must not use boot services.
+  void run_on_all_processors_concurrently(all_cpus_callback callback, void* context);
+
   // There is only 1 to 1 virt - phys mapping, so we don't need these functions.
   // But in the future I may add full address conversion at set_virtual_address_map_event_handler and
   // these functions would be needed in that situation.
@@ -308,7 +315,27 @@ namespace hh::common
 
   // Get chosen bit.
   uint8_t get_bit(void* address, uint64_t bit) noexcept;
-  uint64_t get_physical_address_for_virtual_address_by_cr3(x86::cr3_t guest_cr3, void* virtual_address);
+
+  // Guest paging entries visited by a successful walk, from the top level down to the leaf, with the values they had.
+  struct guest_walk_path
+  {
+    static constexpr uint32_t max_levels = pt::max_paging_levels;
+
+    const volatile uint64_t* entries[max_levels];
+    uint64_t values[max_levels];
+    uint32_t count;
+  };
+
+  // Walks guest paging structures, 4 or 5 levels deep depending on CR4.LA57. Returns 0 on success or the level
+  // of the first entry that isn't present. Page size is the size of the region mapped by the last visited entry,
+  // so on failure the caller may skip the whole unmapped region.
+  uint32_t try_walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+    uint64_t& physical_address, uint64_t& page_size, guest_walk_path& path) noexcept;
+
+  // Same as above but returns guest physical address and throws if the address isn't mapped.
+  uint64_t walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+    uint64_t& page_size, guest_walk_path& path);
+  uint64_t get_physical_address_for_virtual_address_by_cr3(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, void* virtual_address);
 
   inline constexpr uint32_t page_size = 0x1000;
   inline constexpr uint64_t size_2mb = 512 * common::page_size;
@@ -319,4 +346,6 @@ namespace hh::common
   inline constexpr uint64_t page_1gb_offset_mask = (~0ull) >> (64 - page_shift_1gb);
   inline constexpr uint64_t page_2mb_offset_mask = (~0ull) >> (64 - page_shift_2mb);
   inline constexpr uint64_t page_4kb_offset_mask = (~0ull) >> (64 - page_shift);
+  inline constexpr uint32_t paging_index_bits = 9;
+  inline constexpr uint64_t paging_index_mask = (1ull << paging_index_bits) - 1;
 }
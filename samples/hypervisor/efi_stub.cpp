@@ -5,6 +5,7 @@
 #include "common.hpp"
 #include "globals.hpp"
 #include "enum_to_str.hpp"
+#include "flight_recorder.hpp"
 
 namespace hh
 {
@@ -26,6 +27,9 @@ namespace hh
     return allocated_address;
   }
 
+  // Number of the latest VMEXITs per processor printed on bug check.
+  constexpr uint32_t bug_check_dumped_exits = 16;
+
   // Our main way to stop execution after critical error.
   void bug_check(const bug_check_codes code, const uint64_t arg0, const uint64_t arg1,
     const uint64_t arg2, const uint64_t arg3) noexcept
@@ -34,6 +38,8 @@ namespace hh
       "bugcheck args: 0x%llx, 0x%llx, 0x%llx, 0x%llx\n",
       code, enum_to_str(code).data(), arg0, arg1, arg2, arg3));
 
+    flight_recorder::dump_all(bug_check_dumped_exits);
+
     PANIC();
   }
 }
@@ -429,6 +429,7 @@ namespace hh::ept
 
   using pml4_pointer = ept_pml4;
   using pml3_pointer = epdpte;
+  using pml3_entry = epdpte_1gb;
   using pml2_entry = epde_2mb;
   using pml2_pointer = epde;
   using pml1_entry = epte;
@@ -447,37 +448,34 @@ namespace hh::ept
     // Then number of 4096 byte Page Table entries in the page table per 2MB PML2 entry when dynamically split.
     inline constexpr uint32_t pml1e_count = 512;
 
-    struct dynamic_split
+    struct dynamic_pml2
     {
-      //The 4096 byte page table entries that correspond to the split 2MB table entry.
-      DECLSPEC_ALIGN(common::page_size) pml1_entry pml1[pml1e_count];
+      // The 2MB page directory entries that correspond to the split 1GB table entry.
+      DECLSPEC_ALIGN(common::page_size) pml2_entry pml2[pml2e_count];
 
-      //The pointer to the 2MB entry in the page table which this split is servicing.
+      // The pointer to the 1GB entry in the page table which this split is servicing.
       union
       {
-        pml2_entry* entry;
-        pml2_pointer* pointer;
+        pml3_entry* entry;
+        pml3_pointer* pointer;
       };
     };
 
-    struct page_table
+    struct dynamic_pml3
     {
       /**
-        * 28.2.2 Describes 512 contiguous 512GB memory regions each with 512 1GB regions.
+        * Describes 512 contiguous 1GB memory regions within a 512GB PML4 region. It is allocated only for PML4 regions
+        * that contain physical memory. Regions with uniform memory type are mapped by 1GB pages, the rest point to dynamic_pml2 tables.
         */
-      DECLSPEC_ALIGN(common::page_size) pml4_pointer pml4[pml4e_count];
-
-      /**
-        * Describes exactly 512 contiguous 1GB memory regions within a our singular 512GB PML4 region.
-        */
-      DECLSPEC_ALIGN(common::page_size) pml3_pointer pml3[pml3e_count];
+      DECLSPEC_ALIGN(common::page_size) pml3_entry pml3[pml3e_count];
+    };
 
+    struct page_table
+    {
       /**
-        * For each 1GB PML3 entry, create 512 2MB entries to map identity.
-        * NOTE: We are using 2MB pages as the smallest paging size in our map, so we do not manage individiual 4096 byte pages.
-        * Therefore, we do not allocate any PML1 (4096 byte) paging structures.
+        * 28.2.2 Describes 512 contiguous 512GB memory regions each with 512 1GB regions.
         */
-      DECLSPEC_ALIGN(common::page_size) pml2_entry pml2[pml3e_count][pml2e_count];
+      DECLSPEC_ALIGN(common::page_size) pml4_pointer pml4[pml4e_count];
     };
   }
 
@@ -526,17 +524,8 @@ namespace hh::ept
     uint64_t reserved; // Must be zero.
   };
 
-  struct mttr_range_descriptor
-  {
-    uint64_t physical_base_address;
-    uint64_t physical_end_address;
-    memory_type memory_type;
-  };
-
   struct ept_state
   {
-    mttr_range_descriptor memory_ranges[9];	// Physical memory ranges described by the BIOS in the MTRRs. Used to build the EPT identity mapping.
-    uint32_t number_of_enabled_memory_ranges;	// Number of memory ranges specified in MemoryRanges
     eptp ept_pointer;	// Extended-Page-Table Pointer 
     vmm::page_table* ept_page_table;  // Page table entries for EPT operation
   };
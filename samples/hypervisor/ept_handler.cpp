@@ -10,6 +10,7 @@
 #include "hooking_common.hpp"
 #include "memory_manager.hpp"
 #include "per_cpu_data.hpp"
+#include "tlb_shootdown.hpp"
 #include "vcpu.hpp"
 #include "win_defs.hpp"
 
@@ -18,9 +19,12 @@ namespace hh
 {
   namespace ept
   {
-    ept_handler::ept_handler()
+    ept_handler::ept_handler() : pml1_tables_{ pml1_pool_capacity_ }, next_identity_region_{}, pml3_large_pages_supported_{}
     {
       is_ept_features_supported();
+
+      // Without 1GB pages every region of the identity map is described by 2MB pages.
+      pml3_large_pages_supported_ = x86::msr::read<x86::msr::vmx_ept_vpid_cap_register_t>().flags.pdpte_1gb_pages;
     }
 
     // Throws if it is not possible to use EPT on this CPU
@@ -63,6 +67,18 @@ namespace hh
     // vmexits related to EPT hooks.
     void ept_handler::split_large_page(uint64_t physical_address)
     {
+      const common::spinlock_guard lock{ &identity_map_lock_ };
+
+      map_identity_region(physical_address >> common::page_shift_1gb);
+
+      pml3_entry* target_region = get_pml3_entry(physical_address);
+
+      // 1GB page is split to 2MB pages first.
+      if (target_region->large_page)
+      {
+        split_pml3_entry(target_region, physical_address >> common::page_shift_1gb);
+      }
+
       pml2_entry* target_entry = get_pml2_entry(physical_address);
 
       // If this large page is not marked a large page, that means it's a pointer already.
@@ -72,66 +88,213 @@ namespace hh
         return;
       }
 
-      std::shared_ptr<ept::vmm::dynamic_split> pre_allocated_buff{ new (std::align_val_t{ common::page_size }) ept::vmm::dynamic_split{} };
+      split_pml2_entry(target_entry, false);
+    }
 
-      pre_allocated_buff->entry = target_entry;
+    // Points 2MB page entry to 512 4KB pages that map the same region. Memory type of every 4KB page is resolved from MTRRs,
+    // so it is also used for 2MB pages with mixed memory types.
+    void ept_handler::split_pml2_entry(pml2_entry* target_entry, bool mixed_memory_type)
+    {
+      uint32_t table_index;
+
+      {
+        const common::spinlock_guard lock{ &tables_lock_ };
+        table_index = pml1_tables_.acquire(target_entry, mixed_memory_type);
+      }
+
+      pml1_entry* pml1 = pml1_tables_.entries(table_index);
 
       pml1_entry entry_template = {};
       entry_template.read_access = 1;
       entry_template.write_access = 1;
       entry_template.execute_access = 1;
-      entry_template.memory_type = target_entry->memory_type;
       entry_template.ignore_pat = target_entry->ignore_pat;
       entry_template.suppress_ve = target_entry->suppress_ve;
 
-      __stosq(reinterpret_cast<uint64_t*>(&pre_allocated_buff->pml1[0]), entry_template.flags, vmm::pml1e_count);
+      __stosq(reinterpret_cast<uint64_t*>(pml1), entry_template.flags, vmm::pml1e_count);
 
       for (uint32_t entry_index = 0; entry_index < vmm::pml1e_count; entry_index++)
       {
-        pre_allocated_buff->pml1[entry_index].page_frame_number = (target_entry->page_frame_number * common::size_2mb) / common::page_size + entry_index;
+        const uint64_t page_frame_number = (target_entry->page_frame_number * common::size_2mb) / common::page_size + entry_index;
+
+        pml1[entry_index].page_frame_number = page_frame_number;
+        pml1[entry_index].memory_type = static_cast<uint64_t>(mtrrs_.get_memory_type(page_frame_number * common::page_size));
       }
 
       pml2_pointer new_pointer = {};
       new_pointer.write_access = 1;
       new_pointer.read_access = 1;
       new_pointer.execute_access = 1;
-      new_pointer.page_frame_number = common::virtual_address_to_physical_address(&pre_allocated_buff->pml1[0]) / common::page_size;
+      new_pointer.page_frame_number = pml1_tables_.physical_address(table_index) / common::page_size;
 
       memcpy(target_entry, &new_pointer, sizeof(new_pointer));
-      splitted_pml2_.push_back(pre_allocated_buff);
     }
 
-    ept::pml2_entry* ept_handler::get_pml2_entry(uint64_t physical_address)
+    // Maps 2MB region split by split_large_page with a large page again, e.g. when its last hook is removed.
+    // Returns false if the region has mixed memory types or some of its 4KB pages is still changed.
+    // The PML1 table is retired and can be reused only after release_retired_tables.
+    bool ept_handler::coalesce_large_page(uint64_t physical_address)
+    {
+      const common::spinlock_guard lock{ &identity_map_lock_ };
+
+      const pml3_entry* target_region = get_pml3_entry(physical_address);
+
+      if (!target_region->read_access || target_region->large_page)
+      {
+        return false;
+      }
+
+      pml2_entry* target_entry = get_pml2_entry(physical_address);
+
+      if (target_entry->large_page)
+      {
+        return false;
+      }
+
+      const uint32_t table_index = pml1_tables_.index_of(reinterpret_cast<pml2_pointer*>(target_entry)->page_frame_number * common::page_size);
+
+      if (table_index == pml1_pool::invalid_index || pml1_tables_.metadata(table_index).mixed_memory_type)
+      {
+        return false;
+      }
+
+      const pml1_entry* pml1 = pml1_tables_.entries(table_index);
+      const uint64_t first_page_frame_number = (physical_address >> common::page_shift_2mb) * vmm::pml1e_count;
+
+      // Every 4KB page must be identity mapped with full access and the same attributes, as split_pml2_entry has left it.
+      for (uint32_t entry_index = 0; entry_index < vmm::pml1e_count; entry_index++)
+      {
+        const pml1_entry& entry = pml1[entry_index];
+
+        if (entry.page_frame_number != first_page_frame_number + entry_index || !entry.read_access || !entry.write_access
+          || !entry.execute_access || entry.memory_type != pml1[0].memory_type || entry.ignore_pat != pml1[0].ignore_pat
+          || entry.suppress_ve != pml1[0].suppress_ve)
+        {
+          return false;
+        }
+      }
+
+      pml2_entry new_entry = {};
+      new_entry.read_access = 1;
+      new_entry.write_access = 1;
+      new_entry.execute_access = 1;
+      new_entry.large_page = 1;
+      new_entry.memory_type = pml1[0].memory_type;
+      new_entry.ignore_pat = pml1[0].ignore_pat;
+      new_entry.suppress_ve = pml1[0].suppress_ve;
+      new_entry.page_frame_number = physical_address >> common::page_shift_2mb;
+
+      // Single store, the old and the new entry translate every address the same way.
+      target_entry->flags = new_entry.flags;
+      pml1_tables_.retire(table_index);
+
+      return true;
+    }
+
+    // Retired tables may still be cached in paging-structure caches of other processors, so they are
+    // released to the pool only after INVEPT on every processor. It also drops 4KB translations of coalesced pages.
+    // Returns false if some processor didn't acknowledge, tables stay retired then.
+    bool ept_handler::release_retired_tables() noexcept
+    {
+      uint32_t retired_chain;
+
+      {
+        const common::spinlock_guard lock{ &identity_map_lock_ };
+
+        if (!pml1_tables_.has_retired())
+        {
+          return true;
+        }
+
+        retired_chain = pml1_tables_.detach_retired();
+      }
+
+      // Shootdown is performed without the lock, processors that wait for it can't ack.
+      bool invalidated = true;
+
+      try
+      {
+        globals::shootdown_handler->invalidate_ept(ept_state_.ept_pointer.flags);
+      }
+      catch (std::exception& e)
+      {
+        PRINT(("Retired PML1 tables are kept. %a\n", e.what()));
+        invalidated = false;
+      }
+
+      const common::spinlock_guard lock{ &identity_map_lock_ };
+
+      if (invalidated)
+      {
+        pml1_tables_.release(retired_chain);
+      }
+      else
+      {
+        pml1_tables_.retire_chain(retired_chain);
+      }
+
+      return invalidated;
+    }
+
+    void ept_handler::reclaim_tables_if_exhausted() noexcept
+    {
+      bool exhausted;
+
+      {
+        const common::spinlock_guard lock{ &identity_map_lock_ };
+        exhausted = pml1_tables_.exhausted() && pml1_tables_.has_retired();
+      }
+
+      if (exhausted)
+      {
+        release_retired_tables();
+      }
+    }
+
+    ept::pml3_entry* ept_handler::get_pml3_entry(uint64_t physical_address)
     {
       ept_address gpa = { .all = physical_address };
 
-      const uint64_t directory = gpa.pml2_index;
-      const uint64_t directory_pointer = gpa.pml3_index;
-      const uint64_t pml4_entry = gpa.pml4_index;
+      const pml4_pointer& pml4 = ept_state_.ept_page_table->pml4[gpa.pml4_index];
 
-      // Addresses above 512GB are invalid because it is > physical address bus width 
-      if (pml4_entry > 0)
+      // PML3 tables exist only for 512GB regions that contain physical memory.
+      if (!pml4.read_access)
       {
-        throw std::exception{ __FUNCTION__": ""Invalid physical address passed." };
+        throw std::exception{ __FUNCTION__": ""Physical address isn't mapped." };
       }
 
-      return &ept_state_.ept_page_table->pml2[directory_pointer][directory];
+      pml3_entry* pml3 = reinterpret_cast<pml3_entry*>(common::physical_address_to_virtual_address(pml4.page_frame_number * common::page_size));
+
+      return &pml3[gpa.pml3_index];
     }
 
-    pml1_entry* ept_handler::get_pml1_entry(uint64_t physical_address)
+    ept::pml2_entry* ept_handler::get_pml2_entry(uint64_t physical_address)
     {
       ept_address gpa = { .all = physical_address };
 
-      const uint64_t directory = gpa.pml2_index;
-      const uint64_t directory_pointer = gpa.pml3_index;
-      const uint64_t pml4_entry = gpa.pml4_index;
+      pml3_entry* pml3 = get_pml3_entry(physical_address);
 
-      if (pml4_entry > 0)
+      if (!pml3->read_access)
       {
-        throw std::exception{ __FUNCTION__": ""Invalid physical address passed." };
+        throw std::exception{ __FUNCTION__": ""Physical address isn't mapped." };
+      }
+
+      if (pml3->large_page)
+      {
+        throw std::exception{ __FUNCTION__": ""1GB page wasn't splitted. Cannot return pml2 entry." };
       }
 
-      pml2_entry* pml2 = &ept_state_.ept_page_table->pml2[directory_pointer][directory];
+      const pml3_pointer* pml3_p = reinterpret_cast<pml3_pointer*>(pml3);
+      pml2_entry* pml2 = reinterpret_cast<pml2_entry*>(common::physical_address_to_virtual_address(pml3_p->page_frame_number * common::page_size));
+
+      return &pml2[gpa.pml2_index];
+    }
+
+    pml1_entry* ept_handler::get_pml1_entry(uint64_t physical_address)
+    {
+      ept_address gpa = { .all = physical_address };
+
+      pml2_entry* pml2 = get_pml2_entry(physical_address);
 
       // Check to ensure the page is split 
       if (pml2->large_page)
@@ -176,10 +339,10 @@ namespace hh
       }
     }
 
-    void ept_handler::initialize_ept()
+    void ept_handler::initialize_ept(const std::vector<memory_map::physical_range>& physical_ranges)
     {
       build_mttr_map();
-      create_identity_page_table();
+      create_identity_page_table(physical_ranges);
 
       eptp eptp = {};
 
@@ -202,172 +365,231 @@ namespace hh
       ept_state_.ept_pointer = eptp;
     }
 
-    void ept_handler::setup_pml2_entry(pml2_entry* new_entry, uint64_t page_frame_number) const noexcept
+    // Returns false if memory type isn't the same over the whole 2MB page, such page must be split to 4KB pages.
+    bool ept_handler::setup_pml2_entry(pml2_entry* new_entry, uint64_t page_frame_number) const noexcept
     {
-      /*
-      Each of the 512 collections of 512 PML2 entries is setup here.
-      This will, in total, identity map every physical address from 0x0 to physical address 0x8000000000 (512GB of memory)
-
-      ((entry_group_index * vmm::pml2e_count) + entry_index) * 2MB is the actual physical address we're mapping
-      */
       new_entry->page_frame_number = page_frame_number;
 
-      // Size of 2MB page * page_frame_number == address_of_page (physical memory). 
-      const uint64_t address_of_page = page_frame_number * common::size_2mb;
+      memory_type target_memory_type;
 
-      /* To be safe, we will map the first page as UC as to not bring up any kind of undefined behavior from the
-      fixed MTRR section which we are not formally recognizing (typically there is MMIO memory in the first MB).
-
-      I suggest reading up on the fixed MTRR section of the manual to see why the first entry is likely going to need to be UC.
-      */
-      if (page_frame_number == 0)
+      if (!mtrrs_.get_uniform_memory_type(page_frame_number * common::size_2mb, common::size_2mb, target_memory_type))
       {
         new_entry->memory_type = static_cast<uint64_t>(memory_type::uncacheable);
 
-        return;
+        return false;
       }
 
-      // Default memory type is always WB for performance. 
-      memory_type target_memory_type = memory_type::write_back;
+      new_entry->memory_type = static_cast<uint64_t>(target_memory_type);
+
+      return true;
+    }
+
+    // Points PML3 entry to 512 2MB pages that map the same 1GB region. It is used for regions with mixed memory types
+    // and for 1GB pages that contain hooks. 2MB pages with mixed memory types are split to 4KB pages right away.
+    // Split of a mapped page keeps translations and memory types unchanged.
+    void ept_handler::split_pml3_entry(pml3_entry* target_entry, uint64_t region_index)
+    {
+      std::shared_ptr<vmm::dynamic_pml2> pre_allocated_buff{ new (std::align_val_t{ common::page_size }) vmm::dynamic_pml2{} };
+
+      pre_allocated_buff->entry = target_entry;
+
+      pml2_entry pml2_template = {};
+      pml2_template.read_access = 1;
+      pml2_template.write_access = 1;
+      pml2_template.execute_access = 1;
+      pml2_template.large_page = 1;
 
-      // For each MTRR range 
-      for (uint64_t current_mttr_range = 0; current_mttr_range < ept_state_.number_of_enabled_memory_ranges; current_mttr_range++)
+      __stosq(reinterpret_cast<uint64_t*>(&pre_allocated_buff->pml2[0]), pml2_template.flags, vmm::pml2e_count);
+
+      for (uint64_t entry_index = 0; entry_index < vmm::pml2e_count; entry_index++)
       {
-        // If this page's address is below or equal to the max physical address of the range 
-        if (address_of_page <= ept_state_.memory_ranges[current_mttr_range].physical_end_address)
+        if (!setup_pml2_entry(&pre_allocated_buff->pml2[entry_index], region_index * vmm::pml2e_count + entry_index))
         {
-          // And this page's last address is above or equal to the base physical address of the range 
-          if ((address_of_page + common::size_2mb - 1) >= ept_state_.memory_ranges[current_mttr_range].physical_base_address)
-          {
-            /* If we're here, this page fell within one of the ranges specified by the variable MTRRs
-            Therefore, we must mark this page as the same cache type exposed by the MTRR
-            */
-            target_memory_type = ept_state_.memory_ranges[current_mttr_range].memory_type;
-
-            // 11.11.4.1 MTRR Precedences 
-            if (target_memory_type == ept::memory_type::uncacheable)
-            {
-              // If this is going to be marked uncacheable, then we stop the search as UC always takes precedent. 
-              break;
-            }
-          }
+          split_pml2_entry(&pre_allocated_buff->pml2[entry_index], true);
         }
       }
 
-      // Finally, commit the memory type to the entry. 
-      new_entry->memory_type = static_cast<uint64_t>(target_memory_type);
+      pml3_pointer new_pointer = {};
+      new_pointer.read_access = 1;
+      new_pointer.write_access = 1;
+      new_pointer.execute_access = 1;
+      new_pointer.page_frame_number = common::virtual_address_to_physical_address(&pre_allocated_buff->pml2[0]) / common::page_size;
+
+      memcpy(target_entry, &new_pointer, sizeof(new_pointer));
+
+      const common::spinlock_guard lock{ &tables_lock_ };
+      splitted_pml3_.push_back(pre_allocated_buff);
     }
 
-    void ept_handler::create_identity_page_table()
+    // Returns PML3 entry of the region. PML3 table is allocated if the PML4 entry of the region has none yet.
+    pml3_entry* ept_handler::get_or_allocate_pml3_table(uint64_t region_index)
     {
-      // Allocate address anywhere in the OS's memory space
-      const physical_address_t max_size = { .QuadPart = static_cast<long long>((std::numeric_limits<unsigned long long>::max)()) };
+      if (region_index / vmm::pml3e_count >= vmm::pml4e_count)
+      {
+        throw std::exception{ __FUNCTION__": ""Physical address is out of EPT range." };
+      }
 
-      // Allocate all paging structures as 4KB aligned pages
-      auto* page_table = new (std::align_val_t(common::page_size)) vmm::page_table{};
+      pml4_pointer& pml4 = ept_state_.ept_page_table->pml4[region_index / vmm::pml3e_count];
 
-      // Mark the first 512GB PML4 entry as present, which allows us to manage up to 512GB of discrete paging structures. 
-      page_table->pml4[0].page_frame_number = common::virtual_address_to_physical_address(&page_table->pml3[0]) / common::page_size;
-      page_table->pml4[0].read_access = 1;
-      page_table->pml4[0].write_access = 1;
-      page_table->pml4[0].execute_access = 1;
+      if (!pml4.read_access)
+      {
+        std::shared_ptr<vmm::dynamic_pml3> pml3_table{ new (std::align_val_t{ common::page_size }) vmm::dynamic_pml3{} };
 
-      /* Now mark each 1GB PML3 entry as RWX and map each to their PML2 entry */
+        pml4_pointer new_pointer = {};
+        new_pointer.read_access = 1;
+        new_pointer.write_access = 1;
+        new_pointer.execute_access = 1;
+        new_pointer.page_frame_number = common::virtual_address_to_physical_address(&pml3_table->pml3[0]) / common::page_size;
 
-      // Ensure stack memory is cleared
-      pml3_pointer rwx_template = {};
+        pml4.flags = new_pointer.flags;
 
-      // Set up one 'template' RWX PML3 entry and copy it into each of the 512 PML3 entries 
-      // Using the same method as SimpleVisor for copying each entry using intrinsics. 
-      rwx_template.read_access = 1;
-      rwx_template.write_access = 1;
-      rwx_template.execute_access = 1;
+        const common::spinlock_guard lock{ &tables_lock_ };
+        pml3_tables_.push_back(pml3_table);
+      }
 
-      // Copy the template into each of the 512 PML3 entry slots 
-      __stosq(reinterpret_cast<uint64_t*>(&page_table->pml3[0]), rwx_template.flags, vmm::pml3e_count);
+      return &reinterpret_cast<pml3_entry*>(
+        common::physical_address_to_virtual_address(pml4.page_frame_number * common::page_size))[region_index % vmm::pml3e_count];
+    }
+
+    // Identity maps 1GB region with a single 1GB page if its memory type is uniform, otherwise with 2MB pages.
+    // Returns false if the region is already mapped.
+    bool ept_handler::map_identity_region(uint64_t region_index)
+    {
+      pml3_entry* target_entry = get_or_allocate_pml3_table(region_index);
 
-      for (uint64_t entry_index = 0; entry_index < vmm::pml3e_count; entry_index++)
+      if (target_entry->read_access)
       {
-        // Map the 1GB PML3 entry to 512 PML2 (2MB) entries to describe each large page.
-        // NOTE: We do *not* manage any PML1 (4096 byte) entries and do not allocate them.
-        page_table->pml3[entry_index].page_frame_number = common::virtual_address_to_physical_address(&page_table->pml2[entry_index][0]) / common::page_size;
+        return false;
       }
 
-      pml2_entry pml2_template = {};
+      memory_type target_memory_type;
 
-      pml2_template.read_access = 1;
-      pml2_template.write_access = 1;
-      pml2_template.execute_access = 1;
+      if (pml3_large_pages_supported_ && mtrrs_.get_uniform_memory_type(region_index * common::size_1gb, common::size_1gb, target_memory_type))
+      {
+        pml3_entry new_entry = {};
+        new_entry.read_access = 1;
+        new_entry.write_access = 1;
+        new_entry.execute_access = 1;
+        new_entry.large_page = 1;
+        new_entry.memory_type = static_cast<uint64_t>(target_memory_type);
+        new_entry.page_frame_number = region_index;
+
+        // Single store, so processors walking the table never see a partially built entry.
+        target_entry->flags = new_entry.flags;
+      }
+      else
+      {
+        split_pml3_entry(target_entry, region_index);
+      }
 
-      // We are using 2MB large pages, so we must mark this 1 here. 
-      pml2_template.large_page = 1;
+      return true;
+    }
 
-      /* For each collection of 512 PML2 entries (512 collections * 512 entries per collection), mark it RWX using the same template above.
-      This marks the entries as "Present" regardless of if the actual system has memory at this region or not. We will cause a fault in our
-      EPT handler if the guest access a page outside a usable range, despite the EPT frame being present here.
+    // Maps 1GB region that is absent in the firmware memory map, e.g. 64-bit PCI BARs, on the first access.
+    // Returns false if the region is already mapped. Translations which were not present aren't cached, so no INVEPT is needed.
+    bool ept_handler::map_absent_region(uint64_t physical_address)
+    {
+      const common::spinlock_guard lock{ &identity_map_lock_ };
+
+      return map_identity_region(physical_address >> common::page_shift_1gb);
+    }
+
+    void ept_handler::create_identity_page_table(const std::vector<memory_map::physical_range>& physical_ranges)
+    {
+      // Allocate all paging structures as 4KB aligned pages
+      ept_state_.ept_page_table = new (std::align_val_t(common::page_size)) vmm::page_table{};
+
+      /* Only 1GB regions from the firmware memory map are mapped. PML3 tables are allocated here only for
+      512GB regions that contain them, regions themselves are mapped by all processors in map_identity_regions.
+      Each region is mapped by a single 1GB page if the whole region has the same memory type, otherwise it is
+      split to 2MB pages. 4KB pages are created later on demand by split_large_page.
       */
-      __stosq(reinterpret_cast<uint64_t*>(&page_table->pml2[0]), pml2_template.flags, vmm::pml3e_count * vmm::pml2e_count);
+      identity_regions_.clear();
 
-      // For each of the 512 collections of 512 2MB PML2 entries 
-      for (uint64_t entry_group_index = 0; entry_group_index < vmm::pml3e_count; entry_group_index++)
+      for (const memory_map::physical_range& range : physical_ranges)
       {
-        for (uint64_t entry_index = 0; entry_index < vmm::pml2e_count; entry_index++)
+        for (uint64_t region_index = range.base >> common::page_shift_1gb; region_index < range.end >> common::page_shift_1gb; region_index++)
         {
-          setup_pml2_entry(&page_table->pml2[entry_group_index][entry_index], entry_group_index * vmm::pml2e_count + entry_index);
+          get_or_allocate_pml3_table(region_index);
+          identity_regions_.push_back(region_index);
         }
       }
 
-      ept_state_.ept_page_table = page_table;
+      next_identity_region_.store(0, std::memory_order_relaxed);
     }
 
-    void ept_handler::build_mttr_map() noexcept
+    // PML4 entries of all regions are already present, so processors touch only PML3 entries of their own regions.
+    uint32_t ept_handler::map_identity_regions()
     {
-      const x86::msr::mttr_capabilities_register_t mttr_cap = x86::msr::read<x86::msr::mttr_capabilities_register_t>();
+      uint32_t regions_count = 0;
 
-      x86::msr::mtrr_physbase_register_t current_phys_base;
-      x86::msr::mtrr_physmask_register_t current_phys_mask;
-      mttr_range_descriptor descriptor;
-
-      for (uint32_t current_register = 0; current_register < mttr_cap.flags.variable_range_count; current_register++)
+      for (uint32_t region = next_identity_region_.fetch_add(1, std::memory_order_relaxed); region < identity_regions_.size();
+        region = next_identity_region_.fetch_add(1, std::memory_order_relaxed))
       {
-        // For each dynamic register pair
-        current_phys_base = x86::msr::read<x86::msr::mtrr_physbase_register_t>(current_register * 2);
-        current_phys_mask = x86::msr::read<x86::msr::mtrr_physmask_register_t>(current_register * 2);
+        map_identity_region(identity_regions_[region]);
+        regions_count++;
+      }
 
-        // Is the range enabled?
-        if (current_phys_mask.flags.valid)
-        {
-          // We only need to read these once because the ISA dictates that MTRRs are to be synchronized between all processors
-          // during BIOS initialization.
-          descriptor = ept_state_.memory_ranges[ept_state_.number_of_enabled_memory_ranges++];
+      return regions_count;
+    }
+
+    void ept_handler::complete_identity_map()
+    {
+      PRINT(("EPT identity map: %d 1GB regions, %d PML3 tables, %d regions are split to 2MB pages, %d of %d PML1 tables are used.\n",
+        static_cast<uint32_t>(identity_regions_.size()), static_cast<uint32_t>(pml3_tables_.size()), static_cast<uint32_t>(splitted_pml3_.size()),
+        pml1_tables_.in_use_count(), pml1_tables_.capacity()));
 
-          // Calculate the base address in bytes
-          descriptor.physical_base_address = current_phys_base.flags.page_frame_number * common::page_size;
+      identity_regions_.clear();
+      identity_regions_.shrink_to_fit();
+    }
 
-          // Calculate the total size of the range
-          // The lowest bit of the mask that is set to 1 specifies the size of the range
-          uint32_t number_of_bits_in_mask;
-          _BitScanForward64(reinterpret_cast<unsigned long*>(&number_of_bits_in_mask), current_phys_mask.flags.page_frame_number * common::page_size);
+    // MTRRs are synchronized between all processors during BIOS initialization, so they are read only once.
+    void ept_handler::build_mttr_map()
+    {
+      const x86::msr::mttr_capabilities_register_t mttr_cap = x86::msr::read<x86::msr::mttr_capabilities_register_t>();
+      x86::msr::def_type_register_t mttr_def_type = x86::msr::read<x86::msr::def_type_register_t>();
 
-          // Size of the range in bytes + Base Address
-          descriptor.physical_end_address = descriptor.physical_base_address + ((1ull << number_of_bits_in_mask) - 1ull);
+      mtrrs_.set_def_type(mttr_def_type.all);
 
-          // Memory Type (cacheability attributes)
-          descriptor.memory_type = static_cast<memory_type>(current_phys_base.flags.type);
+      if (mttr_cap.flags.fixed_range_supported)
+      {
+        uint32_t fixed_msr_index = 0;
 
-          if (descriptor.memory_type == memory_type::write_back)
-          {
-            /* This is already our default, so no need to store this range.
-            * Simply 'free' the range we just wrote. */
-            ept_state_.number_of_enabled_memory_ranges--;
-          }
+        mtrrs_.set_fixed_msr(fixed_msr_index++, x86::msr::read<x86::msr::mtrr_fix64k>());
 
-          PRINT(("MTRR Range: Base=0x%llx End=0x%llx Type=0x%x\n",
-            descriptor.physical_base_address, descriptor.physical_end_address, descriptor.memory_type));
+        for (uint32_t j = 0; j < 2; j++)
+        {
+          mtrrs_.set_fixed_msr(fixed_msr_index++, x86::msr::read<x86::msr::mtrr_fix16k>(j));
         }
+
+        for (uint32_t j = 0; j < 8; j++)
+        {
+          mtrrs_.set_fixed_msr(fixed_msr_index++, x86::msr::read<x86::msr::mtrr_fix4k>(j));
+        }
+      }
+      else
+      {
+        // Fixed ranges can't be enabled without fixed range MTRRs.
+        mttr_def_type.flags.fixed_range_mtrr_enable = 0;
+        mtrrs_.set_def_type(mttr_def_type.all);
+      }
+
+      for (uint32_t current_register = 0; current_register < mttr_cap.flags.variable_range_count; current_register++)
+      {
+        // For each dynamic register pair
+        const x86::msr::mtrr_physbase_register_t current_phys_base = x86::msr::read<x86::msr::mtrr_physbase_register_t>(current_register * 2);
+        const x86::msr::mtrr_physmask_register_t current_phys_mask = x86::msr::read<x86::msr::mtrr_physmask_register_t>(current_register * 2);
+
+        mtrrs_.add_variable_msrs(current_phys_base.all, current_phys_mask.all);
+      }
+
+      for (const mtrr::resolver::variable_range& range : mtrrs_.variable_ranges())
+      {
+        PRINT(("MTRR Range: Base=0x%llx Mask=0x%llx Type=0x%x\n", range.base, range.mask, range.type));
       }
 
-      PRINT(("Total MTRR Ranges Committed: %d\n", ept_state_.number_of_enabled_memory_ranges));
+      PRINT(("Default memory type 0x%x, fixed ranges are %a, %d variable ranges committed.\n", mttr_def_type.flags.default_memory_type,
+        mttr_def_type.flags.fixed_range_mtrr_enable ? "enabled" : "disabled", static_cast<uint32_t>(mtrrs_.variable_ranges().size())));
     }
   }
 
@@ -1,9 +1,14 @@
 #pragma once
 #include <list>
+#include <atomic>
+#include <vector>
 #include "ept.hpp"
 #include "delete_constructors.hpp"
 #include "pt.hpp"
 #include "vpid.hpp"
+#include "memory_map.hpp"
+#include "mtrr.hpp"
+#include "pml1_pool.hpp"
 
 namespace hh
 {
@@ -19,21 +24,51 @@ namespace hh
     {
     private:
       ept_state ept_state_;
-      std::list<std::shared_ptr<vmm::dynamic_split>> splitted_pml2_;
+      mtrr::resolver mtrrs_;
+      pml1_pool pml1_tables_;
+      std::list<std::shared_ptr<vmm::dynamic_pml2>> splitted_pml3_;
+      std::list<std::shared_ptr<vmm::dynamic_pml3>> pml3_tables_;
+      std::vector<uint64_t> identity_regions_;
+      std::atomic<uint32_t> next_identity_region_;
+      bool pml3_large_pages_supported_;
+      volatile long identity_map_lock_ = {};
+
+      // Guards lists of tables and the PML1 pool while all processors build the identity map.
+      volatile long tables_lock_ = {};
       volatile long pml1_modification_and_invalidation_lock_ = {};
 
     private:
-      void setup_pml2_entry(pml2_entry* new_entry, uint64_t page_frame_number) const noexcept;
-      void create_identity_page_table();
-      void build_mttr_map() noexcept;
+      // Up to 512 2MB pages may be split at once, tables of the pool take 2MB.
+      static constexpr uint32_t pml1_pool_capacity_ = 512;
+
+    private:
+      bool setup_pml2_entry(pml2_entry* new_entry, uint64_t page_frame_number) const noexcept;
+      void split_pml2_entry(pml2_entry* target_entry, bool mixed_memory_type);
+      void split_pml3_entry(pml3_entry* target_entry, uint64_t region_index);
+      pml3_entry* get_or_allocate_pml3_table(uint64_t region_index);
+      bool map_identity_region(uint64_t region_index);
+      void create_identity_page_table(const std::vector<memory_map::physical_range>& physical_ranges);
+      void build_mttr_map();
       void is_ept_features_supported() const;
 
     public:
       ept_handler();
-      void initialize_ept();
+      void initialize_ept(const std::vector<memory_map::physical_range>& physical_ranges);
+
+      // Called on every processor after initialize_ept, each one takes the next unmapped region until none is left.
+      // Returns the number of regions mapped by the calling processor.
+      uint32_t map_identity_regions();
+      void complete_identity_map();
+      bool map_absent_region(uint64_t physical_address);
       eptp get_eptp() const noexcept;
       void set_pml1_and_invalidate_tlb(pml1_entry* entry_address, pml1_entry entry_value, vmx::invvpid_type invalidation_type) noexcept;
       void split_large_page(uint64_t physical_address);
+      bool coalesce_large_page(uint64_t physical_address);
+      bool release_retired_tables() noexcept;
+
+      // Must be called before split_large_page without locks that other processors may wait for in root mode.
+      void reclaim_tables_if_exhausted() noexcept;
+      pml3_entry* get_pml3_entry(uint64_t physical_address);
       pml2_entry* get_pml2_entry(uint64_t physical_address);
       pml1_entry* get_pml1_entry(uint64_t physical_address);
       ~ept_handler() noexcept;
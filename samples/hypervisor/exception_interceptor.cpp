@@ -0,0 +1,87 @@
+#include "exception_interceptor.hpp"
+#include <exception>
+#include "vcpu.hpp"
+#include "per_cpu_data.hpp"
+
+namespace hh
+{
+  exception_interceptor::exception_interceptor() noexcept : interceptions_{}, interceptions_count_{}
+  {}
+
+  void exception_interceptor::intercept(exception_vector vector, handler_routine handler, predicate_routine predicate, bool one_shot)
+  {
+    if (interceptions_count_ == max_interceptions)
+    {
+      throw std::exception{ __FUNCTION__": ""Too many exception interceptions." };
+    }
+
+    if (static_cast<uint32_t>(vector) >= 32 || vector == exception_vector::nmi_interrupt)
+    {
+      throw std::exception{ __FUNCTION__": ""Vector can't be intercepted through exception bitmap." };
+    }
+
+    interception& entry = interceptions_[interceptions_count_++];
+
+    entry.vector = vector;
+    entry.handler = handler;
+    entry.predicate = predicate;
+    entry.one_shot = one_shot;
+    entry.served = false;
+  }
+
+  vmx::exception_bitmap exception_interceptor::initial_bitmap() const noexcept
+  {
+    vmx::exception_bitmap bitmap = {};
+
+    for (uint32_t j = 0; j < interceptions_count_; j++)
+    {
+      if (!interceptions_[j].served.load(std::memory_order_relaxed))
+      {
+        bitmap.flags |= 1u << static_cast<uint32_t>(interceptions_[j].vector);
+      }
+    }
+
+    return bitmap;
+  }
+
+  bool exception_interceptor::dispatch(exception_vector vector, common::guest_regs* regs, vcpu* cpu_obj)
+  {
+    bool consumed = false;
+    bool armed = false;
+
+    for (uint32_t j = 0; j < interceptions_count_; j++)
+    {
+      interception& entry = interceptions_[j];
+
+      if (entry.vector != vector || entry.served.load(std::memory_order_acquire))
+      {
+        continue;
+      }
+
+      if (!consumed && (entry.predicate == nullptr || entry.predicate(regs, cpu_obj)))
+      {
+        // Only one vcpu serves one shot interception, others just reinject the exception.
+        if (!entry.one_shot || !entry.served.exchange(true, std::memory_order_acq_rel))
+        {
+          consumed = entry.handler(regs, cpu_obj);
+        }
+      }
+
+      if (!entry.served.load(std::memory_order_relaxed))
+      {
+        armed = true;
+      }
+    }
+
+    if (!armed)
+    {
+      vmx::exception_bitmap bitmap = cpu_obj->exception_bitmap();
+      bitmap.flags &= ~(1u << static_cast<uint32_t>(vector));
+      cpu_obj->exception_bitmap(bitmap);
+
+      PRINT(("Exception vector %d is no longer intercepted on processor #%d\n", static_cast<uint32_t>(vector), per_cpu_data::get_cpu_id()));
+    }
+
+    return consumed;
+  }
+}
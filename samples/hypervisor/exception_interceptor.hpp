@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "delete_constructors.hpp"
+#include "common.hpp"
+#include "exception.hpp"
+#include "vmx.hpp"
+
+namespace hh
+{
+  class vcpu;
+
+  // Guest exception interceptions registered by VMEXIT handler. Vector is intercepted
+  // on a vcpu only while some interception for it is armed. Once every interception of
+  // the vector is served, the vcpu clears its exception bitmap bit on the next exit
+  // with this vector, so the guest stops exiting on it at all.
+  class exception_interceptor : non_relocatable
+  {
+  public:
+    // Returns true if exception has been consumed, otherwise it is reinjected to the guest.
+    using handler_routine = bool(*)(common::guest_regs* regs, vcpu* cpu_obj);
+
+    // Returns true if the handler should be called for this occurrence.
+    using predicate_routine = bool(*)(common::guest_regs* regs, vcpu* cpu_obj);
+
+    static constexpr uint32_t max_interceptions = 8;
+
+  private:
+    struct interception
+    {
+      exception_vector vector;
+      handler_routine handler;
+      predicate_routine predicate;
+      bool one_shot;
+      std::atomic<bool> served;
+    };
+
+    interception interceptions_[max_interceptions];
+    uint32_t interceptions_count_;
+
+  public:
+    exception_interceptor() noexcept;
+
+    // Must be called before vcpus are initialized. One shot interception is served by the first
+    // vcpu that passes predicate and is disarmed on all vcpus afterwards.
+    void intercept(exception_vector vector, handler_routine handler, predicate_routine predicate = nullptr, bool one_shot = false);
+
+    // Exception bitmap for vcpu that is being initialized.
+    vmx::exception_bitmap initial_bitmap() const noexcept;
+
+    // Calls interceptions for exception that caused current VMEXIT. Returns true if exception has been consumed.
+    bool dispatch(exception_vector vector, common::guest_regs* regs, vcpu* cpu_obj);
+  };
+}
@@ -0,0 +1,81 @@
+#include "exit_latency_recorder.hpp"
+#include <intrin.h>
+
+namespace hh
+{
+  exit_latency_recorder::exit_latency_recorder() noexcept : by_reason_{}, by_vmcall_{}, shootdowns_{}
+  {}
+
+  uint32_t exit_latency_recorder::bucket_index(uint64_t ticks) noexcept
+  {
+    unsigned long index;
+
+    if (!_BitScanReverse64(&index, ticks))
+    {
+      return 0;
+    }
+
+    return index < statistics::latency_buckets_count ? index : statistics::latency_buckets_count - 1;
+  }
+
+  void exit_latency_recorder::histogram::record(uint64_t ticks) noexcept
+  {
+    // Only the owning vcpu writes here, so load + store is enough and avoids lock prefix.
+    auto increment = [](std::atomic<uint64_t>& counter, uint64_t value)
+    {
+      counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    };
+
+    increment(count, 1);
+    increment(total_ticks, ticks);
+    increment(buckets[bucket_index(ticks)], 1);
+
+    if (ticks > max_ticks.load(std::memory_order_relaxed))
+    {
+      max_ticks.store(ticks, std::memory_order_relaxed);
+    }
+  }
+
+  void exit_latency_recorder::histogram::snapshot(statistics::latency_histogram& out) const noexcept
+  {
+    out.count = count.load(std::memory_order_relaxed);
+    out.total_ticks = total_ticks.load(std::memory_order_relaxed);
+    out.max_ticks = max_ticks.load(std::memory_order_relaxed);
+
+    for (uint32_t j = 0; j < statistics::latency_buckets_count; j++)
+    {
+      out.buckets[j] = buckets[j].load(std::memory_order_relaxed);
+    }
+  }
+
+  void exit_latency_recorder::record(uint16_t exit_reason, uint64_t ticks) noexcept
+  {
+    by_reason_[exit_reason < statistics::exit_reasons_count ? exit_reason : 0].record(ticks);
+  }
+
+  void exit_latency_recorder::record(uint16_t exit_reason, uint64_t vmcall_number, uint64_t ticks) noexcept
+  {
+    record(exit_reason, ticks);
+    by_vmcall_[vmcall_number < statistics::vmcall_numbers_count ? vmcall_number : 0].record(ticks);
+  }
+
+  void exit_latency_recorder::record_shootdown(uint64_t ticks) noexcept
+  {
+    shootdowns_.record(ticks);
+  }
+
+  void exit_latency_recorder::snapshot(statistics::exit_statistics& out) const noexcept
+  {
+    for (uint32_t j = 0; j < statistics::exit_reasons_count; j++)
+    {
+      by_reason_[j].snapshot(out.by_reason[j]);
+    }
+
+    for (uint32_t j = 0; j < statistics::vmcall_numbers_count; j++)
+    {
+      by_vmcall_[j].snapshot(out.by_vmcall[j]);
+    }
+
+    shootdowns_.snapshot(out.shootdowns);
+  }
+}
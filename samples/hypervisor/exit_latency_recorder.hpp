@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "delete_constructors.hpp"
+#include "exit_statistics.hpp"
+
+namespace hh
+{
+  // Per vcpu VMEXIT latency histograms. Every histogram has a single writer (its own vcpu)
+  // so counters are updated with plain relaxed stores instead of locked instructions.
+  // A reader on another processor may see a histogram in the middle of an update, but never a torn counter.
+  // Exits completed by the fast path in vmexit_handler_.asm are measured too, see vmcall_number::set_fast_path_mask
+  // to compare them with the regular path.
+  class exit_latency_recorder : non_relocatable
+  {
+  public:
+    static constexpr size_t cache_line_size = 64;
+
+  private:
+    // Each histogram occupies its own cache lines so hot exit reasons don't share lines with each other.
+    struct alignas(cache_line_size) histogram
+    {
+      std::atomic<uint64_t> count;
+      std::atomic<uint64_t> total_ticks;
+      std::atomic<uint64_t> max_ticks;
+      std::atomic<uint64_t> buckets[statistics::latency_buckets_count];
+
+      void record(uint64_t ticks) noexcept;
+      void snapshot(statistics::latency_histogram& out) const noexcept;
+    };
+
+    histogram by_reason_[statistics::exit_reasons_count];
+    histogram by_vmcall_[statistics::vmcall_numbers_count];
+    histogram shootdowns_;
+
+  private:
+    static uint32_t bucket_index(uint64_t ticks) noexcept;
+
+  public:
+    exit_latency_recorder() noexcept;
+
+    // Pass vmcall number only for VMCALL exits.
+    void record(uint16_t exit_reason, uint64_t ticks) noexcept;
+    void record(uint16_t exit_reason, uint64_t vmcall_number, uint64_t ticks) noexcept;
+    void record_shootdown(uint64_t ticks) noexcept;
+
+    void snapshot(statistics::exit_statistics& out) const noexcept;
+  };
+}
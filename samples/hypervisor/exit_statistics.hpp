@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// Layout of VMEXIT latency statistics returned by vmcall_number::get_exit_statistics.
+// This header is shared with win driver so it must stay free of hypervisor dependencies.
+namespace hh::statistics
+{
+  inline constexpr uint32_t exit_reasons_count = 66;
+  inline constexpr uint32_t vmcall_numbers_count = 32;
+
+  // Bucket N counts exits that took [2^N, 2^(N+1)) TSC ticks, the last bucket is open ended.
+  inline constexpr uint32_t latency_buckets_count = 32;
+
+  struct latency_histogram
+  {
+    uint64_t count;
+    uint64_t total_ticks;
+    uint64_t max_ticks;
+    uint64_t buckets[latency_buckets_count];
+  };
+
+  // Guest virtual to physical translation cache of the processor.
+  struct translation_cache_statistics
+  {
+    uint64_t hits;
+    uint64_t misses;
+
+    // Hits rejected because guest changed some of its paging entries behind the cache.
+    uint64_t stale_entries;
+    uint64_t invalidations;
+  };
+
+  struct exit_statistics
+  {
+    latency_histogram by_reason[exit_reasons_count];
+
+    // VMCALL exits are additionally split by vmcall number. Unknown numbers go to slot 0.
+    latency_histogram by_vmcall[vmcall_numbers_count];
+
+    // Cross processor EPT shootdowns started by this processor, from request to the last acknowledgment.
+    latency_histogram shootdowns;
+
+    translation_cache_statistics translations;
+  };
+}
@@ -0,0 +1,150 @@
+#include "extended_state.hpp"
+#include "common.hpp"
+#include "x86.hpp"
+#include <immintrin.h>
+#include <cstring>
+#include <new>
+
+namespace hh
+{
+  namespace
+  {
+    constexpr int32_t cpuid_extended_state_leaf = 0xd;
+    constexpr uint32_t xsaveopt_supported_bit = 1 << 0;
+    constexpr uint32_t xsavec_supported_bit = 1 << 1;
+  }
+
+  void extended_state::initialize_features() noexcept
+  {
+    common::cpuid_eax_01 data = {};
+    __cpuid(reinterpret_cast<int*>(data.cpu_info), 1);
+
+    // CR4.OSXSAVE of the current processor doesn't matter here, save checks it on every exit.
+    if (!data.feature_information_ecx.xsave_xrstor_instruction)
+    {
+      method_ = save_method::fxsave;
+      area_size_ = sizeof(common::fxsave_area);
+
+      PRINT(("XSAVE isn't available, falling back to FXSAVE.\n"));
+      return;
+    }
+
+    common::cpuid_t cpu_info = {};
+
+    // ECX of sub-leaf 0 is the size of the XSAVE area for all features that XCR0 may enable.
+    // Guest can extend XCR0 with xsetbv so we can't use EBX here.
+    __cpuidex(reinterpret_cast<int*>(&cpu_info), cpuid_extended_state_leaf, 0);
+    area_size_ = static_cast<uint32_t>(cpu_info.ecx);
+
+    __cpuidex(reinterpret_cast<int*>(&cpu_info), cpuid_extended_state_leaf, 1);
+
+    // XSAVEOPT keeps the standard format and skips components that weren't modified since the last XRSTOR.
+    if (cpu_info.eax & xsaveopt_supported_bit)
+    {
+      method_ = save_method::xsaveopt;
+    }
+    else if (cpu_info.eax & xsavec_supported_bit)
+    {
+      method_ = save_method::xsavec;
+    }
+    else
+    {
+      method_ = save_method::xsave;
+    }
+
+    PRINT(("Extended state area size: 0x%x, save method: %d\n", area_size_, static_cast<uint32_t>(method_)));
+  }
+
+  uint32_t extended_state::area_size() noexcept
+  {
+    return area_size_;
+  }
+
+  extended_state::extended_state() : area_{}, saved_mask_{}, saved_{}
+  {
+    area_ = new (std::align_val_t{ area_alignment }) uint8_t[area_size_];
+
+    // XRSTOR validates XSAVE header so it must be zeroed before the first save.
+    memset(area_, 0, area_size_);
+  }
+
+  extended_state::~extended_state()
+  {
+    delete[] area_;
+  }
+
+  void extended_state::save() noexcept
+  {
+    if (saved_)
+    {
+      return;
+    }
+
+    // Until the guest executes XSETBV on this processor XCR0 can't have more than x87 state enabled,
+    // and XSAVE raises #UD with CR4.OSXSAVE clear.
+    if (method_ == save_method::fxsave || !x86::read<x86::cr4_t>().flags.os_xsave)
+    {
+      saved_mask_ = 0;
+      _fxsave64(area_);
+      saved_ = true;
+
+      return;
+    }
+
+    switch (method_)
+    {
+    case save_method::xsaveopt:
+    {
+      saved_mask_ = _xgetbv(0);
+      _xsaveopt64(area_, saved_mask_);
+      break;
+    }
+
+    case save_method::xsavec:
+    {
+      saved_mask_ = _xgetbv(0);
+      _xsavec64(area_, saved_mask_);
+      break;
+    }
+
+    default:
+    {
+      saved_mask_ = _xgetbv(0);
+      _xsave64(area_, saved_mask_);
+      break;
+    }
+    }
+
+    saved_ = true;
+  }
+
+  void extended_state::restore() noexcept
+  {
+    if (!saved_)
+    {
+      return;
+    }
+
+    if (saved_mask_ == 0)
+    {
+      _fxrstor64(area_);
+    }
+    else
+    {
+      // XRSTOR recognizes compacted format by XCOMP_BV[63] so it works for XSAVEC too.
+      _xrstor64(area_, saved_mask_);
+    }
+
+    saved_ = false;
+  }
+
+  bool extended_state::saved() const noexcept
+  {
+    return saved_;
+  }
+
+  void* extended_state::area() const noexcept
+  {
+    return area_;
+  }
+}
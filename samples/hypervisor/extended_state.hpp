@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include "delete_constructors.hpp"
+
+namespace hh
+{
+  // Lazily saved guest extended processor state (x87, SSE, AVX and everything else enabled in XCR0).
+  // The VMEXIT entry stub always preserves volatile XMM registers, so a full XSAVE is needed only
+  // when root mode code executes VEX/EVEX encoded instructions or x87 code.
+  class extended_state : non_relocatable
+  {
+  private:
+    enum class save_method : uint8_t
+    {
+      fxsave,
+      xsave,
+      xsavec,
+      xsaveopt
+    };
+
+    inline static save_method method_ = save_method::fxsave;
+    inline static uint32_t area_size_ = 512;
+
+    uint8_t* area_;
+    uint64_t saved_mask_;
+    bool saved_;
+
+  public:
+    static constexpr uint32_t area_alignment = 64;
+
+    // Must be called once before any vcpu is created.
+    static void initialize_features() noexcept;
+    static uint32_t area_size() noexcept;
+
+    extended_state();
+    ~extended_state();
+
+    // Saves guest state if it hasn't been saved during current VMEXIT.
+    void save() noexcept;
+
+    // Restores guest state if it has been saved during current VMEXIT.
+    void restore() noexcept;
+
+    bool saved() const noexcept;
+    void* area() const noexcept;
+  };
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+
+// Layout of VMEXIT flight recorder entries returned by vmcall_number::drain_flight_recorder.
+// This header is shared with win driver so it must stay free of hypervisor dependencies.
+namespace hh::diagnostics
+{
+  inline constexpr uint32_t flight_recorder_capacity = 256;
+
+  struct flight_record
+  {
+    uint64_t tsc;
+    uint64_t guest_rip;
+    uint64_t exit_qualification;
+
+    // Valid only for EPT violation and EPT misconfiguration exits.
+    uint64_t guest_physical_address;
+    uint32_t exit_reason;
+    uint32_t reserved;
+  };
+
+  // Guest buffer starts with this header followed by records_count records, oldest first.
+  struct flight_recorder_drain_header
+  {
+    uint64_t records_count;
+
+    // Records overwritten before they were drained.
+    uint64_t records_lost;
+  };
+}
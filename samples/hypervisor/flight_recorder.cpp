@@ -0,0 +1,113 @@
+#include "flight_recorder.hpp"
+#include <intrin.h>
+#include "globals.hpp"
+#include "common.hpp"
+
+namespace hh
+{
+  flight_recorder::flight_recorder() noexcept : head_{}, drained_{}, drain_lock_{}, records_{}
+  {}
+
+  void flight_recorder::record(uint64_t tsc, uint16_t exit_reason, uint64_t exit_qualification, uint64_t guest_rip,
+    uint64_t guest_physical_address) noexcept
+  {
+    const uint64_t position = head_.load(std::memory_order_relaxed);
+    diagnostics::flight_record& entry = records_[position % capacity];
+
+    entry.tsc = tsc;
+    entry.guest_rip = guest_rip;
+    entry.exit_qualification = exit_qualification;
+    entry.guest_physical_address = guest_physical_address;
+    entry.exit_reason = exit_reason;
+
+    head_.store(position + 1, std::memory_order_release);
+  }
+
+  uint64_t flight_recorder::copy_since(uint64_t first, diagnostics::flight_record* out, uint32_t max_count, uint32_t& copied) const noexcept
+  {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+
+    if (head - first > capacity)
+    {
+      first = head - capacity;
+    }
+
+    uint64_t count = head - first < max_count ? head - first : max_count;
+
+    for (uint64_t j = 0; j < count; j++)
+    {
+      out[j] = records_[(first + j) % capacity];
+    }
+
+    // Writer may have overwritten the oldest records while we were copying them.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t head_after_copy = head_.load(std::memory_order_relaxed);
+    const uint64_t first_intact = head_after_copy >= capacity ? head_after_copy - capacity + 1 : 0;
+
+    if (first < first_intact)
+    {
+      const uint64_t torn = first_intact - first < count ? first_intact - first : count;
+
+      for (uint64_t j = torn; j < count; j++)
+      {
+        out[j - torn] = out[j];
+      }
+
+      first += torn;
+      count -= torn;
+    }
+
+    copied = static_cast<uint32_t>(count);
+
+    return first;
+  }
+
+  uint32_t flight_recorder::drain(diagnostics::flight_record* out, uint32_t max_count, uint64_t& records_lost) noexcept
+  {
+    const common::spinlock_guard _{ &drain_lock_ };
+
+    uint32_t copied;
+    const uint64_t first = copy_since(drained_, out, max_count, copied);
+
+    records_lost = first - drained_;
+    drained_ = first + copied;
+
+    return copied;
+  }
+
+  uint32_t flight_recorder::latest(diagnostics::flight_record* out, uint32_t max_count) const noexcept
+  {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+
+    uint32_t copied;
+    copy_since(head > max_count ? head - max_count : 0, out, max_count, copied);
+
+    return copied;
+  }
+
+  void flight_recorder::dump_all(uint32_t records_per_processor) noexcept
+  {
+    if (globals::flight_recorders == nullptr)
+    {
+      return;
+    }
+
+    // Bug check must not allocate.
+    diagnostics::flight_record records[max_dump_records];
+    records_per_processor = records_per_processor < max_dump_records ? records_per_processor : max_dump_records;
+
+    for (uint64_t j = 0; j < globals::number_of_cpus; j++)
+    {
+      const uint32_t count = globals::flight_recorders[j].latest(records, records_per_processor);
+
+      // Printed regardless of HH_DEBUG, it is the only evidence of a crash in release build.
+      common::print_formatted("Last %d VMEXITs of processor #%d:\n", count, static_cast<uint32_t>(j));
+
+      for (uint32_t i = 0; i < count; i++)
+      {
+        common::print_formatted("  tsc = %016llx, reason = 0x%02x, qualification = %016llx, rip = %016llx, gpa = %016llx\n",
+          records[i].tsc, records[i].exit_reason, records[i].exit_qualification, records[i].guest_rip, records[i].guest_physical_address);
+      }
+    }
+  }
+}
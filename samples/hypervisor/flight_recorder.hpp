@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "delete_constructors.hpp"
+#include "flight_record.hpp"
+
+namespace hh
+{
+  // Per cpu ring of the latest VMEXITs. The owning processor is the only writer and never waits,
+  // readers copy records and then drop the ones that could have been overwritten during the copy.
+  // Exits completed by the fast path in vmexit_handler_.asm are recorded without exit qualification.
+  class flight_recorder : non_relocatable
+  {
+  public:
+    static constexpr size_t cache_line_size = 64;
+    static constexpr uint32_t capacity = diagnostics::flight_recorder_capacity;
+    static constexpr uint32_t max_dump_records = 32;
+
+  private:
+    alignas(cache_line_size) std::atomic<uint64_t> head_;
+    alignas(cache_line_size) uint64_t drained_;
+    volatile long drain_lock_;
+    diagnostics::flight_record records_[capacity];
+
+  private:
+    // Copies records [first, head) that are still intact. Returns position of the first copied record.
+    uint64_t copy_since(uint64_t first, diagnostics::flight_record* out, uint32_t max_count, uint32_t& copied) const noexcept;
+
+  public:
+    flight_recorder() noexcept;
+
+    // Owning processor only.
+    void record(uint64_t tsc, uint16_t exit_reason, uint64_t exit_qualification, uint64_t guest_rip, uint64_t guest_physical_address) noexcept;
+
+    // Moves up to max_count records that weren't drained yet to out. Returns number of records.
+    uint32_t drain(diagnostics::flight_record* out, uint32_t max_count, uint64_t& records_lost) noexcept;
+
+    // Copies up to max_count latest records to out without draining them. Returns number of records.
+    uint32_t latest(diagnostics::flight_record* out, uint32_t max_count) const noexcept;
+
+    // Prints latest records of every processor to serial port. Used by bug_check.
+    static void dump_all(uint32_t records_per_processor) noexcept;
+  };
+}
@@ -8,6 +8,8 @@ namespace hh
   class vcpu;
   class hook_builder;
   class per_cpu_data;
+  class tlb_shootdown;
+  class flight_recorder;
 
   namespace x86
   {
@@ -36,14 +38,19 @@ namespace hh
     inline ept::ept_handler* ept_handler = {};
     inline pt::pt_handler* pt_handler = {};
     inline hook_builder* hook_handler = {};
+    inline tlb_shootdown* shootdown_handler = {};
     inline vcpu* vcpus = {};
     extern "C" x86::idtr64_t host_guest_idtr;
     extern "C" unsigned char __ImageBase;
     inline win_driver::win_driver_info* win_driver_struct = {};
     inline bool skip_init = {};
     inline per_cpu_data* cpu_related_data = {};
+    inline flight_recorder* flight_recorders = {};
     inline unsigned long long number_of_cpus = {};
     inline bool panic_status = false;
     inline bool boot_state = true;
+
+    // Bits of hv_event_handlers::fast_path_exit, tested by the VMEXIT entry stub. Everything is enabled by default.
+    inline unsigned int vmexit_fast_path_mask = ~0u;
   }
 }
@@ -0,0 +1,301 @@
+#include "guest_memory.hpp"
+#include <intrin.h>
+#include <exception>
+#include "common.hpp"
+#include "pt.hpp"
+#include "per_cpu_data.hpp"
+#include "vcpu.hpp"
+#include "globals.hpp"
+#include "pt_handler.hpp"
+
+namespace hh::pt
+{
+  namespace
+  {
+    constexpr size_t simd_block_size = sizeof(__m128i);
+
+    // Only SSE2 is used, so callers don't need to save guest AVX state.
+    void copy_bytes(uint8_t* destination, const uint8_t* source, size_t count) noexcept
+    {
+      const size_t blocks = count / simd_block_size;
+
+      common::memcpy_128bit(destination, source, blocks);
+
+      for (size_t j = blocks * simd_block_size; j < count; j++)
+      {
+        destination[j] = source[j];
+      }
+    }
+
+    void fill_bytes(uint8_t* destination, uint8_t value, size_t count) noexcept
+    {
+      const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+      size_t j = 0;
+
+      for (; j + simd_block_size <= count; j += simd_block_size)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + j), pattern);
+      }
+
+      for (; j < count; j++)
+      {
+        destination[j] = value;
+      }
+    }
+
+    int compare_bytes(const uint8_t* first, const uint8_t* second, size_t count) noexcept
+    {
+      size_t j = 0;
+
+      for (; j + simd_block_size <= count; j += simd_block_size)
+      {
+        const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + j)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + j)));
+
+        if (const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(equal)); mask != 0xFFFF)
+        {
+          unsigned long index;
+          _BitScanForward(&index, ~mask);
+          j += index;
+
+          return static_cast<int>(first[j]) - static_cast<int>(second[j]);
+        }
+      }
+
+      for (; j < count; j++)
+      {
+        if (first[j] != second[j])
+        {
+          return static_cast<int>(first[j]) - static_cast<int>(second[j]);
+        }
+      }
+
+      return 0;
+    }
+  }
+
+  guest_memory::guest_memory(x86::cr3_t guest_cr3, uint64_t guest_virtual_address, size_t size) : spans_{}, spans_count_{}, size_{ size }
+  {
+    if (size == 0)
+    {
+      throw std::exception{ __FUNCTION__": ""Size of guest region is zero." };
+    }
+
+    translation_cache& translations = per_cpu_data::get_vcpu()->translations();
+    uint64_t previous_end = 0;
+
+    try
+    {
+      for (size_t processed = 0; processed < size;)
+      {
+        uint64_t page_size;
+        const uint64_t physical_address = translations.translate(guest_cr3, guest_virtual_address + processed, page_size);
+
+        // Large pages are consumed in one step.
+        size_t chunk = page_size - (physical_address & (page_size - 1));
+        chunk = chunk < size - processed ? chunk : size - processed;
+
+        // Chunk never crosses 1GB boundary, so a single lookup covers it.
+        const bool identity_mapped = globals::pt_handler->is_identity_mapped(physical_address);
+
+        if (identity_mapped && spans_count_ != 0 && !spans_[spans_count_ - 1].pinned && physical_address == previous_end)
+        {
+          spans_[spans_count_ - 1].size += chunk;
+        }
+        else
+        {
+          if (spans_count_ == max_spans)
+          {
+            throw std::exception{ __FUNCTION__": ""Guest region is too fragmented." };
+          }
+
+          if (identity_mapped)
+          {
+            spans_[spans_count_++] = { static_cast<uint8_t*>(common::physical_address_to_virtual_address(physical_address)), chunk, false };
+          }
+          else
+          {
+            // Frames above host identity mapping are pinned in host mapping cache one page at a time.
+            const uint64_t page_offset = physical_address & common::page_4kb_offset_mask;
+            chunk = common::page_size - page_offset < chunk ? common::page_size - page_offset : chunk;
+
+            auto host_address = static_cast<uint8_t*>(globals::pt_handler->pin_guest_frame(physical_address >> common::page_shift));
+            spans_[spans_count_++] = { host_address + page_offset, chunk, true };
+          }
+        }
+
+        previous_end = physical_address + chunk;
+        processed += chunk;
+      }
+    }
+    catch (...)
+    {
+      release();
+      throw;
+    }
+  }
+
+  guest_memory::~guest_memory()
+  {
+    release();
+  }
+
+  void guest_memory::release() noexcept
+  {
+    for (uint32_t j = 0; j < spans_count_; j++)
+    {
+      if (spans_[j].pinned)
+      {
+        globals::pt_handler->unpin_guest_frame(spans_[j].host_address);
+      }
+    }
+
+    spans_count_ = 0;
+  }
+
+  template <typename Callback>
+  void guest_memory::for_each_chunk(size_t offset, size_t count, Callback callback) const
+  {
+    if (offset > size_ || count > size_ - offset)
+    {
+      throw std::exception{ __FUNCTION__": ""Access is out of guest region." };
+    }
+
+    size_t processed = 0;
+
+    for (uint32_t j = 0; j < spans_count_ && processed < count; j++)
+    {
+      if (offset >= spans_[j].size)
+      {
+        offset -= spans_[j].size;
+        continue;
+      }
+
+      size_t chunk = spans_[j].size - offset;
+      chunk = chunk < count - processed ? chunk : count - processed;
+
+      if (!callback(spans_[j].host_address + offset, chunk, processed))
+      {
+        return;
+      }
+
+      processed += chunk;
+      offset = 0;
+    }
+  }
+
+  size_t guest_memory::size() const noexcept
+  {
+    return size_;
+  }
+
+  uint32_t guest_memory::spans_count() const noexcept
+  {
+    return spans_count_;
+  }
+
+  const guest_memory::span& guest_memory::span_at(uint32_t index) const noexcept
+  {
+    return spans_[index];
+  }
+
+  void guest_memory::read(void* destination, size_t offset, size_t count) const
+  {
+    for_each_chunk(offset, count, [destination](uint8_t* host_address, size_t chunk, size_t processed)
+      {
+        copy_bytes(static_cast<uint8_t*>(destination) + processed, host_address, chunk);
+        return true;
+      });
+  }
+
+  void guest_memory::write(size_t offset, const void* source, size_t count)
+  {
+    for_each_chunk(offset, count, [source](uint8_t* host_address, size_t chunk, size_t processed)
+      {
+        copy_bytes(host_address, static_cast<const uint8_t*>(source) + processed, chunk);
+        return true;
+      });
+  }
+
+  void guest_memory::fill(size_t offset, uint8_t value, size_t count)
+  {
+    for_each_chunk(offset, count, [value](uint8_t* host_address, size_t chunk, size_t)
+      {
+        fill_bytes(host_address, value, chunk);
+        return true;
+      });
+  }
+
+  int guest_memory::compare(size_t offset, const void* data, size_t count) const
+  {
+    int result = 0;
+
+    for_each_chunk(offset, count, [data, &result](uint8_t* host_address, size_t chunk, size_t processed)
+      {
+        result = compare_bytes(host_address, static_cast<const uint8_t*>(data) + processed, chunk);
+        return result == 0;
+      });
+
+    return result;
+  }
+
+  size_t guest_memory::find(const void* pattern, size_t pattern_size, size_t from) const
+  {
+    if (pattern_size == 0 || pattern_size > size_ || from > size_ - pattern_size)
+    {
+      return npos;
+    }
+
+    const auto first_byte = *static_cast<const uint8_t*>(pattern);
+    const __m128i first_byte_pattern = _mm_set1_epi8(static_cast<char>(first_byte));
+    const size_t last_candidate = size_ - pattern_size;
+    size_t span_begin = 0;
+
+    for (uint32_t j = 0; j < spans_count_; span_begin += spans_[j].size, j++)
+    {
+      const size_t span_end = span_begin + spans_[j].size;
+
+      if (span_end <= from)
+      {
+        continue;
+      }
+
+      const uint8_t* host_address = spans_[j].host_address;
+      size_t position = from > span_begin ? from : span_begin;
+      const size_t scan_end = span_end < last_candidate + 1 ? span_end : last_candidate + 1;
+
+      // Candidates are found by the first byte, full match may cross span boundary.
+      for (; position + simd_block_size <= scan_end; position += simd_block_size)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(host_address + position - span_begin));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, first_byte_pattern)));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+          unsigned long index;
+          _BitScanForward(&index, mask);
+
+          if (compare(position + index, pattern, pattern_size) == 0)
+          {
+            return position + index;
+          }
+        }
+      }
+
+      for (; position < scan_end; position++)
+      {
+        if (host_address[position - span_begin] == first_byte && compare(position, pattern, pattern_size) == 0)
+        {
+          return position;
+        }
+      }
+
+      if (scan_end == last_candidate + 1)
+      {
+        break;
+      }
+    }
+
+    return npos;
+  }
+}
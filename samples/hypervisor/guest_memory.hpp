@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include "delete_constructors.hpp"
+#include "x86.hpp"
+
+namespace hh::pt
+{
+  // Allocation free view of guest virtual memory. Guest pages are translated once in the constructor
+  // through the translation cache of the current vcpu, physically contiguous pages are merged into spans
+  // that are accessed through host identity mapping. Frames above it are pinned in host mapping cache.
+  // Intended to live on stack for the duration of a single VMEXIT.
+  class guest_memory : non_copyable
+  {
+  public:
+    static constexpr uint32_t max_spans = 64;
+    static constexpr size_t npos = ~0ull;
+
+    struct span
+    {
+      uint8_t* host_address;
+      size_t size;
+
+      // Frame lies above host identity mapping and is pinned in host mapping cache.
+      bool pinned;
+    };
+
+  private:
+    span spans_[max_spans];
+    uint32_t spans_count_;
+    size_t size_;
+
+  private:
+    void release() noexcept;
+
+    template <typename Callback>
+    void for_each_chunk(size_t offset, size_t count, Callback callback) const;
+
+  public:
+    // Throws if some page isn't present or region is too fragmented.
+    guest_memory(x86::cr3_t guest_cr3, uint64_t guest_virtual_address, size_t size);
+    ~guest_memory();
+
+    size_t size() const noexcept;
+    uint32_t spans_count() const noexcept;
+    const span& span_at(uint32_t index) const noexcept;
+
+    void read(void* destination, size_t offset, size_t count) const;
+    void write(size_t offset, const void* source, size_t count);
+    void fill(size_t offset, uint8_t value, size_t count);
+
+    // Same result as memcmp of guest region and data.
+    int compare(size_t offset, const void* data, size_t count) const;
+
+    // Returns offset of the first occurrence of pattern at or after from or npos.
+    size_t find(const void* pattern, size_t pattern_size, size_t from = 0) const;
+
+    template <typename T>
+    T read(size_t offset) const
+    {
+      T result;
+      read(&result, offset, sizeof(T));
+
+      return result;
+    }
+
+    template <typename T>
+    void write(size_t offset, const T& value)
+    {
+      write(offset, &value, sizeof(T));
+    }
+  };
+}
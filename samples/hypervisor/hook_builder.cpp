@@ -1,19 +1,24 @@
 #include "hook_builder.hpp"
-#include <ranges>
+#include <exception>
 #include "ept_handler.hpp"
 #include "globals.hpp"
 #include "invept.hpp"
+#include "per_cpu_data.hpp"
+#include "vcpu.hpp"
 
 namespace hh
 {
   void hook_builder::perform_page_hook(hook::guest_hook_request_info& guest_info)
   {
     // page aligning is performed in guest mode before vmcall
-    uint64_t target_phys_address = common::get_physical_address_for_virtual_address_by_cr3(guest_info.target_cr3, guest_info.target_page_address);
-    uint64_t hooked_page_phys_address = common::get_physical_address_for_virtual_address_by_cr3(guest_info.target_cr3, guest_info.hooked_page_address);
+    pt::translation_cache& translations = per_cpu_data::get_vcpu()->translations();
+    uint64_t target_phys_address = translations.translate(guest_info.target_cr3, reinterpret_cast<uint64_t>(guest_info.target_page_address));
+    uint64_t hooked_page_phys_address = translations.translate(guest_info.target_cr3, reinterpret_cast<uint64_t>(guest_info.hooked_page_address));
 
-    hook_information_[target_phys_address] = {};
-    hook::hook_info& hook_info = hook_information_.find(target_phys_address)->second;
+    // Reclaiming PML1 tables may need a TLB shootdown, so it is done before the lock is taken.
+    globals::ept_handler->reclaim_tables_if_exhausted();
+
+    common::spinlock_guard _{ &hooks_lock_ };
 
     // Split large page and get pml1 entry for more accuracy in hooking process.
     // We don't want to cause vmexit all times when someone want to access memory
@@ -35,6 +40,9 @@ namespace hh
 
     changed_entry.page_frame_number = hooked_page_phys_address >> common::page_shift;
 
+    // The page is added only when its entry is known, so the map never holds a half filled hook.
+    hook::hook_info& hook_info = hook_information_[target_phys_address];
+
     hook_info.changed_entry = changed_entry;
     hook_info.original_entry = *target_pml1_entry;
     hook_info.virtual_address = guest_info.target_page_address;
@@ -46,28 +54,139 @@ namespace hh
 
   void hook_builder::unhook_page(uint64_t target_phys_address)
   {
-    hook::hook_info& info_entry = hook_information_.at(target_phys_address);
+    {
+      common::spinlock_guard _{ &hooks_lock_ };
 
-    globals::ept_handler->set_pml1_and_invalidate_tlb(info_entry.entry_address, info_entry.original_entry,
-      vmx::invvpid_type::invvpid_individual_address);
+      const auto hook_info = hook_information_.find(target_phys_address);
 
-    hook_information_.erase(target_phys_address);
+      if (hook_info == hook_information_.end())
+      {
+        throw std::exception{ __FUNCTION__": ""Page isn't hooked." };
+      }
+
+      globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info->second.entry_address, hook_info->second.original_entry,
+        vmx::invvpid_type::invvpid_individual_address);
+
+      hook_information_.erase(hook_info);
+      coalesce_unhooked_large_page(target_phys_address);
+    }
+
+    globals::ept_handler->release_retired_tables();
   }
 
   void hook_builder::unhook_all_pages() noexcept
   {
-    for (const auto& hook_info : hook_information_ | std::views::values)
     {
-      globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info.entry_address, hook_info.original_entry,
-        vmx::invvpid_type::invvpid_individual_address);
+      common::spinlock_guard _{ &hooks_lock_ };
+
+      while (!hook_information_.empty())
+      {
+        const auto hook_info = hook_information_.begin();
+        const uint64_t physical_address = hook_info->first;
+
+        globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info->second.entry_address, hook_info->second.original_entry,
+          vmx::invvpid_type::invvpid_individual_address);
+
+        hook_information_.erase(hook_info);
+        coalesce_unhooked_large_page(physical_address);
+      }
     }
 
-    hook_information_.clear();
+    globals::ept_handler->release_retired_tables();
   }
 
-  hook::hook_info* hook_builder::get_hooked_page_info(uint64_t physical_address)
+  root_task hook_builder::unhook_all_pages_in_slices()
+  {
+    // The map may change between slices, so the first entry is taken anew every time. The lock is
+    // for the same task spawned on another core when the waiting guest thread has migrated.
+    for (;;)
+    {
+      {
+        common::spinlock_guard _{ &hooks_lock_ };
+
+        if (hook_information_.empty())
+        {
+          break;
+        }
+
+        const auto hook_info = hook_information_.begin();
+        const uint64_t physical_address = hook_info->first;
+
+        globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info->second.entry_address, hook_info->second.original_entry,
+          vmx::invvpid_type::invvpid_individual_address);
+
+        hook_information_.erase(hook_info);
+        coalesce_unhooked_large_page(physical_address);
+      }
+
+      co_await root_task_scheduler::checkpoint{};
+    }
+
+    // Single shootdown for all regions coalesced by the task.
+    globals::ept_handler->release_retired_tables();
+  }
+
+  bool hook_builder::has_hooks_in_large_page(uint64_t physical_address) const noexcept
+  {
+    const uint64_t region_base = physical_address & ~common::page_2mb_offset_mask;
+    const auto hook_info = hook_information_.lower_bound(region_base);
+
+    return hook_info != hook_information_.end() && hook_info->first < region_base + common::size_2mb;
+  }
+
+  // Restores 2MB page when the last hook in its region is removed, so the region is covered by a single TLB entry again.
+  void hook_builder::coalesce_unhooked_large_page(uint64_t physical_address) noexcept
+  {
+    if (has_hooks_in_large_page(physical_address))
+    {
+      return;
+    }
+
+    try
+    {
+      globals::ept_handler->coalesce_large_page(physical_address);
+    }
+    catch (std::exception& e)
+    {
+      PRINT(("Large page isn't coalesced. %a\n", e.what()));
+    }
+  }
+
+  bool hook_builder::has_hooks() noexcept
+  {
+    common::spinlock_guard _{ &hooks_lock_ };
+    return !hook_information_.empty();
+  }
+
+  bool hook_builder::restore_original_entry(uint64_t physical_address) noexcept
   {
     physical_address = reinterpret_cast<uint64_t>(PAGE_ALIGN(physical_address));
-    return &hook_information_.at(physical_address);
+
+    common::spinlock_guard _{ &hooks_lock_ };
+
+    const auto hook_info = hook_information_.find(physical_address);
+
+    if (hook_info == hook_information_.end())
+    {
+      return false;
+    }
+
+    globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info->second.entry_address, hook_info->second.original_entry,
+      vmx::invvpid_type::invvpid_individual_address);
+
+    return true;
+  }
+
+  void hook_builder::restore_changed_entry(uint64_t physical_address) noexcept
+  {
+    common::spinlock_guard _{ &hooks_lock_ };
+
+    const auto hook_info = hook_information_.find(physical_address);
+
+    if (hook_info != hook_information_.end())
+    {
+      globals::ept_handler->set_pml1_and_invalidate_tlb(hook_info->second.entry_address, hook_info->second.changed_entry,
+        vmx::invvpid_type::invvpid_individual_address);
+    }
   }
 }
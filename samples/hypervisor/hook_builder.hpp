@@ -1,19 +1,37 @@
 #pragma once
 #include <map>
 #include "hooking_common.hpp"
+#include "root_task.hpp"
 
 namespace hh
 {
   // Class handles EPT hook related operations in root mode.
+  // Hooks are added, removed and looked up by all processors, every access to the map is done under hooks_lock_.
+  // No TLB shootdown is performed while the lock is held, processors waiting for it couldn't acknowledge.
   class hook_builder : non_relocatable
   {
   private:
     std::map<uint64_t, hook::hook_info> hook_information_;
+    volatile long hooks_lock_ = {};
+
+  private:
+    // Both are called with hooks_lock_ held.
+    bool has_hooks_in_large_page(uint64_t physical_address) const noexcept;
+    void coalesce_unhooked_large_page(uint64_t physical_address) noexcept;
 
   public:
     void perform_page_hook(hook::guest_hook_request_info& guest_info);
     void unhook_page(uint64_t target_phys_address);
     void unhook_all_pages() noexcept;
-    hook::hook_info* get_hooked_page_info(uint64_t physical_address);
+
+    // Same as above but restores one page per slice of the root task.
+    root_task unhook_all_pages_in_slices();
+    bool has_hooks() noexcept;
+
+    // Puts the original entry of the hooked page back for a single instruction. Returns false if the page isn't hooked.
+    bool restore_original_entry(uint64_t physical_address) noexcept;
+
+    // Puts the hooked entry back after the instruction. Does nothing if the page was unhooked meanwhile.
+    void restore_changed_entry(uint64_t physical_address) noexcept;
   };
 }
@@ -0,0 +1,176 @@
+#include "host_mapping_cache.hpp"
+#include <intrin.h>
+#include <exception>
+#include "common.hpp"
+
+namespace hh::pt
+{
+  host_mapping_cache::host_mapping_cache() noexcept : entries_{}, base_address_{}, count_{}, windows_{}, buckets_{},
+    lru_head_{ invalid_index_ }, lru_tail_{ invalid_index_ }, hits_{}, misses_{}
+  {}
+
+  void host_mapping_cache::initialize(pte_64* entries, uint8_t* base_address, uint32_t count)
+  {
+    entries_ = entries;
+    base_address_ = base_address;
+    count_ = count;
+    windows_ = std::make_unique<window[]>(count);
+    buckets_ = std::make_unique<uint32_t[]>(count);
+
+    for (uint32_t j = 0; j < count; j++)
+    {
+      buckets_[j] = invalid_index_;
+      windows_[j] = { unused_frame_, 0, invalid_index_, invalid_index_, invalid_index_ };
+      entries_[j] = pte_64{};
+
+      lru_push_front(j);
+    }
+  }
+
+  uint32_t host_mapping_cache::bucket_index(uint64_t page_frame_number) const noexcept
+  {
+    return static_cast<uint32_t>(page_frame_number % count_);
+  }
+
+  uint32_t host_mapping_cache::find(uint64_t page_frame_number) const noexcept
+  {
+    for (uint32_t index = buckets_[bucket_index(page_frame_number)]; index != invalid_index_; index = windows_[index].bucket_next)
+    {
+      if (windows_[index].page_frame_number == page_frame_number)
+      {
+        return index;
+      }
+    }
+
+    return invalid_index_;
+  }
+
+  void host_mapping_cache::remove_from_bucket(uint32_t index) noexcept
+  {
+    uint32_t* link = &buckets_[bucket_index(windows_[index].page_frame_number)];
+
+    while (*link != index)
+    {
+      link = &windows_[*link].bucket_next;
+    }
+
+    *link = windows_[index].bucket_next;
+    windows_[index].bucket_next = invalid_index_;
+  }
+
+  void host_mapping_cache::lru_unlink(uint32_t index) noexcept
+  {
+    window& current = windows_[index];
+
+    if (current.lru_previous != invalid_index_)
+    {
+      windows_[current.lru_previous].lru_next = current.lru_next;
+    }
+    else
+    {
+      lru_head_ = current.lru_next;
+    }
+
+    if (current.lru_next != invalid_index_)
+    {
+      windows_[current.lru_next].lru_previous = current.lru_previous;
+    }
+    else
+    {
+      lru_tail_ = current.lru_previous;
+    }
+
+    current.lru_previous = invalid_index_;
+    current.lru_next = invalid_index_;
+  }
+
+  void host_mapping_cache::lru_push_front(uint32_t index) noexcept
+  {
+    window& current = windows_[index];
+    current.lru_previous = invalid_index_;
+    current.lru_next = lru_head_;
+
+    if (lru_head_ != invalid_index_)
+    {
+      windows_[lru_head_].lru_previous = index;
+    }
+    else
+    {
+      lru_tail_ = index;
+    }
+
+    lru_head_ = index;
+  }
+
+  void* host_mapping_cache::pin(uint64_t page_frame_number)
+  {
+    uint32_t index = find(page_frame_number);
+
+    if (index != invalid_index_)
+    {
+      hits_++;
+
+      // Pinned windows aren't in LRU list.
+      if (windows_[index].pins++ == 0)
+      {
+        lru_unlink(index);
+      }
+
+      return base_address_ + static_cast<uint64_t>(index) * common::page_size;
+    }
+
+    misses_++;
+
+    index = lru_tail_;
+
+    if (index == invalid_index_)
+    {
+      throw std::exception{ __FUNCTION__": ""All host mapping windows are pinned." };
+    }
+
+    lru_unlink(index);
+
+    window& victim = windows_[index];
+
+    if (victim.page_frame_number != unused_frame_)
+    {
+      remove_from_bucket(index);
+    }
+
+    victim.page_frame_number = page_frame_number;
+    victim.pins = 1;
+    victim.bucket_next = buckets_[bucket_index(page_frame_number)];
+    buckets_[bucket_index(page_frame_number)] = index;
+
+    pte_64& entry = entries_[index];
+    entry.page_frame_number = page_frame_number;
+    entry.present = 1;
+    entry.write = 1;
+
+    // Windows are private, so only TLB of this processor may hold the old translation.
+    void* host_address = base_address_ + static_cast<uint64_t>(index) * common::page_size;
+    __invlpg(host_address);
+
+    return host_address;
+  }
+
+  void host_mapping_cache::unpin(const void* host_address) noexcept
+  {
+    const auto index = static_cast<uint32_t>((static_cast<const uint8_t*>(host_address) - base_address_) / common::page_size);
+
+    if (--windows_[index].pins == 0)
+    {
+      lru_push_front(index);
+    }
+  }
+
+  uint64_t host_mapping_cache::hits() const noexcept
+  {
+    return hits_;
+  }
+
+  uint64_t host_mapping_cache::misses() const noexcept
+  {
+    return misses_;
+  }
+}
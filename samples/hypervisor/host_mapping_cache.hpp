@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "delete_constructors.hpp"
+#include "pt.hpp"
+
+namespace hh::pt
+{
+  // LRU cache of host mapping windows owned by a single logical processor, keyed by guest physical frame.
+  // A pinned window keeps its frame until it is unpinned. Unpinned windows keep their translation too and
+  // are recycled in least recently used order, so a frame that is mapped again costs neither PTE write nor INVLPG.
+  // Not thread safe: only the owning processor may use it.
+  class host_mapping_cache : non_copyable
+  {
+  private:
+    static constexpr uint32_t invalid_index_ = ~0u;
+    static constexpr uint64_t unused_frame_ = ~0ull;
+
+    struct window
+    {
+      uint64_t page_frame_number;
+      uint32_t pins;
+      uint32_t lru_previous;
+      uint32_t lru_next;
+      uint32_t bucket_next;
+    };
+
+    pte_64* entries_;
+    uint8_t* base_address_;
+    uint32_t count_;
+    std::unique_ptr<window[]> windows_;
+    std::unique_ptr<uint32_t[]> buckets_;
+
+    // Head is the most recently unpinned window, tail is the next victim.
+    uint32_t lru_head_;
+    uint32_t lru_tail_;
+
+    uint64_t hits_;
+    uint64_t misses_;
+
+  private:
+    uint32_t bucket_index(uint64_t page_frame_number) const noexcept;
+    uint32_t find(uint64_t page_frame_number) const noexcept;
+    void remove_from_bucket(uint32_t index) noexcept;
+    void lru_unlink(uint32_t index) noexcept;
+    void lru_push_front(uint32_t index) noexcept;
+
+  public:
+    host_mapping_cache() noexcept;
+
+    // Windows are consecutive PTEs that map consecutive pages starting at base_address.
+    void initialize(pte_64* entries, uint8_t* base_address, uint32_t count);
+
+    // Returns host address of the guest physical frame. Throws if every window is pinned.
+    void* pin(uint64_t page_frame_number);
+
+    // Accepts any address inside a pinned window.
+    void unpin(const void* host_address) noexcept;
+
+    uint64_t hits() const noexcept;
+    uint64_t misses() const noexcept;
+  };
+}
@@ -17,10 +17,38 @@ extern "C"
 #include "vmexit_handler.hpp"
 #include "hook_builder.hpp"
 #include "per_cpu_data.hpp"
+#include "tlb_shootdown.hpp"
+#include "flight_recorder.hpp"
+#include "memory_map.hpp"
 #include <atomic>
 
 namespace hh::hv_operations
 {
+  namespace
+  {
+    struct page_tables_context
+    {
+      const std::vector<memory_map::physical_range>& physical_ranges;
+      std::atomic<bool> host_tables_taken;
+      std::atomic<bool> status;
+    };
+
+    struct vcpus_context
+    {
+      std::shared_ptr<hv_event_handlers::vmexit_handler> vmexit_handler;
+      std::atomic<bool> status;
+    };
+
+    // Prints TSC ticks spent in the boot phase and starts the next one.
+    void finish_phase([[maybe_unused]] const char* name, uint64_t& phase_start) noexcept
+    {
+      const uint64_t now = __rdtsc();
+
+      PRINT(("Boot phase \"%a\" took %llu ticks.\n", name, now - phase_start));
+      phase_start = now;
+    }
+  }
+
   void is_vmx_supported()
   {
     x86::msr::feature_control_msr_t feature_control_msr = x86::msr::read<x86::msr::feature_control_msr_t>();
@@ -57,54 +85,96 @@ namespace hh::hv_operations
       globals::gEfiMpServiceProtocol = nullptr;
     }
 
+    uint64_t phase_start = __rdtsc();
+
     globals::mem_manager = new tlsf_allocator{};
     globals::hook_handler = new hook_builder{};
     globals::ept_handler = new ept::ept_handler{};
     globals::pt_handler = new pt::pt_handler{};
     globals::number_of_cpus = common::get_active_processors_count();
-    globals::cpu_related_data = reinterpret_cast<per_cpu_data*>(new uint8_t[sizeof(per_cpu_data) * globals::number_of_cpus]);
-    std::shared_ptr<hv_event_handlers::vmexit_handler> vmexit_handler = std::make_shared<hv_event_handlers::kernel_hook_assistant>();
+    globals::shootdown_handler = new tlb_shootdown{ globals::number_of_cpus };
+    globals::flight_recorders = new flight_recorder[globals::number_of_cpus];
+    globals::cpu_related_data = reinterpret_cast<per_cpu_data*>(
+      new (std::align_val_t{ alignof(per_cpu_data) }) uint8_t[sizeof(per_cpu_data) * globals::number_of_cpus]);
     globals::vcpus = reinterpret_cast<vcpu*>(new uint8_t[sizeof(vcpu) * globals::number_of_cpus]);
 
-    globals::ept_handler->initialize_ept();
-    globals::pt_handler->initialize_pt();
+    // Both identity maps cover only 1GB regions present in the firmware memory map.
+    const std::vector<memory_map::physical_range> physical_ranges = memory_map::get_physical_ranges(common::size_1gb);
+    finish_phase("memory map", phase_start);
+
+    // MTRRs and PML3 tables, the identity map itself is built below by all processors.
+    globals::ept_handler->initialize_ept(physical_ranges);
+    finish_phase("EPT setup", phase_start);
+
+    page_tables_context page_tables = { .physical_ranges = physical_ranges, .host_tables_taken = false, .status = true };
+
+    common::run_on_all_processors_concurrently([](void* callback_context)
+      {
+        auto& context = *static_cast<page_tables_context*>(callback_context);
+        const uint64_t start_tsc = __rdtsc();
+
+        try
+        {
+          // The first processor to arrive builds host page tables, others start with EPT regions right away.
+          if (!context.host_tables_taken.exchange(true))
+          {
+            globals::pt_handler->initialize_pt(context.physical_ranges);
+          }
+
+          [[maybe_unused]] const uint32_t regions_count = globals::ept_handler->map_identity_regions();
+
+          PRINT(("Processor %d has mapped %d EPT regions in %llu ticks.\n",
+            common::get_current_processor_number(), regions_count, __rdtsc() - start_tsc));
+        }
+        catch (std::exception& e)
+        {
+          PRINT(("%a\n", e.what()));
+          context.status = false;
+        }
 
-    for (size_t j = 0; j < globals::number_of_cpus; j++)
+      }, &page_tables);
+
+    if (!page_tables.status.load())
     {
-      new (&globals::vcpus[j]) vcpu{ vmexit_handler };
+      throw std::exception{ __FUNCTION__": ""Failed to build identity maps." };
     }
 
+    globals::ept_handler->complete_identity_map();
+    finish_phase("identity maps", phase_start);
+
+    extended_state::initialize_features();
     initialize_host_idt();
 
-    // Atomic because it is possible to read wrong value from callback_status
-    // because store buffer is not flushed on another logical CPU.
-    std::atomic<bool> callback_status = true;
-    std::pair<vcpu*, std::atomic<bool>&> callback_argument = { globals::vcpus, callback_status };
+    // Every processor constructs and launches its own vcpu, so VMX regions are allocated and touched first by their owner.
+    vcpus_context vcpus = { .vmexit_handler = std::make_shared<hv_event_handlers::kernel_hook_assistant>(), .status = true };
 
-    common::run_on_all_processors([](void* callback_context)
+    common::run_on_all_processors_concurrently([](void* callback_context)
       {
+        auto& context = *static_cast<vcpus_context*>(callback_context);
+        const uint32_t processor_number = common::get_current_processor_number();
 
-        auto [vcpu_array, callback_status_inner] =
-          *static_cast<std::pair<vcpu*, std::atomic<bool>&>*>(callback_context);
-        new (&globals::cpu_related_data[common::get_current_processor_number()]) per_cpu_data{};
+        new (&globals::cpu_related_data[processor_number]) per_cpu_data{};
 
         try
         {
-          vcpu_array[common::get_current_processor_number()].initialize_guest();
+          vcpu* cpu_obj = new (&globals::vcpus[processor_number]) vcpu{ context.vmexit_handler };
+          cpu_obj->initialize_guest();
         }
         catch (std::exception& e)
         {
           PRINT(("%a\n", e.what()));
-          callback_status_inner = false;
+          context.status = false;
         }
 
-      }, &callback_argument);
+      }, &vcpus);
 
-    if (!callback_status.load())
+    if (!vcpus.status.load())
     {
       throw std::exception{};
     }
 
+    finish_phase("vcpus", phase_start);
+
     if (vmx::vmcall(vmx::vmcall_number::test) != common::status::hv_success)
     {
       throw std::exception(__FUNCTION__": ""Hypervisor initialized but test vmcall failed.");
@@ -6,6 +6,7 @@
 #include "efi_stub.hpp"
 #include "globals.hpp"
 #include "per_cpu_data.hpp"
+#include "tlb_shootdown.hpp"
 
 namespace hh::hv_operations
 {
@@ -80,6 +81,11 @@ namespace hh
 
     if (stack->interrupt_number == static_cast<uint64_t>(exception_vector::nmi_interrupt))
     {
+      if (globals::shootdown_handler->handle_nmi())
+      {
+        return;
+      }
+
       globals::vcpus[per_cpu_data::get_cpu_id()].set_nmi_window_exiting(true);
       return;
     }
@@ -0,0 +1,220 @@
+#include "kernel_locator.hpp"
+#include <intrin.h>
+#include <Windows.h>
+#include <string_view>
+#include "common.hpp"
+#include "vcpu.hpp"
+#include "guest_memory.hpp"
+#include "segment.hpp"
+#include "msr.hpp"
+
+namespace hh::kernel_locator
+{
+  namespace
+  {
+    // Export directory keeps the file name the kernel was built as, the loader copies the right one to ntoskrnl.exe.
+    constexpr std::string_view kernel_image_names[] = { "ntoskrnl.exe", "ntkrnlmp.exe", "ntkrnlpa.exe", "ntkrnlpamp.exe" };
+    constexpr size_t max_kernel_image_name_size = sizeof("ntkrnlpamp.exe");
+    constexpr uint32_t max_headers_offset = common::page_size;
+
+    struct guest_context
+    {
+      vcpu* cpu_obj;
+      x86::cr3_t cr3;
+      x86::cr4_t cr4;
+      uint32_t probed_candidates;
+    };
+
+    bool is_mapped(const guest_context& context, uint64_t virtual_address, uint64_t& region_size) noexcept
+    {
+      uint64_t physical_address;
+      common::guest_walk_path path;
+
+      return common::try_walk_guest_page_tables(context.cr3, context.cr4, virtual_address, physical_address, region_size, path) == 0;
+    }
+
+    // Every page is checked before guest_memory is created, so unmapped memory doesn't throw.
+    bool try_read(const guest_context& context, uint64_t virtual_address, void* destination, size_t size) noexcept
+    {
+      const uint64_t end = virtual_address + size;
+
+      for (uint64_t page = virtual_address & ~common::page_4kb_offset_mask; page < end; page += common::page_size)
+      {
+        uint64_t region_size;
+
+        if (!is_mapped(context, page, region_size))
+        {
+          return false;
+        }
+      }
+
+      try
+      {
+        pt::guest_memory{ context.cr3, virtual_address, size }.read(destination, 0, size);
+      }
+      catch (...)
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+    bool is_kernel_image(guest_context& context, uint64_t candidate, uint64_t anchor) noexcept
+    {
+      context.probed_candidates++;
+
+      IMAGE_DOS_HEADER dos_header;
+
+      if (!try_read(context, candidate, &dos_header, sizeof(dos_header)) || dos_header.e_magic != IMAGE_DOS_SIGNATURE
+        || dos_header.e_lfanew <= 0 || static_cast<uint32_t>(dos_header.e_lfanew) > max_headers_offset)
+      {
+        return false;
+      }
+
+      IMAGE_NT_HEADERS64 nt_headers;
+
+      if (!try_read(context, candidate + dos_header.e_lfanew, &nt_headers, sizeof(nt_headers))
+        || nt_headers.Signature != IMAGE_NT_SIGNATURE || nt_headers.FileHeader.Machine != IMAGE_FILE_MACHINE_AMD64)
+      {
+        return false;
+      }
+
+      // The anchor must lie inside of the image, otherwise it's some other module.
+      if (anchor - candidate >= nt_headers.OptionalHeader.SizeOfImage)
+      {
+        return false;
+      }
+
+      const IMAGE_DATA_DIRECTORY& export_directory = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+      IMAGE_EXPORT_DIRECTORY export_data;
+
+      if (!export_directory.VirtualAddress
+        || !try_read(context, candidate + export_directory.VirtualAddress, &export_data, sizeof(export_data)))
+      {
+        return false;
+      }
+
+      char name[max_kernel_image_name_size];
+
+      if (!try_read(context, candidate + export_data.Name, name, sizeof(name)))
+      {
+        return false;
+      }
+
+      size_t name_length = 0;
+
+      for (; name_length < sizeof(name) && name[name_length] != '\0'; name_length++)
+      {
+        if (name[name_length] >= 'A' && name[name_length] <= 'Z')
+        {
+          name[name_length] = static_cast<char>(name[name_length] - 'A' + 'a');
+        }
+      }
+
+      for (const std::string_view kernel_image_name : kernel_image_names)
+      {
+        if (std::string_view{ name, name_length } == kernel_image_name)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    uint64_t probe_anchor(guest_context& context, uint64_t anchor) noexcept
+    {
+      const uint64_t lowest_candidate = anchor > max_scan_distance ? anchor - max_scan_distance : 0;
+
+      // Windows maps the kernel with large pages, so its base is normally 2mb aligned.
+      for (uint64_t candidate = anchor & ~common::page_2mb_offset_mask; candidate >= lowest_candidate; candidate -= common::size_2mb)
+      {
+        if (is_kernel_image(context, candidate, anchor))
+        {
+          return candidate;
+        }
+
+        if (candidate < common::size_2mb)
+        {
+          break;
+        }
+      }
+
+      for (uint64_t candidate = anchor & ~common::page_4kb_offset_mask; candidate >= lowest_candidate;)
+      {
+        uint64_t region_size;
+
+        if (!is_mapped(context, candidate, region_size))
+        {
+          // Jump to the last page of the previous region.
+          const uint64_t region_base = candidate & ~(region_size - 1);
+
+          if (region_base < common::page_size)
+          {
+            break;
+          }
+
+          candidate = region_base - common::page_size;
+          continue;
+        }
+
+        if (is_kernel_image(context, candidate, anchor))
+        {
+          return candidate;
+        }
+
+        if (candidate < common::page_size)
+        {
+          break;
+        }
+
+        candidate -= common::page_size;
+      }
+
+      return 0;
+    }
+  }
+
+  result find_ntoskrnl(vcpu* cpu_obj) noexcept
+  {
+    const uint64_t start_tsc = __rdtsc();
+
+    guest_context context = { cpu_obj, cpu_obj->guest_cr3(), cpu_obj->guest_cr4(), 0 };
+    result located = {};
+
+    struct anchor
+    {
+      const char* name;
+      uint64_t address;
+    };
+
+    anchor anchors[3] = {};
+    uint32_t anchors_count = 0;
+
+    x86::idt_entry_t divide_error_entry;
+
+    if (try_read(context, cpu_obj->guest_idtr().base_address, &divide_error_entry, sizeof(divide_error_entry)))
+    {
+      anchors[anchors_count++] = { "#DE handler", reinterpret_cast<uint64_t>(divide_error_entry.base_address()) };
+    }
+
+    // Root mode doesn't switch IA32_LSTAR, so it holds the guest system call entry.
+    anchors[anchors_count++] = { "IA32_LSTAR", x86::msr::read<x86::msr::lstar>() };
+    anchors[anchors_count++] = { "guest RIP", cpu_obj->guest_rip() };
+
+    for (uint32_t j = 0; j < anchors_count && !located.image_base; j++)
+    {
+      located.image_base = probe_anchor(context, anchors[j].address);
+      located.anchor_name = anchors[j].name;
+    }
+
+    located.elapsed_ticks = __rdtsc() - start_tsc;
+    located.probed_candidates = context.probed_candidates;
+
+    PRINT(("ntoskrnl.exe locator: base = 0x%llx, anchor = %a, candidates = %d, ticks = %llu\n",
+      located.image_base, located.anchor_name, located.probed_candidates, located.elapsed_ticks));
+
+    return located;
+  }
+}
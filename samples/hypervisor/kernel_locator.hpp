@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+
+namespace hh
+{
+  class vcpu;
+}
+
+// Finds ntoskrnl.exe image in guest memory. Search starts from architectural anchors that point into
+// the kernel image (#DE handler from guest IDT, IA32_LSTAR and guest RIP), candidates are probed on 2mb
+// boundaries first and page by page only if that fails. Unmapped regions are skipped as a whole and
+// guest memory is probed without exceptions.
+namespace hh::kernel_locator
+{
+  // Maximum distance between an anchor and the image base.
+  inline constexpr uint64_t max_scan_distance = 0x1000ull * 0x1000;
+
+  struct result
+  {
+    uint64_t image_base;
+    uint64_t elapsed_ticks;
+    uint32_t probed_candidates;
+    const char* anchor_name;
+  };
+
+  // Image base is zero if the kernel hasn't been found.
+  result find_ntoskrnl(vcpu* cpu_obj) noexcept;
+}
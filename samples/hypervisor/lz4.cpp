@@ -0,0 +1,139 @@
+#include "lz4.hpp"
+#include <intrin.h>
+#include <cstring>
+#include <exception>
+
+namespace hh::lz4
+{
+  namespace
+  {
+    constexpr size_t min_match = 4;
+    constexpr uint8_t length_mask = 0xf;
+    constexpr uint8_t length_continuation = 0xff;
+    constexpr size_t wild_copy_length = sizeof(__m128i);
+
+    size_t read_length(const uint8_t*& input, const uint8_t* input_end, size_t length)
+    {
+      if (length != length_mask)
+      {
+        return length;
+      }
+
+      uint8_t next;
+
+      do
+      {
+        if (input == input_end)
+        {
+          throw std::exception{ __FUNCTION__": ""Block is truncated." };
+        }
+
+        next = *input++;
+        length += next;
+      } while (next == length_continuation);
+
+      return length;
+    }
+
+    // Copies 16 bytes at a time and may touch up to 15 bytes past the end of both buffers.
+    void wild_copy(uint8_t* destination, const uint8_t* source, size_t length) noexcept
+    {
+      uint8_t* const destination_end = destination + length;
+
+      do
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)));
+        destination += wild_copy_length;
+        source += wild_copy_length;
+      } while (destination < destination_end);
+    }
+  }
+
+  size_t decompress(const uint8_t* source, size_t source_size, uint8_t* destination, size_t destination_capacity)
+  {
+    const uint8_t* input = source;
+    const uint8_t* const input_end = source + source_size;
+    uint8_t* output = destination;
+    uint8_t* const output_end = destination + destination_capacity;
+
+    while (input < input_end)
+    {
+      const uint8_t token = *input++;
+      const size_t literals_length = read_length(input, input_end, token >> 4);
+
+      if (literals_length > static_cast<size_t>(input_end - input) || literals_length > static_cast<size_t>(output_end - output))
+      {
+        throw std::exception{ __FUNCTION__": ""Literals are out of bounds." };
+      }
+
+      // Wild copy is used only while both buffers have enough margin, the tail is copied exactly.
+      if (static_cast<size_t>(input_end - input) >= literals_length + wild_copy_length
+        && static_cast<size_t>(output_end - output) >= literals_length + wild_copy_length)
+      {
+        wild_copy(output, input, literals_length);
+      }
+      else
+      {
+        memcpy(output, input, literals_length);
+      }
+
+      input += literals_length;
+      output += literals_length;
+
+      // The last sequence has literals only.
+      if (input == input_end)
+      {
+        break;
+      }
+
+      if (input_end - input < 2)
+      {
+        throw std::exception{ __FUNCTION__": ""Block is truncated." };
+      }
+
+      const size_t offset = input[0] | static_cast<size_t>(input[1]) << 8;
+      input += 2;
+
+      if (offset == 0 || offset > static_cast<size_t>(output - destination))
+      {
+        throw std::exception{ __FUNCTION__": ""Match offset is out of bounds." };
+      }
+
+      const size_t match_length = read_length(input, input_end, token & length_mask) + min_match;
+
+      if (match_length > static_cast<size_t>(output_end - output))
+      {
+        throw std::exception{ __FUNCTION__": ""Match is out of bounds." };
+      }
+
+      const uint8_t* match = output - offset;
+
+      const bool has_margin = static_cast<size_t>(output_end - output) >= match_length + wild_copy_length;
+
+      // Chunks don't overlap if the match is far enough behind, otherwise bytes are
+      // copied one by one so the match repeats its own output.
+      if (offset >= wild_copy_length && has_margin)
+      {
+        wild_copy(output, match, match_length);
+      }
+      else if (offset >= sizeof(uint64_t) && has_margin)
+      {
+        for (size_t j = 0; j < match_length; j += sizeof(uint64_t))
+        {
+          memcpy(output + j, match + j, sizeof(uint64_t));
+        }
+      }
+      else
+      {
+        for (size_t j = 0; j < match_length; j++)
+        {
+          output[j] = match[j];
+        }
+      }
+
+      output += match_length;
+    }
+
+    return output - destination;
+  }
+}
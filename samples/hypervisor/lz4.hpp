@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Decoder of the LZ4 block format. Blocks are produced by win_driver/pack_win_driver.py.
+
+namespace hh::lz4
+{
+  // Decompresses a single block and returns the number of written bytes.
+  // Throws if the block is malformed or doesn't fit into the destination.
+  size_t decompress(const uint8_t* source, size_t source_size, uint8_t* destination, size_t destination_capacity);
+}
@@ -0,0 +1,95 @@
+#include "memory_map.hpp"
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include "uefi.hpp"
+#include "common.hpp"
+
+namespace hh::memory_map
+{
+  namespace
+  {
+    constexpr uint64_t low_memory_limit = 0x100000000;
+
+    // Allocation of the buffer may add a few descriptors to the map.
+    constexpr uint32_t spare_descriptors_count = 8;
+  }
+
+  void coalesce(std::vector<physical_range>& ranges, uint64_t granularity)
+  {
+    for (physical_range& range : ranges)
+    {
+      range.base &= ~(granularity - 1);
+      range.end = (range.end + granularity - 1) & ~(granularity - 1);
+    }
+
+    std::sort(ranges.begin(), ranges.end(), [](const physical_range& first, const physical_range& second)
+      {
+        return first.base < second.base;
+      });
+
+    size_t count = 0;
+
+    for (const physical_range& range : ranges)
+    {
+      if (range.base == range.end)
+      {
+        continue;
+      }
+
+      if (count != 0 && range.base <= ranges[count - 1].end)
+      {
+        ranges[count - 1].end = (std::max)(ranges[count - 1].end, range.end);
+      }
+      else
+      {
+        ranges[count++] = range;
+      }
+    }
+
+    ranges.resize(count);
+  }
+
+  std::vector<physical_range> get_physical_ranges(uint64_t granularity)
+  {
+    UINTN map_size = 0;
+    UINTN map_key;
+    UINTN descriptor_size = 0;
+    UINT32 descriptor_version;
+    std::unique_ptr<uint8_t[]> map;
+
+    EFI_STATUS status = gBS->GetMemoryMap(&map_size, nullptr, &map_key, &descriptor_size, &descriptor_version);
+
+    while (status == EFI_BUFFER_TOO_SMALL)
+    {
+      map_size += spare_descriptors_count * descriptor_size;
+      map = std::make_unique<uint8_t[]>(map_size);
+      status = gBS->GetMemoryMap(&map_size, reinterpret_cast<EFI_MEMORY_DESCRIPTOR*>(map.get()), &map_key, &descriptor_size, &descriptor_version);
+    }
+
+    if (EFI_ERROR(status) || descriptor_size < sizeof(EFI_MEMORY_DESCRIPTOR))
+    {
+      throw std::exception{ __FUNCTION__": ""Cannot get firmware memory map." };
+    }
+
+    std::vector<physical_range> ranges;
+    ranges.reserve(map_size / descriptor_size + 1);
+    ranges.push_back({ 0, low_memory_limit });
+
+    // Descriptor size may be larger than EFI_MEMORY_DESCRIPTOR.
+    for (UINTN offset = 0; offset + descriptor_size <= map_size; offset += descriptor_size)
+    {
+      const auto* descriptor = reinterpret_cast<const EFI_MEMORY_DESCRIPTOR*>(map.get() + offset);
+      ranges.push_back({ descriptor->PhysicalStart, descriptor->PhysicalStart + descriptor->NumberOfPages * common::page_size });
+    }
+
+    coalesce(ranges, granularity);
+
+    for (const physical_range& range : ranges)
+    {
+      PRINT(("Physical range 0x%llx - 0x%llx\n", range.base, range.end));
+    }
+
+    return ranges;
+  }
+}
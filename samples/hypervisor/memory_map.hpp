@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace hh::memory_map
+{
+  // Range of physical address space, end is exclusive.
+  struct physical_range
+  {
+    uint64_t base;
+    uint64_t end;
+  };
+
+  // Expands ranges to the granularity, sorts them and merges ranges that overlap or touch.
+  void coalesce(std::vector<physical_range>& ranges, uint64_t granularity);
+
+  // Ranges described by the firmware memory map expanded to the granularity. Low 4GB are always present
+  // because MMIO below 4GB is described by the memory map only partially. Must be called before ExitBootServices.
+  std::vector<physical_range> get_physical_ranges(uint64_t granularity);
+}
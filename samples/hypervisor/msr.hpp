@@ -419,6 +419,27 @@ namespace hh
         }flags;
       };
 
+      // IA32_MTRR_FIX64K_00000, each byte describes 64KB range.
+      struct mtrr_fix64k
+      {
+        static constexpr uint32_t msr_id = 0x250;
+        using result_type = uint64_t;
+      };
+
+      // IA32_MTRR_FIX16K_80000 and IA32_MTRR_FIX16K_A0000, each byte describes 16KB range.
+      struct mtrr_fix16k
+      {
+        static constexpr uint32_t msr_id = 0x258;
+        using result_type = uint64_t;
+      };
+
+      // IA32_MTRR_FIX4K_C0000 through IA32_MTRR_FIX4K_F8000, each byte describes 4KB range.
+      struct mtrr_fix4k
+      {
+        static constexpr uint32_t msr_id = 0x268;
+        using result_type = uint64_t;
+      };
+
       union mttr_capabilities_register_t
       {
         static constexpr uint32_t msr_id = 0x000000FE;
@@ -0,0 +1,180 @@
+#include "mtrr.hpp"
+#include <intrin.h>
+
+namespace hh::mtrr
+{
+  namespace
+  {
+    constexpr uint64_t memory_type_mask = 0xff;
+    constexpr uint64_t def_type_fixed_enable = 1ull << 10;
+    constexpr uint64_t def_type_enable = 1ull << 11;
+    constexpr uint64_t phys_mask_valid = 1ull << 11;
+    constexpr uint64_t phys_address_mask = 0x000ffffffffff000;
+
+    constexpr uint64_t fixed_64k_limit = 0x80000;
+    constexpr uint64_t fixed_16k_limit = 0xc0000;
+    constexpr uint32_t fixed_64k_count = 8;
+    constexpr uint32_t fixed_16k_count = 16;
+
+    constexpr uint32_t type_bit(ept::memory_type type) noexcept
+    {
+      return 1u << static_cast<uint32_t>(type);
+    }
+
+    // 11.11.4.1 MTRR Precedences. Overlaps not defined by the SDM are treated as UC.
+    ept::memory_type combine_types(uint32_t types) noexcept
+    {
+      if (types & type_bit(ept::memory_type::uncacheable))
+      {
+        return ept::memory_type::uncacheable;
+      }
+
+      if ((types & (types - 1)) == 0)
+      {
+        unsigned long index;
+        _BitScanForward(&index, types);
+
+        return static_cast<ept::memory_type>(index);
+      }
+
+      if (types == (type_bit(ept::memory_type::write_through) | type_bit(ept::memory_type::write_back)))
+      {
+        return ept::memory_type::write_through;
+      }
+
+      return ept::memory_type::uncacheable;
+    }
+  }
+
+  resolver::resolver() noexcept : enabled_{}, fixed_enabled_{}, default_type_{ ept::memory_type::uncacheable }, fixed_types_{}
+  {}
+
+  uint32_t resolver::fixed_range_index(uint64_t physical_address) noexcept
+  {
+    if (physical_address < fixed_64k_limit)
+    {
+      return static_cast<uint32_t>(physical_address >> 16);
+    }
+
+    if (physical_address < fixed_16k_limit)
+    {
+      return fixed_64k_count + static_cast<uint32_t>((physical_address - fixed_64k_limit) >> 14);
+    }
+
+    return fixed_64k_count + fixed_16k_count + static_cast<uint32_t>((physical_address - fixed_16k_limit) >> 12);
+  }
+
+  void resolver::set_def_type(uint64_t def_type) noexcept
+  {
+    enabled_ = def_type & def_type_enable;
+    fixed_enabled_ = def_type & def_type_fixed_enable;
+    default_type_ = static_cast<ept::memory_type>(def_type & memory_type_mask);
+  }
+
+  void resolver::set_fixed_msr(uint32_t index, uint64_t value) noexcept
+  {
+    if (index >= fixed_msrs_count)
+    {
+      return;
+    }
+
+    // Every byte describes one range.
+    for (uint32_t j = 0; j < 8; j++)
+    {
+      fixed_types_[index * 8 + j] = static_cast<ept::memory_type>((value >> j * 8) & memory_type_mask);
+    }
+  }
+
+  void resolver::add_variable_msrs(uint64_t phys_base, uint64_t phys_mask)
+  {
+    if (!(phys_mask & phys_mask_valid))
+    {
+      return;
+    }
+
+    variable_ranges_.push_back({ phys_base & phys_address_mask, phys_mask & phys_address_mask,
+      static_cast<ept::memory_type>(phys_base & memory_type_mask) });
+  }
+
+  const std::vector<resolver::variable_range>& resolver::variable_ranges() const noexcept
+  {
+    return variable_ranges_;
+  }
+
+  bool resolver::get_variable_memory_type(uint64_t physical_address, uint64_t size, ept::memory_type& type) const noexcept
+  {
+    const uint64_t offset_mask = size - 1;
+    uint32_t types = 0;
+
+    for (const variable_range& range : variable_ranges_)
+    {
+      // Address within range AND mask == base AND mask. Bits that vary inside the region can't be compared.
+      if ((physical_address ^ range.base) & range.mask & ~offset_mask)
+      {
+        continue;
+      }
+
+      // Only part of the region matches the range.
+      if (range.mask & offset_mask)
+      {
+        return false;
+      }
+
+      types |= type_bit(range.type);
+    }
+
+    type = types ? combine_types(types) : default_type_;
+
+    return true;
+  }
+
+  ept::memory_type resolver::get_memory_type(uint64_t physical_address) const noexcept
+  {
+    ept::memory_type type;
+
+    // 4KB page is always uniform, MTRR granularity is 4KB.
+    get_uniform_memory_type(physical_address & ~0xfffull, 0x1000, type);
+
+    return type;
+  }
+
+  bool resolver::get_uniform_memory_type(uint64_t physical_address, uint64_t size, ept::memory_type& type) const noexcept
+  {
+    if (!enabled_)
+    {
+      type = ept::memory_type::uncacheable;
+      return true;
+    }
+
+    if (!fixed_enabled_ || physical_address >= fixed_ranges_limit)
+    {
+      return get_variable_memory_type(physical_address, size, type);
+    }
+
+    // Fixed ranges take precedence over variable ones in the first 1MB.
+    const uint64_t end = physical_address + size;
+    const uint64_t fixed_end = end < fixed_ranges_limit ? end : fixed_ranges_limit;
+    type = fixed_types_[fixed_range_index(physical_address)];
+
+    for (uint64_t address = physical_address; address < fixed_end; address += 0x1000)
+    {
+      if (fixed_types_[fixed_range_index(address)] != type)
+      {
+        return false;
+      }
+    }
+
+    // The rest of a region that starts at zero is covered by naturally aligned blocks of doubling size.
+    for (uint64_t block = fixed_ranges_limit; block < end; block *= 2)
+    {
+      ept::memory_type block_type;
+
+      if (!get_variable_memory_type(block, block, block_type) || block_type != type)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+}
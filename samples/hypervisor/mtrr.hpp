@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "ept.hpp"
+
+namespace hh::mtrr
+{
+  // Resolves memory types described by fixed and variable range MTRRs, Vol3A[11.11].
+  // It takes raw MSR values and never reads MSRs itself, so it can be filled from a recorded dump.
+  class resolver
+  {
+  public:
+    // Fixed range MSRs in address order: FIX64K_00000, FIX16K_80000, FIX16K_A0000, FIX4K_C0000 ... FIX4K_F8000.
+    static constexpr uint32_t fixed_msrs_count = 11;
+    static constexpr uint64_t fixed_ranges_limit = 0x100000;
+
+    struct variable_range
+    {
+      uint64_t base;
+      uint64_t mask;
+      ept::memory_type type;
+    };
+
+  private:
+    static constexpr uint32_t fixed_ranges_count = fixed_msrs_count * 8;
+
+    bool enabled_;
+    bool fixed_enabled_;
+    ept::memory_type default_type_;
+    ept::memory_type fixed_types_[fixed_ranges_count];
+    std::vector<variable_range> variable_ranges_;
+
+  private:
+    static uint32_t fixed_range_index(uint64_t physical_address) noexcept;
+    bool get_variable_memory_type(uint64_t physical_address, uint64_t size, ept::memory_type& type) const noexcept;
+
+  public:
+    resolver() noexcept;
+
+    void set_def_type(uint64_t def_type) noexcept;
+    void set_fixed_msr(uint32_t index, uint64_t value) noexcept;
+
+    // Disabled pairs are ignored.
+    void add_variable_msrs(uint64_t phys_base, uint64_t phys_mask);
+
+    const std::vector<variable_range>& variable_ranges() const noexcept;
+
+    // Memory type of the 4KB page.
+    ept::memory_type get_memory_type(uint64_t physical_address) const noexcept;
+
+    // Returns false if the memory type isn't the same over the whole naturally aligned region, which size is a power of two.
+    bool get_uniform_memory_type(uint64_t physical_address, uint64_t size, ept::memory_type& type) const noexcept;
+  };
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+
+// Walk of IA-32e paging structures, 4 or 5 levels deep.
+// This header is shared with win driver so it must stay free of hypervisor dependencies.
+namespace hh::pt
+{
+  inline constexpr uint32_t max_paging_levels = 5;
+
+  // Indexed by level of the entry that isn't present minus one.
+  inline constexpr const char* not_present_messages[max_paging_levels] =
+  {
+    "PML1 isn't present.",
+    "PML2 isn't present.",
+    "PML3 isn't present.",
+    "PML4 isn't present.",
+    "PML5 isn't present."
+  };
+
+  // Translates virtual address through tables rooted at the given physical address.
+  // entry_at(table_physical_address, index) returns pointer to the entry, every present entry
+  // is read once and passed to on_entry(entry_pointer, value) on the way down. Returns 0 on success
+  // or the level of the first entry that isn't present. Page size is the size of the region mapped
+  // by the last visited entry, so on failure the caller may skip the whole unmapped region.
+  template <typename EntryAt, typename OnEntry>
+  uint32_t walk_page_tables(uint64_t root_table_address, uint32_t levels, uint64_t virtual_address,
+    EntryAt&& entry_at, OnEntry&& on_entry, uint64_t& physical_address, uint64_t& page_size) noexcept
+  {
+    constexpr uint32_t page_shift = 12;
+    constexpr uint32_t index_bits = 9;
+    constexpr uint64_t index_mask = (1ull << index_bits) - 1;
+    constexpr uint64_t present_bit = 1ull << 0;
+    constexpr uint64_t large_page_bit = 1ull << 7;
+    constexpr uint64_t frame_mask = 0x0000FFFFFFFFF000ull;
+
+    uint64_t table_address = root_table_address;
+
+    for (uint32_t level = levels; level != 0; level--)
+    {
+      const uint32_t index_shift = page_shift + index_bits * (level - 1);
+      const volatile uint64_t* entry_pointer = entry_at(table_address, (virtual_address >> index_shift) & index_mask);
+
+      // Entry may be changed concurrently, so only the value read here is used.
+      const uint64_t entry = *entry_pointer;
+
+      page_size = 1ull << index_shift;
+
+      if (!(entry & present_bit))
+      {
+        return level;
+      }
+
+      on_entry(entry_pointer, entry);
+
+      // Page size bit exists only in PML3 and PML2 entries.
+      if (level == 1 || ((level == 2 || level == 3) && (entry & large_page_bit)))
+      {
+        // Bit 12 of large page entries is PAT, so the frame is masked by the page size.
+        physical_address = (entry & frame_mask & ~(page_size - 1)) + (virtual_address & (page_size - 1));
+        return 0;
+      }
+
+      table_address = entry & frame_mask;
+    }
+
+    // Unreachable, PML1 entry is always a leaf.
+    return 1;
+  }
+}
@@ -1,18 +1,28 @@
 #include "pe.hpp"
 #include <memory>
-#include <ranges>
-#include "pt_handler.hpp"
-#include "globals.hpp"
 #include <algorithm>
+#include "guest_memory.hpp"
+#include "globals.hpp"
 #include "vcpu.hpp"
 #include "per_cpu_data.hpp"
 
 namespace hh::portable_executable
 {
-  static bool iequals(const std::string_view& lhs, const std::string_view& rhs)
+  static bool equals_ignoring_case(std::string_view lhs, std::string_view rhs) noexcept
   {
-    auto to_lower{ std::ranges::views::transform(std::tolower) };
-    return std::ranges::equal(lhs | to_lower, rhs | to_lower);
+    if (lhs.size() != rhs.size())
+      return false;
+
+    for (size_t j = 0; j < lhs.size(); j++)
+    {
+      const char lhs_char = lhs[j] >= 'A' && lhs[j] <= 'Z' ? lhs[j] - 'A' + 'a' : lhs[j];
+      const char rhs_char = rhs[j] >= 'A' && rhs[j] <= 'Z' ? rhs[j] - 'A' + 'a' : rhs[j];
+
+      if (lhs_char != rhs_char)
+        return false;
+    }
+
+    return true;
   }
 
   IMAGE_NT_HEADERS64* get_nt_headers(void* image_base) noexcept
@@ -129,75 +139,163 @@ namespace hh::portable_executable
     }
   }
 
-  uint64_t get_kernel_module_export(uint64_t kernel_module_base, std::string_view function_name)
+  export_index::export_index(uint64_t module_base) : module_base_{ module_base }, directory_rva_{}, directory_size_{}, directory_{},
+    name_table_{}, ordinal_table_{}, function_table_{}, buckets_{}, chain_{}, buckets_mask_{}, names_count_{}, functions_count_{}
   {
-    if (!kernel_module_base)
-      return 0;
+    if (!module_base_)
+      return;
+
+    const x86::cr3_t guest_cr3 = per_cpu_data::get_vcpu()->guest_cr3();
+
+    const auto dos_header = pt::guest_memory{ guest_cr3, module_base_, sizeof(IMAGE_DOS_HEADER) }.read<IMAGE_DOS_HEADER>(0);
+
+    if (dos_header.e_magic != IMAGE_DOS_SIGNATURE)
+      return;
+
+    const auto nt_headers = pt::guest_memory{ guest_cr3, module_base_ + dos_header.e_lfanew, sizeof(IMAGE_NT_HEADERS64) }
+      .read<IMAGE_NT_HEADERS64>(0);
+
+    if (nt_headers.Signature != IMAGE_NT_SIGNATURE)
+      return;
+
+    directory_rva_ = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].VirtualAddress;
+    directory_size_ = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].Size;
+
+    if (!directory_rva_ || directory_size_ < sizeof(IMAGE_EXPORT_DIRECTORY))
+      return;
+
+    // Extra zero byte terminates the last name even if the directory is truncated.
+    directory_ = std::make_unique<uint8_t[]>(directory_size_ + 1);
+    pt::guest_memory{ guest_cr3, module_base_ + directory_rva_, directory_size_ }.read(directory_.get(), 0, directory_size_);
 
-    IMAGE_DOS_HEADER dos_header = {};
-    IMAGE_NT_HEADERS64 nt_headers = {};
+    const auto export_directory = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY*>(directory_.get());
 
-    const auto mapped_dos_header =
-      globals::pt_handler->map_guest_address(globals::vcpus[per_cpu_data::get_cpu_id()].guest_cr3(),
-      reinterpret_cast<uint8_t*>(kernel_module_base), sizeof(dos_header));
-    mapped_dos_header->memcpy(&dos_header, 0, sizeof(dos_header));
+    name_table_ = directory_pointer<uint32_t>(export_directory->AddressOfNames, export_directory->NumberOfNames);
+    ordinal_table_ = directory_pointer<uint16_t>(export_directory->AddressOfNameOrdinals, export_directory->NumberOfNames);
+    function_table_ = directory_pointer<uint32_t>(export_directory->AddressOfFunctions, export_directory->NumberOfFunctions);
 
-    if(dos_header.e_magic != IMAGE_DOS_SIGNATURE)
+    if (!name_table_ || !ordinal_table_ || !function_table_)
     {
-      return 0;
+      directory_.reset();
+      return;
     }
 
-    const auto mapped_nt_headers =
-      globals::pt_handler->map_guest_address(globals::vcpus[per_cpu_data::get_cpu_id()].guest_cr3(),
-      reinterpret_cast<uint8_t*>(kernel_module_base + dos_header.e_lfanew), sizeof(nt_headers));
-    mapped_nt_headers->memcpy(&nt_headers, 0, sizeof(nt_headers));
+    for (uint32_t j = 0; j < export_directory->NumberOfNames; j++)
+    {
+      if (name_table_[j] < directory_rva_ || name_table_[j] - directory_rva_ >= directory_size_)
+      {
+        directory_.reset();
+        return;
+      }
+    }
 
-    if(nt_headers.Signature != IMAGE_NT_SIGNATURE)
+    // At most two names per bucket on average.
+    uint32_t buckets_count = 1;
+
+    while (buckets_count < export_directory->NumberOfNames / 2)
     {
-      return 0;
+      buckets_count *= 2;
     }
 
-    const auto export_base = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].VirtualAddress;
-    const auto export_base_size = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].Size;
+    buckets_ = std::make_unique<uint32_t[]>(buckets_count);
+    chain_ = std::make_unique<uint32_t[]>(export_directory->NumberOfNames);
+    buckets_mask_ = buckets_count - 1;
 
-    if (!export_base || !export_base_size)
-      return 0;
+    for (uint32_t j = 0; j < buckets_count; j++)
+    {
+      buckets_[j] = end_of_chain_;
+    }
+
+    // Names are pushed to the chain heads from the last one, so equal names are found
+    // in AddressOfNames order and the lookup returns the same export as a linear scan would.
+    for (uint32_t j = export_directory->NumberOfNames; j-- != 0;)
+    {
+      uint32_t& head = buckets_[hash_ignoring_case(name(j)) & buckets_mask_];
+      chain_[j] = head;
+      head = j;
+    }
 
-    std::unique_ptr<IMAGE_EXPORT_DIRECTORY> export_data{ reinterpret_cast<IMAGE_EXPORT_DIRECTORY*>(new uint8_t[export_base_size]) };
+    names_count_ = export_directory->NumberOfNames;
+    functions_count_ = export_directory->NumberOfFunctions;
+  }
 
-    const auto mapped_export_data =
-      globals::pt_handler->map_guest_address(globals::vcpus[per_cpu_data::get_cpu_id()].guest_cr3(),
-      reinterpret_cast<uint8_t*>(kernel_module_base + export_base), export_base_size);
-    mapped_export_data->memcpy(export_data.get(), 0, export_base_size);
+  // Name RVAs are validated by the constructor.
+  std::string_view export_index::name(uint32_t name_index) const noexcept
+  {
+    return reinterpret_cast<const char*>(directory_.get() + (name_table_[name_index] - directory_rva_));
+  }
 
-    const auto delta = reinterpret_cast<uint64_t>(export_data.get()) - export_base;
-    const auto name_table = reinterpret_cast<uint32_t*>(export_data->AddressOfNames + delta);
-    const auto ordinal_table = reinterpret_cast<uint16_t*>(export_data->AddressOfNameOrdinals + delta);
-    const auto function_table = reinterpret_cast<uint32_t*>(export_data->AddressOfFunctions + delta);
+  // FNV-1a of the lower case name.
+  uint32_t export_index::hash_ignoring_case(std::string_view name) noexcept
+  {
+    uint32_t hash = 2166136261;
 
-    for (auto i = 0u; i < export_data->NumberOfNames; ++i)
+    for (const char current : name)
     {
-      const std::string current_function_name = std::string{ reinterpret_cast<char*>(name_table[i] + delta) };
+      hash ^= static_cast<uint8_t>(current >= 'A' && current <= 'Z' ? current - 'A' + 'a' : current);
+      hash *= 16777619;
+    }
 
-      if (iequals(current_function_name, function_name))
-      {
-        const auto function_ordinal = ordinal_table[i];
-        const auto function_address = kernel_module_base + function_table[function_ordinal];
+    return hash;
+  }
 
-        if (function_address >= kernel_module_base + export_base && function_address <= kernel_module_base + export_base + export_base_size)
-        {
-          return 0; // No forwarded exports on 64bit?
-        }
+  template <typename T>
+  const T* export_index::directory_pointer(uint32_t rva, uint64_t count) const noexcept
+  {
+    if (rva < directory_rva_ || rva - directory_rva_ + count * sizeof(T) > directory_size_)
+      return nullptr;
 
-        return function_address;
-      }
+    return reinterpret_cast<const T*>(directory_.get() + (rva - directory_rva_));
+  }
+
+  bool export_index::empty() const noexcept
+  {
+    return names_count_ == 0;
+  }
+
+  uint64_t export_index::find(std::string_view function_name) const noexcept
+  {
+    if (names_count_ == 0)
+      return 0;
+
+    uint32_t name_index = buckets_[hash_ignoring_case(function_name) & buckets_mask_];
+
+    while (name_index != end_of_chain_ && !equals_ignoring_case(name(name_index), function_name))
+    {
+      name_index = chain_[name_index];
     }
 
-    return 0;
+    if (name_index == end_of_chain_)
+      return 0;
+
+    const uint16_t function_ordinal = ordinal_table_[name_index];
+
+    if (function_ordinal >= functions_count_)
+      return 0;
+
+    const uint32_t function_rva = function_table_[function_ordinal];
+
+    // Forwarded export points to a string inside the export directory.
+    if (function_rva >= directory_rva_ && function_rva < directory_rva_ + directory_size_)
+      return 0;
+
+    return module_base_ + function_rva;
+  }
+
+  uint64_t get_kernel_module_export(uint64_t kernel_module_base, std::string_view function_name)
+  {
+    return export_index{ kernel_module_base }.find(function_name);
   }
 
   void resolve_imports(uint64_t ntoskrnl_base, const vec_imports& imports)
   {
+    const export_index ntoskrnl_exports{ ntoskrnl_base };
+
+    if (ntoskrnl_exports.empty())
+    {
+      throw std::exception{ __FUNCTION__": ""Can't read ntoskrnl.exe export directory." };
+    }
+
     for (const auto& current_import : imports)
     {
       if (current_import.module_name != "ntoskrnl.exe")
@@ -208,7 +306,7 @@ namespace hh::portable_executable
 
       for (auto& current_function_data : current_import.function_datas)
       {
-        const uint64_t function_address = get_kernel_module_export(ntoskrnl_base, current_function_data.name);
+        const uint64_t function_address = ntoskrnl_exports.find(current_function_data.name);
 
         if (!function_address)
         {
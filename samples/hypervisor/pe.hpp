@@ -1,8 +1,11 @@
 #pragma once
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <Windows.h>
+#include "delete_constructors.hpp"
 
 // Tools for mapping and parsing windows drivers and executables.
 
@@ -27,6 +30,44 @@ namespace hh::portable_executable
     std::vector<import_function_info> function_datas;
   };
 
+  // Local copy of a guest module export directory. Names are matched ignoring case through a hash table
+  // over AddressOfNames that is built in one pass, so a lookup usually costs one hash and one name comparison.
+  // The directory is copied from guest memory once and then reused for any number of lookups.
+  class export_index : non_copyable
+  {
+  private:
+    static constexpr uint32_t end_of_chain_ = ~0u;
+
+    uint64_t module_base_;
+    uint32_t directory_rva_;
+    uint32_t directory_size_;
+    std::unique_ptr<uint8_t[]> directory_;
+    const uint32_t* name_table_;
+    const uint16_t* ordinal_table_;
+    const uint32_t* function_table_;
+    std::unique_ptr<uint32_t[]> buckets_;
+    std::unique_ptr<uint32_t[]> chain_;
+    uint32_t buckets_mask_;
+    uint32_t names_count_;
+    uint32_t functions_count_;
+
+  private:
+    template <typename T>
+    const T* directory_pointer(uint32_t rva, uint64_t count) const noexcept;
+    std::string_view name(uint32_t name_index) const noexcept;
+    static uint32_t hash_ignoring_case(std::string_view name) noexcept;
+
+  public:
+    // Index stays empty if module headers are invalid or module has no exports.
+    explicit export_index(uint64_t module_base);
+
+    bool empty() const noexcept;
+
+    // Returns absolute address of the export or 0 if it isn't found or is forwarded.
+    // If several exports differ only in case, the first one in AddressOfNames wins.
+    uint64_t find(std::string_view function_name) const noexcept;
+  };
+
   using vec_sections = std::vector<IMAGE_SECTION_HEADER>;
   using vec_relocs = std::vector<reloc_info>;
   using vec_imports = std::vector<import_info>;
@@ -0,0 +1,142 @@
+#include "pml1_pool.hpp"
+#include <exception>
+#include "common.hpp"
+
+namespace hh::ept
+{
+  pml1_pool::pml1_pool(uint32_t capacity) : tables_{}, tables_physical_address_{}, capacity_{ capacity },
+    free_head_{ invalid_index }, retired_head_{ invalid_index }, in_use_count_{}, retired_count_{}
+  {
+    tables_ = new (std::align_val_t{ common::page_size }) table[capacity_];
+    tables_physical_address_ = common::virtual_address_to_physical_address(tables_);
+    metadata_ = std::make_unique<table_metadata[]>(capacity_);
+
+    // Lower tables are handed out first.
+    for (uint32_t j = capacity_; j-- > 0;)
+    {
+      metadata_[j] = { .owner = nullptr, .next = free_head_, .state = table_state::free, .mixed_memory_type = false };
+      free_head_ = j;
+    }
+  }
+
+  pml1_pool::~pml1_pool() noexcept
+  {
+    delete[] tables_;
+  }
+
+  uint32_t pml1_pool::acquire(pml2_entry* owner, bool mixed_memory_type)
+  {
+    if (free_head_ == invalid_index)
+    {
+      throw std::exception{ __FUNCTION__": ""PML1 table pool is exhausted." };
+    }
+
+    const uint32_t index = free_head_;
+    table_metadata& entry = metadata_[index];
+
+    free_head_ = entry.next;
+    entry = { .owner = owner, .next = invalid_index, .state = table_state::in_use, .mixed_memory_type = mixed_memory_type };
+    in_use_count_++;
+
+    return index;
+  }
+
+  uint32_t pml1_pool::index_of(uint64_t table_physical_address) const noexcept
+  {
+    const uint64_t offset = table_physical_address - tables_physical_address_;
+
+    // Tables are identity mapped, so physical addresses are as contiguous as virtual ones.
+    if (table_physical_address < tables_physical_address_ || offset / sizeof(table) >= capacity_)
+    {
+      return invalid_index;
+    }
+
+    return static_cast<uint32_t>(offset / sizeof(table));
+  }
+
+  pml1_entry* pml1_pool::entries(uint32_t index) const noexcept
+  {
+    return &tables_[index].pml1[0];
+  }
+
+  uint64_t pml1_pool::physical_address(uint32_t index) const noexcept
+  {
+    return tables_physical_address_ + index * sizeof(table);
+  }
+
+  const pml1_pool::table_metadata& pml1_pool::metadata(uint32_t index) const noexcept
+  {
+    return metadata_[index];
+  }
+
+  void pml1_pool::retire(uint32_t index) noexcept
+  {
+    table_metadata& entry = metadata_[index];
+
+    entry.owner = nullptr;
+    entry.state = table_state::retired;
+    entry.next = retired_head_;
+    retired_head_ = index;
+    in_use_count_--;
+    retired_count_++;
+  }
+
+  uint32_t pml1_pool::detach_retired() noexcept
+  {
+    const uint32_t chain = retired_head_;
+
+    retired_head_ = invalid_index;
+    retired_count_ = 0;
+
+    return chain;
+  }
+
+  void pml1_pool::push_chain(uint32_t& head, uint32_t chain, table_state state) noexcept
+  {
+    while (chain != invalid_index)
+    {
+      table_metadata& entry = metadata_[chain];
+      const uint32_t next = entry.next;
+
+      entry.state = state;
+      entry.next = head;
+      head = chain;
+      chain = next;
+
+      if (state == table_state::retired)
+      {
+        retired_count_++;
+      }
+    }
+  }
+
+  void pml1_pool::release(uint32_t chain) noexcept
+  {
+    push_chain(free_head_, chain, table_state::free);
+  }
+
+  void pml1_pool::retire_chain(uint32_t chain) noexcept
+  {
+    push_chain(retired_head_, chain, table_state::retired);
+  }
+
+  bool pml1_pool::exhausted() const noexcept
+  {
+    return free_head_ == invalid_index;
+  }
+
+  bool pml1_pool::has_retired() const noexcept
+  {
+    return retired_count_ != 0;
+  }
+
+  uint32_t pml1_pool::in_use_count() const noexcept
+  {
+    return in_use_count_;
+  }
+
+  uint32_t pml1_pool::capacity() const noexcept
+  {
+    return capacity_;
+  }
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "delete_constructors.hpp"
+#include "ept.hpp"
+
+namespace hh::ept
+{
+  // Pre-reserved PML1 tables for 2MB pages split to 4KB pages. Tables are consecutive pages,
+  // their bookkeeping is kept out of line, so every split costs exactly one page.
+  // A table that is no longer referenced by EPT is retired first. It may still be cached in paging-structure
+  // caches of other processors, so it is released for reuse only after INVEPT on every processor.
+  // Not thread safe: ept_handler serializes access.
+  class pml1_pool : non_relocatable
+  {
+  public:
+    static constexpr uint32_t invalid_index = ~0u;
+
+    struct table
+    {
+      DECLSPEC_ALIGN(common::page_size) pml1_entry pml1[vmm::pml1e_count];
+    };
+
+    enum class table_state : uint8_t
+    {
+      free,
+      in_use,
+      retired
+    };
+
+    struct table_metadata
+    {
+      // 2MB entry which points to the table.
+      pml2_entry* owner;
+
+      // Next table in the free or retired list.
+      uint32_t next;
+      table_state state;
+
+      // Set if the 2MB page has mixed memory types, such table is never coalesced back to a large page.
+      bool mixed_memory_type;
+    };
+
+  private:
+    table* tables_;
+    uint64_t tables_physical_address_;
+    std::unique_ptr<table_metadata[]> metadata_;
+    uint32_t capacity_;
+    uint32_t free_head_;
+    uint32_t retired_head_;
+    uint32_t in_use_count_;
+    uint32_t retired_count_;
+
+  private:
+    void push_chain(uint32_t& head, uint32_t chain, table_state state) noexcept;
+
+  public:
+    explicit pml1_pool(uint32_t capacity);
+    ~pml1_pool() noexcept;
+
+    // Returns index of a free table. Throws if the pool is exhausted.
+    uint32_t acquire(pml2_entry* owner, bool mixed_memory_type);
+
+    // Returns invalid_index if the table at this physical address doesn't belong to the pool.
+    uint32_t index_of(uint64_t table_physical_address) const noexcept;
+
+    pml1_entry* entries(uint32_t index) const noexcept;
+    uint64_t physical_address(uint32_t index) const noexcept;
+    const table_metadata& metadata(uint32_t index) const noexcept;
+
+    void retire(uint32_t index) noexcept;
+
+    // Detaches all retired tables and returns head of their chain. The chain is handed back with
+    // release() after INVEPT on every processor or with retire_chain() if invalidation failed.
+    uint32_t detach_retired() noexcept;
+    void release(uint32_t chain) noexcept;
+    void retire_chain(uint32_t chain) noexcept;
+
+    bool exhausted() const noexcept;
+    bool has_retired() const noexcept;
+    uint32_t in_use_count() const noexcept;
+    uint32_t capacity() const noexcept;
+  };
+}
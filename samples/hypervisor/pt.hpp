@@ -670,17 +670,22 @@ namespace hh::pt
 
   /* During the boot process os loader changes virtual address mappings. We can't change our addresses to new mappings because of vm exits,
     so we just create our own tables with identical mapping ( virtual address = physical address ). */
-  constexpr uint32_t pt_pml4_count = 2;
+  constexpr uint32_t pt_pml4_count = 512;
   constexpr uint32_t pt_pml3_large_count = 512;
   constexpr uint32_t pt_pml3_count = 1;
   constexpr uint32_t pt_pml2_count = 32;
   constexpr uint32_t pt_pml1_count = 512;
 
+  // 512GB of host identical mapping, only regions from the firmware memory map are present.
+  struct host_identity_table
+  {
+    DECLSPEC_ALIGN(common::page_size) pdpte_1gb_64 pml3_large[pt_pml3_large_count];
+  };
+
   struct host_mapping_table
   {
-    // host indentical mapping
+    // host indentical mapping is described by host_identity_table for each 512GB region with physical memory
     DECLSPEC_ALIGN(common::page_size) pml4e_64 pml4[pt_pml4_count];
-    DECLSPEC_ALIGN(common::page_size) pdpte_1gb_64 pml3_large[pt_pml3_large_count];
 
     // tables for mapping guest addresses
     DECLSPEC_ALIGN(common::page_size) pdpte_64 pml3[pt_pml3_count];
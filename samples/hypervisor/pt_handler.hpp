@@ -1,47 +1,29 @@
 #pragma once
-#include <list>
 #include "pt.hpp"
 #include <memory>
 #include <vector>
 #include "x86.hpp"
+#include "host_mapping_cache.hpp"
+#include "memory_map.hpp"
 
 namespace hh::pt
 {
   // Class handles root mode PT table related operations.
   class pt_handler : non_relocatable
   {
-  public:
-
-    // Auxiliary class for reading of guest VA.
-    class memory_descriptor : non_copyable
-    {
-      friend class pt_handler;
-
-    private:
-      std::list<std::pair<void*, pt::pte_64*>> memory_region_;
-      decltype(memory_region_.begin()) prev_it_;
-      uint32_t prev_index_ = -1;
-      uint32_t initial_page_offset_ = {};
-
-    public:
-      memory_descriptor() = default;
-      memory_descriptor(memory_descriptor&&) = default;
-      memory_descriptor& operator=(memory_descriptor&&) = default;
-
-      uint8_t& operator[](uint64_t offset) noexcept;
-      void memcpy(void* destination, uint64_t offset, size_t count) noexcept;
-      void memset(uint64_t offset, uint8_t value, size_t count) noexcept;
-      ~memory_descriptor();
-    };
-
-    friend class memory_descriptor;
-
   private:
-    static constexpr uint64_t pml4_index_for_host_guest_mappings = 1;
+    // Guest mappings are placed right above the identity mapping and must stay in the lower canonical half.
+    static constexpr uint64_t max_pml4_index_for_host_guest_mappings = pt_pml4_count / 2 - 1;
+    static constexpr uint32_t total_windows_count = pt_pml3_count * pt_pml2_count * pt_pml1_count;
 
-  private:
     host_mapping_table* host_pt_table_;
-    std::list<pte_64*> free_entries_;
+    std::vector<std::unique_ptr<host_identity_table>> identity_tables_;
+    uint64_t pml4_index_for_host_guest_mappings_;
+
+    // Every logical processor owns a private slice of mapping PTEs, so mapping needs no lock
+    // and INVLPG on the owner is enough.
+    std::unique_ptr<host_mapping_cache[]> mapping_caches_;
+    uint32_t windows_per_cpu_;
 
   private:
     void* get_va_for_pt(pte_64* entry) const noexcept;
@@ -50,8 +32,13 @@ namespace hh::pt
     pt_handler();
     ~pt_handler() noexcept;
 
-    void initialize_pt();
+    void initialize_pt(const std::vector<memory_map::physical_range>& physical_ranges);
+    bool is_identity_mapped(uint64_t physical_address) const noexcept;
     x86::cr3_t get_cr3() const noexcept;
-    std::shared_ptr<memory_descriptor> map_guest_address(x86::cr3_t guest_cr3, uint8_t* virtual_address, size_t region_size);
+
+    // Long lived mapping of guest physical frame in the cache of current processor.
+    // Every pin must be paired with unpin on the same processor.
+    void* pin_guest_frame(uint64_t page_frame_number);
+    void unpin_guest_frame(const void* host_address) noexcept;
   };
 }
@@ -0,0 +1,242 @@
+#include "root_task.hpp"
+#include <intrin.h>
+#include "vcpu.hpp"
+#include "per_cpu_data.hpp"
+#include "msr.hpp"
+
+namespace hh
+{
+  namespace
+  {
+    constexpr uint64_t vmx_misc_preemption_timer_rate_mask = 0x1f;
+    constexpr uint32_t max_preemption_timer_value = ~0u;
+  }
+
+  root_task root_task::promise_type::get_return_object() noexcept
+  {
+    return root_task{ handle_type::from_promise(*this) };
+  }
+
+  void root_task::promise_type::unhandled_exception() noexcept
+  {
+    PRINT(("Root task has been terminated by an exception on core #%d\n", per_cpu_data::get_cpu_id()));
+    failed = true;
+  }
+
+  root_task::root_task(handle_type handle) noexcept : handle_{ handle }
+  {}
+
+  root_task::root_task(root_task&& other) noexcept : handle_{ other.release() }
+  {}
+
+  root_task& root_task::operator=(root_task&& other) noexcept
+  {
+    if (this != &other)
+    {
+      if (handle_)
+      {
+        handle_.destroy();
+      }
+
+      handle_ = other.release();
+    }
+
+    return *this;
+  }
+
+  root_task::~root_task()
+  {
+    if (handle_)
+    {
+      handle_.destroy();
+    }
+  }
+
+  root_task::handle_type root_task::release() noexcept
+  {
+    const handle_type handle = handle_;
+    handle_ = nullptr;
+
+    return handle;
+  }
+
+  bool root_task_scheduler::checkpoint::await_ready() const noexcept
+  {
+    return !per_cpu_data::get_vcpu()->root_tasks().budget_exhausted();
+  }
+
+  root_task_scheduler::root_task_scheduler(vcpu& owner) noexcept : owner_{ owner }, slots_{}, active_count_{}, next_slot_{},
+    completed_tags_{}, failed_tags_{}, deadline_{}, preemption_timer_rate_{}, preemption_timer_supported_{},
+    preemption_timer_armed_{}, statistics_{}
+  {
+    // Timer counts down by one every 2^rate TSC ticks.
+    preemption_timer_rate_ = static_cast<uint32_t>(x86::msr::read<x86::msr::vmx_misc>() & vmx_misc_preemption_timer_rate_mask);
+
+    // High dword of the capability MSR holds allowed 1-settings.
+    x86::msr::vmx_pinbased_ctls_t allowed_ctls = {};
+    allowed_ctls.all = x86::msr::read<x86::msr::vmx_pinbased_ctls_t>().all >> 32;
+    preemption_timer_supported_ = allowed_ctls.flags.activate_vmx_preemption_timer;
+  }
+
+  root_task_scheduler::~root_task_scheduler()
+  {
+    for (slot& current_slot : slots_)
+    {
+      if (current_slot.handle)
+      {
+        current_slot.handle.destroy();
+      }
+    }
+  }
+
+  bool root_task_scheduler::spawn(root_task task, root_task_tag tag) noexcept
+  {
+    slot* free_slot = nullptr;
+
+    for (slot& current_slot : slots_)
+    {
+      if (!current_slot.handle)
+      {
+        free_slot = free_slot ? free_slot : &current_slot;
+      }
+      else if (tag != root_task_tag::none && current_slot.tag == tag)
+      {
+        return false;
+      }
+    }
+
+    if (!free_slot || !task.handle_)
+    {
+      return false;
+    }
+
+    free_slot->handle = task.release();
+    free_slot->tag = tag;
+    active_count_++;
+
+    completed_tags_ &= ~tag_bit(tag);
+    failed_tags_ &= ~tag_bit(tag);
+
+    return true;
+  }
+
+  root_task_scheduler::task_state root_task_scheduler::poll(root_task_tag tag) noexcept
+  {
+    for (const slot& current_slot : slots_)
+    {
+      if (current_slot.handle && current_slot.tag == tag)
+      {
+        return task_state::running;
+      }
+    }
+
+    if (failed_tags_ & tag_bit(tag))
+    {
+      failed_tags_ &= ~tag_bit(tag);
+      return task_state::failed;
+    }
+
+    if (completed_tags_ & tag_bit(tag))
+    {
+      completed_tags_ &= ~tag_bit(tag);
+      return task_state::completed;
+    }
+
+    return task_state::none;
+  }
+
+  bool root_task_scheduler::idle() const noexcept
+  {
+    return active_count_ == 0;
+  }
+
+  bool root_task_scheduler::budget_exhausted() const noexcept
+  {
+    return __rdtsc() >= deadline_;
+  }
+
+  const root_task_scheduler::statistics& root_task_scheduler::stats() const noexcept
+  {
+    return statistics_;
+  }
+
+  void root_task_scheduler::retire(slot& finished) noexcept
+  {
+    if (finished.handle.promise().failed)
+    {
+      failed_tags_ |= tag_bit(finished.tag);
+      statistics_.failed++;
+    }
+    else
+    {
+      completed_tags_ |= tag_bit(finished.tag);
+      statistics_.completed++;
+    }
+
+    finished.handle.destroy();
+    finished = {};
+    active_count_--;
+  }
+
+  void root_task_scheduler::run(uint64_t exit_start_tsc) noexcept
+  {
+    if (active_count_ == 0)
+    {
+      arm_preemption_timer(false);
+      return;
+    }
+
+    deadline_ = exit_start_tsc + exit_budget_ticks;
+
+    // The first task is resumed even if the handler has already spent the budget, so tasks always make progress.
+    bool resumed = false;
+
+    for (uint32_t j = 0; j < max_tasks && active_count_ != 0; j++)
+    {
+      slot& current_slot = slots_[next_slot_];
+
+      if (current_slot.handle)
+      {
+        if (resumed && budget_exhausted())
+        {
+          break;
+        }
+
+        current_slot.handle.resume();
+        statistics_.resumes++;
+        resumed = true;
+
+        if (current_slot.handle.done())
+        {
+          retire(current_slot);
+        }
+      }
+
+      next_slot_ = (next_slot_ + 1) % max_tasks;
+    }
+
+    arm_preemption_timer(active_count_ != 0);
+  }
+
+  void root_task_scheduler::arm_preemption_timer(bool arm) noexcept
+  {
+    if (arm == preemption_timer_armed_ || !preemption_timer_supported_)
+    {
+      return;
+    }
+
+    if (arm)
+    {
+      const uint64_t timer_value = guest_slice_ticks >> preemption_timer_rate_;
+
+      // Without saving the timer value on VMEXIT every VMENTRY reloads it from this field.
+      vmx::vmwrite(vmx::vmcs_fields::guest_preemption_timer, timer_value < max_preemption_timer_value ? timer_value : max_preemption_timer_value);
+    }
+
+    x86::msr::vmx_pinbased_ctls_t pinbased_ctls = owner_.pin_based_vm_exec_control();
+    pinbased_ctls.flags.activate_vmx_preemption_timer = arm;
+    owner_.pin_based_vm_exec_control(pinbased_ctls, x86::msr::read<x86::msr::vmx_basic_msr_t>());
+
+    preemption_timer_armed_ = arm;
+  }
+}
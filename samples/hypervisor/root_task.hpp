@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <coroutine>
+#include "delete_constructors.hpp"
+
+namespace hh
+{
+  class vcpu;
+  class root_task_scheduler;
+
+  // Identifies tasks whose result is awaited later, e.g. by a VMCALL that is retried until its task is done.
+  enum class root_task_tag : uint8_t
+  {
+    none,
+    unhook_all_pages,
+    count
+  };
+
+  // Long VMX root mode operation split into slices. It is resumed by root_task_scheduler at the end
+  // of VMEXITs and gives control back to the guest at co_await root_task_scheduler::checkpoint{}
+  // once the budget of the current exit is spent. co_await std::suspend_always{} yields unconditionally.
+  class root_task : non_copyable
+  {
+    friend class root_task_scheduler;
+
+  public:
+    struct promise_type
+    {
+      bool failed = false;
+
+      // Not an aggregate, otherwise the promise would be initialized from coroutine arguments.
+      promise_type() noexcept = default;
+
+      root_task get_return_object() noexcept;
+      std::suspend_always initial_suspend() const noexcept { return {}; }
+      std::suspend_always final_suspend() const noexcept { return {}; }
+      void return_void() const noexcept {}
+      void unhandled_exception() noexcept;
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+  private:
+    handle_type handle_;
+
+  private:
+    explicit root_task(handle_type handle) noexcept;
+    handle_type release() noexcept;
+
+  public:
+    root_task(root_task&& other) noexcept;
+    root_task& operator=(root_task&& other) noexcept;
+    ~root_task();
+  };
+
+  // Per vcpu cooperative scheduler of root tasks. Tasks are resumed round robin after the VMEXIT handler
+  // until the exit budget is spent. While any task is pending the VMX-preemption timer is armed,
+  // so tasks make progress even if the guest doesn't exit on its own.
+  class root_task_scheduler : non_relocatable
+  {
+  public:
+    static constexpr uint32_t max_tasks = 8;
+
+    // Root mode time given to tasks in every VMEXIT, counted from the start of the exit, in TSC ticks.
+    inline static uint64_t exit_budget_ticks = 20000;
+
+    // Guest time between VMX-preemption timer exits while tasks are pending, in TSC ticks.
+    inline static uint64_t guest_slice_ticks = 1000000;
+
+    enum class task_state : uint8_t
+    {
+      none,
+      running,
+      completed,
+      failed
+    };
+
+    // Suspends the task only if the budget of the current VMEXIT is spent.
+    struct checkpoint
+    {
+      bool await_ready() const noexcept;
+      void await_suspend(std::coroutine_handle<>) const noexcept {}
+      void await_resume() const noexcept {}
+    };
+
+    struct statistics
+    {
+      uint64_t resumes;
+      uint64_t completed;
+      uint64_t failed;
+    };
+
+  private:
+    struct slot
+    {
+      root_task::handle_type handle;
+      root_task_tag tag;
+    };
+
+    vcpu& owner_;
+    slot slots_[max_tasks];
+    uint32_t active_count_;
+    uint32_t next_slot_;
+    uint32_t completed_tags_;
+    uint32_t failed_tags_;
+    uint64_t deadline_;
+    uint32_t preemption_timer_rate_;
+    bool preemption_timer_supported_;
+    bool preemption_timer_armed_;
+    statistics statistics_;
+
+  private:
+    static constexpr uint32_t tag_bit(root_task_tag tag) noexcept
+    {
+      return 1u << static_cast<uint32_t>(tag);
+    }
+
+    void retire(slot& finished) noexcept;
+    void arm_preemption_timer(bool arm) noexcept;
+
+  public:
+    explicit root_task_scheduler(vcpu& owner) noexcept;
+    ~root_task_scheduler();
+
+    // Returns false if all slots are busy or a task with the same tag is already running.
+    bool spawn(root_task task, root_task_tag tag = root_task_tag::none) noexcept;
+
+    // Returns state of the task with the given tag. Completed and failed states are reported only once.
+    task_state poll(root_task_tag tag) noexcept;
+
+    bool idle() const noexcept;
+    bool budget_exhausted() const noexcept;
+    const statistics& stats() const noexcept;
+
+    // Called at the end of every VMEXIT handled by handlers_dispatcher.
+    void run(uint64_t exit_start_tsc) noexcept;
+  };
+}
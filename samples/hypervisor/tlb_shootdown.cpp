@@ -0,0 +1,202 @@
+#include "tlb_shootdown.hpp"
+#include <intrin.h>
+#include <exception>
+#include "globals.hpp"
+#include "common.hpp"
+#include "msr.hpp"
+#include "invept.hpp"
+#include "per_cpu_data.hpp"
+#include "vcpu.hpp"
+
+namespace hh
+{
+  namespace
+  {
+    constexpr uint64_t apic_base_x2apic_enable = 1ull << 10;
+    constexpr uint64_t apic_base_address_mask = 0xFFFFFF000ull;
+    constexpr uint32_t apic_icr_low_offset = 0x300;
+    constexpr uint32_t apic_icr_high_offset = 0x310;
+    constexpr uint32_t apic_icr_delivery_pending = 1 << 12;
+
+    // Delivery mode NMI, level assert, destination shorthand "all excluding self".
+    constexpr uint32_t nmi_all_excluding_self = (0b100 << 8) | (1 << 14) | (0b11 << 18);
+  }
+
+  tlb_shootdown::tlb_shootdown(uint64_t processors_count) : processors_{}, processors_count_{ processors_count }, initiator_lock_{}
+  {
+    processors_ = new processor_state[processors_count_]{};
+  }
+
+  tlb_shootdown::~tlb_shootdown() noexcept
+  {
+    delete[] processors_;
+  }
+
+  void tlb_shootdown::invalidate(uint64_t request) noexcept
+  {
+    // Hooks modify only EPT entries, so single context INVEPT is the narrowest correct scope.
+    // It also drops combined mappings for every VPID, so INVVPID isn't needed.
+    if (request == all_contexts)
+    {
+      vmx::invept_all_contexts();
+    }
+    else
+    {
+      vmx::invept_single_context(request);
+    }
+  }
+
+  void tlb_shootdown::send_nmi_to_all_excluding_self() noexcept
+  {
+    const uint64_t apic_base = x86::msr::read<x86::msr::apic_base>();
+
+    if (apic_base & apic_base_x2apic_enable)
+    {
+      __writemsr(x86::msr::x2apic::msr_id + x86::msr::x2apic::to_x2(apic_icr_low_offset), nmi_all_excluding_self);
+      return;
+    }
+
+    // Local APIC page is covered by host identity mapping.
+    auto apic = reinterpret_cast<volatile uint32_t*>(apic_base & apic_base_address_mask);
+
+    while (apic[apic_icr_low_offset / sizeof(uint32_t)] & apic_icr_delivery_pending)
+    {
+      _mm_pause();
+    }
+
+    apic[apic_icr_high_offset / sizeof(uint32_t)] = 0;
+    apic[apic_icr_low_offset / sizeof(uint32_t)] = nmi_all_excluding_self;
+  }
+
+  void tlb_shootdown::post(processor_state& state, uint64_t request) noexcept
+  {
+    uint64_t pending = state.request.load(std::memory_order_relaxed);
+    uint64_t merged;
+
+    // Two different requests that weren't executed yet are merged into all contexts one.
+    do
+    {
+      merged = (pending == 0 || pending == request) ? request : all_contexts;
+    } while (!state.request.compare_exchange_weak(pending, merged, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  void tlb_shootdown::lock() noexcept
+  {
+    // Another initiator may wait for us while we wait for the lock.
+    while (initiator_lock_ || _interlockedbittestandset(&initiator_lock_, 0))
+    {
+      poll();
+      _mm_pause();
+    }
+  }
+
+  void tlb_shootdown::unlock() noexcept
+  {
+    _InterlockedExchange(&initiator_lock_, 0);
+  }
+
+  uint64_t tlb_shootdown::invalidate_ept(uint64_t ept_pointer)
+  {
+    const uint64_t request = ept_pointer != 0 ? ept_pointer : all_contexts;
+    const uint64_t current_cpu = per_cpu_data::get_cpu_id();
+
+    lock();
+
+    const uint64_t start_tsc = __rdtsc();
+
+    for (uint64_t j = 0; j < processors_count_; j++)
+    {
+      if (j != current_cpu)
+      {
+        processors_[j].posted_sequence.fetch_add(1, std::memory_order_relaxed);
+        post(processors_[j], request);
+      }
+    }
+
+    send_nmi_to_all_excluding_self();
+    invalidate(request);
+
+    // Processor acknowledges by clearing its request after invalidation.
+    bool timed_out = false;
+
+    for (uint64_t j = 0; j < processors_count_; j++)
+    {
+      while (processors_[j].request.load(std::memory_order_acquire) != 0)
+      {
+        poll();
+        _mm_pause();
+
+        if (__rdtsc() - start_tsc > ack_timeout_ticks_)
+        {
+          timed_out = true;
+          break;
+        }
+      }
+
+      if (timed_out)
+      {
+        break;
+      }
+    }
+
+    const uint64_t elapsed_ticks = __rdtsc() - start_tsc;
+
+    // Next initiator would wait for stale requests again. Their NMIs are still claimed if they arrive later.
+    if (timed_out)
+    {
+      for (uint64_t j = 0; j < processors_count_; j++)
+      {
+        processors_[j].request.store(0, std::memory_order_release);
+      }
+    }
+
+    unlock();
+
+    per_cpu_data::get_vcpu()->exit_latency().record_shootdown(elapsed_ticks);
+
+    if (timed_out)
+    {
+      throw std::exception{ __FUNCTION__": ""Not all processors have acknowledged TLB shootdown." };
+    }
+
+    return elapsed_ticks;
+  }
+
+  void tlb_shootdown::poll() noexcept
+  {
+    processor_state& state = processors_[per_cpu_data::get_cpu_id()];
+    uint64_t request = state.request.load(std::memory_order_acquire);
+
+    while (request != 0)
+    {
+      invalidate(request);
+
+      // Request could have been widened while we were invalidating, then run it once more.
+      if (state.request.compare_exchange_strong(request, 0, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        break;
+      }
+    }
+  }
+
+  bool tlb_shootdown::handle_nmi() noexcept
+  {
+    processor_state& state = processors_[per_cpu_data::get_cpu_id()];
+
+    // Loaded before poll, a request posted later comes with its own NMI.
+    const uint64_t posted_sequence = state.posted_sequence.load(std::memory_order_acquire);
+
+    poll();
+
+    // Request may be already executed by poll on VMEXIT, but NMI is still ours.
+    // If hardware merged our NMI with external one, the external one is lost.
+    if (posted_sequence == state.claimed_sequence)
+    {
+      return false;
+    }
+
+    state.claimed_sequence = posted_sequence;
+
+    return true;
+  }
+}
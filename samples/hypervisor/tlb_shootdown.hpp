@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "delete_constructors.hpp"
+
+namespace hh
+{
+  // Cross processor invalidation of EPT derived TLB entries. Initiator posts a request for every
+  // processor, kicks them out of the guest with NMI IPI and waits until all of them have invalidated.
+  // NMIs sent by shootdown are swallowed, all other NMIs are still re-injected to the guest.
+  class tlb_shootdown : non_relocatable
+  {
+  public:
+    static constexpr size_t cache_line_size = 64;
+
+    // Request value for INVEPT all contexts. Zero means no pending request.
+    static constexpr uint64_t all_contexts = ~0ull;
+
+  private:
+    // About 100ms on modern CPUs.
+    static constexpr uint64_t ack_timeout_ticks_ = 1ull << 28;
+
+    // Initiator bumps posted_sequence before every NMI it sends to the processor. The processor claims
+    // an NMI only if the sequence has moved since its last claimed one, the rest are re-injected.
+    struct alignas(cache_line_size) processor_state
+    {
+      std::atomic<uint64_t> request;
+      std::atomic<uint64_t> posted_sequence;
+      uint64_t claimed_sequence; // owning processor only
+    };
+
+    processor_state* processors_;
+    uint64_t processors_count_;
+    volatile long initiator_lock_;
+
+  private:
+    static void invalidate(uint64_t request) noexcept;
+    static void send_nmi_to_all_excluding_self() noexcept;
+    void post(processor_state& state, uint64_t request) noexcept;
+    void lock() noexcept;
+    void unlock() noexcept;
+
+  public:
+    explicit tlb_shootdown(uint64_t processors_count);
+    ~tlb_shootdown() noexcept;
+
+    // Invalidates mappings derived from the given EPT pointer on every processor (all contexts if it is zero)
+    // and returns when every processor has acknowledged. Returns elapsed TSC ticks.
+    // Throws on timeout, requests of processors that didn't respond are withdrawn.
+    uint64_t invalidate_ept(uint64_t ept_pointer);
+
+    // Executes pending request of the current processor, if any. Called on every VMEXIT
+    // except the ones completed by the fast path, those leave requests to the NMI.
+    void poll() noexcept;
+
+    // Must be called on every NMI. Returns true if NMI was sent by shootdown and must not reach the guest.
+    bool handle_nmi() noexcept;
+  };
+}
@@ -0,0 +1,148 @@
+#include "translation_cache.hpp"
+#include <exception>
+#include "common.hpp"
+#include "vcpu.hpp"
+
+namespace hh::pt
+{
+  namespace
+  {
+    // Kernel code and data are usually mapped with large pages, so they are checked first.
+    constexpr uint64_t page_sizes[] = { common::size_1gb, common::size_2mb, common::page_size };
+  }
+
+  translation_cache::translation_cache(const vcpu& owner) noexcept : owner_{ owner }, entries_4kb_{}, entries_2mb_{}, entries_1gb_{},
+    hits_{}, misses_{}, stale_entries_{}, invalidations_{}
+  {}
+
+  void translation_cache::increment(std::atomic<uint64_t>& counter) noexcept
+  {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  uint64_t translation_cache::cr3_tag(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4) noexcept
+  {
+    // Bit 63 only tells MOV to CR3 to keep translations, it isn't part of address space identity.
+    // It is reused to keep 4-level and 5-level translations apart.
+    guest_cr3.flags.pcid_invalidate = guest_cr4.flags.linear_addresses_57_bit;
+    return guest_cr3.all;
+  }
+
+  bool translation_cache::is_path_unchanged(const common::guest_walk_path& path) noexcept
+  {
+    for (uint32_t level = 0; level < path.count; level++)
+    {
+      if (*path.entries[level] != path.values[level])
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  translation_cache::entry& translation_cache::slot(uint64_t guest_virtual_address, uint64_t page_size) noexcept
+  {
+    switch (page_size)
+    {
+    case common::size_1gb:
+      return entries_1gb_[(guest_virtual_address >> common::page_shift_1gb) % entries_1gb_count_];
+
+    case common::size_2mb:
+      return entries_2mb_[(guest_virtual_address >> common::page_shift_2mb) % entries_2mb_count_];
+
+    default:
+      return entries_4kb_[(guest_virtual_address >> common::page_shift) % entries_4kb_count_];
+    }
+  }
+
+  translation_cache::entry* translation_cache::lookup(uint64_t tag, uint64_t guest_virtual_address, uint64_t& page_size) noexcept
+  {
+    for (const uint64_t size : page_sizes)
+    {
+      entry& current = slot(guest_virtual_address, size);
+
+      if (current.path.count == 0 || current.cr3 != tag || current.virtual_base != (guest_virtual_address & ~(size - 1)))
+      {
+        continue;
+      }
+
+      // Guest changed its page tables without telling us.
+      if (!is_path_unchanged(current.path))
+      {
+        increment(stale_entries_);
+        current.path.count = 0;
+
+        return nullptr;
+      }
+
+      page_size = size;
+      return &current;
+    }
+
+    return nullptr;
+  }
+
+  uint64_t translation_cache::translate(x86::cr3_t guest_cr3, uint64_t guest_virtual_address, uint64_t& page_size)
+  {
+    const x86::cr4_t guest_cr4 = owner_.guest_cr4();
+    const uint64_t tag = cr3_tag(guest_cr3, guest_cr4);
+
+    if (const entry* cached = lookup(tag, guest_virtual_address, page_size))
+    {
+      increment(hits_);
+      return cached->physical_base + (guest_virtual_address & (page_size - 1));
+    }
+
+    increment(misses_);
+
+    common::guest_walk_path path;
+    const uint64_t physical_address = common::walk_guest_page_tables(guest_cr3, guest_cr4, guest_virtual_address, page_size, path);
+
+    entry& new_entry = slot(guest_virtual_address, page_size);
+    new_entry.cr3 = tag;
+    new_entry.virtual_base = guest_virtual_address & ~(page_size - 1);
+    new_entry.physical_base = physical_address & ~(page_size - 1);
+    new_entry.path = path;
+
+    return physical_address;
+  }
+
+  uint64_t translation_cache::translate(x86::cr3_t guest_cr3, uint64_t guest_virtual_address)
+  {
+    uint64_t page_size;
+    return translate(guest_cr3, guest_virtual_address, page_size);
+  }
+
+  void translation_cache::invalidate_all() noexcept
+  {
+    for (auto& current : entries_4kb_) current.path.count = 0;
+    for (auto& current : entries_2mb_) current.path.count = 0;
+    for (auto& current : entries_1gb_) current.path.count = 0;
+
+    increment(invalidations_);
+  }
+
+  void translation_cache::invalidate_page(uint64_t guest_virtual_address) noexcept
+  {
+    for (const uint64_t size : page_sizes)
+    {
+      entry& current = slot(guest_virtual_address, size);
+
+      if (current.virtual_base == (guest_virtual_address & ~(size - 1)))
+      {
+        current.path.count = 0;
+      }
+    }
+
+    increment(invalidations_);
+  }
+
+  void translation_cache::snapshot(statistics::translation_cache_statistics& out) const noexcept
+  {
+    out.hits = hits_.load(std::memory_order_relaxed);
+    out.misses = misses_.load(std::memory_order_relaxed);
+    out.stale_entries = stale_entries_.load(std::memory_order_relaxed);
+    out.invalidations = invalidations_.load(std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "delete_constructors.hpp"
+#include "x86.hpp"
+#include "exit_statistics.hpp"
+#include "common.hpp"
+
+namespace hh
+{
+  class vcpu;
+}
+
+namespace hh::pt
+{
+  // Per vcpu software TLB for guest virtual to guest physical translations.
+  // Entries are tagged with guest CR3 (including PCID) and paging mode and kept separately for 4kb, 2mb and 1gb pages.
+  // MOV to CR3, INVLPG and INVPCID normally don't cause VMEXITs, so every hit is validated against all guest
+  // paging entries it was built from. A changed upper level entry, e.g. pointed to another table or turned to
+  // a large page, is detected as well as a changed leaf. Walk is deterministic, so equal entries mean equal result.
+  class translation_cache : non_relocatable
+  {
+  private:
+    static constexpr uint32_t entries_4kb_count_ = 64;
+    static constexpr uint32_t entries_2mb_count_ = 16;
+    static constexpr uint32_t entries_1gb_count_ = 4;
+
+    struct entry
+    {
+      uint64_t cr3;
+      uint64_t virtual_base;
+      uint64_t physical_base;
+      common::guest_walk_path path;
+    };
+
+    // Guest paging mode is taken from CR4 of the owner.
+    const vcpu& owner_;
+
+    entry entries_4kb_[entries_4kb_count_];
+    entry entries_2mb_[entries_2mb_count_];
+    entry entries_1gb_[entries_1gb_count_];
+
+    // Single writer counters, see exit_latency_recorder.
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<uint64_t> stale_entries_;
+    std::atomic<uint64_t> invalidations_;
+
+  private:
+    static void increment(std::atomic<uint64_t>& counter) noexcept;
+    static uint64_t cr3_tag(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4) noexcept;
+    static bool is_path_unchanged(const common::guest_walk_path& path) noexcept;
+
+    entry* lookup(uint64_t tag, uint64_t guest_virtual_address, uint64_t& page_size) noexcept;
+    entry& slot(uint64_t guest_virtual_address, uint64_t page_size) noexcept;
+
+  public:
+    explicit translation_cache(const vcpu& owner) noexcept;
+
+    // Returns guest physical address and size of the guest page that maps it.
+    // Throws if the address isn't mapped by guest.
+    uint64_t translate(x86::cr3_t guest_cr3, uint64_t guest_virtual_address, uint64_t& page_size);
+    uint64_t translate(x86::cr3_t guest_cr3, uint64_t guest_virtual_address);
+
+    // MOV to CR3 without PCID preservation.
+    void invalidate_all() noexcept;
+
+    // INVLPG and individual address INVPCID.
+    void invalidate_page(uint64_t guest_virtual_address) noexcept;
+
+    void snapshot(statistics::translation_cache_statistics& out) const noexcept;
+  };
+}
@@ -11,9 +11,9 @@
 namespace hh
 {
   vcpu::vcpu(std::shared_ptr<hv_event_handlers::vmexit_handler> exit_handler) : guest_state_{},
-    vmexit_handler_{ std::move(exit_handler) }
+    vmexit_handler_{ std::move(exit_handler) }, extended_state_{}, vmcs_cache_{},
+    exit_latency_{ std::make_unique<exit_latency_recorder>() }, translations_{ *this }, root_tasks_{ *this }
   {
-    fxsave_area_ = new(std::align_val_t{ 16 }) common::fxsave_area;
   }
 
   void vcpu::allocate_vmx_regions()
@@ -126,6 +126,8 @@ namespace hh
     x86::msr::vmx_procbased_ctls_t procbased_ctls = {};
     procbased_ctls.flags.activate_secondary_controls = 1;
     procbased_ctls.flags.use_msr_bitmaps = 1;
+
+    // Without true controls the CPU may force CR3 access exiting, then handle_cr_access emulates MOV to CR3.
     cpu_based_vm_exec_control(procbased_ctls, basic_msr);
 
     x86::msr::vmx_procbased_ctls2_t procbased_ctls2 = {};
@@ -157,6 +159,8 @@ namespace hh
     // If bit is setted in host_guest mask then when guest tries to read it
     // he gets a bit from cr shadow mask.
     // But if guest tries to set it then vm exit occurs.
+    // Masks contain only bits we have to own, so context switches (CR4.PGE toggling
+    // for TLB flush included) never exit.
     x86::cr4_t cr4_host_guest_mask = {};
     cr4_host_guest_mask.flags.vmx_enable = 1;
 
@@ -199,11 +203,8 @@ namespace hh
     host_efer(x86::msr::read<x86::msr::efer_t>());
     guest_efer(x86::msr::read<x86::msr::efer_t>());
 
-    // Intercept divide_error exception to map our win driver
-    // or skip patchguard initialization.
-    vmx::exception_bitmap exc_bitmap = {};
-    exc_bitmap.divide_error = 1;
-    exception_bitmap(exc_bitmap);
+    // Only exceptions with armed interceptions, e.g. #DE to map our win driver.
+    exception_bitmap(vmexit_handler_->exception_interceptions().initial_bitmap());
 
     ept_pointer(globals::ept_handler->get_eptp().flags);
 
@@ -363,7 +364,6 @@ namespace hh
     delete[] guest_state_.vmxon_region_virtual_address;
     delete[] guest_state_.msr_bitmap_virtual_address;
     delete[] guest_state_.vmm_stack;
-    delete fxsave_area_;
   }
 
   uint64_t vcpu::vmxoff_state_guest_rip() const noexcept
@@ -398,10 +398,7 @@ namespace hh
 
   vmx::exit_reason vcpu::vmexit_reason() const noexcept
   {
-    vmx::exit_reason vmexit_reason;
-    vmx::vmread(vmx::vmcs_fields::vm_exit_reason, vmexit_reason);
-
-    return vmexit_reason;
+    return vmcs_cache_.read<vmx::exit_reason>(vmx::cached_field::exit_reason);
   }
 
   std::shared_ptr<hv_event_handlers::vmexit_handler> vcpu::vmexit_handler() const noexcept
@@ -670,41 +667,32 @@ namespace hh
 
   x86::cr0_t vcpu::guest_cr0() const noexcept
   {
-    x86::cr0_t cr0;
-    vmx::vmread(vmx::vmcs_fields::guest_cr0, cr0);
-
-    return cr0;
+    return vmcs_cache_.read<x86::cr0_t>(vmx::cached_field::guest_cr0);
   }
 
   void vcpu::guest_cr0(x86::cr0_t cr0) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_cr0, cr0);
+    vmcs_cache_.write(vmx::cached_field::guest_cr0, cr0);
   }
 
   x86::cr3_t vcpu::guest_cr3() const noexcept
   {
-    x86::cr3_t cr3;
-    vmx::vmread(vmx::vmcs_fields::guest_cr3, cr3);
-
-    return cr3;
+    return vmcs_cache_.read<x86::cr3_t>(vmx::cached_field::guest_cr3);
   }
 
   void vcpu::guest_cr3(x86::cr3_t cr3) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_cr3, cr3);
+    vmcs_cache_.write(vmx::cached_field::guest_cr3, cr3);
   }
 
   x86::cr4_t vcpu::guest_cr4() const noexcept
   {
-    x86::cr4_t cr4;
-    vmx::vmread(vmx::vmcs_fields::guest_cr4, cr4);
-
-    return cr4;
+    return vmcs_cache_.read<x86::cr4_t>(vmx::cached_field::guest_cr4);
   }
 
   void vcpu::guest_cr4(x86::cr4_t cr4) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_cr4, cr4);
+    vmcs_cache_.write(vmx::cached_field::guest_cr4, cr4);
   }
 
   x86::dr7_t vcpu::guest_dr7() const noexcept
@@ -734,41 +722,32 @@ namespace hh
 
   uint64_t vcpu::guest_rsp() const noexcept
   {
-    uint64_t rsp;
-    vmx::vmread(vmx::vmcs_fields::guest_rsp, rsp);
-
-    return rsp;
+    return vmcs_cache_.read<uint64_t>(vmx::cached_field::guest_rsp);
   }
 
   void vcpu::guest_rsp(uint64_t rsp) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_rsp, rsp);
+    vmcs_cache_.write(vmx::cached_field::guest_rsp, rsp);
   }
 
   uint64_t vcpu::guest_rip() const noexcept
   {
-    uint64_t rip;
-    vmx::vmread(vmx::vmcs_fields::guest_rip, rip);
-
-    return rip;
+    return vmcs_cache_.read<uint64_t>(vmx::cached_field::guest_rip);
   }
 
   void vcpu::guest_rip(uint64_t rip) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_rip, rip);
+    vmcs_cache_.write(vmx::cached_field::guest_rip, rip);
   }
 
   x86::rflags_t vcpu::guest_rflags() const noexcept
   {
-    x86::rflags_t rflags;
-    vmx::vmread(vmx::vmcs_fields::guest_rflags, rflags);
-
-    return rflags;
+    return vmcs_cache_.read<x86::rflags_t>(vmx::cached_field::guest_rflags);
   }
 
   void vcpu::guest_rflags(x86::rflags_t rflags) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::guest_rflags, rflags);
+    vmcs_cache_.write(vmx::cached_field::guest_rflags, rflags);
   }
 
   x86::gdtr_t vcpu::guest_gdtr() const noexcept
@@ -882,7 +861,7 @@ namespace hh
 
   void vcpu::pin_based_vm_exec_control(x86::msr::vmx_pinbased_ctls_t pinbased_ctls, x86::msr::vmx_basic_msr_t basic_msr) noexcept
   {
-    vmx::vmwrite(vmx::vmcs_fields::pin_based_vm_exec_control, vmx::adjust_controls(0,
+    vmx::vmwrite(vmx::vmcs_fields::pin_based_vm_exec_control, vmx::adjust_controls(pinbased_ctls.all,
       basic_msr.fields.vmx_capability_hint ? x86::msr::vmx_true_pinbased_ctls::msr_id : x86::msr::vmx_pinbased_ctls_t::msr_id));
   }
 
@@ -1288,21 +1267,15 @@ namespace hh
 
   vmx::exit_qualification_t vcpu::exit_qualification() const noexcept
   {
-    vmx::exit_qualification_t exit_qualification = {};
-    vmx::vmread(vmx::vmcs_fields::exit_qualification, exit_qualification);
-
-    return exit_qualification;
+    return vmcs_cache_.read<vmx::exit_qualification_t>(vmx::cached_field::exit_qualification);
   }
 
   uint32_t vcpu::exit_instruction_length() const noexcept
   {
-    uint32_t result;
-    vmx::vmread(vmx::vmcs_fields::vm_exit_instruction_len, result);
-
-    return result;
+    return vmcs_cache_.read<uint32_t>(vmx::cached_field::exit_instruction_length);
   }
 
-  hook::hook_info** vcpu::mtf_restore_point() noexcept
+  uint64_t* vcpu::mtf_restore_point() noexcept
   {
     return &guest_state_.mtf_ept_hook_restore_point;
   }
@@ -1404,23 +1377,47 @@ namespace hh
 
   uint64_t vcpu::exit_guest_physical_address() const noexcept
   {
-    uint64_t address;
-    vmx::vmread(vmx::vmcs_fields::guest_physical_address, address);
-
-    return address;
+    return vmcs_cache_.read<uint64_t>(vmx::cached_field::exit_guest_physical_address);
   }
 
   uint64_t vcpu::exit_guest_linear_address() const noexcept
   {
-    uint64_t address;
-    vmx::vmread(vmx::vmcs_fields::guest_linear_address, address);
+    return vmcs_cache_.read<uint64_t>(vmx::cached_field::exit_guest_linear_address);
+  }
 
-    return address;
+  hh::extended_state& vcpu::guest_extended_state() noexcept
+  {
+    return extended_state_;
+  }
+
+  vmx::vmcs_cache& vcpu::exit_state_cache() noexcept
+  {
+    return vmcs_cache_;
+  }
+
+  exit_latency_recorder& vcpu::exit_latency() noexcept
+  {
+    return *exit_latency_;
+  }
+
+  const exit_latency_recorder& vcpu::exit_latency() const noexcept
+  {
+    return *exit_latency_;
+  }
+
+  pt::translation_cache& vcpu::translations() noexcept
+  {
+    return translations_;
+  }
+
+  const pt::translation_cache& vcpu::translations() const noexcept
+  {
+    return translations_;
   }
 
-  common::fxsave_area* vcpu::fxsave_area() noexcept
+  root_task_scheduler& vcpu::root_tasks() noexcept
   {
-    return fxsave_area_;
+    return root_tasks_;
   }
 
   interrupt vcpu::get_exit_interrupt()
@@ -1431,17 +1428,11 @@ namespace hh
 
   exception_error_code vcpu::exit_interruption_error_code() const noexcept
   {
-    exception_error_code result;
-    vmx::vmread(vmx::vmcs_fields::vm_exit_intr_error_code, result);
-
-    return result;
+    return vmcs_cache_.read<exception_error_code>(vmx::cached_field::exit_interruption_error_code);
   }
 
   vmx::interrupt_info vcpu::exit_interruption_info() const noexcept
   {
-    vmx::interrupt_info result;
-    vmx::vmread(vmx::vmcs_fields::vm_exit_intr_info, result);
-
-    return result;
+    return vmcs_cache_.read<vmx::interrupt_info>(vmx::cached_field::exit_interruption_info);
   }
 }
@@ -10,6 +10,11 @@
 #include "common.hpp"
 #include "exception.hpp"
 #include "interrupt.hpp"
+#include "extended_state.hpp"
+#include "vmcs_cache.hpp"
+#include "exit_latency_recorder.hpp"
+#include "translation_cache.hpp"
+#include "root_task.hpp"
 
 namespace hh
 {
@@ -28,7 +33,13 @@ namespace hh
   private:
     vmx::virtual_machihe_state_t guest_state_;
     std::shared_ptr<hv_event_handlers::vmexit_handler> vmexit_handler_;
-    common::fxsave_area* fxsave_area_;
+    hh::extended_state extended_state_;
+    mutable vmx::vmcs_cache vmcs_cache_;
+
+    // vcpu objects are not cache line aligned, so histograms are allocated separately.
+    std::unique_ptr<exit_latency_recorder> exit_latency_;
+    pt::translation_cache translations_;
+    root_task_scheduler root_tasks_;
 
   public:
     void page_fault_error_code_mask(ept::pagefault_error_code mask) noexcept;
@@ -85,7 +96,13 @@ namespace hh
     uint64_t exit_guest_physical_address() const noexcept;
     uint64_t exit_guest_linear_address() const noexcept;
 
-    common::fxsave_area* fxsave_area() noexcept;
+    hh::extended_state& guest_extended_state() noexcept;
+    vmx::vmcs_cache& exit_state_cache() noexcept;
+    exit_latency_recorder& exit_latency() noexcept;
+    const exit_latency_recorder& exit_latency() const noexcept;
+    pt::translation_cache& translations() noexcept;
+    const pt::translation_cache& translations() const noexcept;
+    root_task_scheduler& root_tasks() noexcept;
     interrupt get_exit_interrupt();
     exception_error_code exit_interruption_error_code() const noexcept;
     vmx::interrupt_info exit_interruption_info() const noexcept;
@@ -224,7 +241,7 @@ namespace hh
 
     std::shared_ptr<hv_event_handlers::vmexit_handler> vmexit_handler() const noexcept;
     void vmexit_handler(std::shared_ptr<hv_event_handlers::vmexit_handler> ptr) noexcept;
-    hook::hook_info** mtf_restore_point() noexcept;
+    uint64_t* mtf_restore_point() noexcept;
 
   private:
 
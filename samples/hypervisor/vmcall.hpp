@@ -21,6 +21,9 @@ namespace hh
       get_physical_address_for_virtual,
       notify_all_to_invalidate_ept,
       panic,
+      get_exit_statistics,
+      drain_flight_recorder,
+      set_fast_path_mask,
     };
 
     struct invept_context { uint64_t phys_address; };
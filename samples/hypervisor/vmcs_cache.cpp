@@ -0,0 +1,89 @@
+#include "vmcs_cache.hpp"
+
+namespace hh::vmx
+{
+  vmcs_cache::vmcs_cache() noexcept : values_{}, valid_{}, dirty_{}, statistics_index_{}, active_{}, statistics_{}
+  {}
+
+  exit_reason vmcs_cache::begin_exit() noexcept
+  {
+    valid_ = 0;
+    dirty_ = 0;
+    active_ = true;
+
+    vmread(vmcs_fields::vm_exit_reason, values_[static_cast<size_t>(cached_field::exit_reason)]);
+    valid_ |= field_bit(cached_field::exit_reason);
+
+    const uint16_t basic_reason = static_cast<uint16_t>(values_[static_cast<size_t>(cached_field::exit_reason)]);
+
+    // Unknown reasons are counted in slot 0 but still returned as is, so they reach the unknown exit handler.
+    statistics_index_ = basic_reason < exit_reasons_count ? basic_reason : 0;
+    statistics_[statistics_index_].exits++;
+
+    return static_cast<exit_reason>(basic_reason);
+  }
+
+  void vmcs_cache::flush() noexcept
+  {
+    for (uint32_t dirty = dirty_; dirty != 0; dirty &= dirty - 1)
+    {
+      unsigned long index;
+      _BitScanForward(&index, dirty);
+
+      vmwrite(field_encodings_[index], values_[index]);
+    }
+
+    dirty_ = 0;
+    active_ = false;
+  }
+
+  const vmcs_cache::statistics& vmcs_cache::exit_statistics(exit_reason reason) const noexcept
+  {
+    const auto index = static_cast<size_t>(reason);
+    return statistics_[index < exit_reasons_count ? index : 0];
+  }
+
+  uint64_t vmcs_cache::load(cached_field field) noexcept
+  {
+    const auto index = static_cast<size_t>(field);
+
+    if (!active_)
+    {
+      uint64_t value;
+      vmread(field_encodings_[index], value);
+
+      return value;
+    }
+
+    if (valid_ & field_bit(field))
+    {
+      statistics_[statistics_index_].vmreads_saved++;
+      return values_[index];
+    }
+
+    vmread(field_encodings_[index], values_[index]);
+    valid_ |= field_bit(field);
+
+    return values_[index];
+  }
+
+  void vmcs_cache::store(cached_field field, uint64_t value) noexcept
+  {
+    const auto index = static_cast<size_t>(field);
+
+    if (!active_)
+    {
+      vmwrite(field_encodings_[index], value);
+      return;
+    }
+
+    if (dirty_ & field_bit(field))
+    {
+      statistics_[statistics_index_].vmwrites_saved++;
+    }
+
+    values_[index] = value;
+    valid_ |= field_bit(field);
+    dirty_ |= field_bit(field);
+  }
+}
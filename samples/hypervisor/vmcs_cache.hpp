@@ -0,0 +1,110 @@
+#pragma once
+#include <cstdint>
+#include "delete_constructors.hpp"
+#include "common.hpp"
+#include "vmx.hpp"
+#include "exit_reason.hpp"
+
+namespace hh::vmx
+{
+  // VMCS fields that are touched by almost every VMEXIT handler.
+  enum class cached_field : uint8_t
+  {
+    exit_reason,
+    exit_qualification,
+    exit_instruction_length,
+    exit_interruption_info,
+    exit_interruption_error_code,
+    exit_guest_physical_address,
+    exit_guest_linear_address,
+
+    // Fields below are writable and may be buffered.
+    guest_rip,
+    guest_rsp,
+    guest_rflags,
+    guest_cr0,
+    guest_cr3,
+    guest_cr4,
+
+    count
+  };
+
+  // Per vcpu cache of VMCS fields. It is active only while VMEXIT is handled:
+  // every cached field is read from VMCS at most once per exit and guest state
+  // writes are buffered until flush is called right before VMRESUME.
+  // Outside of VMEXIT handling all accesses go directly to VMCS.
+  class vmcs_cache : non_relocatable
+  {
+  public:
+    static constexpr size_t exit_reasons_count = 66;
+
+    struct statistics
+    {
+      uint64_t exits;
+      uint64_t vmreads_saved;
+      uint64_t vmwrites_saved;
+    };
+
+  private:
+    static constexpr size_t fields_count_ = static_cast<size_t>(cached_field::count);
+
+    static constexpr vmcs_fields field_encodings_[fields_count_] =
+    {
+      vmcs_fields::vm_exit_reason,
+      vmcs_fields::exit_qualification,
+      vmcs_fields::vm_exit_instruction_len,
+      vmcs_fields::vm_exit_intr_info,
+      vmcs_fields::vm_exit_intr_error_code,
+      vmcs_fields::guest_physical_address,
+      vmcs_fields::guest_linear_address,
+      vmcs_fields::guest_rip,
+      vmcs_fields::guest_rsp,
+      vmcs_fields::guest_rflags,
+      vmcs_fields::guest_cr0,
+      vmcs_fields::guest_cr3,
+      vmcs_fields::guest_cr4
+    };
+
+    uint64_t values_[fields_count_];
+    uint32_t valid_;
+    uint32_t dirty_;
+    uint16_t statistics_index_;
+    bool active_;
+    statistics statistics_[exit_reasons_count];
+
+  private:
+    static constexpr uint32_t field_bit(cached_field field) noexcept
+    {
+      return 1u << static_cast<uint32_t>(field);
+    }
+
+    uint64_t load(cached_field field) noexcept;
+    void store(cached_field field, uint64_t value) noexcept;
+
+  public:
+    vmcs_cache() noexcept;
+
+    // Activates the cache and snapshots exit reason. Returns basic exit reason.
+    exit_reason begin_exit() noexcept;
+
+    // Writes all dirty fields back to VMCS and deactivates the cache.
+    void flush() noexcept;
+
+    const statistics& exit_statistics(exit_reason reason) const noexcept;
+
+    template <typename T>
+    T read(cached_field field) noexcept
+    {
+      common::u64_t<T> u = { .as_uint64_t = load(field) };
+      return u.as_value;
+    }
+
+    template <typename T>
+    void write(cached_field field, T value) noexcept
+    {
+      common::u64_t<T> u = {};
+      u.as_value = value;
+      store(field, u.as_uint64_t);
+    }
+  };
+}
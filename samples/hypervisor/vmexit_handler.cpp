@@ -13,20 +13,13 @@
 #include "hook_builder.hpp"
 #include "per_cpu_data.hpp"
 #include "pe.hpp"
+#include "tlb_shootdown.hpp"
+#include "flight_recorder.hpp"
+#include "guest_memory.hpp"
+#include "kernel_locator.hpp"
 
 namespace hh::hv_event_handlers
 {
-  vmexit_handler::fx_state_saver::fx_state_saver(common::fxsave_area* ptr) noexcept : fxsave_area{ ptr }
-  {
-    *fxsave_area = common::fxsave_area{};
-    _fxsave64(fxsave_area);
-  }
-
-  vmexit_handler::fx_state_saver::~fx_state_saver() noexcept
-  {
-    _fxrstor64(fxsave_area);
-  }
-
   bool vmexit_handler::handlers_dispatcher(common::guest_regs* regs) noexcept
   {
     if (globals::panic_status)
@@ -34,36 +27,89 @@ namespace hh::hv_event_handlers
       __halt();
     }
 
+    // Exits completed by the fast path in vmexit_handler_.asm never get here, see record_fast_path_exit.
+    const uint64_t exit_start_tsc = __rdtsc();
     vcpu* current_vcpu = &globals::vcpus[per_cpu_data::get_cpu_id()];
 
-    // We use AVX in some places so we need to save SIMD registers.
-    fx_state_saver saver{ current_vcpu->fxsave_area() };
-    regs->fx_area = current_vcpu->fxsave_area();
+    // Volatile XMM registers are preserved by the entry stub. Everything else is saved only before
+    // root tasks, handlers that execute AVX or x87 code call guest_extended_state().save() first.
+    extended_state& guest_extended_state = current_vcpu->guest_extended_state();
+    regs->extended_state_area = guest_extended_state.area();
     vmexit_handler* this_ptr = current_vcpu->vmexit_handler().get();
-    const uint64_t vmexit_reason = static_cast<uint16_t>(current_vcpu->vmexit_reason());
+    // Exit information fields are read from VMCS only once per exit.
+    // Guest state writes are buffered and flushed right before VMRESUME.
+    const uint64_t vmexit_reason = static_cast<uint16_t>(current_vcpu->exit_state_cache().begin_exit());
 
     current_vcpu->skip_instruction(true);
 
-    if (per_cpu_data::callback_ready_status())
-    {
-      if (const auto [callback, context] = per_cpu_data::pop_root_mode_callback_from_queue();
-        callback != nullptr)
-      {
-        callback(context.get());
-        PRINT(("root mode callback called on core #%d\n", per_cpu_data::get_cpu_id()));
-      }
-    }
+    // Recorded before handling so a crash inside of the handler is visible in the bug check dump.
+    const bool is_ept_exit = vmexit_reason == static_cast<uint16_t>(vmx::exit_reason::ept_violation)
+      || vmexit_reason == static_cast<uint16_t>(vmx::exit_reason::ept_misconfiguration);
 
-    (this_ptr->*(this_ptr->handlers_[vmexit_reason]))(regs, current_vcpu);
+    globals::flight_recorders[per_cpu_data::get_cpu_id()].record(exit_start_tsc, static_cast<uint16_t>(vmexit_reason),
+      current_vcpu->exit_qualification().all, current_vcpu->guest_rip(), is_ept_exit ? current_vcpu->exit_guest_physical_address() : 0);
+
+    // Normally requests are executed from NMI, this catches the ones that arrived while NMIs were blocked.
+    globals::shootdown_handler->poll();
+
+    // Handler may overwrite guest registers, so capture vmcall number beforehand.
+    const uint64_t vmcall_number = regs->rcx & 0xFFFFFFFF;
+
+    this_ptr->dispatch_(this_ptr, vmexit_reason, regs, current_vcpu);
 
     if (current_vcpu->skip_instruction())
     {
       current_vcpu->resume_to_next_instruction();
     }
 
+    root_task_scheduler& root_tasks = current_vcpu->root_tasks();
+
+    if (!root_tasks.idle())
+    {
+      // We don't know what root tasks do.
+      guest_extended_state.save();
+    }
+
+    // Pending root tasks get what is left of this exit's budget.
+    root_tasks.run(exit_start_tsc);
+
+    current_vcpu->exit_state_cache().flush();
+    guest_extended_state.restore();
+
+    const uint64_t exit_ticks = __rdtsc() - exit_start_tsc;
+
+    if (vmexit_reason == static_cast<uint16_t>(vmx::exit_reason::execute_vmcall))
+    {
+      current_vcpu->exit_latency().record(static_cast<uint16_t>(vmexit_reason), vmcall_number, exit_ticks);
+    }
+    else
+    {
+      current_vcpu->exit_latency().record(static_cast<uint16_t>(vmexit_reason), exit_ticks);
+    }
+
     return current_vcpu->vmxoff_executed();
   }
 
+  // Called by the fast path in vmexit_handler_.asm after the exit is completed. Shootdown requests
+  // still arrive with NMI and pending root tasks run on the next exit that takes the regular path.
+  void vmexit_handler::record_fast_path_exit(uint64_t exit_start_tsc, uint64_t exit_reason, uint64_t guest_rip) noexcept
+  {
+    vcpu* current_vcpu = per_cpu_data::get_vcpu();
+
+    globals::flight_recorders[per_cpu_data::get_cpu_id()].record(exit_start_tsc, static_cast<uint16_t>(exit_reason), 0, guest_rip, 0);
+
+    const uint64_t exit_ticks = __rdtsc() - exit_start_tsc;
+
+    if (exit_reason == static_cast<uint16_t>(vmx::exit_reason::execute_vmcall))
+    {
+      current_vcpu->exit_latency().record(static_cast<uint16_t>(exit_reason), static_cast<uint64_t>(vmx::vmcall_number::test), exit_ticks);
+    }
+    else
+    {
+      current_vcpu->exit_latency().record(static_cast<uint16_t>(exit_reason), exit_ticks);
+    }
+  }
+
   uint64_t vmexit_handler::get_instruction_pointer_for_vmxoff() noexcept
   {
     return globals::vcpus[per_cpu_data::get_cpu_id()].vmxoff_state_guest_rip();
@@ -91,148 +137,27 @@ namespace hh::hv_event_handlers
     bug_check(bug_check_codes::vmx_error, error_code);
   }
 
-  vmexit_handler::vmexit_handler()
-    : handlers_
-    {
-    &vmexit_handler::handle_exception_nmi,
-    &vmexit_handler::handle_external_interrupt,
-    &vmexit_handler::handle_triple_fault,
-    &vmexit_handler::handle_init,
-    &vmexit_handler::handle_sipi,
-    &vmexit_handler::handle_io_smi,
-    &vmexit_handler::handle_other_smi,
-    &vmexit_handler::handle_pending_virt_intr,
-    &vmexit_handler::handle_pending_virt_nmi,
-    &vmexit_handler::handle_task_switch,
-    &vmexit_handler::handle_cpuid,
-    &vmexit_handler::handle_getsec,
-    &vmexit_handler::handle_hlt,
-    &vmexit_handler::handle_invd,
-    &vmexit_handler::handle_invlpg,
-    &vmexit_handler::handle_rdpmc,
-    &vmexit_handler::handle_rdtsc,
-    &vmexit_handler::handle_rsm,
-    &vmexit_handler::handle_vmcall,
-    &vmexit_handler::handle_vmclear,
-    &vmexit_handler::handle_vmlaunch,
-    &vmexit_handler::handle_vmptrld,
-    &vmexit_handler::handle_vmptrst,
-    &vmexit_handler::handle_vmread,
-    &vmexit_handler::handle_vmresume,
-    &vmexit_handler::handle_vmwrite,
-    &vmexit_handler::handle_vmxoff,
-    &vmexit_handler::handle_vmxon,
-    &vmexit_handler::handle_cr_access,
-    &vmexit_handler::handle_dr_access,
-    &vmexit_handler::handle_io_instruction,
-    &vmexit_handler::handle_msr_read,
-    &vmexit_handler::handle_msr_write,
-    &vmexit_handler::handle_invalid_guest_state,
-    &vmexit_handler::handle_msr_loading,
-    &vmexit_handler::handler_stub, // reserved_1
-    &vmexit_handler::handle_mwait_instruction,
-    &vmexit_handler::handle_monitor_trap_flag,
-    &vmexit_handler::handler_stub, // reserved_2
-    &vmexit_handler::handle_monitor_instruction,
-    &vmexit_handler::handle_pause_instruction,
-    &vmexit_handler::handle_mce_during_vmentry,
-    &vmexit_handler::handler_stub, // reserved_3
-    &vmexit_handler::handle_tpr_below_threshold,
-    &vmexit_handler::handle_apic_access,
-    &vmexit_handler::handle_virtualized_eoi,
-    &vmexit_handler::handle_access_gdtr_or_idtr,
-    &vmexit_handler::handle_access_ldtr_or_tr,
-    &vmexit_handler::handle_ept_violation,
-    &vmexit_handler::handle_ept_misconfig,
-    &vmexit_handler::handle_invept,
-    &vmexit_handler::handle_rdtscp,
-    &vmexit_handler::handle_vmx_preemption_timer_expired,
-    &vmexit_handler::handle_invvpid,
-    &vmexit_handler::handle_wbinvd,
-    &vmexit_handler::handle_xsetbv,
-    &vmexit_handler::handle_apic_write,
-    &vmexit_handler::handle_rdrand,
-    &vmexit_handler::handle_invpcid,
-    &vmexit_handler::handle_vmfunc,
-    &vmexit_handler::handle_encls,
-    &vmexit_handler::handle_rdseed,
-    &vmexit_handler::handle_page_modification_log_full,
-    &vmexit_handler::handle_xsaves,
-    &vmexit_handler::handle_xrstors
-    }
+  vmexit_handler::vmexit_handler(dispatch_routine routine) noexcept : dispatch_{ routine }, exception_interceptor_{}
   {
   }
 
+  exception_interceptor& vmexit_handler::exception_interceptions() noexcept
+  {
+    return exception_interceptor_;
+  }
+
   void vmexit_handler::handler_stub(common::guest_regs* regs, vcpu* cpu_obj) noexcept
   {
     PRINT(("Unexpected VMEXIT occured. Reason: %a\n", enum_to_str(cpu_obj->vmexit_reason()).data()));
     bug_check(bug_check_codes::vmx_error, static_cast<uint64_t>(cpu_obj->vmexit_reason()));
   }
 
-  void vmexit_handler::handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_external_interrupt(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_init(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_sipi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_io_smi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_other_smi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_pending_virt_intr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_pending_virt_nmi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_task_switch(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_getsec(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_hlt(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invd(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invlpg(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rdpmc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rdtsc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rsm(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmcall(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmclear(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmlaunch(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmptrld(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmptrst(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmread(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmresume(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmwrite(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmxoff(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmxon(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_cr_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_dr_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_io_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_msr_read(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_msr_write(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invalid_guest_state(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_msr_loading(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_mwait_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_monitor_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_pause_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_mce_during_vmentry(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_tpr_below_threshold(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_apic_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_access_gdtr_or_idtr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_access_ldtr_or_tr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_ept_violation(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invept(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rdtscp(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmx_preemption_timer_expired(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invvpid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_wbinvd(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_xsetbv(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_apic_write(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rdrand(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_invpcid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_rdseed(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_pml_full(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_xsaves(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_xrstors(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_pcommit(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_virtualized_eoi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_vmfunc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_encls(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
-  void vmexit_handler::handle_page_modification_log_full(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+  kernel_hook_assistant::kernel_hook_assistant()
+  {
+    // We map our win driver to system process on the first #DE during patchguard initialization.
+    exception_interceptions().intercept(exception_vector::divide_error, &kernel_hook_assistant::load_win_driver,
+      &kernel_hook_assistant::is_kernel_mode, true);
+  }
 
   void kernel_hook_assistant::handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj)
   {
@@ -302,12 +227,22 @@ namespace hh::hv_event_handlers
 
       case 3:
       {
-        // 63 bit invalidates TLB entries. On modern win it will cause bsod.
+        // Happens only if VMX capabilities force CR3-load exiting, so we emulate
+        // TLB invalidation of MOV to CR3 with the narrowest VPID scope.
         x86::cr3_t cr3 = { .all = *reg_ptr };
+
+        // With CR4.PCIDE set bit 63 asks to keep cached translations. It must not reach CR3 itself.
+        const bool keep_translations = cpu_obj->guest_cr4().flags.pcid_enable && cr3.flags.pcid_invalidate;
         cr3.flags.pcid_invalidate = 0;
 
         cpu_obj->guest_cr3(cr3);
-        vmx::invvpid_single_context(vmx::vpid_tag);
+
+        // MOV to CR3 never invalidates global translations.
+        if (!keep_translations)
+        {
+          vmx::invvpid_single_context_retaining_globals(vmx::vpid_tag);
+          cpu_obj->translations().invalidate_all();
+        }
 
         break;
       }
@@ -446,6 +381,7 @@ namespace hh::hv_event_handlers
     }
   }
 
+  // Most leaves are completed by the fast path in vmexit_handler_.asm, keep them in sync.
   void kernel_hook_assistant::handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj)
   {
     int32_t cpu_info[4];
@@ -519,6 +455,9 @@ namespace hh::hv_event_handlers
     cr4.flags.os_xsave = 1;
 
     x86::write<x86::cr4_t>(cr4);
+
+    // Host CR4 is reloaded on every exit, later exits need OSXSAVE to save guest state with XSAVE.
+    cpu_obj->host_cr4(cr4);
     _xsetbv(regs->rcx, regs->rdx << 32 | regs->rax);
   }
 
@@ -559,6 +498,7 @@ namespace hh::hv_event_handlers
     cpu_obj->cr0_shadow(cr0);
     x86::write<x86::cr2_t>(x86::cr2_t{});
     cpu_obj->guest_cr3(x86::cr3_t{});
+    cpu_obj->translations().invalidate_all();
     cpu_obj->cr4_shadow(x86::cr4_t{});
 
     cpu_obj->guest_cr0(vmx::adjust_guest_cr0(cr0, cpu_obj->secondary_vm_exec_control()));
@@ -673,6 +613,46 @@ namespace hh::hv_event_handlers
     cpu_obj->skip_instruction(false);
   }
 
+  bool kernel_hook_assistant::is_kernel_mode(common::guest_regs* regs, vcpu* cpu_obj) noexcept
+  {
+    return (cpu_obj->guest_cs().selector.all & 3) == 0;
+  }
+
+  // Returns false if the exception must be reinjected.
+  bool kernel_hook_assistant::load_win_driver(common::guest_regs* regs, vcpu* cpu_obj)
+  {
+    PRINT(("Trying to get address of ntoskrnl.exe\n"));
+
+    const uint64_t ntoskrnl_base = kernel_locator::find_ntoskrnl(cpu_obj).image_base;
+
+    if (ntoskrnl_base)
+    {
+      PRINT(("ntoskrnl.exe base finded: 0x%llx\n", ntoskrnl_base));
+      PRINT(("cr3 = 0x%llx\n", cpu_obj->guest_cr3().all));
+      PRINT(("Trying to load our win driver.\n"));
+
+      globals::win_driver_struct->ntoskrnl_base = ntoskrnl_base;
+      uint64_t win_driver_entry_point;
+
+      try
+      {
+        win_driver_entry_point = win_driver::load_image_from_memory(ntoskrnl_base, cpu_obj);
+        PRINT(("Win driver successfully loaded. Image entry point: 0x%llx\n", win_driver_entry_point));
+      }
+      catch (std::exception& e)
+      {
+        PRINT(("Failed to load win driver. Error: %a\n", e.what()));
+      }
+    }
+    else
+    {
+      PRINT(("ntoskrnl.exe base hasn't been finded\n"));
+    }
+
+    // Faulting instruction is executed again and its #DE is reinjected then.
+    return true;
+  }
+
   void kernel_hook_assistant::handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj)
   {
     interrupt curr_interrupt = cpu_obj->get_exit_interrupt();
@@ -683,86 +663,28 @@ namespace hh::hv_event_handlers
     {
     case exception_vector::nmi_interrupt:
     {
+      // NMI IPIs of TLB shootdown must not reach the guest.
+      if (globals::shootdown_handler->handle_nmi())
+      {
+        break;
+      }
+
       // Inject NMI as soon as possible.
       cpu_obj->set_nmi_window_exiting(true);
       break;
     }
 
-    // We map our win driver to system process on this exception during patchguard initialization.
-    case exception_vector::divide_error:
+    // Only vectors with armed interceptions reach this point.
+    default:
     {
-      static bool isKeInitAmd64SpecificStateCalled = false;
-
-      if (!isKeInitAmd64SpecificStateCalled)
+      if (!exception_interceptions().dispatch(curr_interrupt.vector(), regs, cpu_obj))
       {
-        uint16_t content;
-        bool is_base_finded = false;
-        PRINT(("Trying to get address of ntoskrnl.exe\n"));
-
-        uint64_t rip = cpu_obj->guest_rip();
-        uint64_t ntoskrnl_base = rip & ~(static_cast<uint64_t>(common::page_size) - 1);
-        size_t size_of_scan_area = 0x1000;
-
-        for (size_t j = 0; j < size_of_scan_area; j++, ntoskrnl_base -= common::page_size)
-        {
-          try
-          {
-            const auto mapped_guest_content = globals::pt_handler->map_guest_address(cpu_obj->guest_cr3(),
-              reinterpret_cast<uint8_t*>(ntoskrnl_base), common::page_size);
-            mapped_guest_content->memcpy(&content, 0, sizeof(content));
-          }
-          catch (...)
-          {
-            continue;
-          }
-
-          if (content == 0x5A4D)
-          {
-            if (portable_executable::get_kernel_module_export(ntoskrnl_base, "BgkDisplayCharacter"))
-            {
-              is_base_finded = true;
-              break;
-            }
-          }
-        }
-
-        if (is_base_finded)
-        {
-          PRINT(("ntoskrnl.exe base finded: 0x%llx\n", ntoskrnl_base));
-          PRINT(("cr3 = 0x%llx\n", cpu_obj->guest_cr3().all));
-          PRINT(("Trying to load our win driver.\n"));
-
-          globals::win_driver_struct->ntoskrnl_base = ntoskrnl_base;
-          uint64_t win_driver_entry_point;
-
-          try
-          {
-            win_driver_entry_point = win_driver::load_image_from_memory(ntoskrnl_base, cpu_obj);
-            PRINT(("Win driver successfully loaded. Image entry point: 0x%llx\n", win_driver_entry_point));
-          }
-          catch (std::exception& e)
-          {
-            PRINT(("Failed to load win driver. Error: %a\n", e.what()));
-          }
-        }
-        else
-        {
-          PRINT(("ntoskrnl.exe base hasn't been finded\n"));
-        }
-
-        isKeInitAmd64SpecificStateCalled = true;
-        break;
+        curr_interrupt.interrupt_info.nmi_unblocking = 0;
+        cpu_obj->inject_interrupt(curr_interrupt);
       }
 
-      cpu_obj->inject_interrupt(interrupt_templates::divide_error());
       break;
     }
-
-    default:
-    {
-      PRINT(("Received unknown exception vector in \"handle_exception_nmi\", vector num = %d", curr_interrupt.vector()));
-      hh::bug_check(bug_check_codes::unexpected_exception_or_interrupt, static_cast<uint64_t>(curr_interrupt.vector()));
-    }
     }
 
     cpu_obj->skip_instruction(false);
@@ -774,10 +696,18 @@ namespace hh::hv_event_handlers
     __halt();
   }
 
+  // Happens only if VMX capabilities force INVLPG exiting. Exit qualification is the linear address.
+  void kernel_hook_assistant::handle_invlpg(common::guest_regs* regs, vcpu* cpu_obj)
+  {
+    const uint64_t linear_address = cpu_obj->exit_qualification().all;
+
+    vmx::invvpid_individual_address(vmx::vpid_tag, linear_address);
+    cpu_obj->translations().invalidate_page(linear_address);
+  }
+
   void kernel_hook_assistant::handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj)
   {
-    uint64_t guest_phys_address;
-    vmx::vmread(vmx::vmcs_fields::guest_physical_address, guest_phys_address);
+    const uint64_t guest_phys_address = cpu_obj->exit_guest_physical_address();
 
     PRINT(("Fatal error. EPT Misconfiguration occured.\n"));
     PRINT(("Physical address 0x%llx\n", guest_phys_address));
@@ -795,6 +725,7 @@ namespace hh::hv_event_handlers
     {
       switch (request_num)
       {
+      // Completed by the fast path in vmexit_handler_.asm unless it is disabled.
       case vmx::vmcall_number::test:
       {
         PRINT(("test vmcall called with params 0x%llx, 0x%llx, 0x%llx\n", regs->rdx, regs->r8, regs->r9));
@@ -805,11 +736,8 @@ namespace hh::hv_event_handlers
 
       case vmx::vmcall_number::change_page_attrib:
       {
-        hook::guest_hook_request_info hook_request_info = {};
-
-        auto mapped_memory = globals::pt_handler->map_guest_address(cpu_obj->guest_cr3(),
-          reinterpret_cast<uint8_t*>(regs->rdx), sizeof(hook::guest_hook_request_info));
-        mapped_memory->memcpy(&hook_request_info, 0, sizeof(hook_request_info));
+        const auto hook_request_info = pt::guest_memory{ cpu_obj->guest_cr3(), regs->rdx, sizeof(hook::guest_hook_request_info) }
+          .read<hook::guest_hook_request_info>(0);
 
         PRINT(("hook_request_info params:\n"));
         PRINT(("target_page_address = 0x%llx, hooked_page_address = 0x%llx\n target_cr3 = 0x%llx, required_attributes = 0x%llx\n",
@@ -823,22 +751,11 @@ namespace hh::hv_event_handlers
       }
 
       // We need to invalidate EPT TLB entries for all logical CPUs after EPT hook.
-      // I will add in the future root mode callback that is executed through NMI IPI
+      // Returns when every logical CPU has invalidated them.
       case vmx::vmcall_number::notify_all_to_invalidate_ept:
       {
-        per_cpu_data::push_root_mode_callback_to_queue([](void* context) -> void
-          {
-            uint64_t ept_pointer_flags = reinterpret_cast<uint64_t>(context);
-
-        if (ept_pointer_flags == 0)
-        {
-          vmx::invept_all_contexts();
-        }
-        else
-        {
-          vmx::invept_single_context(ept_pointer_flags);
-        }
-          }, reinterpret_cast<void*>(globals::ept_handler->get_eptp().flags));
+        [[maybe_unused]] const uint64_t elapsed_ticks = globals::shootdown_handler->invalidate_ept(globals::ept_handler->get_eptp().flags);
+        PRINT(("EPT shootdown took %llu ticks\n", elapsed_ticks));
 
         break;
       }
@@ -877,8 +794,7 @@ namespace hh::hv_event_handlers
 
       case vmx::vmcall_number::get_physical_address_for_virtual:
       {
-        regs->rdx = common::get_physical_address_for_virtual_address_by_cr3(cpu_obj->guest_cr3(),
-          reinterpret_cast<void*>(regs->rdx));
+        regs->rdx = cpu_obj->translations().translate(cpu_obj->guest_cr3(), regs->rdx);
         break;
       }
 
@@ -889,16 +805,94 @@ namespace hh::hv_event_handlers
         break;
       }
 
+      // rdx - processor index, r8 - guest buffer, r9 - buffer size.
+      case vmx::vmcall_number::get_exit_statistics:
+      {
+        if (regs->rdx >= globals::number_of_cpus)
+        {
+          throw std::exception{ __FUNCTION__": ""Invalid processor index." };
+        }
+
+        if (regs->r9 < sizeof(statistics::exit_statistics))
+        {
+          throw std::exception{ __FUNCTION__": ""Buffer for exit statistics is too small." };
+        }
+
+        pt::guest_memory guest_buffer{ cpu_obj->guest_cr3(), regs->r8, sizeof(statistics::exit_statistics) };
+
+        auto snapshot = std::make_unique<statistics::exit_statistics>();
+        globals::vcpus[regs->rdx].exit_latency().snapshot(*snapshot);
+        globals::vcpus[regs->rdx].translations().snapshot(snapshot->translations);
+
+        guest_buffer.write(0, snapshot.get(), sizeof(statistics::exit_statistics));
+
+        break;
+      }
+
+      // rdx - processor index, r8 - guest buffer, r9 - buffer size.
+      // Buffer receives flight_recorder_drain_header followed by records.
+      case vmx::vmcall_number::drain_flight_recorder:
+      {
+        if (regs->rdx >= globals::number_of_cpus)
+        {
+          throw std::exception{ __FUNCTION__": ""Invalid processor index." };
+        }
+
+        if (regs->r9 < sizeof(diagnostics::flight_recorder_drain_header) + sizeof(diagnostics::flight_record))
+        {
+          throw std::exception{ __FUNCTION__": ""Buffer for flight records is too small." };
+        }
+
+        uint64_t max_count = (regs->r9 - sizeof(diagnostics::flight_recorder_drain_header)) / sizeof(diagnostics::flight_record);
+        max_count = max_count < flight_recorder::capacity ? max_count : flight_recorder::capacity;
+
+        // Map the buffer before draining so records aren't lost if guest address is invalid.
+        pt::guest_memory guest_buffer{ cpu_obj->guest_cr3(), regs->r8,
+          sizeof(diagnostics::flight_recorder_drain_header) + max_count * sizeof(diagnostics::flight_record) };
+
+        auto records = std::make_unique<diagnostics::flight_record[]>(max_count);
+        diagnostics::flight_recorder_drain_header header = {};
+        header.records_count = globals::flight_recorders[regs->rdx].drain(records.get(), static_cast<uint32_t>(max_count), header.records_lost);
+
+        guest_buffer.write(0, header);
+        guest_buffer.write(sizeof(header), records.get(), header.records_count * sizeof(diagnostics::flight_record));
+
+        break;
+      }
+
       case vmx::vmcall_number::unhook_all_pages:
       {
-        globals::hook_handler->unhook_all_pages();
+        // Hooks are removed by a root task. Guest stays on VMCALL until there are no hooks left,
+        // so it keeps receiving interrupts between slices. Guest thread may migrate to another
+        // core meanwhile, that's why completion is checked by the hooks themselves.
+        if (!globals::hook_handler->has_hooks())
+        {
+          break;
+        }
+
+        root_task_scheduler& root_tasks = cpu_obj->root_tasks();
+        const auto task_state = root_tasks.poll(root_task_tag::unhook_all_pages);
+
+        if (task_state == root_task_scheduler::task_state::failed)
+        {
+          vmcall_status = common::status::hv_unsuccessful;
+          break;
+        }
+
+        if (task_state != root_task_scheduler::task_state::running
+          && !root_tasks.spawn(globals::hook_handler->unhook_all_pages_in_slices(), root_task_tag::unhook_all_pages))
+        {
+          globals::hook_handler->unhook_all_pages();
+          break;
+        }
+
+        cpu_obj->skip_instruction(false);
         break;
       }
 
       case vmx::vmcall_number::unhook_single_page:
       {
-        uint64_t phys_address = common::get_physical_address_for_virtual_address_by_cr3(cpu_obj->guest_cr3(),
-          reinterpret_cast<void*>(regs->rdx));
+        uint64_t phys_address = cpu_obj->translations().translate(cpu_obj->guest_cr3(), regs->rdx);
 
         phys_address = reinterpret_cast<uint64_t>(PAGE_ALIGN(phys_address));
         globals::hook_handler->unhook_page(phys_address);
@@ -906,6 +900,14 @@ namespace hh::hv_event_handlers
         break;
       }
 
+      // rdx - bits of fast_path_exit, exits with cleared bits take the regular path. Undefined bits are ignored.
+      // Lets guest measure the same exit with and without the fast path.
+      case vmx::vmcall_number::set_fast_path_mask:
+      {
+        globals::vmexit_fast_path_mask = static_cast<uint32_t>(regs->rdx) & fast_path_exits_mask;
+        break;
+      }
+
       default:
       {
         PRINT(("Unsupported vmcall number.\n"));
@@ -924,14 +926,20 @@ namespace hh::hv_event_handlers
     regs->rax = static_cast<uint64_t>(vmcall_status);
   }
 
+  // Root tasks are resumed by handlers_dispatcher after every exit, there is nothing else to do here.
+  void kernel_hook_assistant::handle_vmx_preemption_timer_expired(common::guest_regs* regs, vcpu* cpu_obj)
+  {
+    cpu_obj->skip_instruction(false);
+  }
+
   // Restore EPT entry to hooked one after MTF.
   void kernel_hook_assistant::handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj)
   {
+    // Page 0 is never hooked, it holds the real mode IVT.
     if (*cpu_obj->mtf_restore_point())
     {
-      hook::hook_info* page = *cpu_obj->mtf_restore_point();
-      globals::ept_handler->set_pml1_and_invalidate_tlb(page->entry_address, page->changed_entry,
-        vmx::invvpid_type::invvpid_individual_address);
+      globals::hook_handler->restore_changed_entry(*cpu_obj->mtf_restore_point());
+      *cpu_obj->mtf_restore_point() = 0;
     }
 
     cpu_obj->set_monitor_trap_flag(false);
@@ -944,25 +952,25 @@ namespace hh::hv_event_handlers
     {
       const uint64_t guest_physical_address = cpu_obj->exit_guest_physical_address();
       const vmx::exit_qualification_t exit_qualification = cpu_obj->exit_qualification();
-      hook::hook_info* hooked_page = globals::hook_handler->get_hooked_page_info(guest_physical_address);
 
-      if (hooked_page == nullptr)
+      // Nothing was mapped at this address, the instruction is retried after the region is mapped.
+      if (!exit_qualification.ept_violation.entry_read && !exit_qualification.ept_violation.entry_write
+        && !exit_qualification.ept_violation.entry_execute && globals::ept_handler->map_absent_region(guest_physical_address))
       {
-        PRINT(("Unexpected EPT violation.\n"));
+        cpu_obj->skip_instruction(false);
         return;
       }
 
-      globals::ept_handler->set_pml1_and_invalidate_tlb(hooked_page->entry_address,
-        hooked_page->original_entry, vmx::invvpid_type::invvpid_individual_address);
-
-      uint64_t rip = cpu_obj->guest_rip();
-      uint64_t exact_accessed_address = reinterpret_cast<uint64_t>(hooked_page->virtual_address) + (guest_physical_address
-        - reinterpret_cast<uint64_t>(PAGE_ALIGN(guest_physical_address)));
-
-      //PRINT(("Ept violation, RIP : 0x%llx, exact address : 0xllx\n", rip, exact_accessed_address));
+      // The page may be unhooked by another processor meanwhile, the map is looked up under its lock.
+      // Then the access is retried against the entry that processor restored.
+      if (!globals::hook_handler->restore_original_entry(guest_physical_address))
+      {
+        cpu_obj->skip_instruction(false);
+        return;
+      }
 
       // We replace hooked entry for one CPU command to original version using MTF.
-      *cpu_obj->mtf_restore_point() = hooked_page;
+      *cpu_obj->mtf_restore_point() = reinterpret_cast<uint64_t>(PAGE_ALIGN(guest_physical_address));
       cpu_obj->set_monitor_trap_flag(true);
     }
     catch (std::exception& e)
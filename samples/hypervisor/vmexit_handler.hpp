@@ -1,6 +1,8 @@
 #pragma once
 #include "delete_constructors.hpp"
 #include "common.hpp"
+#include "exit_reason.hpp"
+#include "exception_interceptor.hpp"
 #include <vector>
 
 namespace hh
@@ -9,144 +11,309 @@ namespace hh
 
   namespace hv_event_handlers
   {
-    // Abstract base for all VMEXIT handlers.
+    // VMEXITs that are completed by the entry stub without building guest_regs
+    // and calling handlers_dispatcher. Bits of globals::vmexit_fast_path_mask.
+    enum class fast_path_exit : uint32_t
+    {
+      cpuid_passthrough = 1 << 0, // every CPUID leaf except spoofed brand string
+      test_vmcall = 1 << 1,
+    };
+
+    inline constexpr uint32_t fast_path_exits_mask = static_cast<uint32_t>(fast_path_exit::cpuid_passthrough)
+      | static_cast<uint32_t>(fast_path_exit::test_vmcall);
+
+    // Base for all VMEXIT handlers. It owns VMEXIT entry and exit paths,
+    // actual dispatching is generated by exit_dispatcher for a concrete handler.
     class vmexit_handler abstract : non_relocatable
     {
       friend class vcpu;
-      using vm_handler = void(vmexit_handler::*)(common::guest_regs* regs, vcpu* cpu_obj);
+
+    protected:
+      using dispatch_routine = void(*)(vmexit_handler* handler, uint64_t reason, common::guest_regs* regs, vcpu* cpu_obj);
+
+      static constexpr size_t exit_reasons_count = 66;
 
     private:
-      vm_handler handlers_[66];
+      dispatch_routine dispatch_;
+      exception_interceptor exception_interceptor_;
 
     private:
       static bool handlers_dispatcher(common::guest_regs* regs) noexcept;
+      static void record_fast_path_exit(uint64_t exit_start_tsc, uint64_t exit_reason, uint64_t guest_rip) noexcept;
       static void vm_resume() noexcept;
       static void vmxoff_handler() noexcept;
       static uint64_t get_stack_pointer_for_vmxoff() noexcept;
       static uint64_t get_instruction_pointer_for_vmxoff() noexcept;
       static void vmexit_entry() noexcept;
 
-      virtual void handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_external_interrupt(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_init(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_sipi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_io_smi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_other_smi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_pending_virt_intr(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_pending_virt_nmi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_task_switch(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_getsec(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_hlt(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invd(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invlpg(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rdpmc(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rdtsc(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rsm(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmcall(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmclear(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmlaunch(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmptrld(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmptrst(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmread(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmresume(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmwrite(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmxoff(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmxon(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_cr_access(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_dr_access(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_io_instruction(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_msr_read(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_msr_write(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invalid_guest_state(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_msr_loading(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_mwait_instruction(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_monitor_instruction(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_pause_instruction(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_mce_during_vmentry(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_tpr_below_threshold(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_apic_access(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_access_gdtr_or_idtr(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_access_ldtr_or_tr(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_ept_violation(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invept(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rdtscp(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmx_preemption_timer_expired(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invvpid(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_wbinvd(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_xsetbv(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_apic_write(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rdrand(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_invpcid(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_rdseed(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_pml_full(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_xsaves(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_xrstors(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_pcommit(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_virtualized_eoi(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_vmfunc(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_encls(common::guest_regs* regs, vcpu* cpu_obj);
-      virtual void handle_page_modification_log_full(common::guest_regs* regs, vcpu* cpu_obj);
-
-      // Do absolutely nothing.
-      void handler_stub(common::guest_regs* regs, vcpu* cpu_obj) noexcept;
-
     protected:
 
-      // RAII simd registers saver.
-      struct fx_state_saver
-      {
-        common::fxsave_area* fxsave_area;
-
-        fx_state_saver() noexcept = default;
-        fx_state_saver(const fx_state_saver&) noexcept = default;
-        fx_state_saver(fx_state_saver&&) noexcept = default;
-        fx_state_saver& operator=(const fx_state_saver&) noexcept = default;
-        fx_state_saver& operator=(fx_state_saver&&) noexcept = default;
+      // Called for every VMEXIT that the handler doesn't expect.
+      static void handler_stub(common::guest_regs* regs, vcpu* cpu_obj) noexcept;
 
-        explicit fx_state_saver(common::fxsave_area* ptr) noexcept;
-        ~fx_state_saver() noexcept;
-      };
+      explicit vmexit_handler(dispatch_routine routine) noexcept;
 
     public:
-      vmexit_handler();
+      exception_interceptor& exception_interceptions() noexcept;
       virtual ~vmexit_handler() = default;
     };
 
+    // Compile-time composed VMEXIT dispatcher.
+    // Derived class hides default handle_* methods by name, so every exit reaches its handler
+    // without virtual calls. The most frequent exit reasons are inlined into a switch and
+    // everything else goes through a constexpr table on the cold path.
+    template <typename Derived>
+    class exit_dispatcher : public vmexit_handler
+    {
+    private:
+      using exit_routine = void(*)(Derived* handler, common::guest_regs* regs, vcpu* cpu_obj);
+
+      template <auto Handler>
+      static void invoke(Derived* handler, common::guest_regs* regs, vcpu* cpu_obj)
+      {
+        (handler->*Handler)(regs, cpu_obj);
+      }
+
+      static void invoke_stub(Derived* handler, common::guest_regs* regs, vcpu* cpu_obj)
+      {
+        handler_stub(regs, cpu_obj);
+      }
+
+      __declspec(noinline) static void cold_dispatch(Derived* handler, uint64_t reason, common::guest_regs* regs, vcpu* cpu_obj)
+      {
+        // Table is built here and not as a class member because Derived is complete only at this point.
+        static constexpr exit_routine handlers[exit_reasons_count] =
+        {
+          &exit_dispatcher::invoke<&Derived::handle_exception_nmi>,
+          &exit_dispatcher::invoke<&Derived::handle_external_interrupt>,
+          &exit_dispatcher::invoke<&Derived::handle_triple_fault>,
+          &exit_dispatcher::invoke<&Derived::handle_init>,
+          &exit_dispatcher::invoke<&Derived::handle_sipi>,
+          &exit_dispatcher::invoke<&Derived::handle_io_smi>,
+          &exit_dispatcher::invoke<&Derived::handle_other_smi>,
+          &exit_dispatcher::invoke<&Derived::handle_pending_virt_intr>,
+          &exit_dispatcher::invoke<&Derived::handle_pending_virt_nmi>,
+          &exit_dispatcher::invoke<&Derived::handle_task_switch>,
+          &exit_dispatcher::invoke<&Derived::handle_cpuid>,
+          &exit_dispatcher::invoke<&Derived::handle_getsec>,
+          &exit_dispatcher::invoke<&Derived::handle_hlt>,
+          &exit_dispatcher::invoke<&Derived::handle_invd>,
+          &exit_dispatcher::invoke<&Derived::handle_invlpg>,
+          &exit_dispatcher::invoke<&Derived::handle_rdpmc>,
+          &exit_dispatcher::invoke<&Derived::handle_rdtsc>,
+          &exit_dispatcher::invoke<&Derived::handle_rsm>,
+          &exit_dispatcher::invoke<&Derived::handle_vmcall>,
+          &exit_dispatcher::invoke<&Derived::handle_vmclear>,
+          &exit_dispatcher::invoke<&Derived::handle_vmlaunch>,
+          &exit_dispatcher::invoke<&Derived::handle_vmptrld>,
+          &exit_dispatcher::invoke<&Derived::handle_vmptrst>,
+          &exit_dispatcher::invoke<&Derived::handle_vmread>,
+          &exit_dispatcher::invoke<&Derived::handle_vmresume>,
+          &exit_dispatcher::invoke<&Derived::handle_vmwrite>,
+          &exit_dispatcher::invoke<&Derived::handle_vmxoff>,
+          &exit_dispatcher::invoke<&Derived::handle_vmxon>,
+          &exit_dispatcher::invoke<&Derived::handle_cr_access>,
+          &exit_dispatcher::invoke<&Derived::handle_dr_access>,
+          &exit_dispatcher::invoke<&Derived::handle_io_instruction>,
+          &exit_dispatcher::invoke<&Derived::handle_msr_read>,
+          &exit_dispatcher::invoke<&Derived::handle_msr_write>,
+          &exit_dispatcher::invoke<&Derived::handle_invalid_guest_state>,
+          &exit_dispatcher::invoke<&Derived::handle_msr_loading>,
+          &exit_dispatcher::invoke_stub, // reserved
+          &exit_dispatcher::invoke<&Derived::handle_mwait_instruction>,
+          &exit_dispatcher::invoke<&Derived::handle_monitor_trap_flag>,
+          &exit_dispatcher::invoke_stub, // reserved
+          &exit_dispatcher::invoke<&Derived::handle_monitor_instruction>,
+          &exit_dispatcher::invoke<&Derived::handle_pause_instruction>,
+          &exit_dispatcher::invoke<&Derived::handle_mce_during_vmentry>,
+          &exit_dispatcher::invoke_stub, // reserved
+          &exit_dispatcher::invoke<&Derived::handle_tpr_below_threshold>,
+          &exit_dispatcher::invoke<&Derived::handle_apic_access>,
+          &exit_dispatcher::invoke<&Derived::handle_virtualized_eoi>,
+          &exit_dispatcher::invoke<&Derived::handle_access_gdtr_or_idtr>,
+          &exit_dispatcher::invoke<&Derived::handle_access_ldtr_or_tr>,
+          &exit_dispatcher::invoke<&Derived::handle_ept_violation>,
+          &exit_dispatcher::invoke<&Derived::handle_ept_misconfig>,
+          &exit_dispatcher::invoke<&Derived::handle_invept>,
+          &exit_dispatcher::invoke<&Derived::handle_rdtscp>,
+          &exit_dispatcher::invoke<&Derived::handle_vmx_preemption_timer_expired>,
+          &exit_dispatcher::invoke<&Derived::handle_invvpid>,
+          &exit_dispatcher::invoke<&Derived::handle_wbinvd>,
+          &exit_dispatcher::invoke<&Derived::handle_xsetbv>,
+          &exit_dispatcher::invoke<&Derived::handle_apic_write>,
+          &exit_dispatcher::invoke<&Derived::handle_rdrand>,
+          &exit_dispatcher::invoke<&Derived::handle_invpcid>,
+          &exit_dispatcher::invoke<&Derived::handle_vmfunc>,
+          &exit_dispatcher::invoke<&Derived::handle_encls>,
+          &exit_dispatcher::invoke<&Derived::handle_rdseed>,
+          &exit_dispatcher::invoke<&Derived::handle_page_modification_log_full>,
+          &exit_dispatcher::invoke<&Derived::handle_xsaves>,
+          &exit_dispatcher::invoke<&Derived::handle_xrstors>
+        };
+
+        if (reason >= exit_reasons_count || handlers[reason] == nullptr)
+        {
+          handler_stub(regs, cpu_obj);
+          return;
+        }
+
+        handlers[reason](handler, regs, cpu_obj);
+      }
+
+      static void dispatch(vmexit_handler* handler, uint64_t reason, common::guest_regs* regs, vcpu* cpu_obj)
+      {
+        auto derived = static_cast<Derived*>(handler);
+
+        switch (static_cast<vmx::exit_reason>(reason))
+        {
+        case vmx::exit_reason::ept_violation:
+        {
+          derived->handle_ept_violation(regs, cpu_obj);
+          break;
+        }
+
+        case vmx::exit_reason::monitor_trap_flag:
+        {
+          derived->handle_monitor_trap_flag(regs, cpu_obj);
+          break;
+        }
+
+        case vmx::exit_reason::execute_cpuid:
+        {
+          derived->handle_cpuid(regs, cpu_obj);
+          break;
+        }
+
+        case vmx::exit_reason::execute_vmcall:
+        {
+          derived->handle_vmcall(regs, cpu_obj);
+          break;
+        }
+
+        case vmx::exit_reason::mov_cr:
+        {
+          derived->handle_cr_access(regs, cpu_obj);
+          break;
+        }
+
+        default:
+        {
+          cold_dispatch(derived, reason, regs, cpu_obj);
+          break;
+        }
+        }
+      }
+
+    protected:
+
+      // Default handlers. Derived class replaces them by declaring a method with the same name.
+      void handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_external_interrupt(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_init(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_sipi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_io_smi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_other_smi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_pending_virt_intr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_pending_virt_nmi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_task_switch(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_getsec(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_hlt(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invd(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invlpg(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rdpmc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rdtsc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rsm(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmcall(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmclear(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmlaunch(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmptrld(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmptrst(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmread(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmresume(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmwrite(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmxoff(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmxon(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_cr_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_dr_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_io_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_msr_read(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_msr_write(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invalid_guest_state(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_msr_loading(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_mwait_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_monitor_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_pause_instruction(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_mce_during_vmentry(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_tpr_below_threshold(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_apic_access(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_virtualized_eoi(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_access_gdtr_or_idtr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_access_ldtr_or_tr(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_ept_violation(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invept(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rdtscp(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmx_preemption_timer_expired(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invvpid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_wbinvd(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_xsetbv(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_apic_write(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rdrand(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_invpcid(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_vmfunc(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_encls(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_rdseed(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_page_modification_log_full(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_xsaves(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+      void handle_xrstors(common::guest_regs* regs, vcpu* cpu_obj) { handler_stub(regs, cpu_obj); }
+
+      exit_dispatcher() noexcept : vmexit_handler{ &exit_dispatcher::dispatch }
+      {}
+    };
+
     // VMEXIT handler that helps with EPT hooks.
-    class kernel_hook_assistant : public vmexit_handler
+    class kernel_hook_assistant final : public exit_dispatcher<kernel_hook_assistant>
     {
+      friend class exit_dispatcher<kernel_hook_assistant>;
+
     private:
       void handle_vmx_command(common::guest_regs* regs, vcpu* cpu_obj) const noexcept;
+      static bool is_kernel_mode(common::guest_regs* regs, vcpu* cpu_obj) noexcept;
+      static bool load_win_driver(common::guest_regs* regs, vcpu* cpu_obj);
 
-      void handle_xsetbv(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_init(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_pending_virt_nmi(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_sipi(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmclear(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmlaunch(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmptrld(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmptrst(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmread(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmresume(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmwrite(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmxoff(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmxon(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_cr_access(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_msr_read(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_msr_write(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_io_instruction(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_ept_violation(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_vmcall(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj) override;
-      void handle_hlt(common::guest_regs* regs, vcpu* cpu_obj) override;
+      void handle_xsetbv(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_init(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_pending_virt_nmi(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_exception_nmi(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_triple_fault(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_sipi(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmclear(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmlaunch(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmptrld(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmptrst(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmread(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmresume(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmwrite(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmxoff(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmxon(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_cr_access(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_msr_read(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_msr_write(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_cpuid(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_io_instruction(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_ept_violation(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_ept_misconfig(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmcall(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_monitor_trap_flag(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_hlt(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_invlpg(common::guest_regs* regs, vcpu* cpu_obj);
+      void handle_vmx_preemption_timer_expired(common::guest_regs* regs, vcpu* cpu_obj);
+
+    public:
+      kernel_hook_assistant();
     };
   }
 }
@@ -1,16 +1,172 @@
 .data
 
 local_var_offset = 12h ; mem cell for vmxoff handler
+volatile_xmm_area_size = 60h ; xmm0 - xmm5
+
+vmcs_exit_reason = 4402h
+vmcs_exit_instruction_len = 440Ch
+vmcs_guest_rip = 681Eh
+
+exit_reason_cpuid = 0Ah
+exit_reason_vmcall = 12h
+
+fast_path_cpuid_passthrough = 1 ; hv_event_handlers::fast_path_exit
+fast_path_test_vmcall = 2
+
+vmcall_number_test = 1
+cpuid_hypervisor_present_bit = 31
+
+; fast path frame
+fast_path_exit_start_tsc = 20h ; above shadow space
+fast_path_exit_reason = 28h
+fast_path_saved_xmm = 30h ; xmm0 - xmm5
+fast_path_locals_size = 90h
+fast_path_saved_r11 = 90h
+fast_path_saved_r10 = 98h
+fast_path_saved_r9 = 0A0h
+fast_path_saved_r8 = 0A8h
+fast_path_saved_rbx = 0B0h
+fast_path_saved_rdx = 0B8h
+fast_path_saved_rcx = 0C0h
+fast_path_saved_rax = 0C8h
 
 .code
 
+extern ?vmexit_fast_path_mask@globals@hh@@3IA:dword
+extern ?panic_status@globals@hh@@3_NA:byte
 extern ?handlers_dispatcher@vmexit_handler@hv_event_handlers@hh@@CA_NPEAUguest_regs@common@3@@Z:proc
+extern ?record_fast_path_exit@vmexit_handler@hv_event_handlers@hh@@CAX_K00@Z:proc
 extern ?vm_resume@vmexit_handler@hv_event_handlers@hh@@CAXXZ:proc
 extern ?get_stack_pointer_for_vmxoff@vmexit_handler@hv_event_handlers@hh@@CA_KXZ:proc
 extern ?get_instruction_pointer_for_vmxoff@vmexit_handler@hv_event_handlers@hh@@CA_KXZ:proc
 
 ?vmexit_entry@vmexit_handler@hv_event_handlers@hh@@CAXXZ proc
 
+  ; Fast path for trivial VMEXITs. It doesn't build guest_regs and calls C++ code only to record the exit,
+  ; so keep it in sync with kernel_hook_assistant::handle_cpuid and handle_vmcall.
+  push rax
+  push rcx
+  push rdx
+  push rbx
+  push r8
+  push r9
+  push r10
+  push r11
+  sub rsp, fast_path_locals_size
+
+  rdtsc
+  shl rdx, 32
+  or rax, rdx
+  mov qword ptr [rsp+fast_path_exit_start_tsc], rax
+
+  cmp byte ptr [?panic_status@globals@hh@@3_NA], 0
+  jne slow_path
+
+  mov ecx, vmcs_exit_reason
+  vmread rax, rcx
+  movzx eax, ax ; basic exit reason
+  mov qword ptr [rsp+fast_path_exit_reason], rax
+
+  cmp eax, exit_reason_cpuid
+  je cpuid_fast_path
+
+  cmp eax, exit_reason_vmcall
+  je vmcall_fast_path
+
+  jmp slow_path
+
+  cpuid_fast_path:
+  test dword ptr [?vmexit_fast_path_mask@globals@hh@@3IA], fast_path_cpuid_passthrough
+  jz slow_path
+
+  ; Brand string leaves are spoofed by the C++ handler.
+  mov eax, dword ptr [rsp+fast_path_saved_rax]
+  cmp eax, 80000002h
+  jb cpuid_passthrough
+  cmp eax, 80000004h
+  jbe slow_path
+
+  cpuid_passthrough:
+  mov ecx, dword ptr [rsp+fast_path_saved_rcx]
+  cpuid
+
+  ; We don't support nested virtualization so we mark hypervisor related bits to zero.
+  cmp dword ptr [rsp+fast_path_saved_rax], 1
+  jne cpuid_store_result
+  btr ecx, cpuid_hypervisor_present_bit
+
+  cpuid_store_result:
+  mov qword ptr [rsp+fast_path_saved_rax], rax
+  mov qword ptr [rsp+fast_path_saved_rbx], rbx
+  mov qword ptr [rsp+fast_path_saved_rcx], rcx
+  mov qword ptr [rsp+fast_path_saved_rdx], rdx
+  jmp fast_path_resume
+
+  vmcall_fast_path:
+  test dword ptr [?vmexit_fast_path_mask@globals@hh@@3IA], fast_path_test_vmcall
+  jz slow_path
+
+  cmp dword ptr [rsp+fast_path_saved_rcx], vmcall_number_test
+  jne slow_path
+
+  mov qword ptr [rsp+fast_path_saved_rax], 0 ; common::status::hv_success
+
+  fast_path_resume:
+  mov r8d, vmcs_guest_rip
+  vmread r9, r8
+  mov r8d, vmcs_exit_instruction_len
+  vmread r10, r8
+  add r10, r9
+  mov r8d, vmcs_guest_rip
+  vmwrite r8, r10
+
+  ; The exit goes to the flight recorder and latency statistics like any other one.
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm], xmm0
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm+10h], xmm1
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm+20h], xmm2
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm+30h], xmm3
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm+40h], xmm4
+  movdqu xmmword ptr [rsp+fast_path_saved_xmm+50h], xmm5
+
+  mov rcx, qword ptr [rsp+fast_path_exit_start_tsc]
+  mov rdx, qword ptr [rsp+fast_path_exit_reason]
+  mov r8, r9 ; rip of the exiting instruction
+  call ?record_fast_path_exit@vmexit_handler@hv_event_handlers@hh@@CAX_K00@Z
+
+  movdqu xmm0, xmmword ptr [rsp+fast_path_saved_xmm]
+  movdqu xmm1, xmmword ptr [rsp+fast_path_saved_xmm+10h]
+  movdqu xmm2, xmmword ptr [rsp+fast_path_saved_xmm+20h]
+  movdqu xmm3, xmmword ptr [rsp+fast_path_saved_xmm+30h]
+  movdqu xmm4, xmmword ptr [rsp+fast_path_saved_xmm+40h]
+  movdqu xmm5, xmmword ptr [rsp+fast_path_saved_xmm+50h]
+
+  add rsp, fast_path_locals_size
+  pop r11
+  pop r10
+  pop r9
+  pop r8
+  pop rbx
+  pop rdx
+  pop rcx
+  pop rax
+
+  vmresume
+
+  ; vm_resume executes vmresume again and reports the error.
+  sub rsp, 100h
+  jmp ?vm_resume@vmexit_handler@hv_event_handlers@hh@@CAXXZ
+
+  slow_path:
+  add rsp, fast_path_locals_size
+  pop r11
+  pop r10
+  pop r9
+  pop r8
+  pop rbx
+  pop rdx
+  pop rcx
+  pop rax
+
   push 0 ; for return address in vmxoff handler
 
   pushfq
@@ -30,18 +186,38 @@ extern ?get_instruction_pointer_for_vmxoff@vmexit_handler@hv_event_handlers@hh@@
   push rdx
   push rcx
   push rax
-  push rax ; fxsave area
+  push rax ; extended state area
 
   mov rcx, rsp  ; Ptr to guest regs
+
+  ; Handlers may freely use volatile XMM registers, so we keep guest values here.
+  ; Nonvolatile XMM registers are preserved by the calling convention and the rest
+  ; of the extended state is saved lazily in handlers_dispatcher.
+  sub rsp, volatile_xmm_area_size
+  movdqu xmmword ptr [rsp], xmm0
+  movdqu xmmword ptr [rsp+10h], xmm1
+  movdqu xmmword ptr [rsp+20h], xmm2
+  movdqu xmmword ptr [rsp+30h], xmm3
+  movdqu xmmword ptr [rsp+40h], xmm4
+  movdqu xmmword ptr [rsp+50h], xmm5
+
   sub rsp, 28h 
   call ?handlers_dispatcher@vmexit_handler@hv_event_handlers@hh@@CA_NPEAUguest_regs@common@3@@Z
   add rsp, 28h
 
+  movdqu xmm0, xmmword ptr [rsp]
+  movdqu xmm1, xmmword ptr [rsp+10h]
+  movdqu xmm2, xmmword ptr [rsp+20h]
+  movdqu xmm3, xmmword ptr [rsp+30h]
+  movdqu xmm4, xmmword ptr [rsp+40h]
+  movdqu xmm5, xmmword ptr [rsp+50h]
+  add rsp, volatile_xmm_area_size
+
   cmp al, 1
   je ?vmxoff_handler@vmexit_handler@hv_event_handlers@hh@@CAXXZ
 
   restore_state:
-  pop rax ; fxsave area
+  pop rax ; extended state area
   pop rax
   pop rcx
   pop rdx
@@ -92,7 +268,7 @@ extern ?get_instruction_pointer_for_vmxoff@vmexit_handler@hv_event_handlers@hh@@
   mov qword ptr [rsp+local_var_offset*8], rbx ; save guest stack address
 
   restore_state:
-  pop rax ; fxsave area
+  pop rax ; extended state area
   pop rax
   pop rcx
   pop rdx
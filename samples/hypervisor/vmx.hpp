@@ -191,7 +191,7 @@ namespace hh
       uint8_t* msr_bitmap_virtual_address;
       uint64_t msr_bitmap_physical_address;
       vmxoff_state_t vmxoff_state; // Shows the vmxoff state of the guest
-      hook::hook_info* mtf_ept_hook_restore_point; // It shows the detail of the hooked paged that should be restore in MTF vm-exit
+      uint64_t mtf_ept_hook_restore_point; // Physical address of the hooked page that should be restored in MTF vm-exit, 0 if none
       x86::gdtr_t original_gdtr; // Ptr to original guest GDT
       x86::gdt_entry_t host_guest_gdt_entries[16]; // New GDT for guest and host
       x86::gdtr_t host_guest_gdtr;
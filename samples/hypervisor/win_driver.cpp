@@ -1,53 +1,94 @@
 #include "win_driver.hpp"
 #include "pe.hpp"
 #include "globals.hpp"
-#include "pt_handler.hpp"
+#include "guest_memory.hpp"
 #include "vcpu.hpp"
 #include "common.hpp"
+#include "lz4.hpp"
+#include "win_driver_image.hpp"
 
 // Can't include headers directly because EDK2 and win headers conflict.
 extern "C" uint64_t allocate_pages_from_uefi_pool(uint64_t number_of_pages);
 
+// Position independent loader from win_driver_bootstrap_.asm.
+extern "C" uint8_t __win_driver_bootstrap_begin[];
+extern "C" uint8_t __win_driver_bootstrap_end[];
+extern "C" uint8_t __win_driver_bootstrap[];
+
 namespace hh::win_driver
 {
-  uint64_t load_image_from_memory(uint64_t ntoskrnl_base, vcpu* cpu_obj)
+  namespace
   {
-    const IMAGE_NT_HEADERS* nt_headers = portable_executable::get_nt_headers(win_driver_raw);
-
-    memcpy(globals::win_driver_struct->image_base_physical_address, win_driver_raw, nt_headers->OptionalHeader.SizeOfHeaders);
-
-    const IMAGE_SECTION_HEADER* current_image_section = IMAGE_FIRST_SECTION(nt_headers);
+    bootstrap_parameters* get_bootstrap_parameters() noexcept
+    {
+      return reinterpret_cast<bootstrap_parameters*>(static_cast<uint8_t*>(globals::win_driver_struct->image_base_physical_address)
+        + globals::win_driver_struct->bootstrap_offset);
+    }
 
-    for (size_t j = 0; j < nt_headers->FileHeader.NumberOfSections; j++)
+    // Fills parameters of the bootstrap and returns its guest virtual address.
+    uint64_t prepare_bootstrap(uint64_t ntoskrnl_base, const IMAGE_NT_HEADERS* nt_headers)
     {
-      auto section = reinterpret_cast<void*>(reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_physical_address)
-        + current_image_section[j].VirtualAddress);
-      memcpy(section, win_driver_raw + current_image_section[j].PointerToRawData, current_image_section[j].SizeOfRawData);
+      for (const auto& current_import : portable_executable::get_imports(globals::win_driver_struct->image_base_physical_address))
+      {
+        if (current_import.module_name != "ntoskrnl.exe")
+        {
+          PRINT(("Unacceptable module name: %a\n", current_import.module_name.c_str()));
+          throw std::exception{ __FUNCTION__": ""Inaccessible import module. We can only get export from ntoskrnl.exe." };
+        }
+      }
+
+      const auto image_base = reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_virtual_address);
+      const auto& data_directory = nt_headers->OptionalHeader.DataDirectory;
+      bootstrap_parameters* parameters = get_bootstrap_parameters();
+
+      parameters->image_base = image_base;
+      parameters->relocation_delta = image_base - nt_headers->OptionalHeader.ImageBase;
+      parameters->ntoskrnl_base = ntoskrnl_base;
+      parameters->relocations_rva = data_directory[IMAGE_DIRECTORY_ENTRY_BASERELOC].VirtualAddress;
+      parameters->relocations_size = data_directory[IMAGE_DIRECTORY_ENTRY_BASERELOC].Size;
+      parameters->imports_rva = data_directory[IMAGE_DIRECTORY_ENTRY_IMPORT].VirtualAddress;
+      parameters->entry_point_rva = nt_headers->OptionalHeader.AddressOfEntryPoint;
+      parameters->status = bootstrap_status::not_started;
+
+      return image_base + globals::win_driver_struct->bootstrap_offset + (__win_driver_bootstrap - __win_driver_bootstrap_begin);
     }
+  }
 
-    portable_executable::relocate_image_by_delta(portable_executable::get_relocs(globals::win_driver_struct->image_base_physical_address),
-      reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_virtual_address) - nt_headers->OptionalHeader.ImageBase);
+  uint64_t load_image_from_memory(uint64_t ntoskrnl_base, vcpu* cpu_obj, load_mode mode)
+  {
+    const uint64_t start_tsc = __rdtsc();
+    const IMAGE_NT_HEADERS* nt_headers = portable_executable::get_nt_headers(globals::win_driver_struct->image_base_physical_address);
+
+    const uint64_t win_driver_entry_point = reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_virtual_address)
+      + nt_headers->OptionalHeader.AddressOfEntryPoint;
+    uint64_t guest_entry_point;
 
-    portable_executable::resolve_imports(ntoskrnl_base,
-      portable_executable::get_imports(globals::win_driver_struct->image_base_physical_address));
+    if (mode == load_mode::root)
+    {
+      portable_executable::relocate_image_by_delta(portable_executable::get_relocs(globals::win_driver_struct->image_base_physical_address),
+        reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_virtual_address) - nt_headers->OptionalHeader.ImageBase);
 
-    uint64_t win_driver_entry_point = reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_virtual_address)
-      + nt_headers->OptionalHeader.AddressOfEntryPoint;;
+      portable_executable::resolve_imports(ntoskrnl_base,
+        portable_executable::get_imports(globals::win_driver_struct->image_base_physical_address));
 
+      guest_entry_point = win_driver_entry_point;
+    }
+    else
+    {
+      guest_entry_point = prepare_bootstrap(ntoskrnl_base, nt_headers);
+    }
+
+    // Entry point or bootstrap returns to the interrupted instruction.
     uint64_t guest_rip = cpu_obj->guest_rip();
     uint64_t guest_rsp = cpu_obj->guest_rsp();
     guest_rsp -= 8;
 
-    auto mapped_address = globals::pt_handler->map_guest_address(cpu_obj->guest_cr3(),
-      reinterpret_cast<uint8_t*>(guest_rsp), 8);
-
-    for (size_t j = 0; j < sizeof(guest_rip); j++)
-    {
-      (*mapped_address)[j] = reinterpret_cast<uint8_t*>(&guest_rip)[j];
-    }
+    pt::guest_memory{ cpu_obj->guest_cr3(), guest_rsp, sizeof(guest_rip) }.write(0, guest_rip);
 
     cpu_obj->guest_rsp(guest_rsp);
-    cpu_obj->guest_rip(win_driver_entry_point);
+    cpu_obj->guest_rip(guest_entry_point);
+
+    PRINT(("Win driver root mode stage took %llu ticks, guest continues at 0x%llx.\n", __rdtsc() - start_tsc, guest_entry_point));
 
     return win_driver_entry_point;
   }
@@ -64,15 +105,48 @@ namespace hh::win_driver
     globals::win_driver_struct->mem_pool_for_allocator_virtual_address = globals::win_driver_struct->mem_pool_for_allocator_physical_address;
     globals::win_driver_struct->mem_pool_size = pool_size * common::page_size;
 
-    const IMAGE_NT_HEADERS* nt_headers = portable_executable::get_nt_headers(win_driver_raw);
+    // Raw image is unpacked into a temporary buffer that is released back to the firmware pool.
+    const uint64_t decompress_start_tsc = __rdtsc();
+    const auto win_driver_raw = std::make_unique_for_overwrite<uint8_t[]>(win_driver_image_size);
+
+    if (lz4::decompress(win_driver_image_compressed, sizeof(win_driver_image_compressed), win_driver_raw.get(), win_driver_image_size)
+      != win_driver_image_size)
+    {
+      throw std::exception{ __FUNCTION__": ""Win driver image has unexpected size." };
+    }
+
+    PRINT(("Win driver image has been decompressed in %llu ticks.\n", __rdtsc() - decompress_start_tsc));
+
+    const IMAGE_NT_HEADERS* nt_headers = portable_executable::get_nt_headers(win_driver_raw.get());
     const uint32_t image_size = nt_headers->OptionalHeader.SizeOfImage;
     const uint32_t image_size_in_pages = image_size / common::page_size + (image_size % common::page_size ? 1 : 0);
 
-    allocated_address = allocate_pages_from_uefi_pool(image_size_in_pages);
+    // The bootstrap lives in an extra page right after the image, so guest sees it at the same mapping.
+    const uint64_t bootstrap_size = __win_driver_bootstrap_end - __win_driver_bootstrap_begin;
+    const uint32_t bootstrap_size_in_pages = static_cast<uint32_t>(bootstrap_size / common::page_size + (bootstrap_size % common::page_size ? 1 : 0));
 
-    common::memset_256bit(reinterpret_cast<void*>(allocated_address), {}, image_size_in_pages * common::page_size / sizeof(__m256));
+    allocated_address = allocate_pages_from_uefi_pool(image_size_in_pages + bootstrap_size_in_pages);
+
+    common::memset_256bit(reinterpret_cast<void*>(allocated_address), {},
+      (image_size_in_pages + bootstrap_size_in_pages) * common::page_size / sizeof(__m256));
 
     globals::win_driver_struct->image_base_physical_address = reinterpret_cast<uint8_t*>(allocated_address);
     globals::win_driver_struct->image_base_virtual_address = globals::win_driver_struct->image_base_physical_address;
+    globals::win_driver_struct->bootstrap_offset = static_cast<uint64_t>(image_size_in_pages) * common::page_size;
+
+    // Sections don't depend on the final virtual address, so they are copied here and not during VMEXIT.
+    memcpy(globals::win_driver_struct->image_base_physical_address, win_driver_raw.get(), nt_headers->OptionalHeader.SizeOfHeaders);
+
+    const IMAGE_SECTION_HEADER* current_image_section = IMAGE_FIRST_SECTION(nt_headers);
+
+    for (size_t j = 0; j < nt_headers->FileHeader.NumberOfSections; j++)
+    {
+      auto section = reinterpret_cast<void*>(reinterpret_cast<uint64_t>(globals::win_driver_struct->image_base_physical_address)
+        + current_image_section[j].VirtualAddress);
+      memcpy(section, win_driver_raw.get() + current_image_section[j].PointerToRawData, current_image_section[j].SizeOfRawData);
+    }
+
+    memcpy(static_cast<uint8_t*>(globals::win_driver_struct->image_base_physical_address) + globals::win_driver_struct->bootstrap_offset,
+      __win_driver_bootstrap_begin, bootstrap_size);
   }
 }
@@ -0,0 +1,237 @@
+.code
+
+  IMAGE_REL_BASED_DIR64       = 10
+  BOOTSTRAP_STATUS_LOADED     = 1
+  BOOTSTRAP_STATUS_FAILED     = 2
+
+; Position independent loader of the win driver that is executed in guest context.
+; Everything between __win_driver_bootstrap_begin and __win_driver_bootstrap_end is copied
+; to a page that is visible to the guest, so the code may reference only itself.
+; The parameter block at the beginning matches win_driver::bootstrap_parameters.
+
+__win_driver_bootstrap_begin label byte
+
+bootstrap_image_base          dq 0
+bootstrap_relocation_delta    dq 0
+bootstrap_ntoskrnl_base       dq 0
+bootstrap_relocations_rva     dd 0
+bootstrap_relocations_size    dd 0
+bootstrap_imports_rva         dd 0
+bootstrap_entry_point_rva     dd 0
+bootstrap_status              dq 0
+
+; The hypervisor pushes interrupted guest RIP and redirects guest here, so all registers are
+; preserved and the guest continues from the same instruction after the driver entry returns.
+__win_driver_bootstrap proc
+
+  pushfq
+  push rax
+  push rcx
+  push rdx
+  push rbx
+  push rbp
+  push rsi
+  push rdi
+  push r8
+  push r9
+  push r10
+  push r11
+  push r12
+  push r13
+  push r14
+  push r15
+
+  mov rbp, rsp
+  and rsp, -16
+  sub rsp, 20h
+
+  mov rsi, bootstrap_image_base
+
+  ; Apply IMAGE_REL_BASED_DIR64 relocations.
+  mov r12, bootstrap_relocation_delta
+  mov edi, bootstrap_relocations_rva
+  test edi, edi
+  jz @relocated
+  test r12, r12
+  jz @relocated
+
+  mov r13d, bootstrap_relocations_size
+  add rdi, rsi
+  add r13, rdi
+
+  @relocation_block:
+  lea rax, [rdi + 8]
+  cmp rax, r13
+  ja @relocated
+  mov eax, dword ptr [rdi]
+  mov ecx, dword ptr [rdi + 4]
+  cmp ecx, 8
+  jb @relocated
+  lea r8, [rsi + rax]
+  lea r9, [rdi + 8]
+  lea r10, [rdi + rcx]
+
+  @relocation_item:
+  cmp r9, r10
+  jae @relocation_next
+  movzx eax, word ptr [r9]
+  mov edx, eax
+  shr edx, 12
+  cmp edx, IMAGE_REL_BASED_DIR64
+  jne @relocation_skip
+  and eax, 0fffh
+  add qword ptr [r8 + rax], r12
+
+  @relocation_skip:
+  add r9, 2
+  jmp @relocation_item
+
+  @relocation_next:
+  mov rdi, r10
+  jmp @relocation_block
+
+  @relocated:
+
+  ; r12 - ntoskrnl export directory rva, r13 - its size, r14 - ntoskrnl base.
+  mov r14, bootstrap_ntoskrnl_base
+  mov eax, dword ptr [r14 + 3ch]
+  add rax, r14
+  mov r12d, dword ptr [rax + 88h]
+  mov r13d, dword ptr [rax + 8ch]
+  test r12d, r12d
+  jz @failed
+
+  ; Resolve imports by name, rbx - import descriptor, r15 - original thunk, rdi - thunk.
+  mov ebx, bootstrap_imports_rva
+  test ebx, ebx
+  jz @imported
+  add rbx, rsi
+
+  @import_descriptor:
+  mov edi, dword ptr [rbx + 10h]
+  test edi, edi
+  jz @imported
+  mov r15d, dword ptr [rbx]
+  test r15d, r15d
+  cmovz r15d, edi
+  add rdi, rsi
+  add r15, rsi
+
+  @import_thunk:
+  mov rcx, qword ptr [r15]
+  test rcx, rcx
+  jz @import_next
+  js @failed
+  lea rcx, [rsi + rcx + 2]
+  call @find_export
+  test rax, rax
+  jz @failed
+  mov qword ptr [rdi], rax
+  add r15, 8
+  add rdi, 8
+  jmp @import_thunk
+
+  @import_next:
+  add rbx, 14h
+  jmp @import_descriptor
+
+  @imported:
+  mov qword ptr bootstrap_status, BOOTSTRAP_STATUS_LOADED
+  mov eax, bootstrap_entry_point_rva
+  add rax, rsi
+  call rax
+  jmp @exit
+
+  @failed:
+  mov qword ptr bootstrap_status, BOOTSTRAP_STATUS_FAILED
+
+  @exit:
+  mov rsp, rbp
+
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop r11
+  pop r10
+  pop r9
+  pop r8
+  pop rdi
+  pop rsi
+  pop rbp
+  pop rbx
+  pop rdx
+  pop rcx
+  pop rax
+  popfq
+  ret
+
+  ; Binary search over sorted AddressOfNames. rcx - zero terminated name.
+  ; Returns export address in rax or 0 if it isn't found or is forwarded.
+  @find_export:
+  lea r8, [r14 + r12]
+  xor r9d, r9d
+  mov r10d, dword ptr [r8 + 18h]
+
+  @find_export_loop:
+  cmp r9d, r10d
+  jae @find_export_failed
+  lea r11d, [r9 + r10]
+  shr r11d, 1
+  lea r8, [r14 + r12]
+  mov eax, dword ptr [r8 + 20h]
+  add rax, r14
+  mov eax, dword ptr [rax + r11 * 4]
+  add rax, r14
+  mov rdx, rcx
+
+  @compare_name:
+  movzx r8d, byte ptr [rax]
+  cmp r8b, byte ptr [rdx]
+  jne @compare_name_done
+  test r8b, r8b
+  jz @find_export_found
+  inc rax
+  inc rdx
+  jmp @compare_name
+
+  @compare_name_done:
+  jb @find_export_above
+  mov r10d, r11d
+  jmp @find_export_loop
+
+  @find_export_above:
+  lea r9d, [r11 + 1]
+  jmp @find_export_loop
+
+  @find_export_found:
+  lea r8, [r14 + r12]
+  mov eax, dword ptr [r8 + 24h]
+  add rax, r14
+  movzx eax, word ptr [rax + r11 * 2]
+  cmp eax, dword ptr [r8 + 14h]
+  jae @find_export_failed
+  mov edx, dword ptr [r8 + 1ch]
+  add rdx, r14
+  mov eax, dword ptr [rdx + rax * 4]
+
+  ; Forwarded export points to a string inside the export directory.
+  mov edx, eax
+  sub edx, r12d
+  cmp edx, r13d
+  jb @find_export_failed
+  add rax, r14
+  ret
+
+  @find_export_failed:
+  xor eax, eax
+  ret
+
+__win_driver_bootstrap endp
+
+__win_driver_bootstrap_end label byte
+
+public __win_driver_bootstrap_begin
+public __win_driver_bootstrap_end
+
+end
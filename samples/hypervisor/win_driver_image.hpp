@@ -0,0 +1,8108 @@
+#pragma once
+#include <cstdint>
+
+// Generated by win_driver/pack_win_driver.py, don't edit it by hand.
+
+namespace hh::win_driver
+{
+  // Our win driver that is mapped on patchguard initialization, LZ4 block compressed.
+  inline constexpr uint32_t win_driver_image_size = 271824;
+
+  inline constexpr uint8_t win_driver_image_compressed[] =
+  {
+    0xf2, 0x03, 0x4d, 0x5a, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xb8, 0x00, 0x01, 0x00, 0x13, 0x40, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0xf3, 0x2d,
+    0x01, 0x00, 0x00, 0x0e, 0x1f, 0xba, 0x0e, 0x00, 0xb4, 0x09, 0xcd, 0x21, 0xb8, 0x01, 0x4c, 0xcd,
+    0x21, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x63, 0x61,
+    0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x44,
+    0x4f, 0x53, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x0d, 0x0d, 0x0a, 0x24, 0x43, 0x00, 0x88, 0x7d,
+    0xba, 0x72, 0x8a, 0x39, 0xdb, 0x1c, 0xd9, 0x04, 0x00, 0x91, 0x38, 0xdb, 0x1c, 0xd9, 0x72, 0xa3,
+    0x1d, 0xd8, 0x3a, 0x10, 0x00, 0x31, 0x1d, 0xd9, 0x3f, 0x10, 0x00, 0x31, 0x1f, 0xd8, 0x3e, 0x08,
+    0x00, 0x11, 0x18, 0x08, 0x00, 0x51, 0x84, 0xa7, 0x14, 0xd8, 0x3d, 0x08, 0x00, 0x31, 0x1f, 0xd8,
+    0x3b, 0x08, 0x00, 0x20, 0x18, 0xd8, 0x38, 0x00, 0x51, 0x84, 0xa7, 0x19, 0xd8, 0x32, 0x08, 0x00,
+    0x11, 0x1e, 0x10, 0x00, 0x40, 0x52, 0x69, 0x63, 0x68, 0x54, 0x00, 0x0f, 0xc3, 0x00, 0x05, 0xc4,
+    0x50, 0x45, 0x00, 0x00, 0x64, 0x86, 0x06, 0x00, 0x0e, 0x82, 0xcc, 0x63, 0x14, 0x00, 0xe0, 0xf0,
+    0x00, 0x22, 0x00, 0x0b, 0x02, 0x0e, 0x22, 0x00, 0x78, 0x00, 0x00, 0x00, 0x9c, 0x1e, 0x01, 0x81,
+    0x00, 0x00, 0xbb, 0x3b, 0x00, 0x00, 0x00, 0x10, 0x0b, 0x00, 0x20, 0x40, 0x01, 0x06, 0x00, 0x00,
+    0x0c, 0x00, 0x56, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x21, 0x60, 0x04,
+    0x4d, 0x01, 0x84, 0x27, 0x0d, 0x05, 0x00, 0x01, 0x00, 0x60, 0x41, 0x35, 0x00, 0x04, 0x07, 0x00,
+    0x0e, 0x10, 0x00, 0x09, 0x0b, 0x00, 0x68, 0x00, 0x00, 0x40, 0x04, 0x00, 0x28, 0x10, 0x00, 0xd0,
+    0x30, 0x04, 0x00, 0x88, 0x05, 0x00, 0x00, 0x00, 0x16, 0x04, 0x00, 0xd0, 0x0f, 0xb1, 0x00, 0x30,
+    0x04, 0x00, 0x74, 0x27, 0x00, 0x4c, 0x12, 0x04, 0x00, 0x38, 0xcd, 0x00, 0x08, 0x01, 0x00, 0x23,
+    0x11, 0x04, 0xa9, 0x00, 0x03, 0x01, 0x00, 0x4f, 0x90, 0x00, 0x00, 0x30, 0x2f, 0x00, 0x08, 0x40,
+    0x2e, 0x74, 0x65, 0x78, 0x58, 0x00, 0x10, 0xdf, 0x05, 0x00, 0x00, 0x91, 0x00, 0x13, 0x76, 0x15,
+    0x02, 0x07, 0x01, 0x00, 0xf1, 0x00, 0x20, 0x00, 0x00, 0x68, 0x2e, 0x72, 0x64, 0x61, 0x74, 0x61,
+    0x00, 0x00, 0x84, 0x8e, 0x03, 0x54, 0x00, 0x6a, 0x00, 0x90, 0x03, 0x00, 0x00, 0x7a, 0x28, 0x00,
+    0x52, 0x40, 0x00, 0x00, 0x48, 0x2e, 0x27, 0x00, 0x20, 0x00, 0x88, 0x3f, 0x01, 0x21, 0x20, 0x04,
+    0x2c, 0x01, 0x2a, 0x00, 0x0a, 0x51, 0x00, 0x62, 0x40, 0x00, 0x00, 0xc8, 0x2e, 0x70, 0x29, 0x00,
+    0x01, 0xe4, 0x00, 0x9d, 0x30, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x00, 0x50,
+    0x48, 0x49, 0x4e, 0x49, 0x54, 0x0c, 0x00, 0x11, 0xca, 0x11, 0x00, 0x03, 0x50, 0x00, 0x1a, 0x12,
+    0x28, 0x00, 0xb1, 0x20, 0x00, 0x00, 0x62, 0x2e, 0x72, 0x65, 0x6c, 0x6f, 0x63, 0x00, 0x24, 0x01,
+    0x00, 0x2c, 0x01, 0x01, 0x28, 0x00, 0x1d, 0x14, 0x50, 0x00, 0x1a, 0x42, 0xb2, 0x00, 0x0f, 0x01,
+    0x00, 0xe7, 0xf0, 0x0e, 0x80, 0x7a, 0x08, 0x0f, 0x4c, 0x8b, 0xc9, 0x72, 0x06, 0xb8, 0x02, 0x00,
+    0x20, 0x80, 0xc3, 0x48, 0x83, 0x79, 0x18, 0x00, 0x76, 0x1a, 0x48, 0x8b, 0x41, 0x10, 0x8a, 0x08,
+    0xb8, 0x0a, 0x02, 0xf0, 0x02, 0x41, 0x88, 0x08, 0x49, 0xff, 0x41, 0x10, 0xfe, 0x42, 0x08, 0x49,
+    0xff, 0x49, 0x18, 0xc3, 0xb8, 0x00, 0x27, 0x00, 0xf1, 0x10, 0xcc, 0xcc, 0x48, 0x89, 0x5c, 0x24,
+    0x08, 0x4d, 0x8b, 0xd8, 0x45, 0x0f, 0xb6, 0xd1, 0x44, 0x0f, 0xb6, 0x42, 0x08, 0x48, 0x8b, 0xda,
+    0x45, 0x03, 0xd0, 0x41, 0x83, 0xfa, 0x0f, 0x76, 0x07, 0x4c, 0x00, 0xf1, 0x26, 0xeb, 0x43, 0x41,
+    0x0f, 0xb6, 0xd1, 0x48, 0x39, 0x51, 0x18, 0x72, 0x34, 0x45, 0x02, 0xc1, 0x44, 0x88, 0x43, 0x08,
+    0x44, 0x8b, 0xc2, 0x4c, 0x8b, 0x49, 0x10, 0x48, 0x85, 0xd2, 0x74, 0x12, 0x41, 0x8a, 0x01, 0x49,
+    0xff, 0xc1, 0x41, 0x88, 0x03, 0x49, 0xff, 0xc3, 0x49, 0x83, 0xe8, 0x01, 0x75, 0xee, 0x48, 0x01,
+    0x51, 0x10, 0x73, 0x00, 0x61, 0x48, 0x29, 0x51, 0x18, 0xeb, 0x05, 0x6a, 0x00, 0xf2, 0x04, 0x48,
+    0x8b, 0x5c, 0x24, 0x08, 0xc3, 0xcc, 0xcc, 0xcc, 0x83, 0x3a, 0x05, 0x4c, 0x8b, 0xc9, 0x75, 0x06,
+    0xb8, 0x01, 0xa7, 0x00, 0xf2, 0x04, 0x4a, 0x20, 0x08, 0x41, 0xb2, 0x01, 0x41, 0x8a, 0x40, 0x01,
+    0xc0, 0xe8, 0x07, 0x88, 0x82, 0xf0, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x75, 0x06, 0x41, 0x22, 0xc2,
+    0x88, 0x82, 0xf1, 0x10, 0x00, 0x11, 0x05, 0x10, 0x00, 0x13, 0xf2, 0x10, 0x00, 0xf1, 0x00, 0x24,
+    0x1f, 0x88, 0x82, 0xf3, 0x00, 0x00, 0x00, 0x2c, 0x08, 0x3c, 0x02, 0x0f, 0x87, 0x91, 0x16, 0x00,
+    0x82, 0x48, 0x02, 0xc0, 0xe9, 0x07, 0x88, 0x8a, 0xf4, 0x23, 0x00, 0x95, 0x02, 0xc0, 0xe8, 0x03,
+    0x24, 0x0f, 0x88, 0x82, 0xf5, 0x0f, 0x00, 0x11, 0x02, 0x42, 0x00, 0x13, 0xf6, 0x10, 0x00, 0x50,
+    0x24, 0x03, 0x88, 0x82, 0xf7, 0x0c, 0x00, 0x41, 0x88, 0x49, 0x0a, 0x8a, 0x78, 0x00, 0xa1, 0xf6,
+    0xd0, 0x41, 0x22, 0xc2, 0x41, 0x88, 0x41, 0x0b, 0x8a, 0x77, 0x00, 0x04, 0x0f, 0x00, 0x21, 0x0c,
+    0x8a, 0x76, 0x00, 0x04, 0x0f, 0x00, 0x22, 0x0d, 0x8a, 0x43, 0x00, 0x35, 0x88, 0x41, 0x0e, 0x0a,
+    0x00, 0x21, 0x0f, 0x8a, 0x67, 0x00, 0x81, 0xf6, 0xd0, 0x24, 0x0f, 0x41, 0x88, 0x41, 0x12, 0xfd,
+    0x00, 0x31, 0xc3, 0xb8, 0x07, 0xe2, 0x00, 0xf3, 0x05, 0x8b, 0xc4, 0x48, 0x89, 0x58, 0x08, 0x48,
+    0x89, 0x70, 0x10, 0x48, 0x89, 0x78, 0x18, 0x4c, 0x89, 0x70, 0x20, 0x41, 0x57, 0x05, 0x01, 0x11,
+    0x0a, 0x05, 0x01, 0x50, 0xe9, 0x28, 0x01, 0x00, 0x00, 0x09, 0x01, 0x41, 0x10, 0x48, 0x8d, 0xba,
+    0x00, 0x01, 0x60, 0x80, 0x38, 0xc4, 0x48, 0x8d, 0xb2, 0x84, 0x00, 0x50, 0xb1, 0x01, 0x4c, 0x8d,
+    0xb2, 0x7e, 0x00, 0x30, 0x4c, 0x8d, 0x9a, 0xef, 0x00, 0x30, 0x48, 0x8d, 0x9a, 0xdf, 0x00, 0x30,
+    0x4c, 0x8d, 0xba, 0x70, 0x00, 0x30, 0x4c, 0x8d, 0x92, 0x81, 0x00, 0x50, 0x74, 0x39, 0xc6, 0x82,
+    0xf9, 0xc6, 0x04, 0x04, 0x46, 0x01, 0x40, 0x07, 0x88, 0x0e, 0x41, 0x03, 0x00, 0x33, 0x0b, 0xc6,
+    0x03, 0x3d, 0x01, 0x10, 0x03, 0x99, 0x00, 0x12, 0x07, 0x0c, 0x00, 0x51, 0x02, 0x22, 0xc1, 0x41,
+    0x88, 0x2c, 0x00, 0x22, 0xeb, 0x55, 0x39, 0x00, 0x15, 0x03, 0x39, 0x00, 0x03, 0x7b, 0x01, 0x43,
+    0x22, 0xc1, 0x88, 0x06, 0x76, 0x01, 0x00, 0x2d, 0x00, 0x01, 0x0c, 0x00, 0x40, 0x24, 0x1f, 0x41,
+    0x88, 0x29, 0x00, 0x10, 0x02, 0x29, 0x00, 0x03, 0x09, 0x00, 0x05, 0x57, 0x00, 0x00, 0x5e, 0x01,
+    0x04, 0x57, 0x00, 0x50, 0x02, 0x24, 0x03, 0x41, 0xb8, 0x5a, 0x01, 0xa1, 0x42, 0x88, 0x04, 0x02,
+    0x41, 0x80, 0x3b, 0x03, 0x76, 0x07, 0x0b, 0x01, 0xc0, 0xeb, 0x43, 0x8a, 0x03, 0x41, 0x88, 0x41,
+    0x0a, 0x8a, 0x07, 0xf6, 0xd0, 0x2c, 0x00, 0x43, 0x41, 0x0b, 0x8a, 0x06, 0x0a, 0x00, 0x25, 0x0c,
+    0x41, 0x0b, 0x00, 0x40, 0x0d, 0x41, 0x8a, 0x02, 0x5c, 0x01, 0x02, 0x07, 0x00, 0x20, 0x0f, 0x41,
+    0x2e, 0x00, 0x07, 0x56, 0x01, 0x00, 0x48, 0x02, 0xf1, 0x03, 0x10, 0x48, 0x8b, 0x74, 0x24, 0x18,
+    0x48, 0x8b, 0x7c, 0x24, 0x20, 0x4c, 0x8b, 0x74, 0x24, 0x28, 0x41, 0x5f, 0xc8, 0x02, 0xa4, 0x7c,
+    0x24, 0x08, 0x44, 0x8b, 0x0a, 0x41, 0x83, 0xf9, 0x05, 0x59, 0x01, 0x13, 0xb8, 0x59, 0x01, 0x3f,
+    0x20, 0x40, 0xb7, 0x62, 0x02, 0x02, 0x39, 0x40, 0x22, 0xc7, 0x62, 0x02, 0x01, 0x10, 0x00, 0x04,
+    0x62, 0x02, 0x31, 0xc0, 0xe8, 0x04, 0x10, 0x00, 0x00, 0x77, 0x01, 0x00, 0x10, 0x00, 0xc0, 0xa8,
+    0x08, 0x0f, 0x85, 0x62, 0x01, 0x00, 0x00, 0x24, 0x07, 0x88, 0x82, 0x84, 0x01, 0xb0, 0x0f, 0x84,
+    0x4d, 0x01, 0x00, 0x00, 0x3c, 0x04, 0x0f, 0x84, 0x45, 0x08, 0x00, 0xf6, 0x03, 0x07, 0x0f, 0x84,
+    0x3d, 0x01, 0x00, 0x00, 0x45, 0x8a, 0x58, 0x02, 0x41, 0xc0, 0xeb, 0x07, 0x44, 0x88, 0x9a, 0x79,
+    0x02, 0x01, 0x88, 0x02, 0x0c, 0x78, 0x02, 0xc2, 0x45, 0x8a, 0x50, 0x03, 0x41, 0xc0, 0xea, 0x07,
+    0x44, 0x88, 0x92, 0xf8, 0x1b, 0x00, 0x14, 0x03, 0x93, 0x00, 0x00, 0x94, 0x01, 0x02, 0x10, 0x00,
+    0x02, 0x93, 0x00, 0x15, 0xfa, 0x10, 0x00, 0x02, 0x93, 0x00, 0x15, 0xfb, 0x10, 0x00, 0x11, 0x03,
+    0x10, 0x00, 0xc3, 0xfc, 0x00, 0x00, 0x00, 0x75, 0x09, 0x45, 0x85, 0xc9, 0x0f, 0x85, 0xc0, 0x1b,
+    0x00, 0x00, 0xa6, 0x00, 0x10, 0xfd, 0x66, 0x00, 0xa0, 0x84, 0xd2, 0x74, 0x0e, 0x84, 0xc0, 0x75,
+    0x0a, 0xb8, 0x0a, 0x12, 0x01, 0x75, 0xa6, 0x00, 0x00, 0x00, 0x44, 0x88, 0x59, 0xf1, 0x02, 0x00,
+    0x3f, 0x00, 0x06, 0xf0, 0x02, 0x01, 0x0e, 0x00, 0x05, 0xef, 0x02, 0x01, 0x0e, 0x00, 0xf1, 0x03,
+    0x0d, 0x45, 0x8a, 0x48, 0x03, 0x41, 0xc0, 0xe9, 0x05, 0x41, 0x80, 0xe1, 0x03, 0x44, 0x88, 0x49,
+    0x0f, 0x8a, 0x11, 0x01, 0x03, 0x1e, 0x00, 0x21, 0x10, 0x8a, 0x7c, 0x00, 0x03, 0x0e, 0x00, 0x12,
+    0x11, 0x10, 0x03, 0x00, 0xb0, 0x01, 0x41, 0x88, 0x41, 0x12, 0x8a, 0x80, 0x00, 0x50, 0x88, 0x41,
+    0x13, 0x80, 0xba, 0x24, 0x00, 0xa0, 0x00, 0x75, 0x05, 0x83, 0x3a, 0x00, 0x75, 0x23, 0x80, 0xba,
+    0xbe, 0x00, 0x00, 0x9f, 0x08, 0xf2, 0x03, 0x10, 0x00, 0x75, 0x1a, 0x41, 0x80, 0xf9, 0x03, 0xb9,
+    0x08, 0x00, 0x20, 0x80, 0x0f, 0x44, 0xc1, 0xeb, 0x0c, 0x27, 0x02, 0x20, 0x05, 0xb8, 0x11, 0x00,
+    0x00, 0xdf, 0x01, 0x00, 0x31, 0x04, 0x77, 0x83, 0x3a, 0x00, 0x4c, 0x8b, 0xc9, 0x74, 0x30, 0x04,
+    0x13, 0x40, 0x30, 0x04, 0x3f, 0x41, 0xb3, 0x0f, 0x33, 0x04, 0x1a, 0x31, 0xc0, 0xe8, 0x04, 0x10,
+    0x00, 0x04, 0xd1, 0x01, 0x32, 0x41, 0x22, 0xc3, 0xca, 0x01, 0x42, 0x3c, 0x03, 0x76, 0x06, 0xad,
+    0x03, 0x05, 0x44, 0x04, 0x07, 0xbc, 0x01, 0x01, 0x27, 0x00, 0x0d, 0x35, 0x04, 0x01, 0x7e, 0x01,
+    0x36, 0x07, 0x88, 0x82, 0xbb, 0x01, 0x10, 0x04, 0x73, 0x01, 0x06, 0xba, 0x01, 0x11, 0x03, 0x6c,
+    0x00, 0x04, 0xba, 0x01, 0x00, 0x1c, 0x00, 0x01, 0xb6, 0x01, 0x0f, 0x6d, 0x04, 0x1f, 0x02, 0x6f,
+    0x01, 0x02, 0x0f, 0x00, 0x21, 0x10, 0x8a, 0x52, 0x00, 0x60, 0xf6, 0xd0, 0x41, 0xc6, 0x41, 0x0f,
+    0xcf, 0x04, 0x17, 0x41, 0x76, 0x01, 0x30, 0x41, 0x22, 0xc3, 0x27, 0x03, 0x13, 0x8a, 0x69, 0x00,
+    0x22, 0x41, 0x13, 0x87, 0x04, 0xf0, 0x04, 0xcc, 0xcc, 0xcc, 0x40, 0x53, 0x48, 0x83, 0xec, 0x20,
+    0x8a, 0x42, 0x08, 0x41, 0xb1, 0x08, 0x44, 0x88, 0x82, 0x10, 0x17, 0x03, 0x50, 0x8b, 0xda, 0x88,
+    0x82, 0x11, 0xb1, 0x02, 0xf0, 0x19, 0x3a, 0xc1, 0x74, 0x59, 0x41, 0x80, 0xf8, 0x10, 0x74, 0x33,
+    0x41, 0x80, 0xf8, 0x20, 0x74, 0x15, 0x4c, 0x8d, 0x44, 0x24, 0x38, 0xe8, 0xe5, 0xf9, 0xff, 0xff,
+    0x85, 0xc0, 0x78, 0x5f, 0x48, 0x8b, 0x44, 0x24, 0x38, 0xeb, 0x2f, 0x41, 0xb1, 0x04, 0x18, 0x00,
+    0x32, 0x40, 0xe8, 0xcd, 0x18, 0x00, 0xb2, 0x47, 0x48, 0x63, 0x44, 0x24, 0x40, 0xeb, 0x17, 0x41,
+    0xb1, 0x02, 0x18, 0x00, 0x12, 0xb5, 0x18, 0x00, 0xf2, 0x01, 0x2f, 0x48, 0x0f, 0xbf, 0x44, 0x24,
+    0x40, 0x48, 0x89, 0x83, 0x08, 0x01, 0x00, 0x00, 0xeb, 0x1b, 0x1d, 0x00, 0x12, 0x60, 0x1d, 0x00,
+    0x41, 0x12, 0x48, 0x0f, 0xbe, 0x1d, 0x00, 0x10, 0x82, 0x1d, 0x00, 0x02, 0xcf, 0x03, 0x51, 0x83,
+    0xc4, 0x20, 0x5b, 0xc3, 0x84, 0x06, 0x60, 0x48, 0x89, 0x74, 0x24, 0x18, 0x57, 0xa9, 0x00, 0xf0,
+    0x05, 0x40, 0x8a, 0x74, 0x24, 0x50, 0x48, 0x8b, 0xda, 0x41, 0x0f, 0xb6, 0xf8, 0x4c, 0x8d, 0x04,
+    0x7f, 0x46, 0x88, 0x8c, 0xc2, 0x24, 0x05, 0x80, 0x8a, 0x42, 0x08, 0x42, 0x88, 0x84, 0xc2, 0x29,
+    0x0b, 0x00, 0x30, 0x44, 0x24, 0x58, 0x0c, 0x00, 0x20, 0x19, 0x01, 0x67, 0x04, 0x40, 0xb4, 0xc2,
+    0x18, 0x01, 0x37, 0x05, 0x51, 0xf9, 0x08, 0x0f, 0x84, 0x82, 0x41, 0x05, 0xd2, 0xf9, 0x10, 0x74,
+    0x4d, 0x41, 0x80, 0xf9, 0x20, 0x74, 0x20, 0x41, 0xb1, 0x08, 0xd2, 0x00, 0x11, 0x13, 0x85, 0x00,
+    0x20, 0x0f, 0x88, 0xec, 0x08, 0x01, 0xd6, 0x00, 0x63, 0x48, 0x8d, 0x0c, 0x7f, 0xeb, 0x4c, 0xda,
+    0x00, 0x41, 0x50, 0xe8, 0xf3, 0xf8, 0xa5, 0x00, 0x10, 0x74, 0x17, 0x00, 0x50, 0x40, 0x84, 0xf6,
+    0x74, 0x07, 0xe3, 0x00, 0x40, 0x50, 0xeb, 0x2b, 0x8b, 0x06, 0x00, 0x13, 0x25, 0xe9, 0x00, 0x32,
+    0x50, 0xe8, 0xcc, 0x27, 0x00, 0x11, 0x4d, 0xe9, 0x00, 0x13, 0x50, 0x2d, 0x00, 0x40, 0x75, 0x05,
+    0x0f, 0xb7, 0x0e, 0x00, 0x40, 0x89, 0x84, 0xcb, 0x20, 0xf8, 0x00, 0x12, 0x2a, 0x2c, 0x00, 0x12,
+    0x68, 0x2c, 0x00, 0x11, 0x21, 0xf8, 0x00, 0x07, 0x2c, 0x00, 0x12, 0xb6, 0x2c, 0x00, 0x10, 0xca,
+    0x2c, 0x00, 0x05, 0xd6, 0x04, 0x10, 0x30, 0xd6, 0x04, 0x10, 0x40, 0x11, 0x01, 0x00, 0xcf, 0x04,
+    0x02, 0x98, 0x07, 0x00, 0x14, 0x01, 0xf0, 0x20, 0x10, 0x41, 0x0f, 0xb6, 0x40, 0x0c, 0x4c, 0x8d,
+    0x4a, 0x20, 0x4c, 0x8b, 0xda, 0x4c, 0x8b, 0xd1, 0x48, 0x8d, 0x15, 0x10, 0xe8, 0xff, 0xff, 0xa8,
+    0x60, 0x74, 0x14, 0x8b, 0xc8, 0x48, 0xc1, 0xe9, 0x05, 0x83, 0xe1, 0x03, 0x48, 0x8b, 0x8c, 0xca,
+    0x40, 0x93, 0x00, 0x00, 0x49, 0x09, 0x09, 0x2e, 0x00, 0xe0, 0x0d, 0xa8, 0x03, 0x74, 0x0e, 0x83,
+    0xe0, 0x03, 0x48, 0x8b, 0x84, 0xc2, 0x48, 0x95, 0x17, 0x00, 0x12, 0x01, 0x17, 0x00, 0x73, 0x0c,
+    0x74, 0x12, 0x48, 0xc1, 0xe8, 0x02, 0x1b, 0x00, 0x13, 0xa8, 0x1b, 0x00, 0xf0, 0x2c, 0x8b, 0x4b,
+    0x0c, 0x85, 0xc9, 0x0f, 0x84, 0xa8, 0x00, 0x00, 0x00, 0x83, 0xe9, 0x01, 0x74, 0x03, 0x83, 0xe9,
+    0x01, 0x41, 0xf6, 0x40, 0x0d, 0x10, 0x0f, 0x84, 0x06, 0x03, 0x00, 0x00, 0x49, 0x0f, 0xba, 0x29,
+    0x1a, 0x41, 0x0f, 0xb6, 0x42, 0x23, 0x49, 0x8b, 0x09, 0x84, 0xc0, 0x74, 0x67, 0x8b, 0xd0, 0x83,
+    0xea, 0x26, 0x74, 0x50, 0x83, 0xea, 0x08, 0x74, 0x3f, 0x05, 0x00, 0x10, 0x2e, 0x05, 0x00, 0x72,
+    0x1d, 0x83, 0xfa, 0x26, 0x74, 0x0c, 0x49, 0x76, 0x0c, 0x53, 0x04, 0x00, 0x00, 0xeb, 0x3a, 0x0c,
+    0x00, 0x52, 0x02, 0x00, 0x00, 0xeb, 0x2e, 0x0c, 0x00, 0x62, 0x80, 0x00, 0x00, 0x00, 0xeb, 0x22,
+    0x0c, 0x00, 0x00, 0x97, 0x0c, 0x22, 0xeb, 0x16, 0x0c, 0x00, 0x10, 0x20, 0x0c, 0x00, 0x13, 0x0a,
+    0x30, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x49, 0x0b, 0xc8, 0x49, 0x89, 0x09, 0x48, 0xba, 0x0f, 0x00,
+    0xe0, 0xe0, 0x07, 0x00, 0x00, 0x48, 0x85, 0xca, 0x0f, 0x84, 0x7b, 0x02, 0x00, 0x00, 0xbb, 0x08,
+    0x0b, 0x50, 0xe9, 0x67, 0x02, 0x00, 0x00, 0xa0, 0x00, 0x30, 0x20, 0x74, 0x05, 0x9c, 0x00, 0x10,
+    0x08, 0x0c, 0x00, 0x11, 0x40, 0x1b, 0x00, 0x20, 0x74, 0x1b, 0x11, 0x00, 0x80, 0x10, 0x41, 0x80,
+    0x7a, 0x20, 0x00, 0x74, 0x0f, 0x0c, 0x00, 0x10, 0x1b, 0xb9, 0x00, 0xc1, 0x25, 0x41, 0x89, 0x5c,
+    0xc3, 0x74, 0x41, 0x80, 0x78, 0x0d, 0x00, 0x7d, 0x33, 0x00, 0x52, 0x11, 0x41, 0x84, 0x58, 0x0e,
+    0x3e, 0x00, 0xf0, 0x01, 0x12, 0x41, 0xf6, 0x40, 0x0e, 0x02, 0xbe, 0x00, 0x00, 0x08, 0x00, 0x74,
+    0x03, 0x49, 0x09, 0x31, 0x0f, 0x00, 0x12, 0x04, 0x1b, 0x00, 0x10, 0x14, 0x0c, 0x00, 0x20, 0x08,
+    0xba, 0xa0, 0x00, 0x00, 0x1b, 0x00, 0x10, 0x11, 0x0f, 0x00, 0x12, 0x10, 0x1b, 0x00, 0x10, 0x16,
+    0x0c, 0x00, 0x12, 0x40, 0x0c, 0x00, 0x80, 0x17, 0x41, 0x0f, 0xb6, 0x4a, 0x21, 0x81, 0xe9, 0xb7,
+    0x03, 0xf0, 0x0c, 0x74, 0x48, 0x3b, 0xcb, 0x0f, 0x85, 0x89, 0x00, 0x00, 0x00, 0x49, 0x8b, 0x09,
+    0x48, 0x0f, 0xba, 0xe1, 0x11, 0x73, 0x07, 0x48, 0x0f, 0xba, 0xe9, 0x1c, 0xeb, 0x75, 0x0e, 0x00,
+    0x12, 0x12, 0x0e, 0x00, 0x30, 0x1d, 0xeb, 0x67, 0x0e, 0x00, 0x30, 0x16, 0x73, 0x63, 0x07, 0x00,
+    0x32, 0x1b, 0x72, 0x07, 0x4e, 0x00, 0x21, 0x55, 0x48, 0x02, 0x01, 0x00, 0xe8, 0x0a, 0x20, 0xeb,
+    0x43, 0x40, 0x00, 0x31, 0x85, 0xce, 0x74, 0x30, 0x00, 0x89, 0x1e, 0xeb, 0x37, 0x48, 0x85, 0xca,
+    0x74, 0x1a, 0x2e, 0x00, 0x12, 0x0c, 0x2e, 0x00, 0x00, 0xf7, 0x00, 0xb0, 0xeb, 0x15, 0x49, 0x8b,
+    0x02, 0x80, 0x78, 0x0b, 0x00, 0x74, 0x12, 0x23, 0x00, 0x30, 0x14, 0x73, 0x0b, 0x1b, 0x00, 0x21,
+    0x80, 0x48, 0x47, 0x01, 0x00, 0x9e, 0x00, 0x91, 0x26, 0x41, 0x83, 0x7c, 0xcb, 0x74, 0x00, 0x75,
+    0x14, 0x54, 0x01, 0x10, 0xf0, 0xca, 0x0b, 0x90, 0x49, 0x85, 0x11, 0x74, 0x05, 0x41, 0x89, 0x5c,
+    0xcb, 0x18, 0x01, 0x40, 0x0e, 0x00, 0x7d, 0x3c, 0xcb, 0x00, 0xf0, 0x05, 0x18, 0x41, 0x8a, 0x4a,
+    0x22, 0x49, 0x8b, 0x01, 0x80, 0xf9, 0x2e, 0x74, 0x11, 0x80, 0xf9, 0x3e, 0x75, 0x26, 0x48, 0xb9,
+    0x65, 0x00, 0x11, 0x08, 0xa1, 0x01, 0x02, 0x0c, 0x00, 0x00, 0x82, 0x0b, 0x50, 0x48, 0x0b, 0xc1,
+    0x49, 0x89, 0x53, 0x02, 0x22, 0x42, 0x27, 0x5b, 0x01, 0x60, 0xf6, 0x40, 0x0e, 0x20, 0x48, 0xbe,
+    0x1f, 0x00, 0x00, 0x72, 0x0c, 0x20, 0x74, 0x22, 0x4d, 0x00, 0x11, 0x19, 0x95, 0x00, 0xf4, 0x04,
+    0x0c, 0x00, 0x74, 0x14, 0x41, 0x80, 0x7a, 0x2c, 0x00, 0x7c, 0x0d, 0x49, 0x09, 0x31, 0x49, 0x0f,
+    0xbe, 0x42, 0x2c, 0x33, 0x00, 0x00, 0x61, 0x02, 0x11, 0xa5, 0xae, 0x03, 0x61, 0x78, 0x0e, 0x00,
+    0x0f, 0x8c, 0x9a, 0x36, 0x01, 0xc0, 0x11, 0x48, 0x0f, 0xba, 0xea, 0x1a, 0x49, 0x89, 0x11, 0x48,
+    0x8b, 0xc2, 0xbb, 0x00, 0xc0, 0x23, 0x84, 0xc9, 0x74, 0x6a, 0x48, 0x85, 0xd6, 0x75, 0x65, 0x83,
+    0xe9, 0x75, 0x02, 0x10, 0xe9, 0x75, 0x02, 0x10, 0xe9, 0x75, 0x02, 0x10, 0xe9, 0x75, 0x02, 0x1f,
+    0xf9, 0x75, 0x02, 0x38, 0x48, 0xc0, 0x49, 0x89, 0x01, 0x75, 0x02, 0x30, 0xc2, 0x74, 0x0a, 0xe3,
+    0x00, 0x11, 0x2a, 0xb0, 0x00, 0x01, 0xc0, 0x0a, 0x00, 0xa2, 0x03, 0x10, 0x10, 0x6c, 0x08, 0x04,
+    0xd4, 0x09, 0xe0, 0x68, 0x10, 0x48, 0x89, 0x70, 0x18, 0x48, 0x89, 0x78, 0x20, 0x4c, 0x8b, 0xd1,
+    0xbd, 0xba, 0x01, 0xf1, 0x00, 0x8b, 0x4a, 0x0c, 0x49, 0x8b, 0xf8, 0x4c, 0x8b, 0xca, 0x2b, 0xcd,
+    0x0f, 0x84, 0x21, 0x06, 0x52, 0x03, 0x43, 0x0f, 0x84, 0xe1, 0x05, 0x09, 0x00, 0xb0, 0x46, 0x03,
+    0x00, 0x00, 0x83, 0xf9, 0x01, 0x0f, 0x85, 0x1f, 0x06, 0xfb, 0x03, 0xf0, 0x1f, 0x02, 0x00, 0x00,
+    0x8d, 0x75, 0x09, 0x66, 0x89, 0x42, 0x38, 0x8d, 0x5d, 0x02, 0x45, 0x8a, 0x40, 0x0f, 0x44, 0x8d,
+    0x5d, 0x01, 0x41, 0xc0, 0xe8, 0x07, 0x45, 0x84, 0xc0, 0x75, 0x3c, 0xf6, 0x47, 0x10, 0x07, 0x74,
+    0x36, 0x88, 0x4a, 0x44, 0x0f, 0xb6, 0x4f, 0x10, 0x83, 0xe1, 0x07, 0x9d, 0x03, 0x10, 0x20, 0x05,
+    0x00, 0xf0, 0x02, 0x16, 0x44, 0x8a, 0xc5, 0x83, 0xf9, 0x01, 0x74, 0x05, 0x89, 0x72, 0x48, 0xeb,
+    0x15, 0xc7, 0x42, 0x48, 0xb5, 0x0e, 0xf0, 0x04, 0xeb, 0x0c, 0x89, 0x5a, 0x48, 0xeb, 0x04, 0x44,
+    0x89, 0x5a, 0x48, 0x41, 0xb0, 0x01, 0x0f, 0xb6, 0x4f, 0x0f, 0xb8, 0x8d, 0x01, 0x70, 0x83, 0xe1,
+    0x1f, 0x3b, 0xc8, 0x0f, 0x87, 0xf6, 0x04, 0xc0, 0x74, 0x6b, 0x3b, 0xce, 0x77, 0x4b, 0x74, 0x1c,
+    0x2b, 0xcb, 0x74, 0x3b, 0x47, 0x00, 0x10, 0x36, 0x05, 0x00, 0x10, 0x31, 0x05, 0x00, 0x20, 0x2c,
+    0x41, 0xb8, 0x02, 0x00, 0xb0, 0x07, 0x31, 0x0f, 0xb6, 0x8a, 0xc4, 0x06, 0xf0, 0x09, 0x0f, 0xb6,
+    0xc0, 0x4c, 0x8d, 0x05, 0xa7, 0xe3, 0xff, 0xff, 0x48, 0x8d, 0x14, 0xc1, 0x42, 0x8a, 0x84, 0x02,
+    0x10, 0x94, 0x00, 0x00, 0xe9, 0xd6, 0x1c, 0x00, 0x61, 0xc6, 0x42, 0x1d, 0x40, 0xe9, 0xd0, 0x2e,
+    0x04, 0x31, 0x0c, 0x74, 0xce, 0xd8, 0x00, 0x13, 0x9d, 0x3c, 0x04, 0x11, 0x09, 0xdd, 0x00, 0x1d,
+    0xb4, 0x49, 0x00, 0x17, 0x5e, 0x49, 0x00, 0x61, 0x80, 0x92, 0x00, 0x00, 0xe9, 0x8d, 0x31, 0x00,
+    0x30, 0x11, 0x74, 0x67, 0x36, 0x00, 0x10, 0x8a, 0x05, 0x00, 0x10, 0x5d, 0x05, 0x00, 0x10, 0xc9,
+    0x05, 0x00, 0x10, 0x53, 0x05, 0x00, 0x10, 0x2e, 0x05, 0x00, 0x10, 0x0a, 0x05, 0x00, 0x6a, 0x24,
+    0x83, 0xf9, 0x01, 0x75, 0x64, 0x50, 0x00, 0x10, 0x0e, 0x50, 0x00, 0xca, 0x03, 0xc8, 0x42, 0x8a,
+    0x84, 0x01, 0xe0, 0x93, 0x00, 0x00, 0xeb, 0x41, 0x1f, 0x00, 0x26, 0xef, 0xe2, 0x6f, 0x00, 0x97,
+    0xc8, 0x95, 0x00, 0x00, 0xeb, 0x21, 0x0f, 0xb6, 0x92, 0x20, 0x00, 0x11, 0xcf, 0x20, 0x00, 0x50,
+    0x0c, 0x40, 0x48, 0x03, 0xd1, 0x23, 0x00, 0x20, 0xd0, 0x93, 0x31, 0x07, 0x50, 0x42, 0x1d, 0x8a,
+    0x47, 0x0f, 0xe6, 0x0a, 0x20, 0x42, 0x1c, 0x3e, 0x01, 0x91, 0x83, 0xe1, 0x1f, 0x83, 0xf9, 0x0e,
+    0x0f, 0x87, 0xc6, 0xec, 0x09, 0x00, 0x34, 0x07, 0x00, 0xd3, 0x01, 0x00, 0x48, 0x01, 0x01, 0xf2,
+    0x00, 0x11, 0x98, 0x09, 0x00, 0x30, 0x05, 0x74, 0x6f, 0xa3, 0x00, 0x10, 0x6a, 0x05, 0x00, 0x10,
+    0x3a, 0x05, 0x00, 0x10, 0x35, 0x05, 0x00, 0x11, 0x30, 0x06, 0x01, 0x00, 0xb3, 0x06, 0x40, 0x41,
+    0x0f, 0xb6, 0x89, 0x78, 0x00, 0x01, 0x33, 0x00, 0x00, 0x4a, 0x00, 0x01, 0x1a, 0x00, 0x10, 0x0e,
+    0x1a, 0x00, 0x21, 0xc7, 0x41, 0xb7, 0x01, 0x2c, 0xe9, 0x01, 0x27, 0x00, 0x14, 0xec, 0x09, 0x00,
+    0x14, 0xdd, 0x09, 0x00, 0x12, 0x83, 0x09, 0x00, 0x22, 0xe9, 0x9f, 0xc2, 0x00, 0x10, 0x81, 0x2b,
+    0x00, 0x87, 0xff, 0xc0, 0x41, 0x89, 0x41, 0x50, 0xe9, 0xc3, 0x13, 0x00, 0x31, 0x41, 0x23, 0xc3,
+    0x16, 0x00, 0x40, 0x4c, 0x41, 0x38, 0x99, 0x10, 0x00, 0x21, 0x0f, 0x82, 0x5f, 0x03, 0x61, 0xc6,
+    0x41, 0x58, 0x01, 0xe9, 0x9b, 0x43, 0x00, 0x30, 0x0f, 0x74, 0x4b, 0xa0, 0x00, 0x11, 0x46, 0x56,
+    0x00, 0x40, 0x60, 0xff, 0xff, 0xff, 0x0e, 0x00, 0xd4, 0x18, 0x2b, 0xcd, 0x74, 0x08, 0x2b, 0xcd,
+    0x74, 0x10, 0x3b, 0xcd, 0x75, 0x77, 0x8a, 0x00, 0x44, 0x2b, 0xcb, 0xeb, 0x34, 0x0c, 0x00, 0xc1,
+    0x41, 0x2b, 0xcb, 0xe9, 0x77, 0xff, 0xff, 0xff, 0x41, 0xc7, 0x41, 0x54, 0x70, 0x04, 0x77, 0x51,
+    0x45, 0x89, 0x59, 0x48, 0xeb, 0x4b, 0xb6, 0x00, 0x02, 0xfd, 0x00, 0x50, 0x2f, 0x2b, 0xcd, 0x74,
+    0x25, 0x09, 0x00, 0x10, 0x1a, 0x05, 0x00, 0x10, 0x0b, 0xb8, 0x01, 0x70, 0x26, 0x41, 0x89, 0x59,
+    0x54, 0xeb, 0x20, 0x3b, 0x00, 0x00, 0x19, 0x10, 0x90, 0xeb, 0x16, 0x41, 0x89, 0x69, 0x54, 0xeb,
+    0x10, 0x45, 0x16, 0x00, 0xf0, 0x00, 0x0a, 0x41, 0x89, 0x71, 0x48, 0xeb, 0x04, 0x41, 0x89, 0x59,
+    0x48, 0x45, 0x38, 0x99, 0xff, 0xa2, 0x02, 0x40, 0x0f, 0x41, 0x80, 0xb9, 0x53, 0x09, 0x70, 0x00,
+    0x74, 0x05, 0x41, 0xc6, 0x41, 0x59, 0x64, 0x04, 0x10, 0x81, 0xcf, 0x08, 0x11, 0x05, 0x68, 0x09,
+    0x90, 0x89, 0x69, 0x3c, 0x41, 0x89, 0x41, 0x40, 0xe9, 0xe2, 0x02, 0x06, 0x50, 0x8a, 0x50, 0x0f,
+    0x41, 0xbb, 0xcb, 0x04, 0xf0, 0x01, 0x41, 0x22, 0xd3, 0x4c, 0x8d, 0x05, 0xfc, 0xe0, 0xff, 0xff,
+    0x8d, 0x42, 0xff, 0x0f, 0xb6, 0xc8, 0xb5, 0x03, 0xf1, 0x0c, 0x0f, 0x0f, 0x44, 0xc8, 0x0f, 0xb6,
+    0xd9, 0x41, 0x0f, 0xb7, 0x84, 0x58, 0xac, 0x92, 0x00, 0x00, 0x66, 0x41, 0x89, 0x41, 0x38, 0x8a,
+    0x47, 0x0f, 0xc0, 0xe8, 0x02, 0xe2, 0x01, 0x90, 0x1a, 0xf6, 0x47, 0x0f, 0x7c, 0x0f, 0x84, 0xa5,
+    0x01, 0xa9, 0x02, 0xb0, 0x47, 0x10, 0x83, 0xe0, 0x07, 0x42, 0x8a, 0x94, 0x00, 0x9c, 0x95, 0x08,
+    0x02, 0x20, 0x52, 0x1b, 0xff, 0x01, 0x31, 0xc1, 0xe9, 0x02, 0x02, 0x02, 0x40, 0x09, 0x0f, 0x87,
+    0x07, 0x26, 0x00, 0x24, 0x84, 0xe4, 0x8e, 0x01, 0x13, 0xa2, 0xf3, 0x00, 0x10, 0x6e, 0x05, 0x00,
+    0x10, 0x5c, 0x05, 0x00, 0x10, 0x43, 0x05, 0x00, 0x11, 0x2b, 0x1d, 0x00, 0x00, 0xf5, 0x01, 0x00,
+    0x9b, 0x03, 0x10, 0x30, 0xbd, 0x04, 0xf0, 0x15, 0x0a, 0x85, 0xc9, 0x41, 0x8d, 0x4b, 0x1a, 0x74,
+    0x05, 0x8d, 0x41, 0xf3, 0xeb, 0x02, 0xb0, 0x08, 0x41, 0x88, 0x04, 0x0a, 0xe9, 0x31, 0x01, 0x00,
+    0x00, 0xc0, 0xea, 0x05, 0x0f, 0xb6, 0xc2, 0x42, 0x8a, 0x84, 0x00, 0x28, 0x56, 0x03, 0x18, 0x1a,
+    0x87, 0x00, 0x80, 0x84, 0x00, 0x74, 0x93, 0x00, 0x00, 0xe9, 0x06, 0xda, 0x08, 0x40, 0x8a, 0x84,
+    0x03, 0xa4, 0x2e, 0x03, 0x03, 0xbb, 0x02, 0x10, 0x89, 0x0b, 0x01, 0x02, 0x3c, 0x00, 0xb0, 0x48,
+    0x8d, 0x14, 0x48, 0x48, 0x8d, 0x0c, 0x53, 0x48, 0x03, 0xca, 0x05, 0x03, 0x13, 0xe8, 0xc2, 0x02,
+    0x90, 0x41, 0x8b, 0x84, 0x88, 0x50, 0x92, 0x00, 0x00, 0xeb, 0x80, 0x00, 0x01, 0x3a, 0x01, 0x30,
+    0xc0, 0xea, 0x05, 0xea, 0x02, 0x00, 0x33, 0x00, 0x63, 0x03, 0xc8, 0x48, 0x8d, 0x14, 0x4b, 0xf4,
+    0x02, 0x16, 0xf8, 0x32, 0x00, 0x20, 0x90, 0x80, 0x0c, 0x00, 0x52, 0x89, 0x41, 0x48, 0xe9, 0x95,
+    0x68, 0x00, 0x00, 0xb9, 0x00, 0x20, 0xb9, 0x1d, 0x86, 0x01, 0x51, 0x04, 0xb0, 0x20, 0xeb, 0x05,
+    0x48, 0x04, 0xb0, 0x42, 0x88, 0x04, 0x11, 0xeb, 0x78, 0x83, 0xe9, 0x0a, 0x74, 0x6d, 0xee, 0x00,
+    0x10, 0x5e, 0x05, 0x00, 0x10, 0x4f, 0x05, 0x00, 0x10, 0x40, 0x05, 0x00, 0x10, 0x34, 0xf4, 0x00,
+    0x14, 0x25, 0x74, 0x00, 0x71, 0x48, 0x8d, 0x14, 0x43, 0x48, 0x03, 0xd0, 0x7e, 0x03, 0x07, 0x67,
+    0x00, 0x10, 0x68, 0x8a, 0x03, 0x10, 0x97, 0xd5, 0x00, 0x10, 0xa8, 0xa3, 0x00, 0x11, 0x27, 0x58,
+    0x00, 0x20, 0xeb, 0x20, 0x11, 0x00, 0x00, 0x07, 0x01, 0x20, 0xeb, 0x16, 0x0a, 0x00, 0x10, 0xdc,
+    0xcf, 0x03, 0x10, 0x0c, 0x0a, 0x00, 0x10, 0x40, 0x2f, 0x00, 0x30, 0x02, 0xb0, 0x20, 0x3f, 0x00,
+    0xf2, 0x04, 0xba, 0x3c, 0x00, 0x00, 0x00, 0x84, 0x57, 0x11, 0x74, 0x1c, 0x41, 0xc6, 0x41, 0x44,
+    0x01, 0x0f, 0xb6, 0x47, 0x11, 0xc9, 0x08, 0x72, 0x0f, 0x41, 0x8b, 0x84, 0x80, 0xd0, 0x92, 0xc0,
+    0x00, 0x31, 0x41, 0x80, 0xb9, 0x5d, 0x0c, 0x20, 0x74, 0x25, 0x32, 0x05, 0xa0, 0xc1, 0xe9, 0x03,
+    0x41, 0x23, 0xcb, 0x2b, 0xcd, 0x74, 0x07, 0x9d, 0x00, 0x20, 0x0d, 0xeb, 0x49, 0x09, 0x23, 0x42,
+    0x0f, 0x22, 0x03, 0x00, 0x15, 0x03, 0x30, 0x4d, 0x8d, 0x81, 0xf3, 0x04, 0x34, 0x41, 0x0f, 0xb6,
+    0x60, 0x02, 0xb0, 0x41, 0x40, 0x0f, 0xb6, 0x4f, 0x11, 0x41, 0x23, 0xcb, 0x74, 0x13, 0x34, 0x00,
+    0x51, 0x19, 0x45, 0x0f, 0xb6, 0x99, 0x1a, 0x00, 0x54, 0x83, 0xc3, 0x04, 0xeb, 0x0b, 0x0e, 0x00,
+    0xf1, 0x02, 0x44, 0x03, 0xdd, 0x46, 0x89, 0x1c, 0x0a, 0x41, 0x80, 0x38, 0x00, 0x75, 0x5a, 0x42,
+    0xc7, 0x04, 0x0a, 0x15, 0x03, 0x11, 0x50, 0x5f, 0x00, 0x70, 0x4c, 0x8d, 0x05, 0x72, 0xde, 0xff,
+    0xff, 0x79, 0x02, 0x50, 0x40, 0x70, 0x93, 0x00, 0x00, 0xdc, 0x05, 0x81, 0xf6, 0x47, 0x0f, 0x07,
+    0x74, 0x31, 0xc6, 0x42, 0xb8, 0x00, 0x40, 0x0f, 0x83, 0xe0, 0x07, 0xb4, 0x00, 0x94, 0x08, 0x93,
+    0x00, 0x00, 0x89, 0x42, 0x48, 0xeb, 0x19, 0x37, 0x00, 0x1c, 0x3b, 0x37, 0x00, 0x03, 0x73, 0x06,
+    0x18, 0x6c, 0xf0, 0x0e, 0x16, 0xc3, 0x7c, 0x06, 0xf1, 0x09, 0x78, 0x10, 0x4c, 0x89, 0x70, 0x18,
+    0x4c, 0x89, 0x78, 0x20, 0x45, 0x32, 0xdb, 0x4c, 0x8b, 0xca, 0x45, 0x32, 0xd2, 0x4c, 0x8b, 0xc1,
+    0x49, 0xbf, 0xd1, 0x06, 0x41, 0x10, 0x00, 0x00, 0x49, 0x90, 0x07, 0x00, 0xbc, 0x07, 0x80, 0x41,
+    0x80, 0x79, 0x08, 0x0f, 0x0f, 0x83, 0xe3, 0xe6, 0x06, 0x70, 0x83, 0x78, 0x18, 0x00, 0x0f, 0x86,
+    0xd1, 0x0b, 0x00, 0xf1, 0x26, 0x8b, 0x40, 0x10, 0x0f, 0xb6, 0x08, 0x8b, 0xd1, 0x83, 0xf9, 0x65,
+    0x77, 0x50, 0x74, 0x0f, 0x8d, 0x41, 0xda, 0xa9, 0xe7, 0xff, 0xff, 0xff, 0x74, 0x1f, 0x83, 0xf9,
+    0x64, 0x75, 0x5b, 0x41, 0x88, 0x50, 0x22, 0x45, 0x88, 0x50, 0x27, 0x41, 0x88, 0x50, 0x23, 0x45,
+    0x88, 0x50, 0x2a, 0x41, 0xc6, 0x40, 0x2c, 0xff, 0xe9, 0xa4, 0xa5, 0x07, 0xf4, 0x0a, 0x00, 0x83,
+    0x38, 0x00, 0x75, 0xde, 0x80, 0xfa, 0x3e, 0x75, 0x0e, 0x41, 0x8a, 0x40, 0x23, 0x2c, 0x64, 0x3c,
+    0x01, 0x76, 0x04, 0x45, 0x88, 0x50, 0x2c, 0x35, 0x00, 0x71, 0xeb, 0x7f, 0x83, 0xe9, 0x66, 0x74,
+    0x62, 0xcd, 0x05, 0x20, 0x81, 0xe9, 0x10, 0x09, 0x00, 0x27, 0x02, 0x30, 0x02, 0x74, 0x29, 0x56,
+    0x01, 0x12, 0x24, 0x41, 0x00, 0x20, 0x0f, 0x85, 0x04, 0x06, 0x90, 0x8a, 0xc2, 0x24, 0xf0, 0x3c,
+    0x40, 0x0f, 0x85, 0x81, 0x58, 0x01, 0x50, 0x8a, 0xda, 0x45, 0x88, 0x91, 0x92, 0x0d, 0xf0, 0x0f,
+    0xeb, 0x3f, 0x41, 0x88, 0x50, 0x21, 0x41, 0x88, 0x50, 0x24, 0x45, 0x88, 0x50, 0x26, 0x45, 0x88,
+    0x50, 0x2b, 0xeb, 0x2d, 0x41, 0xc6, 0x40, 0x20, 0x01, 0x45, 0x88, 0x50, 0x25, 0xeb, 0x63, 0x00,
+    0xf0, 0x08, 0x29, 0x4d, 0x09, 0x79, 0x20, 0xeb, 0x18, 0x41, 0x80, 0x78, 0x24, 0x00, 0x45, 0x88,
+    0x50, 0x28, 0x75, 0x09, 0x41, 0xc6, 0x40, 0x24, 0x66, 0x2b, 0x00, 0xf1, 0x05, 0x4d, 0x09, 0x71,
+    0x20, 0x45, 0x84, 0xdb, 0x74, 0x0f, 0x44, 0x3a, 0xda, 0x74, 0x0a, 0x45, 0x32, 0xdb, 0x45, 0x88,
+    0x99, 0x14, 0x12, 0xf0, 0x18, 0x0f, 0xb6, 0x41, 0x70, 0x41, 0x88, 0x54, 0xc1, 0x78, 0x41, 0xfe,
+    0x41, 0x70, 0x41, 0xfe, 0x41, 0x08, 0x49, 0xff, 0x40, 0x10, 0x49, 0xff, 0x48, 0x18, 0x41, 0xfe,
+    0xc2, 0xe9, 0xd7, 0xfe, 0xff, 0xff, 0x4d, 0x85, 0x71, 0x20, 0x74, 0x0e, 0x2b, 0x0b, 0x60, 0x28,
+    0x41, 0xc7, 0x44, 0xc1, 0x74, 0xd8, 0x01, 0x33, 0x4d, 0x85, 0x79, 0x14, 0x00, 0x15, 0x29, 0x14,
+    0x00, 0x00, 0x5e, 0x00, 0x10, 0x73, 0xed, 0x02, 0x02, 0x6b, 0x12, 0x75, 0xcb, 0xc0, 0xe9, 0x03,
+    0x80, 0xe1, 0x01, 0x1f, 0x00, 0xc0, 0x41, 0x8a, 0xc3, 0x49, 0x8b, 0x50, 0x08, 0x49, 0x83, 0x49,
+    0x20, 0x04, 0x71, 0x04, 0x41, 0x01, 0x41, 0x88, 0x89, 0xa5, 0x0e, 0x22, 0x88, 0x81, 0x9c, 0x0e,
+    0x30, 0xc3, 0xd0, 0xe8, 0x15, 0x00, 0x11, 0x81, 0x9a, 0x0e, 0x60, 0x80, 0xe3, 0x01, 0x45, 0x88,
+    0x99, 0xe6, 0x0d, 0x51, 0x88, 0x4a, 0x0a, 0x41, 0x8a, 0x23, 0x00, 0x51, 0x88, 0x42, 0x0b, 0x41,
+    0x8a, 0x1f, 0x00, 0x61, 0x88, 0x42, 0x0c, 0x41, 0x8a, 0x81, 0x1e, 0x00, 0x22, 0x42, 0x0d, 0x39,
+    0x01, 0x00, 0x25, 0x05, 0xd1, 0x78, 0x22, 0x3e, 0x75, 0x08, 0x41, 0x8a, 0x40, 0x27, 0x41, 0x88,
+    0x40, 0x2c, 0x43, 0x0c, 0x21, 0xeb, 0x0c, 0x68, 0x13, 0x21, 0xeb, 0x05, 0xb4, 0x13, 0x03, 0x3c,
+    0x02, 0x30, 0x7c, 0x24, 0x10, 0x22, 0x11, 0x23, 0x18, 0x4c, 0x3c, 0x02, 0x10, 0x89, 0x3d, 0x11,
+    0xf0, 0x07, 0x89, 0x6c, 0x24, 0x18, 0x56, 0x57, 0x41, 0x54, 0x48, 0x83, 0xec, 0x30, 0x41, 0xf6,
+    0x00, 0x01, 0x49, 0x8b, 0xf8, 0x48, 0x8b, 0x69, 0xf8, 0x13, 0x50, 0x48, 0x8b, 0xf1, 0x41, 0xbc,
+    0xed, 0x09, 0x91, 0x0f, 0x84, 0x6b, 0x01, 0x00, 0x00, 0x80, 0xba, 0x02, 0xcf, 0x00, 0x61, 0xb3,
+    0x07, 0x75, 0x46, 0x8a, 0x42, 0x47, 0x0d, 0x30, 0x50, 0x88, 0x82, 0x14, 0x00, 0x32, 0xe8, 0x8e,
+    0xeb, 0x4d, 0x0d, 0x10, 0xce, 0x8c, 0x0d, 0x30, 0x4c, 0x24, 0x50, 0x98, 0x0f, 0x80, 0x01, 0x8a,
+    0xc1, 0xc0, 0xe8, 0x06, 0x88, 0x82, 0xc9, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x3a, 0x0f, 0x50, 0x41,
+    0x22, 0xcb, 0x88, 0x82, 0x5f, 0x09, 0x20, 0x88, 0x8a, 0xe8, 0x06, 0x51, 0xf6, 0x07, 0x10, 0x0f,
+    0x85, 0x9b, 0x06, 0x11, 0xb6, 0x27, 0x00, 0xa1, 0x45, 0x32, 0xd2, 0x80, 0x7a, 0x17, 0x10, 0x0f,
+    0x84, 0xae, 0x87, 0x0f, 0x40, 0x74, 0x0d, 0x80, 0xba, 0x27, 0x00, 0xf0, 0x00, 0x04, 0x75, 0x04,
+    0xb2, 0x01, 0xeb, 0x02, 0x32, 0xd2, 0x8b, 0xc8, 0x84, 0xc0, 0x74, 0x11, 0x47, 0x02, 0x00, 0xc4,
+    0x03, 0xb0, 0x75, 0x1e, 0xeb, 0x19, 0x45, 0x8a, 0xd4, 0xeb, 0x17, 0x80, 0xbb, 0x26, 0x00, 0xf2,
+    0x08, 0x05, 0x75, 0x0e, 0x83, 0x3b, 0x00, 0x75, 0x06, 0x48, 0x0f, 0xba, 0x6b, 0x20, 0x07, 0x41,
+    0xb2, 0x20, 0x84, 0xd2, 0x74, 0x62, 0x8a, 0x43, 0xa8, 0x00, 0x50, 0x48, 0x8b, 0xd3, 0x88, 0x83,
+    0x44, 0x05, 0x62, 0x48, 0x8b, 0xce, 0xe8, 0xe0, 0xea, 0xae, 0x00, 0x00, 0x70, 0x0d, 0x02, 0xae,
+    0x00, 0x32, 0x4b, 0x20, 0x02, 0xae, 0x00, 0x20, 0x83, 0x03, 0x14, 0x00, 0x02, 0xae, 0x00, 0x10,
+    0xcb, 0xeb, 0x0f, 0x20, 0x8b, 0x05, 0xae, 0x00, 0x20, 0x83, 0x04, 0x00, 0x01, 0x60, 0xf9, 0x05,
+    0x75, 0x11, 0x80, 0xbb, 0xa9, 0x00, 0x30, 0x01, 0x41, 0xba, 0x31, 0x0a, 0x40, 0x45, 0x0f, 0x44,
+    0xd4, 0x52, 0x11, 0x31, 0x39, 0xeb, 0x21, 0x9b, 0x00, 0x10, 0x0f, 0x9b, 0x00, 0x60, 0x05, 0x83,
+    0xf9, 0x01, 0xeb, 0x0c, 0x99, 0x00, 0x12, 0x0c, 0xbf, 0x00, 0xc0, 0x06, 0x75, 0x19, 0x41, 0xb2,
+    0x10, 0x45, 0x8a, 0xc2, 0x48, 0x8b, 0xd3, 0x7f, 0x00, 0x22, 0x7d, 0xf0, 0x7f, 0x00, 0x10, 0xa1,
+    0x8f, 0x0a, 0x01, 0x4f, 0x00, 0xf2, 0x0b, 0x03, 0x74, 0x09, 0xf6, 0x07, 0x10, 0x75, 0x04, 0x32,
+    0xc0, 0xeb, 0x02, 0xb0, 0x01, 0x88, 0x45, 0x14, 0xf6, 0x07, 0x02, 0x74, 0x18, 0x0f, 0xb6, 0x45,
+    0x09, 0x33, 0x00, 0x71, 0x44, 0x8a, 0x44, 0x38, 0x01, 0xe8, 0x45, 0x38, 0x00, 0xc3, 0x78, 0x6d,
+    0xf6, 0x07, 0x04, 0x74, 0x35, 0x80, 0x7f, 0x08, 0x00, 0x74, 0xec, 0x00, 0xa0, 0x0f, 0xb6, 0x4d,
+    0x08, 0x45, 0x33, 0xc0, 0x8a, 0x47, 0x08, 0xe7, 0x00, 0xf2, 0x05, 0x44, 0x24, 0x28, 0x8a, 0x47,
+    0x07, 0x44, 0x8a, 0x4c, 0x39, 0x04, 0x48, 0x8b, 0xce, 0x88, 0x44, 0x24, 0x20, 0xe8, 0xab, 0x3a,
+    0x00, 0x60, 0x33, 0x44, 0x84, 0x27, 0x74, 0x29, 0x2e, 0x00, 0x65, 0x41, 0xb0, 0x01, 0x8a, 0x47,
+    0x0d, 0x2e, 0x00, 0x10, 0x0c, 0x2e, 0x00, 0x14, 0x09, 0x2e, 0x00, 0x02, 0xa0, 0x00, 0x10, 0x78,
+    0xa9, 0x15, 0x02, 0x8b, 0x0e, 0x10, 0x58, 0x76, 0x04, 0x92, 0x60, 0x48, 0x83, 0xc4, 0x30, 0x41,
+    0x5c, 0x5f, 0x5e, 0x38, 0x02, 0x02, 0xa0, 0x0f, 0x00, 0x66, 0x13, 0x90, 0x20, 0x55, 0x41, 0x56,
+    0x41, 0x57, 0x48, 0x8b, 0xec, 0xac, 0x0f, 0xf1, 0x04, 0x48, 0x8b, 0xf9, 0x45, 0x33, 0xff, 0x8b,
+    0x4a, 0x0c, 0x4d, 0x8b, 0xf0, 0x48, 0x8b, 0xda, 0x85, 0xc9, 0x74, 0x2c, 0x3a, 0x05, 0xa1, 0x4c,
+    0x8d, 0x42, 0x14, 0x48, 0x8b, 0xcf, 0xe8, 0x65, 0xe9, 0xfc, 0x00, 0xd1, 0x89, 0x9b, 0x02, 0x00,
+    0x00, 0xe9, 0xa3, 0x02, 0x00, 0x00, 0xb8, 0x0c, 0x00, 0x8f, 0x07, 0x40, 0x00, 0xe9, 0x90, 0x02,
+    0x2a, 0x06, 0x10, 0x72, 0x27, 0x00, 0x52, 0x4c, 0x8b, 0xc6, 0xe8, 0x3b, 0x2a, 0x00, 0x30, 0x88,
+    0x7e, 0x02, 0x46, 0x0b, 0x51, 0x10, 0x85, 0xc9, 0x74, 0x50, 0x2d, 0x09, 0xf0, 0x0a, 0x61, 0x02,
+    0x00, 0x00, 0x8a, 0x06, 0x3c, 0x0f, 0x74, 0x24, 0x3c, 0x38, 0x74, 0x14, 0x3c, 0x3a, 0x0f, 0x85,
+    0x4f, 0x02, 0x00, 0x00, 0xc7, 0x42, 0x10, 0xfc, 0x07, 0x22, 0xe9, 0x43, 0x0c, 0x00, 0x00, 0x7b,
+    0x0b, 0xb0, 0xe9, 0x37, 0x02, 0x00, 0x00, 0x44, 0x38, 0x7f, 0x20, 0x0f, 0x85, 0x17, 0x10, 0x30,
+    0xc7, 0x42, 0x0c, 0xbe, 0x02, 0x30, 0xc7, 0x42, 0x10, 0xd2, 0x02, 0x30, 0xe9, 0x1a, 0x02, 0x76,
+    0x02, 0xa0, 0x16, 0x8b, 0xca, 0x83, 0xe9, 0x0f, 0x0f, 0x84, 0x05, 0x02, 0xc4, 0x07, 0xb3, 0x53,
+    0x74, 0x13, 0x83, 0xe9, 0x2d, 0x74, 0x4d, 0x83, 0xe9, 0x35, 0xba, 0x0a, 0x20, 0xf4, 0x01, 0x87,
+    0x04, 0xf1, 0x00, 0x43, 0x08, 0x41, 0x80, 0xf8, 0x0f, 0x73, 0x3d, 0x4c, 0x39, 0x7f, 0x18, 0x0f,
+    0x86, 0xd2, 0x46, 0x02, 0xf0, 0x03, 0x47, 0x10, 0x8a, 0x08, 0x80, 0xe1, 0xf0, 0x80, 0xf9, 0xc0,
+    0x73, 0x09, 0x44, 0x39, 0x3b, 0x0f, 0x85, 0xa7, 0x75, 0x11, 0x32, 0x43, 0x20, 0x04, 0xc5, 0x0c,
+    0x20, 0xb8, 0x06, 0x5f, 0x13, 0x10, 0xc2, 0x4d, 0x02, 0x71, 0x53, 0x08, 0x80, 0xfa, 0x0f, 0x72,
+    0x0a, 0x88, 0x03, 0x52, 0xe9, 0xb0, 0x01, 0x00, 0x00, 0x47, 0x00, 0x17, 0x8b, 0x47, 0x00, 0x60,
+    0x1f, 0x80, 0xf9, 0x08, 0x72, 0x69, 0x3e, 0x00, 0x20, 0x75, 0xc6, 0xb2, 0x00, 0xf0, 0x03, 0x75,
+    0x6b, 0x44, 0x38, 0x7f, 0x24, 0x75, 0x75, 0xfe, 0xca, 0x66, 0xc7, 0x45, 0x28, 0x8f, 0x00, 0x88,
+    0x93, 0x68, 0x06, 0xe0, 0x4c, 0x8d, 0x45, 0x29, 0x48, 0x8b, 0xd3, 0x44, 0x88, 0x7d, 0x2a, 0x41,
+    0xb1, 0x02, 0x4e, 0x01, 0x22, 0x4f, 0xe8, 0x24, 0x01, 0x10, 0x5a, 0xe0, 0x00, 0x20, 0x43, 0x0c,
+    0xf6, 0x00, 0x70, 0x4c, 0x8d, 0x45, 0x28, 0x48, 0x8b, 0x4f, 0x0a, 0x02, 0x23, 0xe8, 0xa0, 0x1f,
+    0x00, 0x11, 0x3b, 0x50, 0x08, 0x10, 0x83, 0x36, 0x04, 0x81, 0xff, 0xc0, 0x89, 0x43, 0x10, 0x4c,
+    0x8b, 0xc6, 0x64, 0x08, 0x00, 0x6b, 0x00, 0x40, 0x74, 0x0a, 0xb8, 0x04, 0x99, 0x00, 0x12, 0x17,
+    0x10, 0x00, 0x50, 0x24, 0x74, 0x0a, 0xb8, 0x05, 0x10, 0x00, 0x00, 0xe5, 0x08, 0xf0, 0x0b, 0x88,
+    0x55, 0x28, 0x48, 0x8b, 0xcf, 0x66, 0x44, 0x89, 0x7d, 0x29, 0x44, 0x88, 0x7d, 0x2b, 0x83, 0xea,
+    0x62, 0x74, 0x5d, 0x41, 0xfe, 0xc8, 0x44, 0x88, 0x83, 0x8f, 0x00, 0x33, 0x83, 0xfa, 0x62, 0x92,
+    0x00, 0xf2, 0x00, 0x74, 0x07, 0xe8, 0x8d, 0xe7, 0xff, 0xff, 0xeb, 0x08, 0x41, 0xb1, 0x02, 0xe8,
+    0xbb, 0xe7, 0x75, 0x00, 0x00, 0xde, 0x0a, 0x80, 0x80, 0x3e, 0x62, 0x74, 0x37, 0xc7, 0x43, 0x0c,
+    0x9b, 0x01, 0x08, 0x99, 0x00, 0x13, 0xf7, 0x99, 0x00, 0x00, 0x3b, 0x09, 0x03, 0x99, 0x00, 0x20,
+    0xe9, 0x64, 0x52, 0x0a, 0x23, 0xb1, 0x03, 0x53, 0x00, 0xf1, 0x07, 0xeb, 0xb7, 0x0f, 0xb6, 0x45,
+    0x2a, 0xc1, 0xe8, 0x02, 0x0f, 0xba, 0xe0, 0x00, 0x8a, 0x43, 0x08, 0x73, 0x21, 0x2c, 0x04, 0xc7,
+    0x43, 0x40, 0x1a, 0x3b, 0x88, 0x83, 0xfe, 0x4f, 0x00, 0xa0, 0x10, 0xea, 0xff, 0xff, 0xeb, 0x2e,
+    0x2c, 0x04, 0x88, 0x83, 0x5a, 0x14, 0x81, 0x48, 0x8b, 0x07, 0x44, 0x39, 0x38, 0x74, 0x07, 0x22,
+    0x14, 0x50, 0xeb, 0x42, 0xc7, 0x43, 0x0c, 0x6a, 0x0a, 0x08, 0x30, 0x00, 0x11, 0xb8, 0xae, 0x04,
+    0x50, 0x78, 0x27, 0x0f, 0xb6, 0x83, 0xb2, 0x05, 0x52, 0xe9, 0xe9, 0xfe, 0xff, 0xff, 0x2e, 0x05,
+    0x30, 0x14, 0xc7, 0x43, 0xda, 0x0b, 0x01, 0x04, 0x08, 0x45, 0x66, 0x41, 0x89, 0x06, 0x03, 0x03,
+    0x10, 0x40, 0x74, 0x07, 0x10, 0x50, 0x42, 0x05, 0x10, 0x58, 0x93, 0x11, 0xa3, 0x41, 0x5f, 0x41,
+    0x5e, 0x5d, 0xc3, 0x48, 0x83, 0xec, 0x28, 0x15, 0x05, 0x53, 0x4d, 0x8b, 0xd0, 0x75, 0x41, 0x15,
+    0x05, 0x13, 0x38, 0x15, 0x05, 0x21, 0x79, 0xe6, 0x67, 0x00, 0x5f, 0x3a, 0x8a, 0x4c, 0x24, 0x38,
+    0x11, 0x05, 0x02, 0x58, 0x24, 0x07, 0x80, 0xe1, 0x07, 0x10, 0x05, 0x03, 0x07, 0x05, 0x44, 0x66,
+    0x41, 0x89, 0x02, 0x0f, 0x13, 0x13, 0x28, 0x94, 0x19, 0x02, 0xa8, 0x05, 0x00, 0x75, 0x03, 0x51,
+    0x20, 0x57, 0x41, 0x54, 0x41, 0x74, 0x03, 0x60, 0x8a, 0x59, 0x14, 0x48, 0x8d, 0x82, 0x39, 0x00,
+    0xf0, 0x25, 0x44, 0x8b, 0x32, 0x4c, 0x8b, 0xda, 0x45, 0x0f, 0xb6, 0xe0, 0x4c, 0x8b, 0xd1, 0x84,
+    0xdb, 0x75, 0x14, 0x80, 0x38, 0x04, 0x75, 0x0f, 0xb2, 0x04, 0x41, 0xb0, 0x01, 0x44, 0x3a, 0xca,
+    0x75, 0x0a, 0x41, 0x8a, 0xe8, 0xeb, 0x08, 0x8a, 0x10, 0x45, 0x32, 0xc0, 0x40, 0x32, 0xed, 0x0f,
+    0xb6, 0x49, 0x12, 0x45, 0x8a, 0xbb, 0x77, 0x00, 0xf0, 0x06, 0x8a, 0xc1, 0x24, 0x07, 0x45, 0x85,
+    0xf6, 0x0f, 0xb6, 0xc0, 0x0f, 0x45, 0xc8, 0x45, 0x84, 0xc0, 0x74, 0x09, 0x45, 0x8a, 0xab, 0xf2,
+    0x04, 0x71, 0xeb, 0x03, 0x44, 0x8a, 0xea, 0x41, 0x8a, 0xf8, 0x04, 0x20, 0x41, 0xb8, 0x95, 0x00,
+    0x40, 0x88, 0x44, 0x24, 0x30, 0x2b, 0x00, 0x20, 0x85, 0x94, 0x20, 0x01, 0xf0, 0x66, 0x8b, 0x43,
+    0x0c, 0x83, 0xe8, 0x04, 0x83, 0xf8, 0x01, 0x0f, 0x96, 0xc0, 0x40, 0x84, 0xed, 0x74, 0x06, 0x41,
+    0x8a, 0x7a, 0x11, 0xeb, 0x03, 0x40, 0x32, 0xff, 0x84, 0xc0, 0x74, 0x06, 0x45, 0x8a, 0x5a, 0x0c,
+    0xeb, 0x03, 0x45, 0x32, 0xdb, 0x41, 0x8a, 0x42, 0x0d, 0x40, 0x02, 0xff, 0x41, 0x0a, 0x7a, 0x0c,
+    0x45, 0x02, 0xdb, 0x41, 0x8a, 0x72, 0x11, 0x44, 0x0a, 0xd8, 0xc0, 0xe0, 0x03, 0x44, 0x0a, 0xe8,
+    0x40, 0xc0, 0xe7, 0x03, 0x40, 0x08, 0x7c, 0x24, 0x30, 0x49, 0x8b, 0xfc, 0x41, 0x8a, 0x42, 0x10,
+    0x02, 0xc0, 0x40, 0xc0, 0xe6, 0x04, 0x41, 0x0a, 0x42, 0x0b, 0x40, 0x0a, 0xf1, 0xc0, 0xe0, 0x03,
+    0x48, 0x8d, 0x0d, 0x38, 0xd5, 0xff, 0xff, 0x44, 0x0a, 0xf8, 0x41, 0xc0, 0xe3, 0x03, 0x45, 0x22,
+    0xbc, 0x0c, 0x80, 0x8f, 0x0b, 0xe0, 0x0a, 0xd3, 0x84, 0xdb, 0x74, 0x0d, 0x41, 0x0f, 0xb6, 0xc1,
+    0x8a, 0x8c, 0x08, 0x90, 0x13, 0x0a, 0xf0, 0x10, 0x03, 0x41, 0x8a, 0xc8, 0x22, 0xd1, 0xeb, 0x06,
+    0x49, 0x8b, 0xfc, 0x40, 0x8a, 0xf1, 0x44, 0x0f, 0xb6, 0x5c, 0x24, 0x50, 0x45, 0x84, 0xdb, 0x75,
+    0x19, 0x45, 0x38, 0x5a, 0x12, 0x0f, 0x85, 0x99, 0x0e, 0xc0, 0x40, 0x84, 0xed, 0x75, 0x0a, 0x41,
+    0x38, 0x6a, 0x11, 0x0f, 0x85, 0xc1, 0xbe, 0x00, 0xf3, 0x1c, 0xf7, 0xde, 0x48, 0x1b, 0xc9, 0x48,
+    0xf7, 0xd1, 0x83, 0xe1, 0x0c, 0x48, 0x8d, 0x04, 0x39, 0x48, 0x8d, 0x3d, 0xcd, 0xd4, 0xff, 0xff,
+    0x44, 0x3a, 0xbc, 0x38, 0xb8, 0x92, 0x00, 0x00, 0x0f, 0x83, 0x9c, 0x00, 0x00, 0x00, 0x4a, 0x8d,
+    0x04, 0x19, 0x40, 0x3a, 0xb4, 0x12, 0x00, 0x10, 0x8a, 0x70, 0x0a, 0x20, 0xdb, 0x74, 0x34, 0x0a,
+    0x61, 0xc1, 0x48, 0x03, 0xc1, 0x3a, 0x94, 0x18, 0x00, 0x82, 0x73, 0x76, 0xb0, 0xff, 0x41, 0x80,
+    0xfc, 0x08, 0x66, 0x0c, 0x41, 0xc7, 0x0f, 0x44, 0xc8, 0x9d, 0x00, 0x00, 0x79, 0x14, 0x50, 0xb6,
+    0xc9, 0x0f, 0xb6, 0xc2, 0x11, 0x00, 0xc0, 0xc9, 0x78, 0x0e, 0x48, 0x0f, 0xbe, 0xc1, 0x80, 0xbc,
+    0x38, 0x60, 0x93, 0xf9, 0x08, 0x40, 0x43, 0x45, 0x84, 0xe4, 0x2d, 0x00, 0xf1, 0x22, 0x41, 0x8b,
+    0xc8, 0x0f, 0x45, 0xc8, 0x41, 0x88, 0x4a, 0x15, 0x45, 0x84, 0xc9, 0x74, 0x04, 0x84, 0xdb, 0x75,
+    0x03, 0x41, 0x8a, 0xd0, 0x40, 0x0f, 0xb6, 0xc6, 0x45, 0x84, 0xdb, 0x41, 0x88, 0x52, 0x16, 0x44,
+    0x0f, 0x45, 0xc0, 0x45, 0x88, 0x6a, 0x18, 0x8a, 0x44, 0x24, 0x30, 0x41, 0x88, 0x42, 0x19, 0x12,
+    0x02, 0x83, 0x45, 0x88, 0x42, 0x17, 0xeb, 0x05, 0xb8, 0x03, 0xd4, 0x07, 0x10, 0x38, 0x9a, 0x05,
+    0x01, 0x9c, 0x02, 0x10, 0x48, 0x93, 0x02, 0x53, 0x41, 0x5d, 0x41, 0x5c, 0x5f, 0xa0, 0x05, 0x10,
+    0x55, 0xd4, 0x07, 0x02, 0x28, 0x02, 0x00, 0xda, 0x07, 0xf0, 0x11, 0x45, 0x8a, 0x50, 0x0b, 0x45,
+    0x33, 0xff, 0x4c, 0x8b, 0xf2, 0x44, 0x88, 0x7c, 0x24, 0x78, 0x41, 0x8a, 0x50, 0x0c, 0x4c, 0x8b,
+    0xd9, 0x80, 0xe2, 0x1f, 0x41, 0x80, 0xe2, 0x1f, 0x88, 0x94, 0x24, 0x18, 0x11, 0xf0, 0x05, 0x41,
+    0x8d, 0x5f, 0x01, 0x41, 0x8b, 0x4e, 0x0c, 0x45, 0x8a, 0xcf, 0x41, 0x8a, 0xf7, 0x45, 0x8a, 0xef,
+    0x41, 0x8b, 0xff, 0x0a, 0x14, 0x10, 0x1f, 0xc5, 0x0c, 0x50, 0xe9, 0x02, 0x0f, 0x84, 0x09, 0xf6,
+    0x0e, 0x41, 0xcb, 0x0f, 0x84, 0xe3, 0x12, 0x0e, 0xf0, 0x04, 0x0f, 0x84, 0x96, 0x00, 0x00, 0x00,
+    0x3b, 0xcb, 0x75, 0x3f, 0x41, 0x0f, 0xb6, 0x48, 0x0f, 0x41, 0x0f, 0xb6, 0x86, 0xcc, 0x07, 0xf0,
+    0x03, 0x8b, 0xf9, 0x41, 0x8a, 0x70, 0x0e, 0x83, 0xe1, 0x1f, 0x44, 0x8a, 0xce, 0xc1, 0xef, 0x05,
+    0x40, 0xc0, 0xee, 0x2d, 0x18, 0xf0, 0x01, 0x1f, 0x40, 0x22, 0xf3, 0x83, 0xe7, 0x03, 0x48, 0x8d,
+    0x0c, 0xc8, 0x48, 0x8d, 0x05, 0x8e, 0x67, 0x6e, 0x04, 0x51, 0x3c, 0x01, 0x0f, 0x84, 0xde, 0x42,
+    0x0a, 0xf0, 0x14, 0x5b, 0x08, 0x41, 0x8a, 0xc2, 0x24, 0x0f, 0x41, 0x8a, 0xef, 0x44, 0x0f, 0xb6,
+    0xe0, 0x45, 0x84, 0xd2, 0x41, 0x0f, 0xb6, 0xc2, 0x8a, 0x4b, 0x14, 0x44, 0x0f, 0x44, 0xe0, 0x41,
+    0x8a, 0xc2, 0x88, 0x8c, 0x24, 0x88, 0xbc, 0x0c, 0xf0, 0x00, 0xe8, 0x04, 0x41, 0xf6, 0xda, 0x45,
+    0x1a, 0xff, 0x44, 0x22, 0xf8, 0x84, 0xd2, 0x0f, 0x84, 0x7a, 0x17, 0x40, 0x84, 0xc9, 0x0f, 0x84,
+    0xf5, 0x0e, 0xc2, 0x40, 0x8a, 0xea, 0x40, 0xc0, 0xed, 0x04, 0x80, 0xe2, 0x0f, 0xe9, 0xe0, 0x65,
+    0x17, 0x70, 0x0e, 0x44, 0x8a, 0xc8, 0x40, 0x8a, 0xf0, 0x07, 0x18, 0x50, 0x80, 0xe1, 0x1f, 0x22,
+    0xc3, 0x89, 0x00, 0x70, 0x88, 0x44, 0x24, 0x78, 0x40, 0x22, 0xf3, 0xbf, 0x09, 0xc0, 0x10, 0x8b,
+    0xf8, 0xc1, 0xef, 0x05, 0x83, 0xe7, 0x03, 0x45, 0x38, 0xbe, 0xcf, 0x04, 0xf7, 0x0e, 0x0f, 0x84,
+    0x75, 0xff, 0xff, 0xff, 0x84, 0xc0, 0x0f, 0x89, 0x68, 0x01, 0x00, 0x00, 0xe9, 0x68, 0xff, 0xff,
+    0xff, 0x45, 0x8a, 0x68, 0x0e, 0x41, 0x8a, 0xf5, 0x45, 0x8a, 0xcd, 0xc5, 0x00, 0x61, 0x41, 0xc0,
+    0xed, 0x07, 0xe9, 0x4a, 0x1e, 0x00, 0x20, 0x48, 0x0e, 0x14, 0x00, 0x20, 0xe9, 0x3d, 0x0d, 0x00,
+    0xf3, 0x0a, 0x38, 0x78, 0x06, 0x7d, 0x06, 0x41, 0x83, 0x3e, 0x05, 0x74, 0x0f, 0x41, 0x84, 0x58,
+    0x07, 0x74, 0x13, 0x41, 0x8b, 0x06, 0x2b, 0xc3, 0x3b, 0xc3, 0x77, 0x7c, 0x1a, 0x10, 0x32, 0x5c,
+    0x17, 0x60, 0x38, 0x7b, 0x20, 0x0f, 0x84, 0x0e, 0xe9, 0x04, 0x00, 0xa4, 0x14, 0x62, 0x0f, 0x85,
+    0x03, 0xff, 0xff, 0xff, 0x7f, 0x05, 0x10, 0x13, 0x60, 0x08, 0x41, 0xe2, 0x07, 0xf6, 0x84, 0x89,
+    0x01, 0x60, 0x08, 0x74, 0x1f, 0x49, 0x8b, 0x03, 0x56, 0x0b, 0x40, 0x17, 0x41, 0x38, 0xae, 0x7e,
+    0x03, 0x51, 0x75, 0x0e, 0x41, 0x80, 0xbe, 0xe6, 0x08, 0x31, 0x0f, 0x84, 0xb1, 0xb5, 0x19, 0xf4,
+    0x08, 0x4c, 0x24, 0x20, 0x45, 0x8a, 0xc4, 0x44, 0x8a, 0xca, 0x48, 0x8b, 0xcb, 0x49, 0x8b, 0xd6,
+    0xe8, 0xd7, 0xfb, 0xff, 0xff, 0x45, 0x33, 0xc9, 0x7b, 0x05, 0xb0, 0x45, 0x84, 0xff, 0x74, 0x0a,
+    0x80, 0x7b, 0x15, 0x01, 0x0f, 0x84, 0x4c, 0x0b, 0x01, 0xa4, 0x03, 0x60, 0x80, 0x7b, 0x16, 0x01,
+    0x74, 0x76, 0xcd, 0x16, 0xf0, 0x16, 0x39, 0x41, 0x8b, 0x46, 0x0c, 0xb2, 0xf0, 0x44, 0x8a, 0x43,
+    0x19, 0x0f, 0xb6, 0x4b, 0x15, 0x83, 0xf8, 0x03, 0x75, 0x05, 0x8a, 0x53, 0x17, 0xeb, 0x13, 0x83,
+    0xc0, 0xfc, 0x83, 0xf8, 0x01, 0x77, 0x0b, 0x45, 0x84, 0xe4, 0xb8, 0x7a, 0x0a, 0xf2, 0x13, 0x0f,
+    0x44, 0xc8, 0x41, 0x3a, 0xc8, 0x74, 0x41, 0x3a, 0xca, 0x74, 0x3d, 0x44, 0x3a, 0xc2, 0x74, 0x38,
+    0x44, 0x38, 0x4c, 0x24, 0x78, 0x74, 0x17, 0x8a, 0x43, 0x15, 0x3a, 0x43, 0x17, 0x74, 0x29, 0x44,
+    0x38, 0x9b, 0x01, 0xf1, 0x12, 0x74, 0x05, 0x3a, 0x43, 0x16, 0x74, 0x1a, 0x45, 0x84, 0xed, 0x74,
+    0x1c, 0x8a, 0x53, 0x15, 0x8a, 0x4b, 0x17, 0x3a, 0xd1, 0x74, 0x0b, 0x8a, 0x43, 0x16, 0x3a, 0xd0,
+    0x74, 0x04, 0x3a, 0xc8, 0x75, 0x07, 0xb3, 0x02, 0xf1, 0x03, 0xeb, 0x2f, 0x83, 0xef, 0x02, 0x74,
+    0x19, 0x83, 0xff, 0x01, 0x75, 0x0d, 0x44, 0x38, 0x4b, 0x13, 0x74, 0x07, 0x87, 0x1a, 0x22, 0xeb,
+    0x18, 0xb3, 0x0a, 0xe0, 0x11, 0x8a, 0x43, 0x13, 0xf6, 0xd8, 0x1b, 0xc0, 0x25, 0xf6, 0xff, 0xef,
+    0x7f, 0x05, 0x1a, 0x00, 0x00, 0xe4, 0x02, 0x11, 0x70, 0x79, 0x08, 0x04, 0xde, 0x02, 0x2f, 0x5e,
+    0x5d, 0xe0, 0x02, 0x00, 0x01, 0x7c, 0x08, 0xa0, 0x30, 0x45, 0x33, 0xe4, 0x4c, 0x8d, 0x3d, 0xfb,
+    0x73, 0x02, 0xce, 0x18, 0xf0, 0x04, 0x48, 0x8b, 0xf9, 0x41, 0x8b, 0xf4, 0x45, 0x8d, 0x6c, 0x24,
+    0x01, 0x45, 0x8d, 0x54, 0x24, 0x02, 0x45, 0x8d, 0x5c, 0x88, 0x1c, 0x00, 0x68, 0x00, 0x21, 0xba,
+    0x07, 0xbb, 0x09, 0xf0, 0x07, 0xb6, 0x37, 0x45, 0x0f, 0xb7, 0xcc, 0x66, 0x44, 0x89, 0x65, 0xf0,
+    0x41, 0x8b, 0xce, 0x41, 0x83, 0xfe, 0x0e, 0x0f, 0x87, 0xfa, 0x03, 0x09, 0x02, 0x91, 0xa5, 0x03,
+    0x00, 0x00, 0x3b, 0xca, 0x0f, 0x87, 0x9a, 0xe9, 0x0f, 0x10, 0x75, 0xba, 0x01, 0x50, 0x84, 0xf6,
+    0x0f, 0x84, 0x23, 0x0c, 0x05, 0x00, 0xf5, 0x11, 0x11, 0xe5, 0x05, 0x11, 0x31, 0xcd, 0x0f, 0x84,
+    0x5e, 0x1b, 0x40, 0x2b, 0xcd, 0x74, 0x74, 0x05, 0x00, 0x10, 0x4c, 0x05, 0x00, 0xf0, 0x10, 0x18,
+    0x41, 0x3b, 0xcd, 0x0f, 0x85, 0xf8, 0x04, 0x00, 0x00, 0x44, 0x39, 0x23, 0x45, 0x8b, 0xcc, 0x41,
+    0x0f, 0x95, 0xc1, 0xe9, 0xc6, 0x04, 0x00, 0x00, 0x8b, 0x0b, 0x85, 0xc9, 0x74, 0x20, 0x23, 0x00,
+    0x11, 0x12, 0x3b, 0x00, 0x41, 0xb2, 0x04, 0x00, 0x00, 0x2c, 0x00, 0x20, 0xa9, 0x04, 0x8d, 0x00,
+    0x42, 0xb7, 0xcd, 0xe9, 0xa0, 0x09, 0x00, 0x41, 0xca, 0xe9, 0x97, 0x04, 0xaf, 0x06, 0x11, 0xf0,
+    0xfc, 0x09, 0xd0, 0xcf, 0xe8, 0x8e, 0xf6, 0xff, 0xff, 0x44, 0x0f, 0xb7, 0x4d, 0xf0, 0x41, 0xba,
+    0xe1, 0x07, 0x93, 0x45, 0x8d, 0x5a, 0x01, 0xe9, 0xf6, 0x03, 0x00, 0x00, 0xa7, 0x17, 0x10, 0x85,
+    0x0e, 0x02, 0x30, 0x0f, 0xb6, 0x8b, 0x0d, 0x03, 0x10, 0xb8, 0x20, 0x07, 0x23, 0x3b, 0xc8, 0xd8,
+    0x06, 0xf0, 0x03, 0x74, 0x12, 0x66, 0x41, 0xc1, 0xe1, 0x02, 0x66, 0x83, 0xc0, 0x21, 0x66, 0x44,
+    0x03, 0xc8, 0xe9, 0x3f, 0x04, 0x5b, 0x06, 0x30, 0xc1, 0xe1, 0x03, 0x0e, 0x00, 0x61, 0x66, 0x45,
+    0x03, 0xcd, 0xe9, 0x2d, 0xa8, 0x00, 0x44, 0x63, 0x0c, 0x74, 0x43, 0x42, 0x00, 0x03, 0x8e, 0x07,
+    0x01, 0x39, 0x00, 0x21, 0xeb, 0xd7, 0x1c, 0x00, 0x14, 0x27, 0x1c, 0x00, 0x70, 0x41, 0x0f, 0xb7,
+    0xc1, 0x66, 0x03, 0xc0, 0x3e, 0x00, 0x04, 0x27, 0x00, 0x00, 0x49, 0x00, 0xe0, 0x44, 0x2b, 0xca,
+    0xe9, 0xe4, 0x03, 0x00, 0x00, 0x45, 0x8b, 0xcc, 0xe9, 0xdc, 0x03, 0x2a, 0x15, 0xf0, 0x17, 0xf6,
+    0x0f, 0x84, 0x49, 0x05, 0x00, 0x00, 0x4c, 0x8b, 0xfe, 0x49, 0x8b, 0xf4, 0x44, 0x38, 0x67, 0x24,
+    0x74, 0x09, 0x0f, 0xb6, 0x47, 0x2b, 0x44, 0x89, 0x64, 0xc3, 0x74, 0x80, 0x7f, 0x24, 0x66, 0x0f,
+    0x85, 0x7e, 0xfe, 0xff, 0xff, 0x13, 0x00, 0xa2, 0x38, 0x47, 0x28, 0x75, 0x05, 0x44, 0x89, 0x6c,
+    0xc3, 0x74, 0xbf, 0x16, 0x00, 0x9f, 0x0e, 0x97, 0x48, 0x09, 0x43, 0x20, 0xe9, 0x5d, 0xfe, 0xff,
+    0xff, 0x04, 0x01, 0x29, 0x92, 0xf8, 0x04, 0x01, 0x21, 0xe9, 0xf6, 0xb0, 0x09, 0x44, 0x08, 0x0f,
+    0x84, 0xca, 0x94, 0x01, 0x00, 0x03, 0x09, 0x01, 0x09, 0x00, 0x00, 0x2f, 0x13, 0x01, 0x09, 0x00,
+    0x00, 0xf9, 0x05, 0x00, 0x70, 0x01, 0x11, 0x62, 0x67, 0x01, 0x21, 0x65, 0x03, 0x93, 0x01, 0xf0,
+    0x02, 0x75, 0x13, 0x48, 0x8b, 0x47, 0x08, 0x44, 0x38, 0x60, 0x0a, 0x74, 0x09, 0x41, 0x0f, 0xb7,
+    0xc2, 0xe9, 0x9c, 0x14, 0x70, 0x48, 0x0f, 0xba, 0x63, 0x20, 0x2b, 0x73, 0xa5, 0x00, 0x11, 0x28,
+    0x8d, 0x00, 0x01, 0xad, 0x01, 0x10, 0x19, 0x3d, 0x00, 0x10, 0x14, 0x05, 0x00, 0xf4, 0x01, 0x05,
+    0x41, 0x3b, 0xcd, 0x74, 0x0a, 0x48, 0x8b, 0x43, 0x20, 0x48, 0xc1, 0xe8, 0x2b, 0xeb, 0x0b, 0x0a,
+    0x00, 0xd0, 0x66, 0xf7, 0xd0, 0x66, 0x41, 0x23, 0xc5, 0xeb, 0x73, 0x0f, 0xb6, 0x4f, 0x24, 0xe2,
+    0x0e, 0x40, 0x33, 0x81, 0xe9, 0x8c, 0x79, 0x01, 0x10, 0x1a, 0x31, 0x00, 0x10, 0x06, 0xd6, 0x01,
+    0x20, 0xeb, 0x3b, 0xe7, 0x00, 0xb0, 0x45, 0x0f, 0xb7, 0xcb, 0x44, 0x89, 0x54, 0xc3, 0x74, 0xeb,
+    0x2c, 0x0f, 0x00, 0x20, 0x41, 0xb9, 0xa8, 0x01, 0x02, 0x11, 0x00, 0x13, 0x1b, 0x20, 0x00, 0x11,
+    0xca, 0x0f, 0x00, 0x30, 0x48, 0xb8, 0xff, 0x01, 0x00, 0xe0, 0xf7, 0xff, 0xff, 0x48, 0x21, 0x43,
+    0x20, 0x33, 0xd2, 0x49, 0x8b, 0xcf, 0xe8, 0x02, 0x7e, 0x16, 0x41, 0x8b, 0xf0, 0xe9, 0x80, 0xcf,
+    0x0a, 0xe1, 0x67, 0x21, 0x41, 0x8b, 0xc4, 0x0f, 0x95, 0xc0, 0x44, 0x0f, 0xb7, 0xc8, 0xe9, 0x6d,
+    0x13, 0x00, 0x10, 0xa3, 0x6e, 0x08, 0x21, 0x75, 0x52, 0xeb, 0x0c, 0x12, 0x45, 0xea, 0x0c, 0x00,
+    0x12, 0x00, 0x00, 0x38, 0x01, 0x22, 0xf6, 0xdd, 0x69, 0x09, 0x71, 0xb1, 0x04, 0x00, 0x00, 0x8a,
+    0x4d, 0x50, 0xfa, 0x02, 0x41, 0x4c, 0x09, 0x6b, 0x20, 0x8a, 0x08, 0x02, 0x0e, 0x03, 0x25, 0x88,
+    0x83, 0x90, 0x08, 0x61, 0x22, 0xc2, 0x22, 0xca, 0x88, 0x83, 0x8f, 0x08, 0x11, 0x8b, 0x56, 0x08,
+    0x21, 0x0f, 0xb6, 0x08, 0x00, 0x24, 0xeb, 0x5f, 0x65, 0x00, 0x12, 0x4e, 0x65, 0x00, 0x19, 0x58,
+    0x65, 0x00, 0x13, 0x91, 0x65, 0x00, 0x11, 0x4c, 0x65, 0x00, 0x12, 0x58, 0x57, 0x00, 0x05, 0x66,
+    0x00, 0x07, 0x60, 0x00, 0x02, 0xf0, 0x08, 0x0b, 0x61, 0x00, 0x00, 0x0e, 0x00, 0x40, 0x41, 0x8b,
+    0xc0, 0xe9, 0x5e, 0x03, 0x07, 0xf2, 0x01, 0x22, 0xa0, 0xf6, 0x55, 0x00, 0x20, 0xf7, 0x03, 0x67,
+    0x02, 0x36, 0x39, 0x5d, 0xf0, 0xf7, 0x00, 0x01, 0x60, 0x00, 0x51, 0xe9, 0xf2, 0xfd, 0xff, 0xff,
+    0xa8, 0x01, 0x10, 0x29, 0xa3, 0x01, 0x15, 0x17, 0xa8, 0x01, 0x13, 0x0d, 0x9e, 0x01, 0x65, 0x2c,
+    0xe9, 0x60, 0xfe, 0xff, 0xff, 0x0d, 0x00, 0x14, 0x50, 0x0d, 0x00, 0x01, 0xb6, 0x18, 0x00, 0x11,
+    0x11, 0xf0, 0x08, 0x48, 0x23, 0xc1, 0x48, 0xf7, 0xd8, 0x66, 0x1b, 0xc0, 0x66, 0x41, 0x03, 0xc2,
+    0xe9, 0xac, 0xfe, 0xff, 0xff, 0x83, 0xf9, 0x16, 0x0f, 0x87, 0x7b, 0x0e, 0x20, 0x0f, 0x84, 0x5b,
+    0x15, 0x00, 0x20, 0x15, 0x10, 0x77, 0x58, 0x00, 0x10, 0x64, 0x05, 0x00, 0x10, 0x51, 0x05, 0x00,
+    0x10, 0x3f, 0x05, 0x00, 0x12, 0x2d, 0xc6, 0x03, 0x00, 0x56, 0x02, 0x11, 0x0f, 0x03, 0x01, 0x10,
+    0x07, 0x50, 0x02, 0x22, 0xeb, 0x07, 0x09, 0x00, 0xd3, 0x09, 0x41, 0x8b, 0xcc, 0x0f, 0x95, 0xc1,
+    0x44, 0x0f, 0xb7, 0xc9, 0xe9, 0xcd, 0x9c, 0x03, 0x00, 0x60, 0x06, 0x10, 0xe9, 0x2d, 0x04, 0x00,
+    0x0d, 0x00, 0x00, 0x93, 0x12, 0x21, 0xe9, 0xb3, 0xa9, 0x0a, 0x80, 0x47, 0x08, 0x44, 0x0f, 0xb6,
+    0x48, 0x0d, 0xe9, 0x32, 0x0c, 0x04, 0x0e, 0x00, 0x33, 0x0a, 0xe9, 0x97, 0x0e, 0x00, 0x00, 0x55,
+    0x07, 0x01, 0x3d, 0x06, 0x40, 0x66, 0x41, 0x3b, 0xcb, 0x50, 0x00, 0x40, 0x41, 0x0f, 0x45, 0xc0,
+    0x14, 0x01, 0x10, 0xe3, 0xd0, 0x18, 0x12, 0x74, 0x6f, 0x00, 0x80, 0x0b, 0xeb, 0x8f, 0x83, 0xe9,
+    0x17, 0x74, 0x55, 0x94, 0x00, 0x10, 0x44, 0x05, 0x00, 0x10, 0x33, 0x05, 0x00, 0x10, 0x22, 0x05,
+    0x00, 0x62, 0x11, 0x41, 0x3b, 0xcd, 0x75, 0x70, 0x27, 0x00, 0x40, 0x11, 0xe9, 0x65, 0xff, 0x01,
+    0x01, 0x00, 0x0c, 0x00, 0x35, 0x10, 0xe9, 0x59, 0x0c, 0x00, 0x35, 0x0f, 0xe9, 0x4d, 0x0c, 0x00,
+    0x35, 0x0e, 0xe9, 0x41, 0x0c, 0x00, 0x32, 0x0d, 0xe9, 0x35, 0x0c, 0x00, 0xf0, 0x03, 0x41, 0x8b,
+    0xd4, 0x44, 0x38, 0x60, 0x0c, 0x0f, 0x95, 0xc2, 0x44, 0x0f, 0xb7, 0xca, 0x41, 0x0f, 0xb7, 0xd1,
+    0x94, 0x02, 0x10, 0x6e, 0xa3, 0x04, 0x21, 0x8b, 0xf8, 0x17, 0x05, 0x10, 0x50, 0x4a, 0x0d, 0x20,
+    0x88, 0x4a, 0xd1, 0x0d, 0x21, 0x9c, 0xfa, 0xb4, 0x12, 0x20, 0x57, 0x01, 0x89, 0x02, 0x50, 0x8b,
+    0x4b, 0x0c, 0xe8, 0xce, 0x10, 0x04, 0xf0, 0x2b, 0x8b, 0x53, 0x20, 0x8b, 0x03, 0x4c, 0x8b, 0x47,
+    0x08, 0x48, 0xc1, 0xea, 0x2b, 0x41, 0x22, 0xd5, 0x41, 0x3b, 0xc5, 0x74, 0x19, 0x41, 0x3b, 0xc3,
+    0x74, 0x14, 0x85, 0xc0, 0x75, 0x13, 0x41, 0x8a, 0x40, 0x0a, 0x41, 0x22, 0xc5, 0x41, 0x02, 0xc2,
+    0x02, 0xc0, 0x02, 0xd0, 0xeb, 0x03, 0x41, 0x02, 0xd2, 0x48, 0x8b, 0x75, 0x50, 0x4c, 0x8d, 0x35,
+    0x39, 0xcb, 0x25, 0x04, 0xb0, 0xc2, 0x0f, 0xb6, 0x4e, 0x05, 0x83, 0xe1, 0x07, 0x48, 0x8d, 0x14,
+    0xe0, 0x17, 0x80, 0x32, 0x00, 0x95, 0x00, 0x00, 0x88, 0x43, 0x16, 0xce, 0x1f, 0xf0, 0x03, 0x88,
+    0x40, 0x08, 0x8a, 0x56, 0x05, 0x8a, 0xc2, 0x24, 0x07, 0x41, 0x3a, 0xc5, 0x75, 0x07, 0xc6, 0x43,
+    0x16, 0x10, 0x00, 0x00, 0xe6, 0x01, 0x22, 0x8b, 0x0b, 0x70, 0x00, 0x20, 0xe8, 0x2c, 0x5b, 0x00,
+    0x00, 0x16, 0x02, 0xb0, 0x41, 0x3b, 0xcb, 0x74, 0x08, 0x85, 0xc9, 0x75, 0x07, 0x04, 0x04, 0x64,
+    0x00, 0x10, 0xc2, 0xf3, 0x0a, 0x20, 0xb6, 0xca, 0x6d, 0x02, 0x60, 0xc1, 0xe9, 0x03, 0x49, 0x23,
+    0xcb, 0x99, 0x08, 0x61, 0x42, 0x8a, 0x84, 0x31, 0x28, 0x93, 0xd5, 0x02, 0x32, 0x88, 0x43, 0x17,
+    0x62, 0x00, 0x60, 0x09, 0x41, 0x8a, 0x07, 0x24, 0x7f, 0x27, 0x18, 0xf2, 0x01, 0x6b, 0xc0, 0x0e,
+    0x48, 0x8d, 0x05, 0x74, 0x9a, 0x02, 0x00, 0x4c, 0x03, 0xc0, 0xe8, 0xc0, 0xee, 0xa0, 0x02, 0x10,
+    0x57, 0xb7, 0x02, 0x23, 0x8b, 0xc6, 0xb6, 0x02, 0x13, 0x82, 0xb6, 0x02, 0x10, 0x41, 0xdd, 0x02,
+    0x93, 0x39, 0x6b, 0x0c, 0x75, 0x77, 0x4c, 0x8d, 0x43, 0x14, 0x1d, 0x00, 0x22, 0x69, 0xda, 0x1d,
+    0x00, 0x50, 0x24, 0x01, 0x00, 0x00, 0xba, 0xf3, 0x27, 0x91, 0x48, 0x8d, 0x0d, 0x4d, 0x6d, 0x02,
+    0x00, 0xe8, 0x20, 0x26, 0x01, 0x30, 0xc8, 0xe8, 0x18, 0x7e, 0x06, 0x30, 0xb6, 0x53, 0x14, 0x0c,
+    0x00, 0x00, 0x34, 0x0d, 0x64, 0x48, 0x8b, 0xc8, 0x44, 0x38, 0x20, 0xbe, 0x22, 0x16, 0xed, 0x2f,
+    0x10, 0x02, 0x0c, 0x03, 0x50, 0x0f, 0xb7, 0xd0, 0xe8, 0xe5, 0x1e, 0x0f, 0x20, 0x4b, 0x0c, 0x70,
+    0x01, 0x60, 0x0f, 0xb7, 0x50, 0x01, 0xe8, 0x5d, 0x45, 0x0f, 0xf2, 0x0a, 0x8b, 0x75, 0x50, 0x0f,
+    0xb7, 0x06, 0x25, 0xff, 0x07, 0x00, 0x00, 0x89, 0x43, 0x04, 0x8a, 0x46, 0x02, 0x24, 0x0f, 0x88,
+    0x43, 0x18, 0x8a, 0x46, 0x02, 0x96, 0x20, 0x20, 0x43, 0x19, 0x5e, 0x02, 0xf0, 0x18, 0x48, 0x89,
+    0x30, 0x0f, 0xb6, 0x46, 0x07, 0xd1, 0xe8, 0x89, 0x43, 0x5c, 0x0f, 0xb6, 0x46, 0x08, 0x89, 0x43,
+    0x60, 0x0f, 0xb6, 0x46, 0x09, 0x83, 0xe0, 0x7f, 0x89, 0x43, 0x64, 0x0f, 0xb6, 0x46, 0x0a, 0x83,
+    0xe0, 0x03, 0x89, 0x43, 0x68, 0x0a, 0x00, 0x62, 0xc1, 0xe8, 0x02, 0x89, 0x43, 0x6c, 0x19, 0x02,
+    0x36, 0x08, 0x75, 0x63, 0xef, 0x00, 0x70, 0x67, 0xe1, 0xff, 0xff, 0x8b, 0x4b, 0x0c, 0xcb, 0x13,
+    0x10, 0x0f, 0x72, 0x02, 0x14, 0x0a, 0x86, 0x03, 0x20, 0x75, 0x0f, 0x6c, 0x0d, 0x02, 0x29, 0x00,
+    0x30, 0xe8, 0xdd, 0xe4, 0xc8, 0x01, 0xf3, 0x0a, 0x56, 0x06, 0x8b, 0xc2, 0x83, 0xe0, 0x7f, 0x48,
+    0x8d, 0x0c, 0x80, 0x48, 0x8d, 0x0c, 0xcd, 0x70, 0xfd, 0x01, 0x00, 0x49, 0x03, 0xce, 0xf6, 0xc2,
+    0x7f, 0xc6, 0x10, 0xd5, 0x09, 0x48, 0x89, 0x4b, 0x28, 0x48, 0x83, 0xc1, 0x14, 0x48, 0x89, 0x4b,
+    0x30, 0x78, 0x0d, 0x0d, 0xfd, 0x07, 0xd1, 0x48, 0x85, 0xc9, 0x74, 0x2b, 0x44, 0x8b, 0xca, 0x85,
+    0xd2, 0x74, 0x2a, 0x41, 0xaf, 0x18, 0x01, 0x06, 0x00, 0x11, 0x12, 0x06, 0x00, 0x11, 0x0c, 0x06,
+    0x00, 0x20, 0x06, 0x41, 0x1d, 0x12, 0xf0, 0x19, 0x06, 0x41, 0x83, 0xf8, 0x01, 0x76, 0x0c, 0xb8,
+    0x04, 0x00, 0x10, 0x80, 0xc3, 0x41, 0x83, 0xf8, 0x02, 0x75, 0xf4, 0x44, 0x89, 0x41, 0x04, 0x4c,
+    0x8d, 0x05, 0x79, 0x5b, 0x00, 0x00, 0x89, 0x11, 0x48, 0x83, 0xc1, 0x08, 0x4c, 0x2b, 0xc1, 0xba,
+    0x75, 0x19, 0xf4, 0x00, 0x41, 0x8a, 0x04, 0x08, 0x88, 0x01, 0x48, 0xff, 0xc1, 0x48, 0x83, 0xea,
+    0x01, 0x75, 0xf1, 0x29, 0x21, 0x50, 0x40, 0x53, 0x48, 0x81, 0xec, 0x90, 0x09, 0xf0, 0x05, 0x48,
+    0x8b, 0x05, 0xfc, 0xe8, 0x03, 0x00, 0x48, 0x33, 0xc4, 0x48, 0x89, 0x44, 0x24, 0x70, 0x48, 0x8b,
+    0x9c, 0x24, 0xb0, 0x4a, 0x05, 0x02, 0x81, 0x1f, 0x00, 0x86, 0x07, 0x10, 0xc9, 0x26, 0x00, 0x22,
+    0x85, 0xdb, 0x13, 0x08, 0x61, 0x4d, 0x85, 0xc0, 0x0f, 0x84, 0xb7, 0x09, 0x00, 0x00, 0xd5, 0x25,
+    0x00, 0x5a, 0x0e, 0x20, 0xe9, 0xad, 0x9f, 0x07, 0x00, 0xa9, 0x29, 0x81, 0x48, 0x8d, 0x4c, 0x24,
+    0x20, 0xc6, 0x01, 0x00, 0x6e, 0x00, 0xf0, 0x0d, 0xe8, 0x01, 0x75, 0xf4, 0x4d, 0x85, 0xdb, 0x4c,
+    0x89, 0x54, 0x24, 0x20, 0x48, 0x8d, 0x54, 0x24, 0x50, 0x4c, 0x89, 0x44, 0x24, 0x30, 0x49, 0x0f,
+    0x45, 0xd3, 0x4c, 0x89, 0x36, 0x0e, 0x80, 0x8b, 0xca, 0xc6, 0x44, 0x24, 0x4c, 0xff, 0xb8, 0x6d,
+    0x12, 0x08, 0x34, 0x00, 0x71, 0x48, 0x89, 0x54, 0x24, 0x28, 0xb8, 0x48, 0x7e, 0x04, 0x72, 0xd3,
+    0xc6, 0x02, 0x00, 0x48, 0xff, 0xc2, 0x19, 0x00, 0x81, 0x41, 0x8b, 0x02, 0x48, 0x8b, 0xd3, 0x89,
+    0x03, 0x4c, 0x17, 0x61, 0x41, 0x8b, 0x4a, 0x04, 0xd2, 0xe0, 0x71, 0x00, 0x51, 0x88, 0x43, 0x15,
+    0xe8, 0xd1, 0x52, 0x11, 0x20, 0x78, 0x26, 0xbd, 0x01, 0x00, 0x14, 0x00, 0x21, 0xe8, 0xb4, 0xae,
+    0x02, 0x70, 0x78, 0x15, 0x8b, 0x43, 0x0c, 0x89, 0x83, 0x38, 0x07, 0x02, 0x87, 0x09, 0x11, 0x05,
+    0x34, 0x01, 0xf0, 0x01, 0x48, 0x8b, 0x4c, 0x24, 0x70, 0x48, 0x33, 0xcc, 0xe8, 0xd2, 0x38, 0x00,
+    0x00, 0x48, 0x81, 0xc4, 0x08, 0x01, 0x82, 0x5b, 0xc3, 0xcc, 0x0f, 0xb7, 0xc2, 0x85, 0xc9, 0xef,
+    0x17, 0x15, 0x4c, 0xe9, 0x19, 0x11, 0x23, 0x52, 0x17, 0xc0, 0x48, 0x6b, 0xc8, 0x11, 0x48, 0x8d,
+    0x05, 0x52, 0xdd, 0x01, 0x00, 0xeb, 0x8d, 0x18, 0x60, 0xc0, 0x48, 0x8d, 0x05, 0x55, 0x5d, 0xf2,
+    0x00, 0xf0, 0x17, 0x04, 0x48, 0xeb, 0x0e, 0x48, 0xc1, 0xe0, 0x04, 0x48, 0x8d, 0x0d, 0x84, 0x5d,
+    0x01, 0x00, 0x48, 0x03, 0xc1, 0x49, 0x89, 0x00, 0xc3, 0x48, 0x6b, 0xc8, 0x0f, 0x48, 0x8d, 0x05,
+    0xd2, 0xd2, 0x01, 0x00, 0xeb, 0x18, 0x48, 0x6b, 0xc8, 0x5f, 0x03, 0x63, 0x25, 0xd0, 0x01, 0x00,
+    0xeb, 0x0b, 0x1a, 0x00, 0x20, 0x18, 0xf8, 0x2c, 0x00, 0xf1, 0x02, 0xc8, 0x49, 0x89, 0x08, 0xc3,
+    0xcc, 0x44, 0x0f, 0xb6, 0x01, 0x41, 0x83, 0xf8, 0x0f, 0x0f, 0x87, 0xf7, 0x96, 0x09, 0x10, 0xd3,
+    0x37, 0x06, 0x61, 0x83, 0xf8, 0x08, 0x0f, 0x87, 0x12, 0x10, 0x00, 0x01, 0x4a, 0x15, 0x32, 0x83,
+    0xe8, 0x01, 0x8b, 0x01, 0x02, 0x0a, 0x00, 0x00, 0x61, 0x13, 0x00, 0x0a, 0x00, 0x21, 0x74, 0x7d,
+    0x06, 0x00, 0x11, 0x59, 0x06, 0x00, 0x80, 0x35, 0x0f, 0xb7, 0x49, 0x01, 0x0f, 0xb7, 0xc2, 0x1f,
+    0x02, 0xf1, 0x04, 0x74, 0x14, 0x48, 0x8d, 0x0c, 0x88, 0x48, 0x8d, 0x04, 0x49, 0x48, 0x8d, 0x0d,
+    0x0a, 0xd6, 0x03, 0x00, 0xe9, 0x63, 0x85, 0x12, 0x23, 0x0c, 0x48, 0x14, 0x00, 0x50, 0x86, 0x8f,
+    0x02, 0x00, 0xe9, 0x60, 0x12, 0x41, 0x0f, 0xb7, 0x41, 0x01, 0x38, 0x19, 0x12, 0xb7, 0x38, 0x19,
+    0x01, 0x1e, 0x00, 0x61, 0x80, 0x97, 0x02, 0x00, 0xe9, 0x31, 0x1e, 0x00, 0x69, 0x49, 0x01, 0x48,
+    0xc1, 0xe1, 0x08, 0x1e, 0x00, 0x64, 0xba, 0x4b, 0x03, 0x00, 0xe9, 0x13, 0x3c, 0x00, 0x39, 0x6b,
+    0xc8, 0x31, 0x1e, 0x00, 0x60, 0x1c, 0x41, 0x03, 0x00, 0xe9, 0xf5, 0xbb, 0x00, 0x02, 0x1e, 0x00,
+    0x19, 0x11, 0x1e, 0x00, 0x66, 0x8e, 0x40, 0x03, 0x00, 0xe9, 0xd7, 0x1e, 0x00, 0x19, 0x0d, 0x1e,
+    0x00, 0x61, 0xe0, 0xd0, 0x02, 0x00, 0xe9, 0xb9, 0x1e, 0x00, 0x01, 0xcb, 0x00, 0x07, 0xb1, 0x00,
+    0x61, 0x75, 0xd1, 0x02, 0x00, 0xe9, 0x9e, 0x1c, 0x01, 0x54, 0xe8, 0x09, 0x0f, 0x84, 0x92, 0x02,
+    0x01, 0x11, 0x71, 0x06, 0x00, 0x10, 0x50, 0x4f, 0x00, 0x01, 0x0a, 0x00, 0x1a, 0x2c, 0xcd, 0x00,
+    0x01, 0x0d, 0x01, 0xa0, 0x0c, 0x48, 0x8d, 0x0d, 0xd5, 0x96, 0x02, 0x00, 0xe9, 0x5e, 0x58, 0x02,
+    0x81, 0x8d, 0x0d, 0x19, 0xd5, 0x03, 0x00, 0xe9, 0x52, 0x0c, 0x00, 0x29, 0x0c, 0x80, 0x81, 0x00,
+    0x6f, 0x5f, 0x26, 0x03, 0x00, 0xe9, 0x38, 0x81, 0x00, 0x02, 0x69, 0xd4, 0x82, 0x02, 0x00, 0xe9,
+    0x1d, 0x1b, 0x00, 0x04, 0x36, 0x00, 0x50, 0xe9, 0x43, 0x03, 0x00, 0xe9, 0x35, 0x08, 0x0e, 0x1b,
+    0x00, 0x10, 0xbe, 0x36, 0x00, 0x10, 0xe7, 0x7a, 0x07, 0x0f, 0x68, 0x01, 0x01, 0x50, 0x50, 0x98,
+    0x02, 0x00, 0xe9, 0xd7, 0x01, 0x0b, 0x6f, 0x00, 0xe1, 0x41, 0x83, 0xf8, 0x16, 0x77, 0x62, 0x74,
+    0x57, 0x41, 0x83, 0xe8, 0x10, 0x74, 0x48, 0xd8, 0x00, 0x11, 0x39, 0x06, 0x00, 0x11, 0x2a, 0x06,
+    0x00, 0x15, 0x1b, 0xd6, 0x00, 0x10, 0x5f, 0x4f, 0x01, 0x00, 0xa7, 0x0c, 0xf0, 0x10, 0x48, 0x8d,
+    0x0d, 0xd3, 0xcf, 0x02, 0x00, 0xeb, 0x7f, 0x48, 0x8d, 0x0d, 0x8a, 0x40, 0x03, 0x00, 0xeb, 0x76,
+    0x48, 0x8d, 0x0d, 0xd1, 0x67, 0x02, 0x00, 0xeb, 0x6d, 0x48, 0x8d, 0x0d, 0x64, 0x12, 0x00, 0xf1,
+    0x0a, 0x64, 0x48, 0x8d, 0x0d, 0x3f, 0xfc, 0x02, 0x00, 0xeb, 0x5b, 0x48, 0x8d, 0x0d, 0xae, 0x95,
+    0x02, 0x00, 0xeb, 0x52, 0x41, 0x83, 0xe8, 0x17, 0x74, 0x45, 0x54, 0x00, 0x11, 0x36, 0x06, 0x00,
+    0x11, 0x27, 0x06, 0x00, 0x11, 0x18, 0x60, 0x00, 0x50, 0x09, 0x48, 0x8d, 0x0d, 0xef, 0x54, 0x00,
+    0xf0, 0x11, 0x2b, 0x48, 0x8d, 0x0d, 0xea, 0x3f, 0x03, 0x00, 0xeb, 0x22, 0x48, 0x8d, 0x0d, 0xc5,
+    0x81, 0x02, 0x00, 0xeb, 0x19, 0x48, 0x8d, 0x0d, 0xc4, 0xd3, 0x03, 0x00, 0xeb, 0x10, 0x48, 0x8d,
+    0x0d, 0xc3, 0x1b, 0x00, 0x70, 0x07, 0x48, 0x8d, 0x0d, 0x3a, 0xd5, 0x03, 0x02, 0x03, 0x00, 0xd5,
+    0x23, 0x07, 0x01, 0x00, 0xf0, 0x0c, 0x0f, 0x01, 0xc1, 0xc3, 0x0f, 0x01, 0xc1, 0x48, 0x8b, 0xc2,
+    0xc3, 0x9c, 0x41, 0x53, 0x50, 0x51, 0x52, 0x41, 0x50, 0x41, 0x51, 0x48, 0x8b, 0xc4, 0xc7, 0x05,
+    0x2e, 0x5d, 0x0b, 0x00, 0xbc, 0x00, 0xd1, 0x83, 0xe0, 0x0f, 0x48, 0x85, 0xc0, 0x74, 0x0e, 0xc7,
+    0x05, 0x1b, 0xe4, 0x03, 0xea, 0x21, 0xf6, 0x12, 0x48, 0x83, 0xec, 0x08, 0xe8, 0x22, 0x29, 0x00,
+    0x00, 0x8b, 0x05, 0x0c, 0xe4, 0x03, 0x00, 0x85, 0xc0, 0x74, 0x04, 0x48, 0x83, 0xc4, 0x08, 0x41,
+    0x59, 0x41, 0x58, 0x5a, 0x59, 0x58, 0x41, 0x5b, 0x9d, 0x65, 0x00, 0x60, 0x4c, 0x8b, 0x14, 0x24,
+    0x4c, 0x8d, 0xb8, 0x15, 0xf0, 0x0e, 0x83, 0xec, 0x30, 0x8c, 0xd0, 0x50, 0x41, 0x53, 0x9c, 0x8c,
+    0xc8, 0x50, 0x41, 0x52, 0x48, 0x83, 0xec, 0x10, 0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54,
+    0x57, 0x56, 0x55, 0xf2, 0x04, 0x00, 0x39, 0x0b, 0xf0, 0x06, 0x48, 0x8d, 0x44, 0x24, 0x70, 0x66,
+    0x0f, 0x7f, 0x70, 0xb0, 0x66, 0x0f, 0x7f, 0x78, 0xc0, 0x66, 0x44, 0x0f, 0x7f, 0x40, 0xd0, 0x06,
+    0x00, 0x20, 0x48, 0xe0, 0x06, 0x00, 0x20, 0x50, 0xf0, 0x06, 0x00, 0x10, 0x18, 0x05, 0x00, 0x20,
+    0x60, 0x10, 0x06, 0x00, 0x20, 0x68, 0x20, 0x06, 0x00, 0x20, 0x70, 0x30, 0x06, 0x00, 0x91, 0x78,
+    0x50, 0x4c, 0x8d, 0x04, 0x24, 0xe8, 0xca, 0x0d, 0xc2, 0x06, 0x03, 0x4a, 0x00, 0x10, 0x6f, 0x4a,
+    0x00, 0x11, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a,
+    0x00, 0x10, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a, 0x00, 0x11, 0x6f, 0x4a,
+    0x00, 0xf0, 0x23, 0x6f, 0x78, 0x50, 0x48, 0x8d, 0x40, 0x78, 0x48, 0x8b, 0x58, 0xe8, 0x48, 0x8b,
+    0x68, 0xf0, 0x48, 0x8b, 0x70, 0xf8, 0x48, 0x8b, 0x38, 0x4c, 0x8b, 0x60, 0x08, 0x4c, 0x8b, 0x68,
+    0x10, 0x4c, 0x8b, 0x70, 0x18, 0x4c, 0x8b, 0x78, 0x20, 0x48, 0x8d, 0x60, 0x18, 0x48, 0x8b, 0x54,
+    0x24, 0x58, 0x49, 0xc7, 0xc0, 0x15, 0x01, 0x30, 0xff, 0xd1, 0x48, 0xc3, 0x0e, 0x60, 0x05, 0x48,
+    0x8b, 0x44, 0xc4, 0x48, 0xb0, 0x05, 0x10, 0x20, 0x86, 0x00, 0x03, 0x21, 0x00, 0x00, 0x3e, 0x0c,
+    0x00, 0xfd, 0x04, 0x40, 0x48, 0xe8, 0xfb, 0x0c, 0x40, 0x01, 0xf0, 0x0a, 0xc4, 0x20, 0x48, 0xcf,
+    0xcc, 0x48, 0x8d, 0x05, 0xed, 0x53, 0x00, 0x00, 0x48, 0x89, 0x01, 0x48, 0x8b, 0x42, 0x08, 0x48,
+    0x89, 0x41, 0x08, 0x48, 0x8b, 0xa0, 0x01, 0x41, 0x48, 0x8d, 0x05, 0xd5, 0x18, 0x00, 0x21, 0x51,
+    0x08, 0x1c, 0x00, 0x00, 0x14, 0x00, 0x02, 0x3c, 0x27, 0x81, 0x48, 0x8b, 0xd9, 0x48, 0x89, 0x11,
+    0xe8, 0x0f, 0x6e, 0x07, 0x12, 0xc3, 0xb6, 0x26, 0x00, 0x08, 0x22, 0x50, 0x01, 0x0f, 0x22, 0xd8,
+    0xc3, 0x38, 0x00, 0x12, 0x9d, 0x50, 0x00, 0x00, 0xa0, 0x1b, 0x21, 0x01, 0xc7, 0xbf, 0x01, 0x0b,
+    0xf0, 0x01, 0x03, 0x48, 0x00, 0x30, 0x8d, 0x05, 0x73, 0x2a, 0x00, 0x00, 0x4f, 0x00, 0x8a, 0x01,
+    0xf6, 0xc2, 0x01, 0x74, 0x05, 0xe8, 0xdb, 0x54, 0x00, 0x04, 0x01, 0x00, 0x34, 0xc2, 0x00, 0x00,
+    0x78, 0x17, 0x00, 0x02, 0x1c, 0x04, 0x1d, 0x27, 0x50, 0x30, 0x48, 0xbe, 0x00, 0xf0, 0x33, 0x0c,
+    0x01, 0xc3, 0x27, 0x70, 0x48, 0x23, 0xce, 0xff, 0x15, 0x02, 0x52, 0x0c, 0x00, 0x30, 0xcb, 0xbd,
+    0xff, 0xba, 0x03, 0x41, 0xc1, 0xe9, 0x27, 0xbf, 0x2a, 0x02, 0xb0, 0x23, 0xcd, 0x48, 0x8b, 0x0c,
+    0xc8, 0x40, 0x84, 0xcf, 0x0f, 0x84, 0x68, 0x03, 0x01, 0x2a, 0x00, 0x21, 0xd8, 0x51, 0x2a, 0x00,
+    0x48, 0x48, 0xc1, 0xe9, 0x1e, 0x20, 0x00, 0x00, 0x69, 0x08, 0x41, 0x84, 0xc9, 0x79, 0x1b, 0x93,
+    0x0d, 0x11, 0xc0, 0x5b, 0x00, 0xf1, 0x01, 0x23, 0xc8, 0xff, 0x15, 0xaa, 0x51, 0x00, 0x00, 0x81,
+    0xe3, 0xff, 0xff, 0xff, 0x3f, 0xeb, 0x6a, 0x3f, 0x00, 0x15, 0x99, 0x3f, 0x00, 0x18, 0x15, 0x3f,
+    0x00, 0x17, 0xd4, 0x3f, 0x00, 0x12, 0xe0, 0x9a, 0x00, 0x00, 0x3f, 0x00, 0x13, 0x6b, 0x3f, 0x00,
+    0x10, 0x1f, 0x2a, 0x03, 0x00, 0x3f, 0x00, 0x15, 0x5a, 0x3f, 0x00, 0x16, 0x0c, 0x3f, 0x00, 0x21,
+    0x74, 0x27, 0x1c, 0x00, 0x12, 0x3e, 0x2d, 0x00, 0x10, 0x0f, 0x22, 0x00, 0x67, 0x6c, 0x24, 0x48,
+    0x48, 0x03, 0xc3, 0x85, 0x15, 0xd3, 0x83, 0xc4, 0x30, 0x5f, 0xc3, 0x44, 0x8b, 0xc7, 0x48, 0x8d,
+    0x15, 0xd6, 0x39, 0x51, 0x07, 0x11, 0xe8, 0xe0, 0x0b, 0x53, 0x8d, 0x15, 0xa5, 0xde, 0x03, 0x11,
+    0x00, 0x52, 0x0b, 0xfd, 0xff, 0xff, 0xcc, 0x26, 0x00, 0x10, 0x90, 0xc2, 0x06, 0x01, 0x15, 0x00,
+    0x12, 0x2a, 0x26, 0x00, 0x15, 0x7f, 0x26, 0x00, 0x25, 0xe5, 0xfc, 0x26, 0x00, 0x15, 0xca, 0x26,
+    0x00, 0x12, 0x04, 0x26, 0x00, 0x15, 0x59, 0x26, 0x00, 0x16, 0xbf, 0x26, 0x00, 0x15, 0x04, 0x72,
+    0x00, 0x21, 0xde, 0xfd, 0x26, 0x00, 0x15, 0x33, 0x26, 0x00, 0x10, 0x99, 0x26, 0x00, 0x10, 0x41,
+    0x65, 0x2c, 0x30, 0x00, 0x41, 0xb9, 0x45, 0x24, 0xf1, 0x0e, 0x48, 0x8b, 0x01, 0x8b, 0x10, 0x85,
+    0xd2, 0x75, 0x0a, 0x48, 0x8b, 0x01, 0xf0, 0x0f, 0xba, 0x28, 0x00, 0x73, 0x20, 0x45, 0x85, 0xc0,
+    0x74, 0x0b, 0x41, 0x8b, 0xc0, 0xf3, 0x90, 0xb0, 0x07, 0xf5, 0x02, 0xf8, 0x43, 0x8d, 0x04, 0x00,
+    0x41, 0x3b, 0xc1, 0x44, 0x8b, 0xc0, 0x45, 0x0f, 0x47, 0xc1, 0xeb, 0xcd, 0xf2, 0x01, 0xa0, 0x48,
+    0x83, 0x79, 0x08, 0x00, 0x48, 0x8d, 0x05, 0xb4, 0x37, 0xa0, 0x0e, 0x21, 0x45, 0x41, 0x2d, 0x2f,
+    0x07, 0x01, 0x00, 0x50, 0x48, 0x83, 0xec, 0x38, 0x48, 0xfe, 0x27, 0x00, 0x7a, 0x00, 0x12, 0x3b,
+    0x8b, 0x00, 0x24, 0xa8, 0xdd, 0x8b, 0x00, 0x10, 0x0e, 0x8b, 0x00, 0x00, 0x88, 0x02, 0x10, 0x15,
+    0x65, 0x01, 0x07, 0xd8, 0x02, 0x34, 0x8d, 0x05, 0x1b, 0x12, 0x00, 0x61, 0xc1, 0xc3, 0x48, 0x8d,
+    0x05, 0x0d, 0x0e, 0x00, 0x07, 0xe0, 0x02, 0x01, 0x64, 0x02, 0x01, 0x77, 0x29, 0xa0, 0x48, 0x8b,
+    0xf9, 0x48, 0x8b, 0x0d, 0xfc, 0xe0, 0x03, 0x00, 0x74, 0x09, 0x10, 0x10, 0xcd, 0x00, 0xf0, 0x0c,
+    0xd7, 0x48, 0x8b, 0x00, 0xff, 0x15, 0xd9, 0x4f, 0x00, 0x00, 0xeb, 0x11, 0x41, 0xb8, 0x66, 0x6d,
+    0x69, 0x63, 0x48, 0x8b, 0xd7, 0x33, 0xc9, 0xff, 0x15, 0x96, 0x4f, 0xaa, 0x01, 0x10, 0xd8, 0x9f,
+    0x04, 0x60, 0x0d, 0x4c, 0x8b, 0xc7, 0x33, 0xd2, 0xc3, 0x0a, 0x22, 0x39, 0x32, 0xca, 0x02, 0x01,
+    0xcd, 0x28, 0x05, 0xc8, 0x28, 0xa3, 0x83, 0xec, 0x28, 0x4c, 0x8b, 0xc1, 0x48, 0x8b, 0x0d, 0xa2,
+    0x5a, 0x00, 0xf1, 0x03, 0x16, 0x48, 0x8b, 0x01, 0x49, 0x8b, 0xd0, 0x48, 0x8b, 0x40, 0x10, 0xff,
+    0x15, 0x7d, 0x4f, 0x00, 0x00, 0x90, 0xf7, 0x16, 0x10, 0xba, 0x5f, 0x00, 0x30, 0x49, 0x8b, 0xc8,
+    0x0d, 0x00, 0x40, 0x48, 0xff, 0x25, 0x3c, 0x62, 0x00, 0x0b, 0x9c, 0x00, 0x13, 0x60, 0x42, 0x00,
+    0x70, 0x14, 0x48, 0x8b, 0x01, 0x4c, 0x8b, 0xc2, 0x9f, 0x00, 0x5e, 0x40, 0x08, 0xff, 0x15, 0x39,
+    0xa0, 0x00, 0x2f, 0xf6, 0x4e, 0xa0, 0x00, 0x00, 0x2f, 0x99, 0x31, 0xa0, 0x00, 0x04, 0x6f, 0xff,
+    0x15, 0xd6, 0x4e, 0x00, 0x00, 0x70, 0x01, 0x00, 0xf0, 0x01, 0x83, 0x64, 0x24, 0x20, 0x00, 0x45,
+    0x33, 0xc9, 0x45, 0x33, 0xc0, 0x33, 0xd2, 0x33, 0xc9, 0xe8, 0x08, 0x15, 0x0c, 0x8c, 0x01, 0x12,
+    0xa7, 0x3d, 0x02, 0x24, 0x9c, 0xdc, 0x8c, 0x01, 0x21, 0x82, 0xfa, 0x8c, 0x01, 0x06, 0xbc, 0x00,
+    0x40, 0x83, 0x25, 0xae, 0xdf, 0xde, 0x0b, 0xb0, 0x8d, 0x05, 0xa7, 0xdf, 0x03, 0x00, 0x48, 0x89,
+    0x05, 0xa0, 0xe1, 0x2c, 0x00, 0x20, 0x1d, 0xb9, 0xa5, 0x00, 0x31, 0x89, 0x05, 0x9a, 0x0e, 0x00,
+    0x20, 0x3d, 0xb3, 0x0e, 0x00, 0xf1, 0x11, 0x3b, 0xdf, 0x74, 0x18, 0x48, 0x83, 0x3b, 0x00, 0x74,
+    0x0c, 0x33, 0xc0, 0xff, 0x15, 0x60, 0x4e, 0x00, 0x00, 0x85, 0xc0, 0x75, 0x2d, 0x48, 0x83, 0xc3,
+    0x08, 0xeb, 0xe3, 0x48, 0x8d, 0x1d, 0x77, 0xd7, 0x00, 0x10, 0x03, 0xd7, 0x00, 0x40, 0x06, 0xff,
+    0x15, 0x41, 0x0e, 0x00, 0x20, 0x83, 0xc3, 0xe5, 0x01, 0x11, 0x66, 0x3d, 0x00, 0x57, 0xd8, 0x75,
+    0xe2, 0x33, 0xc0, 0xdf, 0x00, 0x00, 0xdc, 0x00, 0x20, 0xb9, 0x1e, 0x23, 0x05, 0x30, 0x15, 0xf5,
+    0x4d, 0x50, 0x04, 0xf0, 0x15, 0x3b, 0xca, 0x74, 0x19, 0x48, 0x83, 0xc2, 0x09, 0x48, 0x8d, 0x41,
+    0x09, 0x48, 0x2b, 0xd0, 0x8a, 0x08, 0x3a, 0x0c, 0x10, 0x75, 0x0a, 0x48, 0xff, 0xc0, 0x84, 0xc9,
+    0x75, 0xf2, 0x33, 0xc0, 0xc3, 0x1b, 0xc0, 0x83, 0xc8, 0xc4, 0x04, 0x04, 0x38, 0x00, 0x30, 0xe8,
+    0xde, 0xfe, 0xcc, 0x00, 0x00, 0x01, 0x00, 0x40, 0xcd, 0x2c, 0x33, 0xc0, 0x30, 0x01, 0x36, 0xcd,
+    0x2c, 0xc3, 0x28, 0x0b, 0x30, 0xb8, 0x4d, 0x5a, 0xc3, 0x00, 0xc0, 0x11, 0x4c, 0x8b, 0xca, 0x4c,
+    0x8b, 0xd9, 0x66, 0x39, 0x02, 0x0f, 0x85, 0x41, 0x27, 0x80, 0x4c, 0x63, 0x52, 0x3c, 0x41, 0x81,
+    0x3c, 0x12, 0x94, 0x35, 0x20, 0x0f, 0x85, 0x58, 0x2a, 0x30, 0xb8, 0x64, 0x86, 0x65, 0x12, 0x60,
+    0x39, 0x44, 0x12, 0x04, 0x0f, 0x85, 0xf0, 0x0e, 0x33, 0xb8, 0x0b, 0x02, 0x11, 0x00, 0x41, 0x18,
+    0x0f, 0x85, 0x86, 0xbc, 0x0a, 0x51, 0x4c, 0x12, 0x54, 0x49, 0x8d, 0x1b, 0x2c, 0xf0, 0x02, 0x48,
+    0x3b, 0xc8, 0x72, 0x75, 0x41, 0x39, 0x4c, 0x12, 0x50, 0x72, 0x6e, 0x41, 0x83, 0xbc, 0x12, 0x84,
+    0xdf, 0x27, 0x60, 0x72, 0x63, 0x45, 0x8b, 0x84, 0x12, 0x81, 0x20, 0x42, 0x48, 0xbb, 0xab, 0xaa,
+    0x01, 0x00, 0x90, 0x48, 0x8b, 0xc3, 0x49, 0xf7, 0xe0, 0x48, 0xc1, 0xea, 0x68, 0x16, 0xf1, 0x00,
+    0x52, 0x48, 0xc1, 0xe1, 0x02, 0x4c, 0x3b, 0xc1, 0x75, 0x3a, 0x43, 0x8b, 0x8c, 0x0a, 0xa0, 0xc7,
+    0x0b, 0x80, 0xc3, 0x49, 0x03, 0xc9, 0x49, 0x89, 0x4b, 0x08, 0x12, 0x00, 0x01, 0x3b, 0x00, 0x20,
+    0xf7, 0xe1, 0x2e, 0x00, 0xf5, 0x01, 0x41, 0x89, 0x53, 0x10, 0x43, 0x8b, 0x44, 0x0a, 0x50, 0x41,
+    0x89, 0x43, 0x14, 0x49, 0x8b, 0xc3, 0xef, 0x0a, 0x60, 0x0f, 0x57, 0xc0, 0xc7, 0x44, 0x24, 0x28,
+    0x1e, 0x40, 0x00, 0x0f, 0x57, 0xd2, 0xd0, 0x01, 0xf2, 0x1f, 0x50, 0xf3, 0x0f, 0x7f, 0x44, 0x24,
+    0x28, 0x0f, 0x10, 0x44, 0x24, 0x20, 0xf3, 0x0f, 0x7f, 0x54, 0x24, 0x38, 0x0f, 0x10, 0x4c, 0x24,
+    0x30, 0x66, 0x0f, 0x15, 0xd2, 0x0f, 0x29, 0x44, 0x24, 0x50, 0x0f, 0x29, 0x4c, 0x24, 0x60, 0xf2,
+    0x0f, 0x11, 0x54, 0x24, 0x70, 0xe8, 0x4c, 0x02, 0x46, 0x02, 0xf1, 0x14, 0x83, 0x79, 0x04, 0x00,
+    0x74, 0x12, 0x44, 0x8b, 0x41, 0x04, 0x4c, 0x03, 0xc2, 0x8b, 0x11, 0x49, 0x8b, 0x00, 0x8b, 0x14,
+    0x02, 0x49, 0x03, 0xd0, 0x8b, 0x41, 0x08, 0x48, 0x03, 0xc2, 0xc3, 0xcc, 0x48, 0x81, 0xec, 0x9d,
+    0x08, 0xf0, 0x45, 0x39, 0x11, 0x77, 0x55, 0x8b, 0x41, 0x14, 0x4c, 0x8b, 0xc2, 0x4c, 0x2b, 0x01,
+    0x4c, 0x3b, 0xc0, 0x7d, 0x47, 0x2b, 0x11, 0x45, 0x33, 0xc9, 0x44, 0x8b, 0x51, 0x10, 0x45, 0x85,
+    0xd2, 0x74, 0x2f, 0x4c, 0x8b, 0x59, 0x08, 0x45, 0x8b, 0xc2, 0x45, 0x2b, 0xc1, 0x41, 0xd1, 0xe8,
+    0x45, 0x03, 0xc1, 0x4b, 0x8d, 0x0c, 0x40, 0x49, 0x8d, 0x04, 0x8b, 0x3b, 0x10, 0x73, 0x05, 0x45,
+    0x8b, 0xd0, 0xeb, 0x09, 0x3b, 0x50, 0x04, 0x72, 0x0b, 0x45, 0x8d, 0x48, 0x01, 0x45, 0x3b, 0xca,
+    0x72, 0xd5, 0x33, 0xc0, 0x48, 0x81, 0xc4, 0x59, 0x00, 0x04, 0xc7, 0x00, 0x00, 0xfd, 0x06, 0x0f,
+    0xc7, 0x00, 0x20, 0x45, 0x85, 0x01, 0x00, 0x00, 0xb0, 0x06, 0x30, 0x15, 0xa3, 0xbb, 0x18, 0x10,
+    0x31, 0xd9, 0xe8, 0x07, 0x51, 0x11, 0x06, 0xfc, 0x06, 0xa0, 0x83, 0x79, 0x20, 0x00, 0x48, 0x8b,
+    0x41, 0x18, 0x75, 0x0a, 0x8f, 0x02, 0x61, 0x05, 0x48, 0x8b, 0x40, 0x18, 0xc3, 0x14, 0x07, 0x20,
+    0x51, 0x18, 0x18, 0x34, 0xf1, 0x00, 0x0e, 0x48, 0x8b, 0x41, 0x20, 0x48, 0x85, 0xc0, 0x75, 0x07,
+    0x48, 0x8b, 0x42, 0x20, 0xc3, 0x3d, 0x02, 0x03, 0xf8, 0x00, 0xf1, 0x00, 0x0f, 0xb6, 0xc2, 0x80,
+    0xea, 0x06, 0x80, 0xfa, 0x09, 0x77, 0x13, 0x48, 0x83, 0xc0, 0xfa, 0x29, 0x0c, 0x24, 0x03, 0xc1,
+    0xbc, 0x00, 0x01, 0x74, 0x03, 0x01, 0xb3, 0x00, 0x00, 0x7f, 0x03, 0x50, 0x40, 0x00, 0x0f, 0x57,
+    0xc9, 0xd5, 0x07, 0x02, 0xbb, 0x00, 0x01, 0xa7, 0x00, 0x01, 0xb1, 0x00, 0x10, 0xf2, 0x10, 0x00,
+    0x93, 0x40, 0xf2, 0x0f, 0x11, 0x44, 0x24, 0x70, 0xe8, 0xd3, 0x98, 0x03, 0x20, 0x81, 0xec, 0x97,
+    0x27, 0x61, 0x66, 0x0f, 0x6f, 0x05, 0x3d, 0x4c, 0x68, 0x00, 0x01, 0xf6, 0x00, 0xf0, 0x06, 0x20,
+    0x48, 0x0f, 0xbe, 0x54, 0x04, 0x20, 0x48, 0x8b, 0xc2, 0x84, 0xd2, 0x78, 0x10, 0x48, 0x83, 0xc0,
+    0x16, 0x48, 0x8d, 0x04, 0x70, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x70, 0x00, 0x11, 0x30, 0x70, 0x00,
+    0x10, 0x60, 0x70, 0x00, 0x14, 0x50, 0x70, 0x00, 0x10, 0x38, 0x60, 0x00, 0x10, 0x30, 0x70, 0x00,
+    0x10, 0x70, 0x70, 0x00, 0x11, 0x60, 0x70, 0x00, 0x42, 0x50, 0xf2, 0x0f, 0x11, 0xb2, 0x17, 0x22,
+    0xe8, 0x60, 0x73, 0x00, 0x00, 0xf0, 0x07, 0x04, 0xc0, 0x2e, 0x08, 0xa8, 0x07, 0x70, 0x20, 0x48,
+    0x8b, 0xf2, 0x49, 0x8b, 0xf8, 0xd2, 0x13, 0xb2, 0xd9, 0x48, 0x8b, 0xe9, 0x44, 0x8d, 0x42, 0x58,
+    0xe8, 0x19, 0x2d, 0xbe, 0x03, 0xa2, 0x89, 0x45, 0x08, 0x48, 0x8b, 0xc5, 0x48, 0x89, 0x5d, 0x18,
+    0xac, 0x03, 0x32, 0x89, 0x75, 0x50, 0xfc, 0x2d, 0x30, 0x89, 0x7d, 0x20, 0xff, 0x06, 0x14, 0x38,
+    0x9d, 0x04, 0x02, 0x68, 0x04, 0xf1, 0x01, 0x41, 0x20, 0x4c, 0x8b, 0x49, 0x18, 0x4c, 0x8b, 0x41,
+    0x10, 0x48, 0x8b, 0x51, 0x08, 0x8b, 0x09, 0xe3, 0x08, 0x42, 0xff, 0x15, 0x2b, 0x4a, 0xf4, 0x00,
+    0x0a, 0x8c, 0x2a, 0x0a, 0x04, 0x1a, 0xf0, 0x08, 0x32, 0xe4, 0x0f, 0x29, 0x70, 0xc8, 0x33, 0xff,
+    0x49, 0x8b, 0xf0, 0x4c, 0x8b, 0xfa, 0x48, 0x8b, 0xe9, 0x40, 0x38, 0x79, 0x02, 0x0f, 0x86, 0x37,
+    0x09, 0xf0, 0x07, 0x44, 0x8d, 0x6f, 0x01, 0x45, 0x8b, 0xf5, 0x0f, 0xb6, 0x54, 0x7d, 0x05, 0x8b,
+    0xca, 0x83, 0xe1, 0x0f, 0x83, 0xf9, 0x05, 0x0f, 0x87, 0x6a, 0x1d, 0x60, 0x0f, 0x84, 0xd2, 0x00,
+    0x00, 0x00, 0xe5, 0x0e, 0x13, 0xab, 0x52, 0x15, 0x10, 0x70, 0x05, 0x00, 0x10, 0x58, 0x05, 0x00,
+    0x11, 0x2f, 0x06, 0x13, 0x11, 0x69, 0x88, 0x0e, 0xf0, 0x05, 0x46, 0x18, 0x41, 0x03, 0xfd, 0x45,
+    0x03, 0xf5, 0xc0, 0xea, 0x04, 0x0f, 0xb7, 0x4c, 0x7d, 0x04, 0x48, 0x8b, 0x1c, 0xc8, 0x2c, 0x12,
+    0x10, 0x76, 0x29, 0x02, 0x40, 0x89, 0x18, 0xe9, 0x43, 0x70, 0x1c, 0x90, 0x55, 0x03, 0x49, 0x8b,
+    0xcf, 0x80, 0xe2, 0x0f, 0xe8, 0x9d, 0x13, 0xf0, 0x03, 0x0f, 0xb6, 0x4d, 0x03, 0x83, 0xe1, 0xf0,
+    0x48, 0x8b, 0x00, 0x48, 0x2b, 0xc1, 0x48, 0x89, 0x46, 0x18, 0xe9, 0x6a, 0x1a, 0x60, 0xc1, 0xea,
+    0x04, 0x8d, 0x0c, 0xd5, 0xa5, 0x1f, 0x50, 0x48, 0x01, 0x4e, 0x18, 0xe9, 0xb6, 0x1f, 0xb2, 0xf6,
+    0xc2, 0xf0, 0x75, 0x15, 0x41, 0x03, 0xfd, 0x41, 0x8b, 0xc5, 0x5b, 0x00, 0x30, 0xc1, 0xe1, 0x03,
+    0x1d, 0x00, 0xb1, 0xeb, 0x14, 0x41, 0x8b, 0xc6, 0x0f, 0xb7, 0x4c, 0x45, 0x04, 0xb8, 0xd9, 0x09,
+    0x91, 0x01, 0x4e, 0x18, 0x83, 0xc7, 0x02, 0x44, 0x03, 0xf0, 0x99, 0x2a, 0x00, 0x93, 0x00, 0xb0,
+    0x49, 0x8b, 0xcf, 0xc0, 0xea, 0x04, 0x48, 0x8b, 0x18, 0xe8, 0xef, 0x24, 0x07, 0x80, 0x89, 0x18,
+    0x48, 0x83, 0x46, 0x18, 0x08, 0xe9, 0x9d, 0x0f, 0x11, 0x8b, 0xa4, 0x00, 0x21, 0x46, 0x18, 0x20,
+    0x00, 0x20, 0x1c, 0x01, 0xab, 0x00, 0x12, 0xcb, 0x24, 0x00, 0x80, 0x83, 0xc7, 0x02, 0x41, 0x83,
+    0xc6, 0x02, 0xe9, 0x47, 0x36, 0x33, 0x83, 0xe9, 0x06, 0x45, 0x30, 0x45, 0x2b, 0xcd, 0x74, 0xe6,
+    0x09, 0x14, 0x10, 0x2b, 0xe5, 0x10, 0x10, 0x74, 0x3f, 0x00, 0xa0, 0x48, 0x8b, 0xca, 0x48, 0xc1,
+    0xe9, 0x04, 0x45, 0x8a, 0xe5, 0xa2, 0x12, 0xe0, 0x48, 0x89, 0x56, 0x18, 0x48, 0x8b, 0x02, 0x48,
+    0x89, 0x06, 0x48, 0x8b, 0x42, 0x18, 0xd4, 0x00, 0x52, 0xeb, 0x4e, 0x41, 0x8b, 0xc6, 0x14, 0x01,
+    0x11, 0x45, 0x70, 0x00, 0x31, 0x0f, 0x28, 0x34, 0x6d, 0x00, 0xaf, 0xfe, 0xfc, 0xff, 0xff, 0xf3,
+    0x0f, 0x7f, 0x30, 0xeb, 0x90, 0x3c, 0x01, 0x00, 0x51, 0x03, 0xc9, 0x0f, 0x28, 0x34, 0x3f, 0x01,
+    0x14, 0xd7, 0x27, 0x00, 0x12, 0x06, 0x23, 0x00, 0x42, 0x0f, 0xb6, 0x45, 0x02, 0x0a, 0x00, 0xf0,
+    0x05, 0x3b, 0xf8, 0x0f, 0x82, 0x4c, 0xfe, 0xff, 0xff, 0x45, 0x84, 0xe4, 0x75, 0x12, 0x48, 0x8b,
+    0x4e, 0x18, 0x48, 0x8b, 0x01, 0x79, 0x00, 0x30, 0x8d, 0x41, 0x08, 0x79, 0x00, 0x00, 0x4d, 0x02,
+    0x10, 0x60, 0x40, 0x02, 0x10, 0x68, 0x4e, 0x02, 0x69, 0x70, 0x0f, 0x28, 0x74, 0x24, 0x20, 0x4e,
+    0x11, 0x06, 0x8c, 0x36, 0x06, 0xb8, 0x2c, 0x20, 0x41, 0x56, 0x29, 0x02, 0x10, 0x49, 0xbd, 0x21,
+    0x11, 0xea, 0x65, 0x07, 0xb0, 0x59, 0x18, 0x48, 0x8b, 0xcb, 0xe8, 0x26, 0xfd, 0xff, 0xff, 0x4c,
+    0x15, 0x00, 0x10, 0x16, 0x0e, 0x00, 0x20, 0x4c, 0xfb, 0x27, 0x01, 0xf1, 0x02, 0x47, 0x10, 0x8b,
+    0x58, 0x08, 0x49, 0x03, 0xde, 0xf6, 0x03, 0x18, 0x74, 0x75, 0x0f, 0xb6, 0x4b, 0x02, 0x9e, 0x10,
+    0xd0, 0xe1, 0xfe, 0x8b, 0x44, 0x4b, 0x04, 0x4c, 0x03, 0xf0, 0x48, 0x8d, 0x43, 0x08, 0xfa, 0x0f,
+    0xe0, 0x75, 0x02, 0xcd, 0x2c, 0x48, 0x89, 0x47, 0x38, 0x8a, 0x53, 0x03, 0x80, 0xe2, 0x0f, 0x9f,
+    0x15, 0x40, 0xcd, 0xe8, 0x63, 0xfc, 0x3c, 0x04, 0x50, 0x10, 0xeb, 0x04, 0x48, 0x8b, 0x2f, 0x01,
+    0x50, 0x4e, 0x18, 0x48, 0x89, 0x8d, 0x7d, 0x03, 0x60, 0x48, 0x8b, 0x0e, 0x48, 0x89, 0x8d, 0x2e,
+    0x15, 0x01, 0x0a, 0x00, 0xb0, 0x0f, 0x48, 0x83, 0x67, 0x40, 0x00, 0x83, 0x67, 0x48, 0x00, 0x4c,
+    0x14, 0x22, 0x10, 0xc5, 0x30, 0x13, 0xa5, 0xd7, 0x03, 0x00, 0x49, 0x8b, 0xc6, 0xff, 0x15, 0x54,
+    0x47, 0xbd, 0x07, 0x12, 0x40, 0x24, 0x0a, 0x08, 0xa1, 0x1f, 0x36, 0x30, 0x41, 0x5e, 0xcc, 0x08,
+    0x03, 0xc4, 0x11, 0x51, 0x8d, 0x05, 0x10, 0xd7, 0x03, 0x26, 0x0b, 0x40, 0x3b, 0xc8, 0x74, 0x25,
+    0x8e, 0x05, 0x70, 0x48, 0x8b, 0x51, 0x10, 0x8b, 0x09, 0xe8, 0xc2, 0x0f, 0x01, 0xb6, 0x09, 0x00,
+    0xd8, 0x11, 0x01, 0x0f, 0x32, 0x02, 0xff, 0x05, 0xb0, 0x5f, 0xc3, 0x49, 0x8b, 0x41, 0x50, 0x48,
+    0x8d, 0x0d, 0x11, 0xda, 0x75, 0x00, 0xe0, 0x79, 0x20, 0x48, 0x3b, 0xc1, 0x75, 0x64, 0x48, 0x83,
+    0x7a, 0x60, 0x00, 0x75, 0x43, 0x48, 0x05, 0x00, 0x87, 0x04, 0x02, 0x3d, 0x05, 0x01, 0xa0, 0x04,
+    0x00, 0x63, 0x05, 0x00, 0x6b, 0x20, 0x01, 0x45, 0x05, 0x00, 0x9e, 0x04, 0x00, 0x80, 0x00, 0x11,
+    0x30, 0x58, 0x05, 0x0d, 0x54, 0x05, 0x10, 0x31, 0x02, 0x01, 0x30, 0x83, 0x7b, 0x68, 0xc4, 0x23,
+    0x30, 0x83, 0xc3, 0x48, 0x0a, 0x01, 0x60, 0x5b, 0x60, 0x48, 0x89, 0x9f, 0x60, 0x6f, 0x17, 0xe1,
+    0x58, 0x48, 0x8d, 0x0d, 0x9c, 0xd9, 0x03, 0x00, 0x48, 0x3b, 0xc1, 0x0f, 0x85, 0x62, 0x88, 0x15,
+    0x10, 0x87, 0x19, 0x00, 0x00, 0x59, 0x05, 0xc1, 0x10, 0x48, 0x8d, 0x4a, 0x48, 0x48, 0x3b, 0xc1,
+    0x74, 0x07, 0xe8, 0x39, 0x41, 0x2b, 0x62, 0x48, 0x8b, 0x42, 0x60, 0x48, 0x89, 0x20, 0x00, 0x60,
+    0x8b, 0x42, 0x68, 0x48, 0x89, 0x87, 0xc0, 0x1c, 0x82, 0x48, 0x8b, 0x43, 0x58, 0x48, 0x89, 0x87,
+    0x58, 0x0b, 0x00, 0x50, 0x70, 0x48, 0x89, 0x87, 0x70, 0x5d, 0x32, 0x91, 0x64, 0x3c, 0x4d, 0x15,
+    0xe9, 0x15, 0xff, 0xff, 0xff, 0xd4, 0x07, 0x03, 0x93, 0x05, 0xf0, 0x01, 0x74, 0x1e, 0x83, 0x78,
+    0x04, 0x00, 0x74, 0x18, 0x8b, 0x40, 0x04, 0x48, 0x8d, 0x15, 0xc3, 0xb5, 0x4b, 0x2d, 0x94, 0xc2,
+    0x48, 0x8b, 0x49, 0x18, 0xff, 0x15, 0xee, 0x45, 0x8f, 0x09, 0x0b, 0xb8, 0x38, 0x02, 0x54, 0x04,
+    0x60, 0x8d, 0x68, 0xa1, 0x48, 0x81, 0xec, 0xcc, 0x26, 0x30, 0x48, 0x8b, 0xd9, 0x35, 0x02, 0x90,
+    0x8d, 0x4d, 0xd7, 0x48, 0x8b, 0xfa, 0xe8, 0xcf, 0xf9, 0xbe, 0x19, 0x20, 0x4d, 0xd7, 0x01, 0x14,
+    0x40, 0x8d, 0x15, 0xd1, 0xd8, 0xd1, 0x08, 0x50, 0x4d, 0xef, 0xe8, 0xe4, 0xfa, 0x17, 0x00, 0x50,
+    0x76, 0x20, 0x4c, 0x8d, 0xbe, 0x53, 0x07, 0x30, 0x0f, 0x10, 0x00, 0x18, 0x01, 0xf0, 0x1a, 0x20,
+    0x0f, 0x10, 0x48, 0x10, 0x0f, 0x29, 0x4d, 0x87, 0x0f, 0x10, 0x40, 0x20, 0x0f, 0x29, 0x45, 0x97,
+    0x0f, 0x10, 0x48, 0x30, 0x0f, 0x29, 0x4d, 0xa7, 0x0f, 0x10, 0x40, 0x40, 0x0f, 0x29, 0x45, 0xb7,
+    0xf2, 0x0f, 0x10, 0x48, 0x50, 0x48, 0x83, 0xa6, 0xcd, 0x00, 0x91, 0x00, 0xf2, 0x0f, 0x11, 0x4d,
+    0xc7, 0x48, 0x89, 0x9e, 0xf0, 0x00, 0x20, 0x89, 0xbe, 0xec, 0x00, 0x50, 0xeb, 0x0b, 0x4d, 0x8b,
+    0xc7, 0x03, 0x1d, 0x50, 0x00, 0xfb, 0xff, 0xff, 0x4d, 0xa6, 0x0b, 0x30, 0x4c, 0x24, 0x20, 0x10,
+    0x00, 0x10, 0x1c, 0xcf, 0x03, 0x00, 0xfc, 0x0d, 0x20, 0x45, 0xa7, 0xe7, 0x00, 0x50, 0xd9, 0x4c,
+    0x8d, 0x9c, 0x24, 0xad, 0x00, 0xf2, 0x00, 0x49, 0x8b, 0x5b, 0x20, 0x49, 0x8b, 0x73, 0x28, 0x49,
+    0x8b, 0x7b, 0x30, 0x49, 0x8b, 0xe3, 0xcd, 0x21, 0x03, 0xfc, 0x09, 0x50, 0x48, 0x8d, 0x05, 0xe9,
+    0xd4, 0x7b, 0x01, 0x37, 0xc8, 0x74, 0x0f, 0x24, 0x02, 0x10, 0x0d, 0xa4, 0x08, 0x02, 0x73, 0x0f,
+    0x01, 0x93, 0x21, 0x04, 0xbc, 0x06, 0x90, 0x41, 0xd1, 0xe8, 0x41, 0xf6, 0xc0, 0x01, 0x74, 0x47,
+    0xfd, 0x01, 0x00, 0xa8, 0x0f, 0x31, 0x48, 0x63, 0xc1, 0x18, 0x02, 0x00, 0xa2, 0x13, 0x44, 0x30,
+    0x0f, 0x57, 0xd2, 0x5d, 0x07, 0x01, 0xad, 0x06, 0x00, 0x05, 0x02, 0x02, 0x0f, 0x02, 0x30, 0x4c,
+    0x24, 0x60, 0x27, 0x02, 0x02, 0x0e, 0x02, 0x01, 0x3e, 0x02, 0x64, 0xe8, 0x1e, 0xfa, 0xff, 0xff,
+    0x90, 0xf6, 0x06, 0x03, 0xc8, 0x05, 0x89, 0x10, 0x4c, 0x89, 0x40, 0x18, 0x48, 0x89, 0x48, 0xee,
+    0x1c, 0x60, 0x8d, 0x68, 0xa9, 0x48, 0x81, 0xec, 0xa9, 0x02, 0xf0, 0x04, 0x4d, 0x63, 0xf1, 0x8b,
+    0xda, 0x48, 0x03, 0xd9, 0x0f, 0xb6, 0x0b, 0x83, 0xe1, 0x0f, 0x48, 0x8d, 0x15, 0x06, 0xb4, 0x56,
+    0x05, 0xe0, 0x84, 0x11, 0x60, 0x91, 0x00, 0x00, 0x48, 0x03, 0xd8, 0x8a, 0x8c, 0x11, 0x70, 0x91,
+    0x1e, 0x22, 0xf0, 0x03, 0x63, 0xfc, 0x41, 0xd3, 0xec, 0x45, 0x85, 0xc9, 0x78, 0x05, 0x45, 0x3b,
+    0xf4, 0x72, 0x3c, 0xc7, 0x45, 0xc7, 0x82, 0x1a, 0x50, 0x4c, 0x89, 0x75, 0xcf, 0x41, 0x68, 0x00,
+    0x22, 0x45, 0xd7, 0xaa, 0x00, 0xf3, 0x03, 0x55, 0xdf, 0x0f, 0x10, 0x45, 0xc7, 0x0f, 0x29, 0x45,
+    0xef, 0x0f, 0x10, 0x4d, 0xd7, 0x0f, 0x29, 0x4d, 0xff, 0xa5, 0x00, 0x21, 0x55, 0x0f, 0xc1, 0x01,
+    0x20, 0x7b, 0xf9, 0xf9, 0x03, 0xf0, 0x07, 0x5d, 0xaf, 0x33, 0xff, 0x48, 0x8b, 0xf3, 0x45, 0x85,
+    0xf6, 0x74, 0x1f, 0x48, 0x8d, 0x55, 0xaf, 0x48, 0x8d, 0x4d, 0xb7, 0xe8, 0x28, 0xba, 0x1b, 0xf1,
+    0x05, 0x8b, 0x5d, 0xaf, 0x3b, 0x7d, 0x7f, 0x48, 0x0f, 0x44, 0xf3, 0xff, 0xc7, 0x41, 0x3b, 0xfe,
+    0x75, 0xe1, 0x44, 0x3b, 0x75, 0x0f, 0x00, 0x02, 0xa1, 0x00, 0xc0, 0x4c, 0x8d, 0x0d, 0x65, 0xb3,
+    0xff, 0xff, 0x46, 0x0f, 0xb6, 0xbc, 0x09, 0xa2, 0x00, 0x70, 0x4c, 0x03, 0xfb, 0x42, 0x8a, 0x8c,
+    0x09, 0xa3, 0x00, 0xfe, 0x03, 0x41, 0x8b, 0x7f, 0xfc, 0xd3, 0xef, 0x44, 0x8b, 0xef, 0x41, 0xc1,
+    0xed, 0x02, 0x45, 0x85, 0xed, 0x75, 0x45, 0xa4, 0x00, 0x9c, 0x48, 0x89, 0x5d, 0xdf, 0x48, 0x83,
+    0x65, 0xe7, 0x00, 0xa5, 0x00, 0x92, 0xf2, 0x0f, 0x10, 0x45, 0xe7, 0xf2, 0x0f, 0x11, 0x45, 0xa6,
+    0x00, 0x20, 0xd5, 0xf8, 0x67, 0x02, 0xd0, 0x0d, 0xfa, 0xb2, 0xff, 0xff, 0x83, 0xe7, 0x03, 0x83,
+    0xef, 0x01, 0x74, 0x4a, 0x05, 0x00, 0x10, 0x1b, 0x77, 0x1e, 0xf1, 0x14, 0x74, 0x41, 0x8b, 0x07,
+    0x48, 0x03, 0x45, 0x5f, 0x48, 0x8b, 0x55, 0x6f, 0x48, 0x8b, 0xc8, 0xff, 0x15, 0x0c, 0x43, 0x00,
+    0x00, 0xeb, 0x5e, 0x41, 0x0f, 0xb6, 0x4f, 0x04, 0x83, 0xe1, 0x0f, 0x42, 0x0f, 0xb6, 0x94, 0x9b,
+    0x00, 0x44, 0x46, 0x8b, 0x04, 0x3a, 0x9c, 0x00, 0xdf, 0x49, 0xd3, 0xe8, 0x48, 0x8b, 0x4d, 0x6f,
+    0x49, 0x8b, 0x0c, 0x08, 0xeb, 0x27, 0x2a, 0x00, 0x0d, 0x73, 0x4c, 0x03, 0x45, 0x6f, 0x49, 0x8b,
+    0xc8, 0x67, 0x00, 0x40, 0xff, 0x15, 0xac, 0x42, 0xdd, 0x00, 0x10, 0xcd, 0xab, 0x04, 0xc1, 0x2b,
+    0xc6, 0x48, 0x3b, 0xc1, 0x7c, 0x08, 0x48, 0x2b, 0xd9, 0xe9, 0xec, 0x3d, 0x09, 0x32, 0x9c, 0x24,
+    0xd8, 0x6e, 0x04, 0x00, 0xcc, 0x01, 0x09, 0xe2, 0x1e, 0x05, 0xf0, 0x35, 0x39, 0x54, 0x24, 0x10,
+    0xfb, 0x01, 0x33, 0x6c, 0x24, 0xd9, 0xfc, 0x01, 0xf2, 0x05, 0x48, 0x8d, 0x05, 0x79, 0xd5, 0x03,
+    0x00, 0x4d, 0x8b, 0xf1, 0x48, 0x8b, 0xfa, 0x49, 0x39, 0x41, 0x50, 0x0f, 0x84, 0xfc, 0x56, 0x0c,
+    0x40, 0x61, 0xd5, 0x03, 0x00, 0x11, 0x00, 0x10, 0x74, 0x39, 0x18, 0x40, 0x00, 0x00, 0xe9, 0xea,
+    0xb6, 0x35, 0xf0, 0x1b, 0x8b, 0x49, 0x18, 0xe8, 0x60, 0xf7, 0xff, 0xff, 0x49, 0x8b, 0x5e, 0x20,
+    0x48, 0x8d, 0x4d, 0xdf, 0x4d, 0x8b, 0x4e, 0x10, 0x4c, 0x8b, 0xf8, 0x33, 0xf6, 0x48, 0x89, 0x5d,
+    0x0f, 0x33, 0xc0, 0x48, 0x89, 0x75, 0xe7, 0x48, 0x89, 0x45, 0xdf, 0x4c, 0x8d, 0xa3, 0x56, 0x16,
+    0x40, 0x49, 0x8b, 0x46, 0x38, 0x4a, 0x03, 0xf1, 0x02, 0x89, 0x75, 0xeb, 0x48, 0x89, 0x75, 0xef,
+    0x89, 0x75, 0xf3, 0x8b, 0x10, 0x49, 0x03, 0xd7, 0xe8, 0xba, 0x4b, 0x00, 0x71, 0x44, 0x24, 0x10,
+    0x41, 0x83, 0xcd, 0xff, 0x94, 0x01, 0x50, 0x3b, 0xc7, 0x72, 0x0a, 0x41, 0x76, 0x3b, 0x20, 0xe9,
+    0xbd, 0x54, 0x07, 0x72, 0x55, 0xef, 0x41, 0x8b, 0xf5, 0x85, 0xd2, 0x10, 0x31, 0xf0, 0x00, 0x49,
+    0x8b, 0x46, 0x10, 0x4d, 0x8d, 0x0c, 0x17, 0x45, 0x33, 0xdb, 0x8b, 0x08, 0x8b, 0x83, 0xf4, 0x03,
+    0xf0, 0x08, 0x48, 0x8d, 0x1d, 0x62, 0xb1, 0xff, 0xff, 0x2b, 0xc1, 0x41, 0x0f, 0xb6, 0x09, 0x83,
+    0xe1, 0x0f, 0x41, 0x2b, 0xc7, 0x0f, 0xb6, 0x94, 0x19, 0x49, 0x01, 0x30, 0x8a, 0x8c, 0x19, 0x44,
+    0x01, 0xc0, 0x4c, 0x03, 0xca, 0x33, 0xd2, 0x45, 0x8b, 0x51, 0xfc, 0x41, 0xd3, 0xea, 0xf6, 0x0a,
+    0x13, 0x52, 0x2a, 0x00, 0x48, 0x44, 0x0f, 0xb6, 0x84, 0x28, 0x00, 0xf0, 0x02, 0x4d, 0x03, 0xc8,
+    0x45, 0x8b, 0x41, 0xfc, 0x41, 0xd3, 0xe8, 0x41, 0x03, 0xd0, 0x3b, 0xc2, 0x72, 0x2a, 0x28, 0x00,
+    0x3f, 0x41, 0xff, 0xc3, 0x2b, 0x00, 0x03, 0xf0, 0x0b, 0x41, 0x8b, 0x71, 0xfc, 0xd3, 0xee, 0xff,
+    0xce, 0x45, 0x3b, 0xda, 0x75, 0xae, 0xf6, 0x45, 0xdf, 0x01, 0x74, 0x0d, 0x8b, 0x45, 0xf3, 0x48,
+    0x8b, 0x04, 0x38, 0xc6, 0x00, 0x90, 0xeb, 0x04, 0x48, 0x89, 0x7d, 0xd7, 0x8b, 0x5d, 0xeb, 0xc2,
+    0x17, 0x00, 0x9b, 0x28, 0x60, 0x85, 0xf6, 0x0f, 0x88, 0x93, 0x02, 0xc2, 0x00, 0xf0, 0x0a, 0xcc,
+    0xe8, 0x3a, 0xf5, 0xff, 0xff, 0x4d, 0x8d, 0x04, 0x1f, 0x48, 0x89, 0x45, 0x07, 0x41, 0x0f, 0xb6,
+    0x08, 0x48, 0x8d, 0x1d, 0x9f, 0xb0, 0xff, 0xff, 0xd0, 0x02, 0x20, 0x8b, 0xd0, 0x9f, 0x0b, 0x3d,
+    0x89, 0x4d, 0xcf, 0xc4, 0x00, 0xa0, 0xc2, 0x41, 0x8b, 0x40, 0xfc, 0xd3, 0xe8, 0x89, 0x45, 0x03,
+    0x0c, 0x18, 0x10, 0x4d, 0xa1, 0x30, 0x6b, 0x0f, 0xb6, 0x08, 0x83, 0xe1, 0x0f, 0x2a, 0x00, 0xd0,
+    0x49, 0x03, 0xd0, 0x44, 0x8b, 0x5a, 0xfc, 0x41, 0xd3, 0xeb, 0x0f, 0xb6, 0x0a, 0xbb, 0x00, 0x3c,
+    0x89, 0x5d, 0xff, 0xbf, 0x00, 0x00, 0x4e, 0x00, 0xf2, 0x01, 0x0f, 0xb6, 0x00, 0x41, 0x8b, 0x50,
+    0xfc, 0x83, 0xe0, 0x0f, 0xd3, 0xea, 0x0f, 0xb6, 0x84, 0x18, 0x3f, 0x03, 0xf0, 0x0a, 0xc0, 0x41,
+    0x8b, 0x18, 0x49, 0x83, 0xc0, 0x04, 0x4c, 0x89, 0x45, 0x17, 0x44, 0x3b, 0xde, 0x0f, 0x87, 0xc3,
+    0x01, 0x00, 0x00, 0x3b, 0xf2, 0x0f, 0x87, 0xff, 0x36, 0xf3, 0x00, 0x4d, 0x85, 0xd2, 0x75, 0x19,
+    0x48, 0x8b, 0x55, 0x0f, 0x49, 0x8b, 0x4e, 0x18, 0xe8, 0xf4, 0xce, 0x00, 0x20, 0x6c, 0xf4, 0xc3,
+    0x03, 0xf1, 0x03, 0x45, 0x07, 0x83, 0x65, 0xcb, 0x00, 0x49, 0x8d, 0x3c, 0x1f, 0x0f, 0xb6, 0x0f,
+    0x4c, 0x8d, 0x1d, 0xce, 0xaf, 0xd1, 0x00, 0x14, 0x42, 0x7a, 0x00, 0x13, 0x42, 0x7b, 0x00, 0x51,
+    0x48, 0x03, 0xf8, 0x8b, 0x47, 0xc8, 0x00, 0x10, 0xf7, 0xc8, 0x00, 0x11, 0x51, 0xa4, 0x26, 0xb3,
+    0x07, 0x48, 0xff, 0xc7, 0xa8, 0x01, 0x74, 0x24, 0x0f, 0xb6, 0x0f, 0x09, 0x03, 0x0b, 0x34, 0x00,
+    0xff, 0x1b, 0xfa, 0x8b, 0x57, 0xfc, 0xd3, 0xea, 0x89, 0x55, 0xc7, 0xeb, 0x04, 0x83, 0x65, 0xc7,
+    0x00, 0xa8, 0x02, 0x74, 0x08, 0x8b, 0x1f, 0x48, 0x83, 0xc7, 0x04, 0xeb, 0x02, 0x33, 0xdb, 0x44,
+    0x8b, 0xc0, 0x41, 0xc1, 0xe8, 0x04, 0x41, 0x83, 0xe0, 0x03, 0xa8, 0x04, 0x45, 0x00, 0x10, 0x10,
+    0x7f, 0x45, 0x00, 0x40, 0x7f, 0x00, 0x8b, 0x0f, 0x41, 0x00, 0x90, 0x89, 0x4d, 0xfb, 0xa8, 0x08,
+    0x74, 0x1d, 0x33, 0xd2, 0x48, 0x11, 0x12, 0x57, 0x14, 0x00, 0xf0, 0x01, 0x49, 0x03, 0xcf, 0x49,
+    0x89, 0x0c, 0xd4, 0xff, 0xc2, 0x41, 0x3b, 0xd0, 0x75, 0xec, 0xeb, 0x41, 0x76, 0x02, 0x90, 0x45,
+    0x33, 0xd2, 0x44, 0x8b, 0x08, 0x4d, 0x03, 0xcf, 0x28, 0x00, 0x15, 0x2f, 0x64, 0x00, 0x0e, 0xdd,
+    0x00, 0xf0, 0x05, 0x57, 0xfc, 0x48, 0xd3, 0xea, 0x49, 0x03, 0xd1, 0x4b, 0x89, 0x14, 0xd4, 0x41,
+    0xff, 0xc2, 0x45, 0x3b, 0xd0, 0x75, 0xd1, 0x27, 0x01, 0x20, 0x2d, 0xf3, 0xa1, 0x03, 0xf1, 0x0c,
+    0x4d, 0x07, 0x44, 0x8b, 0x4d, 0x7f, 0x4c, 0x03, 0x4d, 0xd7, 0x8b, 0x55, 0xc7, 0x48, 0x89, 0x4c,
+    0x24, 0x28, 0x49, 0x8b, 0xcf, 0x44, 0x8b, 0xc3, 0x4d, 0x03, 0xc7, 0x76, 0x0b, 0xf0, 0x31, 0xe8,
+    0x4e, 0x02, 0x00, 0x00, 0x84, 0xc0, 0x75, 0x1a, 0x8b, 0x4d, 0xcb, 0x4c, 0x8d, 0x1d, 0x88, 0xae,
+    0xff, 0xff, 0xff, 0xc1, 0x89, 0x4d, 0xcb, 0x3b, 0x4d, 0xf7, 0x0f, 0x85, 0xd3, 0xfe, 0xff, 0xff,
+    0xeb, 0x22, 0x8b, 0x45, 0xfb, 0x44, 0x8b, 0x6d, 0xff, 0x49, 0x03, 0xc7, 0x49, 0x89, 0x46, 0x30,
+    0x41, 0xff, 0xcd, 0x48, 0x8b, 0x45, 0xd7, 0x49, 0x89, 0x44, 0x24, 0x10, 0x49, 0x63, 0xc5, 0x08,
+    0x00, 0xf0, 0x0f, 0x28, 0x49, 0x83, 0x7e, 0x30, 0x00, 0x75, 0x24, 0x4c, 0x8b, 0x45, 0x17, 0x44,
+    0x8b, 0x4d, 0xcf, 0x4c, 0x8b, 0x55, 0x07, 0x41, 0xff, 0xc1, 0x48, 0x8d, 0x1d, 0x39, 0xae, 0xff,
+    0xff, 0x5d, 0x02, 0x71, 0x44, 0x3b, 0x4d, 0x03, 0x0f, 0x85, 0xbc, 0xcd, 0x06, 0xf0, 0x04, 0x7d,
+    0x6f, 0x44, 0x3b, 0xee, 0x7d, 0x16, 0x8b, 0x55, 0xe7, 0x44, 0x8b, 0xce, 0x4c, 0x8b, 0xc7, 0x44,
+    0x89, 0x6c, 0xec, 0x06, 0x61, 0xcf, 0xe8, 0xcc, 0xf9, 0xff, 0xff, 0xdf, 0x07, 0x00, 0x57, 0x04,
+    0x01, 0xc2, 0x15, 0x0e, 0x57, 0x04, 0x06, 0x44, 0x3a, 0x00, 0xb8, 0x2b, 0xf0, 0x02, 0x18, 0x8a,
+    0x02, 0x4c, 0x8d, 0x52, 0x01, 0x88, 0x01, 0x49, 0x8b, 0xf9, 0x48, 0x8d, 0x35, 0xcb, 0xad, 0xe3,
+    0x09, 0x62, 0xd9, 0xa8, 0x04, 0x74, 0x23, 0x41, 0x8c, 0x02, 0x42, 0x0f, 0xb6, 0x94, 0x31, 0x87,
+    0x02, 0x12, 0x31, 0x87, 0x02, 0xd0, 0xd2, 0x41, 0x8b, 0x52, 0xfc, 0xd3, 0xea, 0x41, 0x89, 0x53,
+    0x04, 0xa8, 0x08, 0xc7, 0x12, 0xb8, 0x0a, 0x49, 0x83, 0xc2, 0x04, 0x41, 0x89, 0x4b, 0x08, 0xa8,
+    0x10, 0x0f, 0x00, 0xa0, 0x0c, 0x41, 0x8b, 0x0a, 0xa8, 0x02, 0x74, 0x49, 0x4c, 0x03, 0xe7, 0x03,
+    0x03, 0xf6, 0x02, 0x0a, 0x4b, 0x00, 0x90, 0xc2, 0x33, 0xd2, 0x41, 0x8b, 0x58, 0xfc, 0xd3, 0xeb,
+    0x7b, 0x0f, 0xf0, 0x10, 0x85, 0xdb, 0x74, 0x21, 0x41, 0x8b, 0x08, 0x45, 0x8b, 0x48, 0x04, 0x4d,
+    0x8d, 0x40, 0x08, 0x3b, 0x0f, 0x74, 0x08, 0xff, 0xc2, 0x3b, 0xd3, 0x75, 0xeb, 0xeb, 0x0a, 0x45,
+    0x89, 0x4b, 0x10, 0x13, 0x34, 0x60, 0x4b, 0x10, 0xa8, 0x01, 0x74, 0x21, 0x8c, 0x32, 0x00, 0x7d,
+    0x05, 0x38, 0x0f, 0xb6, 0x84, 0x4f, 0x00, 0x60, 0x42, 0x8b, 0x04, 0x10, 0xd3, 0xe8, 0xbc, 0x0f,
+    0x06, 0x97, 0x37, 0x00, 0x0a, 0x0a, 0x18, 0x18, 0x9c, 0x37, 0x20, 0x70, 0x10, 0x0a, 0x0a, 0x00,
+    0x1c, 0x26, 0xf0, 0x08, 0x48, 0x8b, 0xf2, 0x4c, 0x8b, 0xc9, 0x4c, 0x8b, 0xc2, 0x48, 0x8d, 0x48,
+    0x98, 0x48, 0x8d, 0x15, 0x32, 0xd0, 0x03, 0x00, 0xe8, 0x48, 0xf2, 0xb7, 0x11, 0x12, 0x9e, 0xa4,
+    0x04, 0x2a, 0x7e, 0x20, 0x9c, 0x08, 0x00, 0xb3, 0x07, 0x01, 0x9d, 0x08, 0x32, 0x44, 0x24, 0x40,
+    0x9e, 0x08, 0x10, 0x4c, 0xca, 0x07, 0x00, 0x9f, 0x08, 0x02, 0x0b, 0x0e, 0x10, 0x48, 0x0a, 0x0e,
+    0x60, 0x4c, 0x24, 0x70, 0xeb, 0x0e, 0x4c, 0x94, 0x0a, 0x10, 0xd7, 0x5f, 0x12, 0x20, 0x72, 0xf2,
+    0x51, 0x01, 0x11, 0xc3, 0x8e, 0x08, 0x50, 0x48, 0x8b, 0xd7, 0xe8, 0x8e, 0x7a, 0x03, 0x20, 0x83,
+    0xbe, 0xb9, 0x08, 0x30, 0x00, 0x74, 0xd8, 0x8c, 0x08, 0x00, 0x8d, 0x00, 0xbb, 0x49, 0x8b, 0x5b,
+    0x10, 0x49, 0x8b, 0x73, 0x18, 0x49, 0x8b, 0xe3, 0xe8, 0x3b, 0x01, 0x37, 0x0e, 0xc1, 0x49, 0x8b,
+    0xf1, 0x4d, 0x8b, 0xd8, 0x4c, 0x8b, 0xc9, 0xf6, 0xc2, 0x40, 0xd3, 0x2a, 0x80, 0x00, 0x00, 0xeb,
+    0x4b, 0x8b, 0xc2, 0xf7, 0xd0, 0x9f, 0x1b, 0x60, 0x58, 0x23, 0x01, 0xa8, 0x07, 0x74, 0x36, 0x2e,
+    0xf0, 0x02, 0x38, 0x8b, 0x41, 0x0c, 0x4c, 0x8d, 0x40, 0x04, 0x4d, 0x03, 0xc1, 0x33, 0xc9, 0x46,
+    0x8b, 0x14, 0x08, 0x3a, 0x05, 0xf0, 0x08, 0x1f, 0x8d, 0x59, 0x01, 0x41, 0x8b, 0x38, 0x49, 0x03,
+    0xf9, 0x8b, 0x47, 0x04, 0x49, 0x03, 0xc1, 0x49, 0x3b, 0xc3, 0x74, 0x1f, 0x03, 0xcb, 0x31, 0x04,
+    0x83, 0x41, 0x3b, 0xca, 0x72, 0xe4, 0x32, 0xdb, 0x8a, 0xfd, 0x12, 0x24, 0x8b, 0x74, 0x65, 0x0e,
+    0x30, 0x83, 0xe2, 0x08, 0x7c, 0x2e, 0x50, 0x0e, 0x85, 0xd2, 0x74, 0xe2, 0x16, 0x3d, 0xa0, 0x50,
+    0x48, 0x89, 0x06, 0xeb, 0xd8, 0x85, 0xd2, 0x75, 0xf2, 0x42, 0x17, 0xf0, 0x03, 0x50, 0x84, 0x1f,
+    0x75, 0x12, 0x83, 0x7f, 0x18, 0x00, 0x75, 0x1a, 0x48, 0x8d, 0x4f, 0x08, 0xe8, 0x23, 0xef, 0x94,
+    0x02, 0x50, 0xd0, 0x44, 0x8b, 0x47, 0x14, 0xd9, 0x2e, 0x20, 0x48, 0x20, 0xc0, 0x33, 0x90, 0x8b,
+    0x47, 0x18, 0x49, 0x03, 0xc1, 0x48, 0x8b, 0xce, 0xa8, 0x2e, 0xf1, 0x06, 0x0b, 0x44, 0x8b, 0xc3,
+    0xff, 0x15, 0xa7, 0x3b, 0x00, 0x00, 0xeb, 0x07, 0xff, 0x15, 0x9f, 0x3b, 0x00, 0x00, 0x90, 0xeb,
+    0x89, 0xe4, 0x00, 0x80, 0x4c, 0x8b, 0xc9, 0x48, 0x8d, 0x1d, 0x55, 0xab, 0x25, 0x01, 0xbf, 0xda,
+    0x45, 0x33, 0xd2, 0x4c, 0x89, 0x51, 0x08, 0x4c, 0x8b, 0x02, 0x27, 0x05, 0x08, 0x11, 0x42, 0xed,
+    0x05, 0xf0, 0x04, 0x8b, 0xc0, 0x49, 0x89, 0x13, 0x83, 0xe0, 0x03, 0x41, 0xc1, 0xe8, 0x02, 0x41,
+    0x89, 0x41, 0x04, 0x45, 0x89, 0x01, 0x15, 0x19, 0xf0, 0x0c, 0x49, 0x8b, 0x0b, 0x8b, 0x01, 0x48,
+    0x83, 0xc1, 0x04, 0x49, 0x89, 0x0b, 0xeb, 0x03, 0x41, 0x8b, 0xc2, 0x41, 0x89, 0x41, 0x08, 0x41,
+    0x8b, 0x41, 0x04, 0xff, 0xc8, 0x0e, 0x18, 0x43, 0x26, 0x49, 0x8b, 0x13, 0x62, 0x05, 0x0e, 0x5e,
+    0x05, 0x30, 0x45, 0x8b, 0x50, 0x6e, 0x06, 0x31, 0x4d, 0x89, 0x03, 0x40, 0x02, 0x75, 0x49, 0x8b,
+    0xc1, 0x45, 0x89, 0x51, 0x0c, 0x98, 0x11, 0x04, 0xe4, 0x09, 0x15, 0x4c, 0xe4, 0x09, 0x00, 0x7e,
+    0x1d, 0x31, 0x48, 0x8b, 0x84, 0x05, 0x1e, 0x00, 0x09, 0x04, 0x0f, 0xe9, 0x09, 0x1b, 0x27, 0x35,
+    0xf0, 0xe9, 0x09, 0x01, 0xd4, 0x0f, 0x42, 0x8d, 0x05, 0x75, 0xca, 0x74, 0x0a, 0x91, 0x2a, 0x49,
+    0x8b, 0x51, 0x10, 0x49, 0x8b, 0x41, 0x08, 0x7c, 0x0a, 0x00, 0x64, 0x04, 0x43, 0x44, 0x8b, 0x4a,
+    0x08, 0x85, 0x0a, 0x10, 0x6c, 0x2f, 0x28, 0x03, 0x85, 0x0a, 0x10, 0x38, 0x7a, 0x11, 0x43, 0x38,
+    0xe9, 0xd5, 0xf7, 0xcc, 0x0b, 0x21, 0xb8, 0x18, 0x18, 0x00, 0xf1, 0x07, 0xf9, 0x01, 0x76, 0x12,
+    0x48, 0x8d, 0x41, 0xff, 0x48, 0x83, 0xf8, 0xe0, 0x77, 0x0d, 0x48, 0x83, 0xc0, 0x1f, 0x48, 0x83,
+    0xe0, 0xf8, 0xb5, 0x0a, 0x20, 0xe8, 0x91, 0x8f, 0x12, 0x0b, 0x04, 0x04, 0x02, 0xf0, 0x0d, 0x10,
+    0x4c, 0x45, 0x08, 0x61, 0xf2, 0x48, 0x8b, 0xca, 0xe8, 0xb1, 0x6e, 0x0c, 0x40, 0xc8, 0xe8, 0xf5,
+    0xe9, 0x08, 0x00, 0x41, 0xf8, 0x4c, 0x8b, 0xc6, 0x71, 0x00, 0xc0, 0x33, 0xd2, 0x89, 0x47, 0x08,
+    0x48, 0x8d, 0x5f, 0x10, 0x89, 0x47, 0x0c, 0xb4, 0x17, 0x40, 0x8d, 0x05, 0x5c, 0x3b, 0xfb, 0x00,
+    0x40, 0x07, 0xe8, 0x54, 0x1c, 0x51, 0x03, 0x91, 0x74, 0x24, 0x48, 0x49, 0x8b, 0xc6, 0x49, 0x89,
+    0x1e, 0x90, 0x0d, 0x31, 0x49, 0x89, 0x7e, 0x6d, 0x32, 0x01, 0xab, 0x17, 0x20, 0x41, 0x5e, 0x68,
+    0x16, 0x20, 0x8d, 0x22, 0x2f, 0x00, 0x01, 0x81, 0x16, 0x25, 0x9a, 0x3a, 0x81, 0x16, 0x06, 0x08,
+    0x19, 0x21, 0x83, 0x21, 0x05, 0x19, 0x50, 0x83, 0x61, 0x08, 0x00, 0xb9, 0x97, 0x3b, 0x20, 0xe8,
+    0x74, 0x81, 0x00, 0xf1, 0x00, 0x8d, 0x4b, 0x10, 0x48, 0x89, 0x00, 0x48, 0x89, 0x40, 0x08, 0x48,
+    0x89, 0x03, 0xe8, 0x89, 0x09, 0x25, 0x03, 0x72, 0x12, 0x0b, 0x28, 0x03, 0x70, 0x48, 0x8b, 0x59,
+    0x20, 0x83, 0xce, 0xff, 0xb3, 0x0e, 0xf0, 0x00, 0x85, 0xdb, 0x74, 0x35, 0x8b, 0xc6, 0xf0, 0x0f,
+    0xc1, 0x43, 0x08, 0x03, 0xc6, 0x75, 0x2a, 0x62, 0x11, 0x21, 0x8b, 0xcb, 0xb9, 0x16, 0x42, 0x20,
+    0x39, 0x00, 0x00, 0x1a, 0x00, 0x54, 0x0c, 0x03, 0xc6, 0x75, 0x10, 0x1a, 0x00, 0x00, 0x34, 0x16,
+    0x10, 0x05, 0xd7, 0x17, 0x3f, 0x8b, 0x5f, 0x10, 0x3e, 0x00, 0x08, 0x2f, 0xe2, 0x38, 0x3e, 0x00,
+    0x06, 0x10, 0xc7, 0x3b, 0x18, 0x0b, 0x4a, 0x03, 0x04, 0xcc, 0x03, 0x03, 0x9f, 0x00, 0x10, 0x02,
+    0x9b, 0x00, 0x40, 0x83, 0x22, 0x00, 0x4c, 0x8a, 0x17, 0x70, 0x83, 0x62, 0x08, 0x00, 0x48, 0x8b,
+    0x59, 0x76, 0x17, 0x10, 0x4c, 0x15, 0x01, 0x71, 0x85, 0xdb, 0x74, 0x39, 0x83, 0xc8, 0xff, 0x76,
+    0x00, 0x57, 0x83, 0xf8, 0x01, 0x75, 0x2c, 0x77, 0x00, 0x43, 0x6b, 0x38, 0x00, 0x00, 0x1c, 0x00,
+    0x10, 0x0c, 0x1c, 0x00, 0x09, 0x79, 0x00, 0x16, 0x4e, 0x79, 0x00, 0x15, 0xc7, 0x77, 0x00, 0x0a,
+    0x60, 0x1a, 0x11, 0xb3, 0xda, 0x00, 0x06, 0x60, 0x1a, 0x29, 0x7b, 0xe8, 0xb8, 0x13, 0x0b, 0x30,
+    0x00, 0x20, 0x8b, 0x01, 0x1c, 0x17, 0x12, 0xd9, 0x8d, 0x17, 0x10, 0xf0, 0x7c, 0x18, 0x21, 0x8b,
+    0xcb, 0x2b, 0x00, 0x34, 0xe9, 0x43, 0xe8, 0xfb, 0x15, 0x01, 0x01, 0x00, 0x00, 0xc1, 0x13, 0x01,
+    0x34, 0x00, 0x60, 0x30, 0x48, 0x8b, 0x05, 0xaf, 0xc7, 0x59, 0x0f, 0x13, 0xd9, 0x88, 0x16, 0x11,
+    0xb9, 0x37, 0x00, 0x03, 0xa5, 0x00, 0x40, 0x10, 0xff, 0x15, 0xa9, 0x10, 0x00, 0x0c, 0x3b, 0x17,
+    0x22, 0xa8, 0xe9, 0x4f, 0x00, 0x02, 0x00, 0x03, 0x00, 0x28, 0x17, 0x20, 0xd6, 0xfd, 0x17, 0x03,
+    0x41, 0x8b, 0xc8, 0xe8, 0xa5, 0xa0, 0x0e, 0x0e, 0x28, 0x47, 0x11, 0x45, 0x3e, 0x13, 0x01, 0x59,
+    0x32, 0x20, 0xfa, 0x4c, 0x6e, 0x00, 0xf1, 0x1b, 0xd2, 0x74, 0x4e, 0x45, 0x33, 0xc0, 0x41, 0xb1,
+    0x01, 0x4c, 0x39, 0x43, 0x08, 0x76, 0x59, 0x48, 0x8b, 0x33, 0x33, 0xd2, 0x80, 0x3c, 0x16, 0x3f,
+    0x74, 0x16, 0x49, 0x8b, 0x0e, 0x41, 0x8b, 0xc2, 0x48, 0x03, 0xc2, 0x42, 0x8a, 0x04, 0x18, 0x38,
+    0x04, 0x0a, 0x25, 0x05, 0xf0, 0x0b, 0x02, 0xb0, 0x01, 0x41, 0xff, 0xc0, 0x44, 0x22, 0xc8, 0x41,
+    0x8b, 0xd0, 0x48, 0x3b, 0x53, 0x08, 0x72, 0xd3, 0x45, 0x84, 0xc9, 0x75, 0x22, 0x41, 0xff, 0xc2,
+    0x2c, 0x00, 0x42, 0x3b, 0xc7, 0x72, 0xb2, 0x2e, 0x17, 0x07, 0x41, 0x06, 0x00, 0x2e, 0x35, 0xad,
+    0x20, 0xc3, 0x41, 0x8b, 0xc2, 0x49, 0x03, 0xc3, 0xeb, 0xe3, 0x5c, 0x13, 0x02, 0x58, 0x13, 0xc1,
+    0x60, 0x0f, 0x29, 0x70, 0xd8, 0x45, 0x33, 0xc9, 0x0f, 0x29, 0x78, 0xc8, 0x3a, 0x11, 0xf1, 0x01,
+    0x05, 0xe7, 0xc9, 0x03, 0x00, 0x44, 0x8a, 0xfa, 0x44, 0x8b, 0xf1, 0x48, 0x85, 0xc0, 0x0f, 0x85,
+    0xcb, 0x3e, 0xf0, 0x00, 0x63, 0x40, 0x3c, 0x42, 0x0f, 0xb7, 0x6c, 0x00, 0x06, 0x48, 0x85, 0xed,
+    0x0f, 0x84, 0xcf, 0x59, 0x13, 0xb0, 0x10, 0x35, 0xe6, 0x37, 0x00, 0x00, 0x33, 0xff, 0x49, 0x8d,
+    0x98, 0x76, 0x30, 0x40, 0x0f, 0x10, 0x3d, 0xc6, 0x2b, 0x01, 0xf0, 0x06, 0x03, 0xd8, 0x8b, 0x43,
+    0x1c, 0x25, 0x20, 0x00, 0x00, 0x22, 0x3d, 0x20, 0x00, 0x00, 0x20, 0x75, 0x2b, 0x8b, 0x4b, 0x04,
+    0x4c, 0x23, 0x01, 0x20, 0x8b, 0x13, 0x5f, 0x30, 0x81, 0x30, 0x48, 0x03, 0xce, 0xf3, 0x0f, 0x7f,
+    0x74, 0xb9, 0x15, 0x50, 0x7c, 0x24, 0x30, 0xe8, 0xd1, 0x2c, 0x29, 0x20, 0x8b, 0xc8, 0x5d, 0x15,
+    0xf0, 0x0d, 0x11, 0x48, 0xff, 0xc7, 0x48, 0x83, 0xc3, 0x28, 0x48, 0x3b, 0xfd, 0x7c, 0xba, 0x4d,
+    0x85, 0xc9, 0x74, 0x6a, 0x49, 0x83, 0xc1, 0x03, 0x49, 0x63, 0x01, 0x48, 0x83, 0xc0, 0x03, 0x06,
+    0x50, 0x48, 0x89, 0x05, 0x4b, 0xc9, 0x8e, 0x0f, 0x71, 0x48, 0x20, 0x48, 0x89, 0x0d, 0x48, 0xc9,
+    0x93, 0x1e, 0x50, 0x8b, 0x0d, 0x3f, 0xc9, 0x03, 0x31, 0x2c, 0x61, 0x48, 0x0f, 0x45, 0xc1, 0x48,
+    0x8b, 0xc7, 0x49, 0xf0, 0x00, 0x5b, 0x42, 0x8b, 0x04, 0xb2, 0xc1, 0xf8, 0x04, 0x48, 0x98, 0x48,
+    0x03, 0xc2, 0x74, 0x76, 0x3d, 0x12, 0x10, 0x50, 0x3f, 0x1e, 0x12, 0x60, 0x3c, 0x0f, 0xb3, 0x6b,
+    0x28, 0x49, 0x8b, 0x73, 0x30, 0x0f, 0x28, 0x7c, 0x24, 0x40, 0x41, 0x0f, 0x22, 0x5f, 0xc3, 0xfa,
+    0x1a, 0x52, 0x48, 0x8d, 0x15, 0xf1, 0x1e, 0x23, 0x1b, 0x31, 0x30, 0xe8, 0xbb, 0x58, 0x3d, 0x32,
+    0x15, 0x10, 0xc3, 0x0c, 0x19, 0x45, 0x30, 0xe8, 0x76, 0xe1, 0x23, 0x1b, 0x45, 0x48, 0x8d, 0x15,
+    0xf8, 0x29, 0x00, 0x12, 0x92, 0x29, 0x00, 0x24, 0xe7, 0xc2, 0x29, 0x00, 0x19, 0x4d, 0x29, 0x00,
+    0x15, 0xef, 0x29, 0x00, 0x12, 0x69, 0x29, 0x00, 0x15, 0xbe, 0x29, 0x00, 0x10, 0x24, 0x29, 0x00,
+    0x03, 0x6c, 0x03, 0x05, 0xcc, 0x36, 0x01, 0xd5, 0x04, 0x41, 0x48, 0x8b, 0x7a, 0x10, 0xc6, 0x12,
+    0x10, 0xf1, 0x91, 0x07, 0x60, 0x83, 0xc1, 0x10, 0x41, 0xb8, 0x14, 0x5a, 0x04, 0x10, 0x62, 0x0a,
+    0x2a, 0x31, 0x8b, 0xf0, 0xb8, 0x5e, 0x1c, 0x91, 0x23, 0xf8, 0x48, 0x8d, 0x4f, 0x14, 0x48, 0x3b,
+    0xc8, 0x84, 0x02, 0x20, 0x0f, 0x87, 0xf0, 0x30, 0x10, 0xba, 0x1f, 0x4e, 0x30, 0xe8, 0xd3, 0xfa,
+    0x28, 0x03, 0x10, 0x06, 0x96, 0x23, 0xb1, 0x20, 0x48, 0x8b, 0x48, 0x08, 0x48, 0x83, 0xc1, 0x28,
+    0xe8, 0x2a, 0xb9, 0x12, 0x30, 0x4c, 0x24, 0x28, 0x77, 0x1a, 0x12, 0x40, 0x97, 0x03, 0x11, 0x41,
+    0xb3, 0x03, 0x10, 0x33, 0x3a, 0x02, 0x11, 0x28, 0xf4, 0x02, 0x11, 0x03, 0xb8, 0x03, 0x2a, 0xb3,
+    0x34, 0xb8, 0x03, 0x12, 0x12, 0x38, 0x00, 0x22, 0x8b, 0x01, 0xba, 0x03, 0x20, 0x94, 0x34, 0x25,
+    0x03, 0x20, 0x06, 0x4d, 0x23, 0x25, 0x21, 0x55, 0x10, 0x61, 0x00, 0x61, 0x8b, 0x49, 0x28, 0xe8,
+    0x05, 0x19, 0x17, 0x00, 0x02, 0x14, 0x00, 0x62, 0x5c, 0x24, 0x58, 0x49, 0x03, 0xd6, 0x1c, 0x00,
+    0xf1, 0x09, 0x41, 0x28, 0x41, 0x83, 0x64, 0x06, 0x02, 0x00, 0x49, 0x89, 0x54, 0x06, 0x06, 0x66,
+    0x41, 0xc7, 0x04, 0x06, 0xff, 0x25, 0x48, 0x8b, 0x4d, 0x20, 0x2d, 0x00, 0x61, 0x40, 0x08, 0x48,
+    0x8b, 0x40, 0x28, 0x55, 0x05, 0x00, 0x3b, 0x00, 0x12, 0x18, 0xb0, 0x35, 0x02, 0x38, 0x00, 0xf0,
+    0x01, 0x18, 0x89, 0x54, 0x07, 0x07, 0x48, 0xc1, 0xea, 0x20, 0x89, 0x54, 0x07, 0x0f, 0xc7, 0x04,
+    0x07, 0x34, 0x20, 0xf0, 0x04, 0x66, 0xc7, 0x44, 0x07, 0x04, 0xc7, 0x04, 0xc6, 0x44, 0x07, 0x06,
+    0x24, 0xc7, 0x44, 0x07, 0x0b, 0xc7, 0x44, 0x24, 0x0d, 0x00, 0x10, 0x13, 0x16, 0x04, 0x56, 0x30,
+    0x41, 0x5e, 0x5f, 0x5e, 0xcd, 0x01, 0x71, 0xf4, 0x1c, 0x00, 0x00, 0xe8, 0xf3, 0xe0, 0x76, 0x01,
+    0x24, 0x48, 0xc1, 0xd4, 0x1a, 0x20, 0xae, 0xdf, 0x76, 0x01, 0x41, 0x80, 0x49, 0x28, 0x04, 0x48,
+    0x1c, 0xa0, 0x89, 0x51, 0x18, 0x48, 0x8b, 0xc1, 0x4c, 0x89, 0x41, 0x20, 0x0c, 0x00, 0x12, 0x10,
+    0x14, 0x00, 0x09, 0x68, 0x06, 0x30, 0x4c, 0x8b, 0x54, 0x3d, 0x0b, 0x90, 0xd9, 0x4c, 0x8b, 0xd9,
+    0x4c, 0x3b, 0xd2, 0x0f, 0x87, 0xc3, 0x19, 0x80, 0x49, 0x2b, 0xd2, 0x4c, 0x3b, 0xc2, 0x77, 0x7c,
+    0xa9, 0x0c, 0xf1, 0x07, 0x05, 0x49, 0x8b, 0xc0, 0xeb, 0x76, 0x41, 0x0f, 0xb7, 0x39, 0x48, 0x8d,
+    0x34, 0x51, 0x4a, 0x8d, 0x0c, 0x41, 0x48, 0x8d, 0x46, 0x02, 0x7e, 0x41, 0x00, 0x1c, 0x16, 0x60,
+    0xd1, 0xf8, 0x74, 0x17, 0xeb, 0x0d, 0xd8, 0x1f, 0xe0, 0x74, 0x0f, 0x48, 0xff, 0xc8, 0x48, 0x83,
+    0xc1, 0x02, 0x66, 0x39, 0x39, 0x75, 0xee, 0x76, 0x1b, 0x20, 0x8b, 0xca, 0xb1, 0x02, 0x30, 0x36,
+    0x4d, 0x8b, 0x60, 0x37, 0x50, 0x4d, 0x85, 0xd2, 0x74, 0x1a, 0xde, 0x09, 0xf1, 0x01, 0x2b, 0xcb,
+    0x41, 0x0f, 0xb7, 0x04, 0x11, 0x66, 0x3b, 0x02, 0x75, 0x15, 0x48, 0x83, 0xc2, 0x02, 0x8b, 0x4c,
+    0xc0, 0xec, 0x49, 0x2b, 0xcb, 0x48, 0xd1, 0xf9, 0x48, 0x8b, 0xc1, 0xeb, 0x0a, 0x44, 0x00, 0x6e,
+    0xeb, 0x9a, 0x48, 0x83, 0xc8, 0xff, 0x35, 0x0a, 0x02, 0x48, 0x17, 0x40, 0x4c, 0x89, 0x48, 0x20,
+    0x80, 0x11, 0x30, 0x89, 0x50, 0x10, 0x83, 0x11, 0x13, 0x53, 0x59, 0x02, 0x70, 0x68, 0x49, 0x8b,
+    0xf9, 0x49, 0x8b, 0xd8, 0x45, 0x0a, 0xf1, 0x0c, 0xf1, 0x0f, 0x20, 0xd9, 0x49, 0x8b, 0x50, 0x10,
+    0x48, 0x8b, 0x52, 0x08, 0xe8, 0x5e, 0xe0, 0xff, 0xff, 0x0f, 0x20, 0xd9, 0x48, 0x8b, 0x43, 0x10,
+    0x0f, 0xb7, 0x10, 0x95, 0x01, 0x50, 0x8d, 0x14, 0x50, 0xe8, 0x47, 0x3c, 0x01, 0x04, 0x14, 0x00,
+    0x60, 0x48, 0x08, 0x4c, 0x8d, 0x0d, 0x41, 0x33, 0x07, 0x00, 0x78, 0x00, 0xa1, 0xff, 0xc0, 0x66,
+    0x41, 0x83, 0x3c, 0x41, 0x00, 0x75, 0xf5, 0xea, 0x07, 0x50, 0x45, 0x33, 0xc0, 0xe8, 0xc5, 0x19,
+    0x10, 0xc0, 0x83, 0xf8, 0xff, 0x74, 0x0a, 0xb8, 0x22, 0x00, 0x00, 0xc0, 0xe9, 0x8b, 0xf1, 0x09,
+    0x50, 0x1f, 0x48, 0x8b, 0xbc, 0x24, 0x37, 0x1b, 0x00, 0xdc, 0x0b, 0x00, 0xc9, 0x1a, 0x30, 0x8b,
+    0xb4, 0x24, 0x60, 0x0f, 0x31, 0x4c, 0x8b, 0xb4, 0xb0, 0x14, 0x21, 0x8b, 0x84, 0x4b, 0x0a, 0x11,
+    0x89, 0xe8, 0x38, 0x12, 0x84, 0x55, 0x10, 0x61, 0x89, 0x44, 0x24, 0x48, 0x8b, 0x8c, 0x0a, 0x0c,
+    0x82, 0x89, 0x4c, 0x24, 0x40, 0x8b, 0x8c, 0x24, 0xc8, 0x0b, 0x00, 0x40, 0x38, 0x8b, 0x8c, 0x24,
+    0xa5, 0x26, 0x70, 0x89, 0x4c, 0x24, 0x30, 0x8b, 0x8c, 0x24, 0xe4, 0x1f, 0x00, 0xd9, 0x0c, 0x00,
+    0x2d, 0x00, 0x02, 0xcf, 0x08, 0x10, 0x4c, 0x47, 0x4b, 0xf2, 0x05, 0xcf, 0x4c, 0x8b, 0xc3, 0x8b,
+    0xd6, 0x49, 0x8b, 0xce, 0x48, 0x8b, 0x05, 0x29, 0xc5, 0x03, 0x00, 0xff, 0x15, 0xe3, 0x31, 0x0b,
+    0x14, 0x10, 0x68, 0x20, 0x02, 0x22, 0x5b, 0xc3, 0x30, 0x06, 0x01, 0x2d, 0x06, 0x7a, 0x44, 0x8d,
+    0x42, 0x02, 0xe8, 0x64, 0xd8, 0x57, 0x06, 0x0d, 0x04, 0x19, 0x20, 0x81, 0xec, 0xfc, 0x36, 0x40,
+    0x41, 0x8b, 0xe8, 0x48, 0x7a, 0x18, 0x42, 0xf1, 0x33, 0xd2, 0x41, 0xc0, 0x26, 0x00, 0x6a, 0x19,
+    0x50, 0x33, 0xdb, 0xe8, 0x0c, 0x14, 0x9c, 0x1a, 0x10, 0xc0, 0xc0, 0x19, 0x10, 0x40, 0x05, 0x00,
+    0x30, 0x50, 0xeb, 0x13, 0x18, 0x47, 0x41, 0x68, 0x48, 0x03, 0xf8, 0x08, 0x00, 0x60, 0x03, 0xd8,
+    0x3b, 0xdd, 0x73, 0x26, 0x4d, 0x22, 0x21, 0x60, 0x41, 0x22, 0x08, 0x10, 0x4c, 0x9f, 0x10, 0x00,
+    0x65, 0x15, 0x20, 0x8d, 0x54, 0x02, 0x16, 0x41, 0xce, 0xe8, 0x4e, 0xd8, 0xce, 0x26, 0x30, 0x1d,
+    0xeb, 0xc7, 0x5c, 0x0b, 0x00, 0x6d, 0x00, 0x22, 0x8b, 0xc3, 0x5e, 0x0b, 0x61, 0x6b, 0x18, 0x49,
+    0x8b, 0x73, 0x20, 0x62, 0x0b, 0x05, 0xd8, 0x02, 0x24, 0xec, 0x1a, 0x53, 0x04, 0x21, 0x16, 0xde,
+    0xdd, 0x02, 0x24, 0x6b, 0xbe, 0x53, 0x04, 0x20, 0xd1, 0xdc, 0x80, 0x06, 0x04, 0xbc, 0x07, 0x11,
+    0x30, 0xb0, 0x00, 0x13, 0xd9, 0x9a, 0x2d, 0x91, 0xff, 0xff, 0x03, 0x48, 0x39, 0x41, 0x08, 0x74,
+    0x5f, 0x28, 0x01, 0x00, 0xd6, 0x06, 0x13, 0x28, 0xb1, 0x08, 0x11, 0xc3, 0xe8, 0x01, 0x11, 0xc8,
+    0xc4, 0x00, 0xf0, 0x04, 0x40, 0x10, 0x0f, 0x11, 0x40, 0x20, 0x0f, 0x11, 0x40, 0x30, 0x48, 0x83,
+    0x60, 0x18, 0x00, 0x48, 0x83, 0x60, 0x20, 0x05, 0x00, 0x10, 0x28, 0x05, 0x00, 0x62, 0x30, 0x00,
+    0x48, 0xff, 0x43, 0x08, 0x82, 0x29, 0x11, 0x39, 0x13, 0x09, 0x50, 0x89, 0x4f, 0x08, 0x48, 0x89,
+    0x73, 0x22, 0x02, 0xcd, 0x16, 0x01, 0xdf, 0x20, 0x00, 0x40, 0x26, 0x50, 0x1a, 0x00, 0x00, 0xe8,
+    0xa1, 0xdf, 0x04, 0xa1, 0x4c, 0x8b, 0xdc, 0x49, 0x89, 0x5b, 0x10, 0x45, 0x88, 0x43, 0x4c, 0x1a,
+    0x12, 0x40, 0x92, 0x00, 0xf0, 0x03, 0x49, 0x89, 0x53, 0xd8, 0x49, 0x8d, 0x43, 0x18, 0x49, 0x89,
+    0x43, 0xe0, 0xc6, 0x44, 0x24, 0x30, 0x01, 0xb9, 0x03, 0x0a, 0x20, 0xe8, 0x3b, 0x88, 0x00, 0x01,
+    0x0b, 0x02, 0x41, 0x85, 0xc0, 0x74, 0x22, 0x8f, 0x00, 0x30, 0x00, 0xc7, 0x40, 0x47, 0x1d, 0x31,
+    0x00, 0xc7, 0x40, 0x03, 0x39, 0x40, 0x48, 0x8d, 0x0d, 0x06, 0x9b, 0x1f, 0x11, 0x89, 0x36, 0x3e,
+    0x50, 0x48, 0x89, 0x3b, 0x48, 0x89, 0x91, 0x00, 0x00, 0xe8, 0x39, 0x33, 0x83, 0xc4, 0x40, 0x40,
+    0x34, 0x10, 0x18, 0xe1, 0x00, 0x33, 0x08, 0x56, 0x57, 0x79, 0x12, 0x04, 0x08, 0x29, 0x91, 0xf2,
+    0x48, 0x8b, 0xf9, 0x8b, 0x41, 0x08, 0x89, 0x84, 0x39, 0x02, 0x90, 0x45, 0x33, 0xff, 0x44, 0x38,
+    0x7a, 0x28, 0x0f, 0x84, 0xc5, 0x40, 0x51, 0x48, 0x8b, 0x11, 0xe8, 0xc6, 0x8b, 0x06, 0x50, 0x76,
+    0x10, 0x49, 0x81, 0xe6, 0x97, 0x22, 0x31, 0x48, 0x8b, 0x07, 0xf4, 0x02, 0x50, 0x89, 0x71, 0x10,
+    0x41, 0xbd, 0x74, 0x2d, 0x80, 0x41, 0x8b, 0xd5, 0x41, 0x8b, 0xcd, 0xe8, 0x33, 0x2b, 0x03, 0x22,
+    0x57, 0xc0, 0x8e, 0x1b, 0x23, 0x44, 0x8a, 0x49, 0x0b, 0x22, 0x8b, 0xd0, 0x5d, 0x04, 0x12, 0x0d,
+    0x7a, 0x2c, 0x03, 0x75, 0x05, 0x11, 0x18, 0x82, 0x05, 0x3f, 0xe8, 0xb0, 0xf6, 0x7a, 0x05, 0x0d,
+    0x05, 0x32, 0x09, 0x2f, 0x39, 0x2f, 0x7a, 0x05, 0x0a, 0x21, 0x1a, 0x2f, 0xb4, 0x2d, 0x00, 0x5f,
+    0x00, 0x60, 0x4d, 0x8b, 0xc5, 0x49, 0x8b, 0xd6, 0xeb, 0x16, 0x30, 0xe8, 0x8c, 0x13, 0x16, 0x00,
+    0x10, 0xd6, 0xd6, 0x2a, 0x20, 0xb1, 0xf9, 0x78, 0x0f, 0x40, 0x7c, 0x24, 0x69, 0x66, 0x06, 0x00,
+    0x10, 0x6d, 0x30, 0x35, 0x31, 0x6f, 0x4c, 0x89, 0x5e, 0x18, 0x02, 0x95, 0x00, 0x30, 0x8b, 0x41,
+    0x18, 0x62, 0x01, 0x40, 0x58, 0x0f, 0x20, 0xd8, 0x08, 0x00, 0x82, 0x60, 0x8a, 0x46, 0x28, 0x88,
+    0x44, 0x24, 0x68, 0xde, 0x08, 0x01, 0xc7, 0x29, 0x61, 0x41, 0x8d, 0x49, 0x02, 0xe8, 0x29, 0xf0,
+    0x2b, 0x20, 0x75, 0x3e, 0xb6, 0x03, 0x00, 0x72, 0x03, 0x03, 0x57, 0x18, 0x02, 0x92, 0x0f, 0xc4,
+    0x5f, 0x5e, 0xc3, 0x45, 0x8d, 0x47, 0x01, 0x48, 0x8d, 0x15, 0x92, 0x18, 0x8a, 0x02, 0x21, 0x8c,
+    0xdb, 0x8a, 0x02, 0x24, 0xe1, 0xbb, 0x8a, 0x02, 0x45, 0x47, 0xda, 0xff, 0xff, 0xb2, 0x02, 0x13,
+    0x8a, 0x28, 0x00, 0x32, 0x40, 0xe8, 0x64, 0x28, 0x00, 0x13, 0xb9, 0x28, 0x00, 0x41, 0x40, 0xe8,
+    0x1f, 0xda, 0x05, 0x07, 0x02, 0xd4, 0x17, 0x20, 0x49, 0x08, 0x23, 0x01, 0x21, 0x0a, 0xba, 0x96,
+    0x02, 0x10, 0x8d, 0xdd, 0x02, 0x01, 0xc0, 0x17, 0x00, 0xac, 0x38, 0xa4, 0x79, 0x10, 0x00, 0x74,
+    0x08, 0x48, 0x8b, 0x09, 0xe8, 0x76, 0x17, 0x00, 0x05, 0xf8, 0x09, 0x11, 0x59, 0x86, 0x0a, 0x10,
+    0x10, 0xdf, 0x19, 0x10, 0x35, 0x5f, 0x00, 0x42, 0x8b, 0xcb, 0xe8, 0x51, 0x25, 0x00, 0x02, 0xd0,
+    0x03, 0x05, 0xf8, 0x24, 0x02, 0x46, 0x0a, 0x10, 0x35, 0x1c, 0x00, 0x08, 0x46, 0x0a, 0x06, 0xec,
+    0x0a, 0x30, 0x80, 0x79, 0x28, 0x86, 0x14, 0x10, 0x83, 0x67, 0x01, 0x21, 0x89, 0x01, 0xab, 0x02,
+    0x00, 0x0f, 0x2c, 0x21, 0x49, 0x20, 0xd2, 0x21, 0xa0, 0xff, 0x15, 0x72, 0x2d, 0x00, 0x00, 0x40,
+    0xf6, 0xc7, 0x01, 0x8a, 0x00, 0x42, 0xcb, 0xe8, 0xec, 0xdd, 0x49, 0x00, 0x09, 0x85, 0x21, 0x0e,
+    0x08, 0x0f, 0x40, 0x48, 0x8b, 0x79, 0x08, 0x7d, 0x02, 0x40, 0xd9, 0x48, 0x85, 0xff, 0xa6, 0x00,
+    0x40, 0xcf, 0xe8, 0x8f, 0xda, 0x39, 0x00, 0x93, 0xcf, 0xe8, 0xab, 0xdd, 0xff, 0xff, 0x40, 0xf6,
+    0xc6, 0x4f, 0x00, 0x11, 0x9d, 0x4f, 0x00, 0x00, 0x85, 0x0b, 0x0b, 0x54, 0x00, 0x01, 0x1c, 0x01,
+    0x82, 0x85, 0xc9, 0x74, 0x12, 0x48, 0x8b, 0x01, 0xba, 0xed, 0x19, 0x00, 0x9c, 0x0a, 0x10, 0x0d,
+    0x84, 0x1d, 0x02, 0xe0, 0x18, 0x55, 0x49, 0x10, 0xe9, 0x5f, 0xdd, 0xe4, 0x0a, 0x06, 0xe8, 0x25,
+    0xd1, 0x8d, 0x4a, 0x08, 0x48, 0x8d, 0x15, 0xbc, 0xbd, 0x03, 0x00, 0xe8, 0xcb, 0xde, 0xd2, 0x01,
+    0x97, 0x06, 0x48, 0x8d, 0x43, 0x10, 0xeb, 0x02, 0x33, 0xc0, 0x45, 0x0b, 0x01, 0x80, 0x08, 0x01,
+    0xab, 0x00, 0x01, 0x7c, 0x34, 0x42, 0x48, 0x8d, 0x51, 0x08, 0xc4, 0x01, 0x20, 0xcb, 0xd9, 0x92,
+    0x00, 0x73, 0x4f, 0x10, 0x8b, 0xd3, 0xe8, 0xc8, 0x0b, 0xea, 0x01, 0x51, 0x48, 0x8b, 0xd8, 0xe8,
+    0xe3, 0x18, 0x00, 0x01, 0xa5, 0x00, 0x06, 0x32, 0x0c, 0x07, 0x70, 0x22, 0x02, 0xd0, 0x08, 0x04,
+    0x3f, 0x1e, 0x05, 0x55, 0x00, 0x01, 0x66, 0x19, 0x00, 0x58, 0x00, 0x13, 0x73, 0x58, 0x00, 0x10,
+    0x44, 0x44, 0x00, 0x38, 0xd6, 0xe8, 0xb0, 0x5c, 0x00, 0x11, 0x87, 0x1c, 0x00, 0x00, 0x43, 0x1e,
+    0x0f, 0x61, 0x00, 0x06, 0x06, 0xb0, 0x00, 0x02, 0x2d, 0x35, 0x06, 0xb1, 0x00, 0x13, 0x1a, 0x59,
+    0x00, 0x00, 0xbb, 0x2d, 0x24, 0x1a, 0x0a, 0x9c, 0x02, 0x11, 0x34, 0x16, 0x00, 0x06, 0x4b, 0x00,
+    0x01, 0x20, 0x01, 0x13, 0x50, 0xb2, 0x05, 0x10, 0x20, 0x05, 0x00, 0x11, 0x30, 0xbc, 0x05, 0x40,
+    0x48, 0x8d, 0x05, 0x81, 0x54, 0x01, 0x01, 0x9b, 0x05, 0x01, 0x1f, 0x05, 0xa0, 0x4c, 0x8b, 0xc1,
+    0x33, 0xd2, 0x8d, 0x4a, 0x55, 0xe8, 0xbd, 0x01, 0x11, 0x04, 0xe5, 0x03, 0x10, 0xd4, 0xe4, 0x32,
+    0x50, 0x8b, 0xc8, 0xe8, 0xb8, 0xf7, 0xad, 0x17, 0x21, 0x05, 0xc5, 0x7e, 0x05, 0x32, 0x15, 0x86,
+    0xf8, 0x16, 0x00, 0x11, 0xaa, 0x1e, 0x00, 0xb1, 0xd0, 0x48, 0x8b, 0x0d, 0xb4, 0xbe, 0x03, 0x00,
+    0xe8, 0x6b, 0xfb, 0x1b, 0x0c, 0x00, 0xe7, 0x03, 0x04, 0xa5, 0x02, 0x11, 0x90, 0x70, 0x06, 0x41,
+    0xcb, 0xe8, 0xac, 0xdb, 0xf7, 0x36, 0x01, 0x57, 0x0c, 0xb9, 0x8d, 0x4a, 0x0b, 0x48, 0x83, 0xc4,
+    0x50, 0x5b, 0xe9, 0xaf, 0xd6, 0xac, 0x0c, 0x0e, 0x50, 0x01, 0x48, 0x30, 0xe8, 0x6c, 0xdc, 0x38,
+    0x00, 0x40, 0x08, 0xe8, 0x80, 0xd6, 0x50, 0x00, 0x16, 0xf0, 0x13, 0x00, 0x31, 0x07, 0xe8, 0x6d,
+    0x13, 0x00, 0x16, 0xf8, 0x13, 0x00, 0x40, 0x09, 0xe8, 0x5a, 0xd6, 0x89, 0x00, 0x40, 0x8d, 0x0d,
+    0x7e, 0x2c, 0xe3, 0x00, 0xa2, 0x0f, 0x33, 0xdb, 0x89, 0x5f, 0x08, 0x48, 0x8d, 0x0d, 0x97, 0x0f,
+    0x00, 0x50, 0x48, 0x89, 0x5f, 0x10, 0x05, 0xf8, 0x04, 0x91, 0x8b, 0xd0, 0x48, 0x89, 0x57, 0x18,
+    0x48, 0x8d, 0x8f, 0x68, 0x32, 0x90, 0x89, 0x4f, 0x20, 0xc6, 0x47, 0x28, 0x01, 0xe8, 0x85, 0x23,
+    0x19, 0xf0, 0x00, 0x89, 0x47, 0x10, 0x48, 0x89, 0x3d, 0xa6, 0xbb, 0x03, 0x00, 0x8d, 0x4b, 0x28,
+    0xe8, 0x8e, 0xc5, 0x02, 0x10, 0x89, 0x37, 0x01, 0x00, 0x18, 0x26, 0x00, 0xfa, 0x00, 0x11, 0xec,
+    0x37, 0x05, 0x60, 0xd8, 0x48, 0x89, 0x1d, 0xba, 0xbd, 0x55, 0x0d, 0x72, 0xce, 0xe8, 0x92, 0xfe,
+    0xff, 0xff, 0x90, 0x9a, 0x0c, 0x03, 0xe5, 0x1c, 0x01, 0x22, 0x06, 0x0f, 0x64, 0x07, 0x01, 0x00,
+    0x92, 0x07, 0x11, 0xdb, 0xa5, 0x05, 0x10, 0xe9, 0xec, 0x02, 0xd1, 0x4a, 0x48, 0x8d, 0x7a, 0xff,
+    0x48, 0x85, 0xfa, 0x74, 0x19, 0x41, 0xb8, 0xd8, 0x6c, 0x07, 0x31, 0x15, 0x75, 0x14, 0x00, 0x06,
+    0x70, 0xfe, 0x14, 0x00, 0x00, 0xe8, 0x41, 0xdc, 0x47, 0x04, 0x82, 0x45, 0xff, 0x48, 0xf7, 0xd7,
+    0x48, 0x03, 0xc6, 0x19, 0x33, 0x02, 0x2c, 0x28, 0x71, 0xc7, 0x48, 0x3b, 0xc1, 0x73, 0x0c, 0xbb,
+    0x53, 0x10, 0x62, 0x3b, 0xc3, 0x48, 0x0f, 0x47, 0xd8, 0x88, 0x20, 0x04, 0x54, 0x03, 0x07, 0x9a,
+    0x4e, 0x04, 0x68, 0x0e, 0x20, 0x59, 0xff, 0x89, 0x09, 0x70, 0xf7, 0xd9, 0x48, 0x03, 0xda, 0x48,
+    0x23, 0x35, 0x03, 0x10, 0xff, 0xa4, 0x4c, 0x42, 0x19, 0x41, 0xb8, 0xe6, 0x79, 0x00, 0x10, 0xfc,
+    0x60, 0x05, 0x30, 0x8d, 0x0d, 0x85, 0x79, 0x00, 0x11, 0xc8, 0x61, 0x04, 0x0b, 0x2c, 0x08, 0x02,
+    0x8c, 0x02, 0x41, 0xf7, 0x41, 0x08, 0xfc, 0xff, 0x05, 0x01, 0x37, 0x04, 0x41, 0x19, 0x41, 0xb8,
+    0xa1, 0x91, 0x2d, 0x22, 0x15, 0xbd, 0x3f, 0x00, 0x61, 0x46, 0x19, 0x00, 0x00, 0xe8, 0x89, 0x3f,
+    0x00, 0x00, 0xed, 0x40, 0xf0, 0x00, 0xcb, 0x48, 0x83, 0xe0, 0xfc, 0x48, 0x83, 0xc0, 0x08, 0x48,
+    0x01, 0x43, 0x08, 0xe8, 0x85, 0x2b, 0x00, 0x2a, 0x89, 0x18, 0xfa, 0x03, 0x01, 0xcc, 0x06, 0x0a,
+    0x0c, 0x3b, 0x00, 0x3e, 0x26, 0x00, 0x49, 0x0d, 0x21, 0x68, 0x48, 0x5b, 0x11, 0x50, 0xf2, 0x48,
+    0x83, 0xe1, 0xfc, 0xb6, 0x05, 0x30, 0x60, 0xe8, 0x37, 0xd7, 0x32, 0xf0, 0x08, 0x63, 0x64, 0x24,
+    0x60, 0x4c, 0x63, 0x6c, 0x24, 0x68, 0x49, 0x8b, 0xec, 0x48, 0xc1, 0xe5, 0x05, 0x49, 0x03, 0xed,
+    0x4c, 0x8b, 0xb4, 0xef, 0xae, 0x11, 0x30, 0x4d, 0x85, 0xf6, 0x94, 0x00, 0x12, 0x62, 0x94, 0x00,
+    0x12, 0x29, 0x94, 0x00, 0x60, 0x72, 0x15, 0x00, 0x00, 0xe8, 0xf5, 0xc9, 0x01, 0xe0, 0x8d, 0x5e,
+    0x10, 0x48, 0x89, 0x7e, 0x18, 0x4c, 0x89, 0x33, 0x48, 0x8b, 0xcb, 0xba, 0xc2, 0x20, 0x60, 0x49,
+    0x89, 0x76, 0x18, 0xe8, 0xd9, 0xd4, 0x09, 0x20, 0x3b, 0xd8, 0x0d, 0x01, 0x12, 0x69, 0x3a, 0x00,
+    0x21, 0xef, 0x12, 0x3a, 0x00, 0x10, 0x98, 0x3a, 0x00, 0x11, 0xbb, 0xc8, 0x04, 0x00, 0xea, 0x30,
+    0x12, 0x89, 0x65, 0x00, 0xf4, 0x09, 0x8b, 0x47, 0x20, 0x44, 0x0f, 0xab, 0xe0, 0x89, 0x47, 0x20,
+    0x42, 0x8b, 0x44, 0xa7, 0x24, 0x44, 0x0f, 0xab, 0xe8, 0x42, 0x89, 0x44, 0xa7, 0x24, 0x78, 0x3e,
+    0x06, 0x25, 0x1a, 0x06, 0x24, 0x0f, 0x11, 0x20, 0xd8, 0x00, 0x61, 0x83, 0x60, 0x10, 0x00, 0x33,
+    0xff, 0x72, 0x08, 0x01, 0xbd, 0x43, 0x10, 0x48, 0x89, 0x19, 0x02, 0x38, 0x0a, 0x40, 0xca, 0x48,
+    0x81, 0xfa, 0xdd, 0x01, 0xc0, 0x72, 0x31, 0x48, 0x8b, 0xc2, 0x8d, 0x4f, 0xff, 0x48, 0xc1, 0xe8,
+    0x20, 0x73, 0x02, 0x20, 0x0f, 0xbd, 0xfa, 0x3d, 0x81, 0x83, 0xc1, 0x20, 0xeb, 0x06, 0x0f, 0xbd,
+    0xc3, 0x0b, 0x00, 0x11, 0xfb, 0x71, 0x06, 0xa1, 0xd3, 0xe0, 0xff, 0xc8, 0x48, 0x63, 0xc8, 0x48,
+    0x03, 0xcb, 0xb4, 0x51, 0x00, 0x20, 0x01, 0x30, 0x38, 0xe8, 0x17, 0xaf, 0x4c, 0x62, 0x7c, 0x24,
+    0x38, 0x19, 0x7d, 0x55, 0x16, 0x00, 0x22, 0x8b, 0xce, 0x19, 0x00, 0x20, 0x1a, 0x04, 0x65, 0x00,
+    0x10, 0xf8, 0xc6, 0x02, 0x12, 0x3b, 0xb8, 0x07, 0xa1, 0xe1, 0xfc, 0x48, 0x3b, 0xcb, 0x73, 0x19,
+    0x41, 0xb8, 0x0a, 0x95, 0x1a, 0x31, 0x15, 0xfc, 0x11, 0xf3, 0x00, 0x10, 0x15, 0xd5, 0x08, 0x70,
+    0xc8, 0xd9, 0xff, 0xff, 0x44, 0x8b, 0x4c, 0x40, 0x00, 0x21, 0xd7, 0x44, 0x7b, 0x51, 0x41, 0x8b,
+    0xce, 0xe8, 0x13, 0xf1, 0x32, 0x03, 0xcb, 0x10, 0x00, 0x51, 0x12, 0x06, 0xc0, 0x01, 0x01, 0x08,
+    0x06, 0x02, 0xe3, 0x00, 0x01, 0xce, 0x0d, 0x10, 0xda, 0xaa, 0x12, 0x02, 0x26, 0x35, 0x00, 0x73,
+    0x00, 0x00, 0x93, 0x01, 0x12, 0xbb, 0x59, 0x01, 0x12, 0x96, 0x66, 0x00, 0x20, 0x7f, 0x18, 0xe8,
+    0x0d, 0xc1, 0xd9, 0xff, 0xff, 0xf6, 0x47, 0x08, 0x01, 0x74, 0x5d, 0x48, 0xf7, 0x43, 0x56, 0x02,
+    0x00, 0x29, 0x00, 0x12, 0xbf, 0x29, 0x00, 0x12, 0x6d, 0x29, 0x00, 0x10, 0xb6, 0x29, 0x00, 0x12,
+    0x39, 0xf1, 0x04, 0x02, 0xbc, 0x3f, 0x04, 0x0d, 0x02, 0x30, 0x40, 0xe8, 0x2a, 0x5d, 0x37, 0x11,
+    0x8b, 0x86, 0x31, 0x01, 0xa6, 0x00, 0x01, 0x65, 0x0a, 0x00, 0x72, 0x37, 0x01, 0xe0, 0x15, 0x31,
+    0xcb, 0xe8, 0x46, 0x91, 0x17, 0x12, 0xd8, 0xac, 0x00, 0x09, 0x74, 0x02, 0x07, 0x54, 0x07, 0xb1,
+    0x83, 0xe3, 0xfc, 0x48, 0x8d, 0x5b, 0x08, 0x48, 0x8d, 0x1c, 0x0b, 0xa7, 0x00, 0x02, 0x0d, 0x03,
+    0x10, 0xef, 0x17, 0x04, 0x40, 0x8d, 0x0d, 0x48, 0x11, 0x00, 0x02, 0x0a, 0x39, 0x0b, 0x0b, 0xf8,
+    0x06, 0x30, 0x33, 0xc0, 0x49, 0x63, 0x00, 0x00, 0x32, 0x0b, 0x01, 0xce, 0x01, 0x00, 0x24, 0x47,
+    0x30, 0x48, 0x85, 0xdb, 0x4c, 0x00, 0x12, 0x16, 0x59, 0x01, 0x12, 0xa3, 0x4c, 0x00, 0x10, 0xfc,
+    0xca, 0x00, 0x22, 0x6f, 0xd8, 0xf3, 0x00, 0x00, 0x1f, 0x00, 0x12, 0xca, 0xe9, 0x00, 0x12, 0x84,
+    0x1f, 0x00, 0x10, 0x3d, 0x1f, 0x00, 0x11, 0x50, 0x6b, 0x00, 0x62, 0x4f, 0x08, 0x48, 0x8d, 0x43,
+    0x20, 0xa2, 0x01, 0x20, 0xc8, 0x72, 0x6d, 0x41, 0x00, 0x47, 0x07, 0x11, 0x44, 0x4f, 0x01, 0x10,
+    0xcf, 0x3e, 0x06, 0x00, 0xd0, 0x3c, 0x02, 0x78, 0x44, 0xa1, 0x48, 0x89, 0x38, 0x48, 0x83, 0x4b,
+    0x08, 0x02, 0xe8, 0xb6, 0xf8, 0x0e, 0x30, 0xcf, 0xe8, 0x22, 0x1b, 0x00, 0xdc, 0x83, 0x60, 0x08,
+    0xfd, 0x48, 0x8d, 0x47, 0x10, 0x48, 0x83, 0x67, 0x08, 0xfe, 0xf7, 0x12, 0x0c, 0x94, 0x04, 0x06,
+    0x74, 0x03, 0x91, 0x69, 0x08, 0x48, 0x8d, 0x79, 0x08, 0x48, 0x03, 0xfa, 0x7b, 0x24, 0xb1, 0xf1,
+    0x48, 0x83, 0xe5, 0xfc, 0x4c, 0x8b, 0xf5, 0x4c, 0x2b, 0xf2, 0x2a, 0x03, 0x00, 0x5d, 0x14, 0x30,
+    0x4c, 0x2b, 0xf2, 0x59, 0x01, 0x10, 0xa9, 0x5f, 0x22, 0x02, 0x30, 0x03, 0x12, 0x92, 0xc5, 0x00,
+    0x10, 0xbf, 0xab, 0x0f, 0x90, 0x8d, 0x0d, 0x38, 0x13, 0x00, 0x00, 0xe8, 0x8b, 0xd7, 0x8b, 0x00,
+    0x21, 0x46, 0x08, 0xfb, 0x03, 0x01, 0x4a, 0x36, 0x22, 0xb8, 0x94, 0x26, 0x00, 0x12, 0x99, 0x26,
+    0x00, 0x10, 0x02, 0x63, 0x04, 0xe0, 0x65, 0xd7, 0xff, 0xff, 0x8b, 0x47, 0x08, 0x83, 0xe0, 0x03,
+    0x49, 0x0b, 0xc6, 0x48, 0xbd, 0x14, 0x01, 0x2a, 0x04, 0x20, 0xf8, 0x18, 0x93, 0x02, 0x12, 0x96,
+    0x30, 0x00, 0x12, 0x69, 0x30, 0x00, 0x10, 0x52, 0x30, 0x00, 0x10, 0x35, 0x56, 0x00, 0x40, 0x83,
+    0x66, 0x08, 0x03, 0x7e, 0x44, 0x51, 0x09, 0x7e, 0x08, 0xe8, 0x38, 0xa2, 0x1d, 0x0a, 0x5d, 0x22,
+    0x40, 0x83, 0x48, 0x08, 0x02, 0x13, 0x01, 0x00, 0x6c, 0x13, 0x34, 0x4f, 0x08, 0x01, 0x91, 0x03,
+    0x01, 0x8c, 0x05, 0x30, 0x4c, 0x8b, 0xd2, 0xd2, 0x16, 0x20, 0x81, 0xf9, 0x66, 0x03, 0xf0, 0x0a,
+    0x73, 0x13, 0x41, 0x8b, 0xc1, 0x33, 0xc9, 0x99, 0x83, 0xe2, 0x07, 0x44, 0x8d, 0x0c, 0x02, 0x41,
+    0xc1, 0xf9, 0x03, 0xeb, 0x2f, 0x49, 0x8b, 0xc1, 0xba, 0x41, 0x0c, 0x09, 0x7b, 0x03, 0xff, 0x11,
+    0xd0, 0x83, 0xc2, 0x20, 0xeb, 0x07, 0x41, 0x0f, 0xbd, 0xc1, 0x0f, 0x45, 0xd0, 0x8d, 0x4a, 0xfb,
+    0x49, 0xd3, 0xe9, 0x8d, 0x4a, 0xf9, 0x41, 0x83, 0xf1, 0x20, 0x41, 0x89, 0x0a, 0x45, 0x89, 0x08,
+    0x50, 0x01, 0x06, 0x41, 0x4c, 0x8b, 0x72, 0x18, 0xde, 0x10, 0x00, 0xe5, 0x10, 0x73, 0xd9, 0x4d,
+    0x63, 0xf9, 0x49, 0x63, 0xf0, 0x9f, 0x04, 0x12, 0x46, 0xdf, 0x00, 0x21, 0x8a, 0x0e, 0xdf, 0x00,
+    0x60, 0x13, 0x10, 0x00, 0x00, 0xe8, 0x56, 0xcb, 0x06, 0x11, 0x85, 0x01, 0x03, 0x12, 0x47, 0x1e,
+    0x00, 0x12, 0x6c, 0x1e, 0x00, 0x10, 0x55, 0x1e, 0x00, 0x80, 0x38, 0xd6, 0xff, 0xff, 0x4c, 0x89,
+    0x77, 0x18, 0xf2, 0x01, 0x31, 0xc1, 0xe1, 0x05, 0x51, 0x1b, 0x60, 0x7e, 0x10, 0x48, 0x39, 0xac,
+    0xcb, 0x90, 0x04, 0x51, 0x75, 0x26, 0x48, 0x89, 0xbc, 0x0a, 0x00, 0xfd, 0x0f, 0x48, 0x3b, 0xfb,
+    0x75, 0x19, 0x8b, 0x44, 0xb3, 0x24, 0x44, 0x0f, 0xb3, 0xf8, 0x89, 0x44, 0xb3, 0x24, 0x85, 0xc0,
+    0x75, 0x09, 0x8b, 0x43, 0x20, 0x0f, 0xb3, 0xf0, 0x89, 0x43, 0x20, 0x2e, 0x01, 0x05, 0x1e, 0x01,
+    0x0f, 0x68, 0x24, 0x05, 0xf2, 0x34, 0x20, 0x48, 0x63, 0x1a, 0x48, 0x8b, 0xe9, 0x41, 0x8b, 0x08,
+    0x41, 0x83, 0xca, 0xff, 0x41, 0x8b, 0xc2, 0x83, 0xce, 0xff, 0xd3, 0xe0, 0x4d, 0x8b, 0xf0, 0x8b,
+    0x7c, 0x9d, 0x24, 0x23, 0xf8, 0x75, 0x3f, 0x8d, 0x4b, 0x01, 0x41, 0xd3, 0xe2, 0x44, 0x23, 0x55,
+    0x20, 0x75, 0x04, 0x33, 0xc0, 0xeb, 0x4d, 0x41, 0x0f, 0xbc, 0xc2, 0x8b, 0xde, 0x0f, 0x45, 0xd8,
+    0x48, 0x63, 0xc3, 0x89, 0x1a, 0x8b, 0x7c, 0x85, 0x24, 0xd4, 0x00, 0x12, 0x39, 0xd4, 0x00, 0x10,
+    0x98, 0x72, 0x30, 0xf1, 0x16, 0x8d, 0x0d, 0xa1, 0x0e, 0x00, 0x00, 0xe8, 0x64, 0xd5, 0xff, 0xff,
+    0x0f, 0xbc, 0xc7, 0x0f, 0x45, 0xf0, 0x48, 0x63, 0xc3, 0x48, 0xc1, 0xe0, 0x05, 0x48, 0x63, 0xce,
+    0x48, 0x03, 0xc1, 0x41, 0x89, 0x36, 0x48, 0x8b, 0x84, 0xc5, 0xce, 0x00, 0x02, 0xba, 0x02, 0x01,
+    0xd8, 0x06, 0x01, 0x2b, 0x09, 0x12, 0x7c, 0x74, 0x04, 0x01, 0x3b, 0x24, 0x09, 0xbc, 0x15, 0x10,
+    0xc2, 0x81, 0x03, 0x90, 0x99, 0x49, 0x83, 0xc0, 0xf0, 0x83, 0xe2, 0x07, 0x49, 0x50, 0x17, 0xf0,
+    0x01, 0x03, 0xc2, 0x83, 0xe0, 0x07, 0x48, 0x3b, 0xc2, 0x75, 0x3d, 0x49, 0x8d, 0x40, 0xe8, 0xba,
+    0xe8, 0xd7, 0x01, 0xf2, 0x07, 0x3b, 0xc2, 0x77, 0x2f, 0x49, 0x83, 0xe0, 0xfd, 0x48, 0x8d, 0x5f,
+    0xf8, 0x49, 0x83, 0xc8, 0x01, 0x48, 0x8b, 0xd3, 0x4c, 0x89, 0x07, 0x34, 0x21, 0x41, 0x8b, 0xcb,
+    0xe8, 0xe7, 0x35, 0x25, 0x51, 0x18, 0x48, 0xc7, 0x40, 0x08, 0xac, 0x26, 0x21, 0x8b, 0xc7, 0x42,
+    0x0a, 0x09, 0xa4, 0x0a, 0x00, 0xb4, 0x5a, 0x00, 0x49, 0x11, 0x30, 0x8b, 0xc1, 0x48, 0x3c, 0x02,
+    0x05, 0x67, 0x00, 0x10, 0x74, 0xfe, 0x00, 0x30, 0x40, 0x83, 0x61, 0x09, 0x29, 0x10, 0x91, 0xbc,
+    0x00, 0xf1, 0x00, 0x4c, 0x89, 0x41, 0x10, 0x4c, 0x8d, 0x49, 0x24, 0x4c, 0x89, 0x41, 0x18, 0x41,
+    0xba, 0x19, 0xe6, 0x33, 0x00, 0x42, 0x17, 0x40, 0xfa, 0x48, 0x81, 0xc2, 0x81, 0x02, 0x80, 0x4d,
+    0x8d, 0x49, 0x04, 0x49, 0x8b, 0xc0, 0xb9, 0x38, 0x36, 0x40, 0xf3, 0x48, 0xab, 0x49, 0xd7, 0x36,
+    0x14, 0xdd, 0x43, 0x59, 0x0e, 0x5c, 0x0b, 0x00, 0x90, 0x03, 0x30, 0xe8, 0x7e, 0xff, 0x8a, 0x09,
+    0x32, 0x87, 0x78, 0xe6, 0x35, 0x23, 0x31, 0x8d, 0x96, 0x88, 0x8c, 0x12, 0x31, 0xd8, 0xe8, 0xf1,
+    0x0b, 0x03, 0x0f, 0x54, 0x0b, 0x01, 0x00, 0x92, 0x04, 0x11, 0xef, 0x35, 0x10, 0x0a, 0xa5, 0x05,
+    0xa0, 0x8d, 0x5a, 0xf0, 0x48, 0x8b, 0xf1, 0xf6, 0x43, 0x08, 0x01, 0x9f, 0x03, 0x10, 0xa5, 0x1d,
+    0x06, 0x31, 0x8d, 0x15, 0xfa, 0xa2, 0x0a, 0x20, 0x0d, 0xf3, 0x6f, 0x03, 0x22, 0xc6, 0xd3, 0x15,
+    0x01, 0x10, 0xd2, 0x65, 0x13, 0x02, 0x57, 0x03, 0x10, 0x18, 0x6a, 0x04, 0xa3, 0x01, 0xf6, 0x43,
+    0x08, 0x02, 0x74, 0x7a, 0x48, 0x8b, 0x3b, 0xae, 0x02, 0x12, 0xae, 0xda, 0x01, 0x12, 0xbe, 0x3c,
+    0x00, 0x10, 0xb7, 0x31, 0x05, 0x26, 0x8a, 0xd3, 0xe5, 0x04, 0x12, 0xaf, 0x1f, 0x00, 0x12, 0x9f,
+    0x1f, 0x00, 0x10, 0xf8, 0x1f, 0x00, 0x11, 0x6b, 0x5b, 0x00, 0x0d, 0xce, 0x05, 0x22, 0x5c, 0xfc,
+    0x74, 0x06, 0x09, 0xce, 0x05, 0x11, 0x9f, 0xd7, 0x04, 0x01, 0x00, 0x05, 0x11, 0x78, 0x72, 0x0a,
+    0x13, 0xd8, 0xa3, 0x49, 0x11, 0x86, 0xb5, 0x01, 0x10, 0xd0, 0x0b, 0x00, 0x11, 0xbb, 0x19, 0x00,
+    0x03, 0xe5, 0x04, 0x03, 0x95, 0x06, 0x0e, 0x20, 0x02, 0x41, 0xf9, 0x48, 0x8b, 0xc8, 0xc8, 0x04,
+    0x21, 0xe8, 0x67, 0xa9, 0x0e, 0x13, 0xd0, 0x4c, 0x05, 0x10, 0x59, 0x8c, 0x22, 0x00, 0x37, 0x01,
+    0x02, 0x11, 0x00, 0x04, 0x3d, 0x01, 0x20, 0xe9, 0x15, 0x15, 0x2e, 0x0f, 0x2c, 0x05, 0x07, 0x00,
+    0x5c, 0x12, 0x02, 0x41, 0x08, 0x40, 0x8b, 0xc8, 0xe8, 0x15, 0x52, 0x00, 0x30, 0x8d, 0x4e, 0x20,
+    0x9f, 0x0e, 0x70, 0x03, 0xc8, 0x48, 0x8b, 0xe8, 0xe8, 0x03, 0x12, 0x00, 0x20, 0x85, 0xed, 0x3c,
+    0x26, 0x40, 0xfe, 0x08, 0x77, 0x03, 0x3e, 0x2a, 0x73, 0x8b, 0xd0, 0x49, 0x8b, 0xce, 0xe8, 0xea,
+    0xc6, 0x00, 0x00, 0xad, 0x1f, 0x00, 0xdc, 0x5b, 0x50, 0x4c, 0x8d, 0x78, 0x10, 0x48, 0xc8, 0x11,
+    0x31, 0xcf, 0xe8, 0x53, 0x98, 0x00, 0x60, 0xf8, 0x49, 0x2b, 0xff, 0x0f, 0x84, 0x56, 0x12, 0x61,
+    0x48, 0x83, 0xff, 0x20, 0x73, 0x44, 0xc7, 0x4a, 0x00, 0xf8, 0x03, 0x92, 0x2b, 0xd7, 0x48, 0x3b,
+    0xd6, 0x48, 0x0f, 0x47, 0xca, 0x66, 0x00, 0x25, 0xe8, 0x24, 0x2f, 0x00, 0x21, 0x74, 0x60, 0x2b,
+    0x00, 0x00, 0x38, 0x05, 0x02, 0xc9, 0x01, 0x11, 0x31, 0x15, 0x0c, 0x80, 0x0d, 0xca, 0x12, 0x00,
+    0x00, 0xe8, 0xfd, 0xd1, 0x27, 0x00, 0x52, 0x4b, 0x08, 0x48, 0x8d, 0x47, 0x53, 0x06, 0x20, 0x8b,
+    0xf3, 0x56, 0x06, 0x50, 0x2a, 0x48, 0x8d, 0x57, 0xf8, 0xe1, 0x01, 0x12, 0xed, 0xfe, 0x02, 0x31,
+    0x48, 0x8b, 0xf0, 0xe7, 0x01, 0x21, 0xe8, 0xe1, 0xe1, 0x0b, 0x10, 0xd3, 0x59, 0x12, 0x41, 0x89,
+    0x18, 0xe8, 0x5f, 0x65, 0x00, 0x10, 0xde, 0xdb, 0x27, 0x02, 0x14, 0x00, 0x0f, 0x43, 0x04, 0x04,
+    0x3c, 0xe9, 0xe6, 0xf8, 0xd1, 0x0b, 0x05, 0xe0, 0x18, 0x2a, 0x5b, 0x21, 0xe0, 0x18, 0x2f, 0x9b,
+    0xcf, 0xe0, 0x18, 0x02, 0x02, 0x01, 0x00, 0x40, 0x66, 0x66, 0x0f, 0x1f, 0x7b, 0x14, 0x00, 0xcc,
+    0x04, 0xf1, 0x0a, 0x0d, 0x29, 0xaf, 0x03, 0x00, 0x75, 0x10, 0x48, 0xc1, 0xc1, 0x10, 0x66, 0xf7,
+    0xc1, 0xff, 0xff, 0x75, 0x01, 0xc3, 0x48, 0xc1, 0xc9, 0x10, 0xe9, 0x12, 0xca, 0x2b, 0x00, 0x70,
+    0x33, 0x08, 0x01, 0x00, 0x10, 0xb9, 0xb5, 0x03, 0x2a, 0xcd, 0x29, 0x80, 0x00, 0xc1, 0x10, 0x33,
+    0xc0, 0x33, 0xc9, 0x0f, 0xa2, 0x44, 0x8b, 0xc0, 0x33, 0xc9, 0x36, 0x09, 0xc0, 0x45, 0x32, 0xc9,
+    0x0f, 0xa2, 0x89, 0x04, 0x24, 0x44, 0x8b, 0xd1, 0xb8, 0x6c, 0x3f, 0x40, 0x89, 0x5c, 0x24, 0x04,
+    0x48, 0x11, 0xc0, 0x89, 0x54, 0x24, 0x0c, 0x44, 0x3b, 0xc0, 0x7c, 0x24, 0x33, 0xc9, 0x45, 0x1b,
+    0x46, 0x00, 0x24, 0x00, 0x41, 0x0f, 0xba, 0xe3, 0x09, 0xb7, 0x2a, 0x00, 0x25, 0x00, 0x44, 0x44,
+    0x0f, 0x42, 0xc8, 0x29, 0x00, 0x70, 0x41, 0x0f, 0xba, 0xe2, 0x14, 0x73, 0x26, 0x07, 0x00, 0x30,
+    0x1b, 0x73, 0x1f, 0x07, 0x00, 0xf0, 0x0b, 0x1c, 0x73, 0x18, 0x33, 0xc9, 0x0f, 0x01, 0xd0, 0x48,
+    0xc1, 0xe2, 0x20, 0x48, 0x0b, 0xd0, 0x80, 0xe2, 0x06, 0x80, 0xfa, 0x06, 0x75, 0x04, 0x41, 0x80,
+    0xc9, 0x04, 0x00, 0x81, 0x01, 0x44, 0x88, 0x0d, 0x8d, 0xae, 0x03, 0x00, 0x90, 0x0e, 0x14, 0x10,
+    0x90, 0x0e, 0x60, 0x83, 0xec, 0x28, 0x4d, 0x8b, 0x41, 0x43, 0x3a, 0x3f, 0x49, 0x8b, 0xd1, 0xc0,
+    0x26, 0x00, 0x50, 0x83, 0xec, 0x28, 0x41, 0x8b, 0x4c, 0x5d, 0x10, 0x44, 0x60, 0x1e, 0x70, 0xd1,
+    0x41, 0x83, 0xe3, 0xf8, 0xa8, 0x04, 0xb7, 0x44, 0xf1, 0x0d, 0x40, 0x08, 0x4d, 0x63, 0x50, 0x04,
+    0xf7, 0xd8, 0x4c, 0x03, 0xd1, 0x48, 0x63, 0xc8, 0x4c, 0x23, 0xd1, 0x49, 0x63, 0xc3, 0x4e, 0x8b,
+    0x04, 0x10, 0x48, 0x8b, 0x42, 0x10, 0xfe, 0x10, 0xc0, 0x42, 0x08, 0x0f, 0xb6, 0x54, 0x01, 0x03,
+    0xf6, 0xc2, 0x0f, 0x74, 0x08, 0xd4, 0x3b, 0xc1, 0xf0, 0x4c, 0x03, 0xc8, 0x4d, 0x33, 0xc8, 0x49,
+    0x8b, 0xc9, 0xe8, 0xa6, 0xbf, 0x14, 0x02, 0x62, 0x00, 0x0a, 0x70, 0x01, 0x2c, 0xff, 0xe0, 0x8c,
+    0x01, 0x0b, 0x20, 0x00, 0x38, 0x25, 0x82, 0x1d, 0x73, 0x01, 0x93, 0x48, 0x8b, 0xc1, 0x0f, 0xb6,
+    0xd2, 0x49, 0xb9, 0x01, 0x01, 0x00, 0xf0, 0x0f, 0x49, 0x0f, 0xaf, 0xd1, 0x66, 0x48, 0x0f, 0x6e,
+    0xc2, 0x0f, 0x16, 0xc0, 0x49, 0x83, 0xf8, 0x40, 0x72, 0x6e, 0xf6, 0x05, 0x97, 0xad, 0x03, 0x00,
+    0x02, 0x74, 0x0d, 0x49, 0x81, 0xf8, 0x97, 0x1d, 0x11, 0x0f, 0x64, 0x5c, 0x60, 0x0f, 0x11, 0x01,
+    0x4c, 0x03, 0xc1, 0xef, 0x17, 0x71, 0x48, 0x83, 0xe1, 0xf0, 0x4c, 0x2b, 0xc1, 0x2d, 0x00, 0xf0,
+    0x21, 0x47, 0x4a, 0x8d, 0x54, 0x01, 0xf0, 0x4e, 0x8d, 0x4c, 0x01, 0xd0, 0x49, 0x83, 0xe1, 0xf0,
+    0x49, 0xc1, 0xe8, 0x06, 0x0f, 0x29, 0x01, 0x0f, 0x29, 0x41, 0x10, 0x48, 0x83, 0xc1, 0x40, 0x49,
+    0xff, 0xc8, 0x0f, 0x29, 0x41, 0xe0, 0x0f, 0x29, 0x41, 0xf0, 0x75, 0xe8, 0x41, 0x0f, 0x29, 0x01,
+    0x41, 0x1a, 0x00, 0x00, 0x05, 0x00, 0x80, 0x20, 0x0f, 0x11, 0x02, 0xc3, 0x0f, 0x1f, 0x44, 0x2a,
+    0x51, 0xf0, 0x11, 0xf8, 0x10, 0x72, 0x2a, 0x4d, 0x8d, 0x4c, 0x08, 0xf0, 0x49, 0x83, 0xe0, 0x20,
+    0x0f, 0x11, 0x01, 0x49, 0xd1, 0xe8, 0x41, 0x0f, 0x11, 0x01, 0x42, 0x0f, 0x11, 0x04, 0x01, 0x49,
+    0xf7, 0xd8, 0x43, 0x08, 0x00, 0x15, 0xc3, 0xd0, 0x00, 0x42, 0x49, 0x83, 0xf8, 0x04, 0x30, 0x00,
+    0x70, 0xfc, 0x49, 0x83, 0xe0, 0x08, 0x89, 0x11, 0x2f, 0x00, 0x51, 0x89, 0x11, 0x42, 0x89, 0x14,
+    0x2d, 0x00, 0x50, 0x89, 0x14, 0x01, 0xc3, 0x66, 0x01, 0x00, 0x04, 0x30, 0x00, 0x70, 0x4d, 0x85,
+    0xc0, 0x74, 0x11, 0x88, 0x11, 0xa3, 0x00, 0x20, 0xfe, 0x49, 0xe8, 0x16, 0x5d, 0x04, 0x66, 0x41,
+    0x89, 0x11, 0xc1, 0x02, 0x0f, 0x01, 0x00, 0x16, 0xa0, 0x57, 0xf6, 0x05, 0x78, 0xac, 0x03, 0x00,
+    0x01, 0x74, 0x32, 0xee, 0x0c, 0xb0, 0x03, 0xc1, 0x0f, 0x11, 0x01, 0x48, 0x83, 0xc7, 0x40, 0x0f,
+    0x11, 0xf3, 0x00, 0xf0, 0x12, 0xe7, 0xc0, 0x0f, 0x11, 0x41, 0x20, 0x4c, 0x2b, 0xc7, 0x0f, 0x11,
+    0x41, 0x30, 0x49, 0x8b, 0xc8, 0x4c, 0x8b, 0xc8, 0x66, 0x48, 0x0f, 0x7e, 0xc0, 0xf3, 0xaa, 0x49,
+    0x8b, 0xc1, 0x5f, 0xc3, 0xe8, 0x3f, 0x76, 0x16, 0x1f, 0xc7, 0x7c, 0x00, 0x26, 0x00, 0x01, 0x00,
+    0x70, 0x41, 0x51, 0x41, 0x50, 0x52, 0x51, 0x50, 0x6c, 0x0f, 0x01, 0x49, 0x21, 0x71, 0xe8, 0xcb,
+    0xfc, 0xff, 0xff, 0x0f, 0x28, 0x16, 0x10, 0x9f, 0xc4, 0x30, 0x58, 0x59, 0x5a, 0x41, 0x58, 0x41,
+    0x59, 0xdf, 0x00, 0x08, 0x20, 0x48, 0x8b, 0xba, 0x01, 0x30, 0x08, 0x72, 0x37, 0x79, 0x01, 0xf2,
+    0x13, 0x77, 0x11, 0x4c, 0x8b, 0x1a, 0x4a, 0x8b, 0x54, 0x02, 0xf8, 0x4c, 0x89, 0x19, 0x4a, 0x89,
+    0x54, 0x01, 0xf8, 0xc3, 0x49, 0x83, 0xf8, 0x20, 0x77, 0x5a, 0x0f, 0x10, 0x02, 0x42, 0x0f, 0x10,
+    0x4c, 0x02, 0xf0, 0x89, 0x01, 0x60, 0x4c, 0x01, 0xf0, 0xc3, 0x0f, 0x1f, 0x65, 0x13, 0x01, 0x50,
+    0x01, 0xf0, 0x06, 0x15, 0x48, 0x2b, 0xd1, 0x72, 0x16, 0x44, 0x8a, 0x1c, 0x11, 0x48, 0xff, 0xc1,
+    0x49, 0xff, 0xc8, 0x44, 0x88, 0x59, 0xff, 0x75, 0x22, 0x00, 0x00, 0xd0, 0x01, 0xa1, 0x03, 0xc8,
+    0x44, 0x8a, 0x5c, 0x11, 0xff, 0x48, 0xff, 0xc9, 0x1a, 0x00, 0x31, 0x19, 0x75, 0xf0, 0x91, 0x01,
+    0x04, 0x90, 0x01, 0xf1, 0x00, 0x4e, 0x8d, 0x1c, 0x02, 0x48, 0x2b, 0xd1, 0x73, 0x09, 0x4c, 0x3b,
+    0xd9, 0x0f, 0x87, 0x6e, 0x9f, 0x1b, 0x10, 0x04, 0x35, 0x3e, 0x60, 0x10, 0xf6, 0xc1, 0x0f, 0x74,
+    0x12, 0x5d, 0x02, 0x91, 0x0f, 0x10, 0x0c, 0x11, 0x0f, 0x11, 0x00, 0x0f, 0x28, 0x6f, 0x02, 0xf0,
+    0x03, 0x4c, 0x03, 0xc0, 0x4c, 0x2b, 0xc1, 0x4d, 0x8b, 0xc8, 0x49, 0xc1, 0xe9, 0x06, 0x74, 0x6f,
+    0x49, 0x81, 0xf9, 0xfd, 0x0f, 0x20, 0x0f, 0x87, 0xea, 0x41, 0x61, 0x49, 0x83, 0xe0, 0x3f, 0xeb,
+    0x2d, 0xf0, 0x01, 0x06, 0x62, 0x00, 0x0f, 0x0f, 0x00, 0x0b, 0x01, 0x5d, 0x00, 0xe0, 0x10, 0x54,
+    0x11, 0x10, 0x0f, 0x10, 0x5c, 0x11, 0x20, 0x0f, 0x10, 0x64, 0x11, 0x30, 0xa0, 0x02, 0x02, 0xaf,
+    0x02, 0xf2, 0x03, 0xc9, 0x0f, 0x29, 0x49, 0xc0, 0x0f, 0x29, 0x51, 0xd0, 0x0f, 0x29, 0x59, 0xe0,
+    0x0f, 0x28, 0xc4, 0x75, 0xd1, 0x78, 0x00, 0x35, 0x04, 0x74, 0x19, 0x40, 0x00, 0x34, 0x29, 0x41,
+    0xf0, 0xb2, 0x00, 0xf0, 0x0a, 0x49, 0xff, 0xc9, 0x75, 0xef, 0x49, 0x83, 0xe0, 0x0f, 0x74, 0x0e,
+    0x4e, 0x8d, 0x5c, 0x01, 0xf0, 0x41, 0x0f, 0x10, 0x0c, 0x13, 0x41, 0x0f, 0x11, 0x0b, 0x25, 0x00,
+    0x02, 0x87, 0x02, 0x07, 0x79, 0x00, 0x03, 0x40, 0x01, 0x02, 0xc9, 0x00, 0x00, 0xba, 0x00, 0x7f,
+    0x0f, 0x18, 0x44, 0x11, 0x40, 0xeb, 0x2e, 0xbf, 0x00, 0x1a, 0x1f, 0x90, 0xc0, 0x00, 0x01, 0x12,
+    0x2b, 0xc0, 0x00, 0x01, 0x50, 0x00, 0x00, 0xc5, 0x00, 0x92, 0x2b, 0x49, 0xc0, 0x0f, 0x2b, 0x51,
+    0xd0, 0x0f, 0x2b, 0xc5, 0x00, 0xc0, 0xcc, 0x0f, 0xae, 0xf8, 0xe9, 0x33, 0xff, 0xff, 0xff, 0x0f,
+    0x1f, 0x40, 0xa0, 0x01, 0xc1, 0x0f, 0x10, 0x44, 0x11, 0xf0, 0x48, 0x83, 0xe9, 0x10, 0x49, 0x83,
+    0xe8, 0x76, 0x01, 0x10, 0x18, 0xf6, 0x1d, 0x03, 0x79, 0x01, 0x60, 0x41, 0x0f, 0x11, 0x03, 0x0f,
+    0x28, 0x2b, 0x09, 0x34, 0x4c, 0x2b, 0xc0, 0x76, 0x01, 0x11, 0x39, 0x69, 0x01, 0x10, 0x04, 0x40,
+    0x00, 0x50, 0x0f, 0x10, 0x4c, 0x11, 0xf0, 0x81, 0x00, 0x10, 0xe0, 0x81, 0x00, 0x10, 0xd0, 0x81,
+    0x00, 0x73, 0xc0, 0x0f, 0x29, 0x01, 0x48, 0x83, 0xe9, 0x40, 0x01, 0x9f, 0x30, 0x0f, 0x29, 0x51,
+    0x20, 0x0f, 0x29, 0x59, 0x10, 0x40, 0x01, 0x05, 0x16, 0x01, 0x80, 0x00, 0x05, 0x40, 0x01, 0x77,
+    0x0f, 0x4c, 0x8b, 0xd9, 0x4d, 0x2b, 0xd8, 0x41, 0x01, 0x1f, 0x01, 0xc4, 0x02, 0x04, 0xfb, 0x02,
+    0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x50, 0x36, 0xf7, 0x1b, 0x68, 0x68, 0x3a, 0x3a, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x3a,
+    0x3a, 0x67, 0x65, 0x74, 0x5f, 0x70, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61, 0x6c, 0x5f, 0x61, 0x64,
+    0x64, 0x72, 0x65, 0x73, 0x73, 0x5f, 0x66, 0x6f, 0x72, 0x5f, 0x76, 0x69, 0x72, 0x74, 0x75, 0x14,
+    0x00, 0xfb, 0x0c, 0x62, 0x79, 0x5f, 0x63, 0x72, 0x33, 0x3a, 0x20, 0x50, 0x4d, 0x4c, 0x34, 0x20,
+    0x69, 0x73, 0x6e, 0x27, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x2e, 0x5f, 0x00,
+    0x0f, 0x60, 0x00, 0x2e, 0x1f, 0x33, 0x60, 0x00, 0x4c, 0x1f, 0x32, 0x60, 0x00, 0x4c, 0x1f, 0x31,
+    0x60, 0x00, 0x0c, 0xf8, 0x05, 0x62, 0x61, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6e,
+    0x65, 0x77, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x24, 0x00, 0x12, 0x43, 0xe5, 0x6c, 0xf3,
+    0x1a, 0x70, 0x65, 0x72, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x65, 0x70, 0x74, 0x20, 0x68, 0x6f, 0x6f,
+    0x6b, 0x20, 0x61, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x62, 0x6f,
+    0x75, 0x6e, 0x64, 0x61, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x00, 0x30, 0x00, 0x53, 0x66, 0x69, 0x6e,
+    0x64, 0x20, 0x8f, 0x00, 0xeb, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x73, 0x64, 0x74, 0x20, 0x74, 0x61,
+    0x62, 0x6c, 0x65, 0x82, 0x00, 0x50, 0x53, 0x53, 0x44, 0x54, 0x20, 0x23, 0x6b, 0xa9, 0x20, 0x63,
+    0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x65, 0x64, 0x22, 0x00, 0xf1, 0x02, 0x47, 0x6f, 0x74, 0x20,
+    0x6e, 0x75, 0x6c, 0x6c, 0x70, 0x74, 0x72, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x31, 0x00, 0x51,
+    0x65, 0x6e, 0x74, 0x72, 0x79, 0x28, 0x00, 0xf3, 0x10, 0x79, 0x00, 0x6f, 0x00, 0x75, 0x00, 0x5f,
+    0x00, 0x63, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x65,
+    0x00, 0x6e, 0x00, 0x5f, 0x00, 0x6d, 0x00, 0x65, 0x8e, 0x34, 0x06, 0x01, 0x00, 0x92, 0x46, 0x61,
+    0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0xa3, 0x00, 0xf0, 0x01, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0xa2, 0x02, 0x54, 0x73, 0x20,
+    0x73, 0x69, 0x7a, 0xa8, 0x00, 0x20, 0x49, 0x6e, 0x98, 0x00, 0x32, 0x65, 0x63, 0x74, 0xeb, 0x00,
+    0x01, 0xfc, 0x00, 0x44, 0x6d, 0x61, 0x73, 0x6b, 0xa5, 0x00, 0x06, 0x50, 0x00, 0x62, 0x63, 0x68,
+    0x61, 0x6e, 0x67, 0x65, 0x27, 0x00, 0xf1, 0x16, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x73, 0x2e,
+    0x00, 0xcc, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x74, 0x6f, 0x6f, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x00,
+    0xcc, 0xcc, 0x4d, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x74, 0x00, 0x65, 0x00, 0x73, 0xae, 0x00, 0xd1,
+    0x72, 0x00, 0x65, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x5c, 0x00, 0x77, 0x00, 0x69, 0xb6, 0x00, 0xbf,
+    0x64, 0x00, 0x72, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x16, 0x00, 0x06, 0xa0, 0x74,
+    0x00, 0x6c, 0x00, 0x73, 0x00, 0x66, 0x00, 0x2e, 0x00, 0xd5, 0x6d, 0x08, 0xe0, 0x00, 0xf1, 0x08,
+    0x21, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x5f, 0x00, 0x69, 0x00,
+    0x73, 0x00, 0x5f, 0x00, 0x6c, 0x00, 0x61, 0x6e, 0x00, 0x17, 0x28, 0x1c, 0x00, 0x13, 0x29, 0x38,
+    0x00, 0xfd, 0x0a, 0x30, 0x00, 0x20, 0x00, 0x3d, 0x00, 0x3d, 0x00, 0x20, 0x00, 0x28, 0x00, 0x61,
+    0x00, 0x6c, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x26, 0x12, 0x00, 0x91, 0x2d,
+    0x00, 0x20, 0x00, 0x31, 0x00, 0x29, 0x00, 0x29, 0x1e, 0x00, 0x00, 0x20, 0x00, 0x51, 0x22, 0x00,
+    0x6d, 0x00, 0x75, 0x5a, 0x00, 0x19, 0x20, 0x2a, 0x00, 0x31, 0x74, 0x00, 0x6f, 0x12, 0x00, 0x11,
+    0x20, 0xda, 0x00, 0x11, 0x77, 0xb4, 0x00, 0x51, 0x20, 0x00, 0x6f, 0x00, 0x66, 0x1c, 0x00, 0x55,
+    0x77, 0x00, 0x6f, 0x00, 0x22, 0xb6, 0x00, 0x31, 0x73, 0x00, 0x6c, 0xaa, 0x01, 0x37, 0x61, 0x00,
+    0x70, 0x58, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x24, 0x01, 0x31, 0x72, 0x00, 0x6e, 0x5a, 0x00, 0x11,
+    0x20, 0x0c, 0x00, 0x31, 0x72, 0x00, 0x6f, 0x4a, 0x00, 0x00, 0x8a, 0x00, 0xf1, 0x02, 0x73, 0x00,
+    0x65, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x6c, 0x00, 0x65, 0x1c,
+    0x01, 0x00, 0x2a, 0x00, 0x55, 0x62, 0x00, 0x69, 0x00, 0x74, 0x52, 0x00, 0x00, 0x02, 0x01, 0x97,
+    0x20, 0x00, 0x6e, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x6c, 0x78, 0x00, 0x04, 0x01, 0x00, 0x11, 0x70,
+    0x82, 0x01, 0x17, 0x76, 0x7c, 0x00, 0x04, 0x12, 0x00, 0x31, 0x5f, 0x00, 0x66, 0x0a, 0x00, 0x71,
+    0x65, 0x00, 0x20, 0x00, 0x66, 0x00, 0x69, 0x5e, 0x00, 0x00, 0x6c, 0x00, 0x02, 0x6a, 0x02, 0x00,
+    0x54, 0x00, 0x11, 0x6f, 0xfa, 0x00, 0x11, 0x62, 0x22, 0x00, 0x0f, 0x62, 0x00, 0x05, 0x51, 0x6e,
+    0x00, 0x65, 0x00, 0x78, 0x28, 0x00, 0x04, 0x60, 0x00, 0x04, 0x12, 0x00, 0x0f, 0x60, 0x00, 0x33,
+    0x31, 0x63, 0x00, 0x75, 0x1a, 0x01, 0x00, 0xf2, 0x02, 0x08, 0x66, 0x00, 0x06, 0x5c, 0x00, 0x00,
+    0x98, 0x01, 0x02, 0xa4, 0x01, 0x02, 0x5a, 0x00, 0x04, 0x58, 0x00, 0x31, 0x68, 0x00, 0x61, 0x34,
+    0x01, 0x02, 0xaa, 0x01, 0x04, 0x60, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x4a, 0x00, 0x31, 0x72, 0x00,
+    0x79, 0x6c, 0x00, 0x08, 0x4e, 0x02, 0x00, 0xd8, 0x01, 0x31, 0x5f, 0x00, 0x70, 0x1e, 0x00, 0x0a,
+    0x4c, 0x02, 0x04, 0x44, 0x02, 0x06, 0x06, 0x02, 0x0f, 0x28, 0x00, 0x01, 0x0f, 0x42, 0x00, 0x09,
+    0xf9, 0x08, 0x2c, 0x00, 0x20, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x49, 0x00, 0x47, 0x00, 0x4e, 0x00,
+    0x5f, 0x00, 0x53, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x45, 0x6e, 0x02, 0x06, 0x30, 0x00, 0x06, 0x1e,
+    0x01, 0x06, 0x72, 0x00, 0x11, 0x65, 0x3e, 0x01, 0x00, 0xbe, 0x01, 0x02, 0x02, 0x04, 0x33, 0x72,
+    0x00, 0x6c, 0xc4, 0x00, 0x08, 0x30, 0x01, 0x0f, 0x8e, 0x00, 0x07, 0x00, 0x30, 0x01, 0x00, 0x36,
+    0x02, 0x00, 0x7c, 0x02, 0x00, 0x04, 0x00, 0x1f, 0x67, 0xd8, 0x00, 0x26, 0x0f, 0x4a, 0x00, 0x01,
+    0x0f, 0xe0, 0x00, 0x11, 0x0e, 0x38, 0x00, 0x00, 0xfe, 0x01, 0x0f, 0xf4, 0x00, 0x2b, 0x08, 0xa6,
+    0x00, 0x7f, 0x73, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0xbc, 0x01, 0x04, 0x08, 0x7e, 0x00, 0x06,
+    0x2c, 0x00, 0x31, 0x20, 0x00, 0x2b, 0x6e, 0x03, 0x08, 0x0e, 0x00, 0x08, 0x54, 0x00, 0x71, 0x68,
+    0x00, 0x65, 0x00, 0x61, 0x00, 0x64, 0x7c, 0x00, 0x00, 0x7c, 0x05, 0x02, 0xa2, 0x04, 0x04, 0x16,
+    0x00, 0x0a, 0x40, 0x02, 0x06, 0x80, 0x00, 0x0f, 0x6c, 0x01, 0x03, 0x11, 0x3e, 0x88, 0x00, 0x0f,
+    0x32, 0x00, 0x01, 0x00, 0x22, 0x04, 0x00, 0x28, 0x00, 0x0f, 0x0c, 0x02, 0x03, 0x31, 0x73, 0x00,
+    0x70, 0x12, 0x01, 0x00, 0x1c, 0x01, 0x00, 0x30, 0x05, 0x31, 0x74, 0x00, 0x68, 0xfa, 0x03, 0x33,
+    0x6e, 0x00, 0x76, 0x2c, 0x01, 0x00, 0x26, 0x01, 0x04, 0x4c, 0x00, 0x0a, 0x12, 0x02, 0x0f, 0x30,
+    0x05, 0x0b, 0x04, 0x0c, 0x04, 0x08, 0xa6, 0x01, 0x04, 0x14, 0x00, 0x11, 0x69, 0x7a, 0x06, 0x00,
+    0x5e, 0x04, 0x08, 0x8c, 0x00, 0x02, 0x64, 0x03, 0x17, 0x27, 0xba, 0x03, 0x04, 0x4e, 0x00, 0x02,
+    0x78, 0x00, 0x0f, 0x70, 0x04, 0x07, 0x00, 0xc8, 0x01, 0x31, 0x68, 0x00, 0x79, 0xa8, 0x00, 0x00,
+    0x46, 0x00, 0x02, 0xcc, 0x04, 0x0f, 0x5a, 0x00, 0x09, 0x0f, 0x14, 0x04, 0x01, 0x0e, 0xce, 0x00,
+    0x04, 0x0a, 0x04, 0x0f, 0xce, 0x00, 0x0b, 0x0a, 0x6c, 0x00, 0x04, 0x36, 0x05, 0x02, 0x70, 0x02,
+    0x06, 0x4c, 0x04, 0x00, 0x5a, 0x01, 0x00, 0xf6, 0x00, 0x11, 0x67, 0x62, 0x01, 0x00, 0xc2, 0x01,
+    0x33, 0x72, 0x00, 0x6b, 0x86, 0x02, 0x00, 0xe6, 0x00, 0x00, 0x66, 0x01, 0x55, 0x75, 0x00, 0x63,
+    0x00, 0x68, 0x94, 0x00, 0x0f, 0x00, 0x05, 0x07, 0x0f, 0xf0, 0x00, 0x33, 0x0f, 0xf0, 0x06, 0x17,
+    0x0f, 0xc2, 0x01, 0x33, 0x0f, 0x60, 0x01, 0x09, 0x0f, 0x6e, 0x00, 0x03, 0x08, 0x5c, 0x00, 0x06,
+    0x30, 0x07, 0x02, 0x5a, 0x00, 0x04, 0x3c, 0x00, 0x06, 0xd2, 0x00, 0x0f, 0xb0, 0x03, 0x11, 0x02,
+    0x28, 0x03, 0x04, 0x1e, 0x00, 0x0a, 0xe0, 0x04, 0x06, 0xaa, 0x03, 0x04, 0x80, 0x00, 0x06, 0x12,
+    0x00, 0x0c, 0x7e, 0x00, 0x00, 0xe0, 0x01, 0x31, 0x6e, 0x00, 0x2d, 0x1e, 0x00, 0x00, 0x42, 0x04,
+    0x00, 0x86, 0x00, 0x13, 0x67, 0x38, 0x07, 0x02, 0x64, 0x00, 0x02, 0x0e, 0x00, 0x04, 0x7e, 0x03,
+    0x11, 0x69, 0x42, 0x00, 0x17, 0x6d, 0x5c, 0x00, 0x04, 0x2e, 0x00, 0x06, 0x64, 0x00, 0x00, 0x0a,
+    0x05, 0x00, 0xfe, 0x07, 0x11, 0x73, 0x1e, 0x02, 0x0e, 0xb2, 0x06, 0x0f, 0xb0, 0x01, 0x01, 0x0f,
+    0x42, 0x01, 0x19, 0x00, 0x54, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x5e, 0x04, 0x1f, 0x79, 0x84, 0x02,
+    0x04, 0x08, 0x56, 0x01, 0x30, 0x48, 0x8d, 0x8a, 0xdb, 0x13, 0x30, 0xe9, 0x70, 0xb9, 0x77, 0x16,
+    0x00, 0x47, 0x36, 0x00, 0xaa, 0x2a, 0x00, 0x32, 0x18, 0x04, 0x0a, 0x78, 0x00, 0x0b, 0x12, 0x10,
+    0x60, 0x4e, 0x55, 0x03, 0x2a, 0x00, 0x10, 0xbe, 0x3b, 0x21, 0x03, 0x0c, 0x00, 0x10, 0xce, 0x0c,
+    0x00, 0x00, 0x36, 0x00, 0x10, 0x53, 0x37, 0x00, 0x60, 0x28, 0x48, 0x8b, 0xea, 0x8b, 0x85, 0x38,
+    0x00, 0x31, 0x48, 0x8b, 0x8d, 0xab, 0x23, 0x51, 0x3b, 0x41, 0x08, 0x74, 0x34, 0x52, 0x23, 0xf2,
+    0x01, 0x58, 0x08, 0x48, 0x8b, 0x13, 0x48, 0xff, 0x49, 0x08, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x89,
+    0x10, 0x07, 0x00, 0x20, 0x42, 0x08, 0xbc, 0x2d, 0x51, 0xe8, 0x57, 0xd2, 0xff, 0xff, 0x88, 0x22,
+    0x00, 0x0b, 0x14, 0x20, 0x02, 0xbc, 0x3c, 0x1f, 0x08, 0x7e, 0x00, 0x36, 0x28, 0x5d, 0x5b, 0x7f,
+    0x00, 0x11, 0x73, 0xba, 0x21, 0x10, 0x8a, 0x2e, 0x00, 0x20, 0xe9, 0xd7, 0x64, 0x40, 0x04, 0xb5,
+    0x00, 0x1c, 0x20, 0xb5, 0x00, 0x44, 0x20, 0x5d, 0xc3, 0xcc, 0x0f, 0x00, 0x0f, 0x01, 0x00, 0xff,
+    0x07, 0x10, 0x58, 0x4c, 0x77, 0x43, 0x00, 0x00, 0x00, 0x72, 0x08, 0x00, 0x13, 0x8a, 0x08, 0x00,
+    0x13, 0x9e, 0x08, 0x00, 0x13, 0xac, 0x08, 0x00, 0x04, 0x01, 0x00, 0x22, 0x40, 0x71, 0x57, 0x78,
+    0x22, 0x90, 0x72, 0x08, 0x00, 0x04, 0x10, 0x00, 0x13, 0xb0, 0x10, 0x00, 0x04, 0x08, 0x00, 0x0f,
+    0x01, 0x00, 0x35, 0x00, 0x78, 0x79, 0xf0, 0x0f, 0xa0, 0x3d, 0x00, 0x00, 0xd0, 0x3d, 0x00, 0x00,
+    0xc0, 0x3f, 0x00, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0x50, 0x41, 0x00, 0x00, 0x60, 0x42, 0x00, 0x00,
+    0x20, 0x4a, 0x00, 0x00, 0x50, 0x4a, 0xc5, 0x00, 0xf1, 0x29, 0x00, 0x00, 0x30, 0x58, 0x00, 0x00,
+    0x60, 0x58, 0x00, 0x00, 0x40, 0x5d, 0x00, 0x00, 0x50, 0x62, 0x00, 0x00, 0x70, 0x62, 0x00, 0x00,
+    0xc0, 0x62, 0x00, 0x00, 0x10, 0x63, 0x00, 0x00, 0x30, 0x63, 0x00, 0x00, 0x40, 0x63, 0x00, 0x00,
+    0x70, 0x63, 0x00, 0x00, 0xc0, 0x63, 0x00, 0x00, 0x20, 0x64, 0x00, 0x00, 0x10, 0x65, 0x00, 0x00,
+    0xe0, 0x70, 0xc0, 0x00, 0x70, 0x00, 0x50, 0x71, 0x00, 0x00, 0x60, 0x71, 0x6f, 0x33, 0x31, 0x00,
+    0x00, 0x80, 0x39, 0x78, 0x06, 0x01, 0x00, 0x22, 0xa0, 0x3d, 0xd0, 0x00, 0x22, 0xc0, 0x3f, 0x08,
+    0x00, 0x13, 0xd0, 0x10, 0x00, 0x0c, 0x18, 0x00, 0x22, 0x50, 0x41, 0x08, 0x00, 0x00, 0xc9, 0x48,
+    0x30, 0xff, 0x01, 0x02, 0xb2, 0x59, 0xd3, 0xff, 0x04, 0x05, 0x06, 0x07, 0x01, 0x02, 0x01, 0x03,
+    0x01, 0x02, 0x01, 0x04, 0x08, 0x00, 0x93, 0x05, 0x19, 0x12, 0x19, 0x0b, 0x19, 0x12, 0x19, 0x04,
+    0x08, 0x00, 0x32, 0x00, 0xa0, 0x91, 0x38, 0x00, 0x02, 0xbc, 0x4b, 0x33, 0x00, 0x00, 0xb0, 0x10,
+    0x00, 0x13, 0x0e, 0x10, 0x00, 0x20, 0x4c, 0x8d, 0x51, 0x67, 0x33, 0x00, 0xf7, 0x43, 0x10, 0x00,
+    0x72, 0x78, 0x78, 0x78, 0x3f, 0x3f, 0x3f, 0x3f, 0x06, 0x00, 0x16, 0x3f, 0x90, 0x00, 0x23, 0x30,
+    0x58, 0x78, 0x01, 0x03, 0x08, 0x00, 0x14, 0x60, 0x08, 0x00, 0x1f, 0x42, 0x08, 0x00, 0x03, 0x23,
+    0x50, 0x62, 0xc0, 0x00, 0x03, 0x08, 0x00, 0x23, 0x70, 0x63, 0x10, 0x00, 0x03, 0x08, 0x00, 0x23,
+    0x20, 0x64, 0x18, 0x00, 0x03, 0x20, 0x00, 0x13, 0x30, 0x18, 0x00, 0x13, 0x10, 0x08, 0x00, 0x04,
+    0x40, 0x00, 0x13, 0x40, 0x10, 0x00, 0x2f, 0xe0, 0x70, 0xf8, 0x01, 0x0b, 0x00, 0xc1, 0x16, 0x04,
+    0x68, 0x7c, 0x00, 0x28, 0x00, 0x04, 0x10, 0x00, 0x70, 0x40, 0x04, 0x10, 0x00, 0x10, 0x10, 0x20,
+    0x22, 0x7a, 0x50, 0x00, 0x01, 0x01, 0x02, 0x02, 0x90, 0x50, 0x30, 0x04, 0x04, 0x08, 0xd4, 0x18,
+    0x00, 0xcf, 0x15, 0x01, 0x2c, 0x00, 0x70, 0x10, 0x20, 0x40, 0x00, 0x08, 0x20, 0x40, 0x94, 0x6d,
+    0x11, 0x01, 0x39, 0x00, 0x00, 0x68, 0x01, 0x10, 0x08, 0x01, 0x00, 0x10, 0x06, 0x05, 0x00, 0xc1,
+    0x04, 0xff, 0x10, 0x08, 0x08, 0x20, 0x08, 0x06, 0x08, 0x10, 0x08, 0x08, 0xad, 0x02, 0x08, 0x60,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x6d, 0x3f, 0x00, 0x57, 0x7a, 0x00, 0x6a, 0x17, 0x00, 0x59, 0x00,
+    0x13, 0x09, 0xb0, 0x7b, 0x10, 0x0b, 0x6b, 0x7a, 0x07, 0xa4, 0x00, 0x0f, 0x38, 0x00, 0x01, 0x00,
+    0x34, 0x00, 0x00, 0x01, 0x00, 0x71, 0x10, 0x20, 0x20, 0x10, 0x40, 0x20, 0x00, 0xac, 0x00, 0x62,
+    0x40, 0x40, 0x00, 0x00, 0x20, 0x20, 0x08, 0x00, 0x05, 0x01, 0x00, 0x04, 0x27, 0x03, 0x00, 0x61,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x59, 0x00, 0x10, 0x01, 0xc7, 0x00, 0x03, 0x5c, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0xc4, 0x00, 0x49, 0x01, 0x02, 0x04, 0x08, 0xf5, 0x7b, 0x0f, 0x01, 0x00, 0x0b, 0x08,
+    0x90, 0x00, 0x0f, 0x48, 0x01, 0x05, 0xc2, 0x04, 0x08, 0x10, 0x02, 0x02, 0x02, 0x00, 0x00, 0x40,
+    0x08, 0x20, 0x08, 0xa6, 0x6e, 0x01, 0x14, 0x00, 0x23, 0x00, 0x40, 0x90, 0x00, 0xb1, 0x08, 0x10,
+    0x20, 0x08, 0x10, 0x20, 0x02, 0x02, 0x02, 0x04, 0x04, 0xaa, 0x00, 0x32, 0x10, 0x20, 0x40, 0x03,
+    0x00, 0x02, 0x13, 0x00, 0x11, 0x08, 0x72, 0x01, 0x02, 0x90, 0x01, 0x13, 0x20, 0x90, 0x01, 0x13,
+    0x02, 0x90, 0x01, 0x10, 0x08, 0x1f, 0x00, 0x22, 0x02, 0x04, 0x21, 0x00, 0x04, 0x68, 0x17, 0x04,
+    0xd0, 0x00, 0x05, 0x10, 0x00, 0x0c, 0x18, 0x00, 0x0f, 0x08, 0x00, 0x05, 0x0f, 0x01, 0x00, 0x01,
+    0x02, 0x16, 0x00, 0x03, 0x28, 0x00, 0x03, 0x08, 0x00, 0x04, 0x10, 0x00, 0x04, 0x1e, 0x00, 0x0f,
+    0x20, 0x00, 0x05, 0x04, 0x53, 0x00, 0x07, 0x68, 0x00, 0x0b, 0x10, 0x00, 0x0f, 0x20, 0x00, 0x0a,
+    0x00, 0xd8, 0x01, 0x45, 0x20, 0x10, 0x40, 0x40, 0x08, 0x00, 0x12, 0x10, 0xda, 0x01, 0x02, 0x10,
+    0x00, 0x00, 0x05, 0x00, 0x33, 0x20, 0x10, 0x40, 0x20, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x1e,
+    0x00, 0x00, 0x20, 0x00, 0x02, 0x06, 0x00, 0x42, 0x40, 0x40, 0x08, 0x10, 0x6c, 0x01, 0x05, 0x01,
+    0x00, 0x04, 0xd8, 0x01, 0x04, 0x17, 0x00, 0x0f, 0x75, 0x7d, 0x00, 0x08, 0xb8, 0x01, 0xb0, 0x00,
+    0x1f, 0x07, 0x07, 0x1f, 0x1f, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0xeb, 0x55, 0x70, 0x00, 0x00, 0x0f,
+    0x07, 0x07, 0x1f, 0x0f, 0x10, 0x00, 0x20, 0x07, 0x0f, 0xb5, 0x01, 0x11, 0x40, 0x66, 0x15, 0x07,
+    0x01, 0x00, 0x04, 0x74, 0x02, 0x04, 0x18, 0x00, 0x00, 0x32, 0x2a, 0x02, 0x17, 0x00, 0x09, 0xb8,
+    0x01, 0x04, 0x2f, 0x00, 0xf0, 0x07, 0x31, 0x03, 0x44, 0x70, 0x08, 0x00, 0x00, 0x12, 0x24, 0x0d,
+    0x4c, 0x04, 0x01, 0x10, 0x04, 0x18, 0xa3, 0x00, 0x32, 0x03, 0x44, 0x74, 0x12, 0x00, 0x30, 0x25,
+    0x0d, 0x54, 0x12, 0x00, 0x4d, 0x19, 0xa3, 0x00, 0x33, 0x24, 0x00, 0x1d, 0x34, 0x24, 0x00, 0x50,
+    0x37, 0x03, 0x44, 0xc8, 0x04, 0x2f, 0x01, 0x80, 0x0d, 0x4c, 0x04, 0x04, 0x00, 0x04, 0x03, 0xb0,
+    0x12, 0x00, 0x62, 0xac, 0x02, 0x00, 0x00, 0x10, 0x1d, 0x12, 0x00, 0x20, 0x00, 0xa0, 0x12, 0x00,
+    0x10, 0xcd, 0x24, 0x00, 0x18, 0x1f, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x10, 0xd2,
+    0x12, 0x00, 0x00, 0x36, 0x00, 0x50, 0x01, 0x10, 0x04, 0x04, 0xac, 0x12, 0x00, 0x14, 0xd7, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x14, 0xdc, 0x36, 0x00, 0x02, 0x12, 0x00, 0x95, 0x38, 0x03, 0x44, 0x78,
+    0x08, 0x00, 0x00, 0x4e, 0x30, 0x7e, 0x00, 0x95, 0x38, 0x03, 0x44, 0xb6, 0x02, 0x00, 0x00, 0x4e,
+    0x2d, 0x5a, 0x00, 0x40, 0x38, 0x03, 0x44, 0x7c, 0x24, 0x00, 0x18, 0x2f, 0x12, 0x00, 0x08, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x10, 0x80, 0x12, 0x00, 0x00, 0x36, 0x00, 0x00, 0x5a, 0x00, 0x10, 0xaa,
+    0x12, 0x00, 0x14, 0x84, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x88, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x4a, 0x39, 0x03, 0x44, 0xe1, 0xfc, 0x00, 0x30, 0x39, 0x03, 0x44, 0x23, 0x50, 0x07, 0xfc, 0x00,
+    0x4a, 0x39, 0x03, 0x44, 0xe6, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x18, 0xeb, 0xfc,
+    0x00, 0x10, 0xab, 0x12, 0x00, 0x18, 0xf0, 0xfc, 0x00, 0x01, 0x12, 0x00, 0x18, 0xf5, 0xfc, 0x00,
+    0x33, 0xab, 0x00, 0x3a, 0x68, 0x01, 0x30, 0x22, 0x0d, 0x54, 0x48, 0x00, 0x2d, 0x01, 0xa0, 0x12,
+    0x00, 0x10, 0xb0, 0x12, 0x00, 0x14, 0xb1, 0x12, 0x00, 0x73, 0x01, 0x10, 0x04, 0x11, 0xa4, 0x00,
+    0x3c, 0x20, 0x01, 0x15, 0x31, 0x36, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x00, 0x10,
+    0x25, 0x01, 0x12, 0x00, 0x00, 0x36, 0x00, 0x33, 0xa2, 0x00, 0x3d, 0xd8, 0x00, 0x06, 0x6c, 0x00,
+    0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x18, 0xc5, 0x6c, 0x00, 0xd1, 0xa3, 0x00, 0x40, 0x03,
+    0x33, 0x30, 0x12, 0x00, 0x00, 0xc6, 0x38, 0x0d, 0x5c, 0xea, 0x00, 0x10, 0x60, 0x12, 0x00, 0x68,
+    0x3c, 0x08, 0x00, 0x00, 0xc6, 0x39, 0x12, 0x00, 0x68, 0xad, 0x13, 0x00, 0x00, 0xc6, 0x3a, 0x12,
+    0x00, 0x14, 0x36, 0x36, 0x00, 0x50, 0x01, 0x10, 0x04, 0x0c, 0x65, 0x12, 0x00, 0x00, 0xaf, 0x04,
+    0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xb0, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0x41, 0x6c,
+    0x00, 0x1d, 0x41, 0x6c, 0x00, 0x1d, 0x41, 0x6c, 0x00, 0x1d, 0x41, 0x6c, 0x00, 0x1d, 0x41, 0x6c,
+    0x00, 0x1d, 0x41, 0x6c, 0x00, 0x1d, 0x42, 0x6c, 0x00, 0x1d, 0x42, 0x6c, 0x00, 0x1d, 0x42, 0x6c,
+    0x00, 0x1d, 0x42, 0x6c, 0x00, 0x1d, 0x42, 0x6c, 0x00, 0x1d, 0x42, 0x6c, 0x00, 0x1d, 0x43, 0x6c,
+    0x00, 0x1d, 0x43, 0x6c, 0x00, 0x1d, 0x43, 0x6c, 0x00, 0x1d, 0x43, 0x6c, 0x00, 0x1d, 0x43, 0x6c,
+    0x00, 0x1d, 0x43, 0x6c, 0x00, 0x51, 0x46, 0x03, 0x55, 0xa3, 0x01, 0x88, 0x02, 0x13, 0x60, 0x9a,
+    0x02, 0x40, 0x46, 0x03, 0x55, 0xa8, 0x12, 0x00, 0x18, 0x1f, 0x12, 0x00, 0x10, 0xad, 0x12, 0x00,
+    0x18, 0x20, 0x12, 0x00, 0x14, 0xb2, 0x36, 0x00, 0x02, 0x9a, 0x02, 0x44, 0x46, 0x03, 0x55, 0xb7,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xbc, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x47, 0x03, 0x55,
+    0xc1, 0x6c, 0x00, 0x4a, 0x47, 0x03, 0x55, 0xc6, 0x6c, 0x00, 0x4a, 0x47, 0x03, 0x55, 0xcb, 0x6c,
+    0x00, 0x48, 0x47, 0x03, 0x55, 0xd0, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x18, 0xd5, 0x6c, 0x00,
+    0x01, 0x12, 0x00, 0x18, 0xda, 0x6c, 0x00, 0x32, 0xac, 0x00, 0x48, 0x18, 0x03, 0x23, 0x6e, 0x15,
+    0x20, 0x01, 0x10, 0xa0, 0x12, 0x00, 0x00, 0x92, 0x04, 0x28, 0x6e, 0x17, 0x12, 0x00, 0x00, 0x92,
+    0x04, 0x28, 0x6e, 0x18, 0x12, 0x00, 0x00, 0x92, 0x04, 0x01, 0x36, 0x00, 0x05, 0x48, 0x00, 0x00,
+    0x92, 0x04, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x92, 0x04, 0x01, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x12, 0x49, 0x18, 0x03, 0x07, 0x6c, 0x00, 0x12, 0x49, 0x02, 0x04, 0x07, 0x6c, 0x00, 0x12,
+    0x49, 0x02, 0x04, 0x07, 0x6c, 0x00, 0x12, 0x49, 0x02, 0x04, 0x05, 0x6c, 0x00, 0x10, 0xab, 0x12,
+    0x00, 0x00, 0x02, 0x04, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0x02, 0x04, 0x05, 0x6c, 0x00,
+    0x3d, 0xab, 0x00, 0x4a, 0xd8, 0x00, 0x1d, 0x4a, 0xd8, 0x00, 0x1d, 0x4a, 0xd8, 0x00, 0x1d, 0x4a,
+    0xd8, 0x00, 0x1d, 0x4a, 0xd8, 0x00, 0x1d, 0x4a, 0xd8, 0x00, 0x1d, 0x4b, 0xd8, 0x00, 0x1d, 0x4b,
+    0xd8, 0x00, 0x1d, 0x4b, 0xd8, 0x00, 0x1d, 0x4b, 0xd8, 0x00, 0x1d, 0x4b, 0xd8, 0x00, 0x1d, 0x4b,
+    0xd8, 0x00, 0x12, 0x4e, 0xd8, 0x00, 0x24, 0x22, 0x1d, 0x48, 0x00, 0x22, 0x02, 0x4e, 0xd8, 0x00,
+    0x28, 0x22, 0x1f, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x28, 0x22, 0x20, 0x12, 0x00, 0x00, 0xd8, 0x00,
+    0x01, 0x36, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x01, 0x36, 0x00, 0x05,
+    0x12, 0x00, 0x00, 0xd8, 0x00, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x12, 0x4f, 0xd8, 0x00, 0x07,
+    0x6c, 0x00, 0x12, 0x4f, 0xd8, 0x00, 0x07, 0x6c, 0x00, 0x12, 0x4f, 0xd8, 0x00, 0x07, 0x6c, 0x00,
+    0x12, 0x4f, 0xd8, 0x00, 0x05, 0x6c, 0x00, 0x10, 0xab, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x05, 0x6c,
+    0x00, 0x01, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x05, 0x6c, 0x00, 0xd1, 0xab, 0x02, 0x55, 0x03, 0x33,
+    0xb3, 0x13, 0x00, 0x00, 0x28, 0x17, 0x0d, 0x6c, 0x6d, 0x09, 0x60, 0xa0, 0x20, 0x55, 0x03, 0x33,
+    0xb6, 0x12, 0x00, 0x14, 0x18, 0x12, 0x00, 0x54, 0x24, 0x55, 0x03, 0x33, 0xb9, 0x24, 0x00, 0x50,
+    0x01, 0x10, 0x00, 0x20, 0xa3, 0x24, 0x00, 0x14, 0xbc, 0x24, 0x00, 0x01, 0x12, 0x00, 0x50, 0x24,
+    0x56, 0x03, 0x33, 0xbf, 0x12, 0x00, 0x12, 0x1f, 0x12, 0x00, 0x70, 0x24, 0xa3, 0x28, 0x56, 0x03,
+    0x33, 0xc2, 0x12, 0x00, 0x14, 0x20, 0x12, 0x00, 0x57, 0x2c, 0x57, 0x03, 0x33, 0xc5, 0x36, 0x00,
+    0x78, 0x28, 0xa3, 0x30, 0x58, 0x03, 0x33, 0xc8, 0x5a, 0x00, 0x68, 0xa4, 0x1c, 0x58, 0x03, 0x33,
+    0xcb, 0x5a, 0x00, 0x68, 0xa4, 0x20, 0x59, 0x03, 0x33, 0xce, 0x48, 0x00, 0xb4, 0xa4, 0x28, 0x5b,
+    0x03, 0x33, 0xe4, 0x0b, 0x00, 0x00, 0x28, 0x15, 0xa2, 0x00, 0x5a, 0x1c, 0x5b, 0x03, 0x33, 0xd1,
+    0xc6, 0x00, 0x4a, 0x5b, 0x03, 0x33, 0xd4, 0xc6, 0x00, 0x40, 0x5b, 0x03, 0x33, 0xd7, 0x12, 0x00,
+    0x00, 0x36, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x36, 0x00, 0x1a, 0xda, 0xd8, 0x00, 0x4a, 0x5b, 0x03,
+    0x33, 0xdd, 0xd8, 0x00, 0x4a, 0x5c, 0x03, 0x33, 0xe0, 0xd8, 0x00, 0x4a, 0x5c, 0x03, 0x33, 0xe3,
+    0xd8, 0x00, 0x4a, 0x5d, 0x03, 0x33, 0xe6, 0xd8, 0x00, 0x4a, 0x5e, 0x03, 0x33, 0xe9, 0xd8, 0x00,
+    0x4a, 0x5e, 0x03, 0x33, 0xec, 0xd8, 0x00, 0x4a, 0x5f, 0x03, 0x33, 0xef, 0xd8, 0x00, 0x44, 0x60,
+    0x03, 0x33, 0xf2, 0x6c, 0x00, 0x01, 0xb4, 0x00, 0x54, 0x08, 0x60, 0x03, 0x33, 0xf5, 0x24, 0x00,
+    0x01, 0x12, 0x00, 0x57, 0x0c, 0x60, 0x03, 0x33, 0xf8, 0x90, 0x00, 0x20, 0x14, 0xa4, 0x24, 0x00,
+    0x17, 0xfb, 0x48, 0x00, 0xc5, 0x14, 0xa4, 0x0c, 0x61, 0x03, 0x33, 0x28, 0x0a, 0x00, 0x00, 0x28,
+    0x1d, 0x48, 0x00, 0x13, 0x61, 0xe6, 0x01, 0x05, 0x5a, 0x00, 0x00, 0x24, 0x00, 0x01, 0xe6, 0x01,
+    0x05, 0x5a, 0x00, 0x50, 0x10, 0x61, 0x03, 0x33, 0xfe, 0x12, 0x00, 0x00, 0x36, 0x00, 0x00, 0x48,
+    0x00, 0x10, 0xa3, 0x36, 0x00, 0x27, 0x01, 0x14, 0x6c, 0x00, 0x10, 0xa3, 0x36, 0x00, 0x10, 0x04,
+    0x12, 0x00, 0x04, 0x6c, 0x00, 0x62, 0xa3, 0x10, 0x62, 0x03, 0x55, 0xdf, 0xda, 0x04, 0x20, 0x4c,
+    0x0a, 0x70, 0x08, 0x62, 0x38, 0x01, 0x62, 0x03, 0x55, 0xe4, 0x10, 0x05, 0x01, 0x12, 0x00, 0x20,
+    0x00, 0x20, 0x12, 0x00, 0x12, 0xe9, 0x10, 0x05, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x14, 0xee, 0x36, 0x00, 0x00, 0x9a, 0x02, 0x10, 0x2c, 0x12, 0x00, 0x14, 0xf3, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x14, 0xf8, 0x36, 0x00, 0x02, 0x12, 0x00, 0x52, 0x63, 0x03, 0x55, 0xfd, 0x01,
+    0x00, 0x09, 0x02, 0x7e, 0x00, 0x40, 0x00, 0x63, 0x03, 0x55, 0x51, 0x0a, 0x00, 0x36, 0x09, 0x02,
+    0x5a, 0x00, 0x00, 0x12, 0x00, 0x10, 0x07, 0x12, 0x00, 0x18, 0x2f, 0x12, 0x00, 0x08, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x00, 0x6a, 0x6e, 0x01, 0x36, 0x00, 0x00, 0x5a, 0x00, 0x10, 0x2a, 0x12, 0x00,
+    0x14, 0x11, 0x36, 0x00, 0x05, 0x12, 0x00, 0x10, 0x16, 0x12, 0x00, 0x00, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x40, 0x64, 0x03, 0x55, 0x1b, 0x5e, 0x08, 0x06, 0xfc, 0x00, 0x30, 0x64, 0x03, 0x55, 0x92,
+    0x52, 0x07, 0xfc, 0x00, 0x40, 0x64, 0x03, 0x55, 0x25, 0x12, 0x00, 0x06, 0xfc, 0x00, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x00, 0x99, 0x2d, 0x05, 0xfc, 0x00, 0x10, 0x2b, 0x12, 0x00, 0x14, 0x2f,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x34, 0x36, 0x00, 0x02, 0x12, 0x00, 0x13, 0x65, 0x68, 0x01,
+    0x30, 0x22, 0x0d, 0x54, 0x48, 0x00, 0x2d, 0x01, 0x20, 0x12, 0x00, 0x10, 0x38, 0x12, 0x00, 0x00,
+    0x48, 0x2a, 0x01, 0x12, 0x00, 0x00, 0x00, 0x09, 0x33, 0x24, 0x01, 0x66, 0x20, 0x01, 0x14, 0x31,
+    0x36, 0x00, 0x1c, 0x00, 0x12, 0x00, 0x10, 0x38, 0x12, 0x00, 0x14, 0x3e, 0x12, 0x00, 0x00, 0x36,
+    0x00, 0x33, 0x22, 0x00, 0x67, 0xd8, 0x00, 0x06, 0x6c, 0x00, 0x0c, 0x12, 0x00, 0x10, 0x38, 0x12,
+    0x00, 0x00, 0xaa, 0x70, 0x05, 0x6c, 0x00, 0xd0, 0x23, 0x01, 0x68, 0x03, 0x23, 0x89, 0x13, 0x00,
+    0x33, 0x10, 0x22, 0x0d, 0x58, 0x64, 0x02, 0x3c, 0x01, 0x60, 0x00, 0x12, 0x00, 0x10, 0x78, 0x12,
+    0x00, 0x14, 0xa4, 0x12, 0x00, 0xf5, 0x00, 0x01, 0x10, 0x00, 0x11, 0x64, 0x00, 0x69, 0x03, 0x23,
+    0x07, 0x14, 0x00, 0x33, 0x4e, 0x31, 0x36, 0x00, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x14,
+    0x0a, 0x12, 0x00, 0x00, 0x36, 0x00, 0x6a, 0x62, 0x00, 0x6a, 0x03, 0x23, 0x95, 0x6c, 0x00, 0x0c,
+    0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x18, 0xaa, 0x6c, 0x00, 0xa2, 0x63, 0x00, 0x6b, 0x03, 0x33,
+    0x0d, 0x14, 0x00, 0x00, 0x38, 0x6a, 0x05, 0x30, 0x00, 0x00, 0xa0, 0x12, 0x00, 0x10, 0x10, 0x12,
+    0x00, 0x02, 0x6a, 0x05, 0x03, 0x12, 0x00, 0x10, 0x13, 0x12, 0x00, 0x02, 0x6a, 0x05, 0x03, 0x12,
+    0x00, 0x14, 0x16, 0x36, 0x00, 0x50, 0x01, 0x10, 0x00, 0x1c, 0x24, 0x12, 0x00, 0x14, 0x19, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x14, 0x1c, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x6c, 0x03, 0x33, 0x1f,
+    0x6c, 0x00, 0x4a, 0x6c, 0x03, 0x33, 0x22, 0x6c, 0x00, 0x4a, 0x6c, 0x03, 0x33, 0x25, 0x6c, 0x00,
+    0x48, 0x6c, 0x03, 0x33, 0x28, 0x6c, 0x00, 0x10, 0x23, 0x12, 0x00, 0x18, 0x2b, 0x6c, 0x00, 0x01,
+    0x12, 0x00, 0x18, 0x2e, 0x6c, 0x00, 0xd0, 0x23, 0x00, 0x6d, 0x03, 0x33, 0x31, 0x14, 0x00, 0x00,
+    0x3e, 0x20, 0x0d, 0x64, 0x48, 0x00, 0x20, 0x03, 0xa0, 0x12, 0x00, 0x10, 0x34, 0x12, 0x00, 0x12,
+    0x1d, 0x12, 0x00, 0x11, 0x00, 0x12, 0x00, 0x10, 0x37, 0x12, 0x00, 0x18, 0x1f, 0x12, 0x00, 0x08,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x3a, 0x36, 0x00, 0x50, 0x01, 0x10, 0x00, 0x08, 0xab, 0x12,
+    0x00, 0x14, 0x3d, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x40, 0x36, 0x00, 0x02, 0x12, 0x00, 0x40,
+    0x6e, 0x03, 0x33, 0x43, 0x12, 0x00, 0x02, 0xcc, 0x0c, 0x30, 0x00, 0x03, 0xb0, 0x12, 0x00, 0x10,
+    0x46, 0x12, 0x00, 0x02, 0x02, 0x0d, 0x00, 0x5a, 0x00, 0x40, 0x6e, 0x03, 0x33, 0x49, 0x12, 0x00,
+    0x02, 0x02, 0x0d, 0x03, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x4c, 0x36, 0x00,
+    0x41, 0x01, 0x10, 0x00, 0x04, 0x5a, 0x00, 0x01, 0x12, 0x00, 0x02, 0x02, 0x0d, 0x03, 0x12, 0x00,
+    0x14, 0x4f, 0x36, 0x00, 0x02, 0x12, 0x00, 0x30, 0x6f, 0x03, 0x33, 0xff, 0x2e, 0x12, 0x3e, 0xcc,
+    0x0c, 0x00, 0x7e, 0x00, 0x42, 0x6f, 0x03, 0x33, 0x55, 0xc6, 0x00, 0x04, 0x5a, 0x00, 0x42, 0x6f,
+    0x03, 0x33, 0x58, 0xc6, 0x00, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x5b,
+    0x36, 0x00, 0x05, 0x5a, 0x00, 0x14, 0x5e, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x61, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x95, 0x76, 0x03, 0x44, 0x8c, 0x08, 0x00, 0x00, 0x3e, 0x27, 0x70, 0x08, 0x40,
+    0x76, 0x03, 0x44, 0x90, 0x12, 0x00, 0x18, 0x28, 0x12, 0x00, 0x10, 0x94, 0x12, 0x00, 0x18, 0x29,
+    0x12, 0x00, 0x14, 0x98, 0x36, 0x00, 0x02, 0x70, 0x08, 0x44, 0x76, 0x03, 0x44, 0x9c, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x14, 0xa0, 0x36, 0x00, 0x02, 0x12, 0x00, 0x40, 0x7b, 0x03, 0x33, 0x64, 0x7e,
+    0x00, 0x02, 0x6c, 0x00, 0x00, 0xb4, 0x00, 0x40, 0x7b, 0x03, 0x33, 0x67, 0x12, 0x00, 0x02, 0x6c,
+    0x00, 0x03, 0x12, 0x00, 0x10, 0x6a, 0x12, 0x00, 0x02, 0x6c, 0x00, 0x03, 0x12, 0x00, 0x14, 0x6d,
+    0x36, 0x00, 0x02, 0xb4, 0x00, 0x04, 0x12, 0x00, 0x02, 0x6c, 0x00, 0x03, 0x12, 0x00, 0x14, 0x70,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x7c, 0x03, 0x33, 0x73, 0x56, 0x01, 0x4a, 0x7c, 0x03, 0x33,
+    0x76, 0x56, 0x01, 0x4a, 0x7c, 0x03, 0x33, 0x79, 0x56, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x18, 0x7c, 0x56, 0x01, 0x15, 0xac, 0x12, 0x00, 0x04, 0x56, 0x01, 0x01, 0x12, 0x00, 0x18, 0x7f,
+    0x56, 0x01, 0x6a, 0xac, 0x00, 0x7d, 0x03, 0x33, 0x82, 0x52, 0x02, 0x30, 0x7d, 0x03, 0x33, 0x78,
+    0x35, 0x07, 0x52, 0x02, 0x4a, 0x7d, 0x03, 0x33, 0x88, 0x52, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x18, 0x8b, 0x52, 0x02, 0x01, 0x5a, 0x00, 0x01, 0x12, 0x00, 0x04, 0x52, 0x02, 0x06, 0x12,
+    0x00, 0x04, 0x52, 0x02, 0x6a, 0xac, 0x00, 0x7e, 0x03, 0x33, 0x8e, 0xfc, 0x00, 0x4a, 0x7e, 0x03,
+    0x33, 0x91, 0xfc, 0x00, 0x4a, 0x7e, 0x03, 0x33, 0x94, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x1a, 0x97, 0xfc, 0x00, 0x04, 0x12, 0x00, 0x06, 0xfc, 0x00, 0x4a, 0x7e, 0x03, 0x33, 0x9a,
+    0xfc, 0x00, 0x40, 0x7f, 0x03, 0x33, 0x9d, 0x12, 0x00, 0x15, 0x18, 0x7e, 0x00, 0x40, 0x7f, 0x03,
+    0x33, 0xa0, 0x12, 0x00, 0x15, 0x15, 0x5a, 0x00, 0x40, 0x7f, 0x03, 0x33, 0xa3, 0x12, 0x00, 0x18,
+    0x17, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0xa6, 0x36, 0x00, 0x05, 0x5a, 0x00,
+    0x14, 0xa9, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xac, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x80,
+    0x03, 0x33, 0xaf, 0xfc, 0x00, 0x4a, 0x80, 0x03, 0x33, 0xb2, 0xfc, 0x00, 0x4a, 0x80, 0x03, 0x33,
+    0xb5, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x00, 0xab, 0x42, 0x07, 0xfc, 0x00, 0x04,
+    0x12, 0x00, 0x06, 0xfc, 0x00, 0x4a, 0x80, 0x03, 0x33, 0xbb, 0xfc, 0x00, 0x4a, 0x81, 0x03, 0x33,
+    0xbe, 0xfc, 0x00, 0x4a, 0x81, 0x03, 0x33, 0xc1, 0xfc, 0x00, 0x4a, 0x81, 0x03, 0x33, 0xc4, 0xfc,
+    0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0xc7, 0xfc, 0x00, 0x4a, 0x81, 0x03, 0x33, 0xca,
+    0xfc, 0x00, 0x4a, 0x81, 0x03, 0x33, 0xcd, 0xfc, 0x00, 0x4a, 0x82, 0x03, 0x33, 0xd0, 0x76, 0x02,
+    0x4a, 0x82, 0x03, 0x33, 0xd3, 0x76, 0x02, 0x4a, 0x82, 0x03, 0x33, 0xd6, 0x76, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x17, 0xd9, 0x76, 0x02, 0x20, 0x08, 0xaa, 0x12, 0x00, 0x17, 0xdc, 0x76,
+    0x02, 0x02, 0x12, 0x00, 0x17, 0xdf, 0x76, 0x02, 0x78, 0x08, 0xaa, 0x00, 0x83, 0x03, 0x33, 0xe2,
+    0x7e, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x1a, 0xe5, 0x7e, 0x00, 0x4a, 0x83, 0x03, 0x33, 0xe8, 0x7e,
+    0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x17, 0xeb, 0x7e, 0x00, 0x11, 0x40, 0x5a, 0x00, 0x17,
+    0xee, 0x7e, 0x00, 0x02, 0x12, 0x00, 0x17, 0xf1, 0x7e, 0x00, 0x72, 0x40, 0xaa, 0x00, 0x84, 0x03,
+    0x33, 0xf4, 0x8c, 0x01, 0x13, 0x88, 0x7e, 0x00, 0x42, 0x84, 0x03, 0x33, 0xf7, 0xc2, 0x01, 0x01,
+    0x12, 0x00, 0x20, 0x00, 0xa0, 0x12, 0x00, 0x12, 0xfa, 0xc2, 0x01, 0x07, 0x12, 0x00, 0x08, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x14, 0xfd, 0x36, 0x00, 0x50, 0x01, 0x10, 0x00, 0x2c, 0xa2, 0x12, 0x00,
+    0x23, 0x00, 0x15, 0x36, 0x00, 0x05, 0x12, 0x00, 0x10, 0x03, 0x12, 0x00, 0x00, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x13, 0x85, 0x48, 0x00, 0x06, 0xfc, 0x00, 0x13, 0x85, 0x7e, 0x00, 0x06, 0xfc, 0x00,
+    0x13, 0x85, 0x7e, 0x00, 0x06, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x10, 0x06, 0x5a,
+    0x00, 0x06, 0x7a, 0x01, 0x40, 0x85, 0x03, 0x33, 0x09, 0x12, 0x00, 0x06, 0x7a, 0x01, 0x40, 0x85,
+    0x03, 0x33, 0x0c, 0x12, 0x00, 0x06, 0x7a, 0x01, 0x44, 0x86, 0x03, 0x33, 0x0f, 0x12, 0x00, 0x02,
+    0xf8, 0x01, 0x44, 0x86, 0x03, 0x33, 0x12, 0x48, 0x00, 0x02, 0x5a, 0x00, 0x44, 0x86, 0x03, 0x33,
+    0x15, 0x48, 0x00, 0x05, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x17, 0x18, 0x7e, 0x00,
+    0x11, 0x40, 0x5a, 0x00, 0x17, 0x1b, 0x7e, 0x00, 0x02, 0x12, 0x00, 0x17, 0x1e, 0x7e, 0x00, 0x7a,
+    0x40, 0xaa, 0x00, 0x87, 0x03, 0x33, 0x21, 0x7e, 0x00, 0x4a, 0x87, 0x03, 0x33, 0x24, 0x7e, 0x00,
+    0x4a, 0x87, 0x03, 0x33, 0x27, 0x7e, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0x2a, 0xfc,
+    0x00, 0x4a, 0x87, 0x03, 0x33, 0x2d, 0xfc, 0x00, 0x4a, 0x87, 0x03, 0x33, 0x30, 0xfc, 0x00, 0x4a,
+    0x88, 0x03, 0x33, 0x33, 0x7e, 0x00, 0x4a, 0x88, 0x03, 0x33, 0x36, 0x7e, 0x00, 0x4a, 0x88, 0x03,
+    0x33, 0x39, 0x7e, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0x3c, 0xfc, 0x00, 0x4a, 0x88,
+    0x03, 0x33, 0x3f, 0xfc, 0x00, 0x4a, 0x88, 0x03, 0x33, 0x42, 0xfc, 0x00, 0x4a, 0x89, 0x03, 0x33,
+    0x45, 0x7e, 0x00, 0x4a, 0x89, 0x03, 0x33, 0x48, 0x7e, 0x00, 0x4a, 0x89, 0x03, 0x33, 0x4b, 0x7e,
+    0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x17, 0x4e, 0x7e, 0x00, 0x11, 0x04, 0x5a, 0x00, 0x17,
+    0x51, 0x7e, 0x00, 0x02, 0x12, 0x00, 0x17, 0x54, 0x7e, 0x00, 0x7a, 0x04, 0xaa, 0x00, 0x8a, 0x03,
+    0x33, 0x57, 0x7e, 0x00, 0x4a, 0x8a, 0x03, 0x33, 0x5a, 0x7e, 0x00, 0x4a, 0x8a, 0x03, 0x33, 0x5d,
+    0x7e, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0x60, 0x7e, 0x00, 0x4a, 0x8a, 0x03, 0x33,
+    0x63, 0x7e, 0x00, 0x4a, 0x8a, 0x03, 0x33, 0x66, 0x7e, 0x00, 0x42, 0x8b, 0x03, 0x33, 0x69, 0x06,
+    0x03, 0x04, 0x7e, 0x00, 0x40, 0x8b, 0x03, 0x33, 0x6c, 0x12, 0x00, 0x06, 0x6a, 0x05, 0x42, 0x8b,
+    0x03, 0x33, 0x6f, 0x3c, 0x03, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x00, 0xbf,
+    0x3b, 0x07, 0xb8, 0x08, 0x44, 0x8b, 0x03, 0x33, 0x75, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x78,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x42, 0x8c, 0x03, 0x33, 0x7b, 0x12, 0x00, 0x00, 0x3c, 0x15, 0x00,
+    0x72, 0x03, 0x42, 0x8c, 0x03, 0x33, 0x7e, 0x48, 0x00, 0x01, 0x12, 0x00, 0x20, 0x00, 0xa0, 0x12,
+    0x00, 0x12, 0x81, 0x48, 0x00, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x84,
+    0x36, 0x00, 0x02, 0x0e, 0x0a, 0x44, 0x8c, 0x03, 0x33, 0x87, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14,
+    0x8a, 0x36, 0x00, 0x02, 0x12, 0x00, 0x40, 0x8d, 0x03, 0x44, 0xa4, 0xdc, 0x08, 0x06, 0x6e, 0x04,
+    0x40, 0x8d, 0x03, 0x44, 0xa8, 0x12, 0x00, 0x06, 0x6e, 0x04, 0x40, 0x8d, 0x03, 0x44, 0xac, 0x12,
+    0x00, 0x06, 0x6e, 0x04, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0xb0, 0x36, 0x00, 0x00, 0x4a,
+    0x04, 0x10, 0x22, 0x12, 0x00, 0x14, 0xb4, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xb8, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x4a, 0x8e, 0x03, 0x33, 0x8d, 0xf8, 0x01, 0x4a, 0x8e, 0x03, 0x33, 0x90, 0xf8,
+    0x01, 0x4a, 0x8e, 0x03, 0x33, 0x93, 0xf8, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x18, 0x96,
+    0xf8, 0x01, 0x15, 0xab, 0x12, 0x00, 0x06, 0xb0, 0x0a, 0x48, 0x8e, 0x03, 0x33, 0x99, 0xf8, 0x01,
+    0x60, 0xab, 0x00, 0x8f, 0x03, 0x33, 0x9c, 0x12, 0x00, 0x13, 0x18, 0x7a, 0x01, 0x10, 0xb0, 0x12,
+    0x00, 0x10, 0x9f, 0x12, 0x00, 0x15, 0x15, 0x56, 0x01, 0x40, 0x8f, 0x03, 0x33, 0xa2, 0x12, 0x00,
+    0x18, 0x17, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0xa5, 0x36, 0x00, 0x02, 0x56,
+    0x01, 0x44, 0x8f, 0x03, 0x33, 0xa8, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xab, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x4a, 0x90, 0x03, 0x33, 0xae, 0x76, 0x02, 0x4a, 0x90, 0x03, 0x33, 0xb1, 0x76, 0x02,
+    0x4a, 0x90, 0x03, 0x33, 0xb4, 0x76, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0xb7, 0x76,
+    0x02, 0x4a, 0x90, 0x03, 0x33, 0xba, 0x76, 0x02, 0x4a, 0x90, 0x03, 0x33, 0xbd, 0x76, 0x02, 0x4a,
+    0x91, 0x03, 0x33, 0xc0, 0xfc, 0x00, 0x4a, 0x91, 0x03, 0x33, 0xc3, 0xfc, 0x00, 0x4a, 0x91, 0x03,
+    0x33, 0xc6, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0xc9, 0xfc, 0x00, 0x4a, 0x91,
+    0x03, 0x33, 0xcc, 0xfc, 0x00, 0x4a, 0x91, 0x03, 0x33, 0xcf, 0xfc, 0x00, 0x1d, 0x92, 0x5a, 0x09,
+    0x1d, 0x92, 0x5a, 0x09, 0x1d, 0x92, 0x5a, 0x09, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x5a,
+    0x09, 0x1d, 0x92, 0x5a, 0x09, 0x1d, 0x92, 0x5a, 0x09, 0x4a, 0x93, 0x03, 0x33, 0xd2, 0x76, 0x02,
+    0x4a, 0x93, 0x03, 0x33, 0xd5, 0x76, 0x02, 0x4a, 0x93, 0x03, 0x33, 0xd8, 0x76, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x18, 0xdb, 0x76, 0x02, 0x01, 0x5a, 0x00, 0x01, 0x12, 0x00, 0x06, 0xd4,
+    0x0a, 0x04, 0x12, 0x00, 0x06, 0xd4, 0x0a, 0x42, 0x94, 0x03, 0x33, 0xde, 0x0e, 0x01, 0x04, 0x7e,
+    0x00, 0x42, 0x94, 0x03, 0x33, 0xe1, 0x44, 0x01, 0x04, 0x5a, 0x00, 0x42, 0x94, 0x03, 0x33, 0xe4,
+    0x44, 0x01, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0xe7, 0x36, 0x00, 0x05,
+    0x5a, 0x00, 0x01, 0x12, 0x00, 0x06, 0xfc, 0x00, 0x44, 0x94, 0x03, 0x33, 0xea, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x30, 0x95, 0x03, 0x44, 0x85, 0x83, 0x16, 0x3e, 0xf2, 0x19, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x14, 0xc0, 0x12, 0x00, 0x02, 0x28, 0x1a, 0xc2, 0x96, 0x03, 0x22, 0xd0, 0x1d,
+    0x00, 0x00, 0x3e, 0x22, 0x0d, 0x58, 0x01, 0xe4, 0x0f, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00,
+    0x23, 0x10, 0x1b, 0x12, 0x00, 0x50, 0x01, 0x10, 0x00, 0x15, 0x64, 0x12, 0x00, 0x2c, 0x46, 0x1e,
+    0x36, 0x00, 0x09, 0x12, 0x00, 0x01, 0x36, 0x00, 0x1d, 0x12, 0x36, 0x00, 0x0f, 0x6c, 0x00, 0x20,
+    0x40, 0x97, 0x03, 0x44, 0xc4, 0xb4, 0x00, 0x06, 0x94, 0x1a, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12,
+    0x00, 0x14, 0xc8, 0x12, 0x00, 0x02, 0xd8, 0x00, 0x4a, 0x98, 0x03, 0x22, 0x48, 0xa2, 0x00, 0x0c,
+    0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x14, 0x4a, 0x12, 0x00, 0x02, 0x6c, 0x00, 0x4d, 0x98, 0x03,
+    0x22, 0x4c, 0x36, 0x00, 0x09, 0x12, 0x00, 0x01, 0x36, 0x00, 0x1d, 0x4e, 0x36, 0x00, 0x0f, 0x6c,
+    0x00, 0x20, 0x4a, 0x99, 0x03, 0x44, 0xcc, 0xb0, 0x01, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00,
+    0x18, 0xd0, 0xb0, 0x01, 0x60, 0xa2, 0x00, 0x9a, 0x03, 0x22, 0x50, 0x48, 0x00, 0x15, 0x31, 0x6c,
+    0x00, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x1d, 0x52, 0x24, 0x00, 0x09, 0x12, 0x00, 0x01,
+    0x24, 0x00, 0x14, 0x54, 0x12, 0x00, 0x00, 0x90, 0x00, 0x10, 0x62, 0x12, 0x00, 0x1d, 0x56, 0x12,
+    0x00, 0x0f, 0x6c, 0x00, 0x11, 0x0b, 0x48, 0x00, 0x4a, 0x9b, 0x03, 0x44, 0xd4, 0xd8, 0x00, 0x0c,
+    0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x1a, 0xd8, 0xd8, 0x00, 0x4a, 0x9c, 0x03, 0x22, 0x58, 0x6c,
+    0x00, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x1d, 0x5a, 0x24, 0x00, 0x09, 0x12, 0x00, 0x01,
+    0x24, 0x00, 0x1a, 0x5c, 0x90, 0x00, 0x4d, 0x9c, 0x03, 0x22, 0x5e, 0x12, 0x00, 0x0f, 0x6c, 0x00,
+    0x11, 0x0b, 0x48, 0x00, 0x51, 0x9d, 0x03, 0x33, 0x61, 0x11, 0xc2, 0x01, 0x70, 0x84, 0x04, 0x01,
+    0x00, 0x04, 0x01, 0x60, 0x12, 0x00, 0x15, 0x67, 0x12, 0x00, 0x40, 0x10, 0x04, 0x11, 0x63, 0x12,
+    0x00, 0x12, 0x64, 0x12, 0x00, 0x16, 0x58, 0x24, 0x00, 0x09, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00,
+    0x15, 0x6a, 0x12, 0x00, 0x4f, 0x10, 0x04, 0x11, 0x64, 0x5a, 0x00, 0x12, 0x40, 0x9e, 0x03, 0x33,
+    0xed, 0xf0, 0x03, 0x01, 0x9e, 0x13, 0x01, 0x24, 0x00, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00,
+    0x1d, 0xf0, 0x24, 0x00, 0x09, 0x12, 0x00, 0x01, 0x24, 0x00, 0x15, 0xf3, 0x12, 0x00, 0x04, 0x5a,
+    0x00, 0x18, 0xf6, 0x12, 0x00, 0x1f, 0x64, 0x6c, 0x00, 0x15, 0x0b, 0x48, 0x00, 0x30, 0x9f, 0x03,
+    0x33, 0x2e, 0x43, 0x07, 0xfc, 0x00, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x18, 0x73, 0xfc,
+    0x00, 0x01, 0x36, 0x00, 0x1d, 0x70, 0x36, 0x00, 0x09, 0x12, 0x00, 0x01, 0x36, 0x00, 0x1a, 0x76,
+    0x32, 0x01, 0x0f, 0x6c, 0x00, 0x23, 0x4a, 0xa0, 0x03, 0x44, 0xdc, 0x4a, 0x04, 0x0c, 0x12, 0x00,
+    0x10, 0xb8, 0x12, 0x00, 0x18, 0xe0, 0x4a, 0x04, 0x6a, 0xa3, 0x00, 0xa1, 0x03, 0x44, 0xe4, 0xd0,
+    0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x18, 0xe8, 0xd0, 0x02, 0x6a, 0xa3, 0x00, 0xa2,
+    0x03, 0x22, 0xd4, 0xec, 0x04, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x18, 0x30, 0xec, 0x04,
+    0x10, 0x63, 0x12, 0x00, 0x1a, 0x60, 0x4a, 0x04, 0x0c, 0x12, 0x00, 0x01, 0x36, 0x00, 0x1d, 0x32,
+    0x36, 0x00, 0x0f, 0x6c, 0x00, 0x20, 0x4a, 0xa3, 0x03, 0x22, 0x62, 0x6c, 0x00, 0x0c, 0x12, 0x00,
+    0x10, 0x70, 0x12, 0x00, 0x18, 0x64, 0xb6, 0x04, 0x01, 0x36, 0x00, 0x1d, 0x66, 0x36, 0x00, 0x09,
+    0x12, 0x00, 0x01, 0x36, 0x00, 0x1d, 0x68, 0x36, 0x00, 0x0f, 0x6c, 0x00, 0x20, 0x1b, 0xa4, 0x20,
+    0x13, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x20, 0x13, 0x1d, 0xa4, 0x20, 0x13, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0x20, 0x13, 0x04, 0x12, 0x00, 0x06, 0x28, 0x11, 0x1d, 0xa4, 0x20, 0x13, 0x1b,
+    0xa5, 0xca, 0x08, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xca, 0x08, 0x1d, 0xa5, 0xca, 0x08, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0xca, 0x08, 0x1d, 0xa5, 0xca, 0x08, 0x1d, 0xa5, 0xca, 0x08, 0x1b,
+    0xa6, 0x24, 0x12, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x1d, 0xa6, 0x24, 0x12, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x04, 0x12, 0x00, 0x06, 0xfc, 0x00, 0x1d, 0xa6, 0x24,
+    0x12, 0x1b, 0xa7, 0x24, 0x12, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x1d, 0xa7, 0x24, 0x12,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x1d, 0xa7, 0x24, 0x12, 0x1d, 0xa7, 0x24,
+    0x12, 0x1b, 0xa8, 0x24, 0x12, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x1d, 0xa8, 0x24, 0x12,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x24, 0x12, 0x1d, 0xa8, 0x24, 0x12, 0x1d, 0xa8, 0x24,
+    0x12, 0x1b, 0xa9, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xa9, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xa9, 0xaa, 0x10, 0x1d, 0xa9, 0xaa,
+    0x10, 0x1b, 0xaa, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xaa, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xaa, 0xaa, 0x10, 0x1d, 0xaa, 0xaa,
+    0x10, 0x1b, 0xab, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xab, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xab, 0xaa, 0x10, 0x1d, 0xab, 0xaa,
+    0x10, 0x1b, 0xac, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xac, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xac, 0xaa, 0x10, 0x1d, 0xac, 0xaa,
+    0x10, 0x1b, 0xad, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xad, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xad, 0xaa, 0x10, 0x1d, 0xad, 0xaa,
+    0x10, 0x1b, 0xae, 0xaa, 0x10, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xae, 0xaa, 0x10,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xaa, 0x10, 0x1d, 0xae, 0xaa, 0x10, 0x1d, 0xae, 0xaa,
+    0x10, 0x1b, 0xaf, 0x30, 0x0f, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xaf, 0x30, 0x0f,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xaf, 0x30, 0x0f, 0x1d, 0xaf, 0x30,
+    0x0f, 0x1b, 0xb0, 0x30, 0x0f, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xb0, 0x30, 0x0f,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xb0, 0x30, 0x0f, 0x1d, 0xb0, 0x30,
+    0x0f, 0x1b, 0xb1, 0x30, 0x0f, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xb1, 0x30, 0x0f,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x30, 0x0f, 0x1d, 0xb1, 0x30, 0x0f, 0x1d, 0xb1, 0x30,
+    0x0f, 0x1d, 0xb2, 0x14, 0x0d, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0x14, 0x0d, 0x1d,
+    0xb2, 0x80, 0x0d, 0x0c, 0x12, 0x00, 0x01, 0x36, 0x00, 0x0b, 0x80, 0x0d, 0x0f, 0x6c, 0x00, 0x23,
+    0x1d, 0xb3, 0xde, 0x0c, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0xde, 0x0c, 0x1d, 0xb3,
+    0x4a, 0x0d, 0x0c, 0x12, 0x00, 0x01, 0x36, 0x00, 0x0b, 0x4a, 0x0d, 0x0f, 0x6c, 0x00, 0x23, 0x1d,
+    0xb4, 0xa8, 0x0c, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0x14, 0x0d, 0x0c, 0x12, 0x00,
+    0x01, 0x24, 0x00, 0x0b, 0xcc, 0x0c, 0x1d, 0xb4, 0x14, 0x0d, 0x0f, 0x6c, 0x00, 0x14, 0x0b, 0x48,
+    0x00, 0x1d, 0xb5, 0x72, 0x0c, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0xde, 0x0c, 0x0c,
+    0x12, 0x00, 0x01, 0x24, 0x00, 0x0b, 0x96, 0x0c, 0x1d, 0xb5, 0xde, 0x0c, 0x0f, 0x6c, 0x00, 0x14,
+    0x0b, 0x48, 0x00, 0x1d, 0xb6, 0x44, 0x0a, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0x44,
+    0x0a, 0x1d, 0xb6, 0xb0, 0x0a, 0x0c, 0x12, 0x00, 0x01, 0x36, 0x00, 0x0b, 0xb0, 0x0a, 0x0f, 0x6c,
+    0x00, 0x23, 0x1d, 0xb7, 0x44, 0x0a, 0x0c, 0x12, 0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0x44, 0x0a,
+    0x1d, 0xb7, 0xb0, 0x0a, 0x0c, 0x12, 0x00, 0x01, 0x36, 0x00, 0x0b, 0xb0, 0x0a, 0x0f, 0x6c, 0x00,
+    0x23, 0x42, 0xb8, 0x03, 0x33, 0xf9, 0x5c, 0x04, 0x04, 0x22, 0x20, 0x42, 0xb8, 0x03, 0x33, 0xfc,
+    0x92, 0x04, 0x04, 0xfe, 0x1f, 0x42, 0xb8, 0x03, 0x33, 0xff, 0x92, 0x04, 0x07, 0x12, 0x00, 0x08,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x29, 0x02, 0x16, 0x22, 0x20, 0x40, 0xb8, 0x03, 0x33, 0x05, 0x12,
+    0x00, 0x06, 0x22, 0x20, 0x40, 0xb8, 0x03, 0x33, 0x08, 0x12, 0x00, 0x06, 0x22, 0x20, 0x40, 0xb9,
+    0x03, 0x33, 0x0b, 0x12, 0x00, 0x06, 0xfc, 0x12, 0x40, 0xb9, 0x03, 0x33, 0x0e, 0x12, 0x00, 0x06,
+    0xc0, 0x06, 0x40, 0xb9, 0x03, 0x33, 0x11, 0x12, 0x00, 0x06, 0xc0, 0x06, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x14, 0x14, 0x36, 0x00, 0x02, 0x22, 0x05, 0x04, 0x12, 0x00, 0x06, 0x72, 0x15, 0x44,
+    0xb9, 0x03, 0x33, 0x17, 0x36, 0x00, 0x02, 0x12, 0x00, 0x42, 0xba, 0x03, 0x33, 0x1a, 0x90, 0x00,
+    0x04, 0x7e, 0x00, 0x42, 0xba, 0x03, 0x33, 0x1d, 0xc6, 0x00, 0x04, 0x5a, 0x00, 0x42, 0xba, 0x03,
+    0x33, 0x20, 0xc6, 0x00, 0x07, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x23, 0x36,
+    0x00, 0x05, 0x5a, 0x00, 0x14, 0x26, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x29, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x40, 0xbb, 0x03, 0x33, 0x2c, 0x12, 0x00, 0x06, 0x7a, 0x13, 0x40, 0xbb, 0x03, 0x33,
+    0x2f, 0x12, 0x00, 0x06, 0xb0, 0x0a, 0x40, 0xbb, 0x03, 0x33, 0x32, 0x12, 0x00, 0x06, 0xb0, 0x0a,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x35, 0x36, 0x00, 0x02, 0x8c, 0x0a, 0x44, 0xbb, 0x03,
+    0x33, 0x38, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x3b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0xbc,
+    0x76, 0x14, 0x1d, 0xbc, 0x76, 0x14, 0x1d, 0xbc, 0x76, 0x14, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0x76, 0x14, 0x04, 0x12, 0x00, 0x06, 0x76, 0x14, 0x04, 0x12, 0x00, 0x06, 0x76, 0x14, 0x1d,
+    0xbd, 0x76, 0x14, 0x1d, 0xbd, 0x76, 0x14, 0x1d, 0xbd, 0x76, 0x14, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x0b, 0x76, 0x14, 0x04, 0x12, 0x00, 0x06, 0xfc, 0x00, 0x1d, 0xbd, 0x76, 0x14, 0x40, 0xbe,
+    0x03, 0x33, 0x3e, 0x0e, 0x01, 0x06, 0xbc, 0x10, 0x45, 0xbe, 0x03, 0x33, 0x41, 0x12, 0x00, 0x01,
+    0x78, 0x0f, 0x42, 0xbe, 0x03, 0x33, 0x44, 0x12, 0x00, 0x04, 0xae, 0x0f, 0x0c, 0x12, 0x00, 0x10,
+    0x70, 0x12, 0x00, 0x15, 0x47, 0x12, 0x00, 0x01, 0xe4, 0x0f, 0x0f, 0x5a, 0x00, 0x11, 0x40, 0xbf,
+    0x03, 0x33, 0x4a, 0x12, 0x00, 0x06, 0xaa, 0x10, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x1d,
+    0x4d, 0x24, 0x00, 0x09, 0x12, 0x00, 0x01, 0x24, 0x00, 0x15, 0x50, 0x12, 0x00, 0x04, 0x5a, 0x00,
+    0x18, 0x53, 0x12, 0x00, 0x1f, 0x64, 0x6c, 0x00, 0x15, 0x0b, 0x48, 0x00, 0x4a, 0xc0, 0x03, 0x33,
+    0x56, 0xfc, 0x00, 0x0c, 0x12, 0x00, 0x10, 0x70, 0x12, 0x00, 0x18, 0x59, 0xfc, 0x00, 0x01, 0x36,
+    0x00, 0x1d, 0x5c, 0x36, 0x00, 0x09, 0x12, 0x00, 0x01, 0x36, 0x00, 0x1a, 0x5f, 0x32, 0x01, 0x0f,
+    0x6c, 0x00, 0x23, 0x4a, 0xc1, 0x03, 0x33, 0x62, 0x38, 0x04, 0x4a, 0xc1, 0x03, 0x33, 0x65, 0x38,
+    0x04, 0x4a, 0xc1, 0x03, 0x33, 0x68, 0x38, 0x04, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x18, 0x6b,
+    0x38, 0x04, 0x10, 0xaa, 0x12, 0x00, 0x18, 0x6e, 0x38, 0x04, 0x01, 0x12, 0x00, 0x18, 0x71, 0x38,
+    0x04, 0x6a, 0xaa, 0x00, 0xc2, 0x03, 0x33, 0x74, 0x7e, 0x00, 0x4a, 0xc2, 0x03, 0x33, 0x77, 0x7e,
+    0x00, 0x4a, 0xc2, 0x03, 0x33, 0x7a, 0x7e, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0x7d,
+    0x7e, 0x00, 0x4a, 0xc2, 0x03, 0x33, 0x80, 0x7e, 0x00, 0x4a, 0xc2, 0x03, 0x33, 0x83, 0x7e, 0x00,
+    0x40, 0xc3, 0x03, 0x55, 0x48, 0x60, 0x27, 0x15, 0x0d, 0x36, 0x24, 0x30, 0xc3, 0x03, 0x55, 0x86,
+    0x6f, 0x28, 0x10, 0x0f, 0x12, 0x00, 0x10, 0x52, 0x12, 0x00, 0x18, 0x10, 0x12, 0x00, 0x14, 0x57,
+    0x36, 0x00, 0x00, 0x52, 0x2f, 0x10, 0xa2, 0x12, 0x00, 0x14, 0x5c, 0x36, 0x00, 0x05, 0x12, 0x00,
+    0x00, 0x82, 0x98, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0xc4, 0x42, 0x33, 0x1d, 0xc4, 0x42,
+    0x33, 0x1d, 0xc4, 0x42, 0x33, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x1d, 0xc4,
+    0x42, 0x33, 0x1d, 0xc4, 0x42, 0x33, 0x1d, 0xc5, 0x42, 0x33, 0x1d, 0xc5, 0x42, 0x33, 0x1d, 0xc5,
+    0x42, 0x33, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x1d, 0xc5, 0x42, 0x33, 0x1d,
+    0xc5, 0x42, 0x33, 0x1d, 0xc6, 0x42, 0x33, 0x1d, 0xc6, 0x42, 0x33, 0x1d, 0xc6, 0x42, 0x33, 0x0b,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x1d, 0xc6, 0x42, 0x33, 0x1d, 0xc6, 0x42, 0x33,
+    0x1d, 0xc7, 0x42, 0x33, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x1d, 0xc8,
+    0x42, 0x33, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x1d, 0xc9, 0x42, 0x33,
+    0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x42, 0x33, 0x86, 0xca, 0x03, 0x44, 0xec, 0x08,
+    0x00, 0x00, 0x10, 0xe2, 0x26, 0x40, 0xca, 0x03, 0x44, 0xf0, 0x12, 0x00, 0x06, 0xe2, 0x26, 0x40,
+    0xca, 0x03, 0x44, 0xf4, 0x12, 0x00, 0x06, 0xe2, 0x26, 0x44, 0xca, 0x03, 0x44, 0xf8, 0x36, 0x00,
+    0x02, 0xea, 0x00, 0x44, 0xca, 0x03, 0x44, 0xfc, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0xf0, 0x38,
+    0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x40, 0xd0, 0x03, 0x33, 0xf4, 0x12, 0x00, 0x15, 0x1b, 0x6e,
+    0x0d, 0x0b, 0x12, 0x00, 0x20, 0x00, 0xa0, 0x12, 0x00, 0x23, 0x08, 0x0a, 0x12, 0x00, 0x02, 0xe8,
+    0x05, 0x44, 0xd1, 0x03, 0x33, 0x24, 0x12, 0x00, 0x02, 0x36, 0x00, 0x0b, 0x12, 0x00, 0x20, 0x00,
+    0xa0, 0x12, 0x00, 0x18, 0x38, 0x36, 0x00, 0xa6, 0xab, 0x00, 0xd2, 0x03, 0x33, 0xf8, 0x09, 0x00,
+    0x00, 0x46, 0xa0, 0x29, 0x40, 0xd2, 0x03, 0x33, 0xfc, 0x12, 0x00, 0x06, 0xa0, 0x29, 0x12, 0xd2,
+    0x7e, 0x00, 0x16, 0x46, 0xa0, 0x29, 0x53, 0xd2, 0x03, 0x33, 0x86, 0x16, 0x36, 0x00, 0x00, 0x7c,
+    0x29, 0x10, 0xa4, 0x12, 0x00, 0x10, 0x89, 0x12, 0x00, 0x04, 0xa0, 0x29, 0x01, 0x12, 0x00, 0x10,
+    0x8c, 0x12, 0x00, 0x04, 0xa0, 0x29, 0x32, 0xa4, 0x00, 0xd3, 0xa2, 0x2d, 0x07, 0x6c, 0x00, 0x40,
+    0xd3, 0x03, 0x33, 0x2c, 0x12, 0x00, 0x06, 0x6c, 0x00, 0x12, 0xd3, 0xb4, 0x00, 0x07, 0x6c, 0x00,
+    0x48, 0xd3, 0x03, 0x33, 0x8f, 0x6c, 0x00, 0x10, 0xa3, 0x12, 0x00, 0x18, 0x92, 0x6c, 0x00, 0x01,
+    0x12, 0x00, 0x18, 0x95, 0x6c, 0x00, 0x60, 0xa3, 0x00, 0xd5, 0x03, 0x44, 0x04, 0x32, 0x01, 0x33,
+    0x1f, 0x0d, 0x70, 0x48, 0x00, 0x40, 0xd5, 0x03, 0x44, 0x08, 0x12, 0x00, 0x18, 0x20, 0x12, 0x00,
+    0x14, 0x0c, 0x24, 0x00, 0x00, 0x8c, 0x2e, 0x10, 0x23, 0x12, 0x00, 0x14, 0x10, 0x24, 0x00, 0x02,
+    0x12, 0x00, 0x40, 0xd6, 0x03, 0x44, 0x14, 0x12, 0x00, 0x15, 0x18, 0x36, 0x00, 0x44, 0xd6, 0x03,
+    0x44, 0x18, 0x12, 0x00, 0x00, 0xf8, 0x2e, 0x60, 0x23, 0x00, 0xd7, 0x03, 0x44, 0x1c, 0x12, 0x00,
+    0x15, 0x17, 0x24, 0x00, 0x4a, 0xd7, 0x03, 0x44, 0x20, 0x36, 0x00, 0x44, 0xd7, 0x03, 0x44, 0x24,
+    0x24, 0x00, 0x00, 0x0a, 0x2f, 0x10, 0x24, 0x12, 0x00, 0x17, 0x28, 0x48, 0x00, 0x7a, 0x20, 0x24,
+    0x00, 0xd8, 0x03, 0x44, 0x2c, 0xa2, 0x00, 0x48, 0xd8, 0x03, 0x44, 0x30, 0x90, 0x00, 0x6a, 0x24,
+    0x00, 0xda, 0x03, 0x44, 0x34, 0xd8, 0x00, 0x4a, 0xda, 0x03, 0x44, 0x38, 0x36, 0x00, 0x4a, 0xda,
+    0x03, 0x44, 0x3c, 0xd8, 0x00, 0x4a, 0xda, 0x03, 0x44, 0x40, 0xd8, 0x00, 0x4a, 0xdb, 0x03, 0x44,
+    0x44, 0xa2, 0x00, 0x4a, 0xdb, 0x03, 0x44, 0x48, 0xd8, 0x00, 0x4a, 0xdc, 0x03, 0x44, 0x4c, 0xd8,
+    0x00, 0x4a, 0xdc, 0x03, 0x44, 0x50, 0x36, 0x00, 0x4a, 0xdc, 0x03, 0x44, 0x54, 0xd8, 0x00, 0x4a,
+    0xdc, 0x03, 0x44, 0x58, 0xd8, 0x00, 0x4a, 0xdd, 0x03, 0x44, 0x5c, 0xa2, 0x00, 0x4a, 0xdd, 0x03,
+    0x44, 0x60, 0xd8, 0x00, 0xb0, 0xde, 0x03, 0x33, 0x98, 0x16, 0x00, 0x00, 0x10, 0x1e, 0x0d, 0x7c,
+    0xba, 0x69, 0x20, 0x00, 0x60, 0x12, 0x00, 0x24, 0x8e, 0x11, 0x12, 0x00, 0x10, 0x10, 0xd7, 0x3c,
+    0x51, 0xdf, 0x03, 0x44, 0x64, 0x09, 0xb6, 0x04, 0x00, 0x1c, 0x02, 0x30, 0x44, 0x03, 0xb0, 0x12,
+    0x00, 0x10, 0x68, 0x12, 0x00, 0x12, 0x2d, 0x12, 0x00, 0x20, 0x00, 0xa0, 0x12, 0x00, 0x10, 0x6c,
+    0x12, 0x00, 0x18, 0x2f, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x70, 0x36, 0x00,
+    0x50, 0x01, 0x10, 0x44, 0x04, 0xab, 0x12, 0x00, 0x14, 0x74, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14,
+    0x78, 0x36, 0x00, 0x02, 0x12, 0x00, 0x13, 0xe0, 0x6c, 0x00, 0x30, 0x31, 0x0d, 0x80, 0x48, 0x00,
+    0x2d, 0x01, 0xa0, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x14, 0x7c, 0x12, 0x00, 0xaa, 0x01, 0x10,
+    0x44, 0x11, 0xa3, 0x00, 0xe1, 0x03, 0x44, 0x80, 0xb4, 0x00, 0x4a, 0xe1, 0x03, 0x44, 0x84, 0xb4,
+    0x00, 0x00, 0x80, 0xb1, 0x0a, 0xb4, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1a, 0x8c, 0xb4,
+    0x00, 0x4a, 0xe1, 0x03, 0x44, 0x90, 0xb4, 0x00, 0x4a, 0xe1, 0x03, 0x44, 0x94, 0xb4, 0x00, 0x13,
+    0xe2, 0x6c, 0x00, 0x06, 0xb4, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x1a, 0x98, 0xb4,
+    0x00, 0x43, 0xe3, 0x03, 0x55, 0x66, 0x76, 0x2f, 0x01, 0x0c, 0x06, 0x10, 0xb8, 0x12, 0x00, 0x1a,
+    0x6b, 0x0c, 0x06, 0x43, 0xe3, 0x03, 0x55, 0x70, 0xac, 0x2f, 0x06, 0x12, 0x00, 0x08, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x14, 0x75, 0x36, 0x00, 0x02, 0xe4, 0x06, 0x44, 0xe3, 0x03, 0x55, 0x7a, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x14, 0x7f, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0xe4, 0x03, 0x55, 0x84,
+    0x7e, 0x00, 0x4a, 0xe4, 0x03, 0x55, 0x89, 0x7e, 0x00, 0x4a, 0xe4, 0x03, 0x55, 0x8e, 0x7e, 0x00,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x00, 0xf9, 0x77, 0x07, 0x8a, 0x06, 0x48, 0xe4, 0x03, 0x55,
+    0x98, 0x7e, 0x00, 0x01, 0x12, 0x00, 0x18, 0x9d, 0x7e, 0x00, 0x33, 0xab, 0x00, 0xe5, 0xea, 0x00,
+    0x06, 0x1e, 0x06, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x1a, 0xa2, 0x8a, 0x06, 0x13, 0xe6,
+    0xa2, 0x00, 0x06, 0x36, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x1a, 0xa7, 0x54, 0x06,
+    0x30, 0xe9, 0x03, 0x44, 0x32, 0x01, 0x16, 0xcc, 0x74, 0x07, 0x30, 0xe9, 0x03, 0x44, 0x6c, 0x00,
+    0x16, 0xcc, 0xea, 0x00, 0x30, 0xe9, 0x03, 0x44, 0x68, 0x01, 0x16, 0xcc, 0xea, 0x00, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x00, 0x68, 0x01, 0x01, 0x36, 0x00, 0x02, 0x44, 0x01, 0x30, 0xe9, 0x03,
+    0x44, 0x68, 0x01, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x68, 0x01, 0x01, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x42, 0xea, 0x03, 0x44, 0x9c, 0x2e, 0x02, 0x04, 0x7e, 0x00, 0x42, 0xea, 0x03, 0x44,
+    0xa0, 0x64, 0x02, 0x04, 0x5a, 0x00, 0x42, 0xea, 0x03, 0x44, 0xa4, 0x64, 0x02, 0x07, 0x12, 0x00,
+    0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0xa8, 0x36, 0x00, 0x02, 0x4c, 0x08, 0x44, 0xea, 0x03,
+    0x44, 0xac, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xb0, 0x36, 0x00, 0x02, 0x12, 0x00, 0x30, 0xeb,
+    0x03, 0x44, 0xb0, 0x01, 0x07, 0xfc, 0x00, 0x30, 0xeb, 0x03, 0x44, 0x32, 0x01, 0x07, 0xfc, 0x00,
+    0x30, 0xeb, 0x03, 0x44, 0xe6, 0x01, 0x07, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x00,
+    0xe6, 0x01, 0x05, 0xfc, 0x00, 0x10, 0xab, 0x12, 0x00, 0x00, 0xe6, 0x01, 0x05, 0xfc, 0x00, 0x01,
+    0x12, 0x00, 0x00, 0xe6, 0x01, 0x05, 0xfc, 0x00, 0x33, 0xab, 0x00, 0xec, 0x68, 0x01, 0x06, 0xb0,
+    0x01, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x00, 0xe6, 0x01, 0x01, 0x12, 0x00, 0x02, 0xe6,
+    0x01, 0x13, 0xed, 0x20, 0x01, 0x06, 0x70, 0x08, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x14,
+    0xb4, 0x12, 0x00, 0x02, 0x70, 0x08, 0x13, 0xee, 0xd8, 0x00, 0x06, 0x6c, 0x00, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x00, 0x1c, 0x02, 0x05, 0x6c, 0x00, 0x3d, 0xa3, 0x00, 0xef, 0x1c, 0x02,
+    0x1d, 0xef, 0x1c, 0x02, 0x1d, 0xef, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c,
+    0x02, 0x1d, 0xef, 0x1c, 0x02, 0x1d, 0xef, 0x1c, 0x02, 0x1d, 0xf0, 0x1c, 0x02, 0x1d, 0xf0, 0x1c,
+    0x02, 0x1d, 0xf0, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xf0,
+    0x1c, 0x02, 0x1d, 0xf0, 0x1c, 0x02, 0x1d, 0xf1, 0x1c, 0x02, 0x1d, 0xf1, 0x1c, 0x02, 0x1d, 0xf1,
+    0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xf1, 0x1c, 0x02, 0x1d,
+    0xf1, 0x1c, 0x02, 0x1d, 0xf2, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c,
+    0x02, 0x1d, 0xf3, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d,
+    0xf4, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xf5, 0x1c,
+    0x02, 0x1d, 0xf5, 0x1c, 0x02, 0x1d, 0xf5, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0x1c, 0x02, 0x1d, 0xf5, 0x1c, 0x02, 0x1d, 0xf5, 0x1c, 0x02, 0x1d, 0xf6, 0x1c, 0x02, 0x1d, 0xf6,
+    0x1c, 0x02, 0x1d, 0xf6, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d,
+    0xf6, 0x1c, 0x02, 0x1d, 0xf6, 0x1c, 0x02, 0x1d, 0xf7, 0x1c, 0x02, 0x1d, 0xf7, 0x1c, 0x02, 0x1d,
+    0xf7, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xf7, 0x1c, 0x02,
+    0x1d, 0xf7, 0x1c, 0x02, 0x1d, 0xf8, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b,
+    0x1c, 0x02, 0x1d, 0xf9, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02,
+    0x1d, 0xfa, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xfc,
+    0x24, 0x09, 0x1d, 0xfc, 0x24, 0x09, 0x1d, 0xfc, 0x24, 0x09, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0x24, 0x09, 0x1d, 0xfc, 0x24, 0x09, 0x1d, 0xfc, 0x24, 0x09, 0x1d, 0xfd, 0x24, 0x09, 0x0c,
+    0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x24, 0x09, 0x2c, 0x02, 0x04, 0xd0, 0x02, 0x2c, 0x02,
+    0x04, 0xd0, 0x02, 0x2c, 0x02, 0x04, 0xd0, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xd0,
+    0x02, 0x2c, 0x02, 0x04, 0xd0, 0x02, 0x2c, 0x02, 0x04, 0xd0, 0x02, 0x2c, 0x03, 0x04, 0xd0, 0x02,
+    0x2c, 0x03, 0x04, 0xd0, 0x02, 0x2c, 0x03, 0x04, 0xd0, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0xd0, 0x02, 0x2c, 0x03, 0x04, 0xd0, 0x02, 0x2c, 0x03, 0x04, 0xd0, 0x02, 0x2c, 0x04, 0x04,
+    0xd0, 0x02, 0x2c, 0x04, 0x04, 0xd0, 0x02, 0x2c, 0x04, 0x04, 0xd0, 0x02, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0xd0, 0x02, 0x2c, 0x04, 0x04, 0xd0, 0x02, 0x2c, 0x04, 0x04, 0xd0, 0x02, 0x1d,
+    0x05, 0x7a, 0x01, 0x1d, 0x05, 0x7a, 0x01, 0x1d, 0x05, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x05, 0x7a, 0x01, 0x1d, 0x05, 0x7a, 0x01, 0x1d, 0x06, 0x7a, 0x01,
+    0x1d, 0x06, 0x7a, 0x01, 0x1d, 0x06, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a,
+    0x01, 0x1d, 0x06, 0x7a, 0x01, 0x1d, 0x06, 0x7a, 0x01, 0x1d, 0x07, 0x7a, 0x01, 0x1d, 0x07, 0x7a,
+    0x01, 0x1d, 0x07, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x07,
+    0x7a, 0x01, 0x1d, 0x07, 0x7a, 0x01, 0x1d, 0x08, 0x7a, 0x01, 0x1d, 0x08, 0x7a, 0x01, 0x1d, 0x08,
+    0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x08, 0x7a, 0x01, 0x1d,
+    0x08, 0x7a, 0x01, 0x1d, 0x09, 0x7a, 0x01, 0x1d, 0x09, 0x7a, 0x01, 0x1d, 0x09, 0x7a, 0x01, 0x0b,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x09, 0x7a, 0x01, 0x1d, 0x09, 0x7a, 0x01,
+    0x1d, 0x0a, 0x7a, 0x01, 0x1d, 0x0a, 0x7a, 0x01, 0x1d, 0x0a, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x0a, 0x7a, 0x01, 0x1d, 0x0a, 0x7a, 0x01, 0x1d, 0x0d, 0x7a,
+    0x01, 0x1d, 0x0d, 0x7a, 0x01, 0x1d, 0x0d, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0x7a, 0x01, 0x1d, 0x0d, 0x7a, 0x01, 0x1d, 0x0d, 0x7a, 0x01, 0x1d, 0x0e, 0x7a, 0x01, 0x1d, 0x0e,
+    0x7a, 0x01, 0x1d, 0x0e, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d,
+    0x0e, 0x7a, 0x01, 0x1d, 0x0e, 0x7a, 0x01, 0x1d, 0x0f, 0x7a, 0x01, 0x1d, 0x0f, 0x7a, 0x01, 0x1d,
+    0x0f, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x0f, 0x7a, 0x01,
+    0x1d, 0x0f, 0x7a, 0x01, 0x13, 0x10, 0x68, 0x01, 0x06, 0xd2, 0x06, 0x0c, 0x12, 0x00, 0x10, 0xb0,
+    0x12, 0x00, 0x0b, 0x3e, 0x07, 0x13, 0x11, 0x20, 0x01, 0x06, 0x3e, 0x07, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x0b, 0x3e, 0x07, 0x13, 0x12, 0xd8, 0x00, 0x06, 0x6c, 0x00, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x0b, 0x3e, 0x07, 0x1d, 0x13, 0x1c, 0x02, 0x1d, 0x13, 0x1c, 0x02, 0x1d,
+    0x13, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x13, 0x1c, 0x02,
+    0x1d, 0x13, 0x1c, 0x02, 0x1d, 0x14, 0x1c, 0x02, 0x1d, 0x14, 0x1c, 0x02, 0x1d, 0x14, 0x1c, 0x02,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x14, 0x1c, 0x02, 0x1d, 0x14, 0x1c,
+    0x02, 0x1d, 0x15, 0x1c, 0x02, 0x1d, 0x15, 0x1c, 0x02, 0x1d, 0x15, 0x1c, 0x02, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x15, 0x1c, 0x02, 0x1d, 0x15, 0x1c, 0x02, 0x1d, 0x16,
+    0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x17, 0x1c, 0x02,
+    0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x18, 0x1c, 0x02, 0x0c, 0x12,
+    0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x19, 0x1c, 0x02, 0x1d, 0x19, 0x1c, 0x02,
+    0x1d, 0x19, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x19, 0x1c,
+    0x02, 0x1d, 0x19, 0x1c, 0x02, 0x1d, 0x1a, 0x1c, 0x02, 0x1d, 0x1a, 0x1c, 0x02, 0x1d, 0x1a, 0x1c,
+    0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1a, 0x1c, 0x02, 0x1d, 0x1a,
+    0x1c, 0x02, 0x1d, 0x1b, 0x1c, 0x02, 0x1d, 0x1b, 0x1c, 0x02, 0x1d, 0x1b, 0x1c, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1b, 0x1c, 0x02, 0x1d, 0x1b, 0x1c, 0x02, 0x1d,
+    0x1c, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1d, 0x1c,
+    0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1e, 0x1c, 0x02, 0x0c,
+    0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1f, 0x1c, 0x02, 0x1d, 0x1f, 0x1c,
+    0x02, 0x1d, 0x1f, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x1f,
+    0x1c, 0x02, 0x1d, 0x1f, 0x1c, 0x02, 0x1d, 0x20, 0x1c, 0x02, 0x1d, 0x20, 0x1c, 0x02, 0x1d, 0x20,
+    0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x20, 0x1c, 0x02, 0x1d,
+    0x20, 0x1c, 0x02, 0x1d, 0x21, 0x1c, 0x02, 0x1d, 0x21, 0x1c, 0x02, 0x1d, 0x21, 0x1c, 0x02, 0x0b,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x21, 0x1c, 0x02, 0x1d, 0x21, 0x1c, 0x02,
+    0x1d, 0x22, 0x7a, 0x01, 0x1d, 0x22, 0x7a, 0x01, 0x1d, 0x22, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x22, 0x7a, 0x01, 0x1d, 0x22, 0x7a, 0x01, 0x1d, 0x23, 0x7a,
+    0x01, 0x1d, 0x23, 0x7a, 0x01, 0x1d, 0x23, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0x7a, 0x01, 0x1d, 0x23, 0x7a, 0x01, 0x1d, 0x23, 0x7a, 0x01, 0x1d, 0x24, 0x7a, 0x01, 0x1d, 0x24,
+    0x7a, 0x01, 0x1d, 0x24, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d,
+    0x24, 0x7a, 0x01, 0x1d, 0x24, 0x7a, 0x01, 0x1d, 0x25, 0x7a, 0x01, 0x1d, 0x25, 0x7a, 0x01, 0x1d,
+    0x25, 0x7a, 0x01, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x25, 0x7a, 0x01,
+    0x1d, 0x25, 0x7a, 0x01, 0x1d, 0x26, 0x7a, 0x01, 0x1d, 0x26, 0x7a, 0x01, 0x1d, 0x26, 0x7a, 0x01,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x26, 0x7a, 0x01, 0x1d, 0x26, 0x7a,
+    0x01, 0x1d, 0x27, 0x7a, 0x01, 0x1d, 0x27, 0x7a, 0x01, 0x1d, 0x27, 0x7a, 0x01, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x7a, 0x01, 0x1d, 0x27, 0x7a, 0x01, 0x1d, 0x27, 0x7a, 0x01, 0x2c, 0x2e,
+    0x04, 0x54, 0x18, 0x2c, 0x2e, 0x04, 0x54, 0x18, 0x2c, 0x2e, 0x04, 0x54, 0x18, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x54, 0x18, 0x2c, 0x2e, 0x04, 0x54, 0x18, 0x2c, 0x2e, 0x04, 0x54, 0x18,
+    0x13, 0x2f, 0x6c, 0x00, 0x06, 0xe4, 0x0f, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x54,
+    0x18, 0x1d, 0x30, 0x2e, 0x02, 0x1d, 0x30, 0x2e, 0x02, 0x1d, 0x30, 0x2e, 0x02, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x2e, 0x02, 0x1d, 0x30, 0x2e, 0x02, 0x1d, 0x30, 0x2e, 0x02, 0x1d, 0x31,
+    0x2e, 0x02, 0x1d, 0x31, 0x2e, 0x02, 0x1d, 0x31, 0x2e, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0x2e, 0x02, 0x1d, 0x31, 0x2e, 0x02, 0x1d, 0x31, 0x2e, 0x02, 0x1d, 0x32, 0x2e, 0x02, 0x1d,
+    0x32, 0x2e, 0x02, 0x1d, 0x32, 0x2e, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x2e, 0x02,
+    0x1d, 0x32, 0x2e, 0x02, 0x1d, 0x32, 0x2e, 0x02, 0x1d, 0x33, 0x3e, 0x07, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x0b, 0x3e, 0x07, 0x1d, 0x34, 0x3e, 0x07, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12,
+    0x00, 0x0b, 0x3e, 0x07, 0x1d, 0x35, 0x3e, 0x07, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b,
+    0x3e, 0x07, 0x1d, 0x36, 0x1c, 0x02, 0x1d, 0x36, 0x1c, 0x02, 0x1d, 0x36, 0x1c, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x36, 0x1c, 0x02, 0x1d, 0x36, 0x1c, 0x02, 0x1d,
+    0x37, 0x1c, 0x02, 0x1d, 0x37, 0x1c, 0x02, 0x1d, 0x37, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x37, 0x1c, 0x02, 0x1d, 0x37, 0x1c, 0x02, 0x1d, 0x38, 0x1c, 0x02,
+    0x1d, 0x38, 0x1c, 0x02, 0x1d, 0x38, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c,
+    0x02, 0x1d, 0x38, 0x1c, 0x02, 0x1d, 0x38, 0x1c, 0x02, 0x1d, 0x39, 0x1c, 0x02, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x3a, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0,
+    0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x3b, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00,
+    0x0b, 0x1c, 0x02, 0x1d, 0x3c, 0x1c, 0x02, 0x1d, 0x3c, 0x1c, 0x02, 0x1d, 0x3c, 0x1c, 0x02, 0x0b,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x3c, 0x1c, 0x02, 0x1d, 0x3c, 0x1c, 0x02,
+    0x1d, 0x3d, 0x1c, 0x02, 0x1d, 0x3d, 0x1c, 0x02, 0x1d, 0x3d, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x3d, 0x1c, 0x02, 0x1d, 0x3d, 0x1c, 0x02, 0x1d, 0x3e, 0x1c,
+    0x02, 0x1d, 0x3e, 0x1c, 0x02, 0x1d, 0x3e, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0x1c, 0x02, 0x1d, 0x3e, 0x1c, 0x02, 0x1d, 0x3e, 0x1c, 0x02, 0x1d, 0x3f, 0x1c, 0x02, 0x0c, 0x12,
+    0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x40, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x41, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12,
+    0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x46, 0x1c, 0x02, 0x1d, 0x46, 0x1c, 0x02, 0x1d, 0x46, 0x1c, 0x02,
+    0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x46, 0x1c, 0x02, 0x1d, 0x46, 0x1c,
+    0x02, 0x1d, 0x47, 0x1c, 0x02, 0x1d, 0x47, 0x1c, 0x02, 0x1d, 0x47, 0x1c, 0x02, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x47, 0x1c, 0x02, 0x1d, 0x47, 0x1c, 0x02, 0x1d, 0x48,
+    0x1c, 0x02, 0x1d, 0x48, 0x1c, 0x02, 0x1d, 0x48, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0x1c, 0x02, 0x1d, 0x48, 0x1c, 0x02, 0x1d, 0x48, 0x1c, 0x02, 0x1d, 0x49, 0x1c, 0x02, 0x0c,
+    0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4a, 0x1c, 0x02, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4b, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0,
+    0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4c, 0x1c, 0x02, 0x1d, 0x4c, 0x1c, 0x02, 0x1d, 0x4c, 0x1c,
+    0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4c, 0x1c, 0x02, 0x1d, 0x4c,
+    0x1c, 0x02, 0x1d, 0x4d, 0x1c, 0x02, 0x1d, 0x4d, 0x1c, 0x02, 0x1d, 0x4d, 0x1c, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4d, 0x1c, 0x02, 0x1d, 0x4d, 0x1c, 0x02, 0x1d,
+    0x4e, 0x1c, 0x02, 0x1d, 0x4e, 0x1c, 0x02, 0x1d, 0x4e, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x4e, 0x1c, 0x02, 0x1d, 0x4e, 0x1c, 0x02, 0x1d, 0x4f, 0x1c, 0x02,
+    0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x50, 0x1c, 0x02, 0x0c, 0x12,
+    0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x51, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x52, 0x1c, 0x02, 0x1d, 0x52, 0x1c, 0x02, 0x1d, 0x52,
+    0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x52, 0x1c, 0x02, 0x1d,
+    0x52, 0x1c, 0x02, 0x1d, 0x53, 0x1c, 0x02, 0x1d, 0x53, 0x1c, 0x02, 0x1d, 0x53, 0x1c, 0x02, 0x0b,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x53, 0x1c, 0x02, 0x1d, 0x53, 0x1c, 0x02,
+    0x1d, 0x54, 0x1c, 0x02, 0x1d, 0x54, 0x1c, 0x02, 0x1d, 0x54, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x54, 0x1c, 0x02, 0x1d, 0x54, 0x1c, 0x02, 0x1d, 0x55, 0x1c,
+    0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x56, 0x1c, 0x02, 0x0c,
+    0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0x57, 0x1c, 0x02, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x40, 0x5c, 0x04, 0x44, 0xb8, 0x9a, 0x26, 0x31, 0x15,
+    0x0d, 0x5c, 0x0c, 0xdd, 0x62, 0x20, 0x01, 0x5c, 0x04, 0x44, 0xbc, 0xe2, 0x26, 0x07, 0x12, 0x00,
+    0x12, 0xc0, 0xe2, 0x26, 0x07, 0x12, 0x00, 0x14, 0xc4, 0x36, 0x00, 0x00, 0x58, 0x29, 0x15, 0x2c,
+    0x12, 0x00, 0x00, 0x36, 0x00, 0x0a, 0x12, 0x00, 0x00, 0x36, 0x00, 0x02, 0x12, 0x00, 0x42, 0x5d,
+    0x04, 0x44, 0xc8, 0xc2, 0x01, 0x03, 0x48, 0x00, 0x52, 0x00, 0x5d, 0x04, 0x44, 0xcc, 0xc2, 0x01,
+    0x07, 0x12, 0x00, 0x12, 0xd0, 0xc2, 0x01, 0x07, 0x12, 0x00, 0x14, 0xd4, 0x36, 0x00, 0x00, 0x48,
+    0x00, 0x15, 0x2a, 0x12, 0x00, 0x00, 0x36, 0x00, 0x0a, 0x12, 0x00, 0x00, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x4a, 0x5e, 0x04, 0x44, 0xd8, 0xd8, 0x00, 0x4a, 0x5e, 0x04, 0x44, 0xdc, 0xd8, 0x00, 0x4a,
+    0x5e, 0x04, 0x44, 0xe0, 0xd8, 0x00, 0x48, 0x5e, 0x04, 0x44, 0xe4, 0xd8, 0x00, 0x15, 0x2b, 0x12,
+    0x00, 0x04, 0xd8, 0x00, 0x06, 0x12, 0x00, 0x04, 0xd8, 0x00, 0x33, 0x2b, 0x01, 0x5f, 0x44, 0x01,
+    0x30, 0x1a, 0x0d, 0x6c, 0x48, 0x00, 0x20, 0x01, 0x20, 0x12, 0x00, 0x14, 0xe8, 0x12, 0x00, 0x00,
+    0x84, 0x54, 0x33, 0x24, 0x01, 0x60, 0xfc, 0x00, 0x32, 0x31, 0x0d, 0x80, 0x24, 0x00, 0x54, 0x00,
+    0x60, 0x04, 0x44, 0xec, 0x12, 0x00, 0x00, 0x24, 0x00, 0x33, 0x22, 0x00, 0x61, 0xb4, 0x00, 0x06,
+    0x48, 0x00, 0x48, 0x61, 0x04, 0x44, 0xf0, 0x48, 0x00, 0xf0, 0x09, 0x23, 0x01, 0x66, 0x04, 0x33,
+    0x9b, 0x16, 0x00, 0x00, 0x50, 0x1d, 0x0d, 0x90, 0x04, 0x0c, 0x10, 0x20, 0x1c, 0x44, 0x00, 0x66,
+    0x04, 0x33, 0x9e, 0x12, 0x00, 0x18, 0x1f, 0x12, 0x00, 0x10, 0xa1, 0x12, 0x00, 0x15, 0x20, 0x12,
+    0x00, 0x48, 0x67, 0x04, 0x33, 0xa4, 0x36, 0x00, 0x10, 0x43, 0x12, 0x00, 0x18, 0xa7, 0x36, 0x00,
+    0x01, 0x12, 0x00, 0x18, 0xaa, 0x36, 0x00, 0xe2, 0x43, 0x00, 0x68, 0x04, 0x22, 0x6a, 0x1e, 0x00,
+    0x00, 0x50, 0x23, 0x0d, 0x94, 0x00, 0x48, 0x00, 0x48, 0x69, 0x04, 0x22, 0x6c, 0x12, 0x00, 0x6a,
+    0x43, 0x00, 0x6c, 0x04, 0x22, 0x6e, 0x24, 0x00, 0x1d, 0x6d, 0x24, 0x00, 0x1d, 0x6e, 0x48, 0x00,
+    0x1d, 0x6f, 0x24, 0x00, 0x1d, 0x70, 0x48, 0x00, 0x1d, 0x71, 0x24, 0x00, 0x1d, 0x72, 0xfc, 0x00,
+    0x4a, 0x72, 0x04, 0x33, 0xad, 0xfc, 0x00, 0x4a, 0x72, 0x04, 0x33, 0xb0, 0xfc, 0x00, 0x1d, 0x73,
+    0xfc, 0x00, 0x4a, 0x73, 0x04, 0x33, 0xb3, 0xfc, 0x00, 0x4a, 0x73, 0x04, 0x33, 0xb6, 0xfc, 0x00,
+    0x22, 0x74, 0x04, 0x82, 0x2c, 0x02, 0x02, 0x04, 0x00, 0x5e, 0x2c, 0x21, 0x74, 0x04, 0x3a, 0x2c,
+    0x03, 0x96, 0x27, 0x00, 0xd6, 0x29, 0x21, 0x74, 0x04, 0x3a, 0x2c, 0x03, 0x96, 0x27, 0x03, 0x12,
+    0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x00, 0xda, 0x65, 0x03, 0x96, 0x27, 0x00, 0xb8, 0x2c,
+    0x40, 0x74, 0x04, 0x33, 0x04, 0x12, 0x00, 0x02, 0x38, 0x04, 0x03, 0x12, 0x00, 0x01, 0xdc, 0x2c,
+    0x02, 0x38, 0x04, 0x00, 0x12, 0x00, 0x55, 0x75, 0x04, 0x33, 0x0c, 0x0a, 0xfe, 0x04, 0x00, 0x7e,
+    0x00, 0x40, 0x75, 0x04, 0x33, 0x10, 0x12, 0x00, 0x06, 0x84, 0x30, 0x40, 0x75, 0x04, 0x33, 0x14,
+    0x12, 0x00, 0x06, 0x84, 0x30, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x14, 0x18, 0x36, 0x00, 0x02,
+    0x60, 0x30, 0x44, 0x75, 0x04, 0x33, 0x1c, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x20, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x22, 0x76, 0x04, 0x48, 0x2d, 0x06, 0xfc, 0x00, 0x21, 0x76, 0x04, 0xca, 0x2c,
+    0x07, 0xfc, 0x00, 0x21, 0x76, 0x04, 0xca, 0x2c, 0x07, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x18, 0x30, 0xfc, 0x00, 0x10, 0xab, 0x12, 0x00, 0x18, 0x34, 0xfc, 0x00, 0x01, 0x12, 0x00,
+    0x01, 0xa2, 0x2d, 0x04, 0xfc, 0x00, 0x4c, 0xab, 0x00, 0x77, 0x04, 0x1c, 0x2f, 0x0c, 0x12, 0x00,
+    0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x2f, 0x2c, 0x78, 0x04, 0x1c, 0x2f, 0x0c, 0x12, 0x00, 0x10,
+    0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x2f, 0x2c, 0x79, 0x04, 0x1c, 0x2f, 0x0c, 0x12, 0x00, 0x10, 0xb8,
+    0x12, 0x00, 0x0b, 0x1c, 0x2f, 0x3b, 0x7a, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7a, 0x04, 0x44, 0x1c,
+    0x02, 0x3b, 0x7a, 0x04, 0x44, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02,
+    0x3b, 0x7a, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7a, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7b, 0x04, 0x44,
+    0x1c, 0x02, 0x3b, 0x7b, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7b, 0x04, 0x44, 0x1c, 0x02, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x3b, 0x7b, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7b, 0x04,
+    0x44, 0x1c, 0x02, 0x3b, 0x7c, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7c, 0x04, 0x44, 0x1c, 0x02, 0x3b,
+    0x7c, 0x04, 0x44, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x3b, 0x7c,
+    0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7c, 0x04, 0x44, 0x1c, 0x02, 0x3b, 0x7d, 0x04, 0x55, 0x1c, 0x02,
+    0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x3b, 0x7e, 0x04, 0x55, 0x1c, 0x02,
+    0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x3b, 0x7f, 0x04, 0x55, 0x1c, 0x02,
+    0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x30, 0x80, 0x04, 0x55, 0xc0, 0x88,
+    0x25, 0x52, 0x32, 0x14, 0x31, 0x40, 0x80, 0x04, 0x55, 0xcf, 0x12, 0x00, 0x18, 0x33, 0x12, 0x00,
+    0x10, 0xd4, 0x12, 0x00, 0x18, 0x34, 0x12, 0x00, 0x14, 0xd9, 0x36, 0x00, 0x02, 0x36, 0x09, 0x44,
+    0x80, 0x04, 0x55, 0xde, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x3f, 0xbf, 0x01, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x1d, 0x81, 0x6c, 0x00, 0x1d, 0x81, 0x6c, 0x00, 0x1d, 0x81, 0x6c, 0x00, 0x1d, 0x81,
+    0x6c, 0x00, 0x1d, 0x81, 0x6c, 0x00, 0x1d, 0x81, 0x6c, 0x00, 0x59, 0x82, 0x04, 0x44, 0x60, 0x03,
+    0x6c, 0x00, 0x30, 0x82, 0x04, 0x44, 0x9b, 0xc2, 0x07, 0x6c, 0x00, 0x40, 0x82, 0x04, 0x44, 0x6a,
+    0x12, 0x00, 0x06, 0x6c, 0x00, 0x44, 0x82, 0x04, 0x44, 0x6f, 0x36, 0x00, 0x00, 0x74, 0x34, 0x10,
+    0xa1, 0x12, 0x00, 0x14, 0x74, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x79, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x42, 0x8d, 0x04, 0x55, 0xe8, 0xb8, 0x2c, 0x00, 0x40, 0x2f, 0x00, 0x48, 0x00, 0x42, 0x8d,
+    0x04, 0x55, 0xed, 0xb8, 0x2c, 0x07, 0x12, 0x00, 0x14, 0xf2, 0x24, 0x00, 0x50, 0x01, 0x10, 0x04,
+    0x24, 0xa3, 0x12, 0x00, 0x14, 0xf7, 0x24, 0x00, 0x02, 0x12, 0x00, 0x40, 0x8e, 0x04, 0x55, 0xfc,
+    0x12, 0x00, 0x02, 0xbe, 0x2f, 0x00, 0x36, 0x00, 0x55, 0x8e, 0x04, 0x55, 0x01, 0x03, 0xac, 0x2f,
+    0x70, 0x04, 0x28, 0xa3, 0x00, 0x8f, 0x04, 0x55, 0x1c, 0xdc, 0x03, 0xf4, 0x2f, 0x00, 0x24, 0x00,
+    0x44, 0x8f, 0x04, 0x55, 0x0b, 0x24, 0x00, 0x05, 0x12, 0x00, 0x00, 0xa4, 0xcd, 0x03, 0xf4, 0x2f,
+    0x30, 0x04, 0x20, 0xa4, 0x12, 0x00, 0x17, 0x15, 0x48, 0x00, 0x70, 0x20, 0xa4, 0x00, 0x90, 0x04,
+    0x55, 0x1a, 0x12, 0x00, 0x06, 0xa2, 0x00, 0x44, 0x90, 0x04, 0x55, 0x1f, 0x12, 0x00, 0x00, 0x90,
+    0x00, 0x60, 0xa4, 0x00, 0x92, 0x04, 0x55, 0x24, 0x12, 0x00, 0x06, 0xd8, 0x00, 0x4a, 0x92, 0x04,
+    0x55, 0x29, 0x36, 0x00, 0x44, 0x92, 0x04, 0x55, 0x2e, 0x24, 0x00, 0x02, 0xc6, 0x00, 0x48, 0x92,
+    0x04, 0x55, 0x33, 0x48, 0x00, 0x6a, 0xa3, 0x00, 0x93, 0x04, 0x55, 0x38, 0xa2, 0x00, 0x4a, 0x93,
+    0x04, 0x55, 0x3d, 0xd8, 0x00, 0x4a, 0x94, 0x04, 0x55, 0x42, 0xd8, 0x00, 0x4a, 0x94, 0x04, 0x55,
+    0x47, 0x36, 0x00, 0x4a, 0x94, 0x04, 0x55, 0x4c, 0xd8, 0x00, 0x4a, 0x94, 0x04, 0x55, 0x51, 0xd8,
+    0x00, 0x4a, 0x95, 0x04, 0x55, 0x56, 0xa2, 0x00, 0x4a, 0x95, 0x04, 0x55, 0x5b, 0xd8, 0x00, 0x53,
+    0x96, 0x04, 0x44, 0x50, 0x07, 0xba, 0x30, 0x00, 0x24, 0x00, 0x10, 0x60, 0x12, 0x00, 0x14, 0xf0,
+    0x12, 0x00, 0x8a, 0x01, 0x10, 0x04, 0x14, 0x63, 0x00, 0xa5, 0x04, 0x6c, 0x36, 0x10, 0xb8, 0x12,
+    0x00, 0x0b, 0x6c, 0x36, 0x2c, 0xa5, 0x04, 0x6c, 0x36, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0x6c, 0x36, 0x2c, 0xa5, 0x04, 0x6c, 0x36, 0x2c, 0xa5, 0x04, 0x6c, 0x36, 0x2a, 0xa6, 0x04, 0x6c,
+    0x36, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x6c, 0x36, 0x2c, 0xa6, 0x04, 0x6c, 0x36, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0x6c, 0x36, 0x2c, 0xa6, 0x04, 0x6c, 0x36, 0x2c, 0xa6, 0x04, 0x6c, 0x36,
+    0x2a, 0xa7, 0x04, 0x6c, 0x36, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x6c, 0x36, 0x2c, 0xa7, 0x04, 0x6c,
+    0x36, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x6c, 0x36, 0x2c, 0xa7, 0x04, 0x6c, 0x36, 0x2c,
+    0xa7, 0x04, 0x6c, 0x36, 0x1d, 0xa8, 0x50, 0x07, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b,
+    0x34, 0x05, 0x1d, 0xa9, 0x50, 0x07, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x34, 0x05,
+    0x1d, 0xaa, 0x50, 0x07, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x34, 0x05, 0x1d, 0xae,
+    0x1c, 0x02, 0x1d, 0xae, 0x1c, 0x02, 0x1d, 0xae, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x0b, 0x1c, 0x02, 0x1d, 0xae, 0x1c, 0x02, 0x1d, 0xae, 0x1c, 0x02, 0x1d, 0xaf, 0x1c, 0x02, 0x1d,
+    0xaf, 0x1c, 0x02, 0x1d, 0xaf, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02,
+    0x1d, 0xaf, 0x1c, 0x02, 0x1d, 0xaf, 0x1c, 0x02, 0x1d, 0xb0, 0x1c, 0x02, 0x1d, 0xb0, 0x1c, 0x02,
+    0x1d, 0xb0, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xb0, 0x1c,
+    0x02, 0x1d, 0xb0, 0x1c, 0x02, 0x1d, 0xb1, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00,
+    0x0b, 0x1c, 0x02, 0x1d, 0xb2, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c,
+    0x02, 0x1d, 0xb3, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x12,
+    0xb7, 0x76, 0x0b, 0x43, 0x40, 0x1d, 0x0d, 0x44, 0x3a, 0x08, 0x12, 0xb7, 0x76, 0x0b, 0x28, 0x40,
+    0x1f, 0x12, 0x00, 0x00, 0x5a, 0x09, 0x28, 0x40, 0x20, 0x12, 0x00, 0x00, 0xb0, 0x37, 0x01, 0x36,
+    0x00, 0x50, 0x01, 0x10, 0x00, 0x0c, 0xa4, 0x12, 0x00, 0x00, 0xb0, 0x37, 0x01, 0x36, 0x00, 0x05,
+    0x12, 0x00, 0x00, 0xb0, 0x37, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x28, 0x62, 0x0a, 0x6c,
+    0x00, 0x00, 0x28, 0x62, 0x0a, 0x6c, 0x00, 0x00, 0x28, 0x62, 0x0a, 0x6c, 0x00, 0x00, 0x28, 0x62,
+    0x05, 0x6c, 0x00, 0x10, 0x24, 0x12, 0x00, 0x00, 0x28, 0x62, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00,
+    0x00, 0x28, 0x62, 0x05, 0x6c, 0x00, 0x32, 0x24, 0x00, 0xb8, 0x52, 0x0b, 0x07, 0x6c, 0x00, 0x12,
+    0xb8, 0x52, 0x0b, 0x07, 0x6c, 0x00, 0x12, 0xb8, 0x52, 0x0b, 0x07, 0x6c, 0x00, 0x21, 0xb8, 0x04,
+    0x1c, 0x38, 0x05, 0x6c, 0x00, 0x10, 0xa3, 0x12, 0x00, 0x00, 0x1c, 0x38, 0x05, 0x6c, 0x00, 0x01,
+    0x12, 0x00, 0x00, 0x1c, 0x38, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0x94, 0x62, 0x0a, 0x6c,
+    0x00, 0x00, 0x94, 0x62, 0x0a, 0x6c, 0x00, 0x00, 0x94, 0x62, 0x0a, 0x6c, 0x00, 0x00, 0x94, 0x62,
+    0x05, 0x6c, 0x00, 0x10, 0x23, 0x12, 0x00, 0x00, 0x94, 0x62, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00,
+    0x00, 0x94, 0x62, 0x05, 0x6c, 0x00, 0xa6, 0x23, 0x00, 0xb9, 0x04, 0x22, 0xc4, 0x1d, 0x00, 0x00,
+    0x40, 0xd8, 0x36, 0x54, 0xb9, 0x04, 0x22, 0xce, 0x1b, 0x12, 0x00, 0x01, 0xd8, 0x36, 0x0f, 0x24,
+    0x00, 0x14, 0x2c, 0x3a, 0x0e, 0x24, 0x00, 0x2f, 0x66, 0x0f, 0x24, 0x00, 0x1e, 0x15, 0xba, 0x40,
+    0x02, 0x13, 0x68, 0xd8, 0x00, 0x15, 0xba, 0x40, 0x02, 0x07, 0x12, 0x00, 0x03, 0x40, 0x02, 0x07,
+    0x12, 0x00, 0x12, 0xb9, 0x68, 0x01, 0x10, 0x68, 0x48, 0x00, 0x20, 0x3c, 0xa4, 0x12, 0x00, 0x03,
+    0x40, 0x02, 0x07, 0x12, 0x00, 0x03, 0x40, 0x02, 0x04, 0x12, 0x00, 0x44, 0xbc, 0x04, 0x33, 0xbc,
+    0x9e, 0x01, 0x02, 0x48, 0x00, 0x44, 0xbc, 0x04, 0x33, 0xbf, 0x9e, 0x01, 0x05, 0x12, 0x00, 0x14,
+    0xc2, 0x9e, 0x01, 0x05, 0x12, 0x00, 0x1a, 0xc5, 0xd4, 0x01, 0x4a, 0xbc, 0x04, 0x33, 0xc8, 0xd4,
+    0x01, 0x4a, 0xbc, 0x04, 0x33, 0xcb, 0xd4, 0x01, 0x4d, 0xbc, 0x04, 0x33, 0xce, 0x6c, 0x00, 0x1d,
+    0xd1, 0x6c, 0x00, 0x1d, 0xd4, 0x6c, 0x00, 0x18, 0xd7, 0x6c, 0x00, 0x10, 0x23, 0x12, 0x00, 0x18,
+    0xda, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0xdd, 0x6c, 0x00, 0x6a, 0x23, 0x00, 0xbd, 0x04, 0x33,
+    0xe0, 0x6c, 0x00, 0x4a, 0xbd, 0x04, 0x33, 0xe3, 0x6c, 0x00, 0x4a, 0xbd, 0x04, 0x33, 0xe6, 0x6c,
+    0x00, 0x4a, 0xbd, 0x04, 0x33, 0xe9, 0x84, 0x03, 0x4a, 0xbd, 0x04, 0x33, 0xec, 0x84, 0x03, 0x4a,
+    0xbd, 0x04, 0x33, 0xef, 0x84, 0x03, 0x4d, 0xbd, 0x04, 0x33, 0xf2, 0x6c, 0x00, 0x1d, 0xf5, 0x6c,
+    0x00, 0x1d, 0xf8, 0x6c, 0x00, 0x18, 0xfb, 0x6c, 0x00, 0x10, 0x24, 0x12, 0x00, 0x18, 0xfe, 0x6c,
+    0x00, 0x01, 0x12, 0x00, 0x29, 0x01, 0x17, 0x84, 0x03, 0x82, 0xbf, 0x04, 0x33, 0xfc, 0x0b, 0x00,
+    0x00, 0x40, 0x6c, 0x3f, 0x00, 0x48, 0x00, 0x30, 0xbf, 0x04, 0x33, 0x27, 0x75, 0x12, 0x40, 0x6c,
+    0x3f, 0x03, 0x12, 0x00, 0x10, 0x04, 0x12, 0x00, 0x02, 0x6c, 0x3f, 0x03, 0x12, 0x00, 0x10, 0x08,
+    0x12, 0x00, 0x02, 0x6c, 0x3f, 0x30, 0x00, 0x0c, 0xa2, 0x12, 0x00, 0x14, 0x0c, 0x36, 0x00, 0x05,
+    0x12, 0x00, 0x14, 0x10, 0x36, 0x00, 0x05, 0x12, 0x00, 0x10, 0x04, 0x7e, 0x00, 0x09, 0x6c, 0x00,
+    0x10, 0x07, 0x12, 0x00, 0x09, 0x6c, 0x00, 0x10, 0x0a, 0x12, 0x00, 0x09, 0x6c, 0x00, 0x14, 0x0d,
+    0x36, 0x00, 0x00, 0x48, 0x00, 0x11, 0x22, 0x5a, 0x00, 0x04, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14,
+    0x13, 0x36, 0x00, 0x02, 0x12, 0x00, 0x21, 0xc0, 0x04, 0x3a, 0x6b, 0x16, 0x40, 0x78, 0x3c, 0x40,
+    0xc0, 0x04, 0x33, 0xe8, 0x12, 0x00, 0x06, 0x78, 0x3c, 0x40, 0xc0, 0x04, 0x33, 0xec, 0x12, 0x00,
+    0x06, 0x78, 0x3c, 0x40, 0xc0, 0x04, 0x33, 0x16, 0x48, 0x00, 0x03, 0x78, 0x3c, 0x20, 0x0c, 0xa3,
+    0x12, 0x00, 0x10, 0x19, 0x12, 0x00, 0x03, 0x78, 0x3c, 0x02, 0x12, 0x00, 0x12, 0x1c, 0x44, 0x01,
+    0x07, 0x12, 0x00, 0x14, 0x1f, 0x36, 0x00, 0x05, 0x48, 0x00, 0x14, 0x22, 0x36, 0x00, 0x05, 0x12,
+    0x00, 0x14, 0x25, 0x36, 0x00, 0x05, 0x12, 0x00, 0x18, 0x28, 0x6c, 0x00, 0x10, 0x23, 0x12, 0x00,
+    0x18, 0x2b, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0x2e, 0x6c, 0x00, 0x6a, 0x23, 0x00, 0xc1, 0x04,
+    0x33, 0x31, 0x6c, 0x00, 0x4a, 0xc1, 0x04, 0x33, 0x74, 0xd8, 0x00, 0x4a, 0xc1, 0x04, 0x33, 0x78,
+    0xd8, 0x00, 0x48, 0xc1, 0x04, 0x33, 0x34, 0x6c, 0x00, 0x10, 0xa4, 0x12, 0x00, 0x18, 0x37, 0x6c,
+    0x00, 0x01, 0x12, 0x00, 0x18, 0x3a, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x1d, 0x3d, 0x6c, 0x00, 0x1a,
+    0x40, 0xd8, 0x00, 0x4a, 0xc1, 0x04, 0x33, 0x43, 0xd8, 0x00, 0x48, 0xc1, 0x04, 0x33, 0x46, 0x6c,
+    0x00, 0x10, 0x24, 0x12, 0x00, 0x18, 0x49, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0x4c, 0x6c, 0x00,
+    0x6a, 0x24, 0x00, 0xc2, 0x04, 0x33, 0x4f, 0x1c, 0x02, 0x4a, 0xc2, 0x04, 0x33, 0x52, 0x1c, 0x02,
+    0x4a, 0xc2, 0x04, 0x33, 0x55, 0x1c, 0x02, 0x48, 0xc2, 0x04, 0x33, 0x58, 0x1c, 0x02, 0x10, 0xa1,
+    0x12, 0x00, 0x18, 0x5b, 0x1c, 0x02, 0x01, 0x12, 0x00, 0x18, 0x5e, 0x1c, 0x02, 0x01, 0x12, 0x00,
+    0x1d, 0x61, 0x6c, 0x00, 0x1d, 0x64, 0x6c, 0x00, 0x1d, 0x67, 0x6c, 0x00, 0x18, 0x6a, 0x6c, 0x00,
+    0x10, 0x21, 0x12, 0x00, 0x18, 0x6d, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0x70, 0x6c, 0x00, 0x71,
+    0x21, 0x00, 0xc3, 0x04, 0x33, 0x7b, 0x01, 0x8e, 0x05, 0x13, 0x78, 0x18, 0x0c, 0x55, 0xc4, 0x04,
+    0x33, 0xe2, 0x11, 0xa0, 0x05, 0x85, 0x04, 0x10, 0x64, 0x00, 0xc4, 0x04, 0x22, 0xce, 0x0c, 0x06,
+    0x97, 0x10, 0x00, 0x10, 0x64, 0x00, 0xc5, 0x04, 0x33, 0xe5, 0x24, 0x00, 0x77, 0x20, 0x63, 0x00,
+    0xc5, 0x04, 0x22, 0xec, 0x1e, 0x06, 0x72, 0x20, 0x63, 0x00, 0xc6, 0x04, 0x33, 0xe8, 0x24, 0x00,
+    0x04, 0x5a, 0x00, 0x59, 0xc7, 0x04, 0x33, 0xa4, 0x07, 0x5a, 0x00, 0x59, 0xc7, 0x04, 0x22, 0x14,
+    0x1c, 0x5a, 0x00, 0x4a, 0xc8, 0x04, 0x33, 0xeb, 0x5a, 0x00, 0x4a, 0xc8, 0x04, 0x22, 0xee, 0x5a,
+    0x00, 0x40, 0xcf, 0x04, 0x22, 0xe4, 0x12, 0x00, 0x31, 0x1d, 0x0d, 0x48, 0xc6, 0x00, 0x01, 0x12,
+    0x00, 0x10, 0xcc, 0xa2, 0x00, 0x18, 0x1f, 0x12, 0x00, 0x21, 0x70, 0x1e, 0xc2, 0x01, 0x04, 0x12,
+    0x00, 0x59, 0xd0, 0x04, 0x22, 0xa4, 0x0d, 0x36, 0x00, 0x4a, 0xd0, 0x04, 0x22, 0xba, 0x36, 0x00,
+    0x4a, 0xd0, 0x04, 0x22, 0x72, 0x36, 0x00, 0x48, 0xd1, 0x04, 0x22, 0xc2, 0x6c, 0x00, 0x10, 0x64,
+    0x12, 0x00, 0x18, 0xbe, 0x36, 0x00, 0x01, 0x12, 0x00, 0x18, 0x74, 0x36, 0x00, 0x6a, 0x64, 0x00,
+    0xd2, 0x04, 0x22, 0xc6, 0xa2, 0x00, 0x4a, 0xd2, 0x04, 0x22, 0xc2, 0x6c, 0x00, 0x4a, 0xd2, 0x04,
+    0x22, 0x76, 0x6c, 0x00, 0x40, 0xd3, 0x04, 0x22, 0x78, 0x12, 0x00, 0x06, 0x2c, 0x07, 0x45, 0xd3,
+    0x04, 0x22, 0x06, 0x12, 0x00, 0x01, 0x20, 0x01, 0x4d, 0xd3, 0x04, 0x22, 0x7a, 0x24, 0x00, 0x1d,
+    0x7c, 0x24, 0x00, 0x14, 0x01, 0x44, 0x01, 0x00, 0x1c, 0x02, 0x0f, 0x48, 0x00, 0x04, 0x14, 0x7e,
+    0x12, 0x00, 0x05, 0x24, 0x00, 0x0b, 0x48, 0x00, 0x12, 0xd4, 0x68, 0x0a, 0x21, 0x40, 0x22, 0x64,
+    0x4a, 0x00, 0x0e, 0x0a, 0x13, 0xd4, 0x74, 0x07, 0x00, 0x12, 0x00, 0x00, 0xec, 0x16, 0x10, 0xa4,
+    0x24, 0x00, 0x10, 0x3c, 0x00, 0x09, 0x09, 0x24, 0x00, 0x10, 0x73, 0x64, 0x02, 0x04, 0x24, 0x00,
+    0x32, 0x24, 0x00, 0xd5, 0x7a, 0x0a, 0x25, 0x40, 0x31, 0x24, 0x00, 0x40, 0xd5, 0x04, 0x33, 0x76,
+    0x24, 0x00, 0x00, 0x12, 0x00, 0x00, 0x24, 0x00, 0x10, 0xa2, 0x24, 0x00, 0x10, 0x40, 0x48, 0x00,
+    0x09, 0x24, 0x00, 0x18, 0x79, 0x24, 0x00, 0x35, 0x22, 0x00, 0xd6, 0x90, 0x09, 0x00, 0xf2, 0x73,
+    0x00, 0xf4, 0x02, 0x15, 0xd6, 0x90, 0x09, 0x07, 0x12, 0x00, 0x03, 0x90, 0x09, 0x07, 0x12, 0x00,
+    0x03, 0x90, 0x09, 0x00, 0xf2, 0x73, 0x00, 0x10, 0x05, 0x15, 0xd6, 0x90, 0x09, 0x07, 0x12, 0x00,
+    0x03, 0x90, 0x09, 0x04, 0x12, 0x00, 0x1d, 0xd7, 0x6c, 0x00, 0x1d, 0xd7, 0x6c, 0x00, 0x1d, 0xd7,
+    0x6c, 0x00, 0x1d, 0xd7, 0x6c, 0x00, 0x1d, 0xd7, 0x6c, 0x00, 0x1d, 0xd7, 0x6c, 0x00, 0x12, 0xd8,
+    0x64, 0x0b, 0x07, 0x44, 0x01, 0x21, 0xd8, 0x04, 0x02, 0x70, 0x05, 0x44, 0x01, 0x01, 0x24, 0x00,
+    0x1a, 0x44, 0x68, 0x01, 0x48, 0xd8, 0x04, 0x33, 0x7c, 0x68, 0x01, 0x35, 0x23, 0x00, 0xd9, 0x48,
+    0x09, 0x04, 0x14, 0x04, 0x15, 0xd9, 0x48, 0x09, 0x07, 0x12, 0x00, 0x03, 0x48, 0x09, 0x07, 0x12,
+    0x00, 0x03, 0x88, 0x0b, 0x04, 0x58, 0x05, 0x15, 0xd9, 0x48, 0x09, 0x07, 0x12, 0x00, 0x03, 0x48,
+    0x09, 0x07, 0x12, 0x00, 0x03, 0x88, 0x0b, 0x07, 0x48, 0x00, 0x03, 0x88, 0x0b, 0x07, 0x12, 0x00,
+    0x03, 0x88, 0x0b, 0x07, 0x12, 0x00, 0x03, 0x88, 0x0b, 0x04, 0x58, 0x05, 0x15, 0xd9, 0x88, 0x0b,
+    0x07, 0x12, 0x00, 0x03, 0x88, 0x0b, 0x04, 0x12, 0x00, 0x15, 0xda, 0x8c, 0x01, 0x04, 0x48, 0x00,
+    0x15, 0xda, 0x8c, 0x01, 0x07, 0x12, 0x00, 0x03, 0x8c, 0x01, 0x07, 0x12, 0x00, 0x03, 0x8c, 0x01,
+    0x04, 0x08, 0x07, 0x15, 0xda, 0x8c, 0x01, 0x07, 0x12, 0x00, 0x03, 0x8c, 0x01, 0x07, 0x12, 0x00,
+    0x03, 0x88, 0x0b, 0x07, 0x48, 0x00, 0x03, 0x88, 0x0b, 0x07, 0x12, 0x00, 0x03, 0x88, 0x0b, 0x07,
+    0x12, 0x00, 0x03, 0x88, 0x0b, 0x04, 0x08, 0x07, 0x15, 0xda, 0x88, 0x0b, 0x07, 0x12, 0x00, 0x03,
+    0x88, 0x0b, 0x04, 0x12, 0x00, 0x40, 0xdb, 0x04, 0x22, 0x80, 0x72, 0x03, 0x15, 0x2e, 0xcc, 0x03,
+    0x45, 0xdb, 0x04, 0x22, 0x82, 0x12, 0x00, 0x40, 0x10, 0x00, 0x10, 0x62, 0x12, 0x00, 0x1d, 0x84,
+    0x24, 0x00, 0x1a, 0x86, 0x24, 0x00, 0x1b, 0xe3, 0x9c, 0x0f, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x9c,
+    0x0f, 0x1d, 0xe3, 0x9c, 0x0f, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x9c, 0x0f, 0x1d, 0xe3,
+    0x9c, 0x0f, 0x1d, 0xe3, 0x9c, 0x0f, 0x1b, 0xe4, 0x9c, 0x0f, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x9c,
+    0x0f, 0x1d, 0xe4, 0x9c, 0x0f, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x9c, 0x0f, 0x1d, 0xe4,
+    0x9c, 0x0f, 0x1d, 0xe4, 0x9c, 0x0f, 0x1b, 0xe5, 0x9c, 0x0f, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x9c,
+    0x0f, 0x1d, 0xe5, 0x9c, 0x0f, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x9c, 0x0f, 0x1d, 0xe5,
+    0x9c, 0x0f, 0x1d, 0xe5, 0x9c, 0x0f, 0x1d, 0xe6, 0x9c, 0x0f, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12,
+    0x00, 0x0b, 0x9c, 0x0f, 0x1d, 0xe7, 0x9c, 0x0f, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b,
+    0x9c, 0x0f, 0x1d, 0xe8, 0x9c, 0x0f, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x9c, 0x0f,
+    0x12, 0xec, 0x90, 0x00, 0x07, 0x9a, 0x77, 0x12, 0xec, 0x0a, 0x02, 0x07, 0x9a, 0x77, 0x12, 0xec,
+    0x0a, 0x02, 0x07, 0x9a, 0x77, 0x12, 0xec, 0x0a, 0x02, 0x07, 0x06, 0x78, 0x12, 0xec, 0x0a, 0x02,
+    0x07, 0x06, 0x78, 0x12, 0xec, 0x0a, 0x02, 0x07, 0x06, 0x78, 0x12, 0xed, 0x90, 0x00, 0x07, 0x6c,
+    0x00, 0x12, 0xed, 0x7a, 0x01, 0x07, 0x6c, 0x00, 0x12, 0xed, 0x7a, 0x01, 0x07, 0x6c, 0x00, 0x12,
+    0xed, 0x7a, 0x01, 0x07, 0x06, 0x78, 0x12, 0xed, 0x7a, 0x01, 0x07, 0x06, 0x78, 0x12, 0xed, 0x7a,
+    0x01, 0x07, 0x06, 0x78, 0x91, 0xee, 0x04, 0x33, 0x7f, 0x17, 0x00, 0x00, 0x1a, 0x44, 0x18, 0x1e,
+    0x00, 0x5e, 0x08, 0x40, 0xee, 0x04, 0x33, 0x82, 0x12, 0x00, 0x18, 0x45, 0x12, 0x00, 0x10, 0x85,
+    0x12, 0x00, 0x18, 0x46, 0x12, 0x00, 0x14, 0x88, 0x36, 0x00, 0x00, 0x48, 0x00, 0x10, 0x6b, 0x12,
+    0x00, 0x14, 0x8b, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x8e, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a,
+    0xef, 0x04, 0x33, 0x91, 0x6c, 0x00, 0x4a, 0xef, 0x04, 0x33, 0x94, 0x6c, 0x00, 0x4a, 0xef, 0x04,
+    0x33, 0x97, 0x6c, 0x00, 0x48, 0xef, 0x04, 0x33, 0x9a, 0x6c, 0x00, 0x10, 0x6c, 0x12, 0x00, 0x18,
+    0x9d, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0xa0, 0x6c, 0x00, 0x50, 0x6c, 0x00, 0xf0, 0x04, 0x44,
+    0xaa, 0xed, 0x22, 0x14, 0x26, 0xea, 0x00, 0x4d, 0x18, 0xa3, 0x00, 0xf1, 0x12, 0x00, 0x55, 0xf2,
+    0x04, 0x33, 0xa3, 0x17, 0x80, 0x4c, 0x00, 0x80, 0x04, 0x40, 0xf2, 0x04, 0x33, 0xa6, 0x12, 0x00,
+    0x06, 0x20, 0x0a, 0x40, 0xf2, 0x04, 0x33, 0xa9, 0x12, 0x00, 0x06, 0x20, 0x0a, 0x44, 0xf2, 0x04,
+    0x33, 0xac, 0x36, 0x00, 0x02, 0x68, 0x0a, 0x44, 0xf2, 0x04, 0x33, 0xaf, 0x36, 0x00, 0x05, 0x12,
+    0x00, 0x14, 0xb2, 0x36, 0x00, 0x02, 0x12, 0x00, 0x40, 0xf3, 0x04, 0x33, 0xb5, 0x12, 0x00, 0x06,
+    0x10, 0x05, 0x40, 0xf3, 0x04, 0x33, 0xb8, 0x12, 0x00, 0x06, 0x10, 0x05, 0x40, 0xf3, 0x04, 0x33,
+    0xbb, 0x12, 0x00, 0x06, 0x10, 0x05, 0x44, 0xf3, 0x04, 0x33, 0xbe, 0x36, 0x00, 0x02, 0x16, 0x1a,
+    0x44, 0xf3, 0x04, 0x33, 0xc1, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xc4, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x12, 0xf4, 0xc4, 0x0e, 0x07, 0x6c, 0x00, 0x12, 0xf4, 0xc4, 0x0e, 0x07, 0x6c, 0x00, 0x12,
+    0xf4, 0xc4, 0x0e, 0x07, 0x6c, 0x00, 0x48, 0xf4, 0x04, 0x33, 0xc7, 0x6c, 0x00, 0x10, 0xac, 0x12,
+    0x00, 0x18, 0xca, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x18, 0xcd, 0x6c, 0x00, 0x6a, 0xac, 0x00, 0xf5,
+    0x04, 0x33, 0xd0, 0x44, 0x01, 0x4a, 0xf5, 0x04, 0x33, 0xd3, 0x44, 0x01, 0x4a, 0xf5, 0x04, 0x33,
+    0xd6, 0x44, 0x01, 0x48, 0xf5, 0x04, 0x33, 0xd9, 0x44, 0x01, 0x10, 0xa2, 0x12, 0x00, 0x18, 0xdc,
+    0x44, 0x01, 0x01, 0x12, 0x00, 0x18, 0xdf, 0x44, 0x01, 0x60, 0xa2, 0x00, 0xf6, 0x04, 0x44, 0x4c,
+    0x24, 0x1b, 0x15, 0x0d, 0xaa, 0x7c, 0x40, 0xf6, 0x04, 0x44, 0x50, 0x12, 0x00, 0x18, 0x0f, 0x12,
+    0x00, 0x10, 0x54, 0x12, 0x00, 0x18, 0x10, 0x12, 0x00, 0x14, 0x58, 0x36, 0x00, 0x02, 0xf4, 0x02,
+    0x44, 0xf6, 0x04, 0x44, 0x5c, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x60, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x4a, 0xf7, 0x04, 0x44, 0x64, 0x6c, 0x00, 0x4a, 0xf7, 0x04, 0x44, 0x68, 0x6c, 0x00, 0x4a,
+    0xf7, 0x04, 0x44, 0x6c, 0x6c, 0x00, 0x47, 0xf7, 0x04, 0x44, 0x70, 0x6c, 0x00, 0x20, 0x0c, 0xa2,
+    0x12, 0x00, 0x17, 0x74, 0x6c, 0x00, 0x02, 0x12, 0x00, 0x17, 0x78, 0x6c, 0x00, 0x7a, 0x0c, 0xa2,
+    0x00, 0x00, 0x05, 0x44, 0x7c, 0x6c, 0x00, 0x4a, 0x00, 0x05, 0x44, 0x80, 0x6c, 0x00, 0x4a, 0x00,
+    0x05, 0x44, 0x84, 0x6c, 0x00, 0x4a, 0x00, 0x05, 0x44, 0x88, 0xd8, 0x00, 0x4a, 0x00, 0x05, 0x44,
+    0x8c, 0xd8, 0x00, 0x4a, 0x00, 0x05, 0x44, 0x90, 0xd8, 0x00, 0x4a, 0x01, 0x05, 0x44, 0x94, 0x6c,
+    0x00, 0x4a, 0x01, 0x05, 0x44, 0x98, 0x6c, 0x00, 0x4a, 0x01, 0x05, 0x44, 0x9c, 0x6c, 0x00, 0x4a,
+    0x01, 0x05, 0x44, 0xa0, 0xd8, 0x00, 0x4a, 0x01, 0x05, 0x44, 0xa4, 0xd8, 0x00, 0x4a, 0x01, 0x05,
+    0x44, 0xa8, 0xd8, 0x00, 0x42, 0x03, 0x05, 0x44, 0xac, 0x36, 0x00, 0x04, 0xa4, 0x04, 0x42, 0x03,
+    0x05, 0x44, 0xb0, 0x36, 0x00, 0x07, 0x12, 0x00, 0x12, 0xb4, 0x36, 0x00, 0x07, 0x12, 0x00, 0x14,
+    0xb8, 0x36, 0x00, 0x02, 0x24, 0x1b, 0x44, 0x03, 0x05, 0x44, 0xbc, 0x36, 0x00, 0x05, 0x12, 0x00,
+    0x14, 0xc0, 0x36, 0x00, 0x02, 0x12, 0x00, 0x42, 0x04, 0x05, 0x44, 0xc4, 0x64, 0x1d, 0x04, 0x48,
+    0x00, 0x42, 0x04, 0x05, 0x44, 0xc8, 0x64, 0x1d, 0x07, 0x12, 0x00, 0x12, 0xcc, 0x64, 0x1d, 0x07,
+    0x12, 0x00, 0x14, 0xd0, 0x36, 0x00, 0x02, 0x20, 0x01, 0x44, 0x04, 0x05, 0x44, 0xd4, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x14, 0xd8, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x05, 0x05, 0x44, 0xdc, 0x6c,
+    0x00, 0x4a, 0x05, 0x05, 0x44, 0xe0, 0x6c, 0x00, 0x4a, 0x05, 0x05, 0x44, 0xe4, 0x6c, 0x00, 0x48,
+    0x05, 0x05, 0x44, 0xe8, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x18, 0xec, 0x6c, 0x00, 0x01, 0x12,
+    0x00, 0x18, 0xf0, 0x6c, 0x00, 0x3d, 0xac, 0x00, 0x06, 0x44, 0x01, 0x1d, 0x06, 0x44, 0x01, 0x1d,
+    0x06, 0x44, 0x01, 0x1d, 0x06, 0x44, 0x01, 0x1d, 0x06, 0x44, 0x01, 0x1d, 0x06, 0x44, 0x01, 0x4a,
+    0x09, 0x05, 0x44, 0xf4, 0x6c, 0x00, 0x4a, 0x09, 0x05, 0x44, 0xf8, 0x6c, 0x00, 0x4a, 0x09, 0x05,
+    0x44, 0xfc, 0x6c, 0x00, 0x30, 0x09, 0x05, 0x44, 0xcc, 0x87, 0x07, 0x90, 0x51, 0x40, 0x09, 0x05,
+    0x44, 0x04, 0x12, 0x00, 0x06, 0x90, 0x51, 0x40, 0x09, 0x05, 0x44, 0x08, 0x12, 0x00, 0x06, 0x90,
+    0x51, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0x6c, 0x00, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0x6c,
+    0x00, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0x6c, 0x00, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0xd8,
+    0x00, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0xd8, 0x00, 0x21, 0x0a, 0x05, 0x64, 0x1d, 0x07, 0xd8,
+    0x00, 0x30, 0x0b, 0x05, 0x44, 0x0b, 0xdd, 0x07, 0x6c, 0x00, 0x40, 0x0b, 0x05, 0x44, 0x73, 0x12,
+    0x00, 0x06, 0x6c, 0x00, 0x40, 0x0b, 0x05, 0x44, 0x78, 0x12, 0x00, 0x06, 0x6c, 0x00, 0x44, 0x0b,
+    0x05, 0x44, 0x7d, 0x36, 0x00, 0x02, 0xb4, 0x00, 0x44, 0x0b, 0x05, 0x44, 0x82, 0x36, 0x00, 0x05,
+    0x12, 0x00, 0x14, 0x87, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0x0c, 0x44, 0x01, 0x1d, 0x0c, 0x44,
+    0x01, 0x1d, 0x0c, 0x44, 0x01, 0x1d, 0x0c, 0x44, 0x01, 0x1d, 0x0c, 0x44, 0x01, 0x1d, 0x0c, 0x44,
+    0x01, 0x33, 0x0d, 0x05, 0x55, 0x44, 0x01, 0x04, 0xa8, 0x03, 0x33, 0x0d, 0x05, 0x55, 0x44, 0x01,
+    0x07, 0x12, 0x00, 0x03, 0x44, 0x01, 0x07, 0x12, 0x00, 0x03, 0x44, 0x01, 0x02, 0xa8, 0x03, 0x10,
+    0xa4, 0x12, 0x00, 0x03, 0x44, 0x01, 0x07, 0x12, 0x00, 0x03, 0x44, 0x01, 0x04, 0x12, 0x00, 0x30,
+    0x0f, 0x05, 0x44, 0xb6, 0x82, 0x16, 0x6c, 0xf4, 0x02, 0x30, 0x0f, 0x05, 0x44, 0xb6, 0x82, 0x16,
+    0x6c, 0xf4, 0x02, 0x30, 0x0f, 0x05, 0x44, 0xb6, 0x82, 0x16, 0x6c, 0xf4, 0x02, 0x30, 0x0f, 0x05,
+    0x44, 0xb6, 0x82, 0x01, 0x36, 0x00, 0x02, 0x3c, 0x03, 0x30, 0x0f, 0x05, 0x44, 0xb6, 0x82, 0x01,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0xb6, 0x82, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0x11,
+    0x6c, 0x00, 0x1d, 0x11, 0x6c, 0x00, 0x1d, 0x11, 0x6c, 0x00, 0x1d, 0x11, 0x6c, 0x00, 0x1d, 0x11,
+    0x6c, 0x00, 0x1d, 0x11, 0x6c, 0x00, 0x30, 0x12, 0x05, 0x44, 0x22, 0x83, 0x07, 0x6c, 0x00, 0x30,
+    0x12, 0x05, 0x44, 0x22, 0x83, 0x07, 0x6c, 0x00, 0x30, 0x12, 0x05, 0x44, 0x22, 0x83, 0x07, 0x6c,
+    0x00, 0x30, 0x12, 0x05, 0x44, 0x22, 0x83, 0x05, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x00, 0x22,
+    0x83, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0x22, 0x83, 0x05, 0x6c, 0x00, 0x3d, 0xac, 0x00,
+    0x13, 0x6c, 0x00, 0x1d, 0x13, 0x6c, 0x00, 0x1d, 0x13, 0x6c, 0x00, 0x1d, 0x13, 0x6c, 0x00, 0x1d,
+    0x13, 0x6c, 0x00, 0x1d, 0x13, 0x6c, 0x00, 0x1d, 0x14, 0x60, 0x03, 0x1d, 0x14, 0x60, 0x03, 0x1d,
+    0x14, 0x60, 0x03, 0x1d, 0x14, 0x60, 0x03, 0x1d, 0x14, 0x60, 0x03, 0x1d, 0x14, 0x60, 0x03, 0x1d,
+    0x15, 0x60, 0x03, 0x1d, 0x15, 0x60, 0x03, 0x1d, 0x15, 0x60, 0x03, 0x1d, 0x15, 0x60, 0x03, 0x1d,
+    0x15, 0x60, 0x03, 0x1d, 0x15, 0x60, 0x03, 0x12, 0x17, 0xd8, 0x00, 0x15, 0x22, 0x6c, 0x00, 0x22,
+    0x02, 0x17, 0xd8, 0x00, 0x15, 0x22, 0x6c, 0x00, 0x00, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x15, 0x22,
+    0x6c, 0x00, 0x00, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x01, 0x36, 0x00, 0x01, 0xb4, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0xd8, 0x00, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0xd8, 0x00, 0x01, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x12, 0x18, 0x88, 0x02, 0x07, 0xb6, 0x82, 0x12, 0x18, 0x88, 0x02, 0x07, 0xb6,
+    0x82, 0x12, 0x18, 0x88, 0x02, 0x07, 0xb6, 0x82, 0x12, 0x18, 0x88, 0x02, 0x07, 0xb6, 0x82, 0x12,
+    0x18, 0x88, 0x02, 0x07, 0xb6, 0x82, 0x12, 0x18, 0x88, 0x02, 0x07, 0xb6, 0x82, 0x12, 0x19, 0x1c,
+    0x02, 0x07, 0x6c, 0x00, 0x12, 0x19, 0x1c, 0x02, 0x07, 0x6c, 0x00, 0x12, 0x19, 0x1c, 0x02, 0x07,
+    0x6c, 0x00, 0x12, 0x19, 0x1c, 0x02, 0x07, 0x8e, 0x83, 0x12, 0x19, 0x1c, 0x02, 0x07, 0x8e, 0x83,
+    0x12, 0x19, 0x1c, 0x02, 0x07, 0x8e, 0x83, 0x12, 0x1a, 0xb0, 0x01, 0x07, 0x44, 0x01, 0x12, 0x1a,
+    0xb0, 0x01, 0x07, 0x44, 0x01, 0x12, 0x1a, 0xb0, 0x01, 0x07, 0x44, 0x01, 0x12, 0x1a, 0xb0, 0x01,
+    0x05, 0x44, 0x01, 0x10, 0xa2, 0x12, 0x00, 0x00, 0xb0, 0x01, 0x05, 0x44, 0x01, 0x01, 0x12, 0x00,
+    0x00, 0xb0, 0x01, 0x05, 0x44, 0x01, 0x41, 0xa2, 0x02, 0x1d, 0x05, 0xf0, 0x15, 0x25, 0x28, 0x0d,
+    0x96, 0x81, 0x40, 0x1d, 0x05, 0x33, 0xe2, 0x12, 0x00, 0x14, 0x0f, 0x12, 0x00, 0x50, 0x14, 0x1d,
+    0x05, 0x33, 0xe5, 0x12, 0x00, 0x14, 0x10, 0x12, 0x00, 0x54, 0x18, 0x1d, 0x05, 0x33, 0xe8, 0x36,
+    0x00, 0x00, 0x9c, 0x0f, 0x10, 0xa1, 0x36, 0x00, 0x14, 0xeb, 0x36, 0x00, 0x01, 0x12, 0x00, 0x00,
+    0x36, 0x00, 0x14, 0xee, 0x36, 0x00, 0x01, 0x12, 0x00, 0x00, 0x36, 0x00, 0x12, 0xf1, 0x36, 0x00,
+    0x11, 0x74, 0xe4, 0x0f, 0x01, 0x6c, 0x00, 0x12, 0xf4, 0x36, 0x00, 0x03, 0x12, 0x00, 0x00, 0x36,
+    0x00, 0x12, 0xf7, 0x36, 0x00, 0x03, 0x12, 0x00, 0x31, 0x18, 0x1e, 0x05, 0xca, 0x1a, 0x07, 0x5c,
+    0x82, 0x40, 0x1e, 0x05, 0x33, 0xfa, 0x24, 0x00, 0x06, 0x5c, 0x82, 0x40, 0x1e, 0x05, 0x33, 0xfd,
+    0x12, 0x00, 0x06, 0x5c, 0x82, 0x59, 0x1e, 0x05, 0x33, 0x00, 0x18, 0x5c, 0x82, 0x40, 0x1e, 0x05,
+    0x33, 0x03, 0x12, 0x00, 0x06, 0x5c, 0x82, 0x40, 0x1e, 0x05, 0x33, 0x06, 0x12, 0x00, 0x06, 0x5c,
+    0x82, 0x42, 0x1e, 0x05, 0x33, 0x09, 0x36, 0x00, 0x03, 0x7e, 0x00, 0x00, 0x36, 0x00, 0x12, 0x0c,
+    0x36, 0x00, 0x03, 0x12, 0x00, 0x00, 0x36, 0x00, 0x12, 0x0f, 0x36, 0x00, 0x04, 0xc6, 0x00, 0x0f,
+    0x36, 0x00, 0x23, 0xb0, 0x1f, 0x05, 0x22, 0x88, 0x1e, 0x00, 0x00, 0x28, 0x12, 0x0d, 0x70, 0x68,
+    0x27, 0x70, 0x00, 0x60, 0x04, 0x1f, 0x05, 0x22, 0x8a, 0x12, 0x00, 0x14, 0x13, 0x12, 0x00, 0x50,
+    0x08, 0x1f, 0x05, 0x22, 0x8c, 0x12, 0x00, 0x14, 0x14, 0x12, 0x00, 0x59, 0x0c, 0x20, 0x05, 0x22,
+    0x8e, 0x36, 0x00, 0x59, 0x08, 0x20, 0x05, 0x22, 0x90, 0x36, 0x00, 0x00, 0x24, 0x00, 0x19, 0x92,
+    0x36, 0x00, 0x31, 0x10, 0x21, 0x05, 0x72, 0x0c, 0x06, 0x44, 0x01, 0x54, 0x04, 0x21, 0x05, 0x33,
+    0x12, 0x0e, 0x01, 0x02, 0x56, 0x01, 0x44, 0x21, 0x05, 0x33, 0x15, 0x0e, 0x01, 0x02, 0x56, 0x01,
+    0x48, 0x21, 0x05, 0x33, 0x18, 0x44, 0x01, 0x10, 0xa4, 0x36, 0x00, 0x18, 0x1b, 0x44, 0x01, 0x10,
+    0xa4, 0x36, 0x00, 0x18, 0x1e, 0x44, 0x01, 0x10, 0xa4, 0x36, 0x00, 0x19, 0x21, 0x0e, 0x01, 0x00,
+    0x36, 0x00, 0x19, 0x24, 0x0e, 0x01, 0x00, 0x36, 0x00, 0x19, 0x27, 0x0e, 0x01, 0x31, 0x0c, 0x22,
+    0x05, 0x00, 0x1b, 0x06, 0x88, 0x02, 0x00, 0x12, 0x00, 0x10, 0x2a, 0x24, 0x00, 0x05, 0x88, 0x02,
+    0x50, 0x10, 0x22, 0x05, 0x33, 0x2d, 0x12, 0x00, 0x05, 0x88, 0x02, 0x50, 0x14, 0x22, 0x05, 0x33,
+    0x30, 0x12, 0x00, 0x04, 0x88, 0x02, 0x10, 0xa2, 0x36, 0x00, 0x14, 0x33, 0x36, 0x00, 0x01, 0x12,
+    0x00, 0x00, 0x36, 0x00, 0x14, 0x36, 0x36, 0x00, 0x01, 0x12, 0x00, 0x00, 0x36, 0x00, 0x12, 0x39,
+    0x36, 0x00, 0x07, 0x7e, 0x00, 0x12, 0x3c, 0x36, 0x00, 0x04, 0x9e, 0x01, 0x42, 0x22, 0x05, 0x33,
+    0x3f, 0x36, 0x00, 0x04, 0x9a, 0x02, 0x93, 0x23, 0x05, 0x44, 0x2c, 0x08, 0x00, 0x00, 0xce, 0x47,
+    0x72, 0x03, 0x60, 0x60, 0x00, 0x23, 0x05, 0x44, 0x30, 0x12, 0x00, 0x18, 0x48, 0x12, 0x00, 0x68,
+    0x0c, 0x0b, 0x00, 0x00, 0xce, 0x49, 0x12, 0x00, 0x14, 0x34, 0x36, 0x00, 0x00, 0x72, 0x03, 0x10,
+    0x64, 0x12, 0x00, 0x14, 0x38, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x10, 0x36, 0x00, 0x02, 0x12,
+    0x00, 0x43, 0x25, 0x05, 0x55, 0x7e, 0xe8, 0x05, 0x03, 0xb2, 0x83, 0x43, 0x25, 0x05, 0x55, 0x83,
+    0xe8, 0x05, 0x06, 0x12, 0x00, 0x13, 0x88, 0xe8, 0x05, 0x06, 0x12, 0x00, 0x14, 0x8d, 0x36, 0x00,
+    0x00, 0x48, 0x00, 0x10, 0x21, 0x12, 0x00, 0x14, 0x92, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x97,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x40, 0x26, 0x05, 0x55, 0x9c, 0x12, 0x00, 0x15, 0x1d, 0x48, 0x00,
+    0x42, 0x26, 0x05, 0x55, 0xa1, 0xf8, 0x25, 0x07, 0x12, 0x00, 0x12, 0xa6, 0x68, 0x25, 0x07, 0x12,
+    0x00, 0x14, 0xab, 0x36, 0x00, 0x00, 0xb6, 0x04, 0x10, 0x2b, 0x12, 0x00, 0x14, 0xb0, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x14, 0xb5, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0x27, 0x05, 0x44, 0xd8, 0xd8,
+    0x00, 0x4a, 0x27, 0x05, 0x44, 0xdd, 0xd8, 0x00, 0x4a, 0x27, 0x05, 0x44, 0xe2, 0xd8, 0x00, 0x4a,
+    0x27, 0x05, 0x44, 0xe7, 0xd8, 0x00, 0x4a, 0x27, 0x05, 0x44, 0xec, 0xd8, 0x00, 0x4a, 0x27, 0x05,
+    0x44, 0xf1, 0xd8, 0x00, 0x3b, 0x28, 0x05, 0x44, 0xd8, 0x00, 0x3b, 0x28, 0x05, 0x44, 0xd8, 0x00,
+    0x3b, 0x28, 0x05, 0x44, 0xd8, 0x00, 0x3b, 0x28, 0x05, 0x44, 0xd8, 0x00, 0x3b, 0x28, 0x05, 0x44,
+    0xd8, 0x00, 0x3b, 0x28, 0x05, 0x44, 0xd8, 0x00, 0x42, 0x29, 0x05, 0x44, 0x14, 0x56, 0x13, 0x04,
+    0x48, 0x00, 0x42, 0x29, 0x05, 0x44, 0x19, 0x56, 0x13, 0x07, 0x12, 0x00, 0x12, 0x1e, 0x56, 0x13,
+    0x07, 0x12, 0x00, 0x14, 0x23, 0x36, 0x00, 0x00, 0x48, 0x00, 0x10, 0x2c, 0x12, 0x00, 0x14, 0x28,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x60, 0xec, 0x05, 0x6c, 0x00, 0x63, 0x2c, 0x01, 0x2a, 0x05,
+    0x44, 0x32, 0x98, 0x07, 0x03, 0x48, 0x00, 0x30, 0x2a, 0x05, 0x44, 0x74, 0xb5, 0x07, 0x44, 0x01,
+    0x43, 0x2a, 0x05, 0x44, 0x3c, 0x98, 0x07, 0x06, 0x12, 0x00, 0x14, 0x41, 0x36, 0x00, 0x00, 0x20,
+    0x01, 0x10, 0x22, 0x12, 0x00, 0x14, 0x46, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x4b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x3b, 0x2d, 0x05, 0x44, 0x88, 0x02, 0x3b, 0x2d, 0x05, 0x44, 0x88, 0x02, 0x3b,
+    0x2d, 0x05, 0x44, 0x88, 0x02, 0x3b, 0x2d, 0x05, 0x44, 0x88, 0x02, 0x3b, 0x2d, 0x05, 0x44, 0x88,
+    0x02, 0x3b, 0x2d, 0x05, 0x44, 0x88, 0x02, 0x1d, 0x2e, 0xb0, 0x01, 0x1d, 0x2e, 0xb0, 0x01, 0x1d,
+    0x2e, 0xb0, 0x01, 0x1d, 0x2e, 0xb0, 0x01, 0x1d, 0x2e, 0xb0, 0x01, 0x1d, 0x2e, 0xb0, 0x01, 0x30,
+    0x2f, 0x05, 0x44, 0x85, 0xcf, 0x07, 0x6c, 0x00, 0x4a, 0x2f, 0x05, 0x44, 0xbf, 0x6c, 0x00, 0x4a,
+    0x2f, 0x05, 0x44, 0xc4, 0x6c, 0x00, 0x48, 0x2f, 0x05, 0x44, 0xc9, 0x6c, 0x00, 0x10, 0x2c, 0x12,
+    0x00, 0x00, 0x9d, 0xe9, 0x07, 0xb0, 0x01, 0x48, 0x2f, 0x05, 0x44, 0xd3, 0x6c, 0x00, 0x6a, 0x2c,
+    0x01, 0x30, 0x05, 0x44, 0x50, 0xb0, 0x01, 0x4a, 0x30, 0x05, 0x44, 0x55, 0xb0, 0x01, 0x4a, 0x30,
+    0x05, 0x44, 0x5a, 0xb0, 0x01, 0x4a, 0x30, 0x05, 0x44, 0x5f, 0xb0, 0x01, 0x4a, 0x30, 0x05, 0x44,
+    0x64, 0xb0, 0x01, 0x4a, 0x30, 0x05, 0x44, 0x69, 0xb0, 0x01, 0x3b, 0x34, 0x05, 0x55, 0xd8, 0x00,
+    0x3b, 0x34, 0x05, 0x55, 0xd8, 0x00, 0x3b, 0x34, 0x05, 0x55, 0xd8, 0x00, 0x3b, 0x34, 0x05, 0x55,
+    0xd8, 0x00, 0x3b, 0x34, 0x05, 0x55, 0xd8, 0x00, 0x3b, 0x34, 0x05, 0x55, 0xd8, 0x00, 0x3b, 0x35,
+    0x05, 0x55, 0xcc, 0x03, 0x3b, 0x35, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x35, 0x05, 0x55, 0xcc, 0x03,
+    0x3b, 0x35, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x35, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x35, 0x05, 0x55,
+    0xcc, 0x03, 0x30, 0x36, 0x05, 0x55, 0xad, 0xef, 0x07, 0xd8, 0x00, 0x4a, 0x36, 0x05, 0x55, 0xfb,
+    0xd8, 0x00, 0x30, 0x36, 0x05, 0x55, 0xf8, 0x95, 0x07, 0xd8, 0x00, 0x48, 0x36, 0x05, 0x55, 0x05,
+    0x60, 0x03, 0x10, 0x2b, 0x12, 0x00, 0x00, 0xce, 0x32, 0x07, 0x1c, 0x02, 0x48, 0x36, 0x05, 0x55,
+    0x0f, 0x60, 0x03, 0x5b, 0x2b, 0x01, 0x37, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x37, 0x05, 0x55, 0xcc,
+    0x03, 0x3b, 0x37, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x37, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x37, 0x05,
+    0x55, 0xcc, 0x03, 0x3b, 0x37, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x38, 0x05, 0x55, 0xcc, 0x03, 0x3b,
+    0x38, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x38, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x38, 0x05, 0x55, 0xcc,
+    0x03, 0x3b, 0x38, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x38, 0x05, 0x55, 0xcc, 0x03, 0x3b, 0x39, 0x05,
+    0x55, 0x88, 0x02, 0x3b, 0x39, 0x05, 0x55, 0x88, 0x02, 0x3b, 0x39, 0x05, 0x55, 0x88, 0x02, 0x3b,
+    0x39, 0x05, 0x55, 0x88, 0x02, 0x3b, 0x39, 0x05, 0x55, 0x88, 0x02, 0x3b, 0x39, 0x05, 0x55, 0x88,
+    0x02, 0x21, 0x3c, 0x05, 0xda, 0x1f, 0x25, 0x38, 0x3b, 0x52, 0x14, 0x21, 0x3c, 0x05, 0xda, 0x1f,
+    0x28, 0x38, 0x3c, 0x12, 0x00, 0x00, 0xda, 0x1f, 0x28, 0x38, 0x3d, 0x12, 0x00, 0x00, 0xda, 0x1f,
+    0x01, 0x36, 0x00, 0x00, 0xaa, 0x07, 0x10, 0x21, 0x12, 0x00, 0x00, 0xda, 0x1f, 0x01, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x00, 0xda, 0x1f, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x21, 0x3d, 0x05, 0xf6,
+    0x21, 0x07, 0xe6, 0x88, 0x21, 0x3d, 0x05, 0xf6, 0x21, 0x07, 0xe6, 0x88, 0x21, 0x3d, 0x05, 0xf6,
+    0x21, 0x07, 0xe6, 0x88, 0x21, 0x3d, 0x05, 0xf6, 0x21, 0x07, 0xe6, 0x88, 0x21, 0x3d, 0x05, 0xf6,
+    0x21, 0x07, 0xe6, 0x88, 0x21, 0x3d, 0x05, 0xf6, 0x21, 0x07, 0xe6, 0x88, 0x21, 0x3e, 0x05, 0x8a,
+    0x21, 0x07, 0x6c, 0x00, 0x21, 0x3e, 0x05, 0x8a, 0x21, 0x07, 0x6c, 0x00, 0x21, 0x3e, 0x05, 0x8a,
+    0x21, 0x07, 0x6c, 0x00, 0x21, 0x3e, 0x05, 0x8a, 0x21, 0x07, 0xbe, 0x89, 0x21, 0x3e, 0x05, 0x8a,
+    0x21, 0x07, 0xbe, 0x89, 0x21, 0x3e, 0x05, 0x8a, 0x21, 0x07, 0xbe, 0x89, 0x21, 0x3f, 0x05, 0xa6,
+    0x23, 0x07, 0x44, 0x01, 0x21, 0x3f, 0x05, 0xa6, 0x23, 0x07, 0x44, 0x01, 0x21, 0x3f, 0x05, 0xa6,
+    0x23, 0x07, 0x44, 0x01, 0x21, 0x3f, 0x05, 0xa6, 0x23, 0x05, 0x44, 0x01, 0x10, 0x22, 0x12, 0x00,
+    0x00, 0xa6, 0x23, 0x05, 0x44, 0x01, 0x01, 0x12, 0x00, 0x00, 0xa6, 0x23, 0x05, 0x44, 0x01, 0x41,
+    0x22, 0x00, 0x46, 0x05, 0xa6, 0x23, 0x25, 0x3c, 0x12, 0xe2, 0x1d, 0x21, 0x46, 0x05, 0xa6, 0x23,
+    0x28, 0x3c, 0x13, 0x12, 0x00, 0x00, 0xa6, 0x23, 0x28, 0x3c, 0x14, 0x12, 0x00, 0x14, 0xf0, 0x36,
+    0x00, 0x02, 0xda, 0x16, 0x44, 0x46, 0x05, 0x33, 0xf4, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0xf8,
+    0x36, 0x00, 0x02, 0x12, 0x00, 0x21, 0x47, 0x05, 0x3a, 0x23, 0x07, 0x6c, 0x00, 0x21, 0x47, 0x05,
+    0x3a, 0x23, 0x07, 0x6c, 0x00, 0x21, 0x47, 0x05, 0x3a, 0x23, 0x07, 0x6c, 0x00, 0x57, 0x47, 0x05,
+    0x33, 0x42, 0x18, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x18, 0x7c, 0x6c, 0x00, 0x01, 0x12, 0x00,
+    0x18, 0x80, 0x6c, 0x00, 0x60, 0xac, 0x00, 0x4c, 0x05, 0x44, 0x14, 0x94, 0x11, 0x15, 0x41, 0xd6,
+    0x0e, 0x40, 0x4c, 0x05, 0x44, 0x18, 0x12, 0x00, 0x18, 0x42, 0x12, 0x00, 0x10, 0x1c, 0x12, 0x00,
+    0x18, 0x43, 0x12, 0x00, 0x14, 0x20, 0x36, 0x00, 0x02, 0x86, 0x10, 0x44, 0x4c, 0x05, 0x44, 0x24,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x28, 0x36, 0x00, 0x02, 0x12, 0x00, 0x1d, 0x4d, 0x6c, 0x00,
+    0x1d, 0x4d, 0x6c, 0x00, 0x1d, 0x4d, 0x6c, 0x00, 0x1d, 0x4d, 0x6c, 0x00, 0x1d, 0x4d, 0x6c, 0x00,
+    0x1d, 0x4d, 0x6c, 0x00, 0x4a, 0x50, 0x05, 0x44, 0x2c, 0x6c, 0x00, 0x4a, 0x50, 0x05, 0x44, 0x30,
+    0x6c, 0x00, 0x4a, 0x50, 0x05, 0x44, 0x34, 0x6c, 0x00, 0x4a, 0x50, 0x05, 0x44, 0x38, 0x6c, 0x00,
+    0x4a, 0x50, 0x05, 0x44, 0x3c, 0x6c, 0x00, 0x4a, 0x50, 0x05, 0x44, 0x40, 0x6c, 0x00, 0x1d, 0x51,
+    0x6c, 0x00, 0x1d, 0x51, 0x6c, 0x00, 0x1d, 0x51, 0x6c, 0x00, 0x1d, 0x51, 0x6c, 0x00, 0x1d, 0x51,
+    0x6c, 0x00, 0x1d, 0x51, 0x6c, 0x00, 0x12, 0x54, 0x3e, 0x10, 0x25, 0x18, 0x3e, 0x0e, 0x13, 0x12,
+    0x54, 0x3e, 0x10, 0x28, 0x18, 0x3f, 0x12, 0x00, 0x00, 0x3e, 0x10, 0x28, 0x18, 0x40, 0x12, 0x00,
+    0x00, 0x3e, 0x10, 0x01, 0x36, 0x00, 0x02, 0xf2, 0x10, 0x12, 0x54, 0x3e, 0x10, 0x01, 0x36, 0x00,
+    0x05, 0x12, 0x00, 0x00, 0x3e, 0x10, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x12, 0x55, 0x2c, 0x10,
+    0x07, 0x6a, 0x95, 0x12, 0x55, 0x2c, 0x10, 0x07, 0x6a, 0x95, 0x12, 0x55, 0x1a, 0x10, 0x07, 0xc4,
+    0x95, 0x12, 0x55, 0x1a, 0x10, 0x07, 0xc4, 0x95, 0x59, 0x57, 0x05, 0x44, 0x44, 0x0b, 0xb4, 0x00,
+    0x40, 0x57, 0x05, 0x44, 0x48, 0x12, 0x00, 0x06, 0xb4, 0x00, 0x40, 0x57, 0x05, 0x44, 0x4c, 0x12,
+    0x00, 0x06, 0xb4, 0x00, 0x44, 0x57, 0x05, 0x44, 0x50, 0x36, 0x00, 0x02, 0x90, 0x00, 0x44, 0x57,
+    0x05, 0x44, 0x54, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x58, 0x36, 0x00, 0x02, 0x12, 0x00, 0x42,
+    0x58, 0x05, 0x44, 0x8c, 0x66, 0x06, 0x04, 0x48, 0x00, 0x42, 0x58, 0x05, 0x44, 0x91, 0x66, 0x06,
+    0x07, 0x12, 0x00, 0x00, 0x63, 0xb6, 0x07, 0xc6, 0x00, 0x44, 0x58, 0x05, 0x44, 0x9b, 0x36, 0x00,
+    0x02, 0xb4, 0x00, 0x30, 0x58, 0x05, 0x44, 0x29, 0xf7, 0x07, 0xd8, 0x00, 0x30, 0x58, 0x05, 0x44,
+    0x62, 0xb8, 0x07, 0xd8, 0x00, 0x21, 0x59, 0x05, 0x1e, 0x3c, 0x07, 0x6c, 0x00, 0x21, 0x59, 0x05,
+    0x98, 0x3d, 0x07, 0x6c, 0x00, 0x21, 0x59, 0x05, 0x98, 0x3d, 0x07, 0x6c, 0x00, 0x21, 0x59, 0x05,
+    0x98, 0x3d, 0x07, 0x9c, 0x96, 0x21, 0x59, 0x05, 0x98, 0x3d, 0x07, 0x9c, 0x96, 0x21, 0x59, 0x05,
+    0x98, 0x3d, 0x07, 0x9c, 0x96, 0x21, 0x5a, 0x05, 0x1e, 0x3c, 0x07, 0x6c, 0x00, 0x21, 0x5a, 0x05,
+    0x08, 0x3d, 0x07, 0x6c, 0x00, 0x21, 0x5a, 0x05, 0x08, 0x3d, 0x07, 0x6c, 0x00, 0x21, 0x5a, 0x05,
+    0x08, 0x3d, 0x07, 0xd8, 0x00, 0x21, 0x5a, 0x05, 0x08, 0x3d, 0x07, 0xd8, 0x00, 0x21, 0x5a, 0x05,
+    0x08, 0x3d, 0x07, 0xd8, 0x00, 0x4a, 0x5b, 0x05, 0x44, 0xaa, 0x44, 0x01, 0x4a, 0x5b, 0x05, 0x44,
+    0xaf, 0x44, 0x01, 0x4a, 0x5b, 0x05, 0x44, 0xb4, 0x44, 0x01, 0x30, 0x5b, 0x05, 0x44, 0x70, 0xf6,
+    0x07, 0xd8, 0x00, 0x48, 0x5b, 0x05, 0x44, 0xbe, 0x44, 0x01, 0x01, 0x12, 0x00, 0x18, 0xc3, 0x44,
+    0x01, 0x62, 0xac, 0x00, 0x5c, 0x05, 0x44, 0x5c, 0x38, 0x16, 0x04, 0x48, 0x00, 0x42, 0x5c, 0x05,
+    0x44, 0x60, 0x38, 0x16, 0x07, 0x12, 0x00, 0x12, 0x64, 0x38, 0x16, 0x07, 0x12, 0x00, 0x14, 0x68,
+    0x36, 0x00, 0x02, 0x56, 0x13, 0x44, 0x5c, 0x05, 0x44, 0x6c, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14,
+    0x70, 0x36, 0x00, 0x02, 0x12, 0x00, 0x24, 0x5f, 0x05, 0x0c, 0x21, 0x04, 0x48, 0x00, 0x24, 0x5f,
+    0x05, 0x0c, 0x21, 0x07, 0x12, 0x00, 0x03, 0x0c, 0x21, 0x07, 0x12, 0x00, 0x03, 0x0c, 0x21, 0x04,
+    0xb4, 0x00, 0x24, 0x5f, 0x05, 0x0c, 0x21, 0x07, 0x12, 0x00, 0x03, 0x0c, 0x21, 0x07, 0x12, 0x00,
+    0x03, 0x64, 0x38, 0x04, 0xa0, 0x05, 0x24, 0x5f, 0x05, 0x64, 0x38, 0x07, 0x12, 0x00, 0x03, 0x64,
+    0x38, 0x07, 0x12, 0x00, 0x03, 0x64, 0x38, 0x04, 0xa0, 0x05, 0x24, 0x5f, 0x05, 0x64, 0x38, 0x07,
+    0x12, 0x00, 0x03, 0x64, 0x38, 0x04, 0x12, 0x00, 0x24, 0x60, 0x05, 0xe8, 0x20, 0x04, 0xb4, 0x00,
+    0x24, 0x60, 0x05, 0xe8, 0x20, 0x07, 0x12, 0x00, 0x03, 0xe8, 0x20, 0x07, 0x12, 0x00, 0x03, 0xe8,
+    0x20, 0x04, 0xf8, 0x01, 0x24, 0x60, 0x05, 0xe8, 0x20, 0x07, 0x12, 0x00, 0x03, 0xe8, 0x20, 0x07,
+    0x12, 0x00, 0x03, 0x40, 0x38, 0x04, 0xb4, 0x00, 0x24, 0x60, 0x05, 0x40, 0x38, 0x07, 0x12, 0x00,
+    0x03, 0x40, 0x38, 0x07, 0x12, 0x00, 0x03, 0x40, 0x38, 0x04, 0xe4, 0x06, 0x24, 0x60, 0x05, 0x40,
+    0x38, 0x07, 0x12, 0x00, 0x03, 0x40, 0x38, 0x04, 0x12, 0x00, 0x1d, 0x61, 0x9e, 0x01, 0x1d, 0x61,
+    0x9e, 0x01, 0x1d, 0x61, 0x8c, 0x01, 0x1d, 0x61, 0x8c, 0x01, 0x1d, 0x61, 0x7a, 0x01, 0x1d, 0x61,
+    0x7a, 0x01, 0x1d, 0x61, 0x68, 0x01, 0x1d, 0x61, 0x68, 0x01, 0x1d, 0x62, 0x56, 0x01, 0x1d, 0x62,
+    0x56, 0x01, 0x1d, 0x62, 0x44, 0x01, 0x1d, 0x62, 0x44, 0x01, 0x12, 0x63, 0x18, 0x15, 0x07, 0x48,
+    0x00, 0x12, 0x63, 0x18, 0x15, 0x07, 0x48, 0x00, 0x12, 0x63, 0x06, 0x15, 0x07, 0xd8, 0x00, 0x12,
+    0x63, 0x06, 0x15, 0x07, 0xd8, 0x00, 0x30, 0x63, 0x05, 0x44, 0x16, 0x08, 0x07, 0xd8, 0x00, 0x30,
+    0x63, 0x05, 0x44, 0x16, 0x08, 0x07, 0xd8, 0x00, 0x30, 0x63, 0x05, 0x44, 0x04, 0x08, 0x07, 0xd8,
+    0x00, 0x30, 0x63, 0x05, 0x44, 0x04, 0x08, 0x07, 0xd8, 0x00, 0x1d, 0x64, 0xa0, 0x05, 0x1d, 0x64,
+    0xa0, 0x05, 0x1d, 0x64, 0xa0, 0x05, 0x1d, 0x64, 0xa0, 0x05, 0x1d, 0x64, 0xa0, 0x05, 0x1d, 0x64,
+    0xa0, 0x05, 0x1d, 0x65, 0xa0, 0x05, 0x1d, 0x65, 0xa0, 0x05, 0x1d, 0x65, 0xa0, 0x05, 0x1d, 0x65,
+    0xa0, 0x05, 0x1d, 0x65, 0xa0, 0x05, 0x1d, 0x65, 0xa0, 0x05, 0x1d, 0x66, 0xa0, 0x05, 0x1d, 0x66,
+    0xa0, 0x05, 0x1d, 0x66, 0xa0, 0x05, 0x1d, 0x66, 0xa0, 0x05, 0x1d, 0x66, 0xa0, 0x05, 0x1d, 0x66,
+    0xa0, 0x05, 0x1d, 0x67, 0xa0, 0x05, 0x1d, 0x67, 0xa0, 0x05, 0x1d, 0x67, 0xa0, 0x05, 0x1d, 0x67,
+    0xa0, 0x05, 0x1d, 0x67, 0xa0, 0x05, 0x1d, 0x67, 0xa0, 0x05, 0x1d, 0x68, 0xa0, 0x05, 0x1d, 0x68,
+    0xa0, 0x05, 0x1d, 0x68, 0xa0, 0x05, 0x1d, 0x68, 0xa0, 0x05, 0x1d, 0x68, 0xa0, 0x05, 0x1d, 0x68,
+    0xa0, 0x05, 0x1d, 0x69, 0xa0, 0x05, 0x1d, 0x69, 0xa0, 0x05, 0x1d, 0x69, 0xa0, 0x05, 0x1d, 0x69,
+    0xa0, 0x05, 0x1d, 0x69, 0xa0, 0x05, 0x1d, 0x69, 0xa0, 0x05, 0x15, 0x6a, 0x86, 0x19, 0x04, 0x48,
+    0x00, 0x15, 0x6a, 0x86, 0x19, 0x07, 0x12, 0x00, 0x03, 0x86, 0x19, 0x07, 0x12, 0x00, 0x03, 0x86,
+    0x19, 0x07, 0x48, 0x00, 0x03, 0x86, 0x19, 0x07, 0x12, 0x00, 0x03, 0x86, 0x19, 0x04, 0x12, 0x00,
+    0x12, 0x6b, 0xd6, 0x17, 0x16, 0x46, 0x3c, 0x0c, 0x21, 0x6b, 0x05, 0xc6, 0x2d, 0x16, 0x46, 0x3c,
+    0x0c, 0x21, 0x6b, 0x05, 0xc6, 0x2d, 0x16, 0x46, 0x3c, 0x0c, 0x21, 0x6b, 0x05, 0xc6, 0x2d, 0x01,
+    0x36, 0x00, 0x01, 0xb2, 0x17, 0x00, 0x12, 0x00, 0x00, 0xc6, 0x2d, 0x01, 0x36, 0x00, 0x05, 0x12,
+    0x00, 0x00, 0xc6, 0x2d, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x12, 0x6c, 0x3c, 0x0c, 0x07, 0x5a,
+    0x6c, 0x12, 0x6c, 0x3c, 0x0c, 0x07, 0x5a, 0x6c, 0x12, 0x6c, 0x3c, 0x0c, 0x07, 0x5a, 0x6c, 0x21,
+    0x6c, 0x05, 0xe2, 0x2f, 0x07, 0x5a, 0x6c, 0x21, 0x6c, 0x05, 0xe2, 0x2f, 0x07, 0x5a, 0x6c, 0x21,
+    0x6c, 0x05, 0xe2, 0x2f, 0x07, 0x5a, 0x6c, 0x12, 0x6d, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x12, 0x6d,
+    0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x12, 0x6d, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x21, 0x6d, 0x05, 0x76,
+    0x2f, 0x07, 0x32, 0x6d, 0x21, 0x6d, 0x05, 0x76, 0x2f, 0x07, 0x32, 0x6d, 0x21, 0x6d, 0x05, 0x76,
+    0x2f, 0x07, 0x32, 0x6d, 0x12, 0x6e, 0x92, 0x16, 0x07, 0x44, 0x01, 0x21, 0x6e, 0x05, 0x92, 0x31,
+    0x07, 0x44, 0x01, 0x21, 0x6e, 0x05, 0x92, 0x31, 0x07, 0x44, 0x01, 0x21, 0x6e, 0x05, 0x92, 0x31,
+    0x05, 0x44, 0x01, 0x10, 0xa2, 0x12, 0x00, 0x00, 0x92, 0x31, 0x05, 0x44, 0x01, 0x01, 0x12, 0x00,
+    0x00, 0x92, 0x31, 0x05, 0x44, 0x01, 0xb5, 0xa2, 0x00, 0x6f, 0x05, 0x33, 0x45, 0x18, 0x00, 0x00,
+    0x10, 0x0e, 0xfe, 0x28, 0x54, 0x6f, 0x05, 0x33, 0xab, 0x12, 0x12, 0x00, 0xe5, 0x10, 0x00, 0x10,
+    0x61, 0x00, 0x70, 0x05, 0x33, 0x60, 0x0f, 0x00, 0x00, 0x10, 0x16, 0x24, 0x00, 0x40, 0x70, 0x05,
+    0x33, 0xae, 0x24, 0x00, 0x01, 0x12, 0x00, 0x01, 0x62, 0x34, 0x0f, 0x24, 0x00, 0x11, 0x45, 0x71,
+    0x05, 0x33, 0xb1, 0x12, 0x00, 0x01, 0x24, 0x00, 0x48, 0x71, 0x05, 0x33, 0xb4, 0x24, 0x00, 0x63,
+    0x64, 0x00, 0x72, 0x05, 0x33, 0x48, 0x90, 0x00, 0x00, 0xd0, 0x77, 0x20, 0x00, 0x60, 0x12, 0x00,
+    0x1a, 0x4b, 0xa2, 0x00, 0x48, 0x72, 0x05, 0x33, 0xbd, 0xa2, 0x00, 0x7a, 0x62, 0x00, 0x73, 0x05,
+    0x33, 0x4e, 0x18, 0xde, 0x42, 0x30, 0x05, 0x33, 0x51, 0x12, 0x00, 0x07, 0xde, 0x42, 0x30, 0x05,
+    0x33, 0x54, 0x12, 0x00, 0x07, 0xde, 0x42, 0x38, 0x05, 0x33, 0x57, 0x36, 0x00, 0x10, 0x44, 0x12,
+    0x00, 0x18, 0x5a, 0x36, 0x00, 0x01, 0x12, 0x00, 0x18, 0x5d, 0x36, 0x00, 0x3d, 0x44, 0x00, 0x75,
+    0x6c, 0x00, 0x4a, 0x75, 0x05, 0x33, 0x60, 0x6c, 0x00, 0x4a, 0x75, 0x05, 0x33, 0x63, 0x6c, 0x00,
+    0x1d, 0x76, 0x6c, 0x00, 0x4a, 0x76, 0x05, 0x33, 0x66, 0x6c, 0x00, 0x4a, 0x76, 0x05, 0x33, 0x69,
+    0x6c, 0x00, 0x40, 0x8d, 0x05, 0x44, 0x44, 0x38, 0x70, 0x02, 0xfc, 0x00, 0x00, 0xd6, 0x17, 0x45,
+    0x8d, 0x05, 0x44, 0x48, 0x12, 0x00, 0x90, 0x10, 0x04, 0x10, 0x61, 0x00, 0x8e, 0x05, 0x44, 0x4c,
+    0x12, 0x00, 0x02, 0x56, 0x01, 0x00, 0x24, 0x00, 0x45, 0x8e, 0x05, 0x44, 0x50, 0x12, 0x00, 0x4f,
+    0x10, 0x04, 0x10, 0x63, 0x24, 0x00, 0x12, 0x4a, 0x8f, 0x05, 0x44, 0x54, 0x24, 0x00, 0x48, 0x8f,
+    0x05, 0x44, 0x58, 0x24, 0x00, 0x6a, 0x64, 0x00, 0x90, 0x05, 0x44, 0x5c, 0x90, 0x00, 0x48, 0x90,
+    0x05, 0x44, 0x60, 0x90, 0x00, 0x35, 0x62, 0x00, 0x91, 0xd2, 0x0f, 0x04, 0x9a, 0x02, 0x15, 0x91,
+    0xd2, 0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2, 0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2, 0x0f, 0x01, 0x9a,
+    0x02, 0x00, 0x30, 0x8d, 0x05, 0xd2, 0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2, 0x0f, 0x04, 0x12, 0x00,
+    0x15, 0x92, 0xd2, 0x0f, 0x04, 0x48, 0x00, 0x15, 0x92, 0xd2, 0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2,
+    0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2, 0x0f, 0x02, 0x48, 0x00, 0x10, 0xac, 0x12, 0x00, 0x03, 0xd2,
+    0x0f, 0x07, 0x12, 0x00, 0x03, 0xd2, 0x0f, 0x04, 0x12, 0x00, 0x12, 0xa1, 0x1e, 0x06, 0x25, 0x56,
+    0x35, 0x6a, 0x0e, 0x12, 0xa1, 0x1e, 0x06, 0x28, 0x56, 0x36, 0x12, 0x00, 0x00, 0x1e, 0x06, 0x28,
+    0x56, 0x37, 0x12, 0x00, 0x00, 0x1e, 0x06, 0x01, 0x36, 0x00, 0x02, 0xfa, 0x05, 0x12, 0xa1, 0x1e,
+    0x06, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x1e, 0x06, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x1d, 0xa2, 0x6c, 0x00, 0x1d, 0xa2, 0x6c, 0x00, 0x1d, 0xa2, 0x6c, 0x00, 0x1d, 0xa2, 0x6c, 0x00,
+    0x1d, 0xa2, 0x6c, 0x00, 0x1d, 0xa2, 0x6c, 0x00, 0x15, 0xa3, 0x98, 0x22, 0x04, 0xfa, 0x05, 0x15,
+    0xa3, 0x98, 0x22, 0x07, 0x12, 0x00, 0x03, 0x98, 0x22, 0x07, 0x12, 0x00, 0x03, 0x98, 0x22, 0x04,
+    0xfa, 0x05, 0x15, 0xa3, 0x98, 0x22, 0x07, 0x12, 0x00, 0x03, 0x98, 0x22, 0x04, 0x12, 0x00, 0x4a,
+    0xa4, 0x05, 0x44, 0x84, 0xf6, 0x06, 0x4a, 0xa4, 0x05, 0x44, 0x88, 0xf6, 0x06, 0x4a, 0xa4, 0x05,
+    0x44, 0x8c, 0xf6, 0x06, 0x4a, 0xa4, 0x05, 0x44, 0x90, 0x6c, 0x00, 0x4a, 0xa4, 0x05, 0x44, 0x94,
+    0x6c, 0x00, 0x4a, 0xa4, 0x05, 0x44, 0x98, 0x6c, 0x00, 0x1d, 0xa7, 0x20, 0x25, 0x1d, 0xa7, 0x20,
+    0x25, 0x1d, 0xa7, 0x20, 0x25, 0x1d, 0xa7, 0x20, 0x25, 0x1d, 0xa7, 0x20, 0x25, 0x1d, 0xa7, 0x20,
+    0x25, 0x1d, 0xa8, 0x64, 0x26, 0x1d, 0xa8, 0x64, 0x26, 0x1d, 0xa8, 0x64, 0x26, 0x1d, 0xa8, 0x64,
+    0x26, 0x1d, 0xa8, 0x64, 0x26, 0x1d, 0xa8, 0x64, 0x26, 0x1d, 0xa9, 0x64, 0x26, 0x1d, 0xa9, 0x64,
+    0x26, 0x1d, 0xa9, 0x64, 0x26, 0x1d, 0xa9, 0x64, 0x26, 0x1d, 0xa9, 0x64, 0x26, 0x1d, 0xa9, 0x64,
+    0x26, 0x1d, 0xaa, 0xb4, 0x24, 0x1d, 0xaa, 0xb4, 0x24, 0x1d, 0xaa, 0xb4, 0x24, 0x1d, 0xaa, 0xb4,
+    0x24, 0x1d, 0xaa, 0xb4, 0x24, 0x1d, 0xaa, 0xb4, 0x24, 0x1d, 0xab, 0x98, 0x22, 0x1d, 0xab, 0x98,
+    0x22, 0x1d, 0xab, 0x98, 0x22, 0x1d, 0xab, 0x98, 0x22, 0x1d, 0xab, 0x98, 0x22, 0x1d, 0xab, 0x98,
+    0x22, 0x12, 0xac, 0xc0, 0x21, 0x07, 0x44, 0x01, 0x15, 0xac, 0x94, 0x11, 0x07, 0x12, 0x00, 0x03,
+    0x94, 0x11, 0x07, 0x12, 0x00, 0x03, 0x6a, 0xa7, 0x04, 0x8c, 0x01, 0x15, 0xac, 0xa6, 0x11, 0x07,
+    0x12, 0x00, 0x03, 0xa6, 0x11, 0x04, 0x12, 0x00, 0x12, 0xad, 0xc0, 0x21, 0x07, 0x6c, 0x00, 0x15,
+    0xad, 0xa8, 0x0c, 0x07, 0x12, 0x00, 0x03, 0xa8, 0x0c, 0x07, 0x12, 0x00, 0x03, 0x6a, 0xa7, 0x04,
+    0x8c, 0x01, 0x15, 0xad, 0xba, 0x0c, 0x07, 0x12, 0x00, 0x03, 0xba, 0x0c, 0x04, 0x12, 0x00, 0x1d,
+    0xae, 0x70, 0x23, 0x1d, 0xae, 0x70, 0x23, 0x1d, 0xae, 0x70, 0x23, 0x1d, 0xae, 0x70, 0x23, 0x1d,
+    0xae, 0x70, 0x23, 0x1d, 0xae, 0x70, 0x23, 0x1d, 0xaf, 0x60, 0x03, 0x1d, 0xaf, 0x60, 0x03, 0x1d,
+    0xaf, 0x60, 0x03, 0x1d, 0xaf, 0x60, 0x03, 0x1d, 0xaf, 0x60, 0x03, 0x1d, 0xaf, 0x60, 0x03, 0x1d,
+    0xb0, 0x60, 0x03, 0x1d, 0xb0, 0x60, 0x03, 0x1d, 0xb0, 0x60, 0x03, 0x1d, 0xb0, 0x60, 0x03, 0x1d,
+    0xb0, 0x60, 0x03, 0x1d, 0xb0, 0x60, 0x03, 0x1d, 0xb1, 0x60, 0x03, 0x1d, 0xb1, 0x60, 0x03, 0x1d,
+    0xb1, 0x60, 0x03, 0x1d, 0xb1, 0x60, 0x03, 0x1d, 0xb1, 0x60, 0x03, 0x1d, 0xb1, 0x60, 0x03, 0x1d,
+    0xb2, 0x60, 0x03, 0x1d, 0xb2, 0x60, 0x03, 0x1d, 0xb2, 0x60, 0x03, 0x1d, 0xb2, 0x60, 0x03, 0x1d,
+    0xb2, 0x60, 0x03, 0x1d, 0xb2, 0x60, 0x03, 0x1d, 0xb3, 0x60, 0x03, 0x1d, 0xb3, 0x60, 0x03, 0x1d,
+    0xb3, 0x60, 0x03, 0x1d, 0xb3, 0x60, 0x03, 0x1d, 0xb3, 0x60, 0x03, 0x1d, 0xb3, 0x60, 0x03, 0x1d,
+    0xb4, 0x60, 0x03, 0x1d, 0xb4, 0x60, 0x03, 0x1d, 0xb4, 0x60, 0x03, 0x1d, 0xb4, 0x60, 0x03, 0x1d,
+    0xb4, 0x60, 0x03, 0x1d, 0xb4, 0x60, 0x03, 0x1d, 0xb5, 0x60, 0x03, 0x1d, 0xb5, 0x60, 0x03, 0x1d,
+    0xb5, 0x60, 0x03, 0x1d, 0xb5, 0x60, 0x03, 0x1d, 0xb5, 0x60, 0x03, 0x1d, 0xb5, 0x60, 0x03, 0x1d,
+    0xb6, 0x60, 0x03, 0x1d, 0xb6, 0x60, 0x03, 0x1d, 0xb6, 0x60, 0x03, 0x1d, 0xb6, 0x60, 0x03, 0x1d,
+    0xb6, 0x60, 0x03, 0x1d, 0xb6, 0x60, 0x03, 0x40, 0xb7, 0x05, 0x22, 0x94, 0x86, 0x34, 0x31, 0x0d,
+    0x0d, 0x74, 0x98, 0x4f, 0x10, 0x60, 0x12, 0x00, 0x10, 0x96, 0x12, 0x00, 0x18, 0x0f, 0x12, 0x00,
+    0x10, 0x98, 0x12, 0x00, 0x15, 0x10, 0x12, 0x00, 0x40, 0xb8, 0x05, 0x22, 0x9a, 0x12, 0x00, 0x18,
+    0x15, 0x12, 0x00, 0x10, 0x9c, 0x12, 0x00, 0x18, 0x17, 0x12, 0x00, 0x10, 0x9e, 0x12, 0x00, 0x15,
+    0x18, 0x12, 0x00, 0x51, 0xb9, 0x05, 0x33, 0x6c, 0x18, 0x5e, 0x35, 0x04, 0xac, 0x77, 0x40, 0xb9,
+    0x05, 0x33, 0x6f, 0x12, 0x00, 0x06, 0x72, 0x78, 0x40, 0xb9, 0x05, 0x33, 0x72, 0x12, 0x00, 0x06,
+    0xd0, 0x77, 0x42, 0xb9, 0x05, 0x33, 0x75, 0x36, 0x00, 0x01, 0xe0, 0x22, 0x20, 0x30, 0x21, 0x12,
+    0x00, 0x12, 0x78, 0x36, 0x00, 0x07, 0x12, 0x00, 0x12, 0x7b, 0x36, 0x00, 0x04, 0x12, 0x00, 0x4a,
+    0xba, 0x05, 0x33, 0x7e, 0x6c, 0x00, 0x4a, 0xba, 0x05, 0x33, 0x81, 0x6c, 0x00, 0x4a, 0xba, 0x05,
+    0x33, 0x84, 0x6c, 0x00, 0x47, 0xba, 0x05, 0x33, 0x87, 0x6c, 0x00, 0x20, 0x2c, 0x22, 0x12, 0x00,
+    0x00, 0x53, 0xdb, 0x04, 0x6c, 0x00, 0x02, 0x12, 0x00, 0x17, 0x8d, 0x6c, 0x00, 0x73, 0x2c, 0x22,
+    0x00, 0xbb, 0x05, 0x22, 0xa0, 0x44, 0x01, 0x02, 0x90, 0x24, 0x00, 0x12, 0x00, 0x13, 0xa2, 0x44,
+    0x01, 0x06, 0x12, 0x00, 0x13, 0xa4, 0x44, 0x01, 0x03, 0x12, 0x00, 0x43, 0xbc, 0x05, 0x22, 0xa6,
+    0x44, 0x01, 0x06, 0x12, 0x00, 0x13, 0xa8, 0x44, 0x01, 0x06, 0x12, 0x00, 0x13, 0xaa, 0x44, 0x01,
+    0x03, 0x12, 0x00, 0x4a, 0xbd, 0x05, 0x22, 0xac, 0x36, 0x00, 0x4a, 0xbd, 0x05, 0x22, 0xae, 0x36,
+    0x00, 0x4a, 0xbd, 0x05, 0x22, 0xb0, 0x36, 0x00, 0x4a, 0xbe, 0x05, 0x22, 0xb2, 0xa2, 0x00, 0x4a,
+    0xbe, 0x05, 0x22, 0xb4, 0xa2, 0x00, 0x4a, 0xbe, 0x05, 0x22, 0xb6, 0xa2, 0x00, 0x4a, 0xc0, 0x05,
+    0x22, 0xb8, 0xe6, 0x01, 0x4a, 0xc0, 0x05, 0x22, 0xba, 0xe6, 0x01, 0x4a, 0xc0, 0x05, 0x22, 0xbc,
+    0xe6, 0x01, 0x4a, 0xc1, 0x05, 0x33, 0x90, 0x7a, 0x01, 0x4a, 0xc1, 0x05, 0x33, 0x93, 0x7a, 0x01,
+    0x4a, 0xc1, 0x05, 0x33, 0x96, 0x7a, 0x01, 0x47, 0xc1, 0x05, 0x33, 0x99, 0x7a, 0x01, 0x20, 0x34,
+    0x21, 0x12, 0x00, 0x17, 0x9c, 0x7a, 0x01, 0x02, 0x12, 0x00, 0x17, 0x9f, 0x7a, 0x01, 0x7a, 0x34,
+    0x21, 0x00, 0xc2, 0x05, 0x33, 0xa2, 0x6c, 0x00, 0x4a, 0xc2, 0x05, 0x33, 0xa5, 0x6c, 0x00, 0x4a,
+    0xc2, 0x05, 0x33, 0xa8, 0x6c, 0x00, 0x48, 0xc2, 0x05, 0x33, 0xab, 0xe6, 0x01, 0x10, 0x23, 0x12,
+    0x00, 0x18, 0xae, 0xe6, 0x01, 0x01, 0x12, 0x00, 0x18, 0xb1, 0xe6, 0x01, 0x6a, 0x23, 0x00, 0xc3,
+    0x05, 0x33, 0xb4, 0x6c, 0x00, 0x4a, 0xc3, 0x05, 0x33, 0xb7, 0x6c, 0x00, 0x4a, 0xc3, 0x05, 0x33,
+    0xba, 0x6c, 0x00, 0x48, 0xc3, 0x05, 0x33, 0xbd, 0xbe, 0x02, 0x10, 0x22, 0x12, 0x00, 0x18, 0xc0,
+    0xbe, 0x02, 0x01, 0x12, 0x00, 0x18, 0xc3, 0xbe, 0x02, 0x6a, 0x22, 0x00, 0xc4, 0x05, 0x33, 0xc6,
+    0x6c, 0x00, 0x4a, 0xc4, 0x05, 0x33, 0xc9, 0x6c, 0x00, 0x4a, 0xc4, 0x05, 0x33, 0xcc, 0x6c, 0x00,
+    0x4a, 0xc4, 0x05, 0x33, 0xcf, 0x2a, 0x03, 0x4a, 0xc4, 0x05, 0x33, 0xd2, 0x2a, 0x03, 0x4a, 0xc4,
+    0x05, 0x33, 0xd5, 0x2a, 0x03, 0x4a, 0xc5, 0x05, 0x33, 0xd8, 0x6c, 0x00, 0x4a, 0xc5, 0x05, 0x33,
+    0xdb, 0x6c, 0x00, 0x4a, 0xc5, 0x05, 0x33, 0xde, 0x6c, 0x00, 0x4a, 0xc5, 0x05, 0x33, 0xe1, 0x2a,
+    0x03, 0x4a, 0xc5, 0x05, 0x33, 0xe4, 0x2a, 0x03, 0x4a, 0xc5, 0x05, 0x33, 0xe7, 0x2a, 0x03, 0x4a,
+    0xc6, 0x05, 0x33, 0xea, 0x6c, 0x00, 0x4a, 0xc6, 0x05, 0x33, 0xed, 0x6c, 0x00, 0x4a, 0xc6, 0x05,
+    0x33, 0xf0, 0x6c, 0x00, 0x4a, 0xc6, 0x05, 0x33, 0xf3, 0x1c, 0x02, 0x4a, 0xc6, 0x05, 0x33, 0xf6,
+    0x1c, 0x02, 0x4a, 0xc6, 0x05, 0x33, 0xf9, 0x1c, 0x02, 0x30, 0xc7, 0x05, 0x33, 0xef, 0xd6, 0x07,
+    0x6c, 0x00, 0x4a, 0xc7, 0x05, 0x33, 0xff, 0x6c, 0x00, 0x59, 0xc7, 0x05, 0x33, 0x02, 0x19, 0x6c,
+    0x00, 0x30, 0xc7, 0x05, 0x33, 0x5e, 0xe5, 0x07, 0x1c, 0x02, 0x40, 0xc7, 0x05, 0x33, 0x08, 0x12,
+    0x00, 0x06, 0x1c, 0x02, 0x42, 0xc7, 0x05, 0x33, 0x0b, 0x36, 0x00, 0x04, 0x12, 0x00, 0x42, 0xc8,
+    0x05, 0x33, 0x0e, 0x36, 0x00, 0x04, 0x48, 0x00, 0x42, 0xc8, 0x05, 0x33, 0x11, 0x36, 0x00, 0x07,
+    0x12, 0x00, 0x1a, 0x14, 0x6c, 0x00, 0x47, 0xc8, 0x05, 0x33, 0x17, 0x6c, 0x00, 0x20, 0x30, 0x22,
+    0x12, 0x00, 0x17, 0x1a, 0x6c, 0x00, 0x02, 0x12, 0x00, 0x17, 0x1d, 0x6c, 0x00, 0x70, 0x30, 0x22,
+    0x00, 0xc9, 0x05, 0x33, 0x20, 0x12, 0x00, 0x15, 0x0d, 0x48, 0x00, 0x40, 0xc9, 0x05, 0x33, 0x23,
+    0x12, 0x00, 0x18, 0x0f, 0x12, 0x00, 0x10, 0x26, 0x12, 0x00, 0x18, 0x10, 0x12, 0x00, 0x12, 0x29,
+    0x36, 0x00, 0x02, 0xb4, 0x00, 0x10, 0x21, 0x12, 0x00, 0x12, 0x2c, 0x36, 0x00, 0x07, 0x12, 0x00,
+    0x12, 0x2f, 0x36, 0x00, 0x04, 0x12, 0x00, 0x42, 0xca, 0x05, 0x33, 0x32, 0xa2, 0x00, 0x04, 0x9e,
+    0x88, 0x42, 0xca, 0x05, 0x33, 0x35, 0xa2, 0x00, 0x07, 0x12, 0x00, 0x12, 0x38, 0xa2, 0x00, 0x07,
+    0x12, 0x00, 0x14, 0x3b, 0x36, 0x00, 0x00, 0xb4, 0x00, 0x10, 0xa1, 0x12, 0x00, 0x14, 0x3e, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x14, 0x41, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0xcb, 0x05, 0x33, 0x44,
+    0x6c, 0x00, 0x4a, 0xcb, 0x05, 0x33, 0x47, 0x6c, 0x00, 0x4a, 0xcb, 0x05, 0x33, 0x4a, 0x6c, 0x00,
+    0x47, 0xcb, 0x05, 0x33, 0x4d, 0x6c, 0x00, 0x11, 0x34, 0x48, 0x00, 0x17, 0x50, 0x6c, 0x00, 0x02,
+    0x12, 0x00, 0x17, 0x53, 0x6c, 0x00, 0x72, 0x34, 0xa1, 0x00, 0xcc, 0x05, 0x33, 0x56, 0x0e, 0x01,
+    0x04, 0x48, 0x00, 0x42, 0xcc, 0x05, 0x33, 0x59, 0x0e, 0x01, 0x07, 0x12, 0x00, 0x12, 0x5c, 0x0e,
+    0x01, 0x07, 0x12, 0x00, 0x14, 0x5f, 0x36, 0x00, 0x00, 0x20, 0x01, 0x01, 0x48, 0x00, 0x14, 0x62,
+    0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x65, 0x36, 0x00, 0x02, 0x12, 0x00, 0x4a, 0xcd, 0x05, 0x33,
+    0x68, 0xd8, 0x00, 0x4a, 0xcd, 0x05, 0x33, 0x6b, 0xd8, 0x00, 0x4a, 0xcd, 0x05, 0x33, 0x6e, 0xd8,
+    0x00, 0x47, 0xcd, 0x05, 0x33, 0x71, 0xd8, 0x00, 0x20, 0x2c, 0xa3, 0x12, 0x00, 0x17, 0x74, 0xd8,
+    0x00, 0x02, 0x12, 0x00, 0x17, 0x77, 0xd8, 0x00, 0x7a, 0x2c, 0xa3, 0x00, 0xce, 0x05, 0x33, 0x7a,
+    0x6c, 0x00, 0x4a, 0xce, 0x05, 0x33, 0x7d, 0x6c, 0x00, 0x4a, 0xce, 0x05, 0x33, 0x80, 0x6c, 0x00,
+    0x48, 0xce, 0x05, 0x33, 0x83, 0x6c, 0x00, 0x10, 0xa2, 0x12, 0x00, 0x18, 0x86, 0x6c, 0x00, 0x01,
+    0x12, 0x00, 0x18, 0x89, 0x6c, 0x00, 0x6a, 0xa2, 0x00, 0xcf, 0x05, 0x33, 0x8c, 0x6c, 0x00, 0x4a,
+    0xcf, 0x05, 0x33, 0x8f, 0x6c, 0x00, 0x4a, 0xcf, 0x05, 0x33, 0x92, 0x6c, 0x00, 0x48, 0xcf, 0x05,
+    0x33, 0x95, 0x1c, 0x02, 0x01, 0x48, 0x00, 0x18, 0x98, 0x1c, 0x02, 0x01, 0x12, 0x00, 0x18, 0x9b,
+    0x1c, 0x02, 0x3d, 0xa2, 0x00, 0xd0, 0x3a, 0x08, 0x1d, 0xd0, 0x3a, 0x08, 0x1d, 0xd0, 0x3a, 0x08,
+    0x1d, 0xd0, 0x3a, 0x08, 0x1d, 0xd0, 0x3a, 0x08, 0x1d, 0xd0, 0x3a, 0x08, 0x1d, 0xd1, 0x3a, 0x08,
+    0x1d, 0xd1, 0x3a, 0x08, 0x1d, 0xd1, 0x3a, 0x08, 0x1d, 0xd1, 0x3a, 0x08, 0x1d, 0xd1, 0x3a, 0x08,
+    0x1d, 0xd1, 0x3a, 0x08, 0x1d, 0xd2, 0x2c, 0x07, 0x1d, 0xd2, 0x2c, 0x07, 0x1d, 0xd2, 0x2c, 0x07,
+    0x1d, 0xd2, 0x2c, 0x07, 0x1d, 0xd2, 0x2c, 0x07, 0x1d, 0xd2, 0x2c, 0x07, 0x1d, 0xd3, 0x2c, 0x07,
+    0x1d, 0xd3, 0x2c, 0x07, 0x1d, 0xd3, 0x2c, 0x07, 0x1d, 0xd3, 0x2c, 0x07, 0x1d, 0xd3, 0x2c, 0x07,
+    0x1d, 0xd3, 0x2c, 0x07, 0x1d, 0xd4, 0x2c, 0x07, 0x1d, 0xd4, 0x2c, 0x07, 0x1d, 0xd4, 0x2c, 0x07,
+    0x1d, 0xd4, 0x2c, 0x07, 0x1d, 0xd4, 0x2c, 0x07, 0x1d, 0xd4, 0x2c, 0x07, 0x4a, 0xd5, 0x05, 0x33,
+    0x9e, 0x10, 0x05, 0x4a, 0xd5, 0x05, 0x33, 0xa1, 0x10, 0x05, 0x4a, 0xd5, 0x05, 0x33, 0xa4, 0x10,
+    0x05, 0x4a, 0xd5, 0x05, 0x33, 0xa7, 0x10, 0x05, 0x4a, 0xd5, 0x05, 0x33, 0xaa, 0x10, 0x05, 0x4a,
+    0xd5, 0x05, 0x33, 0xad, 0x10, 0x05, 0x4a, 0xd6, 0x05, 0x22, 0xbe, 0x2e, 0x0b, 0x4a, 0xd6, 0x05,
+    0x22, 0xc0, 0x2e, 0x0b, 0x4a, 0xd6, 0x05, 0x22, 0xc2, 0x2e, 0x0b, 0x1d, 0xd7, 0xa2, 0x00, 0x1d,
+    0xd7, 0xa2, 0x00, 0x1d, 0xd7, 0xa2, 0x00, 0x1d, 0xd7, 0xa2, 0x00, 0x1d, 0xd7, 0xa2, 0x00, 0x1d,
+    0xd7, 0xa2, 0x00, 0x4a, 0xd8, 0x05, 0x33, 0xb0, 0x96, 0x03, 0x4a, 0xd8, 0x05, 0x33, 0xb3, 0x96,
+    0x03, 0x4a, 0xd8, 0x05, 0x33, 0xb6, 0x96, 0x03, 0x4a, 0xd8, 0x05, 0x33, 0xb9, 0xb2, 0x05, 0x4a,
+    0xd8, 0x05, 0x33, 0xbc, 0xb2, 0x05, 0x4a, 0xd8, 0x05, 0x33, 0xbf, 0xb2, 0x05, 0x4a, 0xd9, 0x05,
+    0x33, 0xc2, 0x6c, 0x00, 0x4a, 0xd9, 0x05, 0x33, 0xc5, 0x6c, 0x00, 0x4a, 0xd9, 0x05, 0x33, 0xc8,
+    0x6c, 0x00, 0x4a, 0xd9, 0x05, 0x33, 0xcb, 0xb2, 0x05, 0x4a, 0xd9, 0x05, 0x33, 0xce, 0xb2, 0x05,
+    0x4a, 0xd9, 0x05, 0x33, 0xd1, 0xb2, 0x05, 0x4a, 0xda, 0x05, 0x33, 0xd4, 0xb2, 0x05, 0x4a, 0xda,
+    0x05, 0x33, 0xd7, 0xb2, 0x05, 0x4a, 0xda, 0x05, 0x33, 0xda, 0xb2, 0x05, 0x4a, 0xda, 0x05, 0x33,
+    0xdd, 0xb2, 0x05, 0x4a, 0xda, 0x05, 0x33, 0xe0, 0xb2, 0x05, 0x4a, 0xda, 0x05, 0x33, 0xe3, 0xb2,
+    0x05, 0x4a, 0xdb, 0x05, 0x33, 0xe6, 0xd8, 0x00, 0x4a, 0xdb, 0x05, 0x33, 0xe9, 0xd8, 0x00, 0x4a,
+    0xdb, 0x05, 0x33, 0xec, 0xd8, 0x00, 0x4a, 0xdb, 0x05, 0x33, 0xef, 0xb2, 0x05, 0x4a, 0xdb, 0x05,
+    0x33, 0xf2, 0xb2, 0x05, 0x4a, 0xdb, 0x05, 0x33, 0xf5, 0xb2, 0x05, 0x4a, 0xdc, 0x05, 0x33, 0xf8,
+    0x6c, 0x00, 0x4a, 0xdc, 0x05, 0x33, 0xfb, 0x6c, 0x00, 0x4a, 0xdc, 0x05, 0x33, 0xfe, 0x6c, 0x00,
+    0x59, 0xdc, 0x05, 0x33, 0x01, 0x1a, 0xb2, 0x05, 0x40, 0xdc, 0x05, 0x33, 0x04, 0x12, 0x00, 0x06,
+    0xb2, 0x05, 0x40, 0xdc, 0x05, 0x33, 0x07, 0x12, 0x00, 0x06, 0xb2, 0x05, 0x44, 0xdd, 0x05, 0x33,
+    0x0a, 0x36, 0x00, 0x02, 0x48, 0x00, 0x44, 0xdd, 0x05, 0x33, 0x0d, 0x36, 0x00, 0x05, 0x12, 0x00,
+    0x14, 0x10, 0x36, 0x00, 0x05, 0x12, 0x00, 0x17, 0x13, 0x6c, 0x00, 0x11, 0x30, 0x48, 0x00, 0x17,
+    0x16, 0x6c, 0x00, 0x02, 0x12, 0x00, 0x17, 0x19, 0x6c, 0x00, 0x4d, 0x30, 0xa2, 0x00, 0xde, 0xe0,
+    0x10, 0x1d, 0xde, 0xe0, 0x10, 0x1d, 0xde, 0xe0, 0x10, 0x1d, 0xde, 0xe0, 0x10, 0x1d, 0xde, 0xe0,
+    0x10, 0x1d, 0xde, 0xe0, 0x10, 0x1d, 0xe0, 0xe0, 0x10, 0x1d, 0xe0, 0xe0, 0x10, 0x1d, 0xe0, 0xe0,
+    0x10, 0x1d, 0xe0, 0xe0, 0x10, 0x1d, 0xe0, 0xe0, 0x10, 0x1d, 0xe0, 0xe0, 0x10, 0x1d, 0xe2, 0x9c,
+    0x0f, 0x1d, 0xe2, 0x9c, 0x0f, 0x1d, 0xe2, 0x9c, 0x0f, 0x1d, 0xe2, 0x9c, 0x0f, 0x1d, 0xe2, 0x9c,
+    0x0f, 0x1d, 0xe2, 0x9c, 0x0f, 0x1d, 0xe3, 0xd8, 0x00, 0x1d, 0xe3, 0xd8, 0x00, 0x1d, 0xe3, 0xd8,
+    0x00, 0x1d, 0xe3, 0xd8, 0x00, 0x1d, 0xe3, 0xd8, 0x00, 0x1d, 0xe3, 0xd8, 0x00, 0x1d, 0xe4, 0xfc,
+    0x12, 0x1d, 0xe4, 0xfc, 0x12, 0x1d, 0xe4, 0xfc, 0x12, 0x1d, 0xe4, 0xfc, 0x12, 0x1d, 0xe4, 0xfc,
+    0x12, 0x1d, 0xe4, 0xfc, 0x12, 0x13, 0xe5, 0x4c, 0x11, 0x06, 0x60, 0x42, 0x13, 0xe5, 0x4c, 0x11,
+    0x06, 0x60, 0x42, 0x13, 0xe5, 0x4c, 0x11, 0x06, 0x60, 0x42, 0x13, 0xe5, 0x4c, 0x11, 0x06, 0xcc,
+    0x42, 0x13, 0xe5, 0x4c, 0x11, 0x06, 0xcc, 0x42, 0x13, 0xe5, 0x4c, 0x11, 0x06, 0xcc, 0x42, 0x1d,
+    0xe6, 0x44, 0x01, 0x1d, 0xe6, 0x44, 0x01, 0x1d, 0xe6, 0x44, 0x01, 0x1d, 0xe6, 0x44, 0x01, 0x1d,
+    0xe6, 0x44, 0x01, 0x1d, 0xe6, 0x44, 0x01, 0x30, 0xe7, 0x05, 0x44, 0x24, 0x5a, 0x07, 0x8a, 0x21,
+    0x30, 0xe7, 0x05, 0x44, 0x24, 0x5a, 0x07, 0x8a, 0x21, 0x30, 0xe7, 0x05, 0x44, 0x24, 0x5a, 0x07,
+    0x8a, 0x21, 0x30, 0xe7, 0x05, 0x44, 0x24, 0x5a, 0x04, 0x8a, 0x21, 0x20, 0x04, 0xac, 0x12, 0x00,
+    0x00, 0x24, 0x5a, 0x04, 0x8a, 0x21, 0x02, 0x12, 0x00, 0x00, 0x24, 0x5a, 0x04, 0x8a, 0x21, 0x4d,
+    0x04, 0xac, 0x00, 0xe8, 0x90, 0x12, 0x1d, 0xe8, 0x90, 0x12, 0x1d, 0xe8, 0x90, 0x12, 0x1d, 0xe8,
+    0x90, 0x12, 0x1d, 0xe8, 0x90, 0x12, 0x1d, 0xe8, 0x90, 0x12, 0x12, 0xe9, 0x6e, 0x1f, 0x21, 0x10,
+    0x2a, 0x48, 0x00, 0x00, 0x14, 0x04, 0x12, 0xe9, 0x6e, 0x1f, 0x28, 0x10, 0x2b, 0x12, 0x00, 0x00,
+    0x6e, 0x1f, 0x28, 0x16, 0x2c, 0x12, 0x00, 0x00, 0x6e, 0x1f, 0x01, 0x36, 0x00, 0x02, 0x84, 0x42,
+    0x12, 0xe9, 0x6e, 0x1f, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x6e, 0x1f, 0x01, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x12, 0xea, 0xd8, 0x1b, 0x25, 0x10, 0x4a, 0x48, 0x00, 0x12, 0xea, 0xd8, 0x1b,
+    0x28, 0x10, 0x4b, 0x12, 0x00, 0x00, 0xd8, 0x1b, 0x28, 0x10, 0x4c, 0x12, 0x00, 0x00, 0xd8, 0x1b,
+    0x01, 0x36, 0x00, 0x02, 0xb4, 0x1b, 0x12, 0xea, 0xd8, 0x1b, 0x01, 0x36, 0x00, 0x05, 0x12, 0x00,
+    0x00, 0xd8, 0x1b, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x12, 0xeb, 0xd8, 0x1b, 0x07, 0x6c, 0x00,
+    0x12, 0xeb, 0xd8, 0x1b, 0x07, 0x6c, 0x00, 0x12, 0xeb, 0xd8, 0x1b, 0x07, 0x6c, 0x00, 0x12, 0xeb,
+    0xd8, 0x1b, 0x05, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x01, 0xa6, 0x23, 0x04, 0x6c, 0x00, 0x01,
+    0x12, 0x00, 0x01, 0xa6, 0x23, 0x04, 0x6c, 0x00, 0x32, 0xac, 0x00, 0xec, 0x6e, 0x1f, 0x07, 0x44,
+    0x01, 0x12, 0xec, 0x6e, 0x1f, 0x07, 0x44, 0x01, 0x12, 0xec, 0x6e, 0x1f, 0x07, 0x44, 0x01, 0x12,
+    0xec, 0x6e, 0x1f, 0x05, 0x44, 0x01, 0x10, 0xa2, 0x12, 0x00, 0x00, 0x6e, 0x1f, 0x05, 0x44, 0x01,
+    0x01, 0x12, 0x00, 0x00, 0x6e, 0x1f, 0x05, 0x44, 0x01, 0x3d, 0xa2, 0x00, 0xee, 0xc0, 0x3c, 0x1d,
+    0xee, 0xc0, 0x3c, 0x1d, 0xee, 0xc0, 0x3c, 0x1d, 0xee, 0xc0, 0x3c, 0x1d, 0xee, 0xc0, 0x3c, 0x1d,
+    0xee, 0xc0, 0x3c, 0x1d, 0xef, 0x54, 0x3c, 0x1d, 0xef, 0x54, 0x3c, 0x1d, 0xef, 0x54, 0x3c, 0x1d,
+    0xef, 0x54, 0x3c, 0x1d, 0xef, 0x54, 0x3c, 0x1d, 0xef, 0x54, 0x3c, 0x40, 0xf9, 0x05, 0x44, 0x9c,
+    0x44, 0x01, 0x42, 0x1d, 0x0d, 0x5c, 0x00, 0x48, 0x00, 0x42, 0xf9, 0x05, 0x44, 0xa0, 0x20, 0x25,
+    0x07, 0x12, 0x00, 0x12, 0xa4, 0x20, 0x25, 0x07, 0x12, 0x00, 0x14, 0xa8, 0x36, 0x00, 0x02, 0xb4,
+    0x00, 0x44, 0xf9, 0x05, 0x44, 0xac, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0x1b, 0xed, 0x01, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x4a, 0xfa, 0x05, 0x44, 0xb4, 0x6c, 0x00, 0x4a, 0xfa, 0x05, 0x44, 0xb8,
+    0x6c, 0x00, 0x4a, 0xfa, 0x05, 0x44, 0xbc, 0x6c, 0x00, 0x48, 0xfa, 0x05, 0x44, 0xc0, 0x6c, 0x00,
+    0x10, 0xac, 0x12, 0x00, 0x18, 0xc4, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0xe3, 0xed, 0x05, 0x6c,
+    0x00, 0x3d, 0xac, 0x00, 0xfb, 0xc8, 0x16, 0x1d, 0xfb, 0xc8, 0x16, 0x1d, 0xfb, 0xc8, 0x16, 0x1d,
+    0xfb, 0xc8, 0x16, 0x1d, 0xfb, 0xc8, 0x16, 0x1d, 0xfb, 0xc8, 0x16, 0x1d, 0xfc, 0x38, 0x04, 0x1d,
+    0xfc, 0x38, 0x04, 0x1d, 0xfc, 0x38, 0x04, 0x1d, 0xfc, 0x38, 0x04, 0x1d, 0xfc, 0x38, 0x04, 0x1d,
+    0xfc, 0x38, 0x04, 0x1d, 0xfd, 0xb0, 0x01, 0x1d, 0xfd, 0xb0, 0x01, 0x1d, 0xfd, 0xb0, 0x01, 0x1d,
+    0xfd, 0xb0, 0x01, 0x1d, 0xfd, 0xb0, 0x01, 0x1d, 0xfd, 0xb0, 0x01, 0x1d, 0xfe, 0xb0, 0x01, 0x1d,
+    0xfe, 0xb0, 0x01, 0x1d, 0xfe, 0xb0, 0x01, 0x1d, 0xfe, 0xb0, 0x01, 0x1d, 0xfe, 0xb0, 0x01, 0x1d,
+    0xfe, 0xb0, 0x01, 0x1d, 0xff, 0xb0, 0x01, 0x1d, 0xff, 0xb0, 0x01, 0x1d, 0xff, 0xb0, 0x01, 0x1d,
+    0xff, 0xb0, 0x01, 0x1d, 0xff, 0xb0, 0x01, 0x1d, 0xff, 0xb0, 0x01, 0x2c, 0x00, 0x06, 0xb0, 0x01,
+    0x2c, 0x00, 0x06, 0xb0, 0x01, 0x2c, 0x00, 0x06, 0xb0, 0x01, 0x2c, 0x00, 0x06, 0xb0, 0x01, 0x2c,
+    0x00, 0x06, 0xb0, 0x01, 0x2c, 0x00, 0x06, 0xb0, 0x01, 0x40, 0x05, 0x06, 0x33, 0xf4, 0x4a, 0x5e,
+    0x04, 0x38, 0x1f, 0x10, 0x60, 0x12, 0x00, 0x10, 0xf8, 0x12, 0x00, 0x04, 0x38, 0x1f, 0x01, 0x12,
+    0x00, 0x27, 0x1c, 0x1a, 0x38, 0x1f, 0x01, 0x12, 0x00, 0x14, 0xfc, 0x36, 0x00, 0x00, 0x08, 0x07,
+    0x10, 0x61, 0x12, 0x00, 0x00, 0x09, 0xcb, 0x05, 0x38, 0x1f, 0x01, 0x12, 0x00, 0x14, 0x1f, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x82, 0x08, 0x06, 0x33, 0x22, 0x1a, 0x00, 0x00, 0x9e, 0xaa, 0x22, 0x30,
+    0x00, 0x1c, 0x43, 0x12, 0x00, 0x10, 0x25, 0x12, 0x00, 0x02, 0xaa, 0x22, 0x03, 0x12, 0x00, 0x10,
+    0x28, 0x12, 0x00, 0x02, 0xaa, 0x22, 0x00, 0x12, 0x00, 0x48, 0x09, 0x06, 0x33, 0x2b, 0x36, 0x00,
+    0x10, 0x44, 0x12, 0x00, 0x18, 0x2e, 0x36, 0x00, 0x01, 0x12, 0x00, 0x18, 0x31, 0x36, 0x00, 0x6a,
+    0x44, 0x00, 0x0a, 0x06, 0x33, 0x34, 0x6c, 0x00, 0x4a, 0x0a, 0x06, 0x33, 0x37, 0x6c, 0x00, 0x4a,
+    0x0a, 0x06, 0x33, 0x3a, 0x6c, 0x00, 0x4a, 0x0b, 0x06, 0x33, 0x3d, 0x6c, 0x00, 0x4a, 0x0b, 0x06,
+    0x33, 0x40, 0x6c, 0x00, 0x4a, 0x0b, 0x06, 0x33, 0x43, 0x6c, 0x00, 0x21, 0x12, 0x06, 0x5e, 0xc5,
+    0x12, 0xc8, 0x56, 0x25, 0x00, 0x8c, 0x01, 0x21, 0x12, 0x06, 0x5e, 0xc5, 0x12, 0xc8, 0x56, 0x25,
+    0x03, 0x12, 0x00, 0x00, 0x1c, 0x02, 0x12, 0xc8, 0x56, 0x25, 0x03, 0x12, 0x00, 0x00, 0x1c, 0x02,
+    0x01, 0x36, 0x00, 0x02, 0xf8, 0x01, 0x21, 0x12, 0x06, 0x5e, 0xc5, 0x01, 0x36, 0x00, 0x05, 0x12,
+    0x00, 0x00, 0x1c, 0x02, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x21, 0x13, 0x06, 0x5e, 0xc5, 0x07,
+    0x6c, 0x00, 0x21, 0x13, 0x06, 0x5e, 0xc5, 0x07, 0x6c, 0x00, 0x21, 0x13, 0x06, 0x5e, 0xc5, 0x07,
+    0x6c, 0x00, 0x21, 0x13, 0x06, 0x5e, 0xc5, 0x05, 0x6c, 0x00, 0x10, 0xac, 0x12, 0x00, 0x00, 0x1c,
+    0x02, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0x1c, 0x02, 0x05, 0x6c, 0x00, 0x41, 0xac, 0x00,
+    0x14, 0x06, 0xfa, 0x29, 0x07, 0x6c, 0x00, 0x21, 0x14, 0x06, 0xfa, 0x29, 0x07, 0x6c, 0x00, 0x21,
+    0x14, 0x06, 0xfa, 0x29, 0x07, 0x6c, 0x00, 0x21, 0x14, 0x06, 0xfa, 0x29, 0x07, 0xd8, 0x00, 0x21,
+    0x14, 0x06, 0xfa, 0x29, 0x07, 0xd8, 0x00, 0x21, 0x14, 0x06, 0xfa, 0x29, 0x07, 0xd8, 0x00, 0x21,
+    0x15, 0x06, 0x98, 0x22, 0x07, 0x6c, 0x00, 0x21, 0x15, 0x06, 0x98, 0x22, 0x07, 0x6c, 0x00, 0x21,
+    0x15, 0x06, 0x98, 0x22, 0x07, 0x6c, 0x00, 0x21, 0x15, 0x06, 0x98, 0x22, 0x07, 0xd8, 0x00, 0x21,
+    0x15, 0x06, 0x98, 0x22, 0x07, 0xd8, 0x00, 0x21, 0x15, 0x06, 0x98, 0x22, 0x07, 0xd8, 0x00, 0x21,
+    0x16, 0x06, 0x22, 0x29, 0x07, 0x6c, 0x00, 0x21, 0x16, 0x06, 0x22, 0x29, 0x07, 0x6c, 0x00, 0x21,
+    0x16, 0x06, 0x22, 0x29, 0x07, 0x6c, 0x00, 0x21, 0x16, 0x06, 0x22, 0x29, 0x04, 0x6c, 0x00, 0x20,
+    0x0c, 0xa2, 0x12, 0x00, 0x00, 0x22, 0x29, 0x04, 0x6c, 0x00, 0x02, 0x12, 0x00, 0x00, 0x22, 0x29,
+    0x04, 0x6c, 0x00, 0x00, 0x3c, 0x42, 0x20, 0x06, 0x55, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x30, 0x17,
+    0x06, 0x55, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x30, 0x17, 0x06, 0x55, 0x3c, 0x0c, 0x07, 0x6c, 0x00,
+    0x30, 0x17, 0x06, 0x55, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x30, 0x17, 0x06, 0x55, 0x3c, 0x0c, 0x07,
+    0x6c, 0x00, 0x30, 0x17, 0x06, 0x55, 0x3c, 0x0c, 0x07, 0x6c, 0x00, 0x1d, 0x1a, 0x88, 0x02, 0x1d,
+    0x1a, 0x88, 0x02, 0x1d, 0x1a, 0x88, 0x02, 0x1d, 0x1a, 0x88, 0x02, 0x1d, 0x1a, 0x88, 0x02, 0x1d,
+    0x1a, 0x88, 0x02, 0x1d, 0x1b, 0x88, 0x02, 0x1d, 0x1b, 0x88, 0x02, 0x1d, 0x1b, 0x88, 0x02, 0x1d,
+    0x1b, 0x88, 0x02, 0x1d, 0x1b, 0x88, 0x02, 0x1d, 0x1b, 0x88, 0x02, 0x1d, 0x1c, 0x88, 0x02, 0x1d,
+    0x1c, 0x88, 0x02, 0x1d, 0x1c, 0x88, 0x02, 0x1d, 0x1c, 0x88, 0x02, 0x1d, 0x1c, 0x88, 0x02, 0x1d,
+    0x1c, 0x88, 0x02, 0x1d, 0x1d, 0x88, 0x02, 0x1d, 0x1d, 0x88, 0x02, 0x1d, 0x1d, 0x88, 0x02, 0x1d,
+    0x1d, 0x88, 0x02, 0x1d, 0x1d, 0x88, 0x02, 0x1d, 0x1d, 0x88, 0x02, 0x1d, 0x1e, 0x88, 0x02, 0x1d,
+    0x1e, 0x88, 0x02, 0x1d, 0x1e, 0x88, 0x02, 0x1d, 0x1e, 0x88, 0x02, 0x1d, 0x1e, 0x88, 0x02, 0x1d,
+    0x1e, 0x88, 0x02, 0x1d, 0x1f, 0x88, 0x02, 0x1d, 0x1f, 0x88, 0x02, 0x1d, 0x1f, 0x88, 0x02, 0x1d,
+    0x1f, 0x88, 0x02, 0x1d, 0x1f, 0x88, 0x02, 0x1d, 0x1f, 0x88, 0x02, 0x24, 0x20, 0x06, 0x10, 0x20,
+    0x04, 0xf0, 0x0c, 0x24, 0x20, 0x06, 0x10, 0x20, 0x07, 0x12, 0x00, 0x0b, 0x24, 0x48, 0x24, 0x20,
+    0x06, 0x10, 0x20, 0x04, 0x7a, 0x2e, 0x24, 0x20, 0x06, 0x10, 0x20, 0x07, 0x12, 0x00, 0x09, 0x24,
+    0x48, 0x63, 0xa1, 0x00, 0x21, 0x06, 0x44, 0xcc, 0x64, 0x0b, 0x03, 0xde, 0x39, 0x40, 0x21, 0x06,
+    0x44, 0xd0, 0x12, 0x00, 0x18, 0x2b, 0x12, 0x00, 0x22, 0xd4, 0x0b, 0x2e, 0x0b, 0x06, 0x12, 0x00,
+    0x14, 0xd8, 0x36, 0x00, 0x00, 0x48, 0x00, 0x10, 0x21, 0x12, 0x00, 0x14, 0xdc, 0x36, 0x00, 0x05,
+    0x12, 0x00, 0x14, 0xe0, 0x36, 0x00, 0x02, 0x12, 0x00, 0x31, 0x22, 0x06, 0x44, 0xa8, 0x0c, 0x06,
+    0x4a, 0x31, 0x31, 0x22, 0x06, 0x44, 0xa8, 0x0c, 0x06, 0xd0, 0x2f, 0x31, 0x22, 0x06, 0x44, 0xa8,
+    0x0c, 0x06, 0xd0, 0x2f, 0x31, 0x22, 0x06, 0x44, 0xa8, 0x0c, 0x06, 0x4a, 0x31, 0x31, 0x22, 0x06,
+    0x44, 0xa8, 0x0c, 0x06, 0x4a, 0x31, 0x31, 0x22, 0x06, 0x44, 0xa8, 0x0c, 0x06, 0x4a, 0x31, 0x31,
+    0x23, 0x06, 0x44, 0x3c, 0x0c, 0x02, 0x44, 0x01, 0x00, 0x48, 0x00, 0x31, 0x23, 0x06, 0x44, 0x3c,
+    0x0c, 0x02, 0x44, 0x01, 0x03, 0x12, 0x00, 0x00, 0x3c, 0x0c, 0x03, 0x44, 0x01, 0x03, 0x12, 0x00,
+    0x01, 0x3c, 0x0c, 0x02, 0x44, 0x01, 0x00, 0x18, 0x0c, 0x31, 0x23, 0x06, 0x44, 0x3c, 0x0c, 0x02,
+    0x44, 0x01, 0x03, 0x12, 0x00, 0x00, 0x3c, 0x0c, 0x03, 0x44, 0x01, 0x00, 0x12, 0x00, 0x1d, 0x24,
+    0x6c, 0x00, 0x1d, 0x24, 0x6c, 0x00, 0x1d, 0x24, 0x6c, 0x00, 0x1d, 0x24, 0x6c, 0x00, 0x1d, 0x24,
+    0x6c, 0x00, 0x1d, 0x24, 0x6c, 0x00, 0x2c, 0x28, 0x06, 0x20, 0x0a, 0x2c, 0x28, 0x06, 0x20, 0x0a,
+    0x2c, 0x28, 0x06, 0x20, 0x0a, 0x2c, 0x28, 0x06, 0x20, 0x0a, 0x2c, 0x28, 0x06, 0x20, 0x0a, 0x2c,
+    0x28, 0x06, 0x20, 0x0a, 0x24, 0x28, 0x06, 0xb4, 0x09, 0x04, 0x64, 0x02, 0x33, 0x28, 0x06, 0x44,
+    0x22, 0x68, 0x07, 0x12, 0x00, 0x03, 0x22, 0x68, 0x07, 0x12, 0x00, 0x10, 0x14, 0xb4, 0x00, 0x03,
+    0x76, 0x2f, 0x20, 0x38, 0xa3, 0x12, 0x00, 0x03, 0x34, 0x68, 0x07, 0x12, 0x00, 0x03, 0x34, 0x68,
+    0x04, 0x12, 0x00, 0x40, 0x29, 0x06, 0x33, 0x46, 0xee, 0x08, 0x31, 0x0d, 0x0d, 0x60, 0xb4, 0x00,
+    0x10, 0x60, 0x12, 0x00, 0x10, 0x49, 0x12, 0x00, 0x18, 0x0f, 0x12, 0x00, 0x13, 0x4c, 0x12, 0x09,
+    0x06, 0x12, 0x00, 0x14, 0x4f, 0x36, 0x00, 0x02, 0x24, 0x09, 0x44, 0x29, 0x06, 0x33, 0x52, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x14, 0x55, 0x36, 0x00, 0x02, 0x12, 0x00, 0x2c, 0x2a, 0x06, 0xf8, 0x0a,
+    0x2c, 0x2a, 0x06, 0xf8, 0x0a, 0x2c, 0x2a, 0x06, 0xf8, 0x0a, 0x2c, 0x2a, 0x06, 0xf8, 0x0a, 0x2c,
+    0x2a, 0x06, 0xf8, 0x0a, 0x2c, 0x2a, 0x06, 0xf8, 0x0a, 0x15, 0x2a, 0x8c, 0x0a, 0x04, 0x20, 0x01,
+    0x31, 0x2a, 0x06, 0x44, 0xfa, 0x68, 0x06, 0x44, 0x01, 0x31, 0x2a, 0x06, 0x44, 0xfa, 0x68, 0x06,
+    0x44, 0x01, 0x48, 0x2a, 0x06, 0x44, 0x18, 0x44, 0x01, 0x10, 0xa4, 0x12, 0x00, 0x01, 0x0c, 0x69,
+    0x04, 0x44, 0x01, 0x01, 0x12, 0x00, 0x01, 0x0c, 0x69, 0x04, 0x44, 0x01, 0x35, 0xa4, 0x00, 0x2b,
+    0xb0, 0x01, 0x04, 0x80, 0x04, 0x2c, 0x2b, 0x06, 0x64, 0x0b, 0x2c, 0x2b, 0x06, 0x64, 0x0b, 0x2c,
+    0x2b, 0x06, 0x64, 0x0b, 0x2c, 0x2b, 0x06, 0x64, 0x0b, 0x2c, 0x2b, 0x06, 0x64, 0x0b, 0x1d, 0x2c,
+    0x64, 0x0b, 0x1d, 0x2c, 0x64, 0x0b, 0x1d, 0x2c, 0x64, 0x0b, 0x1d, 0x2c, 0x64, 0x0b, 0x1d, 0x2c,
+    0x64, 0x0b, 0x1d, 0x2c, 0x64, 0x0b, 0x2c, 0x2d, 0x06, 0x40, 0x14, 0x2c, 0x2d, 0x06, 0x40, 0x14,
+    0x2c, 0x2d, 0x06, 0x40, 0x14, 0x2c, 0x2d, 0x06, 0x40, 0x14, 0x2c, 0x2d, 0x06, 0x40, 0x14, 0x2c,
+    0x2d, 0x06, 0x40, 0x14, 0x42, 0x2e, 0x06, 0x44, 0x1c, 0x96, 0x03, 0x04, 0xf8, 0x01, 0x42, 0x2e,
+    0x06, 0x44, 0x20, 0x96, 0x03, 0x07, 0x12, 0x00, 0x12, 0x24, 0x96, 0x03, 0x07, 0x12, 0x00, 0x14,
+    0x28, 0x36, 0x00, 0x05, 0x48, 0x00, 0x14, 0x2c, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x30, 0x36,
+    0x00, 0x05, 0x12, 0x00, 0x0b, 0xfe, 0x31, 0x46, 0x2e, 0x06, 0x44, 0x34, 0x38, 0x04, 0x03, 0x12,
+    0x00, 0x16, 0x38, 0x38, 0x04, 0x03, 0x12, 0x00, 0x08, 0xfe, 0x31, 0x11, 0x38, 0x48, 0x00, 0x16,
+    0x3c, 0x38, 0x04, 0x03, 0x12, 0x00, 0x16, 0x40, 0x38, 0x04, 0x00, 0x12, 0x00, 0x42, 0x2f, 0x06,
+    0x44, 0x44, 0x52, 0x02, 0x04, 0xb4, 0x00, 0x40, 0x2f, 0x06, 0x44, 0x48, 0x12, 0x00, 0x06, 0xf4,
+    0x02, 0x40, 0x2f, 0x06, 0x44, 0x4c, 0x12, 0x00, 0x06, 0xf4, 0x02, 0x44, 0x2f, 0x06, 0x44, 0x50,
+    0x36, 0x00, 0x02, 0xf8, 0x01, 0x44, 0x2f, 0x06, 0x44, 0x54, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14,
+    0x58, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x5c, 0xbe, 0x02, 0x05, 0x48, 0x00, 0x12, 0x60, 0x36,
+    0x00, 0x07, 0x12, 0x00, 0x12, 0x64, 0x36, 0x00, 0x07, 0x12, 0x00, 0x1a, 0x68, 0x38, 0x04, 0x44,
+    0x2f, 0x06, 0x44, 0x6c, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x70, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03,
+    0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03,
+    0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03, 0x1d, 0x30, 0xcc, 0x03,
+    0x15, 0x31, 0x44, 0x01, 0x04, 0xd0, 0x02, 0x43, 0x31, 0x06, 0x44, 0x74, 0x7a, 0x01, 0x06, 0x12,
+    0x00, 0x13, 0x78, 0x7a, 0x01, 0x06, 0x12, 0x00, 0x14, 0x7c, 0x36, 0x00, 0x02, 0x8c, 0x01, 0x44,
+    0x31, 0x06, 0x44, 0x80, 0x36, 0x00, 0x05, 0x12, 0x00, 0x14, 0x84, 0x36, 0x00, 0x02, 0x12, 0x00,
+    0x1d, 0x32, 0xcc, 0x03, 0x1d, 0x32, 0xcc, 0x03, 0x1d, 0x32, 0xcc, 0x03, 0x1d, 0x32, 0xcc, 0x03,
+    0x1d, 0x32, 0xcc, 0x03, 0x1d, 0x32, 0xcc, 0x03, 0x1d, 0x33, 0xcc, 0x03, 0x1d, 0x33, 0xcc, 0x03,
+    0x1d, 0x33, 0xcc, 0x03, 0x1d, 0x33, 0xcc, 0x03, 0x1d, 0x33, 0xcc, 0x03, 0x1d, 0x33, 0xcc, 0x03,
+    0x4a, 0x34, 0x06, 0x44, 0x88, 0xcc, 0x03, 0x4a, 0x34, 0x06, 0x44, 0x8c, 0xcc, 0x03, 0x4a, 0x34,
+    0x06, 0x44, 0x90, 0xcc, 0x03, 0x4a, 0x34, 0x06, 0x44, 0x94, 0xcc, 0x03, 0x4a, 0x34, 0x06, 0x44,
+    0x98, 0xcc, 0x03, 0x4a, 0x34, 0x06, 0x44, 0x9c, 0xcc, 0x03, 0x44, 0x34, 0x06, 0x44, 0xa0, 0xce,
+    0x07, 0x05, 0x48, 0x00, 0x1a, 0xa4, 0xcc, 0x03, 0x4a, 0x34, 0x06, 0x44, 0xa8, 0xcc, 0x03, 0x46,
+    0x34, 0x06, 0x44, 0xac, 0x04, 0x08, 0x00, 0xa8, 0x03, 0x4a, 0x34, 0x06, 0x44, 0xb0, 0xcc, 0x03,
+    0x4a, 0x34, 0x06, 0x44, 0xb4, 0xcc, 0x03, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d,
+    0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d,
+    0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d,
+    0x35, 0x04, 0x08, 0x1d, 0x35, 0x04, 0x08, 0x1d, 0x36, 0x04, 0x08, 0x1d, 0x36, 0x04, 0x08, 0x1d,
+    0x36, 0x04, 0x08, 0x1d, 0x36, 0x04, 0x08, 0x1d, 0x36, 0x04, 0x08, 0x1d, 0x36, 0x04, 0x08, 0x1d,
+    0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d,
+    0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d,
+    0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d, 0x37, 0x38, 0x04, 0x1d,
+    0x38, 0x04, 0x08, 0x1d, 0x38, 0x04, 0x08, 0x1d, 0x38, 0x04, 0x08, 0x1d, 0x38, 0x04, 0x08, 0x1d,
+    0x38, 0x04, 0x08, 0x1d, 0x38, 0x04, 0x08, 0x1d, 0x39, 0x38, 0x04, 0x1d, 0x39, 0x38, 0x04, 0x1d,
+    0x39, 0x38, 0x04, 0x1d, 0x39, 0x38, 0x04, 0x1d, 0x39, 0x38, 0x04, 0x1d, 0x39, 0x38, 0x04, 0x1d,
+    0x3a, 0x38, 0x04, 0x1d, 0x3a, 0x38, 0x04, 0x1d, 0x3a, 0x38, 0x04, 0x1d, 0x3a, 0x38, 0x04, 0x1d,
+    0x3a, 0x38, 0x04, 0x1d, 0x3a, 0x38, 0x04, 0x1d, 0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d,
+    0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d,
+    0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x1d,
+    0x3b, 0x04, 0x08, 0x1d, 0x3b, 0x04, 0x08, 0x2c, 0x3c, 0x06, 0x18, 0x30, 0x2c, 0x3c, 0x06, 0x18,
+    0x30, 0x2c, 0x3c, 0x06, 0x18, 0x30, 0x2c, 0x3c, 0x06, 0x18, 0x30, 0x2c, 0x3c, 0x06, 0x18, 0x30,
+    0x2c, 0x3c, 0x06, 0x18, 0x30, 0x2c, 0x3d, 0x06, 0x1c, 0x1d, 0x2c, 0x3d, 0x06, 0x1c, 0x1d, 0x2c,
+    0x3d, 0x06, 0x1c, 0x1d, 0x2c, 0x3d, 0x06, 0x1c, 0x1d, 0x2c, 0x3d, 0x06, 0x1c, 0x1d, 0x2c, 0x3d,
+    0x06, 0x1c, 0x1d, 0x2c, 0x3e, 0x06, 0x38, 0x1f, 0x2c, 0x3e, 0x06, 0x38, 0x1f, 0x2c, 0x3e, 0x06,
+    0x38, 0x1f, 0x2c, 0x3e, 0x06, 0x38, 0x1f, 0x2c, 0x3e, 0x06, 0x38, 0x1f, 0x2c, 0x3e, 0x06, 0x38,
+    0x1f, 0x1d, 0x41, 0x44, 0x01, 0x1d, 0x41, 0x44, 0x01, 0x1d, 0x41, 0x44, 0x01, 0x1d, 0x41, 0x44,
+    0x01, 0x1d, 0x41, 0x44, 0x01, 0x1d, 0x41, 0x44, 0x01, 0x2c, 0x43, 0x06, 0x88, 0x1d, 0x2c, 0x43,
+    0x06, 0x88, 0x1d, 0x2c, 0x43, 0x06, 0x88, 0x1d, 0x2c, 0x43, 0x06, 0x88, 0x1d, 0x2c, 0x43, 0x06,
+    0x88, 0x1d, 0x2c, 0x43, 0x06, 0x88, 0x1d, 0x15, 0x44, 0x74, 0x10, 0x04, 0x48, 0x00, 0x15, 0x44,
+    0x74, 0x10, 0x07, 0x12, 0x00, 0x0b, 0x84, 0x30, 0x15, 0x44, 0x74, 0x10, 0x04, 0xb4, 0x00, 0x15,
+    0x44, 0x74, 0x10, 0x07, 0x12, 0x00, 0x0b, 0x84, 0x30, 0x1d, 0x45, 0xcc, 0x03, 0x1d, 0x45, 0xcc,
+    0x03, 0x1d, 0x45, 0xcc, 0x03, 0x1d, 0x45, 0xcc, 0x03, 0x1d, 0x45, 0xcc, 0x03, 0x1d, 0x45, 0xcc,
+    0x03, 0x1d, 0x46, 0x6c, 0x00, 0x1d, 0x46, 0x6c, 0x00, 0x1d, 0x46, 0x6c, 0x00, 0x1d, 0x46, 0x6c,
+    0x00, 0x1d, 0x46, 0x6c, 0x00, 0x1d, 0x46, 0x6c, 0x00, 0x30, 0x47, 0x06, 0x55, 0x68, 0x13, 0x07,
+    0xd8, 0x1b, 0x30, 0x47, 0x06, 0x55, 0x68, 0x13, 0x07, 0xd8, 0x1b, 0x30, 0x47, 0x06, 0x55, 0x68,
+    0x13, 0x07, 0xd8, 0x1b, 0x30, 0x47, 0x06, 0x55, 0x68, 0x13, 0x07, 0x44, 0x1c, 0x30, 0x47, 0x06,
+    0x55, 0x68, 0x13, 0x07, 0x44, 0x1c, 0x30, 0x47, 0x06, 0x55, 0x68, 0x13, 0x07, 0x44, 0x1c, 0x30,
+    0x48, 0x06, 0x55, 0x68, 0x13, 0x07, 0x6c, 0x00, 0x30, 0x48, 0x06, 0x55, 0x68, 0x13, 0x07, 0x6c,
+    0x00, 0x30, 0x48, 0x06, 0x55, 0x68, 0x13, 0x07, 0x6c, 0x00, 0x30, 0x48, 0x06, 0x55, 0x68, 0x13,
+    0x07, 0x44, 0x1c, 0x30, 0x48, 0x06, 0x55, 0x68, 0x13, 0x07, 0x44, 0x1c, 0x30, 0x48, 0x06, 0x55,
+    0x68, 0x13, 0x07, 0x44, 0x1c, 0x21, 0x4a, 0x06, 0xa2, 0x51, 0x16, 0x6c, 0x26, 0x4c, 0x21, 0x4a,
+    0x06, 0xa2, 0x51, 0x16, 0x6c, 0x26, 0x4c, 0x21, 0x4a, 0x06, 0xa2, 0x51, 0x16, 0x6c, 0x26, 0x4c,
+    0x21, 0x4a, 0x06, 0xa2, 0x51, 0x01, 0x36, 0x00, 0x02, 0x00, 0x12, 0x21, 0x4a, 0x06, 0xa2, 0x51,
+    0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x30,
+    0x4b, 0x06, 0x44, 0xd6, 0x4d, 0x00, 0xa2, 0x00, 0x03, 0x48, 0x00, 0x30, 0x4b, 0x06, 0x44, 0xd6,
+    0x4d, 0x00, 0xa2, 0x00, 0x06, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x00, 0xa2, 0x00, 0x06, 0x12, 0x00,
+    0x00, 0xd6, 0x4d, 0x01, 0x36, 0x00, 0x00, 0xb4, 0x00, 0x10, 0x2b, 0x12, 0x00, 0x00, 0x4a, 0x26,
+    0x01, 0x36, 0x00, 0x05, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x01, 0x36, 0x00, 0x02, 0x12, 0x00, 0x21,
+    0x4c, 0x06, 0xa2, 0x51, 0x07, 0x6c, 0x00, 0x21, 0x4c, 0x06, 0xa2, 0x51, 0x07, 0x6c, 0x00, 0x21,
+    0x4c, 0x06, 0xa2, 0x51, 0x07, 0x6c, 0x00, 0x21, 0x4c, 0x06, 0xa2, 0x51, 0x05, 0x6c, 0x00, 0x10,
+    0x2c, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x05, 0x6c, 0x00, 0x01, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x05,
+    0x6c, 0x00, 0x41, 0x2c, 0x01, 0x4d, 0x06, 0xa2, 0x51, 0x07, 0x44, 0x01, 0x21, 0x4d, 0x06, 0xa2,
+    0x51, 0x07, 0x44, 0x01, 0x21, 0x4d, 0x06, 0xa2, 0x51, 0x07, 0x44, 0x01, 0x21, 0x4d, 0x06, 0xa2,
+    0x51, 0x05, 0x44, 0x01, 0x10, 0x22, 0x12, 0x00, 0x00, 0xd6, 0x4d, 0x05, 0x44, 0x01, 0x01, 0x12,
+    0x00, 0x00, 0xd6, 0x4d, 0x05, 0x44, 0x01, 0x3d, 0x22, 0x01, 0x4e, 0xb0, 0x01, 0x1d, 0x4e, 0xb0,
+    0x01, 0x1d, 0x4e, 0xb0, 0x01, 0x1d, 0x4e, 0xb0, 0x01, 0x1d, 0x4e, 0xb0, 0x01, 0x1d, 0x4e, 0xb0,
+    0x01, 0x1d, 0x4f, 0xb0, 0x01, 0x1d, 0x4f, 0xb0, 0x01, 0x1d, 0x4f, 0xb0, 0x01, 0x1d, 0x4f, 0xb0,
+    0x01, 0x1d, 0x4f, 0xb0, 0x01, 0x1d, 0x4f, 0xb0, 0x01, 0x1d, 0x50, 0xb0, 0x01, 0x1d, 0x50, 0xb0,
+    0x01, 0x1d, 0x50, 0xb0, 0x01, 0x1d, 0x50, 0xb0, 0x01, 0x1d, 0x50, 0xb0, 0x01, 0x1d, 0x50, 0xb0,
+    0x01, 0x1d, 0x51, 0xb0, 0x01, 0x1d, 0x51, 0xb0, 0x01, 0x1d, 0x51, 0xb0, 0x01, 0x1d, 0x51, 0xb0,
+    0x01, 0x1d, 0x51, 0xb0, 0x01, 0x1d, 0x51, 0xb0, 0x01, 0x1d, 0x52, 0xf0, 0x15, 0x1d, 0x52, 0xf0,
+    0x15, 0x1d, 0x52, 0xf0, 0x15, 0x1d, 0x52, 0xf0, 0x15, 0x1d, 0x52, 0xf0, 0x15, 0x1d, 0x52, 0xf0,
+    0x15, 0x1d, 0x53, 0xd0, 0x0b, 0x15, 0x53, 0x20, 0x0a, 0x07, 0x12, 0x00, 0x0b, 0xf4, 0x4a, 0x15,
+    0x53, 0x20, 0x0a, 0x04, 0x92, 0x43, 0x15, 0x53, 0x20, 0x0a, 0x07, 0x12, 0x00, 0x0b, 0x06, 0x4b,
+    0x1d, 0x54, 0xf8, 0x0a, 0x15, 0x54, 0x20, 0x0a, 0x07, 0x12, 0x00, 0x0b, 0x08, 0x46, 0x15, 0x54,
+    0x20, 0x0a, 0x04, 0xb8, 0x23, 0x15, 0x54, 0x20, 0x0a, 0x07, 0x12, 0x00, 0x0b, 0x1a, 0x46, 0x1d,
+    0x55, 0x48, 0x09, 0x15, 0x55, 0xe8, 0x05, 0x07, 0x12, 0x00, 0x0b, 0x4a, 0x43, 0x1a, 0x55, 0x48,
+    0x09, 0x20, 0x0c, 0xa2, 0x12, 0x00, 0x0b, 0x4a, 0x43, 0x15, 0x55, 0xe8, 0x05, 0x04, 0x12, 0x00,
+    0x1d, 0x56, 0xb0, 0x01, 0x1d, 0x56, 0xb0, 0x01, 0x1d, 0x56, 0xb0, 0x01, 0x1d, 0x56, 0xb0, 0x01,
+    0x1d, 0x56, 0xb0, 0x01, 0x1d, 0x56, 0xb0, 0x01, 0x1d, 0x57, 0xb0, 0x01, 0x1d, 0x57, 0xb0, 0x01,
+    0x1d, 0x57, 0xb0, 0x01, 0x1d, 0x57, 0xb0, 0x01, 0x1d, 0x57, 0xb0, 0x01, 0x1d, 0x57, 0xb0, 0x01,
+    0x1d, 0x58, 0xb0, 0x01, 0x1d, 0x58, 0xb0, 0x01, 0x1d, 0x58, 0xb0, 0x01, 0x1d, 0x58, 0xb0, 0x01,
+    0x1d, 0x58, 0xb0, 0x01, 0x1d, 0x58, 0xb0, 0x01, 0x1d, 0x59, 0xb0, 0x01, 0x1d, 0x59, 0xb0, 0x01,
+    0x1d, 0x59, 0xb0, 0x01, 0x1d, 0x59, 0xb0, 0x01, 0x1d, 0x59, 0xb0, 0x01, 0x1d, 0x59, 0xb0, 0x01,
+    0x12, 0x5b, 0x44, 0x01, 0x07, 0x2c, 0x07, 0x12, 0x5b, 0x44, 0x01, 0x07, 0x2c, 0x07, 0x12, 0x5b,
+    0x44, 0x01, 0x07, 0x2c, 0x07, 0x12, 0x5b, 0x44, 0x01, 0x07, 0x98, 0x07, 0x12, 0x5b, 0x44, 0x01,
+    0x07, 0x98, 0x07, 0x12, 0x5b, 0x44, 0x01, 0x07, 0x98, 0x07, 0x12, 0x5c, 0x44, 0x01, 0x07, 0x6c,
+    0x00, 0x12, 0x5c, 0x44, 0x01, 0x07, 0x6c, 0x00, 0x12, 0x5c, 0x44, 0x01, 0x07, 0x6c, 0x00, 0x12,
+    0x5c, 0x44, 0x01, 0x07, 0x98, 0x07, 0x12, 0x5c, 0x44, 0x01, 0x07, 0x98, 0x07, 0x12, 0x5c, 0x44,
+    0x01, 0x07, 0x98, 0x07, 0x31, 0x5d, 0x06, 0x55, 0x1c, 0x4a, 0x02, 0x92, 0xb8, 0x00, 0x9c, 0x7b,
+    0x22, 0x5d, 0x06, 0x6e, 0x82, 0x02, 0xc8, 0xb8, 0x00, 0x5a, 0x00, 0x31, 0x5d, 0x06, 0x55, 0x52,
+    0x4a, 0x02, 0xc8, 0xb8, 0x03, 0x12, 0x00, 0x08, 0x36, 0x00, 0x02, 0x12, 0x00, 0x01, 0xf0, 0x4b,
+    0x02, 0xc8, 0xb8, 0x03, 0x5a, 0x00, 0x01, 0x64, 0x4a, 0x02, 0xc8, 0xb8, 0x03, 0x12, 0x00, 0x01,
+    0x64, 0x4a, 0x02, 0xc8, 0xb8, 0x00, 0x12, 0x00, 0x31, 0x5e, 0x06, 0x55, 0x0a, 0x4a, 0x06, 0x7e,
+    0x00, 0x22, 0x5e, 0x06, 0x80, 0x82, 0x06, 0x7e, 0x00, 0x31, 0x5e, 0x06, 0x55, 0x40, 0x4a, 0x06,
+    0x7e, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x01, 0x96, 0x4b, 0x04, 0x7e, 0x00, 0x10, 0xab,
+    0x12, 0x00, 0x01, 0x52, 0x4a, 0x04, 0x7e, 0x00, 0x01, 0x12, 0x00, 0x01, 0x52, 0x4a, 0x04, 0x7e,
+    0x00, 0x33, 0xab, 0x00, 0x5f, 0xea, 0x00, 0x15, 0x1a, 0x12, 0x6c, 0x0c, 0x12, 0x00, 0x10, 0xb8,
+    0x12, 0x00, 0x01, 0x7e, 0x6c, 0x00, 0x12, 0x00, 0x02, 0x7e, 0x6c, 0x13, 0x60, 0xa2, 0x00, 0x06,
+    0x36, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x01, 0x48, 0x6c, 0x04, 0x36, 0x00, 0x44,
+    0xa3, 0x00, 0x61, 0x06, 0x5a, 0x87, 0x00, 0xb0, 0x01, 0x00, 0xbc, 0x19, 0x24, 0x61, 0x06, 0x5a,
+    0x87, 0x07, 0x12, 0x00, 0x03, 0x60, 0x4b, 0x07, 0x12, 0x00, 0x03, 0xda, 0x4c, 0x00, 0xb0, 0x01,
+    0x01, 0x60, 0x4b, 0x14, 0x06, 0x5a, 0x87, 0x07, 0x12, 0x00, 0x03, 0x72, 0x4b, 0x04, 0x12, 0x00,
+    0x24, 0x62, 0x06, 0xca, 0x86, 0x04, 0x48, 0x00, 0x24, 0x62, 0x06, 0xca, 0x86, 0x07, 0x12, 0x00,
+    0x03, 0x6e, 0x4c, 0x07, 0x12, 0x00, 0x03, 0x6e, 0x4c, 0x02, 0x48, 0x00, 0x10, 0xab, 0x12, 0x00,
+    0x03, 0x6e, 0x4c, 0x07, 0x12, 0x00, 0x03, 0x6e, 0x4c, 0x04, 0x12, 0x00, 0x24, 0x63, 0x06, 0xb0,
+    0x6d, 0x00, 0x28, 0x98, 0x00, 0x0e, 0x01, 0x24, 0x63, 0x06, 0xb0, 0x6d, 0x00, 0x28, 0x98, 0x00,
+    0x32, 0x01, 0x24, 0x64, 0x06, 0x68, 0x6d, 0x04, 0x24, 0x00, 0x24, 0x64, 0x06, 0x68, 0x6d, 0x02,
+    0x24, 0x00, 0x33, 0xa3, 0x00, 0x66, 0xfc, 0x00, 0x06, 0xea, 0xb4, 0x0b, 0x12, 0x00, 0x00, 0x64,
+    0x4a, 0x03, 0xea, 0x00, 0x06, 0x20, 0xb5, 0x13, 0x67, 0xc6, 0x00, 0x06, 0x36, 0x00, 0x0b, 0x12,
+    0x00, 0x00, 0x2e, 0x4a, 0x03, 0xb4, 0x00, 0x06, 0x20, 0xb5, 0x13, 0x68, 0xb4, 0x00, 0x15, 0x1c,
+    0xc2, 0x01, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x01, 0xc6, 0x00, 0x00, 0x12, 0x00, 0x02,
+    0xc6, 0x00, 0x13, 0x69, 0xc6, 0x00, 0x06, 0x36, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00,
+    0x01, 0xd8, 0x00, 0x04, 0x36, 0x00, 0x44, 0xa3, 0x00, 0x6a, 0x06, 0xd4, 0x88, 0x04, 0x68, 0x01,
+    0x24, 0x6a, 0x06, 0xd4, 0x88, 0x07, 0x12, 0x00, 0x03, 0xb8, 0x86, 0x07, 0x12, 0x00, 0x03, 0xb8,
+    0x86, 0x02, 0x68, 0x01, 0x10, 0xaa, 0x12, 0x00, 0x03, 0xb8, 0x86, 0x07, 0x12, 0x00, 0x03, 0xb8,
+    0x86, 0x04, 0x12, 0x00, 0x24, 0x6c, 0x06, 0x06, 0x6f, 0x04, 0x68, 0x01, 0x24, 0x6c, 0x06, 0x06,
+    0x6f, 0x02, 0x68, 0x01, 0x42, 0xa2, 0x00, 0x6e, 0x06, 0xc4, 0x4d, 0x06, 0x64, 0xc8, 0x22, 0x6e,
+    0x06, 0x74, 0x4f, 0x06, 0xb8, 0xbc, 0x22, 0x6e, 0x06, 0xfa, 0x4d, 0x06, 0xb8, 0xbc, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x01, 0x9a, 0x02, 0x06, 0xb8, 0xbc, 0x22, 0x6e, 0x06, 0x0c, 0x4e, 0x06,
+    0xb8, 0xbc, 0x22, 0x6e, 0x06, 0x0c, 0x4e, 0x06, 0xb8, 0xbc, 0x2c, 0x6f, 0x06, 0xd8, 0x87, 0x2c,
+    0x6f, 0x06, 0xd8, 0x87, 0x2c, 0x6f, 0x06, 0xd8, 0x87, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0xd8, 0x87, 0x2c, 0x6f, 0x06, 0xd8, 0x87, 0x2c, 0x6f, 0x06, 0xd8, 0x87, 0x22, 0x70, 0x06, 0x62,
+    0x4f, 0x06, 0xfc, 0x00, 0x22, 0x70, 0x06, 0x98, 0x4f, 0x06, 0xfc, 0x00, 0x22, 0x70, 0x06, 0x98,
+    0x4f, 0x06, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x01, 0x2a, 0x03, 0x04, 0xfc, 0x00,
+    0x10, 0xab, 0x12, 0x00, 0x01, 0x2a, 0x03, 0x04, 0xfc, 0x00, 0x01, 0x12, 0x00, 0x01, 0x76, 0x02,
+    0x04, 0xfc, 0x00, 0x3d, 0xab, 0x00, 0x71, 0x6e, 0x04, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00,
+    0x0b, 0x6e, 0x04, 0x2c, 0x72, 0x06, 0xd8, 0x87, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b,
+    0xec, 0x70, 0x1d, 0x73, 0xa4, 0x04, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xa4, 0x04,
+    0x13, 0x76, 0xe6, 0x01, 0x07, 0x14, 0x8b, 0x03, 0x1c, 0x02, 0x07, 0x14, 0x8b, 0x03, 0x1c, 0x02,
+    0x07, 0x14, 0x8b, 0x0a, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xf4, 0x89, 0x13, 0x76, 0x1c, 0x02,
+    0x06, 0xf4, 0x89, 0x13, 0x76, 0x1c, 0x02, 0x06, 0xf4, 0x89, 0x1d, 0x77, 0x1c, 0x02, 0x1d, 0x77,
+    0x1c, 0x02, 0x1d, 0x77, 0x1c, 0x02, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d,
+    0x77, 0x1c, 0x02, 0x1d, 0x77, 0x1c, 0x02, 0x13, 0x78, 0xe6, 0x01, 0x06, 0xfc, 0x00, 0x13, 0x78,
+    0x1c, 0x02, 0x06, 0xfc, 0x00, 0x13, 0x78, 0x1c, 0x02, 0x06, 0xfc, 0x00, 0x0b, 0x36, 0x00, 0x02,
+    0x12, 0x00, 0x0b, 0xf4, 0x89, 0x13, 0x78, 0x1c, 0x02, 0x06, 0xf4, 0x89, 0x13, 0x78, 0x1c, 0x02,
+    0x06, 0xf4, 0x89, 0x13, 0x79, 0x0a, 0x02, 0x07, 0xa4, 0x8b, 0x0b, 0x12, 0x00, 0x10, 0xb8, 0x12,
+    0x00, 0x0b, 0x08, 0x73, 0x1d, 0x7a, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b,
+    0x1c, 0x02, 0x13, 0x7b, 0x0a, 0x02, 0x06, 0x6c, 0x00, 0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00,
+    0x0c, 0xf4, 0x89, 0x0d, 0xc0, 0x06, 0x1d, 0x80, 0xc0, 0x06, 0x1d, 0x80, 0xc0, 0x06, 0x1d, 0x80,
+    0xc0, 0x06, 0x1d, 0x80, 0xc0, 0x06, 0x1d, 0x80, 0xc0, 0x06, 0x1d, 0x81, 0xc0, 0x06, 0x1d, 0x81,
+    0xc0, 0x06, 0x1d, 0x81, 0xc0, 0x06, 0x1d, 0x81, 0xc0, 0x06, 0x1d, 0x81, 0xc0, 0x06, 0x1d, 0x81,
+    0xc0, 0x06, 0x1d, 0x82, 0xc0, 0x06, 0x1d, 0x82, 0xc0, 0x06, 0x1d, 0x83, 0xc0, 0x06, 0x1d, 0x83,
+    0xc0, 0x06, 0x1d, 0x85, 0xc0, 0x06, 0x0b, 0x12, 0x00, 0x00, 0xc4, 0xdd, 0x0d, 0xc0, 0x06, 0x1d,
+    0x86, 0xc0, 0x06, 0x0b, 0x12, 0x00, 0x00, 0x7c, 0xdd, 0x0d, 0xc0, 0x06, 0x1d, 0x87, 0xc0, 0x06,
+    0x0c, 0x12, 0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xc0, 0x06, 0x1d, 0x88, 0xc0, 0x06, 0x0c, 0x12,
+    0x00, 0x10, 0xb8, 0x12, 0x00, 0x0b, 0xc0, 0x06, 0x1d, 0x89, 0xc0, 0x06, 0x1d, 0x89, 0xc0, 0x06,
+    0x1d, 0x89, 0xc0, 0x06, 0x1d, 0x89, 0xc0, 0x06, 0x1d, 0x89, 0xc0, 0x06, 0x1d, 0x89, 0xc0, 0x06,
+    0x1d, 0x8b, 0xc0, 0x06, 0x1d, 0x8b, 0xc0, 0x06, 0x2c, 0x8d, 0x06, 0xac, 0x77, 0x13, 0x8d, 0xfc,
+    0x00, 0x06, 0xb0, 0x76, 0x2c, 0x8d, 0x06, 0xac, 0x77, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b,
+    0xac, 0x77, 0x2c, 0x8d, 0x06, 0xac, 0x77, 0x2c, 0x8d, 0x06, 0xac, 0x77, 0x2c, 0x8e, 0x06, 0xac,
+    0x77, 0x13, 0x8e, 0xb4, 0x00, 0x06, 0xac, 0x77, 0x2c, 0x8e, 0x06, 0xac, 0x77, 0x0b, 0x36, 0x00,
+    0x02, 0x12, 0x00, 0x0b, 0xac, 0x77, 0x2c, 0x8e, 0x06, 0xac, 0x77, 0x2c, 0x8e, 0x06, 0xac, 0x77,
+    0x2c, 0x8f, 0x06, 0xac, 0x77, 0x13, 0x8f, 0xc2, 0x01, 0x06, 0xfc, 0x00, 0x2c, 0x8f, 0x06, 0xac,
+    0x77, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0xac, 0x77, 0x2c, 0x8f, 0x06, 0xac, 0x77, 0x2c,
+    0x8f, 0x06, 0xac, 0x77, 0x15, 0x90, 0x2a, 0x03, 0x04, 0x40, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0,
+    0x12, 0x00, 0x0b, 0xa4, 0x04, 0x15, 0x91, 0xd4, 0x01, 0x04, 0x36, 0x00, 0x0c, 0x12, 0x00, 0x10,
+    0xb0, 0x12, 0x00, 0x0b, 0xa4, 0x04, 0x15, 0x92, 0x72, 0x03, 0x04, 0x36, 0x00, 0x0c, 0x12, 0x00,
+    0x10, 0xb0, 0x12, 0x00, 0x0b, 0xa4, 0x04, 0x4a, 0x94, 0x06, 0x33, 0x58, 0x3a, 0x2c, 0x4a, 0x94,
+    0x06, 0x33, 0x5b, 0x3a, 0x2c, 0x4a, 0x94, 0x06, 0x33, 0x5e, 0x3a, 0x2c, 0x4a, 0x95, 0x06, 0x33,
+    0x61, 0xa6, 0x2c, 0x4a, 0x95, 0x06, 0x33, 0x64, 0xa6, 0x2c, 0x4a, 0x95, 0x06, 0x33, 0x67, 0xa6,
+    0x2c, 0x21, 0x96, 0x06, 0xf0, 0x93, 0x12, 0x9e, 0xba, 0x93, 0x00, 0x48, 0x00, 0x21, 0x97, 0x06,
+    0xcc, 0x93, 0x05, 0x12, 0x00, 0x41, 0x43, 0x00, 0x9a, 0x06, 0xf0, 0x93, 0x07, 0x24, 0x00, 0x1d,
+    0x9b, 0x24, 0x00, 0x1d, 0x9c, 0x48, 0x00, 0x1d, 0x9d, 0x24, 0x00, 0x1d, 0x9e, 0x48, 0x00, 0x1d,
+    0x9f, 0x24, 0x00, 0x1d, 0xa0, 0xfc, 0x00, 0x4a, 0xa0, 0x06, 0x33, 0x6a, 0xfc, 0x00, 0x4a, 0xa0,
+    0x06, 0x33, 0x6d, 0xfc, 0x00, 0x1d, 0xa1, 0xfc, 0x00, 0x4a, 0xa1, 0x06, 0x33, 0x70, 0xfc, 0x00,
+    0x4a, 0xa1, 0x06, 0x33, 0x73, 0xfc, 0x00, 0x13, 0xa2, 0x92, 0x0d, 0x06, 0xd2, 0x0f, 0x13, 0xa2,
+    0x92, 0x0d, 0x06, 0xd2, 0x0f, 0x13, 0xa2, 0x80, 0x0d, 0x06, 0x2c, 0x10, 0x13, 0xa2, 0x80, 0x0d,
+    0x06, 0x2c, 0x10, 0x13, 0xa3, 0x58, 0x0e, 0x06, 0x48, 0x00, 0x13, 0xa3, 0x58, 0x0e, 0x06, 0x48,
+    0x00, 0x13, 0xa3, 0x46, 0x0e, 0x06, 0x08, 0x10, 0x13, 0xa3, 0x46, 0x0e, 0x06, 0x08, 0x10, 0x12,
+    0xa4, 0x62, 0x2b, 0x07, 0x48, 0x00, 0x12, 0xa4, 0x62, 0x2b, 0x07, 0x48, 0x00, 0x12, 0xa4, 0x50,
+    0x2b, 0x07, 0x90, 0x00, 0x12, 0xa4, 0x50, 0x2b, 0x07, 0x90, 0x00, 0x12, 0xa5, 0x3e, 0x2b, 0x07,
+    0x48, 0x00, 0x12, 0xa5, 0x3e, 0x2b, 0x07, 0x48, 0x00, 0x12, 0xa5, 0x2c, 0x2b, 0x07, 0x90, 0x00,
+    0x12, 0xa5, 0x2c, 0x2b, 0x07, 0x90, 0x00, 0x13, 0xa6, 0xbc, 0x07, 0x06, 0x04, 0x11, 0x1d, 0xa6,
+    0xea, 0x00, 0x1d, 0xa6, 0xea, 0x00, 0x13, 0xa6, 0x42, 0x0f, 0x06, 0x04, 0x11, 0x1d, 0xa6, 0xfc,
+    0x00, 0x1d, 0xa6, 0xfc, 0x00, 0x13, 0xa7, 0xbc, 0x07, 0x06, 0x6c, 0x00, 0x1d, 0xa7, 0x9e, 0x01,
+    0x1d, 0xa7, 0x9e, 0x01, 0x13, 0xa7, 0x30, 0x0f, 0x06, 0xdc, 0x11, 0x1d, 0xa7, 0xb0, 0x01, 0x1d,
+    0xa7, 0xb0, 0x01, 0x15, 0xa8, 0xe0, 0x07, 0x02, 0xae, 0x06, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x20,
+    0x0a, 0x15, 0xa8, 0x16, 0x08, 0x07, 0x12, 0x00, 0x0b, 0x20, 0x0a, 0x15, 0xa8, 0x16, 0x08, 0x04,
+    0x08, 0x07, 0x15, 0xa8, 0x16, 0x08, 0x07, 0x12, 0x00, 0x0b, 0x20, 0x0a, 0x15, 0xa9, 0x66, 0x06,
+    0x04, 0x7e, 0x00, 0x15, 0xa9, 0x9c, 0x06, 0x04, 0x5a, 0x00, 0x15, 0xa9, 0x9c, 0x06, 0x07, 0x12,
+    0x00, 0x0b, 0x20, 0x0a, 0x15, 0xa9, 0x9c, 0x06, 0x04, 0xfc, 0x09, 0x15, 0xa9, 0x9c, 0x06, 0x07,
+    0x12, 0x00, 0x0b, 0x20, 0x0a, 0x15, 0xaa, 0x70, 0x08, 0x04, 0x7e, 0x00, 0x15, 0xaa, 0xa6, 0x08,
+    0x04, 0x5a, 0x00, 0x15, 0xaa, 0xa6, 0x08, 0x07, 0x12, 0x00, 0x0b, 0x20, 0x0a, 0x15, 0xaa, 0xa6,
+    0x08, 0x04, 0xce, 0x07, 0x15, 0xaa, 0xa6, 0x08, 0x07, 0x12, 0x00, 0x0b, 0x20, 0x0a, 0x1d, 0xab,
+    0x7c, 0x05, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x7c, 0x05, 0x1d, 0xac, 0x7c, 0x05,
+    0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x7c, 0x05, 0x1d, 0xad, 0x7c, 0x05, 0x0c, 0x12,
+    0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x7c, 0x05, 0x1d, 0xaf, 0x98, 0x07, 0x1d, 0xaf, 0x98, 0x07,
+    0x1d, 0xaf, 0x98, 0x07, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x98, 0x07, 0x1d, 0xaf, 0x98,
+    0x07, 0x1d, 0xaf, 0x98, 0x07, 0x1d, 0xb0, 0x98, 0x07, 0x1d, 0xb0, 0x98, 0x07, 0x1d, 0xb0, 0x98,
+    0x07, 0x0b, 0x36, 0x00, 0x02, 0x12, 0x00, 0x0b, 0x98, 0x07, 0x1d, 0xb0, 0x98, 0x07, 0x1d, 0xb0,
+    0x98, 0x07, 0x1d, 0xb1, 0x98, 0x07, 0x1d, 0xb1, 0x98, 0x07, 0x1d, 0xb1, 0x98, 0x07, 0x0b, 0x36,
+    0x00, 0x02, 0x12, 0x00, 0x0b, 0x98, 0x07, 0x1d, 0xb1, 0x98, 0x07, 0x1d, 0xb1, 0x98, 0x07, 0x1d,
+    0xb4, 0x1c, 0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xb5, 0x1c,
+    0x02, 0x0c, 0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x1d, 0xb6, 0x1c, 0x02, 0x0c,
+    0x12, 0x00, 0x10, 0xb0, 0x12, 0x00, 0x0b, 0x1c, 0x02, 0x2c, 0xb9, 0x06, 0x3e, 0xf1, 0x0c, 0x12,
+    0x00, 0x10, 0x78, 0x12, 0x00, 0x0b, 0x3e, 0xf1, 0x2c, 0xba, 0x06, 0x3e, 0xf1, 0x0c, 0x12, 0x00,
+    0x10, 0x78, 0x12, 0x00, 0x0b, 0x3e, 0xf1, 0x2c, 0xbb, 0x06, 0x3e, 0xf1, 0x0c, 0x12, 0x00, 0x10,
+    0x78, 0x12, 0x00, 0x0b, 0x3e, 0xf1, 0x15, 0xbc, 0xac, 0x02, 0x04, 0x22, 0x05, 0x15, 0xbc, 0xac,
+    0x02, 0x07, 0x12, 0x00, 0x0b, 0xb2, 0x05, 0x15, 0xbc, 0xac, 0x02, 0x04, 0x8e, 0x05, 0x15, 0xbc,
+    0xac, 0x02, 0x07, 0x12, 0x00, 0x0b, 0xb2, 0x05, 0x15, 0xbd, 0x1c, 0x02, 0x04, 0x48, 0x00, 0x15,
+    0xbd, 0x1c, 0x02, 0x07, 0x12, 0x00, 0x0b, 0xb2, 0x05, 0x15, 0xbd, 0x1c, 0x02, 0x04, 0x8e, 0x05,
+    0x15, 0xbd, 0x1c, 0x02, 0x07, 0x12, 0x00, 0x0b, 0xb2, 0x05, 0x1d, 0xbe, 0xd8, 0x00, 0x1d, 0xbe,
+    0xd8, 0x00, 0x1d, 0xbe, 0xd8, 0x00, 0x1d, 0xbe, 0xd8, 0x00, 0x1d, 0xbe, 0xd8, 0x00, 0x1d, 0xbe,
+    0xd8, 0x00, 0x1d, 0xbf, 0xd8, 0x00, 0x1d, 0xbf, 0xd8, 0x00, 0x1d, 0xbf, 0xd8, 0x00, 0x1d, 0xbf,
+    0xd8, 0x00, 0x1d, 0xbf, 0xd8, 0x00, 0x1d, 0xbf, 0xd8, 0x00, 0x12, 0xc0, 0xd8, 0x00, 0x07, 0x2a,
+    0x81, 0x12, 0xc0, 0xd8, 0x00, 0x07, 0x2a, 0x81, 0x12, 0xc0, 0xd8, 0x00, 0x07, 0x2a, 0x81, 0x12,
+    0xc0, 0xd8, 0x00, 0x07, 0x96, 0x81, 0x12, 0xc0, 0xd8, 0x00, 0x07, 0x96, 0x81, 0x12, 0xc0, 0xd8,
+    0x00, 0x07, 0x96, 0x81, 0x12, 0xc1, 0xd8, 0x00, 0x07, 0x6c, 0x00, 0x12, 0xc1, 0xd8, 0x00, 0x07,
+    0x6c, 0x00, 0x12, 0xc1, 0xd8, 0x00, 0x07, 0x6c, 0x00, 0x12, 0xc1, 0xd8, 0x00, 0x07, 0x96, 0x81,
+    0x12, 0xc1, 0xd8, 0x00, 0x07, 0x96, 0x81, 0x12, 0xc1, 0xd8, 0x00, 0x07, 0x96, 0x81, 0x04, 0x01,
+    0x00, 0xf0, 0x00, 0x20, 0x00, 0x34, 0x08, 0x07, 0x00, 0x43, 0x24, 0x53, 0x15, 0x00, 0x01, 0x01,
+    0x00, 0x01, 0x10, 0x00, 0x1b, 0x0c, 0x10, 0x00, 0x15, 0x10, 0x10, 0x00, 0x11, 0x10, 0x10, 0x00,
+    0x1b, 0x14, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30, 0x00, 0x75, 0x28, 0x00, 0x34, 0x18, 0x07,
+    0x00, 0x47, 0x20, 0x00, 0x45, 0x28, 0x00, 0x34, 0x1c, 0x10, 0x00, 0x82, 0x10, 0x01, 0x00, 0x33,
+    0x00, 0x23, 0xcb, 0x10, 0x30, 0x00, 0x10, 0x00, 0x20, 0x00, 0x45, 0x33, 0x00, 0x23, 0xce, 0x10,
+    0x00, 0x41, 0x10, 0x01, 0x00, 0x35, 0x20, 0x00, 0x15, 0x3d, 0x20, 0x00, 0x11, 0x35, 0x20, 0x00,
+    0x03, 0x10, 0x00, 0x41, 0x10, 0x01, 0x00, 0x36, 0x20, 0x00, 0x15, 0x3b, 0x20, 0x00, 0x11, 0x36,
+    0x20, 0x00, 0x03, 0x10, 0x00, 0xd2, 0x10, 0x01, 0x00, 0x46, 0x00, 0x34, 0x20, 0x07, 0x00, 0x3b,
+    0x26, 0x54, 0x16, 0x80, 0x00, 0x4b, 0x46, 0x00, 0x34, 0x24, 0x10, 0x00, 0x15, 0x28, 0x10, 0x00,
+    0x02, 0x30, 0x00, 0x1b, 0x2c, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30, 0x00, 0xa0, 0x4f, 0x00,
+    0x11, 0xcb, 0x1e, 0x00, 0x00, 0x88, 0x76, 0x27, 0x70, 0x00, 0x3b, 0x00, 0x00, 0x50, 0x10, 0x00,
+    0x81, 0x96, 0x00, 0x11, 0x79, 0x06, 0x00, 0x00, 0x68, 0x10, 0x00, 0x11, 0x00, 0x10, 0x00, 0x27,
+    0x0e, 0x07, 0x10, 0x00, 0xa0, 0x33, 0x01, 0x22, 0x48, 0x1d, 0x00, 0x00, 0x3a, 0x74, 0x29, 0x0e,
+    0x00, 0x10, 0x0a, 0x10, 0x00, 0x30, 0x4a, 0x1d, 0x05, 0x10, 0x00, 0x11, 0x02, 0x10, 0x00, 0x1b,
+    0x34, 0x20, 0x00, 0x1b, 0x34, 0x20, 0x00, 0xf3, 0x02, 0x45, 0x01, 0x33, 0x0d, 0x11, 0x00, 0x00,
+    0x62, 0x19, 0x0e, 0x98, 0x0a, 0x0a, 0x00, 0x0a, 0x00, 0x46, 0x10, 0x00, 0x13, 0x11, 0x10, 0x00,
+    0x1b, 0x47, 0x10, 0x00, 0x1b, 0x48, 0x30, 0x00, 0xc0, 0x49, 0x01, 0x22, 0x4c, 0x1d, 0x00, 0x00,
+    0x66, 0x76, 0x27, 0x00, 0x0a, 0x14, 0x50, 0x1b, 0x4a, 0x20, 0x00, 0x1b, 0x4b, 0x40, 0x00, 0x1b,
+    0x4c, 0x30, 0x00, 0x1b, 0x4d, 0x30, 0x00, 0x1b, 0x4e, 0x30, 0x00, 0x1b, 0x4f, 0x10, 0x00, 0x1b,
+    0x50, 0x40, 0x00, 0x13, 0x51, 0x20, 0x00, 0x13, 0x21, 0x20, 0x00, 0x1b, 0x52, 0x30, 0x00, 0x1b,
+    0x53, 0x20, 0x00, 0x52, 0x54, 0x01, 0x33, 0x10, 0x11, 0x40, 0x00, 0x10, 0x01, 0x10, 0x00, 0x1b,
+    0x55, 0x10, 0x00, 0x43, 0x56, 0x01, 0x33, 0x13, 0x10, 0x00, 0x10, 0x0a, 0x32, 0x01, 0x1b, 0x57,
+    0x70, 0x00, 0x1b, 0x58, 0x10, 0x00, 0x1e, 0x59, 0x10, 0x00, 0x14, 0x4e, 0x10, 0x00, 0x00, 0x40,
+    0x00, 0x43, 0x59, 0x01, 0x22, 0x50, 0x10, 0x00, 0x10, 0x01, 0x20, 0x00, 0x51, 0x5a, 0x01, 0x22,
+    0x52, 0x1d, 0xf0, 0x00, 0x11, 0x9c, 0x30, 0x00, 0x44, 0x5a, 0x01, 0x22, 0x54, 0x10, 0x00, 0x00,
+    0xf0, 0x01, 0x4b, 0x5a, 0x01, 0x22, 0x56, 0x10, 0x00, 0x12, 0x58, 0x10, 0x00, 0x11, 0x98, 0x50,
+    0x00, 0x43, 0x5a, 0x01, 0x22, 0x5a, 0x10, 0x00, 0x01, 0x50, 0x00, 0x40, 0x5b, 0x01, 0x22, 0x5c,
+    0x10, 0x00, 0x13, 0x11, 0x50, 0x00, 0x44, 0x5b, 0x01, 0x22, 0x5e, 0x10, 0x00, 0x00, 0x40, 0x00,
+    0x4b, 0x5b, 0x01, 0x22, 0x60, 0x10, 0x00, 0x01, 0x50, 0x00, 0x00, 0x20, 0x01, 0x00, 0x50, 0x00,
+    0x0f, 0x10, 0x00, 0x00, 0x01, 0x60, 0x00, 0x16, 0x11, 0x60, 0x00, 0x09, 0x10, 0x00, 0x48, 0x5c,
+    0x01, 0x22, 0x62, 0x70, 0x00, 0x48, 0x5c, 0x01, 0x22, 0x64, 0x60, 0x00, 0x4b, 0x5c, 0x01, 0x22,
+    0x66, 0x10, 0x00, 0x18, 0x68, 0x60, 0x00, 0x48, 0x5c, 0x01, 0x22, 0x6a, 0x50, 0x00, 0x40, 0x5d,
+    0x01, 0x22, 0x6c, 0x10, 0x00, 0x13, 0x21, 0x50, 0x00, 0x44, 0x5d, 0x01, 0x22, 0x6e, 0x10, 0x00,
+    0x00, 0x40, 0x00, 0x4b, 0x5d, 0x01, 0x22, 0x70, 0x10, 0x00, 0x01, 0xb0, 0x00, 0x01, 0x10, 0x00,
+    0x02, 0x30, 0x00, 0x01, 0xa0, 0x00, 0x13, 0x21, 0x50, 0x00, 0x1b, 0x5e, 0x90, 0x01, 0x46, 0x5f,
+    0x01, 0x22, 0x1c, 0x60, 0x02, 0x33, 0x00, 0x00, 0x60, 0x10, 0x00, 0x02, 0x20, 0x02, 0x3b, 0x00,
+    0x00, 0x61, 0x10, 0x00, 0x13, 0x62, 0x10, 0x00, 0x02, 0x30, 0x02, 0x3b, 0x00, 0x00, 0x63, 0x50,
+    0x00, 0x1b, 0x64, 0xb0, 0x02, 0x1b, 0x65, 0x70, 0x02, 0x1b, 0x66, 0x10, 0x00, 0x75, 0x67, 0x01,
+    0x23, 0x16, 0x11, 0x00, 0x37, 0x40, 0x00, 0x75, 0x68, 0x01, 0x23, 0x19, 0x11, 0x00, 0x37, 0x90,
+    0x00, 0x13, 0x69, 0x10, 0x00, 0x04, 0x80, 0x00, 0x1b, 0x6a, 0x10, 0x00, 0x13, 0x6b, 0x10, 0x00,
+    0x04, 0x90, 0x00, 0x1b, 0x6c, 0xd0, 0x02, 0x39, 0x6d, 0x01, 0x33, 0xe0, 0x00, 0x13, 0x6e, 0x10,
+    0x00, 0x04, 0x40, 0x00, 0x1b, 0x6f, 0x10, 0x00, 0x13, 0x70, 0x10, 0x00, 0x04, 0x50, 0x00, 0x1b,
+    0x71, 0x40, 0x00, 0x1b, 0x72, 0x30, 0x00, 0x1b, 0x73, 0x10, 0x00, 0x1b, 0x74, 0x40, 0x00, 0x1b,
+    0x75, 0xd0, 0x00, 0x1b, 0x76, 0xc0, 0x00, 0x1b, 0x77, 0x10, 0x00, 0x1b, 0x78, 0x30, 0x00, 0x1b,
+    0x79, 0xd0, 0x00, 0x1b, 0x7a, 0x40, 0x01, 0x1b, 0x7b, 0x10, 0x00, 0x1b, 0x7c, 0x90, 0x01, 0x1b,
+    0x7d, 0x90, 0x01, 0x1b, 0x7e, 0x30, 0x00, 0x1b, 0x7f, 0x10, 0x00, 0x1b, 0x80, 0x70, 0x00, 0x1b,
+    0x81, 0x50, 0x00, 0x1b, 0x82, 0x50, 0x00, 0x1b, 0x83, 0x40, 0x00, 0x1b, 0x84, 0x10, 0x00, 0x1b,
+    0x85, 0x50, 0x00, 0xb1, 0x8b, 0x01, 0x11, 0xd2, 0x1e, 0x00, 0x00, 0x08, 0x09, 0x09, 0xa0, 0xc0,
+    0x05, 0x48, 0x8b, 0x01, 0x11, 0xd3, 0x10, 0x00, 0x70, 0xa4, 0x01, 0x23, 0x1f, 0x11, 0x00, 0x37,
+    0xc0, 0x05, 0x10, 0x01, 0xc0, 0x02, 0x48, 0xa4, 0x01, 0x23, 0x22, 0x10, 0x00, 0x75, 0xe3, 0x01,
+    0x34, 0x30, 0x07, 0x00, 0x00, 0x30, 0x06, 0x4b, 0xe3, 0x01, 0x34, 0x34, 0x10, 0x00, 0x15, 0x38,
+    0x10, 0x00, 0x11, 0x10, 0x10, 0x00, 0x1b, 0x3c, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30, 0x00,
+    0x48, 0x16, 0x02, 0x33, 0x08, 0x20, 0x00, 0x4b, 0x16, 0x02, 0x33, 0x0c, 0x10, 0x00, 0x1b, 0x10,
+    0x30, 0x00, 0x1f, 0x14, 0x40, 0x00, 0x0c, 0x09, 0x30, 0x00, 0x1b, 0x17, 0x20, 0x00, 0x1b, 0x17,
+    0x60, 0x00, 0x1e, 0x17, 0x30, 0x00, 0x09, 0x60, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x09, 0x30, 0x00,
+    0x20, 0x62, 0x02, 0x40, 0x01, 0x15, 0x41, 0x30, 0x01, 0x20, 0x62, 0x02, 0x40, 0x01, 0x06, 0x10,
+    0x00, 0x55, 0xb6, 0x02, 0x33, 0x25, 0x11, 0x40, 0x00, 0x01, 0x10, 0x00, 0x1b, 0x28, 0x10, 0x00,
+    0x15, 0x2b, 0x10, 0x00, 0x11, 0x10, 0x10, 0x00, 0x1b, 0x2e, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09,
+    0x30, 0x00, 0x48, 0xc2, 0x02, 0x33, 0x20, 0xa0, 0x00, 0x4b, 0xc2, 0x02, 0x33, 0x24, 0x10, 0x00,
+    0x18, 0x28, 0xb0, 0x00, 0x4b, 0xc2, 0x02, 0x33, 0x2c, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30,
+    0x00, 0x1b, 0xea, 0x20, 0x00, 0x1b, 0xea, 0x60, 0x00, 0x1e, 0xea, 0x30, 0x00, 0x09, 0x60, 0x00,
+    0x0f, 0x40, 0x00, 0x00, 0x09, 0x30, 0x00, 0x1b, 0xed, 0x20, 0x00, 0x1b, 0xed, 0x60, 0x00, 0x1e,
+    0xed, 0x30, 0x00, 0x09, 0x60, 0x00, 0x0f, 0x40, 0x00, 0x00, 0x09, 0x30, 0x00, 0x2a, 0xf5, 0x02,
+    0xb0, 0x08, 0x2a, 0xf5, 0x02, 0xb0, 0x08, 0x42, 0x05, 0x03, 0x11, 0xd4, 0x10, 0x03, 0x11, 0xa4,
+    0x10, 0x03, 0xf0, 0x05, 0x13, 0x03, 0x33, 0x31, 0x11, 0x00, 0x00, 0x08, 0x06, 0x06, 0xac, 0x05,
+    0x05, 0x00, 0x85, 0x00, 0x14, 0x03, 0x33, 0x34, 0x10, 0x00, 0x22, 0x08, 0x08, 0x10, 0x00, 0x1b,
+    0x15, 0x10, 0x00, 0x1b, 0x16, 0x10, 0x00, 0x48, 0x17, 0x03, 0x33, 0x37, 0x10, 0x00, 0x40, 0x18,
+    0x03, 0x33, 0x3a, 0x10, 0x00, 0x20, 0x07, 0x07, 0x10, 0x00, 0x71, 0x05, 0x00, 0x1b, 0x03, 0x22,
+    0x72, 0x1d, 0x70, 0x00, 0x20, 0xa8, 0x05, 0x70, 0x00, 0x1b, 0x1c, 0x10, 0x00, 0x21, 0x1d, 0x03,
+    0xc7, 0x0a, 0x41, 0x08, 0x09, 0x09, 0xb4, 0x09, 0x00, 0x48, 0x1e, 0x03, 0x22, 0x74, 0x20, 0x00,
+    0x33, 0x1f, 0x03, 0x11, 0x30, 0x00, 0x20, 0xb0, 0x05, 0x20, 0x00, 0x2a, 0x22, 0x03, 0xc0, 0x03,
+    0x2a, 0x22, 0x03, 0xc0, 0x03, 0x4b, 0x23, 0x03, 0x23, 0x3d, 0x10, 0x00, 0x18, 0x40, 0x10, 0x00,
+    0xb1, 0x37, 0x03, 0x33, 0x53, 0x01, 0x00, 0x00, 0x0a, 0x0a, 0x0a, 0x20, 0x80, 0x0b, 0x4b, 0x37,
+    0x03, 0x33, 0x5d, 0x10, 0x00, 0x14, 0x67, 0x10, 0x00, 0x21, 0x01, 0x10, 0x10, 0x00, 0x18, 0x71,
+    0x10, 0x00, 0x21, 0x39, 0x03, 0xc6, 0x95, 0x05, 0x30, 0x00, 0x4b, 0x39, 0x03, 0x33, 0x85, 0x10,
+    0x00, 0x1b, 0x8f, 0x30, 0x00, 0x18, 0x99, 0x10, 0x00, 0x51, 0x3a, 0x03, 0x33, 0xa0, 0x07, 0x10,
+    0x00, 0x11, 0x24, 0x30, 0x00, 0x21, 0x3a, 0x03, 0xaa, 0x95, 0x01, 0x10, 0x00, 0x00, 0x20, 0x00,
+    0x48, 0x3d, 0x03, 0x33, 0xa8, 0x20, 0x00, 0x48, 0x3d, 0x03, 0x33, 0xac, 0x20, 0x00, 0x1b, 0x3e,
+    0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3f,
+    0xc0, 0x00, 0x1b, 0x3f, 0xc0, 0x00, 0x1b, 0x3f, 0xc0, 0x00, 0x1b, 0x3f, 0xc0, 0x00, 0xb1, 0x40,
+    0x03, 0x33, 0xc0, 0x06, 0x00, 0x00, 0x04, 0x4d, 0x0f, 0x28, 0x30, 0x00, 0xa5, 0x40, 0x03, 0x33,
+    0x3c, 0x08, 0x00, 0x00, 0xc6, 0xb4, 0x55, 0x10, 0x00, 0x14, 0xc4, 0x20, 0x00, 0x03, 0x30, 0x00,
+    0x14, 0x40, 0x20, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x41, 0x40, 0x00, 0x1b, 0x41, 0x40, 0x00, 0x1b,
+    0x41, 0x40, 0x00, 0x1b, 0x41, 0x40, 0x00, 0x1b, 0x42, 0x40, 0x00, 0x1b, 0x42, 0x40, 0x00, 0x1b,
+    0x42, 0x40, 0x00, 0x1b, 0x42, 0x40, 0x00, 0x1b, 0x43, 0x40, 0x00, 0x1b, 0x43, 0x40, 0x00, 0x1b,
+    0x43, 0x40, 0x00, 0x1b, 0x43, 0x40, 0x00, 0x55, 0x44, 0x03, 0x22, 0xa1, 0x0d, 0x40, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0xec, 0x96, 0x03, 0x30, 0x00, 0x77, 0x00, 0x00, 0x45, 0x03, 0x33, 0xb7,
+    0x0f, 0x20, 0x00, 0x44, 0x45, 0x03, 0x33, 0xba, 0x10, 0x00, 0x00, 0x20, 0x00, 0xa2, 0x48, 0x03,
+    0x33, 0xc8, 0x06, 0x00, 0x00, 0x6e, 0x0a, 0x0a, 0x70, 0x00, 0x5a, 0x48, 0x03, 0x33, 0x43, 0x11,
+    0x10, 0x00, 0x14, 0xcc, 0x20, 0x00, 0x00, 0x70, 0x00, 0x44, 0x48, 0x03, 0x33, 0x46, 0x20, 0x00,
+    0x00, 0x10, 0x00, 0x48, 0x49, 0x03, 0x33, 0xa8, 0x40, 0x00, 0x48, 0x49, 0x03, 0x33, 0x49, 0x40,
+    0x00, 0x48, 0x49, 0x03, 0x33, 0xac, 0x40, 0x00, 0x48, 0x49, 0x03, 0x33, 0x4c, 0x40, 0x00, 0x1b,
+    0x4a, 0x80, 0x00, 0x1b, 0x4a, 0x80, 0x00, 0x1b, 0x4a, 0x80, 0x00, 0x1b, 0x4a, 0x80, 0x00, 0x1b,
+    0x4b, 0x80, 0x00, 0x1b, 0x4b, 0x80, 0x00, 0x1b, 0x4b, 0x80, 0x00, 0x1b, 0x4b, 0x80, 0x00, 0xb0,
+    0x4c, 0x03, 0x22, 0x76, 0x1d, 0x00, 0x00, 0x28, 0x50, 0x11, 0x2c, 0x10, 0x01, 0x57, 0x02, 0x4c,
+    0x03, 0x22, 0x78, 0x10, 0x00, 0x58, 0x03, 0x4d, 0x03, 0x22, 0x7a, 0x20, 0x00, 0x48, 0x4d, 0x03,
+    0x22, 0x7c, 0x20, 0x00, 0x42, 0x50, 0x03, 0x44, 0x40, 0x10, 0x03, 0x02, 0x70, 0x00, 0x4b, 0x50,
+    0x03, 0x44, 0x44, 0x10, 0x00, 0x14, 0x48, 0x10, 0x00, 0x00, 0x70, 0x00, 0x48, 0x50, 0x03, 0x44,
+    0x4c, 0x10, 0x00, 0x21, 0x51, 0x03, 0x9e, 0xa5, 0x05, 0x30, 0x00, 0x4b, 0x51, 0x03, 0x44, 0x54,
+    0x10, 0x00, 0x1b, 0x58, 0x30, 0x00, 0x18, 0x5c, 0x10, 0x00, 0x48, 0x52, 0x03, 0x44, 0x60, 0x30,
+    0x00, 0x4b, 0x52, 0x03, 0x44, 0x64, 0x10, 0x00, 0x1b, 0x68, 0x30, 0x00, 0x18, 0x6c, 0x10, 0x00,
+    0x48, 0x53, 0x03, 0x44, 0x70, 0x30, 0x00, 0x4b, 0x53, 0x03, 0x44, 0x74, 0x10, 0x00, 0x1b, 0x78,
+    0x30, 0x00, 0x18, 0x7c, 0x10, 0x00, 0x40, 0x54, 0x03, 0x22, 0x7e, 0x10, 0x01, 0x30, 0x0a, 0x0a,
+    0x30, 0x10, 0x01, 0x50, 0x06, 0x5a, 0x03, 0x22, 0x80, 0x10, 0x00, 0x22, 0x0b, 0x0b, 0x10, 0x00,
+    0x44, 0x60, 0x03, 0x22, 0x82, 0x10, 0x00, 0x87, 0x04, 0x00, 0x00, 0x02, 0x60, 0x03, 0x22, 0x84,
+    0x30, 0x00, 0x67, 0x02, 0x61, 0x03, 0x22, 0x50, 0x10, 0x20, 0x00, 0x47, 0x61, 0x03, 0x22, 0x86,
+    0x30, 0x00, 0x6a, 0x03, 0x61, 0x03, 0x22, 0x18, 0x1c, 0x30, 0x00, 0x17, 0x88, 0x40, 0x00, 0x52,
+    0x03, 0x62, 0x03, 0x44, 0x80, 0x90, 0x00, 0x02, 0x30, 0x04, 0x4b, 0x62, 0x03, 0x44, 0x84, 0x10,
+    0x00, 0x14, 0x88, 0x10, 0x00, 0x00, 0xb0, 0x00, 0x48, 0x62, 0x03, 0x44, 0x8c, 0x10, 0x00, 0x48,
+    0x64, 0x03, 0x44, 0x90, 0x30, 0x00, 0x4b, 0x64, 0x03, 0x44, 0x94, 0x10, 0x00, 0x1b, 0x98, 0x30,
+    0x00, 0x18, 0x9c, 0x10, 0x00, 0x39, 0x65, 0x03, 0x44, 0x40, 0x05, 0x39, 0x65, 0x03, 0x44, 0x40,
+    0x05, 0x39, 0x67, 0x03, 0x44, 0x40, 0x05, 0x39, 0x67, 0x03, 0x44, 0x40, 0x05, 0x73, 0x68, 0x03,
+    0x23, 0x25, 0x0e, 0x00, 0x33, 0x20, 0x00, 0x10, 0x00, 0x10, 0x00, 0x14, 0x28, 0x10, 0x00, 0x00,
+    0xa0, 0x03, 0x48, 0x6a, 0x03, 0x23, 0x2b, 0x20, 0x00, 0x48, 0x6a, 0x03, 0x23, 0x2e, 0x20, 0x00,
+    0xb1, 0x6d, 0x03, 0x22, 0xe6, 0x1a, 0x00, 0x00, 0x3e, 0x0a, 0x0a, 0x2c, 0x20, 0x00, 0x40, 0x6d,
+    0x03, 0x22, 0x8a, 0x1a, 0xe5, 0x07, 0x10, 0x00, 0x14, 0xe8, 0x20, 0x00, 0x03, 0x30, 0x00, 0x14,
+    0x8c, 0x20, 0x00, 0x00, 0x10, 0x00, 0x42, 0x6f, 0x03, 0x22, 0xea, 0x20, 0x00, 0x00, 0xf0, 0x00,
+    0x01, 0x10, 0x00, 0x12, 0x8e, 0x20, 0x00, 0x05, 0x10, 0x00, 0x14, 0xec, 0x20, 0x00, 0x03, 0x30,
+    0x00, 0x14, 0x90, 0x20, 0x00, 0x00, 0x10, 0x00, 0x40, 0x77, 0x03, 0x22, 0x92, 0x10, 0x00, 0x22,
+    0x50, 0x11, 0x50, 0x04, 0x48, 0x77, 0x03, 0x22, 0x94, 0x10, 0x00, 0x4b, 0x78, 0x03, 0x22, 0x96,
+    0x10, 0x00, 0x18, 0x98, 0x10, 0x00, 0x1b, 0x79, 0x40, 0x00, 0x1b, 0x79, 0x40, 0x00, 0x1b, 0x7a,
+    0x40, 0x00, 0x1b, 0x7a, 0x40, 0x00, 0x44, 0x7b, 0x03, 0x22, 0x9a, 0x10, 0x00, 0x00, 0xb0, 0x00,
+    0x4b, 0x7b, 0x03, 0x22, 0x9c, 0x10, 0x00, 0x1b, 0x9e, 0x30, 0x00, 0x18, 0xa0, 0x10, 0x00, 0x48,
+    0x7c, 0x03, 0x22, 0xee, 0x00, 0x01, 0x48, 0x7c, 0x03, 0x22, 0xa2, 0x00, 0x01, 0x48, 0x7c, 0x03,
+    0x22, 0xf0, 0x00, 0x01, 0x48, 0x7c, 0x03, 0x22, 0xa4, 0x00, 0x01, 0x48, 0x7e, 0x03, 0x22, 0xf6,
+    0x40, 0x00, 0x48, 0x7e, 0x03, 0x22, 0xa6, 0x40, 0x00, 0x48, 0x7e, 0x03, 0x22, 0xf8, 0x40, 0x00,
+    0x48, 0x7e, 0x03, 0x22, 0xa8, 0x40, 0x00, 0x40, 0x84, 0x03, 0x22, 0xaa, 0x10, 0x00, 0x31, 0x5e,
+    0x1e, 0x3c, 0x30, 0x00, 0x4b, 0x84, 0x03, 0x22, 0xac, 0x10, 0x00, 0x14, 0xae, 0x10, 0x00, 0x03,
+    0x30, 0x00, 0x18, 0xb0, 0x10, 0x00, 0x40, 0x8b, 0x03, 0x22, 0x00, 0xf8, 0xe6, 0x04, 0x70, 0x00,
+    0x48, 0x8b, 0x03, 0x22, 0xb2, 0x80, 0x00, 0x44, 0x8b, 0x03, 0x22, 0x02, 0x20, 0x00, 0x03, 0x30,
+    0x00, 0x18, 0xb4, 0x80, 0x00, 0x42, 0x8c, 0x03, 0x22, 0x04, 0x20, 0x00, 0x02, 0x60, 0x02, 0x42,
+    0x8c, 0x03, 0x22, 0xb6, 0x20, 0x00, 0x05, 0x10, 0x00, 0x14, 0x06, 0x20, 0x00, 0x03, 0x30, 0x00,
+    0x14, 0xb8, 0x20, 0x00, 0x00, 0x10, 0x00, 0x40, 0x8d, 0x03, 0x33, 0x4f, 0x36, 0xf3, 0x04, 0xb0,
+    0x00, 0x4b, 0x8d, 0x03, 0x33, 0x52, 0x10, 0x00, 0x14, 0x55, 0x10, 0x00, 0x03, 0x30, 0x00, 0x18,
+    0x58, 0x10, 0x00, 0x43, 0x96, 0x03, 0x22, 0x0c, 0x60, 0x00, 0x01, 0x58, 0x6f, 0x4b, 0x96, 0x03,
+    0x22, 0x0e, 0x10, 0x00, 0x01, 0x60, 0xea, 0x00, 0x10, 0x00, 0x03, 0x30, 0x00, 0x01, 0xa6, 0xea,
+    0x07, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30, 0x00, 0x40, 0x97, 0x03, 0x33, 0x5b, 0x70, 0x00,
+    0x04, 0x80, 0x03, 0x44, 0x97, 0x03, 0x33, 0x5e, 0x10, 0x00, 0x00, 0x80, 0x03, 0x04, 0x4c, 0xf5,
+    0x01, 0x10, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x80, 0xf5, 0x07, 0x10, 0x00, 0x01, 0x5a, 0xf5,
+    0x07, 0x30, 0x00, 0x01, 0x8e, 0xf5, 0x0f, 0x40, 0x00, 0x08, 0x09, 0x30, 0x00, 0x04, 0x68, 0xf4,
+    0x04, 0x20, 0x00, 0x04, 0xae, 0xf4, 0x07, 0x10, 0x00, 0x01, 0x76, 0xf4, 0x07, 0x30, 0x00, 0x01,
+    0xbc, 0xf4, 0x0f, 0x40, 0x00, 0x08, 0x09, 0x30, 0x00, 0x48, 0xa0, 0x03, 0x33, 0x79, 0xe0, 0x00,
+    0x48, 0xa0, 0x03, 0x33, 0x7c, 0x20, 0x00, 0x48, 0xa2, 0x03, 0x22, 0x2c, 0x20, 0x01, 0x4b, 0xa2,
+    0x03, 0x22, 0x2e, 0x10, 0x00, 0x01, 0x38, 0xe9, 0x04, 0x30, 0x01, 0x04, 0x2e, 0xf4, 0x07, 0x10,
+    0x00, 0x0c, 0x40, 0x00, 0x09, 0x30, 0x00, 0x1b, 0xa4, 0x40, 0x03, 0x1b, 0xa4, 0x40, 0x03, 0x1b,
+    0xa4, 0x40, 0x03, 0x1b, 0xa4, 0x40, 0x03, 0x1b, 0xae, 0xc0, 0x02, 0x1b, 0xae, 0xc0, 0x02, 0x1b,
+    0xae, 0xc0, 0x02, 0x1b, 0xae, 0xc0, 0x02, 0x1b, 0xb2, 0x00, 0x02, 0x1b, 0xb2, 0x40, 0x02, 0x04,
+    0xa0, 0xec, 0x04, 0xb0, 0x00, 0x04, 0xe6, 0xec, 0x07, 0x10, 0x00, 0x0c, 0x40, 0x00, 0x09, 0x30,
+    0x00, 0x1b, 0xb6, 0x00, 0x01, 0x1b, 0xb6, 0x40, 0x01, 0x04, 0x78, 0xea, 0x07, 0x30, 0x00, 0x09,
+    0x40, 0x01, 0x0f, 0x40, 0x00, 0x00, 0x09, 0x30, 0x00, 0x1b, 0xc4, 0x40, 0x0b, 0x1b, 0xc4, 0x40,
+    0x0b, 0x1b, 0xc4, 0x40, 0x0b, 0x1b, 0xc4, 0x40, 0x0b, 0x1b, 0xc6, 0x40, 0x0b, 0x1b, 0xc6, 0x40,
+    0x0b, 0x1b, 0xc6, 0x40, 0x0b, 0x1b, 0xc6, 0x40, 0x0b, 0x1b, 0xc7, 0x00, 0x0c, 0x1b, 0xc7, 0x00,
+    0x0c, 0x1b, 0xc9, 0x00, 0x0c, 0x1b, 0xc9, 0x00, 0x0c, 0x15, 0xcb, 0x00, 0x09, 0x02, 0x70, 0x00,
+    0x15, 0xcb, 0xf0, 0x08, 0x02, 0x60, 0x00, 0x15, 0xcc, 0xe0, 0x08, 0x02, 0x20, 0x00, 0x15, 0xcc,
+    0xe0, 0x08, 0x05, 0x10, 0x00, 0x03, 0xe0, 0x08, 0x05, 0x30, 0x00, 0x03, 0xe0, 0x08, 0x02, 0x10,
+    0x00, 0x51, 0xd4, 0x03, 0x33, 0x7f, 0x11, 0x10, 0x00, 0x01, 0x10, 0x08, 0x00, 0x10, 0x00, 0x14,
+    0x82, 0x10, 0x00, 0x00, 0x40, 0x01, 0x83, 0xd9, 0x03, 0x33, 0x85, 0x11, 0x00, 0x00, 0x0c, 0x30,
+    0x08, 0x00, 0x10, 0x00, 0x14, 0x88, 0x10, 0x00, 0x00, 0x20, 0x00, 0x42, 0xde, 0x03, 0x33, 0x8b,
+    0x30, 0x00, 0x11, 0x2c, 0xa6, 0x73, 0x03, 0xc8, 0xdf, 0x02, 0x10, 0x00, 0xd2, 0x10, 0x00, 0x00,
+    0xe9, 0x03, 0x33, 0x91, 0x11, 0x00, 0x00, 0xcc, 0x62, 0x1f, 0x90, 0x00, 0x4b, 0xe9, 0x03, 0x33,
+    0x94, 0x10, 0x00, 0x14, 0x97, 0x10, 0x00, 0x00, 0x90, 0x00, 0x48, 0xe9, 0x03, 0x33, 0x9a, 0x10,
+    0x00, 0x48, 0xeb, 0x03, 0x33, 0x9d, 0x30, 0x00, 0x4b, 0xeb, 0x03, 0x33, 0xa0, 0x10, 0x00, 0x1b,
+    0xa3, 0x30, 0x00, 0x18, 0xa6, 0x10, 0x00, 0x42, 0xec, 0x03, 0x33, 0xa9, 0x10, 0x00, 0x02, 0x60,
+    0x01, 0x44, 0xec, 0x03, 0x33, 0xac, 0x10, 0x00, 0x00, 0x20, 0x00, 0x48, 0xee, 0x03, 0x33, 0xaf,
+    0x20, 0x00, 0x48, 0xee, 0x03, 0x33, 0xb2, 0x20, 0x00, 0x1b, 0xef, 0xc0, 0x00, 0x1b, 0xef, 0xc0,
+    0x00, 0x1b, 0xef, 0xc0, 0x00, 0x1b, 0xef, 0xc0, 0x00, 0x1b, 0xf1, 0xc0, 0x00, 0x1b, 0xf1, 0xc0,
+    0x00, 0x1b, 0xf1, 0xc0, 0x00, 0x1b, 0xf1, 0xc0, 0x00, 0x1b, 0xf2, 0xc0, 0x00, 0x1b, 0xf2, 0xc0,
+    0x00, 0x1b, 0xf4, 0xc0, 0x00, 0x1b, 0xf4, 0xc0, 0x00, 0x1b, 0xf5, 0xc0, 0x00, 0x1b, 0xf5, 0xc0,
+    0x00, 0x1b, 0xf5, 0xc0, 0x00, 0x1b, 0xf5, 0xc0, 0x00, 0x1b, 0xf7, 0xc0, 0x00, 0x1b, 0xf7, 0xc0,
+    0x00, 0x1b, 0xf7, 0xc0, 0x00, 0x1b, 0xf7, 0xc0, 0x00, 0x1b, 0xf8, 0xc0, 0x00, 0x1b, 0xf8, 0xc0,
+    0x00, 0x1b, 0xfa, 0xc0, 0x00, 0x1b, 0xfa, 0xc0, 0x00, 0x30, 0xfe, 0x03, 0x44, 0xc0, 0x03, 0x41,
+    0x4c, 0x63, 0x20, 0x00, 0x20, 0x00, 0x4b, 0xfe, 0x03, 0x44, 0x58, 0x10, 0x00, 0x00, 0xd0, 0x03,
+    0x08, 0x10, 0x00, 0x1b, 0x62, 0x10, 0x00, 0x00, 0xe0, 0x03, 0x01, 0x10, 0x00, 0x03, 0x50, 0x00,
+    0x1b, 0x6c, 0x10, 0x00, 0x00, 0xf0, 0x03, 0x08, 0x10, 0x00, 0x18, 0x76, 0x10, 0x00, 0x30, 0xff,
+    0x03, 0x44, 0x00, 0x04, 0x05, 0x50, 0x00, 0x4b, 0xff, 0x03, 0x44, 0x80, 0x10, 0x00, 0x00, 0x10,
+    0x04, 0x08, 0x10, 0x00, 0x1b, 0x8a, 0x10, 0x00, 0x00, 0x20, 0x04, 0x08, 0x50, 0x00, 0x1b, 0x94,
+    0x10, 0x00, 0x00, 0x30, 0x04, 0x08, 0x10, 0x00, 0x18, 0x9e, 0x10, 0x00, 0x57, 0x00, 0x04, 0x44,
+    0xb0, 0x07, 0x50, 0x00, 0x4b, 0x00, 0x04, 0x44, 0xb4, 0x10, 0x00, 0x14, 0xb8, 0x10, 0x00, 0x03,
+    0x30, 0x00, 0x18, 0xbc, 0x10, 0x00, 0x48, 0x01, 0x04, 0x44, 0xc0, 0x30, 0x00, 0x4b, 0x01, 0x04,
+    0x44, 0xc4, 0x10, 0x00, 0x1b, 0xc8, 0x30, 0x00, 0x18, 0xcc, 0x10, 0x00, 0x2a, 0x02, 0x04, 0x40,
+    0x02, 0x2a, 0x02, 0x04, 0x40, 0x02, 0x2a, 0x02, 0x04, 0x40, 0x02, 0x2a, 0x02, 0x04, 0x40, 0x02,
+    0x2a, 0x04, 0x04, 0x40, 0x02, 0x2a, 0x04, 0x04, 0x40, 0x02, 0x2a, 0x04, 0x04, 0x40, 0x02, 0x2a,
+    0x04, 0x04, 0x40, 0x02, 0x1b, 0x05, 0x80, 0x00, 0x1b, 0x05, 0x80, 0x00, 0x1b, 0x05, 0x80, 0x00,
+    0x1b, 0x05, 0x80, 0x00, 0x1b, 0x07, 0x80, 0x00, 0x1b, 0x07, 0x80, 0x00, 0x1b, 0x07, 0x80, 0x00,
+    0x1b, 0x07, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x00, 0x1b, 0x08, 0x80, 0x00,
+    0x1b, 0x08, 0x80, 0x00, 0x1b, 0x0a, 0x80, 0x00, 0x1b, 0x0a, 0x80, 0x00, 0x1b, 0x0a, 0x80, 0x00,
+    0x1b, 0x0a, 0x80, 0x00, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0b,
+    0x04, 0x00, 0x03, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0b, 0x04,
+    0x00, 0x03, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0b, 0x04, 0x00, 0x03, 0x2a, 0x0c, 0x04, 0x00,
+    0x03, 0x2a, 0x0c, 0x04, 0x00, 0x03, 0x2a, 0x0c, 0x04, 0x00, 0x03, 0x2a, 0x0c, 0x04, 0x00, 0x03,
+    0x2a, 0x0c, 0x04, 0x00, 0x03, 0x2a, 0x0c, 0x04, 0x00, 0x03, 0x2a, 0x0c, 0x04, 0x00, 0x03, 0x2a,
+    0x0c, 0x04, 0x00, 0x03, 0x1b, 0x0d, 0x80, 0x01, 0x1b, 0x0d, 0x80, 0x01, 0x1b, 0x0d, 0x80, 0x01,
+    0x1b, 0x0d, 0x80, 0x01, 0x1b, 0x0f, 0x80, 0x01, 0x1b, 0x0f, 0x80, 0x01, 0x1b, 0x0f, 0x80, 0x01,
+    0x1b, 0x0f, 0x80, 0x01, 0x2a, 0x10, 0x04, 0xc0, 0x04, 0x2a, 0x10, 0x04, 0xc0, 0x04, 0x2a, 0x12,
+    0x04, 0xc0, 0x04, 0x2a, 0x12, 0x04, 0xc0, 0x04, 0x1b, 0x13, 0xc0, 0x00, 0x1b, 0x13, 0xc0, 0x00,
+    0x1b, 0x13, 0xc0, 0x00, 0x1b, 0x13, 0xc0, 0x00, 0x1b, 0x15, 0xc0, 0x00, 0x1b, 0x15, 0xc0, 0x00,
+    0x1b, 0x15, 0xc0, 0x00, 0x1b, 0x15, 0xc0, 0x00, 0x1b, 0x16, 0xc0, 0x00, 0x1b, 0x16, 0xc0, 0x00,
+    0x1b, 0x18, 0xc0, 0x00, 0x1b, 0x18, 0xc0, 0x00, 0x1b, 0x19, 0xc0, 0x00, 0x1b, 0x19, 0xc0, 0x00,
+    0x1b, 0x19, 0xc0, 0x00, 0x1b, 0x19, 0xc0, 0x00, 0x1b, 0x1b, 0xc0, 0x00, 0x1b, 0x1b, 0xc0, 0x00,
+    0x1b, 0x1b, 0xc0, 0x00, 0x1b, 0x1b, 0xc0, 0x00, 0x1b, 0x1c, 0xc0, 0x00, 0x1b, 0x1c, 0xc0, 0x00,
+    0x1b, 0x1e, 0xc0, 0x00, 0x1b, 0x1e, 0xc0, 0x00, 0x1b, 0x1f, 0xc0, 0x00, 0x1b, 0x1f, 0xc0, 0x00,
+    0x1b, 0x1f, 0xc0, 0x00, 0x1b, 0x1f, 0xc0, 0x00, 0x1b, 0x21, 0xc0, 0x00, 0x1b, 0x21, 0xc0, 0x00,
+    0x1b, 0x21, 0xc0, 0x00, 0x1b, 0x21, 0xc0, 0x00, 0x1b, 0x22, 0x80, 0x00, 0x1b, 0x22, 0x80, 0x00,
+    0x1b, 0x22, 0x80, 0x00, 0x1b, 0x22, 0x80, 0x00, 0x1b, 0x24, 0x80, 0x00, 0x1b, 0x24, 0x80, 0x00,
+    0x1b, 0x24, 0x80, 0x00, 0x1b, 0x24, 0x80, 0x00, 0x1b, 0x25, 0x80, 0x00, 0x1b, 0x25, 0x80, 0x00,
+    0x1b, 0x25, 0x80, 0x00, 0x1b, 0x25, 0x80, 0x00, 0x1b, 0x27, 0x80, 0x00, 0x1b, 0x27, 0x80, 0x00,
+    0x1b, 0x27, 0x80, 0x00, 0x1b, 0x27, 0x80, 0x00, 0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x28, 0xc0, 0x04,
+    0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x28, 0xc0, 0x04,
+    0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x28, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04,
+    0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04,
+    0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x29, 0xc0, 0x04, 0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2a, 0x00, 0x01,
+    0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2a, 0x00, 0x01,
+    0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2a, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01,
+    0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01,
+    0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2b, 0x00, 0x01, 0x1b, 0x2c, 0xc0, 0x08, 0x1b, 0x2c, 0xc0, 0x08,
+    0x1b, 0x2c, 0xc0, 0x08, 0x1b, 0x2c, 0xc0, 0x08, 0x1b, 0x2d, 0xc0, 0x08, 0x1b, 0x2d, 0xc0, 0x08,
+    0x1b, 0x2d, 0xc0, 0x08, 0x1b, 0x2d, 0xc0, 0x08, 0x1b, 0x30, 0x00, 0x03, 0x1b, 0x30, 0x00, 0x03,
+    0x1b, 0x30, 0x00, 0x03, 0x1b, 0x30, 0x00, 0x03, 0x1b, 0x32, 0x00, 0x03, 0x1b, 0x32, 0x00, 0x03,
+    0x1b, 0x32, 0x00, 0x03, 0x1b, 0x32, 0x00, 0x03, 0x1b, 0x33, 0xc0, 0x04, 0x1b, 0x33, 0xc0, 0x04,
+    0x1b, 0x35, 0xc0, 0x04, 0x1b, 0x35, 0xc0, 0x04, 0x1b, 0x36, 0xc0, 0x00, 0x1b, 0x36, 0xc0, 0x00,
+    0x1b, 0x36, 0xc0, 0x00, 0x1b, 0x36, 0xc0, 0x00, 0x1b, 0x38, 0xc0, 0x00, 0x1b, 0x38, 0xc0, 0x00,
+    0x1b, 0x38, 0xc0, 0x00, 0x1b, 0x38, 0xc0, 0x00, 0x1b, 0x39, 0xc0, 0x00, 0x1b, 0x39, 0xc0, 0x00,
+    0x1b, 0x3b, 0xc0, 0x00, 0x1b, 0x3b, 0xc0, 0x00, 0x1b, 0x3c, 0xc0, 0x00, 0x1b, 0x3c, 0xc0, 0x00,
+    0x1b, 0x3c, 0xc0, 0x00, 0x1b, 0x3c, 0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00,
+    0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3e, 0xc0, 0x00, 0x1b, 0x3f, 0xc0, 0x00, 0x1b, 0x3f, 0xc0, 0x00,
+    0x1b, 0x41, 0xc0, 0x00, 0x1b, 0x41, 0xc0, 0x00, 0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x42, 0xc0, 0x03,
+    0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x42, 0xc0, 0x03,
+    0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x42, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03,
+    0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03,
+    0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x43, 0xc0, 0x03, 0x1b, 0x44, 0xc0, 0x03, 0x1b, 0x44, 0xc0, 0x03,
+    0x1b, 0x44, 0xc0, 0x03, 0x1b, 0x44, 0xc0, 0x03, 0x1b, 0x45, 0xc0, 0x03, 0x1b, 0x45, 0xc0, 0x03,
+    0x1b, 0x45, 0xc0, 0x03, 0x1b, 0x45, 0xc0, 0x03, 0x1b, 0x46, 0x40, 0x02, 0x1b, 0x46, 0x40, 0x02,
+    0x1b, 0x46, 0x40, 0x02, 0x1b, 0x46, 0x40, 0x02, 0x1b, 0x48, 0x40, 0x02, 0x1b, 0x48, 0x40, 0x02,
+    0x1b, 0x48, 0x40, 0x02, 0x1b, 0x48, 0x40, 0x02, 0x1b, 0x49, 0x40, 0x02, 0x1b, 0x49, 0x40, 0x02,
+    0x1b, 0x4b, 0x40, 0x02, 0x1b, 0x4b, 0x40, 0x02, 0x1b, 0x4c, 0xc0, 0x00, 0x1b, 0x4c, 0xc0, 0x00,
+    0x1b, 0x4c, 0xc0, 0x00, 0x1b, 0x4c, 0xc0, 0x00, 0x1b, 0x4e, 0xc0, 0x00, 0x1b, 0x4e, 0xc0, 0x00,
+    0x1b, 0x4e, 0xc0, 0x00, 0x1b, 0x4e, 0xc0, 0x00, 0x1b, 0x4f, 0xc0, 0x00, 0x1b, 0x4f, 0xc0, 0x00,
+    0x1b, 0x51, 0xc0, 0x00, 0x1b, 0x51, 0xc0, 0x00, 0x1b, 0x52, 0xc0, 0x00, 0x1b, 0x52, 0xc0, 0x00,
+    0x1b, 0x52, 0xc0, 0x00, 0x1b, 0x52, 0xc0, 0x00, 0x1b, 0x54, 0xc0, 0x00, 0x1b, 0x54, 0xc0, 0x00,
+    0x1b, 0x54, 0xc0, 0x00, 0x1b, 0x54, 0xc0, 0x00, 0x1b, 0x55, 0xc0, 0x00, 0x1b, 0x55, 0xc0, 0x00,
+    0x1b, 0x57, 0xc0, 0x00, 0x1b, 0x57, 0xc0, 0x00, 0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x58, 0xc0, 0x03,
+    0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x58, 0xc0, 0x03,
+    0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x58, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03,
+    0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03,
+    0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x59, 0xc0, 0x03, 0x1b, 0x5a, 0xc0, 0x03, 0x1b, 0x5a, 0xc0, 0x03,
+    0x1b, 0x5a, 0xc0, 0x03, 0x1b, 0x5a, 0xc0, 0x03, 0x1b, 0x5b, 0xc0, 0x03, 0x1b, 0x5b, 0xc0, 0x03,
+    0x1b, 0x5b, 0xc0, 0x03, 0x1b, 0x5b, 0xc0, 0x03, 0xf0, 0x00, 0x66, 0x04, 0x33, 0xb5, 0x11, 0x00,
+    0x00, 0x0e, 0x0c, 0x0c, 0x40, 0x04, 0x0c, 0x10, 0x24, 0x10, 0x00, 0x18, 0xb8, 0x10, 0x00, 0x4b,
+    0x67, 0x04, 0x33, 0xbb, 0x10, 0x00, 0x18, 0xbe, 0x10, 0x00, 0x1b, 0x72, 0x40, 0x00, 0x48, 0x72,
+    0x04, 0x33, 0xc1, 0x10, 0x00, 0x4b, 0x73, 0x04, 0x33, 0xc4, 0x10, 0x00, 0x18, 0xc7, 0x10, 0x00,
+    0xa2, 0x80, 0x04, 0x44, 0xd0, 0x07, 0x00, 0x00, 0x52, 0x4e, 0x21, 0x70, 0x1d, 0x4b, 0x80, 0x04,
+    0x44, 0xd4, 0x10, 0x00, 0x14, 0xd8, 0x10, 0x00, 0x00, 0xb0, 0x00, 0x48, 0x80, 0x04, 0x44, 0xdc,
+    0x10, 0x00, 0x1b, 0x81, 0x40, 0x00, 0x1b, 0x81, 0x40, 0x00, 0x1b, 0x81, 0x40, 0x00, 0x1b, 0x81,
+    0x40, 0x00, 0x57, 0x82, 0x04, 0x33, 0xb8, 0x06, 0x30, 0x00, 0x5a, 0x82, 0x04, 0x33, 0x04, 0x08,
+    0x10, 0x00, 0x14, 0xbc, 0x20, 0x00, 0x03, 0x30, 0x00, 0x14, 0x08, 0x20, 0x00, 0x00, 0x10, 0x00,
+    0x2a, 0x88, 0x04, 0xc0, 0x16, 0x2a, 0x88, 0x04, 0xc0, 0x16, 0x2a, 0x88, 0x04, 0xc0, 0x16, 0x2a,
+    0x88, 0x04, 0xc0, 0x16, 0x12, 0x89, 0x86, 0xb8, 0x05, 0x30, 0x00, 0x2a, 0x89, 0x04, 0xc0, 0x16,
+    0x2a, 0x89, 0x04, 0xc0, 0x16, 0x2a, 0x89, 0x04, 0xc0, 0x16, 0x1b, 0x8a, 0x80, 0x00, 0x1b, 0x8a,
+    0x80, 0x00, 0x1b, 0x8a, 0x80, 0x00, 0x1b, 0x8a, 0x80, 0x00, 0x1b, 0x8b, 0x80, 0x00, 0x1b, 0x8b,
+    0x80, 0x00, 0x1b, 0x8b, 0x80, 0x00, 0x1b, 0x8b, 0x80, 0x00, 0x42, 0x8c, 0x04, 0x44, 0xe0, 0xb0,
+    0x16, 0x00, 0x80, 0x16, 0x64, 0x04, 0x06, 0x8c, 0x04, 0x44, 0xe4, 0x10, 0x00, 0x95, 0x01, 0x10,
+    0x04, 0x06, 0x91, 0x04, 0x44, 0xe8, 0x07, 0xa0, 0x16, 0x64, 0x04, 0x00, 0x91, 0x04, 0x44, 0xec,
+    0x10, 0x00, 0x00, 0x40, 0x00, 0x03, 0x9e, 0xc5, 0x01, 0x90, 0x16, 0x00, 0x20, 0x00, 0x03, 0x9c,
+    0xc5, 0x03, 0xa0, 0x16, 0x32, 0x04, 0x00, 0x97, 0xbc, 0xb8, 0x03, 0x70, 0x1f, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0xba, 0xb8, 0x05, 0x10, 0x00, 0x52, 0x98, 0x04, 0x12, 0x70, 0x1b, 0x30, 0x00, 0x01,
+    0x40, 0x25, 0x54, 0xa2, 0x04, 0x23, 0x1b, 0x0f, 0xc0, 0x1f, 0x76, 0x10, 0x00, 0x00, 0xa3, 0x04,
+    0x33, 0xca, 0x30, 0x17, 0x10, 0x04, 0x10, 0x00, 0x1b, 0xcd, 0x10, 0x00, 0x1b, 0xd0, 0x10, 0x00,
+    0x18, 0xd3, 0x10, 0x00, 0x4b, 0xa4, 0x04, 0x33, 0xd6, 0x10, 0x00, 0x1b, 0xd9, 0x10, 0x00, 0x1b,
+    0xdc, 0x10, 0x00, 0x18, 0xdf, 0x10, 0x00, 0x1b, 0xa5, 0xa0, 0x01, 0x1b, 0xa5, 0xa0, 0x01, 0x1b,
+    0xa5, 0xa0, 0x01, 0x1b, 0xa5, 0xa0, 0x01, 0x1b, 0xa7, 0xa0, 0x01, 0x1b, 0xa7, 0xa0, 0x01, 0x1b,
+    0xa7, 0xa0, 0x01, 0x1b, 0xa7, 0xa0, 0x01, 0x2a, 0xa8, 0x04, 0xe0, 0x18, 0x12, 0xa8, 0x8a, 0xba,
+    0x05, 0xc0, 0x18, 0x2a, 0xaa, 0x04, 0xe0, 0x18, 0x2a, 0xaa, 0x04, 0xe0, 0x18, 0x1b, 0xae, 0xc0,
+    0x00, 0x1b, 0xae, 0xc0, 0x00, 0x1b, 0xae, 0xc0, 0x00, 0x1b, 0xae, 0xc0, 0x00, 0x1b, 0xb0, 0xc0,
+    0x00, 0x1b, 0xb0, 0xc0, 0x00, 0x1b, 0xb0, 0xc0, 0x00, 0x1b, 0xb0, 0xc0, 0x00, 0x1b, 0xb1, 0xc0,
+    0x00, 0x1b, 0xb1, 0xc0, 0x00, 0x1b, 0xb3, 0xc0, 0x00, 0x1b, 0xb3, 0xc0, 0x00, 0xb1, 0xb7, 0x04,
+    0x22, 0x4a, 0x10, 0x00, 0x00, 0x40, 0x0a, 0x0a, 0x1c, 0x20, 0x19, 0x5a, 0xb7, 0x04, 0x22, 0x8a,
+    0x12, 0x10, 0x00, 0x14, 0x4d, 0x20, 0x00, 0x00, 0x40, 0x02, 0x44, 0xb7, 0x04, 0x22, 0x8d, 0x20,
+    0x00, 0x03, 0x10, 0x00, 0x10, 0xc0, 0xd0, 0xba, 0x07, 0x30, 0x00, 0x10, 0xbc, 0xce, 0xba, 0x07,
+    0x10, 0x00, 0x01, 0x26, 0xbb, 0x07, 0x30, 0x00, 0x01, 0x24, 0xbb, 0x04, 0x10, 0x00, 0x21, 0xb8,
+    0x04, 0xe0, 0x21, 0x05, 0x30, 0x00, 0x48, 0xb8, 0x04, 0x22, 0x9c, 0x80, 0x00, 0x48, 0xb8, 0x04,
+    0x22, 0x53, 0x80, 0x00, 0x48, 0xb8, 0x04, 0x22, 0x9f, 0x80, 0x00, 0x48, 0xb8, 0x04, 0x22, 0xc4,
+    0x80, 0x00, 0x48, 0xb8, 0x04, 0x22, 0xc0, 0x80, 0x00, 0x13, 0xb8, 0x70, 0xbb, 0x07, 0x30, 0x00,
+    0x01, 0x6e, 0xbb, 0x04, 0x10, 0x00, 0x04, 0xce, 0xc2, 0x04, 0x00, 0x1a, 0x04, 0xcc, 0xc2, 0x04,
+    0x00, 0x1a, 0x0f, 0x20, 0x00, 0x10, 0x1b, 0xc6, 0x20, 0x00, 0x1f, 0xd6, 0x20, 0x00, 0x19, 0x44,
+    0xba, 0x04, 0x22, 0x14, 0x20, 0x00, 0x00, 0xb0, 0x00, 0x15, 0xba, 0x80, 0x01, 0x05, 0x10, 0x00,
+    0x10, 0x10, 0x08, 0xbd, 0x07, 0x30, 0x00, 0x03, 0x80, 0x01, 0x02, 0x10, 0x00, 0x21, 0xbb, 0x04,
+    0xe0, 0x25, 0x05, 0xf0, 0x00, 0x48, 0xbb, 0x04, 0x22, 0xc8, 0x00, 0x01, 0x13, 0xbb, 0xdc, 0xbc,
+    0x04, 0xf0, 0x00, 0x13, 0xbb, 0xda, 0xbc, 0x07, 0x10, 0x00, 0x18, 0xe2, 0x40, 0x01, 0x4b, 0xbb,
+    0x04, 0x22, 0xca, 0x40, 0x00, 0x01, 0x52, 0xbd, 0x07, 0x30, 0x00, 0x01, 0x50, 0xbd, 0x04, 0x10,
+    0x00, 0x15, 0xbe, 0x80, 0x00, 0x02, 0x50, 0x21, 0x15, 0xbe, 0x80, 0x00, 0x05, 0x10, 0x00, 0x03,
+    0x80, 0x00, 0x02, 0x90, 0x04, 0x15, 0xbe, 0x80, 0x00, 0x05, 0x10, 0x00, 0x03, 0x80, 0x00, 0x05,
+    0x30, 0x00, 0x03, 0x80, 0x00, 0x05, 0x10, 0x00, 0x03, 0x80, 0x00, 0x05, 0x30, 0x00, 0x03, 0x80,
+    0x00, 0x02, 0x10, 0x00, 0x04, 0xa6, 0xbe, 0x31, 0x0a, 0x0a, 0x34, 0xe0, 0x02, 0x04, 0xa4, 0xbe,
+    0x04, 0x20, 0x05, 0x04, 0xa2, 0xbe, 0x04, 0x30, 0x01, 0x04, 0xa0, 0xbe, 0x04, 0x20, 0x00, 0x04,
+    0x9e, 0xbe, 0x04, 0x20, 0x00, 0x04, 0x9c, 0xbe, 0x04, 0x50, 0x00, 0x04, 0x9a, 0xbe, 0x04, 0x30,
+    0x00, 0x04, 0x98, 0xbe, 0x04, 0x30, 0x00, 0x04, 0x96, 0xbe, 0x04, 0x20, 0x00, 0x04, 0x94, 0xbe,
+    0x04, 0x20, 0x00, 0x42, 0xc9, 0x04, 0x22, 0xd0, 0x80, 0x00, 0x11, 0x34, 0xe0, 0x1d, 0x48, 0xc9,
+    0x04, 0x22, 0xd2, 0x10, 0x00, 0x4b, 0xca, 0x04, 0x22, 0xd4, 0x10, 0x00, 0x18, 0xd6, 0x10, 0x00,
+    0x04, 0xd2, 0xbe, 0x04, 0x70, 0x01, 0x04, 0xd0, 0xbe, 0x04, 0x10, 0x00, 0x04, 0xbc, 0xbe, 0x07,
+    0x10, 0x00, 0x01, 0x60, 0x01, 0x22, 0x0b, 0x0b, 0x10, 0x00, 0x04, 0xa6, 0xbe, 0x04, 0x20, 0x00,
+    0x04, 0xa4, 0xbe, 0x04, 0x10, 0x00, 0x04, 0x90, 0xbe, 0x07, 0x10, 0x00, 0x09, 0x20, 0x03, 0x48,
+    0xd3, 0x04, 0x22, 0xd8, 0xc0, 0x02, 0x48, 0xd3, 0x04, 0x22, 0xda, 0xe0, 0x00, 0x00, 0x10, 0x00,
+    0x0b, 0x20, 0x00, 0x1b, 0xfa, 0x20, 0x00, 0x14, 0xd8, 0x10, 0x00, 0x00, 0xd0, 0x00, 0x0f, 0x40,
+    0x00, 0x00, 0x14, 0x0a, 0x50, 0x01, 0x03, 0x20, 0x00, 0x09, 0x40, 0x00, 0x12, 0xd4, 0xe0, 0x04,
+    0x03, 0x20, 0x00, 0x3b, 0x04, 0x00, 0xd4, 0x10, 0x03, 0x44, 0xd4, 0x04, 0x33, 0xee, 0x80, 0x01,
+    0x03, 0x20, 0x00, 0x09, 0xa0, 0x01, 0x15, 0xd6, 0x60, 0x04, 0x02, 0x50, 0x02, 0x15, 0xd6, 0x60,
+    0x04, 0x05, 0x10, 0x00, 0x03, 0x60, 0x04, 0x02, 0x50, 0x02, 0x15, 0xd6, 0x60, 0x04, 0x02, 0x10,
+    0x00, 0x1b, 0xd7, 0x40, 0x00, 0x1b, 0xd7, 0x40, 0x00, 0x1b, 0xd7, 0x40, 0x00, 0x1b, 0xd7, 0x40,
+    0x00, 0x12, 0xd8, 0x80, 0x05, 0x05, 0xa0, 0x00, 0x21, 0xd8, 0x04, 0xb0, 0x26, 0x05, 0xa0, 0x00,
+    0x48, 0xd8, 0x04, 0x33, 0xf1, 0xc0, 0x00, 0x48, 0xd8, 0x04, 0x22, 0x1c, 0x20, 0x00, 0x15, 0xd9,
+    0xa0, 0x05, 0x02, 0x70, 0x00, 0x15, 0xd9, 0x20, 0x04, 0x05, 0x10, 0x00, 0x03, 0xa0, 0x05, 0x02,
+    0x70, 0x00, 0x15, 0xd9, 0x20, 0x04, 0x05, 0x10, 0x00, 0x03, 0xa0, 0x05, 0x05, 0x30, 0x00, 0x03,
+    0xa0, 0x05, 0x05, 0x10, 0x00, 0x03, 0x20, 0x02, 0x05, 0x30, 0x00, 0x03, 0x20, 0x02, 0x02, 0x10,
+    0x00, 0x1b, 0xda, 0x00, 0x01, 0x1b, 0xda, 0x00, 0x01, 0x1b, 0xda, 0x00, 0x01, 0x1b, 0xda, 0x00,
+    0x01, 0x15, 0xda, 0xa0, 0x05, 0x05, 0x30, 0x00, 0x03, 0xa0, 0x05, 0x05, 0x10, 0x00, 0x03, 0x80,
+    0x02, 0x05, 0x30, 0x00, 0x03, 0x80, 0x02, 0x02, 0x10, 0x00, 0x30, 0xdc, 0x04, 0x44, 0x42, 0x70,
+    0x05, 0x70, 0x28, 0x30, 0xdc, 0x04, 0x44, 0x40, 0x70, 0x35, 0x0c, 0x0b, 0x0b, 0x10, 0x00, 0x00,
+    0x2c, 0x70, 0x05, 0x70, 0x28, 0x30, 0xdc, 0x04, 0x44, 0x2a, 0x70, 0x01, 0x20, 0x00, 0x00, 0x10,
+    0x00, 0x1b, 0xe3, 0xa0, 0x07, 0x1b, 0xe3, 0xa0, 0x07, 0x1b, 0xe3, 0xa0, 0x07, 0x1b, 0xe3, 0xa0,
+    0x07, 0x1b, 0xe5, 0xa0, 0x07, 0x1b, 0xe5, 0xa0, 0x07, 0x1b, 0xe5, 0xa0, 0x07, 0x1b, 0xe5, 0xa0,
+    0x07, 0x1b, 0xe6, 0xa0, 0x07, 0x1b, 0xe6, 0xa0, 0x07, 0x1b, 0xe8, 0xa0, 0x07, 0x1b, 0xe8, 0xa0,
+    0x07, 0x2a, 0xec, 0x04, 0x00, 0x2b, 0x2a, 0xec, 0x04, 0x00, 0x2b, 0x2a, 0xec, 0x04, 0x00, 0x2b,
+    0x2a, 0xec, 0x04, 0x00, 0x2b, 0x21, 0xed, 0x04, 0x40, 0x2c, 0x05, 0x30, 0x00, 0x5a, 0xed, 0x04,
+    0x33, 0x0c, 0x08, 0x10, 0x00, 0x00, 0x40, 0x2c, 0x08, 0x30, 0x00, 0x14, 0x10, 0x20, 0x00, 0x00,
+    0x10, 0x00, 0x44, 0xf2, 0x04, 0x22, 0xdc, 0x50, 0x0a, 0x00, 0xb0, 0x01, 0x55, 0xf2, 0x04, 0x22,
+    0xde, 0x1d, 0x80, 0x01, 0x01, 0x10, 0x00, 0x18, 0xe0, 0x70, 0x0a, 0x44, 0xf2, 0x04, 0x22, 0xe2,
+    0x20, 0x00, 0x00, 0x10, 0x00, 0x48, 0xf3, 0x04, 0x22, 0xe4, 0x40, 0x00, 0x48, 0xf3, 0x04, 0x22,
+    0xe6, 0x40, 0x00, 0x48, 0xf3, 0x04, 0x22, 0xe8, 0x40, 0x00, 0x48, 0xf3, 0x04, 0x22, 0xea, 0x40,
+    0x00, 0x48, 0xf5, 0x04, 0x22, 0xec, 0x40, 0x00, 0x48, 0xf5, 0x04, 0x22, 0xee, 0x40, 0x00, 0x48,
+    0xf5, 0x04, 0x22, 0xf0, 0x40, 0x00, 0x48, 0xf5, 0x04, 0x22, 0xf2, 0x40, 0x00, 0x42, 0xf6, 0x04,
+    0x33, 0xf4, 0x70, 0x0a, 0x02, 0xf0, 0x00, 0x42, 0xf6, 0x04, 0x33, 0xf7, 0x00, 0x22, 0x05, 0x10,
+    0x00, 0x14, 0xfa, 0x20, 0x00, 0x00, 0xf0, 0x00, 0x44, 0xf6, 0x04, 0x33, 0xfd, 0x20, 0x00, 0x00,
+    0x10, 0x00, 0x57, 0xf7, 0x04, 0x33, 0x00, 0x12, 0x40, 0x00, 0x57, 0xf7, 0x04, 0x33, 0x03, 0x12,
+    0x40, 0x00, 0x44, 0xf7, 0x04, 0x33, 0x06, 0x20, 0x00, 0x03, 0x30, 0x00, 0x14, 0x09, 0x20, 0x00,
+    0x00, 0x10, 0x00, 0x48, 0x00, 0x05, 0x33, 0x0c, 0x40, 0x00, 0x48, 0x00, 0x05, 0x33, 0x0f, 0x40,
+    0x00, 0x48, 0x00, 0x05, 0x33, 0x12, 0x40, 0x00, 0x48, 0x00, 0x05, 0x33, 0x15, 0x40, 0x00, 0x48,
+    0x01, 0x05, 0x33, 0x18, 0x40, 0x00, 0x48, 0x01, 0x05, 0x33, 0x1b, 0x40, 0x00, 0x48, 0x01, 0x05,
+    0x33, 0x1e, 0x40, 0x00, 0x48, 0x01, 0x05, 0x33, 0x21, 0x40, 0x00, 0x57, 0x03, 0x05, 0x33, 0xa0,
+    0x06, 0x40, 0x00, 0x44, 0x03, 0x05, 0x33, 0x18, 0x20, 0x03, 0x03, 0x10, 0x00, 0x14, 0xa4, 0x20,
+    0x00, 0x03, 0x30, 0x00, 0x18, 0x20, 0x40, 0x03, 0x21, 0x04, 0x05, 0x40, 0x2d, 0x05, 0x40, 0x00,
+    0x21, 0x04, 0x05, 0x40, 0x2d, 0x05, 0x40, 0x00, 0x21, 0x04, 0x05, 0x40, 0x2d, 0x05, 0x40, 0x00,
+    0x21, 0x04, 0x05, 0x40, 0x2d, 0x05, 0x40, 0x00, 0x48, 0x05, 0x05, 0x33, 0xb0, 0x40, 0x00, 0x48,
+    0x05, 0x05, 0x33, 0x24, 0xc0, 0x00, 0x48, 0x05, 0x05, 0x33, 0xb4, 0x40, 0x00, 0x48, 0x05, 0x05,
+    0x33, 0x27, 0xc0, 0x00, 0x1b, 0x06, 0xc0, 0x00, 0x1b, 0x06, 0xc0, 0x00, 0x1b, 0x06, 0xc0, 0x00,
+    0x1b, 0x06, 0xc0, 0x00, 0x48, 0x09, 0x05, 0x33, 0xd8, 0x40, 0x00, 0x48, 0x09, 0x05, 0x33, 0x2a,
+    0x80, 0x00, 0x48, 0x09, 0x05, 0x33, 0xdc, 0x40, 0x00, 0x48, 0x09, 0x05, 0x33, 0x2d, 0x80, 0x00,
+    0x21, 0x0a, 0x05, 0x00, 0x0f, 0x05, 0x40, 0x00, 0x21, 0x0a, 0x05, 0x00, 0x0f, 0x05, 0x40, 0x00,
+    0x21, 0x0a, 0x05, 0x00, 0x0f, 0x05, 0x40, 0x00, 0x21, 0x0a, 0x05, 0x00, 0x0f, 0x05, 0x40, 0x00,
+    0x48, 0x0b, 0x05, 0x33, 0xd0, 0x40, 0x00, 0x48, 0x0b, 0x05, 0x33, 0x24, 0x40, 0x00, 0x48, 0x0b,
+    0x05, 0x33, 0xd4, 0x40, 0x00, 0x48, 0x0b, 0x05, 0x33, 0x28, 0x40, 0x00, 0x1b, 0x0c, 0xc0, 0x00,
+    0x1b, 0x0c, 0xc0, 0x00, 0x1b, 0x0c, 0xc0, 0x00, 0x1b, 0x0c, 0xc0, 0x00, 0x39, 0x0d, 0x05, 0x44,
+    0xc0, 0x00, 0x39, 0x0d, 0x05, 0x44, 0xc0, 0x00, 0x39, 0x0d, 0x05, 0x44, 0xc0, 0x00, 0x39, 0x0d,
+    0x05, 0x44, 0xc0, 0x00, 0x84, 0x0e, 0x05, 0x33, 0x30, 0x12, 0x00, 0x00, 0x6c, 0x40, 0x00, 0x40,
+    0x0e, 0x05, 0x33, 0x33, 0x10, 0x00, 0x04, 0x40, 0x00, 0x44, 0x0e, 0x05, 0x33, 0x36, 0x20, 0x00,
+    0x03, 0x30, 0x00, 0x14, 0x39, 0x20, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x10, 0x40, 0x00, 0x1b, 0x10,
+    0x40, 0x00, 0x1b, 0x10, 0x40, 0x00, 0x1b, 0x10, 0x40, 0x00, 0x1b, 0x14, 0x80, 0x01, 0x1b, 0x14,
+    0x80, 0x01, 0x1b, 0x14, 0x80, 0x01, 0x1b, 0x14, 0x80, 0x01, 0x1b, 0x15, 0x80, 0x01, 0x1b, 0x15,
+    0x80, 0x01, 0x1b, 0x15, 0x80, 0x01, 0x1b, 0x15, 0x80, 0x01, 0x30, 0x16, 0x05, 0x44, 0x40, 0x05,
+    0x05, 0x30, 0x00, 0x30, 0x16, 0x05, 0x44, 0x40, 0x05, 0x08, 0x10, 0x00, 0x00, 0x40, 0x05, 0x08,
+    0x30, 0x00, 0x00, 0x40, 0x05, 0x05, 0x10, 0x00, 0x57, 0x1b, 0x05, 0x44, 0x14, 0x08, 0x80, 0x00,
+    0x39, 0x1b, 0x05, 0x44, 0xc0, 0x02, 0x44, 0x1b, 0x05, 0x44, 0x1c, 0x20, 0x00, 0x03, 0x30, 0x00,
+    0x09, 0xc0, 0x02, 0x39, 0x1c, 0x05, 0x44, 0xc0, 0x00, 0x39, 0x1c, 0x05, 0x44, 0xc0, 0x00, 0x39,
+    0x1c, 0x05, 0x44, 0xc0, 0x00, 0x39, 0x1c, 0x05, 0x44, 0xc0, 0x00, 0x47, 0x1d, 0x05, 0x22, 0xf4,
+    0x30, 0x2f, 0x57, 0x04, 0x1d, 0x05, 0x22, 0xf6, 0x10, 0x00, 0x57, 0x05, 0x1d, 0x05, 0x22, 0xf8,
+    0x90, 0x2f, 0x00, 0x20, 0x00, 0x17, 0xfa, 0x10, 0x00, 0x58, 0x05, 0x1e, 0x05, 0x22, 0xfc, 0xa0,
+    0x2f, 0x48, 0x1e, 0x05, 0x22, 0xfe, 0x80, 0x2f, 0x21, 0x1e, 0x05, 0x10, 0x0d, 0x04, 0x30, 0x00,
+    0x00, 0x20, 0x00, 0x10, 0x00, 0x4a, 0xb3, 0x03, 0x10, 0x00, 0x54, 0x03, 0x21, 0x05, 0x22, 0x02,
+    0x10, 0x00, 0x00, 0xa4, 0x42, 0x47, 0x21, 0x05, 0x22, 0x04, 0x10, 0x00, 0x31, 0x02, 0x21, 0x05,
+    0x80, 0xc8, 0x04, 0x30, 0x00, 0x00, 0x20, 0x00, 0x17, 0x08, 0x10, 0x00, 0x57, 0x02, 0x22, 0x05,
+    0x22, 0x0a, 0x30, 0x00, 0x57, 0x03, 0x22, 0x05, 0x22, 0x0c, 0x10, 0x00, 0x58, 0x04, 0x22, 0x05,
+    0x22, 0x0e, 0x70, 0x00, 0x47, 0x22, 0x05, 0x22, 0x10, 0x10, 0x00, 0x13, 0x04, 0x84, 0xb2, 0x05,
+    0x40, 0x01, 0x04, 0x82, 0xb2, 0x25, 0xb6, 0x57, 0x10, 0x00, 0x00, 0x6e, 0xb2, 0x05, 0x40, 0x01,
+    0x04, 0x6c, 0xb2, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x27, 0x80, 0x02, 0x1b, 0x27, 0x80,
+    0x02, 0x1b, 0x27, 0x80, 0x02, 0x1b, 0x27, 0x80, 0x02, 0x1b, 0x28, 0x40, 0x05, 0x1b, 0x28, 0x40,
+    0x05, 0x1b, 0x28, 0x40, 0x05, 0x1b, 0x28, 0x40, 0x05, 0x21, 0x29, 0x05, 0x00, 0x08, 0x05, 0x40,
+    0x00, 0x21, 0x29, 0x05, 0x00, 0x08, 0x05, 0x40, 0x00, 0x21, 0x29, 0x05, 0x00, 0x08, 0x05, 0x40,
+    0x00, 0x21, 0x29, 0x05, 0x00, 0x08, 0x05, 0x40, 0x00, 0x1b, 0x2a, 0x00, 0x03, 0x1b, 0x2a, 0x00,
+    0x03, 0x1b, 0x2a, 0x00, 0x03, 0x1b, 0x2a, 0x00, 0x03, 0x84, 0x2b, 0x05, 0x37, 0x5e, 0x00, 0x00,
+    0x36, 0xb4, 0x80, 0x07, 0x4b, 0x2b, 0x05, 0x37, 0x65, 0x10, 0x00, 0x14, 0x6c, 0x10, 0x00, 0x00,
+    0x70, 0x07, 0x48, 0x2b, 0x05, 0x37, 0x73, 0x10, 0x00, 0x48, 0x2c, 0x05, 0x37, 0x7a, 0x30, 0x00,
+    0x4b, 0x2c, 0x05, 0x37, 0x81, 0x10, 0x00, 0x1b, 0x88, 0x30, 0x00, 0x1f, 0x8f, 0x40, 0x00, 0x0c,
+    0x09, 0x30, 0x00, 0x1b, 0x2d, 0x20, 0x06, 0x1b, 0x2d, 0x20, 0x06, 0x1b, 0x2d, 0x20, 0x06, 0x1b,
+    0x2d, 0x20, 0x06, 0x1b, 0x2e, 0xa0, 0x01, 0x1b, 0x2e, 0xa0, 0x01, 0x1b, 0x2e, 0xa0, 0x01, 0x1b,
+    0x2e, 0xa0, 0x01, 0x48, 0x2f, 0x05, 0x33, 0x3c, 0xa0, 0x07, 0x1b, 0x2f, 0xe0, 0x06, 0x48, 0x2f,
+    0x05, 0x33, 0x3f, 0xa0, 0x07, 0x1b, 0x2f, 0xe0, 0x06, 0x1b, 0x30, 0xe0, 0x05, 0x1b, 0x30, 0xe0,
+    0x05, 0x1b, 0x30, 0xe0, 0x05, 0x1b, 0x30, 0xe0, 0x05, 0x57, 0x31, 0x05, 0x35, 0x1c, 0x01, 0x20,
+    0x01, 0x44, 0x31, 0x05, 0x35, 0x21, 0x10, 0x00, 0x00, 0x20, 0x01, 0x48, 0x32, 0x05, 0x35, 0x26,
+    0x20, 0x00, 0x48, 0x32, 0x05, 0x35, 0x2b, 0x20, 0x00, 0xa2, 0x48, 0x05, 0x33, 0x42, 0x12, 0x00,
+    0x00, 0xca, 0x52, 0x13, 0x70, 0x00, 0x4b, 0x48, 0x05, 0x33, 0x45, 0x10, 0x00, 0x14, 0x48, 0x10,
+    0x00, 0x00, 0x70, 0x00, 0x48, 0x48, 0x05, 0x33, 0x4b, 0x10, 0x00, 0x1b, 0x49, 0x40, 0x00, 0x1b,
+    0x49, 0x40, 0x00, 0x1b, 0x49, 0x40, 0x00, 0x1b, 0x49, 0x40, 0x00, 0x48, 0x4a, 0x05, 0x33, 0x4e,
+    0x30, 0x00, 0x4b, 0x4a, 0x05, 0x33, 0x51, 0x10, 0x00, 0x1b, 0x54, 0x30, 0x00, 0x18, 0x57, 0x10,
+    0x00, 0x1b, 0x4b, 0x40, 0x00, 0x1b, 0x4b, 0x40, 0x00, 0x1b, 0x4b, 0x40, 0x00, 0x1b, 0x4b, 0x40,
+    0x00, 0x40, 0x4c, 0x05, 0x33, 0x5a, 0x10, 0x00, 0x22, 0x51, 0x12, 0x30, 0x00, 0x4b, 0x4c, 0x05,
+    0x33, 0x5d, 0x10, 0x00, 0x14, 0x60, 0x10, 0x00, 0x03, 0x30, 0x00, 0x18, 0x63, 0x10, 0x00, 0x1b,
+    0x4d, 0x40, 0x00, 0x1b, 0x4d, 0x40, 0x00, 0x1b, 0x4d, 0x40, 0x00, 0x1b, 0x4d, 0x40, 0x00, 0x48,
+    0x4e, 0x05, 0x33, 0x66, 0xb0, 0x00, 0x4b, 0x4e, 0x05, 0x33, 0x69, 0x10, 0x00, 0x18, 0x6c, 0xb0,
+    0x00, 0x48, 0x4e, 0x05, 0x33, 0x6f, 0x10, 0x00, 0x1b, 0x4f, 0x40, 0x00, 0x1b, 0x4f, 0x40, 0x00,
+    0x1b, 0x4f, 0x40, 0x00, 0x1b, 0x4f, 0x40, 0x00, 0x48, 0x50, 0x05, 0x33, 0x72, 0xb0, 0x00, 0x4b,
+    0x50, 0x05, 0x33, 0x75, 0x10, 0x00, 0x18, 0x78, 0xb0, 0x00, 0x48, 0x50, 0x05, 0x33, 0x7b, 0x10,
+    0x00, 0x1b, 0x51, 0x40, 0x00, 0x1b, 0x51, 0x40, 0x00, 0x1b, 0x51, 0x40, 0x00, 0x1b, 0x51, 0x40,
+    0x00, 0x24, 0x52, 0x05, 0x10, 0x37, 0x02, 0x00, 0x17, 0x24, 0x52, 0x05, 0x00, 0x37, 0x02, 0x20,
+    0x16, 0x30, 0x53, 0x05, 0x44, 0xf0, 0x38, 0x05, 0x20, 0x17, 0x30, 0x53, 0x05, 0x44, 0xe0, 0x38,
+    0x05, 0x20, 0x17, 0x21, 0x55, 0x05, 0xd0, 0x0c, 0x05, 0x30, 0x03, 0x21, 0x55, 0x05, 0xc0, 0x0c,
+    0x05, 0x20, 0x03, 0x30, 0x5d, 0x05, 0x55, 0x00, 0x0e, 0x32, 0xda, 0xbb, 0x5c, 0xf0, 0x19, 0x30,
+    0x5d, 0x05, 0x55, 0x40, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x10, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x40,
+    0x1b, 0x08, 0x10, 0x00, 0x00, 0x20, 0x0e, 0x01, 0x10, 0x00, 0x03, 0x50, 0x00, 0x00, 0x40, 0x1b,
+    0x08, 0x10, 0x00, 0x00, 0x30, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x40, 0x1b, 0x05, 0x10, 0x00, 0x30,
+    0x5e, 0x05, 0x55, 0x40, 0x0e, 0x05, 0x50, 0x00, 0x30, 0x5e, 0x05, 0x55, 0x40, 0x1b, 0x08, 0x10,
+    0x00, 0x00, 0x50, 0x0e, 0x08, 0x10, 0x00, 0x00, 0x40, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x60, 0x0e,
+    0x08, 0x50, 0x00, 0x00, 0x40, 0x1b, 0x08, 0x10, 0x00, 0x00, 0x70, 0x0e, 0x08, 0x10, 0x00, 0x00,
+    0x40, 0x1b, 0x05, 0x10, 0x00, 0x42, 0x5f, 0x05, 0x33, 0x7e, 0x80, 0x04, 0x02, 0x40, 0x01, 0x4b,
+    0x5f, 0x05, 0x33, 0x81, 0x10, 0x00, 0x14, 0x84, 0x10, 0x00, 0x03, 0x30, 0x00, 0x1b, 0x87, 0x10,
+    0x00, 0x00, 0x80, 0x10, 0x05, 0x60, 0x2f, 0x30, 0x5f, 0x05, 0x33, 0x80, 0x10, 0x08, 0x10, 0x00,
+    0x00, 0x80, 0x10, 0x05, 0x70, 0x2f, 0x30, 0x5f, 0x05, 0x33, 0x80, 0x10, 0x05, 0x10, 0x00, 0x48,
+    0x60, 0x05, 0x33, 0x90, 0x70, 0x00, 0x4b, 0x60, 0x05, 0x33, 0x93, 0x10, 0x00, 0x18, 0x96, 0x70,
+    0x00, 0x4b, 0x60, 0x05, 0x33, 0x99, 0x10, 0x00, 0x00, 0x80, 0x10, 0x05, 0x70, 0x00, 0x30, 0x60,
+    0x05, 0x33, 0x80, 0x10, 0x08, 0x10, 0x00, 0x00, 0x80, 0x10, 0x08, 0x70, 0x00, 0x00, 0x80, 0x10,
+    0x05, 0x10, 0x00, 0x12, 0x61, 0xb0, 0x00, 0x05, 0x30, 0x0e, 0x12, 0x61, 0xa0, 0x00, 0x05, 0x20,
+    0x0e, 0x21, 0x62, 0x05, 0xd0, 0x0f, 0x05, 0x40, 0x02, 0x21, 0x62, 0x05, 0xc0, 0x0f, 0x05, 0x40,
+    0x02, 0x48, 0x63, 0x05, 0x33, 0xa2, 0x40, 0x00, 0x48, 0x63, 0x05, 0x33, 0xa5, 0x40, 0x00, 0x42,
+    0x6f, 0x05, 0x33, 0xa8, 0x70, 0x00, 0x02, 0x00, 0x13, 0x03, 0x86, 0xa4, 0x05, 0x40, 0x30, 0x03,
+    0x60, 0xa4, 0x05, 0x20, 0x00, 0x03, 0x5e, 0xa4, 0x0f, 0x20, 0x00, 0x16, 0x03, 0x7c, 0xa4, 0x05,
+    0x20, 0x00, 0x03, 0x7a, 0xa4, 0x05, 0x20, 0x00, 0x43, 0x72, 0x05, 0x33, 0xb7, 0x10, 0x00, 0x01,
+    0x30, 0x14, 0x48, 0x72, 0x05, 0x33, 0xba, 0x30, 0x00, 0x03, 0x74, 0xa4, 0x05, 0x30, 0x00, 0x58,
+    0x73, 0x05, 0x33, 0xc0, 0x12, 0x70, 0x1c, 0x38, 0x05, 0x33, 0xc3, 0x10, 0x00, 0x4b, 0x74, 0x05,
+    0x33, 0xc6, 0x10, 0x00, 0x18, 0xc9, 0x10, 0x00, 0x4b, 0x75, 0x05, 0x33, 0xcc, 0x10, 0x00, 0x18,
+    0xcf, 0x10, 0x00, 0x1b, 0x76, 0x40, 0x00, 0x48, 0x76, 0x05, 0x33, 0xd2, 0x10, 0x00, 0x1b, 0x7a,
+    0x70, 0x07, 0x1b, 0x7a, 0x70, 0x07, 0x1b, 0x7a, 0x70, 0x07, 0x1b, 0x7a, 0x70, 0x07, 0x1b, 0x7c,
+    0x30, 0x07, 0x1b, 0x7c, 0x30, 0x07, 0x1b, 0x7c, 0x30, 0x07, 0x1b, 0x7c, 0x30, 0x07, 0x1b, 0x83,
+    0x40, 0x00, 0x1b, 0x83, 0x40, 0x00, 0x1b, 0x83, 0x40, 0x00, 0x1b, 0x83, 0x40, 0x00, 0x45, 0x86,
+    0x05, 0x22, 0xbd, 0x40, 0x1b, 0x20, 0x00, 0x00, 0x10, 0x00, 0x14, 0xc0, 0x10, 0x00, 0x00, 0x60,
+    0x01, 0x1b, 0x88, 0xe0, 0x00, 0x1b, 0x88, 0xe0, 0x00, 0x1b, 0x88, 0xe0, 0x00, 0x1b, 0x88, 0xe0,
+    0x00, 0x1b, 0x8a, 0xa0, 0x00, 0x1b, 0x8a, 0xa0, 0x00, 0x1b, 0x8a, 0xa0, 0x00, 0x1b, 0x8a, 0xa0,
+    0x00, 0x1b, 0x8b, 0x40, 0x00, 0x1b, 0x8b, 0x40, 0x00, 0x1b, 0x8b, 0x40, 0x00, 0x1b, 0x8b, 0x40,
+    0x00, 0x03, 0xba, 0xa5, 0x03, 0x40, 0x02, 0x01, 0x10, 0x00, 0x00, 0xb8, 0xa5, 0x05, 0x70, 0x1c,
+    0x03, 0x92, 0xa5, 0x05, 0x20, 0x00, 0x03, 0x90, 0xa5, 0x0f, 0x20, 0x00, 0x16, 0x03, 0xae, 0xa5,
+    0x05, 0x20, 0x00, 0x03, 0xac, 0xa5, 0x05, 0x20, 0x00, 0x03, 0xaa, 0xa5, 0x05, 0x20, 0x00, 0x03,
+    0xa8, 0xa5, 0x05, 0x20, 0x00, 0xa2, 0xa1, 0x05, 0x33, 0xd5, 0x12, 0x00, 0x00, 0x1c, 0x4f, 0x10,
+    0xd0, 0x00, 0x4b, 0xa1, 0x05, 0x33, 0xd8, 0x10, 0x00, 0x14, 0xdb, 0x10, 0x00, 0x03, 0x30, 0x00,
+    0x18, 0xde, 0x10, 0x00, 0x1b, 0xa2, 0x40, 0x00, 0x1b, 0xa2, 0x40, 0x00, 0x1b, 0xa2, 0x40, 0x00,
+    0x1b, 0xa2, 0x40, 0x00, 0x48, 0xa3, 0x05, 0x33, 0xe1, 0xf0, 0x09, 0x48, 0xa3, 0x05, 0x33, 0xe4,
+    0x60, 0x01, 0x48, 0xa3, 0x05, 0x33, 0xe7, 0xf0, 0x09, 0x48, 0xa3, 0x05, 0x33, 0xea, 0x60, 0x01,
+    0x48, 0xa4, 0x05, 0x33, 0xf0, 0xa0, 0x01, 0x48, 0xa4, 0x05, 0x33, 0xed, 0x40, 0x00, 0x48, 0xa4,
+    0x05, 0x33, 0xf4, 0xa0, 0x01, 0x00, 0x30, 0x00, 0x08, 0x40, 0x00, 0x21, 0xa5, 0x05, 0xb0, 0x13,
+    0x05, 0x00, 0x07, 0x15, 0xa5, 0xf0, 0x06, 0x05, 0x10, 0x00, 0x12, 0xf3, 0x30, 0x00, 0x05, 0x10,
+    0x00, 0x18, 0xf6, 0x10, 0x00, 0x12, 0xa6, 0x30, 0x0c, 0x08, 0x10, 0x00, 0x03, 0x30, 0x0c, 0x05,
+    0x10, 0x00, 0x1b, 0xf9, 0x30, 0x00, 0x18, 0xfc, 0x10, 0x00, 0x1b, 0xa7, 0x70, 0x0b, 0x1b, 0xa7,
+    0x70, 0x0b, 0x1b, 0xa7, 0x70, 0x0b, 0x1b, 0xa7, 0x70, 0x0b, 0x1b, 0xa8, 0x20, 0x03, 0x1b, 0xa8,
+    0x20, 0x03, 0x1b, 0xa8, 0x20, 0x03, 0x1b, 0xa8, 0x20, 0x03, 0x1b, 0xaa, 0xe0, 0x02, 0x1b, 0xaa,
+    0xe0, 0x02, 0x1b, 0xaa, 0xe0, 0x02, 0x1b, 0xaa, 0xe0, 0x02, 0x1b, 0xab, 0xd0, 0x0d, 0x1b, 0xab,
+    0xd0, 0x0d, 0x1b, 0xab, 0xd0, 0x0d, 0x1b, 0xab, 0xd0, 0x0d, 0x21, 0xac, 0x05, 0x50, 0x15, 0x05,
+    0x40, 0x00, 0x1b, 0xac, 0x80, 0x08, 0x12, 0xac, 0xa0, 0x01, 0x05, 0x40, 0x00, 0x1b, 0xac, 0x90,
+    0x08, 0x1b, 0xae, 0x90, 0x0d, 0x1b, 0xae, 0x90, 0x0d, 0x1b, 0xae, 0x90, 0x0d, 0x1b, 0xae, 0x90,
+    0x0d, 0x1b, 0xaf, 0x80, 0x01, 0x1b, 0xaf, 0x80, 0x01, 0x1b, 0xaf, 0x80, 0x01, 0x1b, 0xaf, 0x80,
+    0x01, 0x1b, 0xb0, 0x80, 0x01, 0x1b, 0xb0, 0x80, 0x01, 0x1b, 0xb0, 0x80, 0x01, 0x1b, 0xb0, 0x80,
+    0x01, 0x1b, 0xb2, 0x80, 0x01, 0x1b, 0xb2, 0x80, 0x01, 0x1b, 0xb2, 0x80, 0x01, 0x1b, 0xb2, 0x80,
+    0x01, 0x1b, 0xb3, 0x80, 0x01, 0x1b, 0xb3, 0x80, 0x01, 0x1b, 0xb3, 0x80, 0x01, 0x1b, 0xb3, 0x80,
+    0x01, 0x1b, 0xb4, 0x80, 0x01, 0x1b, 0xb4, 0x80, 0x01, 0x1b, 0xb4, 0x80, 0x01, 0x1b, 0xb4, 0x80,
+    0x01, 0x1b, 0xb6, 0x80, 0x01, 0x1b, 0xb6, 0x80, 0x01, 0x1b, 0xb6, 0x80, 0x01, 0x1b, 0xb6, 0x80,
+    0x01, 0x51, 0xbf, 0x05, 0x22, 0x12, 0x1e, 0x20, 0x00, 0x02, 0xa0, 0x1b, 0x51, 0xbf, 0x05, 0x22,
+    0x14, 0x1e, 0x20, 0x00, 0x03, 0xc0, 0x1b, 0x43, 0x05, 0x22, 0x58, 0x1c, 0xb0, 0x04, 0x03, 0x10,
+    0x00, 0x12, 0x16, 0x20, 0x00, 0x05, 0x10, 0x00, 0x14, 0x5a, 0x20, 0x00, 0x00, 0x30, 0x06, 0x44,
+    0xca, 0x05, 0x22, 0x18, 0x20, 0x00, 0x00, 0x10, 0x00, 0x48, 0xcb, 0x05, 0x22, 0x5c, 0x40, 0x00,
+    0x48, 0xcb, 0x05, 0x22, 0x1a, 0x40, 0x00, 0x48, 0xcb, 0x05, 0x22, 0x5e, 0x40, 0x00, 0x48, 0xcb,
+    0x05, 0x22, 0x1c, 0x40, 0x00, 0x48, 0xcc, 0x05, 0x22, 0x60, 0x40, 0x00, 0x48, 0xcc, 0x05, 0x22,
+    0x1e, 0x40, 0x00, 0x48, 0xcc, 0x05, 0x22, 0x62, 0x40, 0x00, 0x48, 0xcc, 0x05, 0x22, 0x20, 0x40,
+    0x00, 0x48, 0xcd, 0x05, 0x22, 0x64, 0x40, 0x00, 0x48, 0xcd, 0x05, 0x22, 0x22, 0x40, 0x00, 0x48,
+    0xcd, 0x05, 0x22, 0x66, 0x40, 0x00, 0x48, 0xcd, 0x05, 0x22, 0x24, 0x40, 0x00, 0x48, 0xce, 0x05,
+    0x22, 0x68, 0x40, 0x00, 0x48, 0xce, 0x05, 0x22, 0x26, 0x40, 0x00, 0x48, 0xce, 0x05, 0x22, 0x6a,
+    0x40, 0x00, 0x48, 0xce, 0x05, 0x22, 0x28, 0x40, 0x00, 0x48, 0xcf, 0x05, 0x22, 0x6c, 0x40, 0x00,
+    0x48, 0xcf, 0x05, 0x22, 0x2a, 0x40, 0x00, 0x48, 0xcf, 0x05, 0x22, 0x6e, 0x40, 0x00, 0x48, 0xcf,
+    0x05, 0x22, 0x2c, 0x40, 0x00, 0x48, 0xd8, 0x05, 0x22, 0x70, 0x40, 0x00, 0x48, 0xd8, 0x05, 0x22,
+    0x2e, 0x40, 0x00, 0x48, 0xd8, 0x05, 0x22, 0x72, 0x40, 0x00, 0x48, 0xd8, 0x05, 0x22, 0x30, 0x40,
+    0x00, 0x48, 0xd9, 0x05, 0x22, 0x74, 0x40, 0x00, 0x48, 0xd9, 0x05, 0x22, 0x32, 0x40, 0x00, 0x48,
+    0xd9, 0x05, 0x22, 0x76, 0x40, 0x00, 0x48, 0xd9, 0x05, 0x22, 0x34, 0x40, 0x00, 0x48, 0xda, 0x05,
+    0x22, 0x78, 0x40, 0x00, 0x48, 0xda, 0x05, 0x22, 0x36, 0x40, 0x00, 0x48, 0xda, 0x05, 0x22, 0x7a,
+    0x40, 0x00, 0x48, 0xda, 0x05, 0x22, 0x38, 0x40, 0x00, 0x48, 0xdb, 0x05, 0x22, 0x7c, 0x40, 0x00,
+    0x48, 0xdb, 0x05, 0x22, 0x3a, 0x40, 0x00, 0x48, 0xdb, 0x05, 0x22, 0x7e, 0x40, 0x00, 0x48, 0xdb,
+    0x05, 0x22, 0x3c, 0x40, 0x00, 0x48, 0xdc, 0x05, 0x22, 0x80, 0x40, 0x00, 0x48, 0xdc, 0x05, 0x22,
+    0x3e, 0x40, 0x00, 0x48, 0xdc, 0x05, 0x22, 0x82, 0x40, 0x00, 0x48, 0xdc, 0x05, 0x22, 0x40, 0x40,
+    0x00, 0x48, 0xdd, 0x05, 0x22, 0x84, 0x40, 0x00, 0x48, 0xdd, 0x05, 0x22, 0x42, 0x40, 0x00, 0x48,
+    0xdd, 0x05, 0x22, 0x86, 0x40, 0x00, 0x48, 0xdd, 0x05, 0x22, 0x44, 0x40, 0x00, 0x48, 0xde, 0x05,
+    0x33, 0xe8, 0x60, 0x03, 0x48, 0xde, 0x05, 0x33, 0xff, 0x20, 0x04, 0x48, 0xde, 0x05, 0x33, 0xec,
+    0x60, 0x03, 0x57, 0xde, 0x05, 0x33, 0x02, 0x13, 0x60, 0x03, 0x1b, 0xe0, 0x60, 0x04, 0x1b, 0xe0,
+    0x60, 0x04, 0x1b, 0xe0, 0x60, 0x04, 0x1b, 0xe0, 0x60, 0x04, 0x1b, 0xe2, 0xe0, 0x03, 0x1b, 0xe2,
+    0xe0, 0x03, 0x1b, 0xe2, 0xe0, 0x03, 0x1b, 0xe2, 0xe0, 0x03, 0x1b, 0xe3, 0x80, 0x00, 0x1b, 0xe3,
+    0x80, 0x00, 0x1b, 0xe3, 0x80, 0x00, 0x1b, 0xe3, 0x80, 0x00, 0x1b, 0xe4, 0x60, 0x05, 0x1b, 0xe4,
+    0x60, 0x05, 0x1b, 0xe4, 0x60, 0x05, 0x1b, 0xe4, 0x60, 0x05, 0x1b, 0xe6, 0x80, 0x00, 0x1b, 0xe6,
+    0x80, 0x00, 0x1b, 0xe6, 0x80, 0x00, 0x1b, 0xe6, 0x80, 0x00, 0x57, 0xe8, 0x05, 0x33, 0x05, 0x13,
+    0x40, 0x00, 0x44, 0xe8, 0x05, 0x33, 0x08, 0x60, 0x01, 0x03, 0x10, 0x00, 0x14, 0x0b, 0x20, 0x00,
+    0x03, 0x30, 0x00, 0x18, 0x0e, 0x80, 0x01, 0x1b, 0xed, 0xb0, 0x17, 0x1b, 0xed, 0xb0, 0x17, 0x1b,
+    0xed, 0xb0, 0x17, 0x1b, 0xed, 0xb0, 0x17, 0x2a, 0xf1, 0x05, 0x90, 0x54, 0x1b, 0xf2, 0x10, 0x00,
+    0x1b, 0xf3, 0x10, 0x00, 0x1b, 0xf4, 0x10, 0x00, 0x1b, 0xf5, 0x10, 0x00, 0x1b, 0xf6, 0x10, 0x00,
+    0x1b, 0xf7, 0x10, 0x00, 0x1b, 0xf8, 0x10, 0x00, 0x03, 0x72, 0x8e, 0x05, 0x00, 0x01, 0x03, 0x70,
+    0x8e, 0x05, 0x00, 0x01, 0x03, 0x5c, 0x8e, 0x05, 0x00, 0x01, 0x03, 0x5a, 0x8e, 0x05, 0x00, 0x01,
+    0x2a, 0x20, 0x06, 0xa0, 0x06, 0x2a, 0x20, 0x06, 0xa0, 0x06, 0x2a, 0x20, 0x06, 0xa0, 0x06, 0x2a,
+    0x20, 0x06, 0xa0, 0x06, 0x21, 0x22, 0x06, 0x50, 0x49, 0x05, 0x20, 0x0c, 0x46, 0x22, 0x06, 0x33,
+    0x11, 0x80, 0x01, 0x01, 0x10, 0x00, 0x00, 0x60, 0x49, 0x05, 0x30, 0x0c, 0x46, 0x22, 0x06, 0x33,
+    0x14, 0x80, 0x01, 0x3b, 0x00, 0x00, 0x23, 0x40, 0x00, 0x48, 0x23, 0x06, 0x33, 0x17, 0x40, 0x00,
+    0x1b, 0x23, 0x40, 0x00, 0x48, 0x23, 0x06, 0x33, 0x1a, 0x40, 0x00, 0x1b, 0x24, 0x40, 0x00, 0x1b,
+    0x24, 0x40, 0x00, 0x1b, 0x24, 0x40, 0x00, 0x1b, 0x24, 0x40, 0x00, 0x2a, 0x25, 0x06, 0x60, 0x08,
+    0x2a, 0x25, 0x06, 0x60, 0x08, 0x2a, 0x25, 0x06, 0x60, 0x08, 0x2a, 0x25, 0x06, 0x60, 0x08, 0x2a,
+    0x26, 0x06, 0x00, 0x03, 0x2a, 0x26, 0x06, 0x00, 0x03, 0x2a, 0x26, 0x06, 0x00, 0x03, 0x2a, 0x26,
+    0x06, 0x00, 0x03, 0x2a, 0x27, 0x06, 0x00, 0x03, 0x2a, 0x27, 0x06, 0x00, 0x03, 0x2a, 0x27, 0x06,
+    0x00, 0x03, 0x2a, 0x27, 0x06, 0x00, 0x03, 0x42, 0x28, 0x06, 0x33, 0x1d, 0xe0, 0x02, 0x11, 0x34,
+    0x7a, 0x7c, 0x42, 0x28, 0x06, 0x33, 0x20, 0xe0, 0x00, 0x05, 0x10, 0x00, 0x13, 0x23, 0x20, 0x00,
+    0x01, 0x50, 0x00, 0x48, 0x28, 0x06, 0x33, 0x26, 0x20, 0x03, 0x44, 0x28, 0x06, 0x33, 0x29, 0x20,
+    0x00, 0x03, 0x50, 0x00, 0x18, 0x2c, 0x20, 0x03, 0x48, 0x29, 0x06, 0x33, 0x2f, 0x60, 0x00, 0x48,
+    0x29, 0x06, 0x33, 0x32, 0x60, 0x00, 0x48, 0x2a, 0x06, 0x33, 0x35, 0x20, 0x00, 0x4b, 0x2a, 0x06,
+    0x33, 0x38, 0x20, 0x00, 0x03, 0xd0, 0x17, 0x02, 0x80, 0x00, 0x48, 0x2a, 0x06, 0x33, 0x3b, 0x80,
+    0x00, 0x24, 0x2a, 0x06, 0xd0, 0x17, 0x02, 0x80, 0x00, 0x48, 0x2a, 0x06, 0x33, 0x3e, 0x80, 0x00,
+    0x21, 0x2b, 0x06, 0x00, 0x09, 0x05, 0x30, 0x00, 0x2a, 0x2b, 0x06, 0x00, 0x09, 0x24, 0x2b, 0x06,
+    0x20, 0x0c, 0x05, 0x30, 0x00, 0x09, 0x00, 0x09, 0x1b, 0x2c, 0x40, 0x00, 0x1b, 0x2c, 0x40, 0x00,
+    0x1b, 0x2c, 0x40, 0x00, 0x1b, 0x2c, 0x40, 0x00, 0x48, 0x2e, 0x06, 0x33, 0x41, 0xe0, 0x00, 0x48,
+    0x2e, 0x06, 0x33, 0x44, 0xe0, 0x00, 0x48, 0x2e, 0x06, 0x33, 0x47, 0x60, 0x01, 0x48, 0x2e, 0x06,
+    0x33, 0x4a, 0xe0, 0x00, 0x48, 0x2e, 0x06, 0x33, 0x4d, 0x60, 0x01, 0x48, 0x2e, 0x06, 0x33, 0x50,
+    0xe0, 0x00, 0x48, 0x2f, 0x06, 0x33, 0x53, 0x60, 0x00, 0x48, 0x2f, 0x06, 0x33, 0x56, 0x60, 0x00,
+    0x48, 0x2f, 0x06, 0x33, 0x59, 0x60, 0x00, 0x48, 0x2f, 0x06, 0x33, 0x5c, 0x60, 0x00, 0x48, 0x2f,
+    0x06, 0x33, 0x5f, 0x60, 0x00, 0x48, 0x2f, 0x06, 0x33, 0x62, 0x60, 0x00, 0x48, 0x31, 0x06, 0x33,
+    0x65, 0x30, 0x00, 0x4b, 0x31, 0x06, 0x33, 0x68, 0x10, 0x00, 0x1b, 0x6b, 0x30, 0x00, 0x18, 0x6e,
+    0x10, 0x00, 0x48, 0x34, 0x06, 0x33, 0x71, 0xa0, 0x00, 0x48, 0x34, 0x06, 0x33, 0x74, 0xa0, 0x00,
+    0x48, 0x34, 0x06, 0x33, 0x77, 0xa0, 0x00, 0x48, 0x34, 0x06, 0x33, 0x7a, 0x60, 0x00, 0x48, 0x34,
+    0x06, 0x33, 0x7d, 0xa0, 0x00, 0x48, 0x34, 0x06, 0x33, 0x80, 0x60, 0x00, 0x1b, 0x35, 0xc0, 0x02,
+    0x1b, 0x35, 0xc0, 0x02, 0x1b, 0x35, 0xc0, 0x02, 0x1b, 0x35, 0xc0, 0x02, 0x1b, 0x35, 0xc0, 0x02,
+    0x1b, 0x35, 0xc0, 0x02, 0x1b, 0x36, 0xc0, 0x02, 0x1b, 0x36, 0xc0, 0x02, 0x1b, 0x37, 0xc0, 0x02,
+    0x1b, 0x37, 0xc0, 0x02, 0x1b, 0x37, 0xc0, 0x02, 0x1b, 0x37, 0xc0, 0x02, 0x1b, 0x37, 0xc0, 0x02,
+    0x1b, 0x37, 0xc0, 0x02, 0x1b, 0x38, 0x80, 0x02, 0x1b, 0x38, 0x80, 0x02, 0x1b, 0x38, 0x80, 0x02,
+    0x1b, 0x38, 0x80, 0x02, 0x1b, 0x39, 0x40, 0x00, 0x1b, 0x39, 0x40, 0x00, 0x1b, 0x39, 0x40, 0x00,
+    0x1b, 0x39, 0x40, 0x00, 0x1b, 0x3b, 0xc0, 0x02, 0x1b, 0x3b, 0xc0, 0x02, 0x1b, 0x3b, 0xc0, 0x02,
+    0x1b, 0x3b, 0xc0, 0x02, 0x1b, 0x3b, 0xc0, 0x02, 0x1b, 0x3b, 0xc0, 0x02, 0x1b, 0x3c, 0x40, 0x05,
+    0x1b, 0x3c, 0x40, 0x05, 0x1b, 0x3c, 0x40, 0x05, 0x1b, 0x3c, 0x40, 0x05, 0x1b, 0x3d, 0x40, 0x05,
+    0x1b, 0x3d, 0x40, 0x05, 0x1b, 0x3d, 0x40, 0x05, 0x1b, 0x3d, 0x40, 0x05, 0x2a, 0x3e, 0x06, 0x70,
+    0x21, 0x2a, 0x3e, 0x06, 0x90, 0x1a, 0x2a, 0x3e, 0x06, 0x70, 0x21, 0x2a, 0x3e, 0x06, 0x90, 0x1a,
+    0x1b, 0x41, 0xc0, 0x00, 0x1b, 0x41, 0xc0, 0x00, 0x1b, 0x41, 0xc0, 0x00, 0x1b, 0x41, 0xc0, 0x00,
+    0x1b, 0x43, 0xc0, 0x05, 0x1b, 0x43, 0xc0, 0x05, 0x1b, 0x43, 0xc0, 0x05, 0x1b, 0x43, 0xc0, 0x05,
+    0x1b, 0x44, 0x80, 0x07, 0x1b, 0x44, 0x80, 0x07, 0x1b, 0x44, 0x80, 0x07, 0x1b, 0x44, 0x80, 0x07,
+    0x2a, 0x45, 0x06, 0x00, 0x0a, 0x2a, 0x45, 0x06, 0x00, 0x0a, 0x2a, 0x45, 0x06, 0x00, 0x0a, 0x2a,
+    0x45, 0x06, 0x00, 0x0a, 0x1b, 0x46, 0xc0, 0x00, 0x1b, 0x46, 0xc0, 0x00, 0x1b, 0x46, 0xc0, 0x00,
+    0x1b, 0x46, 0xc0, 0x00, 0x73, 0x49, 0x06, 0x23, 0xc9, 0x0f, 0x00, 0x28, 0x40, 0x09, 0x10, 0x00,
+    0x10, 0x00, 0x2a, 0x83, 0x13, 0x10, 0x00, 0x14, 0xcc, 0x20, 0x00, 0x00, 0x70, 0x07, 0x44, 0x49,
+    0x06, 0x23, 0x86, 0x20, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x52, 0x00, 0x01, 0x1b, 0x52, 0x00, 0x01,
+    0x1b, 0x52, 0x00, 0x01, 0x1b, 0x52, 0x00, 0x01, 0x12, 0x53, 0x20, 0x03, 0x05, 0x40, 0x00, 0x1b,
+    0x53, 0x20, 0x03, 0x12, 0x53, 0x20, 0x03, 0x05, 0x40, 0x00, 0x1b, 0x53, 0x20, 0x03, 0x15, 0x54,
+    0xe0, 0x03, 0x02, 0x30, 0x00, 0x2a, 0x54, 0x06, 0x70, 0x1e, 0x15, 0x54, 0xe0, 0x03, 0x05, 0x30,
+    0x00, 0x09, 0x70, 0x1e, 0x1b, 0x55, 0x80, 0x01, 0x1b, 0x55, 0x80, 0x01, 0x1b, 0x55, 0x80, 0x01,
+    0x1b, 0x55, 0x80, 0x01, 0x1b, 0x56, 0x00, 0x01, 0x1b, 0x56, 0x00, 0x01, 0x1b, 0x56, 0x00, 0x01,
+    0x1b, 0x56, 0x00, 0x01, 0x1b, 0x57, 0x00, 0x01, 0x1b, 0x57, 0x00, 0x01, 0x1b, 0x57, 0x00, 0x01,
+    0x1b, 0x57, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x01, 0x1b, 0x58, 0x00, 0x01,
+    0x1b, 0x58, 0x00, 0x01, 0x1b, 0x59, 0x00, 0x01, 0x1b, 0x59, 0x00, 0x01, 0x1b, 0x59, 0x00, 0x01,
+    0x1b, 0x59, 0x00, 0x01, 0x2a, 0x5a, 0x06, 0x80, 0x0b, 0x2a, 0x5a, 0x06, 0x80, 0x0b, 0x2a, 0x5a,
+    0x06, 0x80, 0x0b, 0x2a, 0x5a, 0x06, 0x80, 0x0b, 0x21, 0x6b, 0x06, 0xb0, 0x29, 0x05, 0x00, 0x0a,
+    0x21, 0x6b, 0x06, 0xb0, 0x29, 0x08, 0x10, 0x00, 0x03, 0x30, 0x19, 0x02, 0x70, 0x02, 0x21, 0x6b,
+    0x06, 0xb0, 0x29, 0x05, 0x10, 0x00, 0x24, 0x6d, 0x06, 0x90, 0x28, 0x02, 0x90, 0x2a, 0x24, 0x6d,
+    0x06, 0x90, 0x28, 0x02, 0x80, 0x15, 0x24, 0x7c, 0x06, 0x10, 0x1a, 0x00, 0x00, 0x29, 0x10, 0x00,
+    0x10, 0x00, 0x03, 0x10, 0x1a, 0x05, 0x10, 0x00, 0x03, 0x10, 0x1a, 0x00, 0x00, 0x29, 0x01, 0x10,
+    0x00, 0x03, 0x10, 0x1a, 0x02, 0x10, 0x00, 0x24, 0x7d, 0x06, 0xd0, 0x19, 0x02, 0x30, 0x00, 0x24,
+    0x7d, 0x06, 0xd0, 0x19, 0x05, 0x10, 0x00, 0x03, 0xa0, 0x00, 0x05, 0x30, 0x00, 0x03, 0xa0, 0x00,
+    0x02, 0x10, 0x00, 0x42, 0x7e, 0x06, 0x44, 0x64, 0x10, 0x16, 0x02, 0x30, 0x29, 0x44, 0x7e, 0x06,
+    0x44, 0x68, 0x10, 0x00, 0x00, 0xa0, 0x00, 0x48, 0x7f, 0x06, 0x44, 0x6c, 0x20, 0x00, 0x24, 0x7f,
+    0x06, 0x30, 0x33, 0x02, 0x20, 0x00, 0x1b, 0x8a, 0x20, 0x01, 0x1b, 0x8a, 0x20, 0x01, 0x1b, 0x8a,
+    0x20, 0x01, 0x1b, 0x8a, 0x20, 0x01, 0x1b, 0x8c, 0x20, 0x01, 0x1b, 0x8c, 0x20, 0x01, 0x2a, 0xa6,
+    0x06, 0xf0, 0x53, 0x2a, 0xa6, 0x06, 0xf0, 0x53, 0x2a, 0xa6, 0x06, 0xf0, 0x53, 0x2a, 0xa6, 0x06,
+    0xf0, 0x53, 0x2a, 0xa7, 0x06, 0xf0, 0x53, 0x2a, 0xa7, 0x06, 0xf0, 0x53, 0x2a, 0xa7, 0x06, 0xf0,
+    0x53, 0x2a, 0xa7, 0x06, 0xf0, 0x53, 0x21, 0xa8, 0x06, 0x30, 0x2c, 0x05, 0x50, 0x01, 0x21, 0xa8,
+    0x06, 0x30, 0x2c, 0x08, 0x10, 0x00, 0x09, 0xa0, 0x01, 0x21, 0xa8, 0x06, 0x30, 0x2c, 0x05, 0x10,
+    0x00, 0x15, 0xaa, 0x20, 0x01, 0x02, 0x30, 0x00, 0x15, 0xaa, 0x20, 0x01, 0x05, 0x10, 0x00, 0x09,
+    0xa0, 0x01, 0x15, 0xaa, 0x20, 0x01, 0x02, 0x10, 0x00, 0x2a, 0xab, 0x06, 0xf0, 0x2a, 0x2a, 0xab,
+    0x06, 0xf0, 0x2a, 0x15, 0xad, 0x40, 0x01, 0x02, 0x20, 0x00, 0x15, 0xad, 0x40, 0x01, 0x03, 0x50,
+    0x33, 0x33, 0x06, 0x12, 0xf8, 0x60, 0x10, 0x01, 0xd0, 0x0d, 0x2a, 0xaf, 0x06, 0xc0, 0x2b, 0x2a,
+    0xaf, 0x06, 0xc0, 0x2b, 0x2a, 0xaf, 0x06, 0xc0, 0x2b, 0x2a, 0xaf, 0x06, 0xc0, 0x2b, 0x2a, 0xb1,
+    0x06, 0xc0, 0x2b, 0x2a, 0xb1, 0x06, 0xc0, 0x2b, 0x2a, 0xb1, 0x06, 0xc0, 0x2b, 0x2a, 0xb1, 0x06,
+    0xc0, 0x2b, 0x1b, 0xb4, 0xd0, 0x00, 0x1b, 0xb4, 0xd0, 0x00, 0x1b, 0xb6, 0xd0, 0x00, 0x1b, 0xb6,
+    0xd0, 0x00, 0x11, 0xb7, 0x10, 0x68, 0x13, 0x28, 0x70, 0x2b, 0x10, 0x00, 0x10, 0x00, 0x1b, 0x8c,
+    0x10, 0x00, 0x14, 0x8f, 0x10, 0x00, 0x00, 0xf0, 0x00, 0x48, 0xb7, 0x06, 0x23, 0x92, 0x10, 0x00,
+    0x11, 0xb8, 0xe4, 0x67, 0x06, 0x30, 0x00, 0x4b, 0xb8, 0x06, 0x23, 0x98, 0x10, 0x00, 0x1b, 0x9b,
+    0x30, 0x00, 0x18, 0x9e, 0x10, 0x00, 0x57, 0xb9, 0x06, 0x23, 0xa1, 0x13, 0x20, 0x54, 0x03, 0x8e,
+    0x68, 0x05, 0x20, 0x54, 0x48, 0xbb, 0x06, 0x23, 0xa7, 0x20, 0x00, 0x03, 0x42, 0x68, 0x05, 0x20,
+    0x00, 0x15, 0xbc, 0x80, 0x01, 0x02, 0x80, 0x02, 0x15, 0xbc, 0x80, 0x01, 0x05, 0x10, 0x00, 0x03,
+    0x80, 0x01, 0x02, 0x80, 0x02, 0x15, 0xbc, 0x80, 0x01, 0x02, 0x10, 0x00, 0x15, 0xbd, 0x80, 0x01,
+    0x02, 0x30, 0x00, 0x15, 0xbd, 0x80, 0x01, 0x05, 0x10, 0x00, 0x03, 0x80, 0x01, 0x05, 0x30, 0x00,
+    0x03, 0x80, 0x01, 0x02, 0x10, 0x00, 0x1b, 0xbe, 0x80, 0x00, 0x1b, 0xbe, 0x80, 0x00, 0x1b, 0xbe,
+    0x80, 0x00, 0x1b, 0xbe, 0x80, 0x00, 0x1b, 0xbf, 0x80, 0x00, 0x1b, 0xbf, 0x80, 0x00, 0x1b, 0xbf,
+    0x80, 0x00, 0x1b, 0xbf, 0x80, 0x00, 0x12, 0xc0, 0x10, 0x06, 0x05, 0x30, 0x2d, 0x12, 0xc0, 0x10,
+    0x06, 0x08, 0x10, 0x00, 0x09, 0x80, 0x2d, 0x12, 0xc0, 0x10, 0x06, 0x05, 0x10, 0x00, 0x12, 0xc1,
+    0xd0, 0x09, 0x05, 0x30, 0x00, 0x12, 0xc1, 0xd0, 0x09, 0x08, 0x10, 0x00, 0x09, 0x80, 0x58, 0x12,
+    0xc1, 0xd0, 0x09, 0x05, 0x10, 0x00, 0x21, 0xc2, 0x06, 0x67, 0x5c, 0x50, 0x0a, 0x0a, 0x0a, 0x38,
+    0x00, 0xa9, 0x10, 0x1b, 0xc3, 0x10, 0x00, 0x0f, 0x01, 0x00, 0x2d, 0x1f, 0x0f, 0x28, 0x00, 0x14,
+    0x02, 0x77, 0x00, 0x02, 0x01, 0x00, 0x1f, 0x09, 0x28, 0x00, 0x08, 0x00, 0x26, 0x66, 0x04, 0x01,
+    0x00, 0x1f, 0x0d, 0x28, 0x00, 0x08, 0x08, 0x01, 0x00, 0x0a, 0x84, 0x00, 0x00, 0x86, 0x02, 0x0f,
+    0x01, 0x00, 0x15, 0x0f, 0x2c, 0x00, 0x08, 0x1f, 0x10, 0x43, 0x00, 0x14, 0x0f, 0x44, 0x01, 0x15,
+    0x00, 0x28, 0x00, 0x0f, 0x2c, 0x00, 0x11, 0x0f, 0xbf, 0x00, 0x15, 0x1f, 0x14, 0x28, 0x00, 0x14,
+    0x04, 0x01, 0x00, 0x0f, 0x17, 0x01, 0x34, 0x01, 0x18, 0x01, 0x1f, 0x02, 0x39, 0x02, 0x18, 0x12,
+    0x02, 0xf1, 0x5e, 0x0f, 0x01, 0x00, 0x06, 0x50, 0x18, 0x02, 0x00, 0x00, 0x43, 0x1e, 0x02, 0x00,
+    0x6e, 0x20, 0x0f, 0x01, 0x00, 0x08, 0x72, 0x10, 0x02, 0x00, 0x00, 0x42, 0x0e, 0x00, 0xd6, 0x5e,
+    0x0f, 0x01, 0x00, 0x07, 0x1f, 0x80, 0x46, 0x00, 0x0b, 0x06, 0x28, 0x00, 0x0f, 0xc3, 0x00, 0x14,
+    0x1f, 0x40, 0x27, 0x00, 0x13, 0x0f, 0x28, 0x00, 0x06, 0x0c, 0xd0, 0x02, 0x1f, 0xc0, 0x3b, 0x01,
+    0x18, 0x0f, 0x7c, 0x00, 0x11, 0x0f, 0xd7, 0x01, 0x15, 0x0f, 0x28, 0x00, 0x05, 0x0f, 0x70, 0x03,
+    0x01, 0x1f, 0xd4, 0xa4, 0x00, 0x10, 0x0f, 0xae, 0x01, 0x0c, 0x0f, 0x28, 0x00, 0x0e, 0x0c, 0x78,
+    0x00, 0x1f, 0x41, 0x50, 0x00, 0x14, 0x0f, 0x28, 0x00, 0x05, 0x0c, 0x50, 0x00, 0x1f, 0xd5, 0x50,
+    0x00, 0x14, 0x3f, 0xd5, 0x5f, 0x3f, 0x28, 0x00, 0x12, 0x00, 0xc8, 0x00, 0x0f, 0xf4, 0x00, 0x11,
+    0x0d, 0x28, 0x00, 0x0f, 0x4c, 0x01, 0x04, 0x1c, 0x11, 0xa4, 0x00, 0x0f, 0x28, 0x00, 0x04, 0x00,
+    0x4c, 0x00, 0x1f, 0xd5, 0x90, 0x01, 0x14, 0x17, 0xc5, 0x28, 0x00, 0x0f, 0xbf, 0x04, 0x09, 0x0f,
+    0xbc, 0x01, 0x22, 0x0f, 0x84, 0x00, 0x08, 0x0f, 0xbc, 0x01, 0x11, 0x2f, 0x40, 0x04, 0xc8, 0x00,
+    0x13, 0x00, 0x01, 0x00, 0x0f, 0xbc, 0x01, 0x16, 0x0f, 0x50, 0x05, 0x14, 0x0f, 0x28, 0x00, 0x12,
+    0x2f, 0x50, 0x02, 0x0c, 0x02, 0x13, 0x10, 0x10, 0x28, 0x00, 0x1f, 0x3d, 0x28, 0x00, 0x10, 0x5f,
+    0x12, 0x00, 0xd5, 0x5f, 0x2c, 0x6e, 0x01, 0x12, 0x0f, 0x84, 0x02, 0x15, 0x3f, 0xd5, 0x5f, 0x3c,
+    0x50, 0x00, 0x14, 0x00, 0x28, 0x00, 0x0f, 0x78, 0x05, 0x0c, 0x00, 0xac, 0x61, 0x4f, 0x00, 0x00,
+    0x00, 0x90, 0x1c, 0x01, 0x10, 0x0f, 0x28, 0x00, 0x01, 0x08, 0x70, 0x03, 0x04, 0x01, 0x00, 0x17,
+    0xc5, 0x0c, 0x00, 0x00, 0x15, 0x0f, 0x0f, 0x01, 0x00, 0x05, 0x2f, 0xc1, 0x08, 0xbf, 0x06, 0x13,
+    0x00, 0x58, 0x02, 0x1f, 0x94, 0xfc, 0x02, 0x14, 0x0f, 0xb4, 0x04, 0x0d, 0x00, 0x10, 0x03, 0x00,
+    0x74, 0x03, 0x04, 0x01, 0x00, 0x1f, 0xc4, 0x30, 0x00, 0x08, 0x08, 0x62, 0x01, 0x0f, 0x80, 0x00,
+    0x09, 0x10, 0xc1, 0x05, 0x00, 0x03, 0x20, 0x00, 0x0f, 0xd0, 0x00, 0x09, 0x08, 0x20, 0x03, 0x0f,
+    0x50, 0x00, 0x09, 0x10, 0x81, 0x28, 0x03, 0x0f, 0x50, 0x00, 0x10, 0x17, 0x01, 0x44, 0x00, 0x1f,
+    0xd4, 0x28, 0x00, 0x08, 0x01, 0x2c, 0x00, 0x0f, 0x20, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x17, 0xc4,
+    0x54, 0x00, 0x0f, 0x38, 0x04, 0x09, 0x00, 0x90, 0x06, 0x1f, 0x95, 0xc4, 0x03, 0x15, 0x0f, 0x28,
+    0x00, 0x10, 0x17, 0xc0, 0x78, 0x00, 0x0f, 0xf0, 0x00, 0x09, 0x00, 0x78, 0x00, 0x04, 0x28, 0x00,
+    0x1f, 0x94, 0x57, 0x00, 0x0f, 0x0f, 0xf4, 0x00, 0x0e, 0x00, 0xf0, 0x00, 0x04, 0x01, 0x00, 0x1f,
+    0x11, 0xa8, 0x00, 0x08, 0x08, 0x80, 0x07, 0x0f, 0xf8, 0x00, 0x35, 0xd0, 0x04, 0x02, 0x22, 0x4e,
+    0x0f, 0x00, 0x00, 0x06, 0x04, 0x03, 0x00, 0x03, 0x03, 0x0e, 0x00, 0x14, 0x51, 0x0e, 0x00, 0x39,
+    0x01, 0x10, 0x1c, 0x1c, 0x00, 0x19, 0x1c, 0x1c, 0x00, 0x19, 0x1d, 0x1c, 0x00, 0x19, 0x1d, 0x1c,
+    0x00, 0x19, 0x1e, 0x1c, 0x00, 0x19, 0x1e, 0x1c, 0x00, 0x19, 0x1f, 0x1c, 0x00, 0x19, 0x1f, 0x1c,
+    0x00, 0x19, 0x20, 0x1c, 0x00, 0x19, 0x20, 0x1c, 0x00, 0x19, 0x21, 0x1c, 0x00, 0x19, 0x21, 0x1c,
+    0x00, 0x19, 0x22, 0x1c, 0x00, 0x19, 0x22, 0x1c, 0x00, 0x19, 0x23, 0x1c, 0x00, 0x19, 0x23, 0x1c,
+    0x00, 0x19, 0x24, 0x1c, 0x00, 0x19, 0x24, 0x1c, 0x00, 0x19, 0x25, 0x1c, 0x00, 0x19, 0x25, 0x1c,
+    0x00, 0x19, 0x26, 0x1c, 0x00, 0x19, 0x26, 0x1c, 0x00, 0x19, 0x27, 0x1c, 0x00, 0x19, 0x27, 0x1c,
+    0x00, 0x19, 0x28, 0x1c, 0x00, 0x19, 0x28, 0x1c, 0x00, 0x19, 0x29, 0x1c, 0x00, 0x19, 0x29, 0x1c,
+    0x00, 0x19, 0x2a, 0x1c, 0x00, 0x19, 0x2a, 0x1c, 0x00, 0x19, 0x2b, 0x1c, 0x00, 0x19, 0x2b, 0x1c,
+    0x00, 0x19, 0x2c, 0x1c, 0x00, 0x19, 0x2c, 0x1c, 0x00, 0x19, 0x2d, 0x1c, 0x00, 0x19, 0x2d, 0x1c,
+    0x00, 0x19, 0x2e, 0x1c, 0x00, 0x19, 0x2e, 0x1c, 0x00, 0x19, 0x36, 0x1c, 0x00, 0x19, 0x36, 0x1c,
+    0x00, 0x19, 0x37, 0x1c, 0x00, 0x19, 0x37, 0x1c, 0x00, 0x19, 0x59, 0x1c, 0x00, 0x19, 0x59, 0x1c,
+    0x00, 0x19, 0x8c, 0x1c, 0x00, 0x1a, 0x8c, 0x34, 0x01, 0x91, 0x00, 0x34, 0x70, 0x06, 0x00, 0x44,
+    0xbc, 0xb0, 0x51, 0x6a, 0x0b, 0x45, 0x28, 0x00, 0x34, 0x74, 0x0f, 0x00, 0x32, 0x10, 0x00, 0x29,
+    0xbe, 0x74, 0x00, 0x0f, 0x00, 0x00, 0xbe, 0x74, 0x12, 0x29, 0xbd, 0x74, 0x02, 0x0f, 0x00, 0x3a,
+    0x10, 0x01, 0x2a, 0x1e, 0x00, 0x1a, 0x2a, 0x1e, 0x00, 0x1a, 0x2b, 0x1e, 0x00, 0x1a, 0x2b, 0x1e,
+    0x00, 0x1a, 0x2c, 0x1e, 0x00, 0x1a, 0x2c, 0x1e, 0x00, 0x1a, 0x2d, 0x1e, 0x00, 0x1a, 0x2d, 0x1e,
+    0x00, 0x1a, 0x32, 0x1e, 0x00, 0x1a, 0x32, 0x1e, 0x00, 0x1a, 0x34, 0x1e, 0x00, 0x1a, 0x34, 0x1e,
+    0x00, 0xa1, 0x95, 0x01, 0x11, 0xd1, 0x1e, 0x00, 0x00, 0xda, 0x7b, 0x5c, 0x38, 0x04, 0x73, 0xa2,
+    0x01, 0x34, 0x78, 0x06, 0x00, 0x26, 0x0f, 0x00, 0x55, 0x01, 0xa2, 0x01, 0x34, 0x7c, 0x0f, 0x00,
+    0x75, 0x10, 0x01, 0xa3, 0x01, 0x33, 0x78, 0x06, 0x2d, 0x00, 0x00, 0x0f, 0x00, 0x15, 0x7c, 0x0f,
+    0x00, 0x49, 0x10, 0x01, 0xf3, 0x02, 0x4b, 0x00, 0x29, 0x11, 0x03, 0x78, 0x00, 0x29, 0x11, 0x03,
+    0x78, 0x00, 0x1a, 0x24, 0x1e, 0x00, 0x1a, 0x24, 0x1e, 0x00, 0x12, 0x62, 0xb6, 0x3f, 0x03, 0xc6,
+    0x2f, 0x22, 0x00, 0x62, 0xb5, 0x3f, 0x07, 0x0f, 0x00, 0x00, 0x84, 0x13, 0x03, 0xa4, 0x2f, 0x00,
+    0x0f, 0x00, 0x00, 0x83, 0x13, 0x04, 0x0f, 0x00, 0x12, 0x63, 0x72, 0x3f, 0x04, 0x2d, 0x00, 0x12,
+    0x63, 0x71, 0x3f, 0x07, 0x0f, 0x00, 0x00, 0x80, 0x13, 0x07, 0x2d, 0x00, 0x00, 0x7f, 0x13, 0x04,
+    0x0f, 0x00, 0x12, 0x64, 0x4e, 0x44, 0x04, 0x2d, 0x00, 0x12, 0x64, 0x2d, 0x41, 0x04, 0x1e, 0x00,
+    0x47, 0x65, 0x04, 0x22, 0x16, 0x1e, 0x00, 0x12, 0x65, 0x8b, 0x40, 0x04, 0x1e, 0x00, 0x40, 0x24,
+    0x05, 0x44, 0x80, 0x0e, 0x01, 0x03, 0x7a, 0x30, 0x4a, 0x24, 0x05, 0x44, 0x84, 0x0f, 0x00, 0x1a,
+    0x88, 0x0f, 0x00, 0x1a, 0x8c, 0x0f, 0x00, 0x14, 0x90, 0x0f, 0x00, 0x20, 0x01, 0x10, 0x0f, 0x00,
+    0x1a, 0x94, 0x0f, 0x00, 0x1a, 0x98, 0x0f, 0x00, 0x17, 0x9c, 0x0f, 0x00, 0x30, 0x3a, 0x05, 0x44,
+    0x72, 0x1a, 0x04, 0x4b, 0x00, 0x30, 0x3a, 0x05, 0x44, 0x61, 0x1a, 0x04, 0x1e, 0x00, 0x30, 0x3b,
+    0x05, 0x44, 0x40, 0x11, 0x04, 0x1e, 0x00, 0x30, 0x3b, 0x05, 0x44, 0x2f, 0x11, 0x04, 0x1e, 0x00,
+    0x30, 0x40, 0x05, 0x44, 0xee, 0x1a, 0x04, 0x1e, 0x00, 0x30, 0x40, 0x05, 0x44, 0xdd, 0x1a, 0x04,
+    0x1e, 0x00, 0x12, 0x41, 0xfc, 0x3a, 0x04, 0x1e, 0x00, 0x12, 0x41, 0xeb, 0x3a, 0x04, 0x1e, 0x00,
+    0x12, 0x42, 0xda, 0x39, 0x04, 0x1e, 0x00, 0x12, 0x42, 0xc9, 0x39, 0x04, 0x1e, 0x00, 0x30, 0x43,
+    0x05, 0x44, 0xf8, 0x11, 0x04, 0x1e, 0x00, 0x30, 0x43, 0x05, 0x44, 0xe7, 0x11, 0x04, 0x1e, 0x00,
+    0x12, 0x44, 0x96, 0x39, 0x04, 0x1e, 0x00, 0x12, 0x44, 0x85, 0x39, 0x04, 0x1e, 0x00, 0x30, 0x45,
+    0x05, 0x44, 0x44, 0x1a, 0x04, 0x1e, 0x00, 0x30, 0x45, 0x05, 0x44, 0x33, 0x1a, 0x04, 0x1e, 0x00,
+    0x47, 0x77, 0x05, 0x22, 0x18, 0x86, 0x01, 0x44, 0x77, 0x05, 0x22, 0x1a, 0x0f, 0x00, 0x77, 0x01,
+    0x10, 0x00, 0x78, 0x05, 0x22, 0x1c, 0x1e, 0x00, 0x47, 0x78, 0x05, 0x22, 0x1e, 0x1e, 0x00, 0x47,
+    0x79, 0x05, 0x22, 0xf5, 0x1c, 0x02, 0x47, 0x79, 0x05, 0x22, 0xf8, 0x0d, 0x02, 0x47, 0x7b, 0x05,
+    0x22, 0x20, 0x3c, 0x00, 0x47, 0x7b, 0x05, 0x22, 0x22, 0x3c, 0x00, 0x47, 0x7d, 0x05, 0x22, 0x24,
+    0x1e, 0x00, 0x47, 0x7d, 0x05, 0x22, 0x26, 0x1e, 0x00, 0x47, 0x7e, 0x05, 0x22, 0x28, 0x1e, 0x00,
+    0x47, 0x7e, 0x05, 0x22, 0x2a, 0x1e, 0x00, 0x47, 0x7f, 0x05, 0x22, 0x2c, 0x1e, 0x00, 0x47, 0x7f,
+    0x05, 0x22, 0x2e, 0x1e, 0x00, 0x47, 0x80, 0x05, 0x22, 0x30, 0x1e, 0x00, 0x47, 0x80, 0x05, 0x22,
+    0x32, 0x1e, 0x00, 0x47, 0x81, 0x05, 0x22, 0x34, 0x1e, 0x00, 0x47, 0x81, 0x05, 0x22, 0x36, 0x1e,
+    0x00, 0x47, 0x82, 0x05, 0x22, 0x38, 0x1e, 0x00, 0x47, 0x82, 0x05, 0x22, 0x3a, 0x1e, 0x00, 0x47,
+    0x84, 0x05, 0x22, 0x3c, 0x1e, 0x00, 0x47, 0x84, 0x05, 0x22, 0x3e, 0x1e, 0x00, 0x47, 0x85, 0x05,
+    0x22, 0x40, 0x1e, 0x00, 0x47, 0x85, 0x05, 0x22, 0x42, 0x1e, 0x00, 0x47, 0x87, 0x05, 0x22, 0x44,
+    0x1e, 0x00, 0x47, 0x87, 0x05, 0x22, 0x46, 0x1e, 0x00, 0x1a, 0x89, 0x2c, 0x01, 0x1a, 0x89, 0x2c,
+    0x01, 0x1a, 0x8c, 0x78, 0x00, 0x1a, 0x8c, 0x78, 0x00, 0x47, 0x93, 0x05, 0x44, 0xe0, 0xe0, 0x01,
+    0x47, 0x93, 0x05, 0x44, 0xe4, 0xe0, 0x01, 0x30, 0x94, 0x05, 0x44, 0x02, 0x27, 0x04, 0x1e, 0x00,
+    0x30, 0x94, 0x05, 0x44, 0xf1, 0x26, 0x04, 0x1e, 0x00, 0x1a, 0x95, 0x1e, 0x00, 0x1a, 0x95, 0x1e,
+    0x00, 0x1a, 0x96, 0x5a, 0x00, 0x1a, 0x96, 0x5a, 0x00, 0x1a, 0x97, 0x3c, 0x00, 0x1a, 0x97, 0x3c,
+    0x00, 0x1a, 0x98, 0x1e, 0x00, 0x1a, 0x98, 0x1e, 0x00, 0x30, 0x99, 0x05, 0x44, 0x78, 0x2e, 0x04,
+    0x1e, 0x00, 0x30, 0x99, 0x05, 0x44, 0x67, 0x2e, 0x04, 0x1e, 0x00, 0x47, 0x9a, 0x05, 0x44, 0xf8,
+    0x1e, 0x00, 0x47, 0x9a, 0x05, 0x44, 0xfc, 0x1e, 0x00, 0x1a, 0x9b, 0x3c, 0x00, 0x1a, 0x9b, 0x3c,
+    0x00, 0x1a, 0x9c, 0x3c, 0x00, 0x1a, 0x9c, 0x3c, 0x00, 0x1a, 0x9d, 0x3c, 0x00, 0x1a, 0x9d, 0x3c,
+    0x00, 0x1a, 0x9e, 0x1e, 0x00, 0x1a, 0x9e, 0x1e, 0x00, 0x1a, 0xf0, 0x5a, 0x00, 0x59, 0xf0, 0x05,
+    0x44, 0x00, 0x07, 0x0f, 0x00, 0x08, 0x69, 0x00, 0x44, 0xf0, 0x05, 0x44, 0x04, 0x1e, 0x00, 0x77,
+    0x01, 0x10, 0x04, 0x01, 0x06, 0x33, 0xd1, 0x2a, 0x03, 0x47, 0x01, 0x06, 0x33, 0xd4, 0x2a, 0x03,
+    0x46, 0x01, 0x06, 0x33, 0xd7, 0x1e, 0x00, 0x00, 0x2d, 0x00, 0x08, 0x29, 0x04, 0x46, 0x01, 0x06,
+    0x33, 0xda, 0x2d, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x38, 0x04, 0x12, 0x02, 0x62, 0x25, 0x04, 0x5a,
+    0x00, 0x12, 0x02, 0x51, 0x25, 0x04, 0x5a, 0x00, 0x47, 0x02, 0x06, 0x33, 0xdd, 0x5a, 0x00, 0x12,
+    0x02, 0x8f, 0x1c, 0x07, 0x0f, 0x00, 0x17, 0xe0, 0x5a, 0x00, 0x12, 0x02, 0x8d, 0x1c, 0x04, 0x0f,
+    0x00, 0x47, 0x03, 0x06, 0x33, 0xe3, 0xb4, 0x00, 0x47, 0x03, 0x06, 0x33, 0xe6, 0xb4, 0x00, 0x47,
+    0x03, 0x06, 0x33, 0xe9, 0x5a, 0x00, 0x12, 0x03, 0x99, 0x16, 0x07, 0x0f, 0x00, 0x17, 0xec, 0x5a,
+    0x00, 0x12, 0x03, 0x97, 0x16, 0x04, 0x0f, 0x00, 0x30, 0x04, 0x06, 0x33, 0xb6, 0x32, 0x04, 0x5a,
+    0x00, 0x30, 0x04, 0x06, 0x33, 0xb5, 0x32, 0x04, 0x5a, 0x00, 0x47, 0x04, 0x06, 0x33, 0xef, 0x5a,
+    0x00, 0x12, 0x04, 0xc3, 0x1c, 0x07, 0x0f, 0x00, 0x17, 0xf2, 0x5a, 0x00, 0x12, 0x04, 0xc1, 0x1c,
+    0x04, 0x0f, 0x00, 0x37, 0x0c, 0x06, 0x33, 0x92, 0x04, 0x00, 0x0f, 0x00, 0x08, 0xcd, 0x05, 0x37,
+    0x0c, 0x06, 0x33, 0xa1, 0x04, 0x00, 0x0f, 0x00, 0x08, 0xdc, 0x05, 0x47, 0x0d, 0x06, 0x33, 0xfb,
+    0x3c, 0x00, 0x12, 0x0d, 0x2b, 0x17, 0x07, 0x0f, 0x00, 0x17, 0xfe, 0x3c, 0x00, 0x12, 0x0d, 0x29,
+    0x17, 0x04, 0x0f, 0x00, 0x56, 0x0e, 0x06, 0x33, 0x01, 0x11, 0x2d, 0x00, 0x12, 0x0e, 0xf7, 0x20,
+    0x07, 0x0f, 0x00, 0x14, 0x04, 0x1e, 0x00, 0x02, 0x2d, 0x00, 0x08, 0x18, 0x06, 0x47, 0x0f, 0x06,
+    0x33, 0x07, 0x3c, 0x00, 0x12, 0x0f, 0xf3, 0x1f, 0x07, 0x0f, 0x00, 0x17, 0x0a, 0x3c, 0x00, 0x12,
+    0x0f, 0xf1, 0x1f, 0x04, 0x0f, 0x00, 0x1a, 0x10, 0x3a, 0x02, 0x1a, 0x10, 0x3a, 0x02, 0x1a, 0x10,
+    0x3a, 0x02, 0x1a, 0x10, 0x3a, 0x02, 0x1a, 0x11, 0x1c, 0x02, 0x1a, 0x11, 0x1c, 0x02, 0x1a, 0x11,
+    0x1c, 0x02, 0x1a, 0x11, 0x1c, 0x02, 0x1a, 0x18, 0xfe, 0x01, 0x1a, 0x18, 0xfe, 0x01, 0x1a, 0x18,
+    0xfe, 0x01, 0x1a, 0x18, 0xfe, 0x01, 0x1a, 0x19, 0xe0, 0x01, 0x1a, 0x19, 0xe0, 0x01, 0x1a, 0x19,
+    0xe0, 0x01, 0x1a, 0x19, 0xe0, 0x01, 0x04, 0x70, 0x7e, 0x21, 0x73, 0x28, 0x60, 0x29, 0x15, 0x06,
+    0x71, 0x7e, 0x05, 0x11, 0x00, 0xa1, 0x35, 0x03, 0x44, 0xb8, 0x0c, 0x00, 0x00, 0x64, 0x73, 0x28,
+    0x4f, 0x00, 0x1c, 0x29, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x14, 0xbc, 0x11, 0x00, 0x90, 0x01,
+    0x10, 0x04, 0x2d, 0x00, 0x36, 0x03, 0x44, 0xfa, 0x9f, 0x08, 0x03, 0x22, 0x00, 0x1c, 0x28, 0x11,
+    0x00, 0x10, 0x22, 0x11, 0x00, 0x17, 0xc0, 0x33, 0x00, 0x3c, 0x2a, 0x00, 0x37, 0x66, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x39, 0x66, 0x00, 0x0b, 0x11, 0x00,
+    0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x47, 0x3b, 0x03, 0x44, 0xc4, 0x55, 0x00, 0x1c, 0x28,
+    0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x19, 0xc8, 0x33, 0x00, 0x38, 0x46, 0x03, 0x55, 0x55, 0x00,
+    0x10, 0x21, 0x11, 0x00, 0x14, 0xff, 0x11, 0x00, 0x62, 0x01, 0x10, 0x04, 0x26, 0x00, 0x4e, 0xaa,
+    0x00, 0x15, 0x22, 0xbb, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x00, 0xbb, 0x00, 0x01,
+    0x11, 0x00, 0x01, 0xbb, 0x00, 0x12, 0x4f, 0xaa, 0x00, 0x04, 0x22, 0x00, 0x1c, 0x28, 0x11, 0x00,
+    0x10, 0x22, 0x11, 0x00, 0x00, 0xbb, 0x00, 0x04, 0x33, 0x00, 0xa2, 0x2a, 0x00, 0x56, 0x03, 0x33,
+    0xd0, 0x0c, 0x00, 0x00, 0x28, 0x11, 0x00, 0x77, 0x00, 0x32, 0x04, 0x59, 0x03, 0x33, 0xf4, 0x11,
+    0x00, 0x67, 0x33, 0x03, 0x5c, 0x03, 0x33, 0xd8, 0x11, 0x00, 0x78, 0x34, 0x04, 0x5f, 0x03, 0x33,
+    0x76, 0x1a, 0x22, 0x00, 0x1b, 0x60, 0x33, 0x00, 0x2b, 0x01, 0x61, 0x55, 0x00, 0x62, 0x02, 0x62,
+    0x03, 0x55, 0x04, 0x05, 0xdd, 0x00, 0x00, 0xd5, 0x9d, 0x2b, 0x29, 0x00, 0x11, 0x00, 0x10, 0x23,
+    0x11, 0x00, 0x14, 0x09, 0x11, 0x00, 0x01, 0xcc, 0x00, 0x49, 0x64, 0x03, 0x55, 0x0e, 0x33, 0x00,
+    0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x17, 0x13, 0x33, 0x00, 0xa2, 0x2a, 0x00, 0x6d, 0x03,
+    0x33, 0xf0, 0x0c, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x2c, 0x00, 0x28, 0x11, 0x00, 0x10, 0x20, 0x11,
+    0x00, 0x00, 0xaa, 0x00, 0x01, 0x11, 0x00, 0x99, 0x01, 0x10, 0x00, 0x2f, 0x00, 0x70, 0x03, 0x44,
+    0xcc, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x00, 0xcc, 0x00, 0x04, 0x33, 0x00,
+    0x67, 0x2e, 0x00, 0x71, 0x03, 0x44, 0xd4, 0x22, 0x00, 0x1c, 0x29, 0x11, 0x00, 0x10, 0x23, 0x11,
+    0x00, 0x00, 0x32, 0x01, 0x04, 0x33, 0x00, 0x69, 0x2d, 0x00, 0x72, 0x03, 0x44, 0xdc, 0x33, 0x00,
+    0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x19, 0xe0, 0x33, 0x00, 0x49, 0x73, 0x03, 0x44, 0xe4,
+    0x99, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x08, 0x66, 0x00, 0x69, 0x2a, 0x00, 0x74,
+    0x03, 0x44, 0xe8, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x08, 0x66, 0x00, 0x69,
+    0x2a, 0x00, 0x75, 0x03, 0x44, 0xec, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x0a,
+    0xff, 0x00, 0x40, 0x7e, 0x03, 0x33, 0x79, 0x7a, 0x6d, 0x05, 0xcc, 0x00, 0x0b, 0x11, 0x00, 0x10,
+    0x22, 0x11, 0x00, 0x08, 0x33, 0x00, 0x67, 0x2d, 0x00, 0x8c, 0x03, 0x33, 0x7c, 0x22, 0x00, 0x1c,
+    0x28, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x08, 0x98, 0x01, 0x3c, 0x2b, 0x00, 0xb8, 0xcb, 0x01,
+    0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0xcb, 0x01, 0x55, 0xcf, 0x03, 0x33, 0x04, 0x0d,
+    0x52, 0x03, 0x2c, 0x00, 0x21, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x14, 0x08, 0x11, 0x00, 0x00,
+    0xba, 0x0c, 0x2c, 0x00, 0xe7, 0x1e, 0x04, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x08, 0x1e,
+    0x04, 0x3c, 0x31, 0x00, 0xe8, 0x1e, 0x04, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x08, 0x1e,
+    0x04, 0x32, 0x2e, 0x00, 0xe9, 0x55, 0x00, 0x15, 0xc0, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22,
+    0x11, 0x00, 0x00, 0x66, 0x00, 0x01, 0x11, 0x00, 0x01, 0xfd, 0x02, 0x12, 0xeb, 0x55, 0x00, 0x04,
+    0x22, 0x00, 0x1c, 0x28, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x00, 0x66, 0x00, 0x04, 0x33, 0x00,
+    0x3c, 0x2a, 0x00, 0xef, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00,
+    0x1c, 0xf1, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0xf5,
+    0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0xf7, 0x66, 0x00,
+    0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0xfb, 0x33, 0x00, 0x0b, 0x11,
+    0x00, 0x10, 0x22, 0x11, 0x00, 0x08, 0x33, 0x00, 0x4b, 0x2c, 0x00, 0x0d, 0x04, 0x99, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x99, 0x00, 0x2b, 0x0f, 0x04, 0x66, 0x00, 0x0b, 0x11,
+    0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x99, 0x00, 0x1c, 0x13, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10,
+    0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x15, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11,
+    0x00, 0x0a, 0x66, 0x00, 0x1c, 0x19, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a,
+    0x66, 0x00, 0x1c, 0x1b, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00,
+    0x1c, 0x30, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x32,
+    0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x36, 0x66, 0x00,
+    0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x38, 0x66, 0x00, 0x0b, 0x11,
+    0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x3c, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10,
+    0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x3e, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11,
+    0x00, 0x0a, 0x66, 0x00, 0x1c, 0x46, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a,
+    0x66, 0x00, 0x1c, 0x48, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00,
+    0x1c, 0x4c, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x4e,
+    0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x52, 0x66, 0x00,
+    0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x54, 0x66, 0x00, 0x0b, 0x11,
+    0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x53, 0x66, 0x04, 0x33, 0x7f, 0x1a, 0x0c, 0x05,
+    0x97, 0x0c, 0x10, 0x20, 0x33, 0x01, 0x67, 0x04, 0x33, 0x82, 0x11, 0x00, 0x64, 0x32, 0x02, 0x69,
+    0x04, 0x22, 0xc4, 0x18, 0x0a, 0x00, 0x11, 0x00, 0x23, 0x00, 0x6a, 0x11, 0x00, 0x14, 0x78, 0x11,
+    0x00, 0x1c, 0x6b, 0x11, 0x00, 0x1c, 0x6f, 0x33, 0x00, 0x21, 0x74, 0x04, 0x1c, 0x06, 0x04, 0xe9,
+    0x05, 0x1c, 0x29, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x00, 0x2d, 0x06, 0x04, 0xfa, 0x05, 0x41,
+    0x2d, 0x00, 0x76, 0x04, 0x82, 0x06, 0x04, 0x22, 0x00, 0x1c, 0x28, 0x11, 0x00, 0x10, 0x23, 0x11,
+    0x00, 0x08, 0x33, 0x00, 0x5a, 0x2a, 0x00, 0x7a, 0x04, 0x44, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10,
+    0x23, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x47, 0x7c, 0x04, 0x44, 0xf8, 0x22, 0x00, 0x1c, 0x28, 0x11,
+    0x00, 0x10, 0x23, 0x11, 0x00, 0x00, 0x2c, 0x07, 0x06, 0x66, 0x00, 0x12, 0x83, 0x54, 0x01, 0x06,
+    0x60, 0x06, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x0a, 0x7e, 0x0a, 0x12, 0x84, 0xba, 0x01,
+    0x06, 0xc6, 0x06, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x0a, 0xe4, 0x0a, 0x1c, 0x85, 0x66,
+    0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x86, 0x66, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0x87, 0x66, 0x00, 0x0b, 0x11, 0x00,
+    0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x21, 0x99, 0x04, 0x6d, 0x0a, 0x13, 0x40, 0x10, 0x01,
+    0x32, 0xb4, 0x00, 0x9a, 0x87, 0x01, 0x04, 0x11, 0x00, 0x41, 0xb3, 0x00, 0x9b, 0x04, 0x5e, 0x08,
+    0x04, 0x11, 0x00, 0x41, 0xb2, 0x00, 0x9c, 0x04, 0x8f, 0x0a, 0x04, 0x11, 0x00, 0x3c, 0xb5, 0x00,
+    0x9d, 0x44, 0x00, 0x1c, 0x9e, 0x44, 0x00, 0x1c, 0x9f, 0x44, 0x00, 0x1c, 0xa0, 0x44, 0x00, 0x2b,
+    0xa1, 0x04, 0x4d, 0x08, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11, 0x00, 0x0a, 0x4d, 0x08, 0x12, 0xb7,
+    0x75, 0x02, 0x01, 0x44, 0x00, 0x01, 0x20, 0x02, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x08,
+    0x88, 0x00, 0x10, 0x33, 0x11, 0x00, 0x17, 0x85, 0x77, 0x00, 0x50, 0x37, 0x00, 0xb8, 0x04, 0x33,
+    0x20, 0x02, 0x04, 0x33, 0x00, 0x1c, 0x28, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x08, 0xbb, 0x00,
+    0x10, 0x32, 0x11, 0x00, 0x17, 0x88, 0x44, 0x00, 0x32, 0x36, 0x00, 0xbc, 0xaa, 0x00, 0x06, 0x44,
+    0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x08, 0x21, 0x01, 0x10, 0x34, 0x11, 0x00, 0x17,
+    0x8b, 0x44, 0x00, 0x64, 0x38, 0x00, 0xbd, 0x04, 0x33, 0x8e, 0x11, 0x00, 0x01, 0xcc, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x08, 0x32, 0x01, 0x10, 0x35, 0x11, 0x00, 0x17, 0x91, 0x11,
+    0x00, 0x60, 0x39, 0x00, 0xcb, 0x04, 0x33, 0x94, 0x11, 0x00, 0x14, 0x75, 0xdd, 0x00, 0x47, 0xcc,
+    0x04, 0x33, 0x97, 0x11, 0x00, 0x3c, 0x36, 0x00, 0xcd, 0x22, 0x00, 0x1c, 0xce, 0x22, 0x00, 0x1c,
+    0xe3, 0x75, 0x02, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x75, 0x02, 0x1c, 0xe5, 0x75,
+    0x02, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x75, 0x02, 0x1a, 0xf8, 0xff, 0x00, 0x67,
+    0xb8, 0x00, 0xf9, 0x04, 0x33, 0x9a, 0x11, 0x00, 0x3a, 0xb7, 0x00, 0xfa, 0x65, 0x01, 0x67, 0xb6,
+    0x00, 0xfb, 0x04, 0x33, 0x9d, 0x11, 0x00, 0x3c, 0xb9, 0x00, 0xfc, 0x44, 0x00, 0x1c, 0xfd, 0x44,
+    0x00, 0x1c, 0xfe, 0x44, 0x00, 0x1c, 0xff, 0x44, 0x00, 0x46, 0x02, 0x05, 0x44, 0xfc, 0xdd, 0x00,
+    0x2c, 0x0a, 0x28, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x00, 0xe7, 0x22, 0x03, 0xbb, 0x00, 0x5b,
+    0x0a, 0x2e, 0x00, 0x04, 0x05, 0xee, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x8f,
+    0x0a, 0x1c, 0x07, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x2b,
+    0x08, 0x05, 0xe0, 0x0e, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x08, 0xe0, 0x0e, 0x3c, 0x2e,
+    0x00, 0x0f, 0x99, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x99, 0x00, 0x1c, 0x11,
+    0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x2b, 0x12, 0x05, 0x20,
+    0x02, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0xc1, 0x0b, 0x1c, 0x13, 0x33, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x12, 0x18, 0x88, 0x00, 0x06, 0x57, 0x0f,
+    0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x08, 0x57, 0x0f, 0x32, 0x2e, 0x00, 0x19, 0x55, 0x00,
+    0x06, 0xbd, 0x0f, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x08, 0xbd, 0x0f, 0x4a, 0x31, 0x00,
+    0x1e, 0x05, 0x68, 0x0f, 0x3a, 0x02, 0x21, 0x05, 0x68, 0x0f, 0x59, 0x01, 0x26, 0x05, 0x55, 0x18,
+    0x13, 0x0f, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x17, 0x1d, 0x13, 0x0f, 0x5a, 0x2e, 0x00,
+    0x28, 0x05, 0x44, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c,
+    0x2e, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0x33, 0x33,
+    0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x49, 0x36, 0x05, 0x55, 0x22,
+    0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x19, 0x27, 0x33, 0x00, 0x1a, 0x55, 0x0f,
+    0x02, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x33, 0x11, 0x3a, 0x56, 0x05, 0x44, 0xb6, 0x05, 0x0f, 0x11,
+    0x00, 0x01, 0x08, 0xb6, 0x05, 0x10, 0x26, 0xc9, 0x48, 0x17, 0xa0, 0x91, 0x08, 0x67, 0x34, 0x02,
+    0x74, 0x05, 0x33, 0xa3, 0x11, 0x00, 0x3c, 0x35, 0x01, 0x9f, 0x97, 0x02, 0x0b, 0x11, 0x00, 0x10,
+    0x20, 0x11, 0x00, 0x0a, 0x97, 0x02, 0x1c, 0xa0, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11,
+    0x00, 0x08, 0x33, 0x00, 0x10, 0x30, 0xf9, 0xe8, 0x0a, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20,
+    0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0xac, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00,
+    0x0a, 0x33, 0x00, 0x1c, 0xb0, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33,
+    0x00, 0x1c, 0xb4, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c,
+    0xdf, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0xe1, 0x33,
+    0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0xe4, 0x33, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0xee, 0x33, 0x00, 0x0b, 0x11, 0x00,
+    0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0xef, 0x2f, 0x04, 0x0b, 0x11, 0x00, 0x10, 0x20,
+    0x11, 0x00, 0x0a, 0x2f, 0x04, 0x04, 0xcc, 0x3e, 0x05, 0xeb, 0x14, 0x04, 0xcd, 0x3e, 0x05, 0x11,
+    0x00, 0x04, 0xce, 0x3e, 0x05, 0x11, 0x00, 0x04, 0xcf, 0x3e, 0x05, 0x11, 0x00, 0x04, 0xd0, 0x3e,
+    0x05, 0x11, 0x00, 0x04, 0xd1, 0x3e, 0x05, 0x11, 0x00, 0x04, 0xd2, 0x3e, 0x05, 0x11, 0x00, 0x04,
+    0xd3, 0x3e, 0x05, 0x11, 0x00, 0x2b, 0x06, 0x06, 0xe9, 0x05, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11,
+    0x00, 0x0a, 0xe9, 0x05, 0x1c, 0x07, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0b,
+    0x1c, 0x06, 0x36, 0x06, 0x33, 0xa6, 0x30, 0x03, 0x77, 0x00, 0x38, 0x02, 0x09, 0x06, 0x33, 0xa9,
+    0x11, 0x00, 0x10, 0x39, 0xa2, 0xc6, 0x19, 0x0c, 0x85, 0x03, 0x0f, 0x11, 0x00, 0x01, 0x19, 0x10,
+    0x96, 0x03, 0x00, 0xef, 0xc4, 0x03, 0x11, 0x00, 0x00, 0x5f, 0x39, 0x1c, 0x28, 0x11, 0x00, 0x10,
+    0x21, 0x11, 0x00, 0x14, 0x18, 0x11, 0x00, 0x01, 0xa9, 0x01, 0x46, 0x2b, 0x06, 0x44, 0x1c, 0x55,
+    0x00, 0x2c, 0x04, 0x28, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x16, 0x20, 0x66, 0x00, 0x20, 0x04,
+    0x2e, 0xf9, 0xc0, 0x0a, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x66, 0x00,
+    0x49, 0x31, 0x06, 0x44, 0x24, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x19, 0x28,
+    0x66, 0x00, 0x00, 0xb7, 0xbd, 0x09, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a,
+    0x66, 0x00, 0x1c, 0x38, 0xcc, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0xcc, 0x00,
+    0x2b, 0x3d, 0x06, 0xdb, 0x02, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0xdb, 0x02, 0x1c,
+    0x3f, 0x33, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x1c, 0x40, 0x20,
+    0x02, 0x0b, 0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x20, 0x02, 0x1c, 0x42, 0x33, 0x00, 0x0b,
+    0x11, 0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x33, 0x00, 0x2b, 0x4b, 0x06, 0x4f, 0x06, 0x0b, 0x11,
+    0x00, 0x10, 0x21, 0x11, 0x00, 0x0a, 0x4f, 0x06, 0x1c, 0x5b, 0xcc, 0x00, 0x0b, 0x11, 0x00, 0x10,
+    0x20, 0x11, 0x00, 0x0a, 0xcc, 0x00, 0x2b, 0x5c, 0x06, 0xda, 0x03, 0x0b, 0x11, 0x00, 0x10, 0x20,
+    0x11, 0x00, 0x0a, 0xda, 0x03, 0x2b, 0x65, 0x06, 0x16, 0x0c, 0x0b, 0x11, 0x00, 0x10, 0x23, 0x11,
+    0x00, 0x0a, 0x16, 0x0c, 0x21, 0x74, 0x06, 0x25, 0x0e, 0x06, 0x2f, 0x15, 0x0b, 0x11, 0x00, 0x10,
+    0x23, 0x11, 0x00, 0x08, 0xc9, 0x14, 0x4b, 0x2d, 0x00, 0x75, 0x06, 0x36, 0x0e, 0x0b, 0x11, 0x00,
+    0x10, 0x23, 0x11, 0x00, 0x0a, 0x36, 0x0e, 0x1c, 0x84, 0x99, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x23,
+    0x11, 0x00, 0x0a, 0x99, 0x00, 0x1c, 0x93, 0x32, 0x01, 0x0b, 0x11, 0x00, 0x10, 0x20, 0x11, 0x00,
+    0x0a, 0x32, 0x01, 0x47, 0x94, 0x06, 0x33, 0xac, 0xda, 0x03, 0x67, 0x37, 0x01, 0x95, 0x06, 0x33,
+    0xaf, 0x11, 0x00, 0x50, 0x36, 0x02, 0x97, 0x06, 0x22, 0x0d, 0x04, 0x03, 0x9b, 0x0f, 0x43, 0x00,
+    0x32, 0x00, 0x98, 0x11, 0x00, 0x02, 0xbd, 0x0f, 0x4c, 0x00, 0x32, 0x00, 0x99, 0x11, 0x00, 0x1c,
+    0x9d, 0x33, 0x00, 0x1c, 0xaf, 0x98, 0x01, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0xf4,
+    0x0b, 0x1c, 0xb1, 0xcc, 0x00, 0x0b, 0x11, 0x00, 0x11, 0x22, 0x80, 0x9e, 0x09, 0xf4, 0x0b, 0x1c,
+    0xb2, 0x66, 0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x1c, 0xb3, 0x66,
+    0x00, 0x0b, 0x11, 0x00, 0x10, 0x22, 0x11, 0x00, 0x0a, 0x66, 0x00, 0x05, 0x01, 0x00, 0x92, 0x01,
+    0x00, 0x03, 0x2c, 0x0d, 0x00, 0x39, 0x42, 0x6e, 0xf1, 0x28, 0x74, 0x02, 0x00, 0x14, 0x2c, 0x05,
+    0x00, 0x46, 0x0f, 0x00, 0xa1, 0x03, 0x00, 0x22, 0xb2, 0x1a, 0x00, 0x00, 0x6a, 0x93, 0x3b, 0x6f,
+    0x25, 0x47, 0x03, 0x00, 0x22, 0xb4, 0x0f, 0x00, 0x47, 0x04, 0x00, 0x14, 0x30, 0x2d, 0x00, 0x1a,
+    0x05, 0x2d, 0x00, 0x1a, 0x05, 0x2d, 0x00, 0x1a, 0x06, 0x69, 0x00, 0xa1, 0x07, 0x00, 0x23, 0x2f,
+    0x0d, 0x01, 0x24, 0x1e, 0x6e, 0x14, 0xd8, 0x25, 0x45, 0x07, 0x00, 0x23, 0x32, 0x0f, 0x00, 0x88,
+    0x50, 0x18, 0x07, 0x00, 0x23, 0x35, 0x0d, 0x00, 0x1e, 0x00, 0x15, 0x38, 0x0f, 0x00, 0x01, 0x1e,
+    0x00, 0x1a, 0x3b, 0x3c, 0x00, 0x15, 0x3e, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x1a, 0x41, 0x3c,
+    0x00, 0x15, 0x44, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x13, 0x47, 0x2d, 0x00, 0x03, 0x87, 0x00, 0x13,
+    0x4a, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x14, 0x4d, 0x1e, 0x00, 0x02, 0x3c, 0x00, 0x15, 0x50, 0x0f,
+    0x00, 0x01, 0x78, 0x00, 0x14, 0x53, 0x2d, 0x00, 0x02, 0x1e, 0x00, 0x15, 0x56, 0x0f, 0x00, 0x01,
+    0x1e, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0x1a, 0x59, 0x3c, 0x00, 0x17, 0x5c, 0x3c, 0x00, 0x80, 0x08,
+    0x00, 0x23, 0x5f, 0x0d, 0x06, 0x21, 0x02, 0x53, 0x92, 0x10, 0x01, 0xc4, 0x2b, 0x2a, 0x23, 0x62,
+    0x0f, 0x00, 0x15, 0x65, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x17, 0x68, 0x0f, 0x00, 0x74, 0x09,
+    0x00, 0x23, 0x6b, 0x0d, 0x01, 0x2b, 0xf0, 0x00, 0x45, 0x09, 0x00, 0x23, 0x6e, 0x0f, 0x00, 0x88,
+    0x50, 0x18, 0x09, 0x00, 0x23, 0x71, 0x0d, 0x00, 0x1e, 0x00, 0x15, 0x74, 0x0f, 0x00, 0x01, 0x1e,
+    0x00, 0x1a, 0x77, 0x3c, 0x00, 0x15, 0x7a, 0x0f, 0x00, 0x01, 0x5a, 0x00, 0x1a, 0x7d, 0x3c, 0x00,
+    0x15, 0x80, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x13, 0x83, 0x2d, 0x00, 0x00, 0x01, 0x00, 0x43, 0x09,
+    0x00, 0x23, 0x86, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x14, 0x89, 0x1e, 0x00, 0x02, 0x3c, 0x00, 0x15,
+    0x8c, 0x0f, 0x00, 0x01, 0x78, 0x00, 0x14, 0x8f, 0x2d, 0x00, 0x02, 0x1e, 0x00, 0x15, 0x92, 0x0f,
+    0x00, 0x01, 0x1e, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0x1a, 0x95, 0x3c, 0x00, 0x17, 0x98, 0x3c, 0x00,
+    0xb0, 0x0a, 0x00, 0x22, 0xad, 0x0d, 0x00, 0x00, 0xb0, 0xa4, 0x4b, 0x08, 0x60, 0x04, 0x44, 0x0a,
+    0x00, 0x22, 0xb0, 0x0f, 0x00, 0x70, 0x01, 0x10, 0x00, 0x0b, 0x00, 0x22, 0xb3, 0x0f, 0x00, 0x21,
+    0xa3, 0x4a, 0x1e, 0x00, 0x44, 0x0b, 0x00, 0x22, 0xb6, 0x0f, 0x00, 0x00, 0x71, 0xcd, 0x50, 0x00,
+    0x22, 0x13, 0x0e, 0x02, 0x2d, 0x00, 0x10, 0x0c, 0x1e, 0x00, 0x44, 0x0c, 0x00, 0x22, 0x16, 0x0f,
+    0x00, 0x70, 0x01, 0x10, 0x00, 0x0d, 0x00, 0x22, 0x1c, 0x0f, 0x00, 0x21, 0xa3, 0x4a, 0x1e, 0x00,
+    0x44, 0x0d, 0x00, 0x22, 0x1f, 0x0f, 0x00, 0x43, 0x01, 0x10, 0x00, 0x0e, 0x78, 0x00, 0x21, 0xa6,
+    0x4c, 0x5a, 0x00, 0x13, 0x0e, 0x78, 0x00, 0x00, 0x0f, 0x00, 0x40, 0x01, 0x10, 0x00, 0x0f, 0x78,
+    0x00, 0x15, 0x02, 0x1e, 0x00, 0x10, 0x0f, 0x78, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x39, 0xf9, 0x01,
+    0xfe, 0x01, 0x14, 0x09, 0xef, 0x01, 0x11, 0x10, 0xfe, 0x01, 0x08, 0x0f, 0x00, 0x15, 0x65, 0x0f,
+    0x00, 0x01, 0x2d, 0x00, 0x17, 0x68, 0x0f, 0x00, 0x40, 0x11, 0x00, 0x22, 0x54, 0xe0, 0x90, 0x30,
+    0x02, 0x02, 0x10, 0x5a, 0x00, 0x44, 0x11, 0x00, 0x22, 0x57, 0x0f, 0x00, 0xd1, 0x01, 0x10, 0x00,
+    0x12, 0x00, 0x23, 0x9b, 0x0d, 0x00, 0x41, 0x5e, 0x71, 0x25, 0x5d, 0x05, 0x47, 0x13, 0x00, 0x23,
+    0x9e, 0x0f, 0x00, 0x1a, 0x14, 0x3c, 0x00, 0x1a, 0x14, 0x3c, 0x00, 0x30, 0x15, 0x00, 0x1a, 0x2c,
+    0x2e, 0x31, 0x60, 0x72, 0x26, 0xb7, 0x09, 0x47, 0x16, 0x00, 0x1a, 0x0a, 0x0f, 0x00, 0x1a, 0x17,
+    0x3c, 0x00, 0x1a, 0x17, 0x3c, 0x00, 0x1a, 0x18, 0x78, 0x00, 0x1a, 0x19, 0x78, 0x00, 0x1a, 0x1a,
+    0x3c, 0x00, 0x1a, 0x1a, 0x3c, 0x00, 0x1a, 0x1b, 0x78, 0x00, 0x1a, 0x1c, 0x78, 0x00, 0x22, 0x1d,
+    0x00, 0x00, 0x92, 0x03, 0x3c, 0x00, 0x22, 0x1d, 0x00, 0xff, 0x91, 0x03, 0x3c, 0x00, 0x38, 0x1e,
+    0x00, 0x33, 0x1e, 0x00, 0x38, 0x1e, 0x00, 0x33, 0x1e, 0x00, 0x11, 0x1f, 0x2a, 0x03, 0x23, 0x40,
+    0x6c, 0xd0, 0x02, 0x11, 0x1f, 0x2a, 0x03, 0x03, 0x0f, 0x00, 0x31, 0x50, 0x18, 0x1f, 0x2a, 0x03,
+    0x08, 0x1e, 0x00, 0x15, 0x74, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a, 0x77, 0x3c, 0x00, 0x15, 0x7a,
+    0x0f, 0x00, 0x01, 0x5a, 0x00, 0x1a, 0x7d, 0x3c, 0x00, 0x15, 0x80, 0x0f, 0x00, 0x01, 0x1e, 0x00,
+    0x13, 0x83, 0x2d, 0x00, 0x00, 0x01, 0x00, 0x11, 0x1f, 0x2a, 0x03, 0x08, 0x0f, 0x00, 0x14, 0x89,
+    0x1e, 0x00, 0x02, 0x3c, 0x00, 0x15, 0x8c, 0x0f, 0x00, 0x01, 0x78, 0x00, 0x14, 0x8f, 0x2d, 0x00,
+    0x02, 0x1e, 0x00, 0x15, 0x92, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0x1a, 0x95,
+    0x3c, 0x00, 0x17, 0x98, 0x3c, 0x00, 0x12, 0x21, 0xb2, 0x02, 0x31, 0x6e, 0xa4, 0x4b, 0x2c, 0x01,
+    0x12, 0x21, 0xb2, 0x02, 0x01, 0x0f, 0x00, 0x42, 0x01, 0x10, 0x00, 0x22, 0x2a, 0x03, 0x31, 0x6e,
+    0xa3, 0x4a, 0x1e, 0x00, 0x12, 0x22, 0x2a, 0x03, 0x01, 0x0f, 0x00, 0x4a, 0x01, 0x10, 0x00, 0x23,
+    0x3c, 0x00, 0x1a, 0x23, 0x3c, 0x00, 0x1a, 0x24, 0x3c, 0x00, 0x1a, 0x24, 0x3c, 0x00, 0x1a, 0x25,
+    0x27, 0x06, 0x1a, 0x25, 0x27, 0x06, 0x92, 0x26, 0x00, 0x23, 0xa7, 0x0d, 0x00, 0x97, 0xba, 0x69,
+    0x4a, 0x01, 0x45, 0x26, 0x00, 0x23, 0xaa, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0x27, 0x3c, 0x00, 0x1a,
+    0x27, 0x3c, 0x00, 0x31, 0x2e, 0x00, 0x33, 0x84, 0x03, 0x21, 0xa8, 0x4d, 0x78, 0x00, 0x31, 0x2e,
+    0x00, 0x33, 0x84, 0x03, 0x00, 0x0f, 0x00, 0x01, 0x89, 0x1d, 0x11, 0x33, 0xfc, 0x03, 0x03, 0x1e,
+    0x00, 0x31, 0x2f, 0x00, 0x33, 0xfc, 0x03, 0x03, 0x1e, 0x00, 0x47, 0x30, 0x00, 0x23, 0xb9, 0x1e,
+    0x00, 0x47, 0x30, 0x00, 0x23, 0xbc, 0x1e, 0x00, 0x47, 0x31, 0x00, 0x23, 0xbf, 0x1e, 0x00, 0x47,
+    0x31, 0x00, 0x23, 0xc2, 0x1e, 0x00, 0xe0, 0x37, 0x00, 0x22, 0xb6, 0x1a, 0x00, 0x00, 0x78, 0x82,
+    0x32, 0x00, 0x0b, 0x01, 0x00, 0x0f, 0x00, 0x32, 0xb8, 0x1a, 0x08, 0x0f, 0x00, 0x11, 0x02, 0x0f,
+    0x00, 0x1c, 0xba, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x4a, 0x02, 0x00, 0x00, 0x38, 0x3c, 0x00, 0x1a,
+    0x38, 0x3c, 0x00, 0x1a, 0x38, 0x3c, 0x00, 0x01, 0x1e, 0x00, 0x06, 0x3c, 0x00, 0x1a, 0x39, 0x3c,
+    0x00, 0x1a, 0x39, 0x3c, 0x00, 0x1a, 0x39, 0x3c, 0x00, 0x01, 0x1e, 0x00, 0x06, 0x3c, 0x00, 0x44,
+    0x3a, 0x00, 0x22, 0xbc, 0x2d, 0x00, 0x20, 0x0b, 0x10, 0x0f, 0x00, 0x14, 0xbe, 0x1e, 0x00, 0x74,
+    0x0b, 0x10, 0x00, 0x3b, 0x00, 0x22, 0xc0, 0x1e, 0x00, 0x22, 0x0a, 0x00, 0x0f, 0x00, 0x03, 0x1e,
+    0x00, 0x75, 0x0a, 0x00, 0x00, 0x3c, 0x00, 0x22, 0xc2, 0x2d, 0x00, 0x01, 0x0f, 0x00, 0x14, 0xc4,
+    0x2d, 0x00, 0x20, 0x01, 0x10, 0x0f, 0x00, 0x15, 0xc6, 0x78, 0x00, 0x01, 0x0f, 0x00, 0x1a, 0xc8,
+    0x2d, 0x00, 0x1a, 0xca, 0x2d, 0x00, 0x17, 0xcc, 0x2d, 0x00, 0x47, 0x3d, 0x00, 0x22, 0xce, 0x96,
+    0x00, 0x47, 0x3d, 0x00, 0x22, 0xd0, 0x96, 0x00, 0x92, 0x3e, 0x00, 0x22, 0xd2, 0x1a, 0x00, 0x00,
+    0x58, 0x68, 0x0d, 0x02, 0x47, 0x3e, 0x00, 0x22, 0xd4, 0x0f, 0x00, 0x92, 0x3f, 0x00, 0x23, 0xc5,
+    0x0d, 0x00, 0x47, 0x20, 0x6b, 0x3a, 0x02, 0x45, 0x3f, 0x00, 0x23, 0xc8, 0x0f, 0x00, 0x0f, 0x1e,
+    0x00, 0x0d, 0x1a, 0x40, 0x1e, 0x00, 0x1f, 0x40, 0x1e, 0x00, 0x19, 0x40, 0x41, 0x00, 0x11, 0x3e,
+    0xf2, 0x6b, 0x12, 0x6d, 0xcf, 0x03, 0x74, 0x42, 0x00, 0x23, 0xcb, 0x0d, 0x00, 0x3a, 0x2d, 0x00,
+    0x45, 0x42, 0x00, 0x23, 0xce, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x13, 0xd1, 0x0f, 0x00, 0x00,
+    0x93, 0x03, 0x45, 0x42, 0x00, 0x23, 0xd4, 0x0f, 0x00, 0x67, 0x10, 0x00, 0x43, 0x00, 0x23, 0xd7,
+    0x1e, 0x00, 0x45, 0x43, 0x00, 0x23, 0xda, 0x0f, 0x00, 0x31, 0x50, 0x18, 0x43, 0xa1, 0x04, 0x05,
+    0x5a, 0x00, 0x11, 0x43, 0xa1, 0x04, 0x03, 0x0f, 0x00, 0x3a, 0x50, 0x18, 0x44, 0x1e, 0x00, 0x1d,
+    0x44, 0x1e, 0x00, 0x08, 0x5a, 0x00, 0x1a, 0x44, 0x5a, 0x00, 0x1a, 0x45, 0x3c, 0x00, 0x1a, 0x45,
+    0x3c, 0x00, 0x1a, 0x45, 0x3c, 0x00, 0x1a, 0x45, 0x3c, 0x00, 0xa1, 0x47, 0x00, 0x14, 0x34, 0x05,
+    0x00, 0x00, 0x2a, 0x6e, 0x14, 0x9b, 0xca, 0x60, 0x47, 0x00, 0x14, 0x38, 0x05, 0x05, 0x0f, 0x00,
+    0x00, 0x92, 0x35, 0x78, 0x04, 0x47, 0x00, 0x14, 0x3c, 0x05, 0x04, 0x0f, 0x00, 0x12, 0x40, 0x2d,
+    0x00, 0x04, 0x0f, 0x00, 0x14, 0x44, 0x2d, 0x00, 0x75, 0x01, 0x00, 0x24, 0x47, 0x00, 0x14, 0x48,
+    0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x14, 0x4c, 0x5a, 0x00, 0x70, 0x01, 0x10, 0x00, 0x48, 0x00,
+    0x02, 0xd6, 0x9c, 0x21, 0x03, 0x37, 0x05, 0x40, 0x49, 0x00, 0x02, 0xd8, 0x0f, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x78, 0xa3, 0x30, 0x00, 0x02, 0xda, 0x0f, 0x00, 0x12, 0x7a, 0xdc, 0x0a, 0xa1, 0x4b,
+    0x00, 0x01, 0x09, 0x00, 0x00, 0x05, 0xae, 0xa0, 0x47, 0xa4, 0xa5, 0x11, 0x4c, 0x0f, 0x00, 0x23,
+    0x3f, 0x4a, 0x3c, 0x00, 0x11, 0x4d, 0x0f, 0x00, 0x14, 0x0c, 0x0f, 0x00, 0xa1, 0x4e, 0x00, 0x11,
+    0xec, 0x05, 0x00, 0x00, 0x2e, 0x56, 0x18, 0x86, 0x01, 0x80, 0x51, 0x00, 0x11, 0xf1, 0x16, 0x00,
+    0x00, 0x72, 0xa6, 0xaf, 0x42, 0x01, 0x10, 0x00, 0x52, 0x0f, 0x00, 0x31, 0x30, 0x57, 0x19, 0x0f,
+    0x00, 0x11, 0x53, 0x33, 0x00, 0x41, 0x80, 0xba, 0xaf, 0x50, 0x09, 0x00, 0x74, 0x54, 0x00, 0x01,
+    0xcf, 0x05, 0x00, 0x0e, 0x4b, 0x00, 0x80, 0x55, 0x00, 0x11, 0xc6, 0x1e, 0x00, 0x80, 0x2c, 0xea,
+    0xe3, 0x42, 0x01, 0x30, 0x00, 0x56, 0x65, 0x0b, 0x20, 0xba, 0x6a, 0x1e, 0x00, 0xc1, 0x20, 0x00,
+    0x57, 0x00, 0x01, 0xc7, 0x1e, 0x00, 0x00, 0xc2, 0xb3, 0x54, 0x17, 0x00, 0x12, 0x58, 0x5a, 0x00,
+    0x31, 0x32, 0x59, 0x1b, 0x5a, 0x00, 0x80, 0x59, 0x00, 0x11, 0xd9, 0x0e, 0x00, 0x00, 0x34, 0x50,
+    0x55, 0x00, 0xea, 0xa2, 0x64, 0x00, 0x01, 0xae, 0x00, 0x00, 0x21, 0x5a, 0x00, 0x92, 0x5b, 0x00,
+    0x23, 0xdd, 0x0d, 0x00, 0x1b, 0x36, 0x5b, 0xa4, 0x01, 0x45, 0x5b, 0x00, 0x23, 0xe0, 0x0f, 0x00,
+    0x31, 0x10, 0x00, 0x5c, 0x1e, 0x00, 0x14, 0x1d, 0x1e, 0x00, 0x11, 0x5c, 0x1e, 0x00, 0x03, 0x0f,
+    0x00, 0x31, 0x10, 0x00, 0x5d, 0x1e, 0x00, 0x14, 0x13, 0x1e, 0x00, 0x11, 0x5d, 0x1e, 0x00, 0x03,
+    0x0f, 0x00, 0x31, 0x10, 0x00, 0x5e, 0x1e, 0x00, 0x14, 0x16, 0x1e, 0x00, 0x11, 0x5e, 0x1e, 0x00,
+    0x03, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0x5f, 0x78, 0x00, 0x1a, 0x5f, 0x78, 0x00, 0x1a, 0x60, 0x78,
+    0x00, 0x1a, 0x60, 0x78, 0x00, 0x1a, 0x61, 0x78, 0x00, 0x1a, 0x61, 0x78, 0x00, 0x1a, 0x62, 0x78,
+    0x00, 0x1a, 0x62, 0x78, 0x00, 0x11, 0x63, 0x1e, 0x00, 0x14, 0x08, 0x1e, 0x00, 0x11, 0x63, 0x1e,
+    0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0x64, 0x1e, 0x00, 0x14, 0x18, 0x1e, 0x00, 0x11, 0x64,
+    0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0x65, 0x1e, 0x00, 0x14, 0x12, 0x1e, 0x00, 0x11,
+    0x65, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0x66, 0x1e, 0x00, 0x14, 0x14, 0x1e, 0x00,
+    0x11, 0x66, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0x67, 0x78, 0x00, 0x1a, 0x67, 0x78,
+    0x00, 0x1a, 0x68, 0x78, 0x00, 0x1a, 0x68, 0x78, 0x00, 0x1a, 0x69, 0x78, 0x00, 0x1a, 0x69, 0x78,
+    0x00, 0x1a, 0x6a, 0x78, 0x00, 0x1a, 0x6a, 0x78, 0x00, 0x47, 0x6b, 0x00, 0x23, 0xe3, 0x8b, 0x0b,
+    0x47, 0x6b, 0x00, 0x23, 0xe6, 0x8b, 0x0b, 0x11, 0x6b, 0x56, 0x04, 0x08, 0x1e, 0x00, 0x17, 0xce,
+    0x8b, 0x0b, 0x4a, 0x6b, 0x00, 0x23, 0xe9, 0x3c, 0x00, 0x1a, 0xec, 0x3c, 0x00, 0x1a, 0xef, 0x3c,
+    0x00, 0x1a, 0xf2, 0x3c, 0x00, 0x17, 0xf5, 0xc7, 0x0b, 0x47, 0x6b, 0x00, 0x23, 0xf8, 0xc7, 0x0b,
+    0x47, 0x6b, 0x00, 0x23, 0xfb, 0x8b, 0x0b, 0x45, 0x6b, 0x00, 0x23, 0xfe, 0x0f, 0x00, 0x01, 0x3c,
+    0x00, 0x26, 0x9d, 0x05, 0x8b, 0x0b, 0x45, 0x6b, 0x00, 0x23, 0xa1, 0x0f, 0x00, 0x01, 0x1e, 0x00,
+    0x0f, 0x3c, 0x00, 0x0b, 0x1a, 0xa5, 0x3c, 0x00, 0x17, 0xa9, 0x3c, 0x00, 0x56, 0x6c, 0x00, 0x33,
+    0x01, 0x0e, 0xc7, 0x0b, 0x44, 0x6c, 0x00, 0x33, 0x04, 0x0f, 0x00, 0x70, 0x01, 0x10, 0x00, 0x6d,
+    0x00, 0x33, 0x07, 0x0f, 0x00, 0x03, 0xc7, 0x0b, 0x44, 0x6d, 0x00, 0x33, 0x0a, 0x0f, 0x00, 0xb1,
+    0x01, 0x10, 0x00, 0x6e, 0x00, 0x03, 0x0d, 0x0e, 0x01, 0x2c, 0xb2, 0xc3, 0x00, 0x9f, 0x10, 0x03,
+    0x6e, 0x00, 0x04, 0x50, 0x05, 0x01, 0x29, 0x0f, 0x00, 0x04, 0x81, 0x6f, 0x00, 0x03, 0x10, 0x0e,
+    0x00, 0x2c, 0xb2, 0x47, 0x04, 0x00, 0x0f, 0x00, 0x5f, 0x04, 0x54, 0x05, 0x00, 0x29, 0x0f, 0x00,
+    0x06, 0x18, 0x33, 0x21, 0x0c, 0x38, 0x6f, 0x00, 0x33, 0x21, 0x0c, 0x40, 0x70, 0x00, 0x03, 0x19,
+    0x4b, 0x00, 0x01, 0x83, 0x04, 0x60, 0x10, 0x03, 0x70, 0x00, 0x04, 0x58, 0x3c, 0x00, 0x0f, 0x0f,
+    0x00, 0x03, 0x38, 0x71, 0x00, 0x33, 0x4e, 0x0c, 0x38, 0x71, 0x00, 0x33, 0x4e, 0x0c, 0x40, 0x72,
+    0x00, 0x03, 0x22, 0x4b, 0x00, 0x03, 0xa5, 0x00, 0x40, 0x72, 0x00, 0x04, 0x5c, 0x3c, 0x00, 0x0f,
+    0x0f, 0x00, 0x03, 0x92, 0x73, 0x00, 0x24, 0x60, 0x05, 0x01, 0x2b, 0xa2, 0x6d, 0xe0, 0x01, 0x45,
+    0x73, 0x00, 0x24, 0x64, 0x0f, 0x00, 0x88, 0x50, 0x18, 0x73, 0x00, 0x24, 0x68, 0x05, 0x00, 0x1e,
+    0x00, 0x15, 0x6c, 0x0f, 0x00, 0xc0, 0x50, 0x18, 0x74, 0x00, 0x16, 0x9d, 0x00, 0x06, 0x17, 0xa2,
+    0x5c, 0x2a, 0xcd, 0x05, 0x50, 0x00, 0x75, 0x00, 0x16, 0xa3, 0x0f, 0x00, 0x12, 0x8c, 0xdc, 0x05,
+    0x0b, 0x0f, 0x00, 0x21, 0x76, 0x00, 0xbc, 0x99, 0x04, 0xff, 0x00, 0x21, 0x76, 0x00, 0xbb, 0x99,
+    0x04, 0xff, 0x00, 0x21, 0x77, 0x00, 0xba, 0x99, 0x04, 0xd2, 0x00, 0x21, 0x77, 0x00, 0xb9, 0x99,
+    0x04, 0xd2, 0x00, 0x83, 0x78, 0x00, 0x04, 0x70, 0x05, 0x00, 0x00, 0x72, 0x26, 0x07, 0x47, 0x79,
+    0x00, 0x02, 0xdc, 0xaf, 0x05, 0xa1, 0x7a, 0x00, 0x22, 0xde, 0x1a, 0x00, 0x00, 0xb0, 0xa9, 0x4d,
+    0xa5, 0x00, 0x45, 0x7a, 0x00, 0x22, 0xe0, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x1a, 0xe2, 0x1e,
+    0x00, 0x17, 0xe4, 0x1e, 0x00, 0xb0, 0x7b, 0x00, 0x22, 0xe6, 0x1a, 0x02, 0x00, 0x3e, 0xa4, 0x4b,
+    0x14, 0x78, 0x00, 0x44, 0x7b, 0x00, 0x22, 0xe8, 0x0f, 0x00, 0x52, 0x01, 0x10, 0x00, 0x7c, 0x00,
+    0xf0, 0x99, 0x03, 0x49, 0x02, 0x22, 0x7c, 0x00, 0xdf, 0x99, 0x03, 0x49, 0x02, 0x42, 0x7d, 0x00,
+    0x22, 0xee, 0x2d, 0x00, 0x01, 0x1e, 0x00, 0x44, 0x7d, 0x00, 0x22, 0xf0, 0x0f, 0x00, 0x00, 0x44,
+    0x32, 0x32, 0x00, 0x22, 0xf2, 0x2d, 0x00, 0x20, 0x00, 0x03, 0x44, 0x32, 0x34, 0x00, 0x22, 0xf4,
+    0x0f, 0x00, 0x00, 0x44, 0x32, 0x12, 0x00, 0x0a, 0x99, 0x03, 0x3c, 0x00, 0x22, 0x7f, 0x00, 0xf9,
+    0x98, 0x03, 0x3c, 0x00, 0x43, 0x80, 0x00, 0x22, 0xfa, 0x2d, 0x00, 0x20, 0x04, 0x03, 0x07, 0x42,
+    0x02, 0x97, 0x9a, 0x00, 0x0f, 0x00, 0x00, 0x44, 0x32, 0x30, 0x00, 0x22, 0xfc, 0x0f, 0x00, 0x21,
+    0xa3, 0x4a, 0x1e, 0x00, 0x44, 0x81, 0x00, 0x22, 0xfe, 0x0f, 0x00, 0x00, 0x44, 0x32, 0x12, 0x00,
+    0x24, 0x96, 0x03, 0x5a, 0x00, 0x22, 0x82, 0x00, 0x13, 0x96, 0x03, 0x5a, 0x00, 0x22, 0x83, 0x00,
+    0xc2, 0x98, 0x03, 0x86, 0x01, 0x22, 0x83, 0x00, 0xb1, 0x98, 0x03, 0x86, 0x01, 0x40, 0x84, 0x00,
+    0x22, 0x08, 0x0f, 0x00, 0x21, 0xa3, 0x4a, 0xb4, 0x00, 0x44, 0x84, 0x00, 0x22, 0x0a, 0x0f, 0x00,
+    0x00, 0x62, 0x32, 0x41, 0x00, 0x22, 0x0c, 0x1b, 0xe1, 0x00, 0x10, 0x0c, 0xde, 0x5b, 0x4a, 0x85,
+    0x00, 0x22, 0x0e, 0x0f, 0x00, 0x14, 0x10, 0x0f, 0x00, 0x02, 0x2d, 0x00, 0x17, 0x12, 0x0f, 0x00,
+    0x43, 0x86, 0x00, 0x22, 0x14, 0x0f, 0x00, 0x00, 0x78, 0x00, 0x44, 0x86, 0x00, 0x22, 0x16, 0x0f,
+    0x00, 0x00, 0x9e, 0x32, 0x35, 0x00, 0x22, 0x18, 0x0f, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x1a, 0x1a,
+    0x0f, 0x00, 0x1a, 0x1c, 0x2d, 0x00, 0x17, 0x1e, 0x0f, 0x00, 0x40, 0x88, 0x00, 0x22, 0x20, 0x0f,
+    0x00, 0x01, 0x2b, 0x02, 0x10, 0x00, 0x0f, 0x00, 0x1a, 0x22, 0x0f, 0x00, 0x15, 0x24, 0x0f, 0x00,
+    0x01, 0x2d, 0x00, 0x17, 0x26, 0x0f, 0x00, 0x47, 0x89, 0x00, 0x22, 0x28, 0x96, 0x00, 0x47, 0x89,
+    0x00, 0x22, 0x2a, 0x5a, 0x00, 0x43, 0x8a, 0x00, 0x22, 0x2c, 0x2d, 0x00, 0x00, 0xe1, 0x00, 0x4a,
+    0x8a, 0x00, 0x22, 0x2e, 0x0f, 0x00, 0x14, 0x30, 0x0f, 0x00, 0x02, 0x2d, 0x00, 0x17, 0x32, 0x0f,
+    0x00, 0x10, 0x8b, 0x1c, 0x02, 0x06, 0x86, 0x01, 0x10, 0x8b, 0x1c, 0x02, 0x06, 0x86, 0x01, 0x1a,
+    0x8c, 0x1c, 0x02, 0x1a, 0x8c, 0x1c, 0x02, 0x10, 0x8d, 0xc2, 0x01, 0x06, 0x58, 0x02, 0x10, 0x8d,
+    0xc2, 0x01, 0x06, 0x58, 0x02, 0x47, 0x8e, 0x00, 0x22, 0x34, 0xa4, 0x01, 0x47, 0x8e, 0x00, 0x22,
+    0x36, 0xa4, 0x01, 0x1a, 0x8f, 0xa4, 0x01, 0x1a, 0x8f, 0xa4, 0x01, 0x1a, 0x8f, 0xa4, 0x01, 0x1a,
+    0x8f, 0xa4, 0x01, 0x1a, 0x90, 0xf0, 0x00, 0x1a, 0x90, 0xf0, 0x00, 0x1a, 0x90, 0xf0, 0x00, 0x1a,
+    0x90, 0xf0, 0x00, 0x40, 0x91, 0x00, 0x02, 0x38, 0x87, 0x00, 0x03, 0xfa, 0x05, 0x40, 0x92, 0x00,
+    0x02, 0x3a, 0x0f, 0x00, 0x03, 0x60, 0x09, 0x74, 0x93, 0x00, 0x02, 0x3c, 0x1b, 0x00, 0x23, 0xbf,
+    0x13, 0x1a, 0x94, 0x0f, 0x00, 0x74, 0x95, 0x00, 0x12, 0x3e, 0x1b, 0x00, 0x1a, 0x36, 0x06, 0x62,
+    0x95, 0x00, 0x12, 0x40, 0x1b, 0x01, 0x0f, 0x00, 0x11, 0x01, 0x0f, 0x00, 0x15, 0x42, 0x0f, 0x00,
+    0x64, 0x50, 0x18, 0x95, 0x00, 0x12, 0x44, 0x2d, 0x00, 0x02, 0x1e, 0x00, 0x15, 0x46, 0x0f, 0x00,
+    0x94, 0x50, 0x18, 0x97, 0x00, 0x13, 0x31, 0x0e, 0x01, 0x48, 0x1e, 0x00, 0x45, 0x97, 0x00, 0x13,
+    0x34, 0x0f, 0x00, 0x87, 0x10, 0x00, 0x97, 0x00, 0x14, 0x74, 0x05, 0x00, 0x1e, 0x00, 0x25, 0x14,
+    0x78, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0x98, 0xfd, 0x11, 0x1a, 0x98, 0xfd, 0x11, 0x1a, 0x99, 0xfd,
+    0x11, 0x1a, 0x99, 0xfd, 0x11, 0x1a, 0x9a, 0xfd, 0x11, 0x1a, 0x9a, 0xfd, 0x11, 0x1a, 0x9b, 0xfd,
+    0x11, 0x1a, 0x9b, 0xfd, 0x11, 0x15, 0x9c, 0x79, 0x0e, 0x01, 0x5a, 0x00, 0x15, 0x9c, 0x79, 0x0e,
+    0x01, 0x5a, 0x00, 0x15, 0x9d, 0x79, 0x0e, 0x01, 0x1e, 0x00, 0x15, 0x9d, 0x79, 0x0e, 0x01, 0x1e,
+    0x00, 0x12, 0x9e, 0x23, 0x0a, 0x31, 0x74, 0x8b, 0x2d, 0x7f, 0x15, 0xa1, 0x9f, 0x00, 0x04, 0x7c,
+    0x05, 0x17, 0x80, 0xa8, 0x9d, 0x44, 0x32, 0x0a, 0x47, 0x9f, 0x00, 0x04, 0x80, 0x0f, 0x00, 0x18,
+    0xa0, 0x1e, 0x00, 0x00, 0xa5, 0xb6, 0x07, 0x1e, 0x00, 0x60, 0x00, 0x00, 0xa1, 0x00, 0x04, 0x84,
+    0x0f, 0x00, 0x10, 0x9e, 0x21, 0x41, 0x01, 0x0f, 0x00, 0x17, 0x88, 0x0f, 0x00, 0x70, 0xa2, 0x00,
+    0x29, 0x32, 0x00, 0x00, 0x42, 0x85, 0x11, 0x00, 0x46, 0x05, 0x47, 0xa3, 0x00, 0x2a, 0x14, 0x0f,
+    0x00, 0x12, 0xa4, 0x87, 0x00, 0x01, 0xb9, 0x0a, 0x4a, 0x00, 0x00, 0x00, 0xa5, 0x0f, 0x00, 0xa1,
+    0xa6, 0x00, 0x23, 0x37, 0x0e, 0x00, 0x41, 0x44, 0x5d, 0x1d, 0x73, 0x05, 0x1a, 0xa7, 0x0f, 0x00,
+    0x92, 0xa8, 0x00, 0x25, 0xe5, 0x00, 0x04, 0x00, 0x72, 0x68, 0xfe, 0x01, 0x40, 0xa9, 0x00, 0x33,
+    0x3a, 0x8f, 0x07, 0x30, 0xa8, 0x4d, 0x14, 0xc0, 0x03, 0x45, 0xa9, 0x00, 0x33, 0x3d, 0x0f, 0x00,
+    0xc1, 0x10, 0x00, 0xaa, 0x00, 0x33, 0x40, 0x0e, 0x00, 0x00, 0x20, 0xaa, 0x4e, 0x0c, 0x43, 0x52,
+    0xaa, 0x00, 0x22, 0x48, 0x1b, 0x0f, 0x00, 0x00, 0x1d, 0x01, 0xa1, 0xab, 0x00, 0x02, 0x47, 0x0e,
+    0x00, 0x03, 0xd8, 0xba, 0x5b, 0x4b, 0x00, 0x1a, 0xac, 0x0f, 0x00, 0x44, 0xad, 0x00, 0x23, 0x43,
+    0x0f, 0x00, 0x10, 0x02, 0x0f, 0x00, 0x24, 0x13, 0x46, 0x0f, 0x00, 0x20, 0x01, 0x10, 0x1e, 0x00,
+    0x1a, 0x49, 0x1e, 0x00, 0x17, 0x4c, 0x1e, 0x00, 0x1a, 0xae, 0x1e, 0x00, 0x47, 0xaf, 0x00, 0x13,
+    0x4f, 0x1e, 0x00, 0x47, 0xb0, 0x00, 0x13, 0x52, 0x0f, 0x00, 0x1a, 0xb1, 0x78, 0x00, 0x92, 0xb2,
+    0x00, 0x24, 0x8c, 0x05, 0x00, 0x1c, 0x48, 0x60, 0x3c, 0x00, 0x11, 0xb3, 0x0f, 0x00, 0x14, 0x1e,
+    0x0f, 0x00, 0x11, 0xb4, 0x0f, 0x00, 0x14, 0x15, 0x0f, 0x00, 0x1a, 0xb5, 0x2d, 0x00, 0x1a, 0xb6,
+    0x2d, 0x00, 0x1a, 0xb7, 0x2d, 0x00, 0x11, 0xb8, 0x0f, 0x00, 0x14, 0x19, 0x0f, 0x00, 0x1a, 0xb9,
+    0x0f, 0x00, 0x74, 0xba, 0x00, 0x13, 0x55, 0x0e, 0x00, 0x01, 0xb4, 0x00, 0x44, 0xba, 0x00, 0x13,
+    0x58, 0x0f, 0x00, 0x2f, 0x01, 0x10, 0x1e, 0x00, 0x00, 0x17, 0x5b, 0x1e, 0x00, 0x92, 0xbb, 0x00,
+    0x24, 0x90, 0x05, 0x00, 0x34, 0xd8, 0x61, 0x1e, 0x00, 0x1a, 0xbc, 0x0f, 0x00, 0x1a, 0xbd, 0x3c,
+    0x00, 0x1a, 0xbd, 0x5a, 0x00, 0x0e, 0x1e, 0x00, 0x08, 0x5a, 0x00, 0x0b, 0x1e, 0x00, 0x44, 0xbe,
+    0x00, 0x03, 0x5e, 0x0f, 0x00, 0x00, 0x41, 0x62, 0x01, 0x3b, 0x01, 0x14, 0x02, 0x0f, 0x00, 0x56,
+    0xc0, 0x00, 0x01, 0x8f, 0x05, 0x4a, 0x01, 0x01, 0xa3, 0x42, 0x24, 0x00, 0x00, 0x0f, 0x00, 0x1a,
+    0xc2, 0xd1, 0x01, 0x1a, 0xc2, 0xd1, 0x01, 0x1a, 0xc2, 0xb3, 0x01, 0x1a, 0xc2, 0xd1, 0x01, 0x1a,
+    0xc3, 0x1e, 0x00, 0x1a, 0xc4, 0x4b, 0x00, 0x1a, 0xc4, 0x4b, 0x00, 0x1c, 0xc4, 0x2d, 0x00, 0x09,
+    0x4b, 0x00, 0x1a, 0xc5, 0x1e, 0x00, 0x13, 0xc6, 0x93, 0x03, 0x00, 0x9b, 0x07, 0x4a, 0x00, 0x02,
+    0x00, 0xc7, 0xb4, 0x00, 0x74, 0xc8, 0x00, 0x12, 0x44, 0x0e, 0x00, 0x04, 0x2d, 0x00, 0x1a, 0xc9,
+    0x0f, 0x00, 0x47, 0xca, 0x00, 0x13, 0x61, 0x5a, 0x00, 0x47, 0xca, 0x00, 0x13, 0x64, 0x0f, 0x00,
+    0x47, 0xcb, 0x00, 0x13, 0x67, 0x4a, 0x01, 0x47, 0xcb, 0x00, 0x13, 0x6a, 0x0f, 0x00, 0x1a, 0xcc,
+    0x1e, 0x00, 0x1a, 0xcc, 0x1e, 0x00, 0x1a, 0xcd, 0x5a, 0x00, 0x1a, 0xcd, 0x5a, 0x00, 0x1a, 0xce,
+    0x1e, 0x00, 0x1a, 0xce, 0x1e, 0x00, 0x4a, 0xcf, 0x00, 0x13, 0x6d, 0x0f, 0x00, 0x1a, 0x70, 0x0f,
+    0x00, 0x17, 0x73, 0x0f, 0x00, 0x1a, 0xd0, 0x4b, 0x00, 0x1a, 0xd0, 0x4b, 0x00, 0x1a, 0xd1, 0xd1,
+    0x01, 0x47, 0xd2, 0x00, 0x13, 0x76, 0x1e, 0x00, 0x47, 0xd2, 0x00, 0x13, 0x79, 0x0f, 0x00, 0x1a,
+    0xd3, 0x1e, 0x00, 0x1d, 0xd3, 0x1e, 0x00, 0x17, 0x7c, 0x0f, 0x00, 0x13, 0xd4, 0x2d, 0x00, 0x24,
+    0xa6, 0x4c, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x15, 0xa7, 0x0f, 0x00, 0x01, 0x3c, 0x00, 0x03, 0x0f,
+    0x00, 0x1a, 0xd5, 0xa5, 0x00, 0x1a, 0xd5, 0xa5, 0x00, 0x1a, 0xd6, 0x1e, 0x00, 0x1a, 0xd6, 0x1e,
+    0x00, 0x47, 0xd7, 0x00, 0x13, 0x7f, 0xef, 0x01, 0x4a, 0xd7, 0x00, 0x13, 0x82, 0x1e, 0x00, 0x1a,
+    0x85, 0x0f, 0x00, 0x17, 0x88, 0x0f, 0x00, 0x47, 0xd8, 0x00, 0x02, 0x50, 0x1a, 0x04, 0x53, 0xd9,
+    0x00, 0x12, 0x4a, 0x1b, 0xfe, 0x01, 0x86, 0x01, 0x10, 0x00, 0xda, 0x00, 0x12, 0x4c, 0x1b, 0xb3,
+    0x01, 0x47, 0xda, 0x00, 0x12, 0x4e, 0x0f, 0x00, 0x1a, 0xdb, 0x3c, 0x00, 0x1a, 0xdc, 0x0f, 0x00,
+    0x1a, 0xdd, 0x0f, 0x00, 0x1a, 0xde, 0x0f, 0x00, 0x1a, 0xdf, 0x0f, 0x00, 0x1a, 0xe0, 0x0f, 0x00,
+    0x1a, 0xe1, 0xfd, 0x02, 0x1a, 0xe1, 0xfd, 0x02, 0x1a, 0xe1, 0xdf, 0x02, 0x1a, 0xe1, 0xfd, 0x02,
+    0x1a, 0xe2, 0x1e, 0x00, 0x11, 0xe3, 0xe0, 0x01, 0x02, 0xd2, 0x00, 0x41, 0x00, 0x00, 0x00, 0xe4,
+    0x0f, 0x00, 0x03, 0xde, 0x03, 0x3a, 0x02, 0x00, 0xe5, 0x0c, 0x03, 0x45, 0xe6, 0x00, 0x12, 0x50,
+    0xe1, 0x00, 0x10, 0x13, 0x0f, 0x00, 0x17, 0x52, 0x0f, 0x00, 0x47, 0xe7, 0x00, 0x12, 0x54, 0x1d,
+    0x01, 0x4a, 0xe8, 0x00, 0x12, 0x56, 0x0f, 0x00, 0x17, 0x58, 0x0f, 0x00, 0x1a, 0xe9, 0x2d, 0x00,
+    0x44, 0xe9, 0x00, 0x12, 0x5a, 0x0f, 0x00, 0x77, 0x00, 0x00, 0x00, 0xea, 0x00, 0x03, 0x8b, 0xf0,
+    0x00, 0x47, 0xeb, 0x00, 0x03, 0x8e, 0x74, 0x04, 0x1a, 0xec, 0x0f, 0x00, 0x47, 0xed, 0x00, 0x03,
+    0x91, 0x83, 0x04, 0x1a, 0xee, 0xcd, 0x05, 0x45, 0xef, 0x00, 0x12, 0x5c, 0xa5, 0x00, 0x10, 0x12,
+    0x0f, 0x00, 0x17, 0x5e, 0x0f, 0x00, 0x11, 0xf0, 0x4b, 0x00, 0x05, 0x2d, 0x00, 0x1a, 0xf1, 0xf0,
+    0x00, 0x1a, 0xf2, 0xdd, 0x04, 0x1a, 0xf3, 0x69, 0x00, 0x1a, 0xf4, 0x69, 0x00, 0x47, 0xf5, 0x00,
+    0x13, 0x94, 0x68, 0x01, 0x47, 0xf5, 0x00, 0x13, 0x97, 0x68, 0x01, 0x47, 0xf5, 0x00, 0x13, 0x9a,
+    0x1e, 0x00, 0x1a, 0xf6, 0x2d, 0x00, 0x4a, 0xf6, 0x00, 0x13, 0x9d, 0x0f, 0x00, 0x08, 0x3c, 0x00,
+    0x1d, 0xf6, 0x3c, 0x00, 0x0b, 0x1e, 0x00, 0x08, 0x0f, 0x00, 0x1a, 0xf7, 0x0f, 0x00, 0x1a, 0xf8,
+    0x2b, 0x02, 0x1a, 0xf8, 0x2b, 0x02, 0x1a, 0xf8, 0x0d, 0x02, 0x1a, 0xf8, 0x2b, 0x02, 0x1a, 0xf9,
+    0x1e, 0x00, 0x1a, 0xfa, 0x4b, 0x00, 0x1a, 0xfa, 0x4b, 0x00, 0x1c, 0xfa, 0x2d, 0x00, 0x09, 0x4b,
+    0x00, 0x1a, 0xfb, 0x1e, 0x00, 0x11, 0xfc, 0x3b, 0x01, 0x05, 0xc2, 0x01, 0x1a, 0xfd, 0x63, 0x06,
+    0x1a, 0xfe, 0xbd, 0x06, 0x1a, 0xff, 0x0f, 0x00, 0x47, 0x00, 0x01, 0x23, 0xa0, 0x2d, 0x00, 0x29,
+    0x01, 0x01, 0x90, 0x06, 0x12, 0x02, 0x7e, 0x47, 0x04, 0x0f, 0x00, 0x29, 0x03, 0x01, 0x69, 0x00,
+    0x47, 0x04, 0x01, 0x13, 0xa3, 0x87, 0x00, 0x0f, 0x0f, 0x00, 0x0b, 0xf3, 0x01, 0x05, 0x01, 0x11,
+    0xc8, 0x1e, 0x00, 0x00, 0xb0, 0x64, 0x4a, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x06, 0x0f, 0x00, 0x12,
+    0x65, 0x0f, 0x00, 0x45, 0x07, 0x01, 0x11, 0xc9, 0x1e, 0x00, 0x33, 0x15, 0x00, 0x08, 0x0f, 0x00,
+    0x01, 0x1e, 0x00, 0x40, 0x15, 0x00, 0x09, 0x01, 0x2b, 0x02, 0x05, 0x1c, 0x02, 0x29, 0x0a, 0x01,
+    0xd0, 0x02, 0x1a, 0x0b, 0x0f, 0x00, 0xa1, 0x0c, 0x01, 0x02, 0x60, 0x1b, 0x00, 0x80, 0xba, 0xa1,
+    0x48, 0x0f, 0x00, 0xa1, 0x0d, 0x01, 0x33, 0xa6, 0x0e, 0x00, 0x00, 0x52, 0x66, 0x21, 0x7e, 0x18,
+    0x44, 0x0d, 0x01, 0x33, 0xa9, 0x0f, 0x00, 0x00, 0x7a, 0x1c, 0x0a, 0x1e, 0x00, 0x1a, 0x0e, 0x1e,
+    0x00, 0x56, 0x0f, 0x01, 0x22, 0x2d, 0x0f, 0x1e, 0x00, 0x44, 0x0f, 0x01, 0x22, 0x30, 0x0f, 0x00,
+    0x00, 0x4d, 0x1c, 0x19, 0x01, 0xb6, 0x1c, 0x29, 0x10, 0x01, 0xb6, 0x1c, 0x29, 0x11, 0x01, 0xb6,
+    0x1c, 0x29, 0x11, 0x01, 0xb6, 0x1c, 0x12, 0x12, 0x59, 0x01, 0x11, 0xba, 0xf4, 0x0b, 0xc1, 0x20,
+    0x00, 0x13, 0x01, 0x12, 0x62, 0x1b, 0x00, 0x00, 0x54, 0x67, 0x22, 0x0f, 0x00, 0x1a, 0x14, 0x5a,
+    0x00, 0x1a, 0x14, 0x5a, 0x00, 0x1a, 0x15, 0x5a, 0x00, 0x1a, 0x15, 0x5a, 0x00, 0x47, 0x16, 0x01,
+    0x13, 0xac, 0x03, 0x0c, 0x47, 0x16, 0x01, 0x13, 0xaf, 0x03, 0x0c, 0x47, 0x16, 0x01, 0x14, 0x94,
+    0x03, 0x0c, 0x47, 0x16, 0x01, 0x14, 0x98, 0x03, 0x0c, 0x81, 0x17, 0x01, 0x34, 0x9c, 0x05, 0x00,
+    0x3e, 0x1e, 0x15, 0x18, 0x10, 0x00, 0x0f, 0x00, 0x15, 0xa0, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a,
+    0xa4, 0x1e, 0x00, 0x19, 0xa8, 0x1e, 0x00, 0x54, 0x14, 0xac, 0x05, 0x01, 0x3e, 0x5a, 0x00, 0x45,
+    0x17, 0x01, 0x14, 0xb0, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x10, 0xb4, 0x2d, 0x00, 0x06, 0x1e, 0x00,
+    0x15, 0xb8, 0x0f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x02, 0x1c, 0x01, 0x0f, 0x00, 0x02, 0x5a, 0x00,
+    0x00, 0x02, 0x1c, 0x03, 0x0f, 0x00, 0xa3, 0x10, 0x00, 0x18, 0x01, 0x23, 0xb2, 0x0e, 0x01, 0x07,
+    0x5a, 0x20, 0x0d, 0x68, 0x18, 0x01, 0x23, 0xb5, 0x0e, 0x03, 0x0f, 0x00, 0x1a, 0xb8, 0x0f, 0x00,
+    0x1a, 0xbb, 0x2d, 0x00, 0x1a, 0xbe, 0x1e, 0x00, 0x17, 0xc1, 0x0f, 0x00, 0x29, 0x19, 0x01, 0x7a,
+    0x0d, 0x29, 0x19, 0x01, 0x7a, 0x0d, 0x29, 0x19, 0x01, 0x7a, 0x0d, 0x29, 0x19, 0x01, 0x7a, 0x0d,
+    0x29, 0x19, 0x01, 0x7a, 0x0d, 0x54, 0x1a, 0x01, 0x11, 0x15, 0x00, 0xbc, 0x16, 0x73, 0x00, 0x00,
+    0x1b, 0x01, 0x11, 0xca, 0x1e, 0x03, 0x0c, 0xb1, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x03, 0xc4, 0x0e,
+    0x01, 0x0b, 0x5c, 0xe5, 0x0b, 0x7f, 0x80, 0x02, 0x1c, 0x01, 0x04, 0xbc, 0x05, 0x0f, 0x00, 0x06,
+    0x81, 0x1d, 0x01, 0x03, 0xc7, 0x0e, 0x00, 0x0b, 0x5c, 0x3d, 0x0e, 0x0f, 0x0f, 0x00, 0x00, 0x3f,
+    0x04, 0xc0, 0x05, 0x0f, 0x00, 0x24, 0x24, 0x1e, 0x01, 0x4d, 0x0d, 0x01, 0xee, 0x11, 0x47, 0x1e,
+    0x01, 0x33, 0xca, 0x5d, 0x0c, 0x56, 0x1f, 0x01, 0x44, 0xc4, 0x05, 0x4e, 0x0c, 0x29, 0x1f, 0x01,
+    0x5d, 0x0c, 0x40, 0x20, 0x01, 0x03, 0xcd, 0x87, 0x00, 0x03, 0xa5, 0x00, 0x40, 0x20, 0x01, 0x04,
+    0xc8, 0x5a, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x83, 0x21, 0x01, 0x13, 0xd0, 0x0e, 0x00, 0x11, 0x58,
+    0x59, 0x01, 0x30, 0x22, 0x01, 0x01, 0x08, 0x0a, 0x04, 0x0f, 0x00, 0x47, 0x23, 0x01, 0x02, 0xd1,
+    0x1e, 0x00, 0x74, 0x24, 0x01, 0x02, 0x64, 0x1b, 0x00, 0x10, 0x0f, 0x00, 0x13, 0x25, 0x1b, 0x03,
+    0x01, 0xed, 0x12, 0xf0, 0x01, 0x20, 0x00, 0x26, 0x01, 0x23, 0xd3, 0x0e, 0x07, 0x37, 0xd0, 0xb7,
+    0x58, 0x00, 0x01, 0x01, 0x30, 0x0f, 0x00, 0x44, 0xd6, 0x0e, 0x07, 0xb7, 0x0f, 0x00, 0x62, 0x27,
+    0x01, 0x11, 0xec, 0x05, 0x01, 0x2d, 0x00, 0x70, 0x01, 0x30, 0x00, 0x28, 0x01, 0x22, 0x66, 0xfc,
+    0x03, 0x01, 0x60, 0x18, 0x50, 0x20, 0x00, 0x29, 0x01, 0x33, 0x15, 0x18, 0x20, 0xba, 0x05, 0x7e,
+    0xb3, 0xc1, 0x20, 0x00, 0x2a, 0x01, 0x22, 0xd3, 0x0e, 0x07, 0x00, 0x72, 0x70, 0x24, 0x3c, 0x00,
+    0x47, 0x2a, 0x01, 0x22, 0xd6, 0x0f, 0x00, 0x1a, 0x2b, 0x69, 0x00, 0x1a, 0x2b, 0x69, 0x00, 0x80,
+    0x2c, 0x01, 0x04, 0xcc, 0x05, 0x00, 0x2d, 0x9a, 0xa5, 0x00, 0x43, 0x60, 0x00, 0x00, 0x2d, 0x0f,
+    0x00, 0x00, 0x59, 0x01, 0x70, 0x60, 0x00, 0x00, 0x2e, 0x01, 0x04, 0xd0, 0x0f, 0x00, 0x00, 0x92,
+    0x13, 0xd0, 0x60, 0x00, 0x00, 0x2f, 0x01, 0x13, 0xdc, 0x0e, 0x05, 0x1b, 0x3a, 0x6e, 0x14, 0xcc,
+    0x00, 0x78, 0x84, 0x2f, 0x01, 0x13, 0xdf, 0x0e, 0x00, 0x0f, 0x00, 0x12, 0xe2, 0x1e, 0x00, 0x00,
+    0x80, 0x05, 0x00, 0x0f, 0x00, 0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00, 0x01,
+    0x0f, 0x00, 0x11, 0x30, 0x4b, 0x00, 0x14, 0x1d, 0x3c, 0x00, 0x11, 0x30, 0x4b, 0x00, 0x08, 0x0f,
+    0x00, 0x12, 0xe2, 0x1e, 0x00, 0x04, 0x2d, 0x00, 0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12, 0xe8,
+    0x2d, 0x00, 0x01, 0x0f, 0x00, 0x91, 0x31, 0x01, 0x13, 0xeb, 0x0e, 0x00, 0x00, 0x3a, 0x6b, 0x3c,
+    0x00, 0x78, 0x00, 0x32, 0x01, 0x13, 0xee, 0x0e, 0x05, 0x0f, 0x00, 0x17, 0xf1, 0x1e, 0x00, 0x11,
+    0x35, 0x78, 0x00, 0x14, 0x13, 0x69, 0x00, 0x11, 0x35, 0x78, 0x00, 0x08, 0x0f, 0x00, 0x12, 0xe2,
+    0x1e, 0x00, 0x01, 0x5a, 0x00, 0x11, 0x35, 0x78, 0x00, 0x08, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00,
+    0x01, 0x0f, 0x00, 0x11, 0x36, 0x4b, 0x00, 0x14, 0x16, 0x3c, 0x00, 0x11, 0x36, 0x4b, 0x00, 0x08,
+    0x0f, 0x00, 0x12, 0xe2, 0x1e, 0x00, 0x04, 0x2d, 0x00, 0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12,
+    0xe8, 0x2d, 0x00, 0x01, 0x0f, 0x00, 0x30, 0x37, 0x01, 0x12, 0x21, 0x1b, 0x13, 0xc4, 0x03, 0x1b,
+    0x30, 0x37, 0x01, 0x12, 0x21, 0x1b, 0x07, 0x0f, 0x00, 0x00, 0x21, 0x1b, 0x07, 0x0f, 0x00, 0x00,
+    0x5d, 0x1b, 0x13, 0xc4, 0x5d, 0x1b, 0x51, 0x37, 0x01, 0x12, 0xdc, 0x0e, 0x3c, 0x00, 0x01, 0xe1,
+    0x00, 0x51, 0x37, 0x01, 0x12, 0xdf, 0x0e, 0x1e, 0x00, 0x04, 0x0f, 0x00, 0x23, 0x68, 0x1b, 0x5a,
+    0x00, 0x75, 0x01, 0x00, 0x24, 0x37, 0x01, 0x12, 0x6a, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x00,
+    0x4e, 0x1b, 0x01, 0x4b, 0x00, 0x00, 0x4b, 0x33, 0x0a, 0xe0, 0x01, 0x1a, 0x38, 0xe0, 0x01, 0x1a,
+    0x38, 0xe0, 0x01, 0x1a, 0x38, 0xe0, 0x01, 0x1a, 0x38, 0xe0, 0x01, 0x1a, 0x39, 0xe0, 0x01, 0x1a,
+    0x39, 0xe0, 0x01, 0x1a, 0x39, 0xe0, 0x01, 0x1a, 0x39, 0xe0, 0x01, 0x1a, 0x39, 0xe0, 0x01, 0x1a,
+    0x3a, 0xb3, 0x01, 0x1a, 0x3a, 0xb3, 0x01, 0x1a, 0x3a, 0xb3, 0x01, 0x1a, 0x3a, 0xb3, 0x01, 0x1a,
+    0x3a, 0xb3, 0x01, 0x1a, 0x3b, 0xb3, 0x01, 0x1a, 0x3b, 0xb3, 0x01, 0x1a, 0x3b, 0xb3, 0x01, 0x1a,
+    0x3b, 0xb3, 0x01, 0x1a, 0x3b, 0xb3, 0x01, 0x11, 0x3c, 0x4b, 0x00, 0x14, 0x08, 0x3c, 0x00, 0x11,
+    0x3c, 0x4b, 0x00, 0x08, 0x0f, 0x00, 0x12, 0xe2, 0x1e, 0x00, 0x04, 0x2d, 0x00, 0x38, 0xe5, 0x0e,
+    0x04, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00, 0x01, 0x0f, 0x00, 0x11, 0x3d, 0x4b, 0x00, 0x14, 0x18,
+    0x3c, 0x00, 0x11, 0x3d, 0x4b, 0x00, 0x08, 0x0f, 0x00, 0x12, 0xe2, 0x1e, 0x00, 0x04, 0x2d, 0x00,
+    0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00, 0x01, 0x0f, 0x00, 0x11, 0x3e, 0x4b,
+    0x00, 0x14, 0x12, 0x3c, 0x00, 0x11, 0x3e, 0x4b, 0x00, 0x08, 0x0f, 0x00, 0x12, 0xe2, 0x1e, 0x00,
+    0x04, 0x2d, 0x00, 0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00, 0x01, 0x0f, 0x00,
+    0x11, 0x3f, 0x4b, 0x00, 0x14, 0x14, 0x3c, 0x00, 0x11, 0x3f, 0x4b, 0x00, 0x08, 0x0f, 0x00, 0x12,
+    0xe2, 0x1e, 0x00, 0x04, 0x2d, 0x00, 0x38, 0xe5, 0x0e, 0x04, 0x0f, 0x00, 0x12, 0xe8, 0x2d, 0x00,
+    0x01, 0x0f, 0x00, 0x1a, 0x40, 0x2c, 0x01, 0x1a, 0x40, 0x2c, 0x01, 0x1a, 0x40, 0x2c, 0x01, 0x1a,
+    0x40, 0x2c, 0x01, 0x1a, 0x40, 0x2c, 0x01, 0x1a, 0x41, 0x2c, 0x01, 0x1a, 0x41, 0x2c, 0x01, 0x1a,
+    0x41, 0x2c, 0x01, 0x1a, 0x41, 0x2c, 0x01, 0x1a, 0x41, 0x2c, 0x01, 0x40, 0x42, 0x01, 0x13, 0xf4,
+    0x29, 0x04, 0x12, 0x7a, 0x2a, 0x03, 0x1a, 0x43, 0x3b, 0x01, 0x1a, 0x43, 0x3b, 0x01, 0x1a, 0x43,
+    0x3b, 0x01, 0x1a, 0x43, 0x3b, 0x01, 0x1a, 0x43, 0x3b, 0x01, 0x1a, 0x44, 0x3b, 0x01, 0x1a, 0x44,
+    0x3b, 0x01, 0x1a, 0x44, 0x3b, 0x01, 0x1a, 0x44, 0x3b, 0x01, 0x1a, 0x44, 0x3b, 0x01, 0x92, 0x86,
+    0x01, 0x02, 0x6c, 0x1b, 0x00, 0x1f, 0x4a, 0x79, 0x45, 0x06, 0x56, 0x87, 0x01, 0x23, 0xf7, 0x0e,
+    0x0a, 0x23, 0x45, 0x87, 0x01, 0x23, 0xfa, 0x0f, 0x00, 0x71, 0x10, 0x00, 0x88, 0x01, 0x22, 0x6e,
+    0x1b, 0x33, 0x09, 0x01, 0xc9, 0x09, 0x21, 0x89, 0x01, 0x17, 0x95, 0x40, 0xb0, 0xab, 0x4a, 0x14,
+    0xde, 0x03, 0x83, 0x8a, 0x01, 0x23, 0xfd, 0x0e, 0x00, 0x00, 0xa0, 0x7f, 0x08, 0x80, 0x8c, 0x01,
+    0x22, 0x72, 0x1b, 0x00, 0x00, 0x72, 0x0f, 0x00, 0x86, 0x02, 0x00, 0x00, 0x8d, 0x01, 0x03, 0x00,
+    0x0f, 0xb0, 0x13, 0x56, 0x8e, 0x01, 0x23, 0x03, 0x0f, 0x2d, 0x00, 0x00, 0x3f, 0x5e, 0x00, 0x69,
+    0x7b, 0x21, 0xa4, 0x4b, 0x08, 0x00, 0x40, 0x90, 0x01, 0x23, 0x06, 0x1e, 0x00, 0x03, 0xc1, 0x20,
+    0x62, 0x91, 0x01, 0x12, 0x74, 0x1b, 0x05, 0xd2, 0x1e, 0x02, 0x0f, 0x00, 0x23, 0x76, 0x1b, 0xe1,
+    0x1e, 0x77, 0x01, 0x10, 0x00, 0x92, 0x01, 0x23, 0x09, 0x2d, 0x00, 0x45, 0x93, 0x01, 0x12, 0x78,
+    0x2d, 0x00, 0x10, 0x30, 0x0f, 0x00, 0x15, 0x7a, 0x2d, 0x00, 0x60, 0x30, 0x00, 0x94, 0x01, 0x12,
+    0x7c, 0xea, 0x06, 0x10, 0x69, 0x0f, 0x00, 0x10, 0x20, 0x0f, 0x00, 0x15, 0x7e, 0x0f, 0x00, 0x65,
+    0x30, 0x00, 0x96, 0x01, 0x12, 0x80, 0x2d, 0x00, 0x10, 0x20, 0x0f, 0x00, 0x17, 0x82, 0x3c, 0x00,
+    0x53, 0x97, 0x01, 0x25, 0xea, 0x00, 0x52, 0x26, 0xa2, 0x04, 0x20, 0x00, 0x98, 0x01, 0x04, 0xd4,
+    0x05, 0x01, 0x0a, 0x12, 0x1b, 0x7f, 0x90, 0x02, 0x98, 0x01, 0x05, 0xef, 0x00, 0x0f, 0x00, 0x06,
+    0x72, 0x99, 0x01, 0x04, 0xd8, 0x05, 0x00, 0x0a, 0xd5, 0x1b, 0x00, 0x0f, 0x00, 0x3f, 0x05, 0xf4,
+    0x00, 0x0f, 0x00, 0x06, 0x40, 0x9a, 0x01, 0x04, 0xdc, 0x2d, 0x00, 0x01, 0xa9, 0x1a, 0x00, 0x0f,
+    0x00, 0x20, 0x05, 0xf9, 0x1e, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x40, 0x9b, 0x01, 0x04, 0xe0, 0x2d,
+    0x00, 0x03, 0x69, 0x00, 0x40, 0x9b, 0x01, 0x05, 0xfe, 0x1e, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x73,
+    0x9c, 0x01, 0x13, 0xe4, 0x05, 0x05, 0x00, 0x2b, 0x02, 0x65, 0x00, 0x9d, 0x01, 0x14, 0xe4, 0x05,
+    0x49, 0x02, 0x2a, 0x00, 0x9e, 0x0f, 0x00, 0x56, 0x9f, 0x01, 0x23, 0x0c, 0x0f, 0x0d, 0x02, 0x45,
+    0x9f, 0x01, 0x23, 0x0f, 0x0f, 0x00, 0x67, 0x10, 0x00, 0xa0, 0x01, 0x23, 0x12, 0x77, 0x01, 0x47,
+    0xa1, 0x01, 0x12, 0x84, 0x59, 0x01, 0x47, 0xa1, 0x01, 0x12, 0x86, 0x59, 0x01, 0xa2, 0xa4, 0x01,
+    0x23, 0x15, 0x0f, 0x00, 0x3c, 0x70, 0x7c, 0x2b, 0xf9, 0x15, 0x35, 0x01, 0x23, 0x18, 0x0f, 0x00,
+    0x41, 0x10, 0x00, 0xa5, 0x01, 0x50, 0x97, 0x11, 0x40, 0xda, 0x25, 0x60, 0x10, 0x00, 0xa6, 0x01,
+    0x23, 0x1e, 0x0f, 0x00, 0x83, 0x8b, 0x2d, 0x00, 0x03, 0x03, 0x10, 0x00, 0xa7, 0xd6, 0x0b, 0x03,
+    0x61, 0x17, 0x13, 0xa7, 0xd6, 0x0b, 0x03, 0x61, 0x17, 0x10, 0xa8, 0xd6, 0x0b, 0x06, 0x61, 0x17,
+    0x10, 0xa8, 0xd6, 0x0b, 0x06, 0x61, 0x17, 0x29, 0xa9, 0x01, 0x61, 0x17, 0x29, 0xa9, 0x01, 0x61,
+    0x17, 0x29, 0xaa, 0x01, 0x61, 0x17, 0x29, 0xaa, 0x01, 0x61, 0x17, 0x20, 0xab, 0x01, 0xb1, 0x21,
+    0x30, 0x26, 0x72, 0x7d, 0xc1, 0x58, 0x3a, 0x00, 0x00, 0xac, 0xa3, 0x02, 0x1a, 0xad, 0x96, 0x00,
+    0x1a, 0xad, 0x96, 0x00, 0x1a, 0xae, 0x96, 0x00, 0x1a, 0xae, 0x96, 0x00, 0x1a, 0xaf, 0x96, 0x00,
+    0x1a, 0xaf, 0x96, 0x00, 0x1a, 0xb0, 0x96, 0x00, 0x1a, 0xb0, 0x96, 0x00, 0xa1, 0xb1, 0x01, 0x03,
+    0x21, 0x0f, 0x00, 0x00, 0x72, 0x7e, 0x2e, 0x9c, 0x09, 0x47, 0xb1, 0x01, 0x03, 0x24, 0x0f, 0x00,
+    0x13, 0xb2, 0x1e, 0x00, 0x21, 0x7f, 0x2f, 0xa5, 0x00, 0x13, 0xb2, 0x1e, 0x00, 0x03, 0x0f, 0x00,
+    0xa1, 0xb3, 0x01, 0x05, 0x03, 0x01, 0x00, 0x00, 0x7e, 0x86, 0x34, 0x25, 0x5e, 0x83, 0xb4, 0x01,
+    0x22, 0x88, 0x1b, 0x01, 0x00, 0x40, 0x3f, 0x0c, 0x45, 0xb4, 0x01, 0x22, 0x8a, 0x0f, 0x00, 0x60,
+    0x10, 0x50, 0xb4, 0x01, 0x22, 0x8c, 0x63, 0x24, 0x06, 0x1e, 0x00, 0x15, 0x8e, 0x0f, 0x00, 0x01,
+    0x1e, 0x00, 0x1a, 0x90, 0x3c, 0x00, 0x16, 0x92, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x9c, 0x05,
+    0x3c, 0x00, 0x15, 0xa0, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x13, 0x94, 0x4b, 0x00, 0x12, 0x06, 0x1e,
+    0x00, 0x15, 0x96, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x13, 0x98, 0x0f, 0x00, 0x12, 0x16, 0x1e, 0x00,
+    0x15, 0x9a, 0x0f, 0x00, 0x02, 0x5a, 0x00, 0x03, 0x69, 0x00, 0x00, 0xa6, 0x2a, 0x43, 0xb4, 0x01,
+    0x22, 0x9e, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x1a, 0xa0, 0x1e, 0x00, 0x1a, 0xa2, 0x1e, 0x00, 0x15,
+    0xa4, 0x1e, 0x00, 0x01, 0x5a, 0x00, 0x15, 0xa6, 0x1e, 0x00, 0x01, 0x0f, 0x00, 0x14, 0xa8, 0x1e,
+    0x00, 0x02, 0x78, 0x00, 0x15, 0xaa, 0x0f, 0x00, 0x01, 0xf0, 0x00, 0x14, 0xac, 0x2d, 0x00, 0x02,
+    0x1e, 0x00, 0x15, 0xae, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x31, 0xb0, 0x1b, 0x07, 0x0f, 0x00, 0x30,
+    0x08, 0x01, 0x20, 0x1e, 0x00, 0x1a, 0xb2, 0x0f, 0x00, 0x13, 0xb4, 0x0f, 0x00, 0x12, 0x09, 0x0f,
+    0x00, 0x1a, 0xb6, 0x0f, 0x00, 0x1a, 0xb8, 0x2d, 0x00, 0x1a, 0xba, 0x0f, 0x00, 0x1a, 0xbc, 0x2d,
+    0x00, 0x17, 0xbe, 0x0f, 0x00, 0x22, 0xb5, 0x01, 0xd9, 0x92, 0x30, 0xa4, 0x4b, 0x04, 0x2b, 0x02,
+    0x22, 0xb5, 0x01, 0xc8, 0x92, 0x00, 0x0f, 0x00, 0x00, 0xb9, 0x3d, 0x12, 0x01, 0xb7, 0x92, 0x06,
+    0x1e, 0x00, 0x01, 0xa6, 0x92, 0x03, 0x1e, 0x00, 0x22, 0xb6, 0x01, 0x95, 0x92, 0x21, 0xa3, 0x4a,
+    0x1e, 0x00, 0x22, 0xb6, 0x01, 0x84, 0x92, 0x00, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x01, 0x73, 0x92,
+    0x06, 0x1e, 0x00, 0x01, 0x62, 0x92, 0x03, 0x1e, 0x00, 0x13, 0xb7, 0xd1, 0x01, 0x21, 0x80, 0x30,
+    0xd1, 0x01, 0x13, 0xb7, 0x1c, 0x02, 0x03, 0x0f, 0x00, 0x40, 0xb8, 0x01, 0x22, 0xc8, 0x0f, 0x00,
+    0x00, 0xc0, 0x03, 0x20, 0x01, 0x00, 0x0f, 0x00, 0x15, 0xca, 0x0f, 0x00, 0x0f, 0x1e, 0x00, 0x10,
+    0x12, 0xcc, 0xa5, 0x00, 0x01, 0xc8, 0x19, 0x22, 0xb8, 0x01, 0x2a, 0x98, 0x03, 0x59, 0x1f, 0x0f,
+    0x1e, 0x00, 0x0e, 0x1a, 0xd0, 0x5a, 0x00, 0x1a, 0xd2, 0x5a, 0x00, 0x0f, 0x1e, 0x00, 0x0b, 0x1a,
+    0xd4, 0x5a, 0x00, 0x01, 0x62, 0x98, 0x06, 0x5a, 0x00, 0x0f, 0x1e, 0x00, 0x08, 0xa1, 0xb9, 0x01,
+    0x22, 0xd8, 0x1b, 0x02, 0x00, 0x40, 0xa6, 0x4c, 0x1f, 0x0e, 0x44, 0xb9, 0x01, 0x22, 0xda, 0x0f,
+    0x00, 0x00, 0x32, 0x19, 0x91, 0x01, 0x23, 0x27, 0x0f, 0x00, 0x00, 0x76, 0x81, 0x31, 0x1d, 0x01,
+    0x47, 0xba, 0x01, 0x23, 0x2a, 0x0f, 0x00, 0x59, 0xbb, 0x01, 0x22, 0xdc, 0x1b, 0x0f, 0x00, 0x17,
+    0xde, 0x0f, 0x00, 0x40, 0xbc, 0x01, 0x22, 0xe0, 0x4b, 0x00, 0x03, 0xf1, 0x1d, 0x22, 0xbd, 0x01,
+    0x28, 0x98, 0x03, 0xd1, 0x01, 0x22, 0xbd, 0x01, 0xb7, 0x96, 0x03, 0xd1, 0x01, 0x22, 0xbd, 0x01,
+    0x06, 0x98, 0x06, 0x1e, 0x00, 0x01, 0xf5, 0x96, 0x03, 0x1e, 0x00, 0x10, 0xbe, 0x3c, 0x00, 0x01,
+    0x4b, 0x00, 0x01, 0x94, 0x11, 0x10, 0xbe, 0x3c, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x12,
+    0xe2, 0x69, 0x00, 0x04, 0x1e, 0x00, 0x14, 0xe4, 0x0f, 0x00, 0x72, 0x01, 0x10, 0x00, 0xbf, 0x01,
+    0x22, 0xe6, 0xfe, 0x01, 0x10, 0x18, 0x1e, 0x00, 0x47, 0xc0, 0x01, 0x22, 0x1e, 0xff, 0x00, 0x47,
+    0xc0, 0x01, 0x22, 0xe8, 0x0f, 0x00, 0x42, 0xc1, 0x01, 0x22, 0xea, 0x2d, 0x00, 0x04, 0x0f, 0x00,
+    0x01, 0x1c, 0x98, 0x03, 0x0f, 0x00, 0x1a, 0xc2, 0x4b, 0x00, 0x1a, 0xc3, 0x4b, 0x00, 0x1a, 0xc3,
+    0x4b, 0x00, 0x1a, 0xc4, 0x4b, 0x00, 0x22, 0xc4, 0x01, 0x17, 0x98, 0x03, 0x0f, 0x00, 0x42, 0xc5,
+    0x01, 0x22, 0xf0, 0x2d, 0x00, 0x10, 0x18, 0x69, 0x1e, 0x43, 0xc6, 0x01, 0x22, 0xf2, 0x5a, 0x00,
+    0x00, 0x0f, 0x00, 0x1a, 0xc7, 0xff, 0x00, 0x12, 0xc8, 0x2c, 0x01, 0x31, 0xb0, 0xa8, 0x4d, 0x0f,
+    0x00, 0x42, 0xc9, 0x01, 0x22, 0xa1, 0x2a, 0x03, 0x01, 0x68, 0x01, 0x47, 0xc9, 0x01, 0x22, 0xa7,
+    0x0f, 0x00, 0x47, 0xca, 0x01, 0x22, 0xf4, 0x3c, 0x00, 0x47, 0xcb, 0x01, 0x22, 0xf6, 0xfd, 0x02,
+    0x47, 0xcc, 0x01, 0x22, 0xf8, 0x3a, 0x02, 0x22, 0xcd, 0x01, 0x6d, 0x97, 0x00, 0xf0, 0x0f, 0x00,
+    0x05, 0x19, 0x03, 0x1c, 0x02, 0x03, 0x0f, 0x00, 0x47, 0xcf, 0x01, 0x22, 0xfc, 0x76, 0x02, 0x47,
+    0xcf, 0x01, 0x22, 0xfe, 0x3c, 0x00, 0x40, 0xcf, 0x01, 0x22, 0x00, 0xa9, 0x96, 0x03, 0x58, 0x02,
+    0x10, 0xcf, 0x3a, 0x02, 0x06, 0xff, 0x00, 0x40, 0xcf, 0x01, 0x22, 0x02, 0x1e, 0x00, 0x01, 0x08,
+    0x07, 0x0f, 0x3c, 0x00, 0x01, 0x14, 0x04, 0x1e, 0x00, 0x02, 0x3c, 0x00, 0x08, 0x96, 0x00, 0x4a,
+    0xcf, 0x01, 0x22, 0x06, 0x5a, 0x00, 0x01, 0xa5, 0x00, 0x06, 0x5a, 0x00, 0x01, 0xb2, 0x02, 0x03,
+    0xbf, 0x22, 0x01, 0x78, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x1a, 0x08, 0x78, 0x00, 0x0b,
+    0x5a, 0x00, 0x01, 0x6d, 0x98, 0x06, 0x3c, 0x00, 0x08, 0x5a, 0x00, 0x52, 0xd0, 0x01, 0x22, 0x0c,
+    0x1c, 0xb2, 0x02, 0x00, 0xca, 0x1a, 0x56, 0xd1, 0x01, 0x05, 0x08, 0x01, 0x06, 0x09, 0x47, 0xd1,
+    0x01, 0x06, 0xa9, 0x15, 0x09, 0x0b, 0x0f, 0x00, 0x56, 0xd2, 0x01, 0x05, 0x0d, 0x01, 0x06, 0x09,
+    0x47, 0xd2, 0x01, 0x06, 0xaf, 0x15, 0x09, 0x0d, 0x0f, 0x00, 0x22, 0x22, 0x0e, 0x69, 0x00, 0x01,
+    0x87, 0x00, 0x44, 0xd2, 0x01, 0x22, 0x10, 0x0f, 0x00, 0x00, 0x13, 0x1a, 0x3a, 0x01, 0x22, 0x12,
+    0x1e, 0x00, 0x17, 0x14, 0x1e, 0x00, 0x10, 0xd3, 0xfb, 0x04, 0x01, 0xa2, 0x03, 0x01, 0xee, 0x02,
+    0x10, 0xd3, 0xfb, 0x04, 0x03, 0x0f, 0x00, 0x00, 0xf5, 0x19, 0x0a, 0x1e, 0x00, 0x1a, 0xd4, 0x1e,
+    0x00, 0x40, 0xd5, 0x01, 0x05, 0x12, 0xa5, 0x00, 0x03, 0x7e, 0x09, 0x47, 0xd5, 0x01, 0x06, 0xb5,
+    0x8d, 0x09, 0x0b, 0x0f, 0x00, 0x40, 0xd6, 0x01, 0x22, 0x16, 0x78, 0x00, 0x00, 0xb2, 0x02, 0x74,
+    0x04, 0x00, 0x00, 0xd6, 0x01, 0x22, 0x18, 0x0f, 0x00, 0x00, 0x22, 0x1a, 0x3a, 0x01, 0x22, 0x1a,
+    0x1e, 0x00, 0x17, 0x1c, 0x1e, 0x00, 0x40, 0xd7, 0x01, 0x05, 0x17, 0x69, 0x00, 0x03, 0x1d, 0x01,
+    0x47, 0xd7, 0x01, 0x06, 0xbb, 0xc9, 0x09, 0x0b, 0x0f, 0x00, 0x40, 0xd8, 0x01, 0x22, 0x1e, 0x95,
+    0x01, 0x03, 0x4d, 0x2b, 0x45, 0xd8, 0x01, 0x22, 0x20, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x1a,
+    0x22, 0x1e, 0x00, 0x17, 0x24, 0x1e, 0x00, 0x40, 0xd9, 0x01, 0x22, 0x26, 0x0f, 0x00, 0x21, 0x7a,
+    0x2a, 0x1e, 0x00, 0x45, 0xd9, 0x01, 0x22, 0x28, 0x0f, 0x00, 0x35, 0x10, 0x00, 0xda, 0x63, 0x06,
+    0x01, 0x0e, 0x01, 0x15, 0xda, 0x63, 0x06, 0x01, 0x0e, 0x01, 0x15, 0xda, 0x63, 0x06, 0x04, 0x1e,
+    0x00, 0x03, 0x63, 0x06, 0x01, 0x1e, 0x00, 0x15, 0xdb, 0x63, 0x06, 0x01, 0x1e, 0x00, 0x15, 0xdb,
+    0x63, 0x06, 0x04, 0x1e, 0x00, 0x03, 0x63, 0x06, 0x04, 0x1e, 0x00, 0x03, 0x63, 0x06, 0x01, 0x1e,
+    0x00, 0x47, 0xdc, 0x01, 0x22, 0x2a, 0xb4, 0x00, 0x47, 0xdc, 0x01, 0x22, 0x2c, 0xb4, 0x00, 0x4a,
+    0xdc, 0x01, 0x22, 0x2e, 0x1e, 0x00, 0x17, 0x30, 0x1e, 0x00, 0x30, 0xdd, 0x01, 0x33, 0x80, 0x16,
+    0x04, 0x3a, 0x2f, 0x30, 0xdd, 0x01, 0x33, 0x80, 0x16, 0x04, 0x3a, 0x2f, 0x47, 0xde, 0x01, 0x14,
+    0xe8, 0x72, 0x15, 0x47, 0xde, 0x01, 0x14, 0xec, 0x72, 0x15, 0x47, 0xde, 0x01, 0x14, 0xf0, 0x72,
+    0x15, 0x47, 0xde, 0x01, 0x14, 0xf4, 0x72, 0x15, 0x1a, 0xdf, 0xf6, 0x09, 0x1a, 0xdf, 0xf6, 0x09,
+    0x1a, 0xe0, 0xf6, 0x09, 0x1a, 0xe0, 0xf6, 0x09, 0x1a, 0xe1, 0xf6, 0x09, 0x1a, 0xe1, 0xf6, 0x09,
+    0x1a, 0xe2, 0xf6, 0x09, 0x1a, 0xe2, 0xf6, 0x09, 0x56, 0xe4, 0x01, 0x02, 0x32, 0x1c, 0xe7, 0x09,
+    0x40, 0xe4, 0x01, 0x02, 0x28, 0x8c, 0x0a, 0x03, 0x0f, 0x00, 0x13, 0xe5, 0x1e, 0x00, 0x03, 0xe7,
+    0x09, 0x13, 0xe5, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x11, 0xe6, 0x9f, 0x15, 0x05, 0xf5, 0x28, 0x11,
+    0xe6, 0x9f, 0x15, 0x05, 0xbc, 0x34, 0x11, 0xe6, 0x9f, 0x15, 0x08, 0x1e, 0x00, 0x15, 0x46, 0x0f,
+    0x00, 0x32, 0x50, 0x18, 0xe7, 0xf5, 0x0a, 0x13, 0x7c, 0x24, 0x09, 0x92, 0xe7, 0x01, 0x22, 0xcb,
+    0x0d, 0x00, 0x00, 0xd4, 0x91, 0x77, 0x01, 0x92, 0xe7, 0x01, 0x11, 0x44, 0x05, 0x00, 0x00, 0xd4,
+    0x5f, 0x3c, 0x00, 0x0f, 0x0f, 0x00, 0x59, 0x15, 0x48, 0x0f, 0x00, 0x1f, 0x10, 0x0f, 0x00, 0x1d,
+    0x02, 0xc3, 0x00, 0x14, 0x5f, 0xc3, 0x00, 0x25, 0x22, 0xce, 0x0f, 0x00, 0x01, 0x2d, 0x00, 0x10,
+    0x69, 0x2d, 0x00, 0x21, 0x8f, 0x14, 0x41, 0x61, 0x04, 0x3c, 0x00, 0x15, 0x8f, 0x4b, 0x00, 0x0b,
+    0x1e, 0x00, 0x0f, 0x2d, 0x00, 0x28, 0x0f, 0x87, 0x00, 0x0b, 0x0f, 0x1e, 0x00, 0x0c, 0x01, 0x0f,
+    0x00, 0x00, 0x4b, 0x00, 0x0f, 0x2d, 0x00, 0x02, 0x01, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x0f, 0x0f,
+    0x00, 0xff, 0x06, 0x05, 0x2c, 0x01, 0x02, 0x58, 0x02, 0x14, 0x77, 0x58, 0x02, 0x0c, 0x0d, 0x02,
+    0x01, 0xd1, 0x01, 0x01, 0x1e, 0x00, 0x94, 0x10, 0x00, 0xe8, 0x01, 0x11, 0x2f, 0x0d, 0x01, 0x00,
+    0xda, 0x34, 0x45, 0xe8, 0x01, 0x11, 0x32, 0x0f, 0x00, 0x88, 0x50, 0x18, 0xe8, 0x01, 0x11, 0x35,
+    0x0d, 0x00, 0x1e, 0x00, 0x15, 0x38, 0x0f, 0x00, 0x49, 0x50, 0x18, 0xe9, 0x01, 0x06, 0x36, 0x29,
+    0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9,
+    0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x11, 0xe9, 0x04, 0x1a, 0x08, 0x1e, 0x00, 0x08,
+    0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0xca,
+    0x35, 0x29, 0xe9, 0x01, 0xca, 0x35, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36,
+    0x0f, 0x3c, 0x00, 0x0e, 0x08, 0x06, 0x36, 0x29, 0xe9, 0x01, 0x06, 0x36, 0x12, 0xea, 0x46, 0x05,
+    0x04, 0xca, 0x35, 0x12, 0xea, 0x46, 0x05, 0x04, 0xca, 0x35, 0x12, 0xeb, 0x46, 0x05, 0x04, 0xca,
+    0x35, 0x12, 0xeb, 0x46, 0x05, 0x04, 0xca, 0x35, 0x56, 0xec, 0x01, 0x23, 0x33, 0x0f, 0xa9, 0x1a,
+    0x56, 0xec, 0x01, 0x23, 0x36, 0x0f, 0x9a, 0x1a, 0x4a, 0xec, 0x01, 0x23, 0x39, 0x0f, 0x00, 0x1a,
+    0x3c, 0x2d, 0x00, 0x1a, 0x3f, 0x1e, 0x00, 0x17, 0x42, 0x0f, 0x00, 0x54, 0xed, 0x01, 0x03, 0x45,
+    0x0f, 0x4f, 0x1a, 0x65, 0x90, 0x02, 0xed, 0x01, 0x04, 0xf8, 0x5e, 0x1a, 0x0d, 0x0f, 0x00, 0x54,
+    0xee, 0x01, 0x03, 0x48, 0x0f, 0x22, 0x1a, 0x0f, 0x0f, 0x00, 0x00, 0x25, 0x04, 0xfc, 0x40, 0x1a,
+    0x0f, 0x0f, 0x00, 0x1c, 0x40, 0xef, 0x01, 0x03, 0x4b, 0x4b, 0x00, 0x03, 0x69, 0x00, 0x5f, 0xef,
+    0x01, 0x04, 0x00, 0x06, 0x0f, 0x00, 0x06, 0x12, 0xf0, 0x23, 0x0a, 0x31, 0x74, 0xae, 0x4f, 0xab,
+    0x09, 0x12, 0xf0, 0x23, 0x0a, 0x01, 0x0f, 0x00, 0x20, 0x01, 0x10, 0x0f, 0x00, 0x00, 0x30, 0x0c,
+    0x31, 0xb0, 0xad, 0x4f, 0x4a, 0x01, 0x13, 0xf0, 0x04, 0x0b, 0x00, 0x0f, 0x00, 0x4a, 0x01, 0x10,
+    0x00, 0xf1, 0x3c, 0x00, 0x1a, 0xf1, 0x3c, 0x00, 0x1a, 0xf1, 0x3c, 0x00, 0x1a, 0xf1, 0x3c, 0x00,
+    0x1a, 0xf2, 0x3c, 0x00, 0x1a, 0xf2, 0x3c, 0x00, 0x1a, 0xf2, 0x3c, 0x00, 0x1a, 0xf2, 0x3c, 0x00,
+    0x40, 0xf3, 0x01, 0x22, 0x34, 0x3c, 0x00, 0x03, 0x5f, 0x0a, 0x44, 0xf3, 0x01, 0x22, 0x36, 0x0f,
+    0x00, 0x02, 0x1e, 0x00, 0x00, 0xa8, 0x39, 0x13, 0xb0, 0x1c, 0x02, 0x21, 0xf3, 0x01, 0xa8, 0x39,
+    0x01, 0x0f, 0x00, 0x77, 0x01, 0x10, 0x00, 0xf4, 0x01, 0x22, 0x38, 0x3c, 0x00, 0x47, 0xf4, 0x01,
+    0x22, 0x3a, 0x3c, 0x00, 0x56, 0xf4, 0x01, 0x22, 0x3c, 0x1c, 0x3c, 0x00, 0x44, 0xf4, 0x01, 0x22,
+    0x3e, 0x0f, 0x00, 0x00, 0x0c, 0x21, 0x03, 0x5a, 0x00, 0x03, 0x16, 0x08, 0x13, 0xf5, 0x5a, 0x00,
+    0x03, 0x16, 0x08, 0x1a, 0xf6, 0x5a, 0x00, 0x1a, 0xf6, 0x5a, 0x00, 0x1a, 0xf6, 0x5a, 0x00, 0x1a,
+    0xf6, 0x5a, 0x00, 0x21, 0xf7, 0x01, 0x4c, 0x64, 0x04, 0x3c, 0x00, 0x21, 0xf7, 0x01, 0x4d, 0x64,
+    0x04, 0x3c, 0x00, 0x1a, 0xf7, 0xd2, 0x00, 0x1a, 0xf7, 0xd2, 0x00, 0x1a, 0xf8, 0x3c, 0x00, 0x1a,
+    0xf8, 0x3c, 0x00, 0x1a, 0xf8, 0x3c, 0x00, 0x1a, 0xf8, 0x3c, 0x00, 0x13, 0xf9, 0x3c, 0x00, 0x21,
+    0xa5, 0x4b, 0x3c, 0x00, 0x13, 0xf9, 0x3c, 0x00, 0x00, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x08, 0x3c,
+    0x00, 0x1a, 0xf9, 0x3c, 0x00, 0x1a, 0xfa, 0x78, 0x00, 0x1a, 0xfa, 0x78, 0x00, 0x1a, 0xfa, 0x3c,
+    0x00, 0x1a, 0xfa, 0x3c, 0x00, 0x1a, 0xfb, 0x3c, 0x00, 0x1a, 0xfb, 0x3c, 0x00, 0x1a, 0xfb, 0x3c,
+    0x00, 0x1a, 0xfb, 0x3c, 0x00, 0x1a, 0xfc, 0x3c, 0x00, 0x1a, 0xfc, 0x3c, 0x00, 0x1a, 0xfc, 0x3c,
+    0x00, 0x1a, 0xfc, 0x3c, 0x00, 0x1a, 0xfd, 0x3c, 0x00, 0x1a, 0xfd, 0x3c, 0x00, 0x1a, 0xfd, 0x3c,
+    0x00, 0x1a, 0xfd, 0x3c, 0x00, 0x1a, 0xfe, 0x3c, 0x00, 0x1a, 0xfe, 0x3c, 0x00, 0x1a, 0xfe, 0xe0,
+    0x01, 0x1a, 0xfe, 0xe0, 0x01, 0x31, 0xff, 0x01, 0x33, 0x3c, 0x00, 0x03, 0xee, 0x02, 0x31, 0xff,
+    0x01, 0x33, 0x3c, 0x00, 0x03, 0xee, 0x02, 0x31, 0xff, 0x01, 0x33, 0x78, 0x00, 0x03, 0xee, 0x02,
+    0x31, 0xff, 0x01, 0x33, 0x78, 0x00, 0x03, 0xee, 0x02, 0x12, 0x00, 0x68, 0x66, 0x13, 0x6c, 0x78,
+    0x00, 0x12, 0x00, 0x69, 0x66, 0x01, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x00, 0x3c, 0x00, 0x13, 0x6c,
+    0x78, 0x00, 0x21, 0x00, 0x02, 0xb4, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x62, 0x5f, 0x0a, 0x3c, 0x00,
+    0x1a, 0x01, 0x3c, 0x00, 0x1a, 0x01, 0x3c, 0x00, 0x1a, 0x01, 0x3c, 0x00, 0x12, 0x02, 0x9d, 0x6c,
+    0x31, 0x72, 0x88, 0x35, 0x08, 0x00, 0x47, 0x03, 0x02, 0x22, 0x40, 0xdf, 0x02, 0x47, 0x03, 0x02,
+    0x22, 0x42, 0xdf, 0x02, 0x21, 0x03, 0x02, 0xb1, 0x21, 0x04, 0xff, 0x00, 0x21, 0x03, 0x02, 0xb1,
+    0x21, 0x04, 0xff, 0x00, 0x47, 0x05, 0x02, 0x22, 0x44, 0x3c, 0x00, 0x47, 0x05, 0x02, 0x22, 0x46,
+    0x3c, 0x00, 0x47, 0x05, 0x02, 0x22, 0x48, 0x3b, 0x01, 0x47, 0x05, 0x02, 0x22, 0x4a, 0x3b, 0x01,
+    0x47, 0x06, 0x02, 0x23, 0x5a, 0x75, 0x03, 0x47, 0x06, 0x02, 0x23, 0x5d, 0x75, 0x03, 0x22, 0x07,
+    0x02, 0x3b, 0x01, 0x03, 0x1e, 0x00, 0x22, 0x07, 0x02, 0x3b, 0x01, 0x03, 0x1e, 0x00, 0x12, 0x08,
+    0x1e, 0x00, 0x31, 0x80, 0x89, 0x36, 0x1e, 0x00, 0x12, 0x08, 0x1e, 0x00, 0x01, 0x0f, 0x00, 0x00,
+    0x0b, 0x40, 0x37, 0x02, 0x22, 0x4c, 0x96, 0x00, 0x47, 0x09, 0x02, 0x22, 0x4e, 0x96, 0x00, 0x47,
+    0x09, 0x02, 0x22, 0x50, 0x96, 0x00, 0x47, 0x09, 0x02, 0x22, 0x52, 0x96, 0x00, 0x29, 0x0a, 0x02,
+    0x83, 0x04, 0x29, 0x0a, 0x02, 0x83, 0x04, 0x12, 0x0a, 0x59, 0x01, 0x04, 0x3c, 0x00, 0x12, 0x0a,
+    0x59, 0x01, 0x04, 0x3c, 0x00, 0x13, 0x0b, 0x1e, 0x00, 0x03, 0xb4, 0x00, 0x13, 0x0b, 0x1e, 0x00,
+    0x03, 0xb4, 0x00, 0x29, 0x0c, 0x02, 0x47, 0x04, 0x29, 0x0c, 0x02, 0x47, 0x04, 0x29, 0x0c, 0x02,
+    0x67, 0x02, 0x29, 0x0c, 0x02, 0x67, 0x02, 0x92, 0x0d, 0x02, 0x37, 0x5e, 0x00, 0x06, 0x36, 0xb0,
+    0xa9, 0x5a, 0x00, 0x4a, 0x0d, 0x02, 0x37, 0x65, 0x0f, 0x00, 0x14, 0x6c, 0x0f, 0x00, 0x02, 0x2d,
+    0x00, 0x17, 0x73, 0x0f, 0x00, 0x47, 0x0e, 0x02, 0x37, 0x7a, 0x2d, 0x00, 0x4a, 0x0e, 0x02, 0x37,
+    0x81, 0x0f, 0x00, 0x1a, 0x88, 0x2d, 0x00, 0x17, 0x8f, 0x0f, 0x00, 0x1a, 0x0f, 0x4a, 0x01, 0x1a,
+    0x0f, 0x4a, 0x01, 0x1a, 0x0f, 0x4a, 0x01, 0x1a, 0x0f, 0x4a, 0x01, 0x1a, 0x10, 0x4a, 0x01, 0x1a,
+    0x10, 0x4a, 0x01, 0x1a, 0x10, 0x4a, 0x01, 0x1a, 0x10, 0x4a, 0x01, 0x13, 0x11, 0x1e, 0x00, 0x03,
+    0xa5, 0x00, 0x13, 0x11, 0x1e, 0x00, 0x03, 0x96, 0x00, 0x1a, 0x12, 0x4a, 0x01, 0x1a, 0x12, 0x4a,
+    0x01, 0x1a, 0x12, 0x4a, 0x01, 0x1a, 0x12, 0x4a, 0x01, 0x56, 0x13, 0x02, 0x35, 0x1c, 0x01, 0xff,
+    0x00, 0x44, 0x13, 0x02, 0x35, 0x21, 0x0f, 0x00, 0x00, 0x83, 0x40, 0x37, 0x02, 0x35, 0x26, 0x1e,
+    0x00, 0x47, 0x14, 0x02, 0x35, 0x2b, 0x1e, 0x00, 0xa1, 0x15, 0x02, 0x05, 0x30, 0x01, 0x00, 0x41,
+    0x82, 0x8a, 0x37, 0x5c, 0x0d, 0x47, 0x15, 0x02, 0x05, 0x35, 0x0f, 0x00, 0x21, 0x18, 0x02, 0x6b,
+    0x96, 0x04, 0x68, 0x2e, 0x45, 0x18, 0x02, 0x33, 0x63, 0x0f, 0x00, 0x49, 0x10, 0x00, 0x19, 0x02,
+    0x86, 0x2e, 0x47, 0x19, 0x02, 0x33, 0x66, 0x1e, 0x00, 0x47, 0x1a, 0x02, 0x33, 0x69, 0x3c, 0x00,
+    0x47, 0x1a, 0x02, 0x33, 0x6c, 0x1e, 0x00, 0x43, 0x1b, 0x02, 0x33, 0x6f, 0x92, 0x04, 0x30, 0x01,
+    0x03, 0x00, 0x0f, 0x00, 0x12, 0x72, 0x2c, 0x01, 0x10, 0x14, 0xcf, 0x12, 0x47, 0x1b, 0x02, 0x33,
+    0x75, 0x3c, 0x00, 0x47, 0x1b, 0x02, 0x33, 0x78, 0x3c, 0x00, 0x12, 0x2f, 0x29, 0x04, 0x04, 0xa1,
+    0x04, 0x12, 0x2f, 0x29, 0x04, 0x04, 0xa1, 0x04, 0x13, 0x2f, 0x68, 0x01, 0x03, 0xa1, 0x04, 0x13,
+    0x2f, 0x68, 0x01, 0x03, 0xa1, 0x04, 0x1a, 0x30, 0x3c, 0x00, 0x1a, 0x30, 0x3c, 0x00, 0x1a, 0x30,
+    0x3c, 0x00, 0x1a, 0x30, 0x3c, 0x00, 0x1a, 0x31, 0x3c, 0x00, 0x1a, 0x31, 0x3c, 0x00, 0x1a, 0x31,
+    0x3c, 0x00, 0x1a, 0x31, 0x3c, 0x00, 0x22, 0x32, 0x02, 0x25, 0x08, 0x03, 0x48, 0x03, 0x24, 0x32,
+    0x02, 0xa1, 0x13, 0x01, 0x1e, 0x00, 0x1a, 0x33, 0x5a, 0x00, 0x1a, 0x33, 0x5a, 0x00, 0x1a, 0x33,
+    0x5a, 0x00, 0x1a, 0x33, 0x5a, 0x00, 0x1a, 0x34, 0x3c, 0x00, 0x1a, 0x34, 0x3c, 0x00, 0x1a, 0x34,
+    0x3c, 0x00, 0x1a, 0x34, 0x3c, 0x00, 0x1a, 0x35, 0x3c, 0x00, 0x1a, 0x35, 0x3c, 0x00, 0x1a, 0x35,
+    0x3c, 0x00, 0x1a, 0x35, 0x3c, 0x00, 0x47, 0x38, 0x02, 0x33, 0x7b, 0xa4, 0x01, 0x47, 0x38, 0x02,
+    0x33, 0x7e, 0xa4, 0x01, 0x1a, 0x39, 0x1e, 0x00, 0x47, 0x39, 0x02, 0x33, 0x81, 0x1e, 0x00, 0x47,
+    0x3a, 0x02, 0x33, 0x84, 0x1e, 0x00, 0x47, 0x3a, 0x02, 0x33, 0x87, 0x1e, 0x00, 0x45, 0x3b, 0x02,
+    0x33, 0x8a, 0xae, 0x06, 0x10, 0x00, 0x0f, 0x00, 0x17, 0x8d, 0xbd, 0x06, 0x43, 0x3b, 0x02, 0x33,
+    0x90, 0x2b, 0x02, 0x00, 0x3c, 0x00, 0x45, 0x3b, 0x02, 0x33, 0x93, 0x0f, 0x00, 0x33, 0x10, 0x00,
+    0x3c, 0xde, 0x03, 0x03, 0xd2, 0x00, 0x13, 0x3c, 0xde, 0x03, 0x03, 0xd2, 0x00, 0x13, 0x3c, 0xde,
+    0x03, 0x03, 0xd2, 0x00, 0x13, 0x3c, 0xde, 0x03, 0x03, 0xd2, 0x00, 0x1a, 0x3d, 0x84, 0x03, 0x1a,
+    0x3d, 0x84, 0x03, 0x1a, 0x3d, 0x84, 0x03, 0x1a, 0x3d, 0x84, 0x03, 0x1a, 0x3e, 0x28, 0x05, 0x1a,
+    0x3e, 0x28, 0x05, 0x1a, 0x3f, 0x1e, 0x00, 0x1a, 0x3f, 0x1e, 0x00, 0x13, 0x40, 0x86, 0x01, 0x03,
+    0x78, 0x00, 0x13, 0x40, 0x86, 0x01, 0x03, 0x78, 0x00, 0x1a, 0x40, 0x56, 0x04, 0x1a, 0x40, 0x56,
+    0x04, 0x1a, 0x41, 0x3c, 0x00, 0x1a, 0x41, 0x3c, 0x00, 0x1a, 0x41, 0x3c, 0x00, 0x1a, 0x41, 0x3c,
+    0x00, 0x1a, 0x42, 0x96, 0x00, 0x1a, 0x42, 0x96, 0x00, 0x1a, 0x43, 0x1e, 0x00, 0x1a, 0x43, 0x1e,
+    0x00, 0x1a, 0x44, 0x1e, 0x00, 0x1a, 0x44, 0x1e, 0x00, 0x1a, 0x45, 0x1e, 0x00, 0x1a, 0x45, 0x1e,
+    0x00, 0x1a, 0x46, 0xb4, 0x00, 0x1a, 0x46, 0xb4, 0x00, 0x1a, 0x46, 0xb4, 0x00, 0x1a, 0x46, 0xb4,
+    0x00, 0x1a, 0x47, 0x3c, 0x00, 0x1a, 0x47, 0x3c, 0x00, 0x1a, 0x47, 0x3c, 0x00, 0x1a, 0x47, 0x3c,
+    0x00, 0x1a, 0x48, 0x96, 0x00, 0x1a, 0x48, 0x96, 0x00, 0x1a, 0x49, 0x1e, 0x00, 0x1a, 0x49, 0x1e,
+    0x00, 0x40, 0x4a, 0x02, 0x22, 0x54, 0x0d, 0x02, 0x12, 0xa3, 0xb0, 0x04, 0x42, 0x4a, 0x02, 0x22,
+    0x56, 0xfe, 0x01, 0x01, 0x7f, 0x17, 0x21, 0x4b, 0x02, 0xc3, 0x93, 0x04, 0x33, 0x27, 0x21, 0x4b,
+    0x02, 0xb2, 0x93, 0x04, 0xd0, 0x02, 0x21, 0x4c, 0x02, 0xa1, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4c,
+    0x02, 0x90, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4d, 0x02, 0x7f, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4d,
+    0x02, 0x6e, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4e, 0x02, 0x5d, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4e,
+    0x02, 0x4c, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4f, 0x02, 0x3b, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x4f,
+    0x02, 0x2a, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x50, 0x02, 0x19, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x50,
+    0x02, 0x08, 0x93, 0x04, 0x1e, 0x00, 0x21, 0x51, 0x02, 0xf7, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x51,
+    0x02, 0xe6, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x52, 0x02, 0xd5, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x52,
+    0x02, 0xc4, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x53, 0x02, 0xb3, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x53,
+    0x02, 0xa2, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x54, 0x02, 0x91, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x54,
+    0x02, 0x80, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x55, 0x02, 0x6f, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x55,
+    0x02, 0x5e, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x56, 0x02, 0x4d, 0x92, 0x04, 0x1e, 0x00, 0x21, 0x56,
+    0x02, 0x3c, 0x92, 0x04, 0x1e, 0x00, 0x1a, 0x57, 0xa4, 0x01, 0x1a, 0x57, 0xa4, 0x01, 0x1a, 0x58,
+    0xce, 0x04, 0x1a, 0x58, 0xce, 0x04, 0x1a, 0x58, 0xce, 0x04, 0x1a, 0x58, 0xce, 0x04, 0x1a, 0x5a,
+    0xf6, 0x09, 0x1a, 0x5a, 0xf6, 0x09, 0x1a, 0x5a, 0xf6, 0x09, 0x1a, 0x5a, 0xf6, 0x09, 0x1a, 0x5b,
+    0x38, 0x04, 0x1a, 0x5b, 0x38, 0x04, 0x1a, 0x5b, 0x38, 0x04, 0x1a, 0x5b, 0x38, 0x04, 0x1a, 0x5c,
+    0xd2, 0x00, 0x1a, 0x5c, 0xd2, 0x00, 0x1a, 0x5d, 0x5a, 0x00, 0x1a, 0x5d, 0x5a, 0x00, 0x1a, 0x5d,
+    0xee, 0x02, 0x1a, 0x5d, 0xee, 0x02, 0x40, 0x5e, 0x02, 0x22, 0x88, 0x2d, 0x00, 0x03, 0x2f, 0x0d,
+    0x44, 0x5e, 0x02, 0x22, 0x8a, 0x0f, 0x00, 0x02, 0x1e, 0x00, 0x17, 0x8c, 0x96, 0x00, 0x47, 0x5e,
+    0x02, 0x22, 0x8e, 0x96, 0x00, 0x83, 0x5f, 0x02, 0x13, 0x96, 0x0f, 0x00, 0x00, 0x86, 0x2c, 0x10,
+    0x4a, 0x5f, 0x02, 0x13, 0x99, 0x0f, 0x00, 0x1a, 0x9c, 0x0f, 0x00, 0x38, 0x9f, 0x0f, 0x04, 0x0f,
+    0x00, 0x14, 0xa2, 0x0f, 0x00, 0x00, 0xce, 0x40, 0x35, 0x02, 0x13, 0xa5, 0x0f, 0x00, 0x01, 0x5a,
+    0x00, 0x1a, 0xa8, 0x2d, 0x00, 0x17, 0xab, 0x0f, 0x00, 0x40, 0x60, 0x02, 0x09, 0x3b, 0x22, 0x9d,
+    0x03, 0x37, 0x23, 0x30, 0x61, 0x02, 0x09, 0x77, 0x37, 0x13, 0x86, 0x21, 0x39, 0x20, 0x62, 0x02,
+    0x57, 0x21, 0x32, 0x41, 0xb0, 0x8e, 0xa5, 0x3c, 0x20, 0x62, 0x02, 0x57, 0x21, 0x03, 0x0f, 0x00,
+    0x94, 0x10, 0x00, 0x63, 0x02, 0x03, 0xae, 0x0f, 0x04, 0x2f, 0x4b, 0x00, 0x40, 0x64, 0x02, 0x03,
+    0xb1, 0x0f, 0x00, 0x03, 0x3c, 0x00, 0x40, 0x65, 0x02, 0x03, 0xb4, 0x0f, 0x00, 0x03, 0x0e, 0x3d,
+    0x1a, 0x66, 0x6c, 0x0c, 0x1a, 0x66, 0x6c, 0x0c, 0x1a, 0x66, 0x6c, 0x0c, 0x1a, 0x66, 0x6c, 0x0c,
+    0x22, 0x67, 0x02, 0x6d, 0x53, 0x10, 0x91, 0x87, 0x0c, 0x41, 0x10, 0x00, 0x68, 0x02, 0xdb, 0x42,
+    0x31, 0x88, 0x6f, 0x23, 0x0f, 0x00, 0x1a, 0x69, 0x0f, 0x00, 0x13, 0x6a, 0x2d, 0x00, 0x10, 0xac,
+    0xa4, 0x2e, 0x3a, 0x10, 0x00, 0x6b, 0x0f, 0x00, 0x1a, 0x6c, 0x0f, 0x00, 0x1a, 0x6d, 0x0f, 0x00,
+    0x1a, 0x6e, 0x69, 0x00, 0x12, 0x6f, 0x5a, 0x00, 0x31, 0x8a, 0x90, 0x39, 0x0f, 0x00, 0x1a, 0x70,
+    0x0a, 0x05, 0x1a, 0x70, 0x0a, 0x05, 0x1a, 0x70, 0x1c, 0x02, 0x1a, 0x70, 0x1c, 0x02, 0x1a, 0x71,
+    0x2a, 0x03, 0x1a, 0x71, 0x2a, 0x03, 0x1a, 0x71, 0x2a, 0x03, 0x1a, 0x71, 0x2a, 0x03, 0x21, 0x72,
+    0x02, 0xcd, 0x6c, 0x04, 0x5a, 0x00, 0x21, 0x72, 0x02, 0xcd, 0x6c, 0x04, 0x5a, 0x00, 0x51, 0x73,
+    0x02, 0x33, 0xbd, 0x0f, 0xe8, 0x17, 0x01, 0x1e, 0x00, 0x44, 0x73, 0x02, 0x33, 0xc0, 0x0f, 0x00,
+    0x4a, 0x01, 0x10, 0x00, 0x74, 0x1e, 0x00, 0x1a, 0x74, 0x1e, 0x00, 0x47, 0x75, 0x02, 0x33, 0xc3,
+    0xd2, 0x00, 0x47, 0x75, 0x02, 0x33, 0xc6, 0xd2, 0x00, 0x1a, 0x76, 0xb4, 0x00, 0x1a, 0x76, 0xb4,
+    0x00, 0x1a, 0x76, 0xb4, 0x00, 0x1a, 0x76, 0xb4, 0x00, 0x1a, 0x77, 0x3c, 0x00, 0x1a, 0x77, 0x3c,
+    0x00, 0x1a, 0x77, 0x3c, 0x00, 0x1a, 0x77, 0x3c, 0x00, 0x1a, 0x78, 0x3c, 0x00, 0x1a, 0x78, 0x3c,
+    0x00, 0x1a, 0x78, 0x3c, 0x00, 0x1a, 0x78, 0x3c, 0x00, 0x43, 0x79, 0x02, 0x22, 0x90, 0xb1, 0x03,
+    0x00, 0x9d, 0x7b, 0x43, 0x79, 0x02, 0x22, 0x92, 0x36, 0x06, 0x00, 0x99, 0x39, 0x47, 0x79, 0x02,
+    0x22, 0x94, 0xde, 0x03, 0x47, 0x79, 0x02, 0x22, 0x96, 0xde, 0x03, 0x15, 0x79, 0xa2, 0x03, 0x01,
+    0x3c, 0x1e, 0x1a, 0x79, 0xa2, 0x03, 0x47, 0x7a, 0x02, 0x22, 0x98, 0x4b, 0x00, 0x47, 0x7b, 0x02,
+    0x22, 0x9a, 0x69, 0x00, 0x4a, 0x7b, 0x02, 0x22, 0x9c, 0x1e, 0x00, 0x17, 0x9e, 0x69, 0x00, 0x1a,
+    0x7b, 0x0f, 0x0f, 0x47, 0x7b, 0x02, 0x22, 0xa0, 0x69, 0x00, 0x47, 0x7b, 0x02, 0x22, 0xa2, 0x69,
+    0x00, 0x47, 0x7c, 0x02, 0x22, 0xa4, 0x5a, 0x00, 0x47, 0x7c, 0x02, 0x22, 0xa6, 0x5a, 0x00, 0x47,
+    0x7c, 0x02, 0x22, 0xa8, 0x5a, 0x00, 0x47, 0x7c, 0x02, 0x22, 0xaa, 0x5a, 0x00, 0x47, 0x7c, 0x02,
+    0x22, 0xac, 0x5a, 0x00, 0x47, 0x7c, 0x02, 0x22, 0xae, 0x5a, 0x00, 0xa1, 0x7d, 0x02, 0x12, 0xb0,
+    0x1c, 0x00, 0x1a, 0xba, 0xa2, 0x49, 0x6c, 0x0c, 0x47, 0x7e, 0x02, 0x22, 0xb2, 0x69, 0x00, 0x47,
+    0x7e, 0x02, 0x22, 0xb4, 0x69, 0x00, 0x47, 0x7e, 0x02, 0x22, 0xb6, 0x69, 0x00, 0x47, 0x7e, 0x02,
+    0x22, 0xb8, 0x69, 0x00, 0x47, 0x7e, 0x02, 0x22, 0xba, 0x69, 0x00, 0x47, 0x7e, 0x02, 0x22, 0xbc,
+    0x69, 0x00, 0x47, 0x7f, 0x02, 0x22, 0xbe, 0x5a, 0x00, 0x47, 0x7f, 0x02, 0x22, 0xc0, 0x5a, 0x00,
+    0x47, 0x7f, 0x02, 0x22, 0xc2, 0x5a, 0x00, 0x47, 0x7f, 0x02, 0x22, 0xc4, 0x5a, 0x00, 0x47, 0x7f,
+    0x02, 0x22, 0xc6, 0x5a, 0x00, 0x47, 0x7f, 0x02, 0x22, 0xc8, 0x5a, 0x00, 0x1a, 0x80, 0xe0, 0x01,
+    0x1a, 0x80, 0xe0, 0x01, 0x1a, 0x80, 0xe0, 0x01, 0x1a, 0x80, 0xe0, 0x01, 0x1a, 0x80, 0xe0, 0x01,
+    0x1a, 0x80, 0xe0, 0x01, 0x1a, 0x81, 0xe0, 0x01, 0x1a, 0x82, 0xe0, 0x01, 0x1a, 0x82, 0xe0, 0x01,
+    0x1a, 0x82, 0xe0, 0x01, 0x1a, 0x82, 0xe0, 0x01, 0x1a, 0x82, 0x69, 0x00, 0x1a, 0x82, 0x69, 0x00,
+    0x1a, 0x83, 0xe0, 0x01, 0x1a, 0x83, 0xe0, 0x01, 0x1a, 0x83, 0xe0, 0x01, 0x1a, 0x83, 0xe0, 0x01,
+    0x1a, 0x83, 0x5a, 0x00, 0x1a, 0x83, 0x5a, 0x00, 0x1a, 0x84, 0xa1, 0x04, 0x1a, 0x84, 0xa1, 0x04,
+    0x1a, 0x84, 0xa1, 0x04, 0x1a, 0x84, 0xa1, 0x04, 0x1a, 0x85, 0x3c, 0x00, 0x1a, 0x85, 0x3c, 0x00,
+    0x1a, 0x85, 0x3c, 0x00, 0x1a, 0x85, 0x3c, 0x00, 0x13, 0x86, 0x3c, 0x00, 0x03, 0xf9, 0x06, 0x13,
+    0x86, 0x3c, 0x00, 0x03, 0xf9, 0x06, 0x1a, 0x86, 0x3c, 0x00, 0x1a, 0x86, 0x3c, 0x00, 0x1a, 0x87,
+    0x78, 0x00, 0x1a, 0x87, 0x78, 0x00, 0x1a, 0x87, 0x3c, 0x00, 0x1a, 0x87, 0x3c, 0x00, 0x1a, 0x88,
+    0x3c, 0x00, 0x1a, 0x88, 0x3c, 0x00, 0x1a, 0x88, 0x3c, 0x00, 0x1a, 0x88, 0x3c, 0x00, 0x1a, 0x89,
+    0x3c, 0x00, 0x1a, 0x89, 0x3c, 0x00, 0x1a, 0x89, 0x3c, 0x00, 0x1a, 0x89, 0x3c, 0x00, 0x1a, 0x8a,
+    0x3c, 0x00, 0x1a, 0x8a, 0x3c, 0x00, 0x1a, 0x8a, 0x3c, 0x00, 0x1a, 0x8a, 0x3c, 0x00, 0x1a, 0x8b,
+    0x3c, 0x00, 0x1a, 0x8b, 0x3c, 0x00, 0x1a, 0x8b, 0x3c, 0x00, 0x1a, 0x8b, 0x3c, 0x00, 0x20, 0x8d,
+    0x02, 0xb8, 0x90, 0x23, 0x37, 0x6c, 0xbb, 0x08, 0x20, 0x8d, 0x02, 0xa7, 0x90, 0x02, 0x0f, 0x00,
+    0x00, 0x82, 0x41, 0x91, 0x02, 0x11, 0xcc, 0x1e, 0x00, 0x00, 0x8c, 0x92, 0x3a, 0x07, 0x08, 0x54,
+    0x8e, 0x02, 0x11, 0x75, 0x06, 0x0f, 0x00, 0x67, 0x10, 0x00, 0x8f, 0x02, 0x22, 0xca, 0x58, 0x02,
+    0x1a, 0x8f, 0x78, 0x00, 0x47, 0x8f, 0x02, 0x22, 0xcc, 0x9d, 0x08, 0x1a, 0x8f, 0x78, 0x00, 0x1a,
+    0x90, 0x3c, 0x00, 0x1a, 0x90, 0x3c, 0x00, 0x1a, 0x90, 0x3c, 0x00, 0x1a, 0x90, 0x3c, 0x00, 0x1a,
+    0x91, 0x1e, 0x00, 0x1a, 0x91, 0x1e, 0x00, 0x1a, 0x92, 0x5a, 0x00, 0x1a, 0x92, 0x5a, 0x00, 0x1a,
+    0x92, 0x3c, 0x00, 0x1a, 0x92, 0x3c, 0x00, 0x47, 0x93, 0x02, 0x22, 0xce, 0x3c, 0x00, 0x47, 0x93,
+    0x02, 0x22, 0xd0, 0x2a, 0x03, 0x1a, 0x93, 0x3c, 0x00, 0x1a, 0x93, 0x3c, 0x00, 0x47, 0x94, 0x02,
+    0x22, 0xd2, 0x3c, 0x00, 0x47, 0x94, 0x02, 0x22, 0xd4, 0x3c, 0x00, 0x1a, 0x94, 0x3c, 0x00, 0x1a,
+    0x94, 0x3c, 0x00, 0x1a, 0x95, 0x1e, 0x00, 0x1a, 0x95, 0x1e, 0x00, 0x47, 0x96, 0x02, 0x22, 0xd6,
+    0x5a, 0x00, 0x47, 0x96, 0x02, 0x22, 0xd8, 0x5a, 0x00, 0x1a, 0x96, 0x3c, 0x00, 0x1a, 0x96, 0x3c,
+    0x00, 0x83, 0x97, 0x02, 0x13, 0xcf, 0x0f, 0x00, 0x00, 0x8e, 0x51, 0x09, 0x4a, 0x97, 0x02, 0x13,
+    0xd2, 0x0f, 0x00, 0x1a, 0xd5, 0x0f, 0x00, 0x1a, 0xd8, 0x0f, 0x00, 0x38, 0xdb, 0x0f, 0x04, 0x0f,
+    0x00, 0x10, 0xde, 0x0f, 0x00, 0x03, 0xd8, 0x09, 0x4a, 0x97, 0x02, 0x13, 0xe1, 0x0f, 0x00, 0x14,
+    0xe4, 0x2d, 0x00, 0x00, 0x72, 0x42, 0x35, 0x02, 0x13, 0xe7, 0x0f, 0x00, 0x01, 0x87, 0x00, 0x1a,
+    0xea, 0x4b, 0x00, 0x17, 0xed, 0x0f, 0x00, 0x20, 0x98, 0x02, 0xec, 0xb1, 0x05, 0x4b, 0x00, 0x30,
+    0x99, 0x02, 0x0a, 0x0d, 0x20, 0x13, 0x8e, 0xf6, 0x09, 0x74, 0x9a, 0x02, 0x03, 0xf0, 0x0f, 0x04,
+    0x20, 0x2d, 0x00, 0x40, 0x9b, 0x02, 0x03, 0xf3, 0x0f, 0x00, 0x03, 0x1e, 0x00, 0x40, 0x9c, 0x02,
+    0x03, 0xf6, 0x0f, 0x00, 0x03, 0x14, 0x0a, 0x74, 0x9d, 0x02, 0x34, 0x04, 0x06, 0x00, 0x2b, 0x90,
+    0x06, 0x1a, 0x9e, 0x23, 0x0a, 0x1a, 0x9e, 0x23, 0x0a, 0x1a, 0x9e, 0x23, 0x0a, 0x1a, 0x9e, 0x23,
+    0x0a, 0x80, 0x9f, 0x02, 0x23, 0xf9, 0x0f, 0x01, 0x22, 0x9c, 0x96, 0x00, 0x00, 0x4c, 0x2c, 0x35,
+    0x02, 0x23, 0xfc, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x38, 0xff, 0x0f, 0x00, 0x1e, 0x00, 0x24, 0x02,
+    0x10, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x53, 0x05, 0x10, 0x01, 0x22, 0x9c, 0x0e, 0x01, 0x45, 0x9f,
+    0x02, 0x23, 0x08, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x10, 0x0b, 0x2d, 0x00, 0x06, 0x1e, 0x00, 0x15,
+    0x0e, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a, 0x11, 0x3c, 0x00, 0x1a, 0x14, 0x3c, 0x00, 0x1a, 0x17,
+    0x3c, 0x00, 0x17, 0x1a, 0x3c, 0x00, 0x21, 0xa0, 0x02, 0xbf, 0x22, 0x13, 0xb0, 0x89, 0x1c, 0x21,
+    0xa0, 0x02, 0xbf, 0x22, 0x01, 0x0f, 0x00, 0x00, 0xf1, 0x2c, 0x14, 0x02, 0xb1, 0x21, 0x01, 0x98,
+    0x0d, 0x24, 0xa1, 0x02, 0xb1, 0x21, 0x01, 0x98, 0x0d, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0,
+    0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0,
+    0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0,
+    0x00, 0x1a, 0xa2, 0xf0, 0x00, 0x1a, 0xa2, 0xf0, 0x00, 0xa1, 0xa3, 0x02, 0x11, 0xcd, 0x1e, 0x00,
+    0x00, 0x98, 0x9a, 0x41, 0x1e, 0x00, 0x1a, 0xa4, 0x0f, 0x00, 0x40, 0xa5, 0x02, 0x03, 0x1d, 0x3c,
+    0xc1, 0x00, 0x98, 0x49, 0x70, 0x00, 0x20, 0x00, 0xa6, 0x02, 0x03, 0x20, 0x2b, 0xe2, 0x21, 0x83,
+    0x33, 0x0f, 0x00, 0x30, 0xa7, 0x02, 0x11, 0x63, 0xab, 0x31, 0x90, 0x94, 0x3c, 0x2d, 0x00, 0x30,
+    0xa7, 0x02, 0x11, 0x27, 0x15, 0x04, 0x0f, 0x00, 0xa1, 0xa8, 0x02, 0x04, 0x08, 0x06, 0x00, 0x00,
+    0x84, 0x8d, 0x38, 0x58, 0x02, 0x13, 0xa9, 0x4b, 0x00, 0x12, 0x95, 0x76, 0x02, 0x92, 0xaa, 0x02,
+    0x03, 0x23, 0x10, 0x00, 0x00, 0x92, 0x96, 0x52, 0x86, 0xa1, 0xab, 0x02, 0x12, 0xda, 0x1c, 0x00,
+    0x38, 0x94, 0x97, 0x3e, 0x3c, 0x00, 0x12, 0xac, 0x0f, 0x00, 0x31, 0x96, 0x98, 0x3f, 0x0f, 0x00,
+    0x12, 0xad, 0x5a, 0x00, 0x04, 0x22, 0x38, 0x12, 0xae, 0x78, 0x00, 0x04, 0x0f, 0x00, 0x36, 0xaf,
+    0x02, 0x02, 0xa5, 0x00, 0x60, 0x00, 0x00, 0xb0, 0x02, 0x03, 0x26, 0x0f, 0x00, 0x12, 0x99, 0xc6,
+    0x82, 0x83, 0xb1, 0x02, 0x14, 0x0c, 0x06, 0x05, 0x00, 0x9a, 0xe9, 0x34, 0x49, 0xb1, 0x02, 0x03,
+    0x0d, 0x0f, 0x00, 0x40, 0x14, 0x10, 0x06, 0x00, 0x0f, 0x00, 0x01, 0x36, 0x86, 0x47, 0xb1, 0x02,
+    0x03, 0x11, 0x0f, 0x00, 0x56, 0xb2, 0x02, 0x34, 0x14, 0x06, 0x9c, 0x09, 0x56, 0xb3, 0x02, 0x23,
+    0x29, 0x10, 0x0f, 0x00, 0x74, 0xb4, 0x02, 0x23, 0x2c, 0x10, 0x01, 0x27, 0xd1, 0x01, 0x45, 0xb4,
+    0x02, 0x23, 0x2f, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00, 0x38, 0xd7, 0x0d, 0x00, 0x1e, 0x00, 0x15,
+    0xda, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x10, 0x32, 0x2d, 0x00, 0x03, 0x95, 0x01, 0x45, 0xb4, 0x02,
+    0x23, 0x35, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x38, 0x38, 0x10, 0x00, 0x1e, 0x00, 0x15, 0x3b, 0x0f,
+    0x00, 0x01, 0x1e, 0x00, 0x1a, 0x3e, 0x3c, 0x00, 0x1a, 0x41, 0x3c, 0x00, 0x1a, 0x44, 0x3c, 0x00,
+    0x17, 0x47, 0x3c, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00,
+    0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00,
+    0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00, 0x1a, 0xb5, 0xb4, 0x00,
+    0x1a, 0xb5, 0xb4, 0x00, 0x21, 0xb7, 0x02, 0x3a, 0x95, 0x04, 0xd7, 0x46, 0x21, 0xb7, 0x02, 0x29,
+    0x95, 0x04, 0xd7, 0x46, 0x21, 0xb8, 0x02, 0x18, 0x95, 0x04, 0x1e, 0x00, 0x21, 0xb8, 0x02, 0x07,
+    0x95, 0x04, 0x1e, 0x00, 0x42, 0xb9, 0x02, 0x33, 0x56, 0x0f, 0x00, 0x01, 0x62, 0x25, 0x44, 0xb9,
+    0x02, 0x33, 0x59, 0x0f, 0x00, 0x00, 0x98, 0x2b, 0x37, 0x02, 0x33, 0x5c, 0x1e, 0x00, 0x47, 0xba,
+    0x02, 0x33, 0x5f, 0x1e, 0x00, 0x92, 0xbb, 0x02, 0x02, 0xdc, 0x1c, 0x00, 0x30, 0xb8, 0x6c, 0x58,
+    0x02, 0x1a, 0xbc, 0x1a, 0x04, 0x1a, 0xbc, 0x1a, 0x04, 0x1a, 0xbd, 0x1a, 0x04, 0x1a, 0xbd, 0x1a,
+    0x04, 0x27, 0xbe, 0x02, 0xae, 0x51, 0x94, 0x10, 0x00, 0xbf, 0x02, 0x02, 0xde, 0x1c, 0x00, 0x2a,
+    0x81, 0x33, 0x74, 0xc0, 0x02, 0x02, 0xe0, 0x1c, 0x00, 0x1b, 0x81, 0x51, 0x11, 0xc1, 0xa4, 0x01,
+    0x23, 0x35, 0xac, 0x86, 0x01, 0x11, 0xc1, 0xa4, 0x01, 0x03, 0x0f, 0x00, 0x10, 0x10, 0x0f, 0x00,
+    0x38, 0xd7, 0x0d, 0x00, 0x1e, 0x00, 0x15, 0xda, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x10, 0x32, 0x2d,
+    0x00, 0x03, 0x4a, 0x01, 0x11, 0xc1, 0xa4, 0x01, 0x03, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x38, 0x38,
+    0x10, 0x00, 0x1e, 0x00, 0x15, 0x3b, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a, 0x3e, 0x3c, 0x00, 0x1a,
+    0x41, 0x3c, 0x00, 0x1a, 0x44, 0x3c, 0x00, 0x17, 0x47, 0x3c, 0x00, 0x11, 0xc3, 0x7a, 0x1c, 0x02,
+    0xe1, 0x00, 0x00, 0x69, 0x86, 0x10, 0x02, 0x75, 0x5d, 0x14, 0x25, 0xa5, 0x3c, 0x20, 0xc4, 0x02,
+    0x75, 0x5d, 0x03, 0x0f, 0x00, 0x40, 0x50, 0x18, 0xc4, 0x02, 0x75, 0x5d, 0x08, 0x1e, 0x00, 0x15,
+    0x38, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a, 0x3b, 0x3c, 0x00, 0x15, 0x3e, 0x0f, 0x00, 0x10, 0x10,
+    0x0f, 0x00, 0x1a, 0x41, 0x3c, 0x00, 0x15, 0x44, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x13, 0x47, 0x2d,
+    0x00, 0x03, 0x87, 0x00, 0x13, 0x4a, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x14, 0x4d, 0x1e, 0x00, 0x02,
+    0x3c, 0x00, 0x15, 0x50, 0x0f, 0x00, 0x01, 0x78, 0x00, 0x14, 0x53, 0x2d, 0x00, 0x02, 0x1e, 0x00,
+    0x15, 0x56, 0x0f, 0x00, 0x01, 0x1e, 0x00, 0x0f, 0x3c, 0x00, 0x0b, 0x1a, 0x59, 0x3c, 0x00, 0x17,
+    0x5c, 0x3c, 0x00, 0x54, 0xc5, 0x02, 0x03, 0x62, 0x10, 0x28, 0x50, 0x74, 0x00, 0x03, 0xc5, 0x02,
+    0x04, 0x18, 0x06, 0x19, 0x50, 0x0d, 0x0f, 0x00, 0x54, 0xc6, 0x02, 0x03, 0x65, 0x10, 0x28, 0x50,
+    0x00, 0x0f, 0x00, 0x34, 0x04, 0x1c, 0x06, 0x19, 0x50, 0x0d, 0x0f, 0x00, 0x40, 0xc7, 0x02, 0x03,
+    0x68, 0x2d, 0x00, 0x02, 0xbc, 0x07, 0x50, 0x03, 0xc7, 0x02, 0x04, 0x20, 0x1e, 0x00, 0x0f, 0x0f,
+    0x00, 0x03, 0x40, 0xc8, 0x02, 0x03, 0x6b, 0x2d, 0x00, 0x03, 0x69, 0x00, 0x40, 0xc8, 0x02, 0x04,
+    0x24, 0x1e, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0xa1, 0xc9, 0x02, 0x02, 0xe2, 0x1c, 0x00, 0x37, 0x6a,
+    0xb1, 0x52, 0xec, 0x04, 0x1a, 0xca, 0x0f, 0x00, 0x20, 0xcb, 0x02, 0x27, 0x33, 0x05, 0x0f, 0x00,
+    0x53, 0xcc, 0x02, 0x11, 0x50, 0x06, 0x6f, 0x54, 0x42, 0x01, 0x00, 0x00, 0xcd, 0x87, 0x1e, 0x31,
+    0xa4, 0x9c, 0x43, 0x08, 0x00, 0x83, 0xce, 0x02, 0x12, 0xe4, 0x1c, 0x01, 0x1b, 0xa6, 0xd7, 0x55,
+    0x45, 0xce, 0x02, 0x12, 0xe6, 0x0f, 0x00, 0x31, 0x10, 0x00, 0xcf, 0x1e, 0x00, 0x14, 0x1d, 0x1e,
+    0x00, 0x11, 0xcf, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0xd0, 0x1e, 0x00, 0x14, 0x13,
+    0x1e, 0x00, 0x11, 0xd0, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0xd1, 0x1e, 0x00, 0x14,
+    0x16, 0x1e, 0x00, 0x11, 0xd1, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0xd2, 0x78, 0x00,
+    0x1a, 0xd2, 0x78, 0x00, 0x1a, 0xd3, 0x78, 0x00, 0x1a, 0xd3, 0x78, 0x00, 0x1a, 0xd4, 0x78, 0x00,
+    0x1a, 0xd4, 0x78, 0x00, 0x1a, 0xd5, 0x78, 0x00, 0x1a, 0xd5, 0x78, 0x00, 0x11, 0xd6, 0x1e, 0x00,
+    0x14, 0x08, 0x1e, 0x00, 0x11, 0xd6, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0xd7, 0x1e,
+    0x00, 0x14, 0x18, 0x1e, 0x00, 0x11, 0xd7, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00, 0xd8,
+    0x1e, 0x00, 0x14, 0x12, 0x1e, 0x00, 0x11, 0xd8, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x31, 0x10, 0x00,
+    0xd9, 0x1e, 0x00, 0x14, 0x14, 0x1e, 0x00, 0x11, 0xd9, 0x1e, 0x00, 0x03, 0x0f, 0x00, 0x3a, 0x10,
+    0x00, 0xda, 0x78, 0x00, 0x1a, 0xda, 0x78, 0x00, 0x1a, 0xdb, 0x78, 0x00, 0x1a, 0xdb, 0x78, 0x00,
+    0x1a, 0xdc, 0x78, 0x00, 0x1a, 0xdc, 0x78, 0x00, 0x18, 0xdd, 0xde, 0x03, 0x3a, 0x20, 0x00, 0xde,
+    0x87, 0x00, 0x1a, 0xde, 0x87, 0x00, 0x13, 0xdf, 0x85, 0x20, 0x21, 0xa3, 0x4a, 0x08, 0x00, 0x56,
+    0xe0, 0x02, 0x12, 0xe8, 0x1c, 0xc8, 0x37, 0x56, 0xe0, 0x02, 0x12, 0xea, 0x1c, 0xc8, 0x37, 0x12,
+    0xe1, 0x41, 0x0a, 0x31, 0xaa, 0x9f, 0x46, 0x55, 0x05, 0x12, 0xe1, 0x41, 0x0a, 0x01, 0x0f, 0x00,
+    0x00, 0x20, 0x2b, 0x0a, 0x1e, 0x00, 0x1a, 0xe2, 0x1e, 0x00, 0x1a, 0xe3, 0x1e, 0x00, 0x1a, 0xe3,
+    0x1e, 0x00, 0x12, 0xe4, 0x49, 0x20, 0x04, 0x1e, 0x00, 0x12, 0xe4, 0x49, 0x20, 0x04, 0x1e, 0x00,
+    0x1a, 0xe5, 0x3c, 0x00, 0x1a, 0xe5, 0x3c, 0x00, 0x1a, 0xe6, 0x1e, 0x00, 0x1a, 0xe6, 0x1e, 0x00,
+    0x40, 0xe7, 0x02, 0x23, 0x6e, 0xc1, 0x99, 0x03, 0x1e, 0x00, 0x44, 0xe7, 0x02, 0x23, 0x71, 0x0f,
+    0x00, 0x00, 0x32, 0x28, 0x37, 0x02, 0x23, 0x74, 0xbe, 0x05, 0x0e, 0x0f, 0x00, 0x17, 0x77, 0xcd,
+    0x05, 0x0e, 0x0f, 0x00, 0x10, 0x7a, 0x55, 0x05, 0x06, 0x2d, 0x00, 0x0b, 0x0f, 0x00, 0x15, 0x7d,
+    0x0f, 0x00, 0x01, 0x2d, 0x00, 0x0b, 0x0f, 0x00, 0x17, 0x80, 0xbe, 0x05, 0x0e, 0x0f, 0x00, 0x17,
+    0x83, 0xcd, 0x05, 0x0e, 0x0f, 0x00, 0x17, 0x86, 0xdc, 0x05, 0x0e, 0x0f, 0x00, 0x17, 0x89, 0xeb,
+    0x05, 0x0e, 0x0f, 0x00, 0x1a, 0x8c, 0x69, 0x00, 0x0b, 0x0f, 0x00, 0x1a, 0x8f, 0x69, 0x00, 0x0b,
+    0x0f, 0x00, 0x1a, 0x92, 0x69, 0x00, 0x0b, 0x0f, 0x00, 0x1a, 0x95, 0x69, 0x00, 0x08, 0x0f, 0x00,
+    0x83, 0xe9, 0x02, 0x34, 0x28, 0x06, 0x00, 0x35, 0xac, 0x0e, 0x2e, 0x45, 0xe9, 0x02, 0x34, 0x2c,
+    0x0f, 0x00, 0x01, 0x1e, 0x00, 0x1a, 0x30, 0x1e, 0x00, 0x17, 0x34, 0x1e, 0x00, 0x1a, 0xeb, 0x95,
+    0x01, 0x1a, 0xeb, 0x86, 0x01, 0x1a, 0xeb, 0x77, 0x01, 0x1a, 0xeb, 0x68, 0x01, 0x1a, 0xeb, 0x59,
+    0x01, 0x1a, 0xeb, 0x4a, 0x01, 0x1a, 0xeb, 0x3b, 0x01, 0x1a, 0xeb, 0x2c, 0x01, 0x1a, 0xeb, 0x1d,
+    0x01, 0x1a, 0xeb, 0x0e, 0x01, 0x1a, 0xeb, 0xff, 0x00, 0x1a, 0xeb, 0xf0, 0x00, 0x1a, 0xec, 0xf0,
+    0x00, 0x1a, 0xec, 0xf0, 0x00, 0x1a, 0xec, 0xf0, 0x00, 0x1a, 0xec, 0xf0, 0x00, 0x22, 0xee, 0x02,
+    0x37, 0x50, 0x03, 0xa7, 0x0d, 0x22, 0xee, 0x02, 0x37, 0x50, 0x03, 0xa7, 0x0d, 0x22, 0xef, 0x02,
+    0xea, 0x42, 0x03, 0xd9, 0x08, 0x22, 0xef, 0x02, 0x37, 0x50, 0x03, 0xd9, 0x08, 0x47, 0xf0, 0x02,
+    0x12, 0xec, 0xc0, 0x03, 0x47, 0xf0, 0x02, 0x12, 0xee, 0xc0, 0x03, 0x56, 0xf1, 0x02, 0x11, 0x3a,
+    0x0f, 0xa5, 0x5a, 0x54, 0xf2, 0x02, 0x12, 0xf0, 0x1c, 0x02, 0x3a, 0x01, 0x0f, 0x00, 0x15, 0xf2,
+    0x0f, 0x00, 0x65, 0x10, 0x00, 0xf4, 0x02, 0x12, 0xf4, 0x3c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x17,
+    0xf6, 0x4b, 0x00, 0x21, 0xf6, 0x02, 0x75, 0x30, 0x04, 0x67, 0x2f, 0x21, 0xf6, 0x02, 0x75, 0x30,
+    0x04, 0x67, 0x2f, 0x15, 0xf7, 0x7e, 0x09, 0x01, 0x1e, 0x00, 0x15, 0xf7, 0x7e, 0x09, 0x01, 0x1e,
+    0x00, 0x29, 0xf8, 0x02, 0x67, 0x2f, 0x29, 0xf8, 0x02, 0x67, 0x2f, 0x15, 0xf9, 0x9c, 0x09, 0x01,
+    0x1e, 0x00, 0x15, 0xf9, 0x9c, 0x09, 0x01, 0x1e, 0x00, 0x11, 0xfa, 0xcc, 0x06, 0x14, 0x06, 0xc2,
+    0x5b, 0x11, 0xfb, 0x0f, 0x00, 0x14, 0x45, 0x8d, 0x09, 0x11, 0xfc, 0x0f, 0x00, 0x14, 0x0d, 0x0f,
+    0x00, 0x12, 0xfd, 0x0a, 0x05, 0x04, 0xf0, 0x00, 0x29, 0xfe, 0x02, 0x95, 0x5b, 0x21, 0xff, 0x02,
+    0x84, 0x9d, 0x04, 0x1d, 0x3d, 0x54, 0x00, 0x03, 0x04, 0x38, 0x06, 0xeb, 0x32, 0x65, 0x80, 0x02,
+    0x00, 0x03, 0x05, 0x3a, 0x18, 0x33, 0x0d, 0x0f, 0x00, 0x54, 0x01, 0x03, 0x04, 0x3c, 0x06, 0xeb,
+    0x32, 0x00, 0x0f, 0x00, 0x25, 0x05, 0x3f, 0x18, 0x33, 0x0d, 0x0f, 0x00, 0x40, 0x02, 0x03, 0x04,
+    0x40, 0x2d, 0x00, 0x01, 0xda, 0x07, 0x00, 0x0f, 0x00, 0x25, 0x05, 0x44, 0xa0, 0x32, 0x0d, 0x0f,
+    0x00, 0x40, 0x03, 0x03, 0x04, 0x44, 0x2d, 0x00, 0x03, 0x69, 0x00, 0x45, 0x03, 0x03, 0x05, 0x49,
+    0x64, 0x32, 0x0d, 0x0f, 0x00, 0x47, 0x04, 0x03, 0x12, 0xfa, 0xc2, 0x01, 0x47, 0x04, 0x03, 0x12,
+    0xfc, 0xc2, 0x01, 0x29, 0x06, 0x03, 0x58, 0x5c, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03,
+    0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12,
+    0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66,
+    0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0xd6, 0x65, 0x29,
+    0x07, 0x03, 0xd6, 0x65, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x0f, 0x3c,
+    0x00, 0x0e, 0x08, 0x12, 0x66, 0x29, 0x07, 0x03, 0x12, 0x66, 0x29, 0x08, 0x03, 0x28, 0x32, 0x29,
+    0x08, 0x03, 0x28, 0x32, 0x29, 0x09, 0x03, 0x28, 0x32, 0x29, 0x09, 0x03, 0x28, 0x32, 0x29, 0x0a,
+    0x03, 0xc1, 0x02, 0x29, 0x0a, 0x03, 0xc1, 0x02, 0x29, 0x0b, 0x03, 0xc1, 0x02, 0x29, 0x0b, 0x03,
+    0xc1, 0x02, 0x81, 0x0c, 0x03, 0x01, 0xce, 0x1e, 0x00, 0x00, 0xba, 0xef, 0x01, 0xa3, 0x20, 0x00,
+    0x0d, 0x03, 0x06, 0xc1, 0x00, 0x05, 0x32, 0xb6, 0xd0, 0x11, 0x92, 0x0d, 0x03, 0x06, 0xc7, 0x00,
+    0x02, 0x32, 0xb6, 0x03, 0x1d, 0x01, 0x80, 0x0e, 0x03, 0x03, 0x98, 0x10, 0x00, 0x8f, 0xb6, 0xb1,
+    0x30, 0x02, 0x0f, 0x00, 0x17, 0x9b, 0x0f, 0x00, 0x81, 0x0f, 0x03, 0x04, 0x48, 0x06, 0x00, 0x80,
+    0xb8, 0x0f, 0x00, 0x10, 0x20, 0x0f, 0x00, 0x17, 0x4c, 0x0f, 0x00, 0x83, 0x10, 0x03, 0x06, 0xcd,
+    0x00, 0x00, 0xb1, 0xb8, 0x69, 0x00, 0x4a, 0x10, 0x03, 0x06, 0xd3, 0x0f, 0x00, 0x10, 0xd9, 0x0f,
+    0x00, 0x01, 0x69, 0x00, 0x94, 0x20, 0x00, 0x12, 0x03, 0x01, 0xcf, 0x1e, 0x00, 0x00, 0x23, 0x0a,
+    0x40, 0x12, 0x03, 0x01, 0xbb, 0x76, 0xf3, 0x03, 0x0f, 0x00, 0x20, 0x19, 0x03, 0x85, 0x5c, 0x05,
+    0xc2, 0x2e, 0x20, 0x19, 0x03, 0x85, 0x5c, 0x05, 0xc2, 0x2e, 0x20, 0x19, 0x03, 0x85, 0x5c, 0x08,
+    0x1e, 0x00, 0x17, 0xce, 0xe0, 0x2e, 0x20, 0x19, 0x03, 0x49, 0x5c, 0x05, 0xd1, 0x2e, 0x20, 0x19,
+    0x03, 0x49, 0x5c, 0x08, 0x0f, 0x00, 0x17, 0xfb, 0xa4, 0x2e, 0x0e, 0x0f, 0x00, 0x15, 0xfe, 0x0f,
+    0x00, 0x01, 0x4b, 0x00, 0x0b, 0x0f, 0x00, 0x26, 0x9d, 0x05, 0xc2, 0x2e, 0x0e, 0x0f, 0x00, 0x15,
+    0xa1, 0x0f, 0x00, 0x01, 0x2d, 0x00, 0x08, 0x0f, 0x00, 0x74, 0x1a, 0x03, 0x02, 0xfe, 0x1c, 0x00,
+    0x26, 0x1b, 0x03, 0x12, 0x20, 0x86, 0x96, 0x04, 0x4f, 0x47, 0xa1, 0x21, 0x03, 0x14, 0x50, 0x06,
+    0x00, 0x38, 0xd2, 0xb8, 0x59, 0x4b, 0x00, 0x20, 0x22, 0x03, 0xe9, 0x61, 0x41, 0x3c, 0x24, 0x53,
+    0x15, 0xe1, 0x00, 0x20, 0x22, 0x03, 0xe9, 0x61, 0x03, 0x0f, 0x00, 0x32, 0x10, 0x00, 0x25, 0xbb,
+    0xf4, 0x04, 0x0d, 0x02, 0x12, 0x25, 0xba, 0xf4, 0x04, 0x0d, 0x02, 0x12, 0x26, 0xb9, 0xf4, 0x04,
+    0x0d, 0x02, 0x12, 0x26, 0xb8, 0xf4, 0x04, 0x0d, 0x02, 0x40, 0x27, 0x03, 0x22, 0xb0, 0xde, 0xbc,
+    0x03, 0xfc, 0x30, 0x45, 0x27, 0x03, 0x22, 0xb3, 0x0f, 0x00, 0x3a, 0x10, 0x00, 0x28, 0x1e, 0x00,
+    0x1a, 0x28, 0x1e, 0x00, 0x12, 0x29, 0xb4, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x20, 0x2a,
+    0x03, 0x00, 0x0f, 0x14, 0x2b, 0xd2, 0x00, 0x74, 0x2b, 0x03, 0x11, 0xd0, 0x1e, 0x00, 0x00, 0xc3,
+    0x00, 0x1a, 0x2c, 0xd2, 0x00, 0x56, 0x2d, 0x03, 0x22, 0x00, 0x1d, 0x63, 0x06, 0x44, 0x2d, 0x03,
+    0x22, 0x02, 0x0f, 0x00, 0x00, 0x31, 0x65, 0x30, 0x03, 0x22, 0x04, 0x0f, 0x00, 0x03, 0x63, 0x06,
+    0x44, 0x2e, 0x03, 0x22, 0x06, 0x0f, 0x00, 0x00, 0xac, 0x26, 0x0a, 0x3c, 0x00, 0x1a, 0x2f, 0x3c,
+    0x00, 0x47, 0x30, 0x03, 0x22, 0x08, 0x3c, 0x00, 0x1a, 0x30, 0x3c, 0x00, 0x52, 0xcd, 0x03, 0x12,
+    0x0a, 0x1d, 0xa1, 0x40, 0x01, 0x7b, 0x0c, 0x33, 0x03, 0x12, 0xfb, 0xbd, 0x42, 0x00, 0x95, 0x01,
+    0x1a, 0xce, 0x1e, 0x00, 0x1a, 0xce, 0x1e, 0x00, 0x70, 0xab, 0x04, 0x01, 0x53, 0x05, 0x00, 0x2e,
+    0xb7, 0x48, 0x00, 0x01, 0x00, 0x61, 0xac, 0x04, 0x12, 0x16, 0x07, 0x00, 0xc6, 0x48, 0x00, 0xbf,
+    0x40, 0x30, 0xad, 0x04, 0x01, 0x45, 0x15, 0x22, 0xd0, 0xb5, 0x5c, 0x61, 0x11, 0xb4, 0x2d, 0x00,
+    0x12, 0xae, 0x2d, 0x00, 0x40, 0x20, 0x00, 0xb5, 0x04, 0x44, 0x61, 0x05, 0x09, 0x06, 0x12, 0xb6,
+    0x67, 0x9c, 0x04, 0x0f, 0x00, 0x1a, 0xdd, 0x4b, 0x00, 0x56, 0xde, 0x04, 0x12, 0x0c, 0x1d, 0x0f,
+    0x00, 0x54, 0xdf, 0x04, 0x23, 0x9e, 0x10, 0x3e, 0x49, 0x10, 0x20, 0x0f, 0x00, 0x15, 0xa1, 0x0f,
+    0x00, 0x01, 0x1e, 0x00, 0x24, 0xa4, 0x10, 0x4d, 0x49, 0x01, 0x1e, 0x00, 0x15, 0xa7, 0x0f, 0x00,
+    0x3a, 0x30, 0x00, 0xe0, 0x87, 0x00, 0x1a, 0xe1, 0x87, 0x00, 0x1a, 0xe2, 0x0f, 0x00, 0x47, 0xe9,
+    0x04, 0x23, 0xaa, 0x69, 0x00, 0x47, 0xe9, 0x04, 0x23, 0xad, 0x69, 0x00, 0x4a, 0xe9, 0x04, 0x23,
+    0xb0, 0x1e, 0x00, 0x17, 0xb3, 0x69, 0x00, 0x20, 0xea, 0x04, 0xf9, 0x06, 0x14, 0xab, 0x69, 0x00,
+    0x10, 0xeb, 0xd2, 0x00, 0x15, 0x02, 0xc3, 0x00, 0x00, 0x62, 0x89, 0x07, 0x79, 0x4a, 0x21, 0xc5,
+    0x06, 0xe7, 0x18, 0x04, 0x37, 0x14, 0x1a, 0xc6, 0x0f, 0x00, 0x47, 0xc7, 0x06, 0x03, 0xb6, 0x46,
+    0x14, 0x29, 0xc8, 0x06, 0x46, 0x14, 0x40, 0xc9, 0x06, 0x03, 0xb9, 0x40, 0xd2, 0x22, 0xb9, 0x5a,
+    0x6a, 0x0e, 0x37, 0x06, 0x04, 0x54, 0x37, 0x14, 0x20, 0xcb, 0x06, 0x2c, 0x3d, 0x01, 0x7b, 0x0c,
+    0x00, 0xa3, 0x02, 0x21, 0xcc, 0x06, 0x2c, 0x3d, 0x04, 0x0f, 0x00, 0x18, 0xcd, 0x1e, 0x00, 0x38,
+    0x30, 0x00, 0xce, 0x1e, 0x00, 0xc1, 0x30, 0x00, 0xcf, 0x06, 0x12, 0x0e, 0x1d, 0x00, 0x00, 0xc4,
+    0x9b, 0x42, 0x4b, 0x00, 0x56, 0xd0, 0x06, 0x23, 0xbc, 0x10, 0xbf, 0x5e, 0x45, 0xd0, 0x06, 0x23,
+    0xbf, 0x0f, 0x00, 0x76, 0x50, 0x18, 0xd0, 0x06, 0x23, 0xc2, 0x10, 0xbf, 0x5e, 0x45, 0xd0, 0x06,
+    0x23, 0xc5, 0x0f, 0x00, 0xa3, 0x50, 0x18, 0xd1, 0x06, 0x13, 0xc8, 0x10, 0x00, 0x00, 0x3a, 0x4b,
+    0x00, 0x56, 0xd2, 0x06, 0x22, 0xbc, 0x10, 0x0a, 0x41, 0x45, 0xd2, 0x06, 0x22, 0xbf, 0x0f, 0x00,
+    0x60, 0x50, 0x58, 0xd2, 0x06, 0x22, 0xc2, 0xf4, 0x38, 0x06, 0x1e, 0x00, 0x15, 0xc5, 0x0f, 0x00,
+    0x01, 0x1e, 0x00, 0x10, 0x10, 0xa9, 0xd1, 0x03, 0xb0, 0x04, 0x0b, 0x0f, 0x00, 0x30, 0xd3, 0x06,
+    0x08, 0x70, 0x02, 0x22, 0x7e, 0x84, 0xaf, 0x41, 0x1a, 0xd4, 0x0f, 0x00, 0x47, 0xd5, 0x06, 0x09,
+    0x4d, 0x0f, 0x00, 0x47, 0xd6, 0x06, 0x07, 0x96, 0x0f, 0x00, 0x1a, 0xd7, 0x1e, 0x00, 0x00, 0x9c,
+    0x8b, 0x16, 0x00, 0xb4, 0x00, 0xa1, 0xd9, 0x06, 0x04, 0x58, 0x06, 0x00, 0x00, 0xdc, 0xbc, 0x5d,
+    0x0f, 0x00, 0x52, 0xda, 0x06, 0x02, 0x12, 0x1d, 0xab, 0x45, 0x00, 0x28, 0x41, 0x29, 0xdb, 0x06,
+    0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad,
+    0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34,
+    0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29,
+    0xdb, 0x06, 0x71, 0x34, 0x29, 0xdb, 0x06, 0x71, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29, 0xdb,
+    0x06, 0xad, 0x34, 0x0f, 0x3c, 0x00, 0x0e, 0x08, 0xad, 0x34, 0x29, 0xdb, 0x06, 0xad, 0x34, 0x29,
+    0xdc, 0x06, 0xad, 0x34, 0x29, 0xdc, 0x06, 0xad, 0x34, 0x29, 0xdd, 0x06, 0xad, 0x34, 0x29, 0xdd,
+    0x06, 0xad, 0x34, 0x12, 0xde, 0x77, 0x01, 0x22, 0xbe, 0xb2, 0xc1, 0x65, 0x44, 0xdf, 0x06, 0x14,
+    0x5c, 0x77, 0x01, 0x4a, 0x01, 0x1a, 0x00, 0xe0, 0x0f, 0x00, 0x13, 0xe1, 0x0f, 0x00, 0x8a, 0xbf,
+    0x60, 0x00, 0x00, 0x01, 0x3a, 0x00, 0xe2, 0x0f, 0x00, 0x45, 0xe3, 0x06, 0x14, 0x60, 0x2d, 0x00,
+    0x3a, 0x15, 0x00, 0xe4, 0x0f, 0x00, 0x40, 0xe5, 0x06, 0x14, 0x64, 0x0f, 0x00, 0x21, 0xbd, 0x5e,
+    0x0f, 0x00, 0x1a, 0xe6, 0x0f, 0x00, 0x12, 0xe7, 0x2d, 0x00, 0x31, 0xde, 0xbe, 0x5f, 0x0f, 0x00,
+    0x1a, 0xe8, 0x0f, 0x00, 0x13, 0xe9, 0x2d, 0x00, 0x01, 0x69, 0x00, 0x3a, 0x35, 0x00, 0xea, 0x0f,
+    0x00, 0x45, 0xeb, 0x06, 0x04, 0x68, 0x2b, 0x02, 0x60, 0x20, 0x00, 0xec, 0x06, 0x06, 0xdf, 0x58,
+    0x02, 0x12, 0x85, 0x58, 0x02, 0x1a, 0xed, 0x0f, 0x00, 0x90, 0xee, 0x06, 0x04, 0x6c, 0x06, 0x00,
+    0x00, 0x7e, 0x87, 0x0f, 0x00, 0x60, 0x00, 0x00, 0xee, 0x06, 0x05, 0x4e, 0x70, 0x44, 0x01, 0x0f,
+    0x00, 0x3a, 0x80, 0x00, 0xef, 0x0e, 0x01, 0x20, 0xf0, 0x06, 0x56, 0x04, 0x23, 0x41, 0x6c, 0x94,
+    0x02, 0x07, 0xa0, 0xa1, 0x02, 0xcc, 0xa4, 0x11, 0x0f, 0x7c, 0x3a, 0x11, 0x0f, 0x66, 0x0b, 0x11,
+    0x0f, 0x8f, 0x06, 0x11, 0x0f, 0x21, 0x00, 0x10, 0x0f, 0x47, 0x07, 0x21, 0x00, 0x0f, 0x4d, 0x00,
+    0x21, 0x0f, 0x07, 0x06, 0x00, 0x01, 0x4d, 0xa5, 0x21, 0x0f, 0x0b, 0x06, 0x00, 0x11, 0x0c, 0x06,
+    0x00, 0x01, 0xc7, 0xa1, 0x21, 0x0f, 0x0e, 0x06, 0x00, 0x01, 0x4f, 0x00, 0x11, 0x0f, 0xd5, 0x9b,
+    0x11, 0x0f, 0xff, 0x9c, 0x00, 0x3d, 0xd2, 0xa0, 0x00, 0x00, 0x81, 0x15, 0x0e, 0x81, 0x16, 0x0e,
+    0x81, 0x17, 0x25, 0x00, 0x81, 0x81, 0xae, 0x00, 0x81, 0xaf, 0x00, 0x81, 0xb0, 0x1e, 0x00, 0x71,
+    0x13, 0x00, 0x81, 0xe1, 0x0d, 0x0f, 0x15, 0x0c, 0x00, 0x01, 0xc4, 0x14, 0x21, 0x0f, 0x19, 0x06,
+    0x00, 0x11, 0x1b, 0x06, 0x00, 0xf1, 0x46, 0x1d, 0x00, 0x81, 0x12, 0x00, 0x0f, 0x1f, 0x00, 0x81,
+    0xed, 0x06, 0x0f, 0x21, 0x00, 0x81, 0x4e, 0x01, 0x0f, 0x23, 0x00, 0x81, 0xcb, 0x00, 0x0f, 0x24,
+    0x00, 0x81, 0x86, 0x01, 0x0f, 0x27, 0x00, 0x81, 0xff, 0x0d, 0x0f, 0x29, 0x00, 0x81, 0x0f, 0x06,
+    0x0f, 0x2b, 0x00, 0x81, 0xeb, 0x02, 0x0f, 0x2d, 0x00, 0x81, 0xf1, 0x05, 0x0f, 0x2f, 0x00, 0x81,
+    0x42, 0x02, 0x0f, 0x30, 0x00, 0x81, 0xfc, 0x01, 0x0f, 0x33, 0x00, 0x81, 0x6a, 0x01, 0x0f, 0x34,
+    0x00, 0x81, 0xfa, 0x00, 0x0f, 0x37, 0x00, 0x8b, 0x98, 0x00, 0x0f, 0x39, 0x5a, 0x00, 0xd0, 0x3b,
+    0x00, 0x8b, 0x4a, 0x0d, 0x8b, 0x5b, 0x0d, 0x8b, 0x5c, 0x0d, 0x8b, 0x5d, 0xc1, 0x00, 0xe0, 0x0f,
+    0x3d, 0x00, 0x8b, 0xa0, 0x05, 0x8b, 0xb1, 0x05, 0x8b, 0xb2, 0x05, 0x8b, 0xb3, 0xf7, 0x00, 0xe1,
+    0x0f, 0x3f, 0x00, 0x8b, 0x2c, 0x0d, 0x8b, 0x3d, 0x0d, 0x8b, 0x3e, 0x0d, 0x8b, 0x3f, 0x24, 0x00,
+    0x01, 0x59, 0x9d, 0x20, 0x8b, 0x63, 0x1e, 0x00, 0x21, 0x8b, 0x64, 0x24, 0x00, 0xd0, 0x43, 0x00,
+    0x8b, 0x91, 0x00, 0x81, 0xd9, 0x01, 0x81, 0xda, 0x01, 0x81, 0xdb, 0x45, 0x01, 0x81, 0x81, 0x12,
+    0x0e, 0x81, 0x13, 0x0e, 0x81, 0x14, 0xea, 0x00, 0x71, 0xab, 0x00, 0x81, 0xac, 0x00, 0x81, 0xad,
+    0x72, 0x00, 0xf0, 0x4c, 0x45, 0x00, 0x81, 0xda, 0x0d, 0x0f, 0x47, 0x00, 0x81, 0x0b, 0x00, 0x0f,
+    0x49, 0x00, 0x81, 0xe6, 0x06, 0x0f, 0x4b, 0x00, 0x81, 0x0f, 0x01, 0x0f, 0x4d, 0x00, 0x81, 0xc4,
+    0x00, 0x0f, 0x4e, 0x00, 0x81, 0x7f, 0x01, 0x0f, 0x51, 0x00, 0x81, 0xf8, 0x0d, 0x0f, 0x53, 0x00,
+    0x81, 0x08, 0x06, 0x0f, 0x55, 0x00, 0x81, 0xe4, 0x02, 0x0f, 0x57, 0x00, 0x81, 0xea, 0x05, 0x0f,
+    0x59, 0x00, 0x81, 0x18, 0x02, 0x0f, 0x5b, 0x00, 0x81, 0x2b, 0x01, 0x0f, 0x5d, 0x00, 0x81, 0x26,
+    0x02, 0x0f, 0x5f, 0x00, 0x81, 0x39, 0x01, 0x81, 0xb1, 0x01, 0x81, 0xb2, 0x01, 0x81, 0xb3, 0x78,
+    0x00, 0x21, 0x0f, 0x61, 0x66, 0x00, 0x11, 0x62, 0x06, 0x00, 0x11, 0x63, 0x06, 0x00, 0x11, 0x64,
+    0x06, 0x00, 0x11, 0x65, 0x06, 0x00, 0x11, 0x66, 0x06, 0x00, 0x11, 0x67, 0x06, 0x00, 0x11, 0x69,
+    0x06, 0x00, 0x11, 0x6b, 0x06, 0x00, 0x11, 0x6c, 0x06, 0x00, 0x11, 0x6d, 0x06, 0x00, 0x11, 0x6e,
+    0x06, 0x00, 0x11, 0x6f, 0x06, 0x00, 0x11, 0x70, 0x06, 0x00, 0x11, 0x71, 0xbc, 0x01, 0x71, 0x0f,
+    0x0e, 0x81, 0x10, 0x0e, 0x81, 0x11, 0xd2, 0x00, 0x71, 0xa8, 0x00, 0x81, 0xa9, 0x00, 0x81, 0xaa,
+    0x1e, 0x00, 0x71, 0x72, 0x00, 0x81, 0xd3, 0x0d, 0x0f, 0x74, 0x0c, 0x00, 0x11, 0x76, 0x06, 0x00,
+    0x11, 0x78, 0x06, 0x00, 0x11, 0x7a, 0x06, 0x00, 0xf1, 0x22, 0x7c, 0x00, 0x81, 0x04, 0x00, 0x0f,
+    0x7e, 0x00, 0x81, 0xdf, 0x06, 0x0f, 0x80, 0x00, 0x81, 0xec, 0x00, 0x0f, 0x82, 0x00, 0x81, 0x47,
+    0x01, 0x0f, 0x84, 0x00, 0x81, 0xf1, 0x0d, 0x0f, 0x86, 0x00, 0x81, 0x01, 0x06, 0x0f, 0x88, 0x00,
+    0x81, 0xdd, 0x02, 0x0f, 0x8a, 0x00, 0x81, 0xe3, 0x05, 0x0f, 0x8c, 0x36, 0x00, 0x11, 0x8d, 0x06,
+    0x00, 0x11, 0x8e, 0x06, 0x00, 0x11, 0x8f, 0x06, 0x00, 0x11, 0x90, 0x06, 0x00, 0x11, 0x92, 0x06,
+    0x00, 0x11, 0x93, 0x06, 0x00, 0x01, 0x93, 0x9d, 0x21, 0x0f, 0x95, 0x06, 0x00, 0x00, 0x88, 0x05,
+    0x31, 0x00, 0x0f, 0x97, 0x06, 0x00, 0x11, 0x98, 0x06, 0x00, 0x11, 0x9a, 0x06, 0x00, 0x11, 0x9b,
+    0x06, 0x00, 0x11, 0x9c, 0x06, 0x00, 0x11, 0x9d, 0x06, 0x00, 0x01, 0x88, 0x5f, 0x21, 0x0f, 0x9f,
+    0x06, 0x00, 0x11, 0xa0, 0x06, 0x00, 0x11, 0xa2, 0x06, 0x00, 0x01, 0x19, 0x5f, 0x21, 0x0f, 0xa6,
+    0x06, 0x00, 0x11, 0xa8, 0x06, 0x00, 0x11, 0xa9, 0x06, 0x00, 0x02, 0xe4, 0x00, 0x11, 0xab, 0x06,
+    0x00, 0x11, 0xac, 0x06, 0x00, 0x02, 0xc8, 0x01, 0x11, 0xae, 0x06, 0x00, 0x11, 0xaf, 0x06, 0x00,
+    0x02, 0xc4, 0x02, 0x11, 0xb1, 0x06, 0x00, 0x11, 0xb2, 0x06, 0x00, 0x11, 0xb4, 0x06, 0x00, 0x11,
+    0xb5, 0x06, 0x00, 0x11, 0xb6, 0x06, 0x00, 0x11, 0xb7, 0x06, 0x00, 0x11, 0xb8, 0x06, 0x00, 0x11,
+    0xb9, 0x06, 0x00, 0x11, 0xba, 0x06, 0x00, 0x11, 0xbb, 0x06, 0x00, 0x11, 0xbc, 0x06, 0x00, 0x11,
+    0xbd, 0x06, 0x00, 0x11, 0xbe, 0x06, 0x00, 0x11, 0xbf, 0x06, 0x00, 0x00, 0xab, 0x9e, 0x21, 0x00,
+    0x0f, 0x4e, 0x5d, 0x21, 0x0f, 0xca, 0x06, 0x00, 0x11, 0xcb, 0x06, 0x00, 0x11, 0xcc, 0x06, 0x00,
+    0x11, 0xcd, 0x06, 0x00, 0x11, 0xcf, 0x06, 0x00, 0x11, 0xd1, 0x06, 0x00, 0x11, 0xd2, 0x06, 0x00,
+    0x11, 0xd3, 0x06, 0x00, 0x01, 0xa3, 0x9f, 0x11, 0x0f, 0xd5, 0xa2, 0x21, 0x0f, 0xd6, 0x06, 0x00,
+    0xf1, 0x22, 0xd8, 0x00, 0x81, 0x49, 0x02, 0x0f, 0xd9, 0x00, 0x81, 0x03, 0x02, 0x0f, 0xdc, 0x00,
+    0x81, 0x71, 0x01, 0x0f, 0xdd, 0x00, 0x81, 0x01, 0x01, 0x0f, 0xe0, 0x00, 0x81, 0x3b, 0x02, 0x0f,
+    0xe1, 0x00, 0x81, 0xf5, 0x01, 0x0f, 0xe4, 0x00, 0x81, 0x63, 0x01, 0x0f, 0xe5, 0x00, 0x81, 0xf3,
+    0x00, 0x0f, 0xe8, 0x36, 0x00, 0x11, 0xe9, 0x06, 0x00, 0x11, 0xea, 0x06, 0x00, 0x11, 0xeb, 0x06,
+    0x00, 0x11, 0xec, 0x06, 0x00, 0x11, 0xed, 0x06, 0x00, 0x11, 0xee, 0x06, 0x00, 0x11, 0xef, 0x06,
+    0x00, 0x11, 0xf0, 0x06, 0x00, 0x01, 0x4c, 0x59, 0x81, 0x0f, 0xf2, 0x00, 0x8b, 0x8a, 0x00, 0x0f,
+    0xf4, 0x0c, 0x00, 0x11, 0xf5, 0x06, 0x00, 0x11, 0xf6, 0x06, 0x00, 0x11, 0xf7, 0x06, 0x00, 0x11,
+    0xf9, 0x06, 0x00, 0x11, 0xfa, 0x06, 0x00, 0x11, 0xfb, 0x06, 0x00, 0x11, 0xfc, 0x06, 0x00, 0x11,
+    0xfd, 0x06, 0x00, 0x11, 0xfe, 0x06, 0x00, 0x11, 0xff, 0x06, 0x00, 0x00, 0xb5, 0x06, 0x21, 0x00,
+    0x0f, 0xde, 0x57, 0x10, 0x0f, 0x89, 0x2f, 0x21, 0x00, 0x0f, 0x20, 0xc8, 0x21, 0x0f, 0x05, 0x06,
+    0x00, 0x00, 0xcd, 0x48, 0x31, 0x00, 0x0f, 0x07, 0x06, 0x00, 0x11, 0x08, 0x06, 0x00, 0x11, 0x09,
+    0x06, 0x00, 0x11, 0x0a, 0x06, 0x00, 0x00, 0x10, 0x6f, 0x31, 0x00, 0x0f, 0x0c, 0x06, 0x00, 0x01,
+    0xdb, 0x04, 0x21, 0x0f, 0x10, 0x06, 0x00, 0x11, 0x11, 0x06, 0x00, 0x01, 0xd9, 0x56, 0x21, 0x0f,
+    0x13, 0x06, 0x00, 0x01, 0x7e, 0x4b, 0x21, 0x0f, 0x15, 0x06, 0x00, 0x00, 0x03, 0x49, 0x31, 0x00,
+    0x0f, 0x19, 0x06, 0x00, 0x11, 0x1a, 0x06, 0x00, 0x11, 0x1b, 0x06, 0x00, 0x11, 0x1c, 0x06, 0x00,
+    0x11, 0x1d, 0x06, 0x00, 0x11, 0x1e, 0x06, 0x00, 0x11, 0x1f, 0x06, 0x00, 0x11, 0x20, 0x06, 0x00,
+    0x11, 0x21, 0x06, 0x00, 0x11, 0x22, 0x06, 0x00, 0x11, 0x23, 0x06, 0x00, 0x11, 0x24, 0x06, 0x00,
+    0x01, 0x24, 0x54, 0x21, 0x0f, 0x26, 0x06, 0x00, 0x71, 0x27, 0x01, 0x81, 0xee, 0x01, 0x0f, 0x29,
+    0x0c, 0x00, 0x11, 0x2a, 0x06, 0x00, 0x11, 0x2b, 0x06, 0x00, 0x11, 0x2c, 0x06, 0x00, 0x11, 0x2d,
+    0x06, 0x00, 0x11, 0x2e, 0x06, 0x00, 0x11, 0x2f, 0x06, 0x00, 0x11, 0x30, 0x06, 0x00, 0x11, 0x31,
+    0x06, 0x00, 0x11, 0x34, 0x06, 0x00, 0x11, 0x35, 0x06, 0x00, 0x11, 0x36, 0x06, 0x00, 0x11, 0x37,
+    0x06, 0x00, 0x11, 0x38, 0x06, 0x00, 0x11, 0x39, 0x06, 0x00, 0x11, 0x3a, 0x06, 0x00, 0x11, 0x3b,
+    0x06, 0x00, 0x11, 0x3e, 0x06, 0x00, 0x11, 0x3f, 0x06, 0x00, 0x11, 0x40, 0x06, 0x00, 0x11, 0x41,
+    0x06, 0x00, 0x11, 0x42, 0x06, 0x00, 0x11, 0x43, 0x06, 0x00, 0x11, 0x44, 0x06, 0x00, 0x11, 0x46,
+    0x06, 0x00, 0x11, 0x47, 0x06, 0x00, 0x11, 0x48, 0x06, 0x00, 0x11, 0x49, 0x06, 0x00, 0x11, 0x4a,
+    0x06, 0x00, 0x11, 0x4b, 0x06, 0x00, 0x11, 0x4c, 0x06, 0x00, 0x11, 0x4d, 0x06, 0x00, 0x00, 0x60,
+    0x06, 0x31, 0x00, 0x0f, 0x50, 0x06, 0x00, 0x11, 0x52, 0x06, 0x00, 0x00, 0xea, 0xac, 0x31, 0x00,
+    0x0f, 0x54, 0x06, 0x00, 0x11, 0x55, 0x06, 0x00, 0x11, 0x56, 0x06, 0x00, 0x00, 0xb2, 0xcc, 0x31,
+    0x00, 0x0f, 0x59, 0x06, 0x00, 0x11, 0x5a, 0x06, 0x00, 0x11, 0x5b, 0x06, 0x00, 0x11, 0x5c, 0x06,
+    0x00, 0x00, 0x10, 0xad, 0x31, 0x00, 0x0f, 0x5e, 0x06, 0x00, 0x11, 0x60, 0x06, 0x00, 0x00, 0xc2,
+    0xcc, 0x31, 0x00, 0x0f, 0x63, 0x06, 0x00, 0x11, 0x64, 0x06, 0x00, 0x11, 0x65, 0x06, 0x00, 0x11,
+    0x66, 0x06, 0x00, 0x00, 0x30, 0xad, 0x91, 0x00, 0x0f, 0x68, 0x01, 0x81, 0x16, 0x01, 0x0f, 0x69,
+    0x0c, 0x00, 0x11, 0x6a, 0x06, 0x00, 0x11, 0x6b, 0x06, 0x00, 0x11, 0x6e, 0x06, 0x00, 0x11, 0x6f,
+    0x06, 0x00, 0x11, 0x72, 0x06, 0x00, 0x11, 0x73, 0x06, 0x00, 0x00, 0xd6, 0xcc, 0x31, 0x00, 0x0f,
+    0x77, 0x06, 0x00, 0x11, 0x78, 0x06, 0x00, 0x11, 0x79, 0x06, 0x00, 0x11, 0x7a, 0x06, 0x00, 0x00,
+    0x64, 0xad, 0x31, 0x00, 0x0f, 0x7c, 0x06, 0x00, 0x11, 0x7d, 0x06, 0x00, 0x11, 0x7e, 0x06, 0x00,
+    0x11, 0x7f, 0x06, 0x00, 0x00, 0xf2, 0xcc, 0x31, 0x00, 0x0f, 0x81, 0x06, 0x00, 0x11, 0x82, 0x06,
+    0x00, 0x11, 0x83, 0x06, 0x00, 0x11, 0x84, 0x06, 0x00, 0x11, 0x86, 0x06, 0x00, 0x11, 0x88, 0x06,
+    0x00, 0x11, 0x89, 0x06, 0x00, 0x00, 0x02, 0xcd, 0x31, 0x00, 0x0f, 0x8b, 0x06, 0x00, 0x11, 0x8c,
+    0x06, 0x00, 0x11, 0x8d, 0x06, 0x00, 0x11, 0x8e, 0x06, 0x00, 0x01, 0x71, 0x4f, 0x21, 0x0f, 0x90,
+    0x06, 0x00, 0x11, 0x91, 0x06, 0x00, 0x11, 0x92, 0x06, 0x00, 0x11, 0x93, 0x06, 0x00, 0x00, 0x1e,
+    0xcd, 0x31, 0x00, 0x0f, 0x95, 0x06, 0x00, 0x11, 0x96, 0x06, 0x00, 0x11, 0x97, 0x06, 0x00, 0x11,
+    0x98, 0x06, 0x00, 0x00, 0xdc, 0xad, 0x31, 0x00, 0x0f, 0x9c, 0x06, 0x00, 0x00, 0x28, 0xcd, 0x31,
+    0x00, 0x0f, 0xa0, 0x06, 0x00, 0x11, 0xa1, 0x06, 0x00, 0xf0, 0x0a, 0xa3, 0x01, 0x81, 0x93, 0x0d,
+    0x0f, 0xa4, 0x01, 0x81, 0x85, 0x0d, 0x81, 0xa0, 0x0d, 0x81, 0xa1, 0x0d, 0x81, 0x9a, 0x0d, 0x81,
+    0x9b, 0x0d, 0x81, 0xa2, 0xae, 0x06, 0x21, 0x81, 0x9c, 0xb4, 0x06, 0x11, 0xa7, 0x2a, 0x00, 0x11,
+    0xa8, 0x06, 0x00, 0x11, 0xa9, 0x06, 0x00, 0x11, 0xaa, 0x06, 0x00, 0x11, 0xab, 0x06, 0x00, 0x01,
+    0x6a, 0x4d, 0x21, 0x0f, 0xad, 0x06, 0x00, 0x11, 0xae, 0x06, 0x00, 0x11, 0xaf, 0x06, 0x00, 0x11,
+    0xb0, 0x06, 0x00, 0x11, 0xb1, 0x06, 0x00, 0x11, 0xb2, 0x06, 0x00, 0x02, 0x66, 0x06, 0x11, 0xb4,
+    0x06, 0x00, 0x11, 0xb7, 0x06, 0x00, 0x11, 0xb9, 0x06, 0x00, 0x11, 0xba, 0x06, 0x00, 0x11, 0xbb,
+    0x06, 0x00, 0x11, 0xbc, 0x06, 0x00, 0x11, 0xbf, 0x06, 0x00, 0x11, 0xc0, 0x06, 0x00, 0x11, 0xc1,
+    0x06, 0x00, 0x11, 0xc2, 0x06, 0x00, 0x11, 0xc5, 0x06, 0x00, 0x11, 0xc6, 0x06, 0x00, 0x11, 0xc7,
+    0x06, 0x00, 0x11, 0xc8, 0x06, 0x00, 0x11, 0xcb, 0x06, 0x00, 0x11, 0xcc, 0x06, 0x00, 0x11, 0xcd,
+    0x06, 0x00, 0x11, 0xce, 0x06, 0x00, 0x11, 0xd1, 0x06, 0x00, 0x11, 0xd2, 0x06, 0x00, 0xf0, 0x0a,
+    0xd5, 0x01, 0x81, 0x89, 0x05, 0x0f, 0xd6, 0x01, 0x81, 0x7b, 0x05, 0x81, 0x96, 0x05, 0x81, 0x97,
+    0x05, 0x81, 0x90, 0x05, 0x81, 0x91, 0x05, 0x81, 0x98, 0x86, 0x07, 0x21, 0x81, 0x92, 0x8c, 0x07,
+    0x11, 0xd9, 0x2a, 0x00, 0x11, 0xda, 0x06, 0x00, 0x11, 0xdd, 0x06, 0x00, 0x11, 0xde, 0x06, 0x00,
+    0x11, 0xe1, 0x06, 0x00, 0x11, 0xe2, 0x06, 0x00, 0x11, 0xe5, 0x06, 0x00, 0x11, 0xe6, 0x06, 0x00,
+    0x11, 0xe9, 0x06, 0x00, 0x10, 0xea, 0x06, 0x00, 0x11, 0x81, 0xc5, 0x08, 0x21, 0x81, 0x0d, 0x06,
+    0x00, 0x00, 0x12, 0x80, 0x31, 0x00, 0x81, 0x0e, 0x3e, 0x01, 0x11, 0xed, 0x24, 0x00, 0x11, 0xee,
+    0x24, 0x00, 0x11, 0x6f, 0x18, 0x00, 0x11, 0x6d, 0x06, 0x00, 0x11, 0x70, 0x06, 0x00, 0x11, 0x6e,
+    0x24, 0x00, 0x11, 0xf1, 0x24, 0x00, 0x11, 0xf3, 0x06, 0x00, 0x11, 0xf5, 0x06, 0x00, 0x11, 0xf7,
+    0x06, 0x00, 0x11, 0xf9, 0x06, 0x00, 0x11, 0xfa, 0x06, 0x00, 0x11, 0xfb, 0x06, 0x00, 0x11, 0xfc,
+    0x06, 0x00, 0x11, 0xfd, 0x06, 0x00, 0x11, 0xfe, 0x06, 0x00, 0x00, 0xaf, 0x51, 0x21, 0x00, 0x0f,
+    0x41, 0x3a, 0x21, 0x0f, 0x03, 0x06, 0x00, 0x11, 0x04, 0x06, 0x00, 0x11, 0x05, 0x06, 0x00, 0x11,
+    0x06, 0x06, 0x00, 0x11, 0x07, 0x06, 0x00, 0x11, 0x08, 0x06, 0x00, 0x11, 0x09, 0x06, 0x00, 0x11,
+    0x0a, 0x06, 0x00, 0x00, 0xe7, 0x73, 0x31, 0x00, 0x0f, 0x0c, 0x06, 0x00, 0x11, 0x0d, 0x06, 0x00,
+    0x11, 0x0e, 0x06, 0x00, 0x01, 0xc7, 0x09, 0x10, 0x0f, 0xc0, 0xac, 0x31, 0x00, 0x0f, 0x11, 0x06,
+    0x00, 0x11, 0x12, 0x06, 0x00, 0x11, 0x13, 0x06, 0x00, 0x01, 0x81, 0x21, 0x21, 0x0f, 0x17, 0x06,
+    0x00, 0x00, 0x0c, 0xad, 0x31, 0x00, 0x0f, 0x1b, 0x06, 0x00, 0x11, 0x1c, 0x06, 0x00, 0x11, 0x1d,
+    0x06, 0x00, 0x11, 0x1e, 0x06, 0x00, 0x11, 0x1f, 0x06, 0x00, 0x11, 0x20, 0x06, 0x00, 0x11, 0x21,
+    0x06, 0x00, 0x11, 0x22, 0x06, 0x00, 0x11, 0x25, 0x06, 0x00, 0x11, 0x26, 0x06, 0x00, 0x11, 0x27,
+    0x06, 0x00, 0x11, 0x28, 0x06, 0x00, 0x11, 0x2b, 0x06, 0x00, 0x11, 0x2c, 0x06, 0x00, 0x11, 0x2d,
+    0x06, 0x00, 0x11, 0x2e, 0x06, 0x00, 0x11, 0x2f, 0x06, 0x00, 0x11, 0x30, 0x06, 0x00, 0x11, 0x33,
+    0x06, 0x00, 0x11, 0x34, 0x06, 0x00, 0x11, 0x37, 0x06, 0x00, 0x11, 0x38, 0x06, 0x00, 0x11, 0x39,
+    0x06, 0x00, 0x11, 0x3a, 0x06, 0x00, 0x11, 0x3b, 0x06, 0x00, 0x11, 0x3c, 0x06, 0x00, 0x11, 0x3d,
+    0x06, 0x00, 0x11, 0x3e, 0x06, 0x00, 0x11, 0x3f, 0x06, 0x00, 0x11, 0x40, 0x06, 0x00, 0x11, 0x41,
+    0x06, 0x00, 0x11, 0x42, 0x06, 0x00, 0x11, 0x43, 0x06, 0x00, 0x11, 0x44, 0x06, 0x00, 0x11, 0x45,
+    0x06, 0x00, 0x11, 0x48, 0x06, 0x00, 0x11, 0x49, 0x06, 0x00, 0x11, 0x4c, 0x06, 0x00, 0x11, 0x4e,
+    0x06, 0x00, 0x11, 0x4f, 0x06, 0x00, 0x11, 0x50, 0x06, 0x00, 0x11, 0x51, 0x06, 0x00, 0x11, 0x52,
+    0x06, 0x00, 0x11, 0x53, 0x06, 0x00, 0x11, 0x54, 0x06, 0x00, 0x11, 0x55, 0x06, 0x00, 0x11, 0x56,
+    0x06, 0x00, 0x11, 0x57, 0x06, 0x00, 0x11, 0x58, 0x06, 0x00, 0x11, 0x59, 0x06, 0x00, 0x11, 0x5a,
+    0x06, 0x00, 0x11, 0x5b, 0x06, 0x00, 0x11, 0x5c, 0x06, 0x00, 0x11, 0x5d, 0x06, 0x00, 0x11, 0x5e,
+    0x06, 0x00, 0x11, 0x5f, 0x06, 0x00, 0x11, 0x60, 0x06, 0x00, 0x11, 0x61, 0x06, 0x00, 0x11, 0x62,
+    0x06, 0x00, 0x11, 0x63, 0x06, 0x00, 0x11, 0x64, 0x06, 0x00, 0x11, 0x65, 0x06, 0x00, 0x11, 0x66,
+    0x06, 0x00, 0x11, 0x67, 0x06, 0x00, 0x11, 0x68, 0x06, 0x00, 0x11, 0x69, 0x06, 0x00, 0x11, 0x6a,
+    0x06, 0x00, 0x11, 0x6b, 0x06, 0x00, 0xf0, 0x22, 0x6c, 0x02, 0x81, 0xc7, 0x03, 0x0f, 0x6d, 0x02,
+    0x81, 0xb9, 0x03, 0x0f, 0x70, 0x02, 0x81, 0x60, 0x04, 0x0f, 0x71, 0x02, 0x81, 0x52, 0x04, 0x0f,
+    0x74, 0x02, 0x81, 0x63, 0x03, 0x0f, 0x75, 0x02, 0x81, 0x55, 0x03, 0x81, 0x70, 0x03, 0x81, 0x71,
+    0x03, 0x81, 0x6a, 0x03, 0x81, 0x6b, 0x03, 0x81, 0x72, 0xb9, 0x0b, 0x20, 0x81, 0x6c, 0x06, 0x00,
+    0xf0, 0x0b, 0x0f, 0x78, 0x02, 0x81, 0x06, 0x04, 0x0f, 0x79, 0x02, 0x81, 0xf8, 0x03, 0x81, 0x13,
+    0x04, 0x81, 0x14, 0x04, 0x81, 0x0d, 0x04, 0x81, 0x0e, 0x04, 0x81, 0x15, 0xd7, 0x0b, 0x11, 0x81,
+    0xdd, 0x0b, 0xf1, 0x0b, 0x0f, 0x7c, 0x02, 0x81, 0xa9, 0x04, 0x0f, 0x7d, 0x02, 0x81, 0x9b, 0x04,
+    0x81, 0xb6, 0x04, 0x81, 0xb7, 0x04, 0x81, 0xb0, 0x04, 0x81, 0xb1, 0x04, 0x81, 0xb8, 0x24, 0x00,
+    0x11, 0xb2, 0x24, 0x00, 0xf1, 0x0a, 0x80, 0x02, 0x81, 0x03, 0x05, 0x0f, 0x81, 0x02, 0x81, 0xf5,
+    0x04, 0x81, 0x10, 0x05, 0x81, 0x11, 0x05, 0x81, 0x0a, 0x05, 0x81, 0x0b, 0x05, 0x81, 0x12, 0x78,
+    0x03, 0x11, 0x0c, 0x78, 0x03, 0x11, 0x84, 0xae, 0x00, 0x11, 0x85, 0x06, 0x00, 0x11, 0x86, 0x06,
+    0x00, 0x11, 0x87, 0x06, 0x00, 0x11, 0x88, 0x06, 0x00, 0x11, 0x89, 0x06, 0x00, 0x11, 0x8a, 0x06,
+    0x00, 0x11, 0x8b, 0x06, 0x00, 0xf1, 0x22, 0x8c, 0x02, 0x81, 0xdc, 0x03, 0x0f, 0x8d, 0x02, 0x81,
+    0xce, 0x03, 0x0f, 0x90, 0x02, 0x81, 0x75, 0x04, 0x0f, 0x91, 0x02, 0x81, 0x67, 0x04, 0x0f, 0x94,
+    0x02, 0x81, 0x81, 0x03, 0x0f, 0x95, 0x02, 0x81, 0x73, 0x03, 0x81, 0x8e, 0x03, 0x81, 0x8f, 0x03,
+    0x81, 0x88, 0x03, 0x81, 0x89, 0x03, 0x81, 0x90, 0xd8, 0x00, 0x11, 0x8a, 0xd8, 0x00, 0xf1, 0x0a,
+    0x98, 0x02, 0x81, 0x24, 0x04, 0x0f, 0x99, 0x02, 0x81, 0x16, 0x04, 0x81, 0x31, 0x04, 0x81, 0x32,
+    0x04, 0x81, 0x2b, 0x04, 0x81, 0x2c, 0x04, 0x81, 0x33, 0xb4, 0x00, 0x11, 0x2d, 0xb4, 0x00, 0xf1,
+    0x0a, 0x9c, 0x02, 0x81, 0xc7, 0x04, 0x0f, 0x9d, 0x02, 0x81, 0xb9, 0x04, 0x81, 0xd4, 0x04, 0x81,
+    0xd5, 0x04, 0x81, 0xce, 0x04, 0x81, 0xcf, 0x04, 0x81, 0xd6, 0x24, 0x00, 0x11, 0xd0, 0x24, 0x00,
+    0xf1, 0x0a, 0xa0, 0x02, 0x81, 0x21, 0x05, 0x0f, 0xa1, 0x02, 0x81, 0x13, 0x05, 0x81, 0x2e, 0x05,
+    0x81, 0x2f, 0x05, 0x81, 0x28, 0x05, 0x81, 0x29, 0x05, 0x81, 0x30, 0xd8, 0x00, 0x11, 0x2a, 0xd8,
+    0x00, 0x11, 0xa4, 0xae, 0x00, 0x11, 0xa6, 0x06, 0x00, 0xf1, 0x22, 0xa8, 0x02, 0x81, 0xf1, 0x03,
+    0x0f, 0xa9, 0x02, 0x81, 0xe3, 0x03, 0x0f, 0xac, 0x02, 0x81, 0x8a, 0x04, 0x0f, 0xad, 0x02, 0x81,
+    0x7c, 0x04, 0x0f, 0xb0, 0x02, 0x81, 0x9f, 0x03, 0x0f, 0xb1, 0x02, 0x81, 0x91, 0x03, 0x81, 0xac,
+    0x03, 0x81, 0xad, 0x03, 0x81, 0xa6, 0x03, 0x81, 0xa7, 0x03, 0x81, 0xae, 0xb4, 0x00, 0x11, 0xa8,
+    0xb4, 0x00, 0xf1, 0x0a, 0xb4, 0x02, 0x81, 0x42, 0x04, 0x0f, 0xb5, 0x02, 0x81, 0x34, 0x04, 0x81,
+    0x4f, 0x04, 0x81, 0x50, 0x04, 0x81, 0x49, 0x04, 0x81, 0x4a, 0x04, 0x81, 0x51, 0x90, 0x00, 0x11,
+    0x4b, 0x90, 0x00, 0xf1, 0x0a, 0xb8, 0x02, 0x81, 0xe5, 0x04, 0x0f, 0xb9, 0x02, 0x81, 0xd7, 0x04,
+    0x81, 0xf2, 0x04, 0x81, 0xf3, 0x04, 0x81, 0xec, 0x04, 0x81, 0xed, 0x04, 0x81, 0xf4, 0x24, 0x00,
+    0x11, 0xee, 0x24, 0x00, 0xf1, 0x0a, 0xbc, 0x02, 0x81, 0x3f, 0x05, 0x0f, 0xbd, 0x02, 0x81, 0x31,
+    0x05, 0x81, 0x4c, 0x05, 0x81, 0x4d, 0x05, 0x81, 0x46, 0x05, 0x81, 0x47, 0x05, 0x81, 0x4e, 0xb4,
+    0x00, 0x00, 0x3f, 0x45, 0x31, 0x00, 0x0f, 0xc0, 0xae, 0x00, 0x11, 0xc1, 0x06, 0x00, 0x11, 0xc4,
+    0x06, 0x00, 0x11, 0xc5, 0x06, 0x00, 0x11, 0xc6, 0x06, 0x00, 0x11, 0xc7, 0x06, 0x00, 0x11, 0xc8,
+    0x06, 0x00, 0x11, 0xc9, 0x06, 0x00, 0x11, 0xca, 0x06, 0x00, 0x11, 0xcb, 0x06, 0x00, 0x11, 0xcc,
+    0x06, 0x00, 0x01, 0x46, 0x20, 0x21, 0x0f, 0xce, 0x06, 0x00, 0x11, 0xcf, 0x06, 0x00, 0x11, 0xd0,
+    0x06, 0x00, 0x11, 0xd1, 0x06, 0x00, 0x11, 0xd2, 0x06, 0x00, 0x11, 0xd3, 0x06, 0x00, 0xf0, 0x15,
+    0xd4, 0x02, 0x81, 0x04, 0x03, 0x0f, 0xd5, 0x02, 0x81, 0x01, 0x03, 0x0f, 0xd8, 0x02, 0x81, 0x14,
+    0x0d, 0x0f, 0xd9, 0x02, 0x81, 0x11, 0x0d, 0x81, 0x1a, 0x0d, 0x81, 0x1b, 0x0d, 0x81, 0x17, 0x0d,
+    0x81, 0x18, 0x0d, 0x81, 0x3d, 0x84, 0x31, 0x00, 0x81, 0x19, 0x28, 0x05, 0xf1, 0x0a, 0xdc, 0x02,
+    0x81, 0x74, 0x0d, 0x0f, 0xdd, 0x02, 0x81, 0x71, 0x0d, 0x81, 0x7a, 0x0d, 0x81, 0x7b, 0x0d, 0x81,
+    0x77, 0x0d, 0x81, 0x78, 0x0d, 0x81, 0x7c, 0x24, 0x00, 0x11, 0x79, 0x24, 0x00, 0x11, 0xe0, 0x5a,
+    0x00, 0x11, 0xe1, 0x06, 0x00, 0x11, 0xe2, 0x06, 0x00, 0x11, 0xe3, 0x06, 0x00, 0x11, 0xe4, 0x06,
+    0x00, 0x11, 0xe5, 0x06, 0x00, 0x11, 0xe6, 0x06, 0x00, 0x11, 0xe7, 0x06, 0x00, 0x11, 0xe8, 0x06,
+    0x00, 0x11, 0xe9, 0x06, 0x00, 0x11, 0xea, 0x06, 0x00, 0x11, 0xec, 0x06, 0x00, 0x11, 0xee, 0x06,
+    0x00, 0x11, 0xef, 0x06, 0x00, 0x11, 0xf2, 0x06, 0x00, 0x11, 0xf4, 0x06, 0x00, 0xf0, 0x04, 0xf6,
+    0x02, 0x8b, 0x51, 0x0d, 0x0f, 0xf8, 0x02, 0x8b, 0x43, 0x0d, 0x8b, 0x5e, 0x0d, 0x8b, 0x5f, 0x0d,
+    0x8b, 0x60, 0x78, 0x00, 0x81, 0x8b, 0x58, 0x0d, 0x8b, 0x59, 0x0d, 0x8b, 0x5a, 0x84, 0x00, 0x11,
+    0xfa, 0x2a, 0x00, 0x11, 0xfb, 0x06, 0x00, 0x11, 0xfc, 0x06, 0x00, 0x01, 0x7f, 0x1a, 0x21, 0x0f,
+    0xfe, 0x06, 0x00, 0x11, 0xff, 0x06, 0x00, 0x01, 0xee, 0xac, 0x10, 0x0f, 0x8d, 0x37, 0x21, 0x00,
+    0x0f, 0x72, 0xb2, 0x11, 0x0f, 0x72, 0x40, 0x11, 0x0f, 0x53, 0x68, 0x21, 0x0f, 0x05, 0x06, 0x00,
+    0x11, 0x06, 0x06, 0x00, 0x11, 0x07, 0x06, 0x00, 0x11, 0x08, 0x06, 0x00, 0x11, 0x09, 0x06, 0x00,
+    0x11, 0x0a, 0x06, 0x00, 0x11, 0x0b, 0x06, 0x00, 0x11, 0x0c, 0x06, 0x00, 0x11, 0x0d, 0x06, 0x00,
+    0x11, 0x0e, 0x06, 0x00, 0x01, 0x7f, 0x0f, 0x21, 0x0f, 0x10, 0x06, 0x00, 0x11, 0x11, 0x06, 0x00,
+    0x11, 0x12, 0x06, 0x00, 0x11, 0x13, 0x06, 0x00, 0x01, 0x21, 0x27, 0x21, 0x0f, 0x15, 0x06, 0x00,
+    0x11, 0x16, 0x06, 0x00, 0x11, 0x17, 0x06, 0x00, 0x71, 0x18, 0x03, 0x8b, 0x55, 0x01, 0x0f, 0x19,
+    0x0c, 0x00, 0x11, 0x1a, 0x06, 0x00, 0x11, 0x1b, 0x06, 0x00, 0x11, 0x1e, 0x06, 0x00, 0x11, 0x1f,
+    0x06, 0x00, 0x11, 0x22, 0x06, 0x00, 0x11, 0x23, 0x06, 0x00, 0x11, 0x24, 0x06, 0x00, 0x11, 0x25,
+    0x06, 0x00, 0x11, 0x26, 0x06, 0x00, 0x11, 0x27, 0x06, 0x00, 0x11, 0x28, 0x06, 0x00, 0x01, 0x92,
+    0x16, 0x21, 0x0f, 0x2a, 0x06, 0x00, 0x11, 0x2b, 0x06, 0x00, 0x11, 0x2c, 0x06, 0x00, 0x11, 0x2d,
+    0x06, 0x00, 0x11, 0x30, 0x06, 0x00, 0x11, 0x31, 0x06, 0x00, 0xf1, 0x0a, 0x34, 0x03, 0x8b, 0xa7,
+    0x05, 0x0f, 0x35, 0x03, 0x8b, 0x99, 0x05, 0x8b, 0xb4, 0x05, 0x8b, 0xb5, 0x05, 0x8b, 0xae, 0x05,
+    0x8b, 0xaf, 0x05, 0x8b, 0xb6, 0x24, 0x0f, 0x11, 0xb0, 0x94, 0x02, 0x11, 0x38, 0x2a, 0x00, 0x11,
+    0x39, 0x06, 0x00, 0x11, 0x3a, 0x06, 0x00, 0x11, 0x3b, 0x06, 0x00, 0x11, 0x3c, 0x06, 0x00, 0x11,
+    0x3d, 0x06, 0x00, 0x11, 0x3e, 0x06, 0x00, 0x11, 0x3f, 0x06, 0x00, 0x11, 0x40, 0x06, 0x00, 0x11,
+    0x41, 0x06, 0x00, 0x11, 0x42, 0x06, 0x00, 0x11, 0x43, 0x06, 0x00, 0x11, 0x44, 0x06, 0x00, 0x11,
+    0x45, 0x06, 0x00, 0x11, 0x46, 0x06, 0x00, 0x11, 0x47, 0x06, 0x00, 0x11, 0x48, 0x06, 0x00, 0x11,
+    0x49, 0x06, 0x00, 0x11, 0x4a, 0x06, 0x00, 0x11, 0x4b, 0x06, 0x00, 0x11, 0x4c, 0x06, 0x00, 0x11,
+    0x4d, 0x06, 0x00, 0x11, 0x4e, 0x06, 0x00, 0x11, 0x4f, 0x06, 0x00, 0x11, 0x50, 0x06, 0x00, 0x11,
+    0x51, 0x06, 0x00, 0x11, 0x52, 0x06, 0x00, 0x11, 0x53, 0x06, 0x00, 0x11, 0x56, 0x06, 0x00, 0x11,
+    0x57, 0x06, 0x00, 0xf1, 0x09, 0x58, 0x03, 0x8b, 0xf4, 0x0c, 0x0f, 0x59, 0x03, 0x8b, 0xed, 0x0c,
+    0x8b, 0xfe, 0x0c, 0x8b, 0xff, 0x0c, 0x8b, 0xfb, 0x0c, 0x8b, 0xfc, 0x0c, 0x8b, 0xec, 0xb1, 0x20,
+    0x8b, 0xfd, 0xf9, 0x10, 0xf0, 0x0b, 0x0f, 0x5c, 0x03, 0x8b, 0x48, 0x03, 0x0f, 0x5d, 0x03, 0x8b,
+    0x41, 0x03, 0x8b, 0x52, 0x03, 0x8b, 0x53, 0x03, 0x8b, 0x4f, 0x03, 0x8b, 0x50, 0x03, 0x8b, 0x54,
+    0x42, 0x00, 0x12, 0x8b, 0x60, 0x00, 0xf1, 0x0a, 0x60, 0x03, 0x8b, 0x33, 0x0d, 0x0f, 0x61, 0x03,
+    0x8b, 0x25, 0x0d, 0x8b, 0x40, 0x0d, 0x8b, 0x41, 0x0d, 0x8b, 0x3a, 0x0d, 0x8b, 0x3b, 0x0d, 0x8b,
+    0x42, 0x48, 0x00, 0x11, 0x3c, 0x70, 0x02, 0x11, 0x64, 0x2a, 0x00, 0x11, 0x65, 0x36, 0x00, 0x11,
+    0x65, 0x38, 0x01, 0x11, 0x61, 0x06, 0x00, 0x11, 0x66, 0x06, 0x00, 0x11, 0x62, 0x44, 0x01, 0x11,
+    0x68, 0x24, 0x00, 0x11, 0x69, 0x06, 0x00, 0x11, 0x6a, 0x06, 0x00, 0x11, 0x6b, 0x06, 0x00, 0x11,
+    0x6e, 0x06, 0x00, 0x11, 0x6f, 0x06, 0x00, 0x11, 0x70, 0x06, 0x00, 0x11, 0x71, 0x06, 0x00, 0x11,
+    0x74, 0x06, 0x00, 0x11, 0x76, 0x06, 0x00, 0xf1, 0x04, 0x78, 0x03, 0x81, 0x5c, 0x01, 0x0f, 0x7a,
+    0x03, 0x81, 0xe5, 0x00, 0x0f, 0x7c, 0x03, 0x81, 0x08, 0x01, 0x0f, 0x7e, 0x18, 0x00, 0x11, 0x7f,
+    0x06, 0x00, 0xf1, 0x16, 0x80, 0x03, 0x81, 0x1f, 0x02, 0x0f, 0x82, 0x03, 0x81, 0x32, 0x01, 0x0f,
+    0x84, 0x03, 0x81, 0x11, 0x02, 0x0f, 0x86, 0x03, 0x81, 0x24, 0x01, 0x0f, 0x88, 0x03, 0x81, 0x2d,
+    0x02, 0x0f, 0x8a, 0x03, 0x81, 0x40, 0x01, 0x0f, 0x8c, 0x2a, 0x00, 0x11, 0x8d, 0x06, 0x00, 0xf1,
+    0x04, 0x8e, 0x03, 0x81, 0x1d, 0x01, 0x0f, 0x90, 0x03, 0x81, 0x8c, 0x0d, 0x81, 0x9d, 0x0d, 0x81,
+    0x9e, 0x0d, 0x81, 0x9f, 0xc6, 0x00, 0xd1, 0x92, 0x03, 0x81, 0x82, 0x05, 0x81, 0x93, 0x05, 0x81,
+    0x94, 0x05, 0x81, 0x95, 0xb4, 0x00, 0x10, 0x94, 0x30, 0x00, 0x21, 0x81, 0x23, 0xde, 0x03, 0x00,
+    0xab, 0x88, 0x31, 0x00, 0x0f, 0x96, 0x12, 0x00, 0x11, 0x83, 0x12, 0x00, 0x11, 0x84, 0x12, 0x00,
+    0xf2, 0x09, 0x98, 0x03, 0x81, 0xc0, 0x03, 0x0f, 0x9a, 0x03, 0x81, 0x59, 0x04, 0x0f, 0x9c, 0x03,
+    0x81, 0x5c, 0x03, 0x81, 0x6d, 0x03, 0x81, 0x6e, 0x03, 0x81, 0xd2, 0x00, 0xd2, 0x9e, 0x03, 0x81,
+    0xff, 0x03, 0x81, 0x10, 0x04, 0x81, 0x11, 0x04, 0x81, 0x12, 0xb8, 0x05, 0xc1, 0x03, 0x81, 0xa2,
+    0x04, 0x81, 0xb3, 0x04, 0x81, 0xb4, 0x04, 0x81, 0xb5, 0x12, 0x00, 0xc1, 0xa2, 0x03, 0x81, 0xfc,
+    0x04, 0x81, 0x0d, 0x05, 0x81, 0x0e, 0x05, 0x81, 0xaf, 0x12, 0xf2, 0x0a, 0x0f, 0xa4, 0x03, 0x81,
+    0xd5, 0x03, 0x0f, 0xa6, 0x03, 0x81, 0x6e, 0x04, 0x0f, 0xa8, 0x03, 0x81, 0x7a, 0x03, 0x81, 0x8b,
+    0x03, 0x81, 0x8c, 0x03, 0x81, 0xc0, 0x00, 0xd1, 0xaa, 0x03, 0x81, 0x1d, 0x04, 0x81, 0x2e, 0x04,
+    0x81, 0x2f, 0x04, 0x81, 0x30, 0x42, 0x00, 0xd1, 0xac, 0x03, 0x81, 0xc0, 0x04, 0x81, 0xd1, 0x04,
+    0x81, 0xd2, 0x04, 0x81, 0xd3, 0x12, 0x00, 0xd1, 0xae, 0x03, 0x81, 0x1a, 0x05, 0x81, 0x2b, 0x05,
+    0x81, 0x2c, 0x05, 0x81, 0x2d, 0x54, 0x00, 0xf1, 0x0a, 0xb0, 0x03, 0x81, 0xea, 0x03, 0x0f, 0xb2,
+    0x03, 0x81, 0x83, 0x04, 0x0f, 0xb4, 0x03, 0x81, 0x98, 0x03, 0x81, 0xa9, 0x03, 0x81, 0xaa, 0x03,
+    0x81, 0xab, 0x54, 0x00, 0xd2, 0xb6, 0x03, 0x81, 0x3b, 0x04, 0x81, 0x4c, 0x04, 0x81, 0x4d, 0x04,
+    0x81, 0x4e, 0xd0, 0x05, 0xc1, 0x03, 0x81, 0xde, 0x04, 0x81, 0xef, 0x04, 0x81, 0xf0, 0x04, 0x81,
+    0xf1, 0x12, 0x00, 0xd1, 0xba, 0x03, 0x81, 0x38, 0x05, 0x81, 0x49, 0x05, 0x81, 0x4a, 0x05, 0x81,
+    0x4b, 0xb2, 0x05, 0x10, 0xbf, 0x57, 0x13, 0x10, 0x81, 0x53, 0xa1, 0x31, 0x00, 0x81, 0xc1, 0x06,
+    0x00, 0x01, 0x3d, 0xb9, 0x21, 0x0f, 0xbc, 0x54, 0x00, 0x11, 0xbd, 0x06, 0x00, 0x11, 0xbe, 0x06,
+    0x00, 0x11, 0xbf, 0x38, 0x01, 0xf1, 0x04, 0xcd, 0x01, 0x81, 0xce, 0x01, 0x81, 0xd0, 0x01, 0x81,
+    0xd1, 0x01, 0x81, 0xd3, 0x01, 0x81, 0xd4, 0x01, 0x81, 0xcf, 0x98, 0x0a, 0x01, 0x22, 0x0b, 0x21,
+    0x81, 0xd5, 0x06, 0x00, 0xf0, 0x04, 0x74, 0x02, 0x81, 0x75, 0x02, 0x81, 0x77, 0x02, 0x81, 0x78,
+    0x02, 0x81, 0x7a, 0x02, 0x81, 0x7b, 0x02, 0x81, 0x76, 0xb0, 0x04, 0x21, 0x81, 0x79, 0x06, 0x00,
+    0x11, 0x7c, 0x06, 0x00, 0xf1, 0x03, 0xdc, 0x01, 0x81, 0xdd, 0x01, 0x81, 0xdf, 0x01, 0x81, 0xe0,
+    0x01, 0x81, 0xe2, 0x01, 0x81, 0xe3, 0x01, 0x81, 0x28, 0x0b, 0x11, 0x81, 0x28, 0x0b, 0x21, 0x81,
+    0xe4, 0x06, 0x00, 0x71, 0xee, 0x0d, 0x81, 0xef, 0x0d, 0x81, 0xf0, 0xaa, 0x01, 0x70, 0x1f, 0x00,
+    0x81, 0x20, 0x00, 0x81, 0x21, 0x96, 0x0f, 0x70, 0x81, 0xfa, 0x06, 0x81, 0xfb, 0x06, 0x81, 0xc8,
+    0xa4, 0x92, 0x00, 0x81, 0xd6, 0x01, 0x81, 0xd7, 0x01, 0x81, 0xd8, 0xee, 0x0b, 0xc1, 0x03, 0x81,
+    0x34, 0x02, 0x81, 0x0c, 0x0e, 0x81, 0x0d, 0x0e, 0x81, 0x0e, 0x2a, 0x12, 0x71, 0x1c, 0x06, 0x81,
+    0x1d, 0x06, 0x81, 0x1e, 0x2a, 0x00, 0x61, 0xf8, 0x02, 0x81, 0xf9, 0x02, 0x81, 0x58, 0x05, 0x71,
+    0x81, 0xfe, 0x05, 0x81, 0xff, 0x05, 0x81, 0xa0, 0xb9, 0x21, 0x0f, 0xc2, 0xde, 0x00, 0x11, 0xc3,
+    0x06, 0x00, 0x11, 0xc4, 0x06, 0x00, 0x11, 0xc5, 0x06, 0x00, 0x11, 0xc6, 0x06, 0x00, 0x11, 0xc7,
+    0xf6, 0x00, 0xf1, 0x04, 0x7d, 0x02, 0x81, 0x7e, 0x02, 0x81, 0x80, 0x02, 0x81, 0x81, 0x02, 0x81,
+    0x83, 0x02, 0x81, 0x84, 0x02, 0x81, 0x7f, 0x48, 0x00, 0x11, 0x82, 0x06, 0x00, 0x01, 0x76, 0x08,
+    0xf1, 0x04, 0x81, 0xe5, 0x01, 0x81, 0xe6, 0x01, 0x81, 0xe8, 0x01, 0x81, 0xe9, 0x01, 0x81, 0xeb,
+    0x01, 0x81, 0xec, 0x01, 0x81, 0x4d, 0x4f, 0x12, 0x81, 0xdc, 0x0b, 0x02, 0xc4, 0x0b, 0xf1, 0x10,
+    0xc8, 0x03, 0x81, 0x86, 0x02, 0x0f, 0xc9, 0x03, 0x81, 0x9b, 0x02, 0x81, 0xc0, 0x02, 0x81, 0xc1,
+    0x02, 0x81, 0xc3, 0x02, 0x81, 0xc4, 0x02, 0x81, 0xc6, 0x02, 0x81, 0xc7, 0x02, 0x81, 0xc2, 0x48,
+    0x00, 0x01, 0x2c, 0x07, 0x12, 0x81, 0x20, 0x07, 0x11, 0xcc, 0x84, 0x00, 0x11, 0xcd, 0x06, 0x00,
+    0x11, 0xce, 0x06, 0x00, 0x11, 0xcf, 0x06, 0x00, 0x11, 0xd0, 0x06, 0x00, 0x11, 0xd1, 0xae, 0x03,
+    0x72, 0xa5, 0x00, 0x8b, 0xa6, 0x00, 0x8b, 0xa7, 0x82, 0x11, 0xc1, 0x03, 0x81, 0xbd, 0x00, 0x0f,
+    0xd3, 0x03, 0x81, 0x78, 0x01, 0x0f, 0xd6, 0x24, 0x00, 0x11, 0xd7, 0x06, 0x00, 0x11, 0xd8, 0x06,
+    0x00, 0x11, 0xd9, 0x06, 0x00, 0x11, 0xda, 0x06, 0x00, 0x11, 0xdb, 0x06, 0x00, 0x11, 0xdc, 0x06,
+    0x00, 0x11, 0xdd, 0x06, 0x00, 0x11, 0xde, 0x06, 0x00, 0x11, 0xdf, 0x06, 0x00, 0x11, 0xe0, 0x06,
+    0x00, 0x11, 0xe1, 0x06, 0x00, 0x11, 0xe2, 0x06, 0x00, 0x11, 0xe3, 0x06, 0x00, 0x11, 0xe4, 0x06,
+    0x00, 0x11, 0xe5, 0x06, 0x00, 0x11, 0xe6, 0x06, 0x00, 0x11, 0xe7, 0x06, 0x00, 0x11, 0xe8, 0x06,
+    0x00, 0x11, 0xe9, 0x06, 0x00, 0x11, 0xea, 0x06, 0x00, 0x11, 0xeb, 0x06, 0x00, 0x11, 0xec, 0x06,
+    0x00, 0x11, 0xed, 0x06, 0x00, 0x11, 0xee, 0x06, 0x00, 0x11, 0xef, 0x06, 0x00, 0x11, 0xf0, 0x06,
+    0x00, 0x11, 0xf1, 0x06, 0x00, 0x11, 0xf2, 0x06, 0x00, 0x11, 0xf3, 0x06, 0x00, 0x11, 0xf6, 0x06,
+    0x00, 0x11, 0xf7, 0x06, 0x00, 0x11, 0xf8, 0x06, 0x00, 0x11, 0xf9, 0x06, 0x00, 0x11, 0xfa, 0x06,
+    0x00, 0x11, 0xfb, 0x06, 0x00, 0x11, 0xfc, 0x06, 0x00, 0x11, 0xfd, 0x06, 0x00, 0x11, 0xfe, 0x06,
+    0x00, 0x11, 0xff, 0x06, 0x00, 0x01, 0x4e, 0x16, 0x11, 0x0f, 0x50, 0xd2, 0x21, 0x0f, 0x02, 0x06,
+    0x00, 0x00, 0x43, 0x57, 0x20, 0x00, 0x0f, 0xa7, 0x17, 0x31, 0x00, 0x0f, 0x05, 0x06, 0x00, 0x11,
+    0x06, 0x06, 0x00, 0x11, 0x07, 0x06, 0x00, 0x11, 0x08, 0x06, 0x00, 0x11, 0x09, 0x06, 0x00, 0x11,
+    0x0a, 0x06, 0x00, 0x11, 0x0b, 0x06, 0x00, 0x11, 0x0c, 0x06, 0x00, 0x10, 0x0e, 0x06, 0x00, 0x71,
+    0x8b, 0xa2, 0x00, 0x8b, 0xa3, 0x00, 0x8b, 0x9e, 0x13, 0x21, 0x81, 0xaf, 0x46, 0x02, 0x00, 0x31,
+    0xa5, 0x31, 0x00, 0x81, 0xb1, 0x06, 0x00, 0x11, 0xb2, 0x06, 0x00, 0xf1, 0x03, 0xc4, 0x01, 0x81,
+    0xc5, 0x01, 0x81, 0xca, 0x01, 0x81, 0xcb, 0x01, 0x81, 0xc6, 0x01, 0x81, 0xc7, 0x01, 0x81, 0x52,
+    0x0e, 0x11, 0x81, 0x4c, 0x0e, 0x21, 0x81, 0xc9, 0x06, 0x00, 0xf1, 0x03, 0x62, 0x02, 0x81, 0x63,
+    0x02, 0x81, 0x68, 0x02, 0x81, 0x69, 0x02, 0x81, 0x64, 0x02, 0x81, 0x65, 0x02, 0x81, 0x7c, 0x0b,
+    0x11, 0x81, 0x6a, 0x0b, 0x11, 0x81, 0x82, 0x0b, 0xf1, 0x04, 0x81, 0xa8, 0x01, 0x81, 0xa9, 0x01,
+    0x81, 0xae, 0x01, 0x81, 0xaf, 0x01, 0x81, 0xaa, 0x01, 0x81, 0xab, 0x01, 0x81, 0x18, 0x0f, 0x11,
+    0x81, 0x06, 0x0f, 0x11, 0x81, 0x1e, 0x0f, 0x81, 0x81, 0xeb, 0x0d, 0x81, 0xec, 0x0d, 0x81, 0xed,
+    0x12, 0x03, 0x60, 0x1c, 0x00, 0x81, 0x1d, 0x00, 0x81, 0xfb, 0x31, 0x91, 0x00, 0x81, 0xf7, 0x06,
+    0x81, 0xf8, 0x06, 0x81, 0xf9, 0x90, 0x00, 0x62, 0xa5, 0x01, 0x81, 0xa6, 0x01, 0x81, 0x72, 0x0f,
+    0xd1, 0x10, 0x04, 0x81, 0x0a, 0x02, 0x81, 0x09, 0x0e, 0x81, 0x0a, 0x0e, 0x81, 0x0b, 0x12, 0x03,
+    0x71, 0x19, 0x06, 0x81, 0x1a, 0x06, 0x81, 0x1b, 0x2a, 0x00, 0x71, 0xf5, 0x02, 0x81, 0xf6, 0x02,
+    0x81, 0xf7, 0x7e, 0x00, 0x71, 0xfb, 0x05, 0x81, 0xfc, 0x05, 0x81, 0xfd, 0x14, 0x04, 0xf1, 0x04,
+    0x6b, 0x02, 0x81, 0x6c, 0x02, 0x81, 0x71, 0x02, 0x81, 0x72, 0x02, 0x81, 0x6d, 0x02, 0x81, 0x6e,
+    0x02, 0x81, 0x6f, 0x24, 0x00, 0x11, 0x73, 0x06, 0x00, 0x11, 0x70, 0x06, 0x00, 0xf1, 0x04, 0xb4,
+    0x01, 0x81, 0xb5, 0x01, 0x81, 0xba, 0x01, 0x81, 0xbb, 0x01, 0x81, 0xb6, 0x01, 0x81, 0xb7, 0x01,
+    0x81, 0xb8, 0xa2, 0x00, 0x01, 0x7e, 0x0f, 0x11, 0x81, 0x96, 0x0f, 0xf1, 0x05, 0x81, 0xb7, 0x02,
+    0x81, 0xb8, 0x02, 0x81, 0xbd, 0x02, 0x81, 0xbe, 0x02, 0x81, 0xb9, 0x02, 0x81, 0xba, 0x02, 0x81,
+    0xbb, 0x3c, 0x00, 0x11, 0xbf, 0x06, 0x00, 0x11, 0xbc, 0xe2, 0x02, 0xf1, 0x04, 0x12, 0x04, 0x81,
+    0xd0, 0x02, 0x0f, 0x14, 0x04, 0x81, 0xaf, 0x03, 0x81, 0xb6, 0x03, 0x81, 0xb7, 0x03, 0x81, 0xb8,
+    0xce, 0x01, 0xd1, 0x16, 0x04, 0x81, 0x91, 0x04, 0x81, 0x98, 0x04, 0x81, 0x99, 0x04, 0x81, 0x9a,
+    0x80, 0x0a, 0x11, 0xab, 0xb4, 0x00, 0x00, 0xcf, 0xa6, 0x31, 0x00, 0x81, 0xad, 0x06, 0x00, 0x11,
+    0xae, 0xc0, 0x03, 0x11, 0x18, 0xb0, 0x01, 0x11, 0x19, 0x24, 0x00, 0x61, 0xbf, 0x01, 0x81, 0xc0,
+    0x01, 0x81, 0xea, 0x0f, 0x21, 0x81, 0xbe, 0x06, 0x00, 0x01, 0xfc, 0x0f, 0x21, 0x81, 0xc3, 0x06,
+    0x00, 0xf1, 0x03, 0x50, 0x02, 0x81, 0x51, 0x02, 0x81, 0x53, 0x02, 0x81, 0x54, 0x02, 0x81, 0x56,
+    0x02, 0x81, 0x57, 0x02, 0x81, 0x7a, 0x0d, 0x11, 0x81, 0x6e, 0x0d, 0x11, 0x81, 0x62, 0x0d, 0xf1,
+    0x04, 0x81, 0x90, 0x01, 0x81, 0x91, 0x01, 0x81, 0x93, 0x01, 0x81, 0x94, 0x01, 0x81, 0x96, 0x01,
+    0x81, 0x97, 0x01, 0x81, 0x28, 0x11, 0x11, 0x81, 0x1c, 0x11, 0x11, 0x81, 0x10, 0x11, 0x82, 0x81,
+    0xe8, 0x0d, 0x81, 0xe9, 0x0d, 0x81, 0xea, 0x56, 0x0a, 0x51, 0x00, 0x81, 0x1a, 0x00, 0x81, 0x2a,
+    0x18, 0x81, 0x81, 0xf4, 0x06, 0x81, 0xf5, 0x06, 0x81, 0xf6, 0x9c, 0x00, 0x71, 0x99, 0x01, 0x81,
+    0x9a, 0x01, 0x81, 0x9b, 0x30, 0x00, 0x71, 0x06, 0x0e, 0x81, 0x07, 0x0e, 0x81, 0x08, 0x80, 0x01,
+    0x71, 0x16, 0x06, 0x81, 0x17, 0x06, 0x81, 0x18, 0x24, 0x00, 0x61, 0xf2, 0x02, 0x81, 0xf3, 0x02,
+    0x81, 0x14, 0x0a, 0x81, 0x81, 0xf8, 0x05, 0x81, 0xf9, 0x05, 0x81, 0xfa, 0xe8, 0x05, 0x11, 0x1a,
+    0xd2, 0x00, 0x11, 0x1b, 0x06, 0x00, 0x11, 0x1c, 0x06, 0x00, 0x11, 0x1d, 0x06, 0x00, 0x11, 0x1e,
+    0x06, 0x00, 0x11, 0x1f, 0xea, 0x00, 0xf1, 0x03, 0x59, 0x02, 0x81, 0x5a, 0x02, 0x81, 0x5c, 0x02,
+    0x81, 0x5d, 0x02, 0x81, 0x5f, 0x02, 0x81, 0x60, 0x02, 0x81, 0x10, 0x0e, 0x11, 0x81, 0x04, 0x0e,
+    0x11, 0x81, 0xf8, 0x0d, 0xf1, 0x04, 0x81, 0x9c, 0x01, 0x81, 0x9d, 0x01, 0x81, 0x9f, 0x01, 0x81,
+    0xa0, 0x01, 0x81, 0xa2, 0x01, 0x81, 0xa3, 0x01, 0x81, 0xbe, 0x11, 0x11, 0x81, 0xb8, 0x11, 0x21,
+    0x81, 0xa4, 0x22, 0x02, 0xf1, 0x04, 0x20, 0x04, 0x81, 0x94, 0x02, 0x0f, 0x21, 0x04, 0x81, 0xa9,
+    0x02, 0x81, 0xb2, 0x02, 0x81, 0xb3, 0x02, 0x81, 0xb5, 0x3c, 0x00, 0x12, 0xb1, 0xe6, 0x01, 0x01,
+    0x06, 0x00, 0x11, 0xb6, 0xaa, 0x01, 0x11, 0x24, 0x7e, 0x00, 0x11, 0x25, 0x06, 0x00, 0x11, 0x26,
+    0x06, 0x00, 0x11, 0x27, 0x24, 0x03, 0x71, 0x9f, 0x00, 0x8b, 0xa0, 0x00, 0x8b, 0xa1, 0x80, 0x04,
+    0x71, 0x28, 0x04, 0x81, 0xde, 0x00, 0x0f, 0x2a, 0x1e, 0x00, 0x11, 0x2b, 0x06, 0x00, 0x11, 0x2c,
+    0x06, 0x00, 0x02, 0x14, 0x0d, 0x02, 0xea, 0x06, 0x11, 0x32, 0xc0, 0x00, 0x00, 0x7d, 0x00, 0x22,
+    0x00, 0x0f, 0x32, 0x0d, 0x00, 0xf1, 0x01, 0x82, 0x00, 0x81, 0x8d, 0x01, 0x81, 0x8e, 0x01, 0x81,
+    0xa8, 0x12, 0xf1, 0x10, 0x34, 0x04, 0x81, 0x8d, 0x02, 0x0f, 0x35, 0x04, 0x81, 0xa2, 0x02, 0x0f,
+    0x38, 0x04, 0x81, 0xc9, 0x02, 0x0f, 0x3a, 0x04, 0x81, 0x2d, 0x03, 0x81, 0x34, 0x03, 0x81, 0x35,
+    0x03, 0x81, 0x36, 0x22, 0x02, 0xc1, 0x3c, 0x04, 0x81, 0x37, 0x03, 0x81, 0x3e, 0x03, 0x81, 0x3f,
+    0x03, 0x81, 0xae, 0x09, 0x06, 0x01, 0x00, 0xf1, 0x07, 0x81, 0x2f, 0x03, 0x0c, 0x9e, 0x00, 0x81,
+    0x30, 0x03, 0x0c, 0xa0, 0x00, 0x09, 0x1a, 0x00, 0x0c, 0x38, 0x01, 0x09, 0x25, 0x00, 0x0c, 0x59,
+    0x14, 0x02, 0x20, 0x00, 0xf1, 0x01, 0xcb, 0x06, 0x81, 0xe9, 0x06, 0x81, 0xd5, 0x02, 0x81, 0xec,
+    0x02, 0x81, 0x39, 0x07, 0x81, 0x3b, 0x56, 0x1a, 0x00, 0xb4, 0x03, 0xf3, 0x00, 0x06, 0x81, 0xea,
+    0x06, 0x81, 0xd6, 0x02, 0x81, 0xed, 0x02, 0x81, 0x3a, 0x07, 0x81, 0x3c, 0x18, 0x00, 0x05, 0x01,
+    0x00, 0x10, 0x0a, 0x02, 0x07, 0x01, 0xbc, 0x01, 0xa0, 0xd7, 0x02, 0x0a, 0x01, 0x00, 0x0a, 0x02,
+    0x00, 0x0a, 0x03, 0x95, 0x8f, 0x03, 0x1e, 0x00, 0x01, 0xa9, 0x1a, 0x11, 0x0a, 0xa9, 0x1a, 0x1c,
+    0x0a, 0x3b, 0x00, 0x01, 0x15, 0x00, 0x0a, 0x28, 0xb5, 0x11, 0x0a, 0xc7, 0x1a, 0x41, 0x0a, 0x0a,
+    0x00, 0x0a, 0xca, 0x1a, 0x06, 0x18, 0x00, 0x01, 0xd3, 0x1a, 0xf1, 0x02, 0x0a, 0x0d, 0x00, 0x06,
+    0x19, 0x00, 0x06, 0x1a, 0x00, 0x06, 0x1b, 0x00, 0x06, 0x1c, 0x00, 0x81, 0xce, 0x78, 0x00, 0x22,
+    0xd8, 0x02, 0xe3, 0x01, 0x08, 0x01, 0x00, 0x23, 0x81, 0x33, 0x69, 0xc0, 0x60, 0x81, 0x30, 0x05,
+    0x81, 0x37, 0x05, 0xe3, 0x07, 0x1a, 0x30, 0x03, 0x00, 0xf0, 0x1b, 0xb8, 0x03, 0x81, 0xb9, 0x03,
+    0x81, 0xba, 0x03, 0x81, 0xbb, 0x03, 0x81, 0xbc, 0x03, 0x81, 0xbd, 0x03, 0x81, 0xbe, 0x03, 0x81,
+    0xbf, 0x03, 0x81, 0x33, 0x05, 0x81, 0x34, 0x05, 0x81, 0x35, 0x05, 0x81, 0x36, 0x05, 0x81, 0xc0,
+    0x03, 0x81, 0xc1, 0x03, 0x1c, 0x84, 0x6b, 0x21, 0x00, 0x81, 0x12, 0x18, 0x0e, 0x01, 0x00, 0xfe,
+    0x0f, 0x81, 0xd5, 0x03, 0x06, 0x2a, 0x00, 0x81, 0xd6, 0x03, 0x81, 0xd7, 0x03, 0x81, 0xd8, 0x03,
+    0x81, 0xd9, 0x03, 0x81, 0xda, 0x03, 0x0a, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x81, 0xe6, 0x03, 0x03,
+    0x00, 0x6f, 0x15, 0x01, 0x00, 0x81, 0xe8, 0x03, 0x03, 0x00, 0x00, 0x90, 0x4e, 0x00, 0x81, 0x46,
+    0x00, 0x81, 0x4f, 0x00, 0x81, 0x78, 0x27, 0x07, 0xf9, 0x00, 0x0f, 0x59, 0xc1, 0x0a, 0x21, 0x8b,
+    0x82, 0x8c, 0x0a, 0x16, 0x6f, 0x92, 0x0a, 0x03, 0x18, 0x00, 0x11, 0x83, 0x12, 0x00, 0x00, 0xfa,
+    0x7d, 0x03, 0x18, 0x1b, 0x03, 0x18, 0x00, 0x11, 0x75, 0x12, 0x00, 0x00, 0x86, 0x55, 0x37, 0x00,
+    0x8b, 0x55, 0x18, 0x00, 0x11, 0x76, 0x12, 0x00, 0x11, 0x6a, 0x06, 0x00, 0x17, 0x56, 0x18, 0x00,
+    0x17, 0x7c, 0x0c, 0x00, 0x17, 0x5c, 0x0c, 0x00, 0x43, 0x7d, 0x05, 0x8b, 0x7b, 0x0f, 0x00, 0x71,
+    0x8b, 0x5d, 0x05, 0x8b, 0x5b, 0x05, 0x93, 0xa2, 0x15, 0x0e, 0x01, 0x00, 0x71, 0x0a, 0x10, 0x00,
+    0x0a, 0x11, 0x00, 0x0a, 0x6e, 0x1c, 0x09, 0x18, 0x00, 0x1f, 0x13, 0x2f, 0x00, 0x02, 0xf1, 0x02,
+    0x00, 0x0a, 0x14, 0x00, 0x0a, 0x15, 0x00, 0x0a, 0x16, 0x00, 0x0a, 0x17, 0x00, 0x0a, 0x18, 0x00,
+    0x0a, 0x77, 0x1c, 0x0e, 0x01, 0x00, 0x88, 0x81, 0xce, 0x02, 0x81, 0xfb, 0x02, 0x81, 0x87, 0x4f,
+    0xc2, 0x04, 0x1b, 0x00, 0x10, 0x22, 0x68, 0x02, 0xff, 0x05, 0x06, 0x51, 0x00, 0x06, 0x52, 0x00,
+    0x06, 0x53, 0x00, 0x06, 0x54, 0x00, 0x81, 0xaa, 0x05, 0x10, 0x29, 0x00, 0x81, 0x2f, 0x80, 0x02,
+    0x01, 0x00, 0x22, 0x02, 0x00, 0x18, 0x00, 0xf1, 0x07, 0x10, 0x2a, 0x00, 0x10, 0x2b, 0x00, 0x81,
+    0xc9, 0x02, 0x81, 0xdc, 0x06, 0x10, 0x2c, 0x00, 0x10, 0x2d, 0x00, 0x10, 0x2e, 0x00, 0x81, 0x01,
+    0x1a, 0x0c, 0x30, 0x00, 0x31, 0xc4, 0x00, 0x81, 0x13, 0x1a, 0x06, 0x12, 0x00, 0x11, 0xab, 0x24,
+    0x06, 0x03, 0x64, 0x77, 0x06, 0x01, 0x00, 0x80, 0x8b, 0xa1, 0x00, 0x8b, 0xad, 0x00, 0x8b, 0xa9,
+    0x32, 0x07, 0x09, 0x18, 0x00, 0x73, 0xa2, 0x00, 0x8b, 0xae, 0x00, 0x8b, 0xaa, 0x47, 0x07, 0x0c,
+    0x60, 0x00, 0x4f, 0x02, 0x06, 0x81, 0x03, 0xd8, 0x00, 0x00, 0x41, 0x06, 0x55, 0x00, 0x06, 0x7c,
+    0x23, 0x2f, 0x06, 0x57, 0x36, 0x00, 0x00, 0x05, 0x01, 0x00, 0xd0, 0x10, 0x30, 0x00, 0x10, 0x31,
+    0x00, 0x10, 0x32, 0x00, 0x81, 0x43, 0x07, 0x81, 0x33, 0xc8, 0x0d, 0x60, 0x00, 0x1f, 0x3e, 0x08,
+    0x01, 0x04, 0x16, 0x51, 0x18, 0x00, 0x11, 0x12, 0xf0, 0x1b, 0x11, 0x12, 0xf0, 0x1b, 0x11, 0x12,
+    0xf0, 0x1b, 0x03, 0x18, 0x00, 0x01, 0xf6, 0x1b, 0x21, 0x12, 0x91, 0x06, 0x00, 0x01, 0xfc, 0x1b,
+    0x81, 0x10, 0xe1, 0x00, 0x10, 0xe2, 0x00, 0x10, 0xe3, 0x0c, 0x00, 0x11, 0xe4, 0x06, 0x00, 0x01,
+    0xac, 0x74, 0x71, 0x10, 0xe6, 0x00, 0x10, 0xe7, 0x00, 0x10, 0xb2, 0x1a, 0x11, 0x10, 0xb2, 0x1a,
+    0x11, 0x10, 0xb2, 0x1a, 0x03, 0xa5, 0x00, 0x31, 0xeb, 0x00, 0x12, 0x05, 0x1c, 0x00, 0x0c, 0x00,
+    0x33, 0xec, 0x00, 0x12, 0x8d, 0x7b, 0x51, 0x00, 0x10, 0xed, 0x00, 0x12, 0x0b, 0x1c, 0x00, 0x0c,
+    0x00, 0x31, 0xee, 0x00, 0x12, 0x11, 0x1c, 0x53, 0x0a, 0x22, 0x00, 0x0a, 0x23, 0x15, 0x00, 0x54,
+    0x0a, 0x24, 0x00, 0x0a, 0x25, 0x0c, 0x00, 0x44, 0x26, 0x00, 0x0a, 0x27, 0x0c, 0x00, 0x40, 0x28,
+    0x00, 0x0a, 0x29, 0x09, 0x00, 0xf3, 0x08, 0x0f, 0x3e, 0x04, 0x0f, 0x3f, 0x04, 0x0f, 0x40, 0x04,
+    0x0f, 0x41, 0x04, 0x0f, 0x42, 0x04, 0x0f, 0x43, 0x04, 0x0f, 0x44, 0x04, 0x0f, 0x45, 0x90, 0x04,
+    0x11, 0x10, 0x3e, 0x0a, 0x11, 0x10, 0x3e, 0x0a, 0x11, 0x10, 0x3e, 0x0a, 0x03, 0x18, 0x00, 0x01,
+    0x44, 0x0a, 0x11, 0x10, 0x44, 0x0a, 0x11, 0x10, 0x44, 0x0a, 0x81, 0x0a, 0x2e, 0x00, 0x0a, 0x2f,
+    0x00, 0x0a, 0x30, 0x5d, 0x00, 0x60, 0x31, 0x00, 0x0a, 0x32, 0x00, 0x0a, 0xa0, 0x23, 0x0f, 0x01,
+    0x00, 0x03, 0x2f, 0x0f, 0x46, 0x57, 0xc1, 0x03, 0xf6, 0xb6, 0x0f, 0x47, 0x04, 0x8d, 0x28, 0x00,
+    0x8d, 0xf8, 0x03, 0x8d, 0x12, 0x00, 0x8d, 0x4d, 0x06, 0x8d, 0x5e, 0x00, 0x8d, 0xf6, 0x06, 0x8d,
+    0x7b, 0x07, 0x8d, 0xf1, 0x00, 0x8d, 0x29, 0x00, 0x8d, 0xf9, 0x03, 0x8d, 0x13, 0x00, 0x8d, 0x4e,
+    0x06, 0x8d, 0x5f, 0x00, 0x8d, 0xf7, 0x06, 0x8d, 0x7c, 0x07, 0x8d, 0xf2, 0x00, 0x8e, 0x2a, 0x00,
+    0x8e, 0xfa, 0x03, 0x8e, 0x14, 0x00, 0x8e, 0x4f, 0x06, 0x8e, 0x60, 0x00, 0x8e, 0xf8, 0x06, 0x8e,
+    0x7d, 0x07, 0x8e, 0xf3, 0x00, 0x8e, 0x2b, 0x00, 0x8e, 0xfb, 0x03, 0x8e, 0x15, 0x00, 0x8e, 0x50,
+    0x06, 0x8e, 0x61, 0x00, 0x8e, 0xf9, 0x06, 0x8e, 0x7e, 0x07, 0x8e, 0xf4, 0x00, 0x06, 0xbe, 0x00,
+    0x06, 0xbf, 0x00, 0x06, 0xc0, 0x00, 0x06, 0xc1, 0x00, 0x06, 0xc2, 0x00, 0x06, 0xc3, 0x00, 0x06,
+    0xc4, 0x00, 0x06, 0xc5, 0x00, 0x06, 0xc6, 0x00, 0x06, 0xc7, 0x00, 0x06, 0xc8, 0x00, 0x06, 0xc9,
+    0x00, 0x06, 0xca, 0x00, 0x06, 0xcb, 0x00, 0x06, 0xcc, 0x00, 0x06, 0xcd, 0x00, 0x8d, 0x2e, 0x00,
+    0x8d, 0xfe, 0x03, 0x8d, 0x18, 0x00, 0x8d, 0x53, 0x06, 0x8d, 0x64, 0x00, 0x8d, 0xfc, 0x06, 0x8d,
+    0x81, 0x07, 0x8d, 0xf7, 0x00, 0x8d, 0x2f, 0x00, 0x8d, 0xff, 0x03, 0x8d, 0x19, 0x00, 0x8d, 0x54,
+    0x06, 0x8d, 0x65, 0x00, 0x8d, 0xfd, 0x06, 0x8d, 0x82, 0x07, 0x8d, 0xf8, 0x00, 0x81, 0x21, 0xf6,
+    0x03, 0x08, 0x01, 0x00, 0x10, 0x81, 0x9c, 0x9b, 0x0f, 0x0e, 0x01, 0x04, 0xf1, 0x04, 0x62, 0x04,
+    0x0f, 0x63, 0x04, 0x0f, 0x64, 0x04, 0x0f, 0x65, 0x04, 0x0f, 0x66, 0x04, 0x0f, 0x67, 0x04, 0x0f,
+    0x68, 0xe7, 0x06, 0x19, 0x69, 0x26, 0x01, 0x21, 0x0f, 0x6a, 0x15, 0x00, 0x4f, 0x6b, 0x04, 0x0f,
+    0x6c, 0x3e, 0x01, 0x00, 0x5f, 0x0f, 0x8d, 0x04, 0x0f, 0x8e, 0x18, 0x00, 0x00, 0xf3, 0x68, 0x8b,
+    0x0e, 0x06, 0x8b, 0x1a, 0x06, 0x8b, 0xdd, 0x05, 0x8b, 0xed, 0x05, 0x8b, 0x98, 0x06, 0x8b, 0xb4,
+    0x06, 0x8b, 0x99, 0x06, 0x8b, 0x36, 0x06, 0x8b, 0x0f, 0x06, 0x8b, 0x1b, 0x06, 0x8b, 0xde, 0x05,
+    0x8b, 0xee, 0x05, 0x8b, 0x9a, 0x06, 0x8b, 0xb5, 0x06, 0x8b, 0x9b, 0x06, 0x8b, 0x37, 0x06, 0x8b,
+    0x10, 0x06, 0x8b, 0x1c, 0x06, 0x8b, 0xdf, 0x05, 0x8b, 0xef, 0x05, 0x8b, 0x9c, 0x06, 0x8b, 0xb6,
+    0x06, 0x8b, 0x9d, 0x06, 0x8b, 0x38, 0x06, 0x8b, 0x11, 0x06, 0x8b, 0x1d, 0x06, 0x8b, 0xe0, 0x05,
+    0x8b, 0xf0, 0x05, 0x8b, 0x9e, 0x06, 0x8b, 0xb7, 0x06, 0x8b, 0x9f, 0x06, 0x8b, 0x39, 0x06, 0x0f,
+    0x99, 0x04, 0x0f, 0x9a, 0x04, 0x0f, 0x9b, 0x04, 0x0f, 0x9c, 0x04, 0x0f, 0x9d, 0x04, 0x0f, 0x9e,
+    0x04, 0x0f, 0x9f, 0x04, 0x0f, 0xa0, 0x8a, 0x00, 0x59, 0x0f, 0xca, 0x04, 0x0f, 0xcb, 0x96, 0x00,
+    0x12, 0x0a, 0xe7, 0x21, 0x0f, 0x01, 0x00, 0x01, 0x8f, 0x0f, 0xdb, 0x04, 0x0f, 0xdc, 0x04, 0x0f,
+    0xdd, 0xde, 0x00, 0x01, 0x01, 0xa8, 0x15, 0x10, 0x0f, 0xae, 0xac, 0x36, 0x00, 0x0f, 0x14, 0x4a,
+    0x01, 0x21, 0x0f, 0x15, 0x12, 0x00, 0x11, 0x16, 0x06, 0x00, 0x17, 0x17, 0x18, 0x00, 0x43, 0x18,
+    0x05, 0x0f, 0x19, 0x0f, 0x00, 0x8f, 0x0f, 0x1a, 0x05, 0x0f, 0x1b, 0x05, 0x0f, 0x97, 0x80, 0x01,
+    0x06, 0x0c, 0x6c, 0x00, 0x30, 0x07, 0x06, 0x0f, 0x7a, 0x3a, 0x0d, 0x18, 0x00, 0x61, 0x1d, 0x06,
+    0x0f, 0x1e, 0x06, 0x8d, 0x90, 0x12, 0x0b, 0x01, 0x00, 0x5f, 0x0a, 0x3d, 0x00, 0x8d, 0x1c, 0x18,
+    0x00, 0x00, 0x00, 0x45, 0x3d, 0x1f, 0x1d, 0x30, 0x00, 0x01, 0x31, 0x3e, 0x00, 0x8e, 0xd2, 0x12,
+    0x0e, 0x01, 0x00, 0x20, 0x81, 0x12, 0x6d, 0x0e, 0xf0, 0x4b, 0x81, 0xe1, 0x05, 0x81, 0xf1, 0x05,
+    0x81, 0xa0, 0x06, 0x81, 0xb8, 0x06, 0x81, 0xa1, 0x06, 0x81, 0x3a, 0x06, 0x81, 0x13, 0x06, 0x81,
+    0x1f, 0x06, 0x81, 0xe2, 0x05, 0x81, 0xf2, 0x05, 0x81, 0xa2, 0x06, 0x81, 0xb9, 0x06, 0x81, 0xa3,
+    0x06, 0x81, 0x3b, 0x06, 0x81, 0x14, 0x06, 0x81, 0x20, 0x06, 0x81, 0xe3, 0x05, 0x81, 0xf3, 0x05,
+    0x81, 0xa4, 0x06, 0x81, 0xba, 0x06, 0x81, 0xa5, 0x06, 0x81, 0x3c, 0x06, 0x81, 0x15, 0x06, 0x81,
+    0x21, 0x06, 0x81, 0xe4, 0x05, 0x81, 0xf4, 0x05, 0x81, 0xa6, 0x06, 0x81, 0xbb, 0x06, 0x81, 0xa7,
+    0x06, 0x81, 0x3d, 0x06, 0x3e, 0x0a, 0xf1, 0x04, 0x22, 0x06, 0x81, 0xe5, 0x05, 0x81, 0xf5, 0x05,
+    0x81, 0xa8, 0x06, 0x81, 0xbc, 0x06, 0x81, 0xa9, 0x06, 0x81, 0x3e, 0x53, 0x0a, 0xf0, 0x04, 0x23,
+    0x06, 0x81, 0xe6, 0x05, 0x81, 0xf6, 0x05, 0x81, 0xaa, 0x06, 0x81, 0xbd, 0x06, 0x81, 0xab, 0x06,
+    0x81, 0x3f, 0x68, 0x0a, 0xf0, 0x06, 0x81, 0x24, 0x06, 0x81, 0xe7, 0x05, 0x81, 0xf7, 0x05, 0x81,
+    0xac, 0x06, 0x81, 0xbe, 0x06, 0x81, 0xad, 0x06, 0x81, 0x40, 0x06, 0x06, 0x0c, 0x50, 0x25, 0x06,
+    0x81, 0xe8, 0x05, 0x77, 0x0a, 0xd1, 0xae, 0x06, 0x81, 0xbf, 0x06, 0x81, 0xaf, 0x06, 0x81, 0x41,
+    0x06, 0x81, 0x83, 0x44, 0x22, 0x20, 0x93, 0x01, 0xbf, 0x0a, 0x50, 0xff, 0x01, 0x81, 0x04, 0x02,
+    0x38, 0x0a, 0x40, 0xa7, 0x01, 0x81, 0x84, 0x59, 0x22, 0x00, 0x13, 0x0b, 0x80, 0x9a, 0x01, 0x81,
+    0x00, 0x02, 0x81, 0x05, 0x02, 0x4d, 0x0a, 0xf0, 0x0a, 0xa8, 0x01, 0x81, 0xcc, 0x01, 0x81, 0x11,
+    0x02, 0x0a, 0x3f, 0x00, 0x81, 0xfe, 0x01, 0x0a, 0x40, 0x00, 0x0a, 0x41, 0x00, 0x0a, 0x42, 0x00,
+    0x0a, 0x43, 0x26, 0x10, 0x01, 0x60, 0x0c, 0xc0, 0x01, 0x81, 0xf8, 0x01, 0x0d, 0x21, 0x00, 0x81,
+    0xd1, 0x01, 0x0d, 0x22, 0xd5, 0x0f, 0x30, 0x81, 0x8b, 0x01, 0xe7, 0x09, 0x13, 0x8c, 0x55, 0x0b,
+    0x12, 0x0a, 0x52, 0x80, 0x01, 0xe4, 0x0c, 0x21, 0x81, 0xbd, 0x47, 0x22, 0x10, 0xb4, 0x3e, 0x0d,
+    0x00, 0x4d, 0x0d, 0x10, 0xb6, 0x51, 0x0c, 0x00, 0x11, 0x0a, 0x10, 0x90, 0x14, 0x0a, 0xa1, 0x81,
+    0x91, 0x01, 0x0a, 0x45, 0x00, 0x81, 0x0b, 0x02, 0x81, 0x98, 0x1c, 0x00, 0x78, 0x0c, 0x17, 0xc5,
+    0xeb, 0x0b, 0x01, 0xab, 0x1b, 0x60, 0x81, 0xf9, 0x01, 0x81, 0x85, 0x01, 0x59, 0x10, 0x10, 0x95,
+    0x79, 0x0b, 0x60, 0x81, 0x06, 0x02, 0x81, 0x01, 0x02, 0x53, 0x0d, 0x41, 0xa4, 0x01, 0x81, 0x86,
+    0x6e, 0x10, 0x20, 0x96, 0x01, 0x13, 0x0b, 0x50, 0x02, 0x02, 0x81, 0x07, 0x02, 0x26, 0x0d, 0x11,
+    0xaa, 0x6e, 0x0d, 0x80, 0x12, 0x02, 0x81, 0xf6, 0x01, 0x81, 0xfa, 0x01, 0x29, 0x0d, 0x01, 0xc1,
+    0x1a, 0x00, 0x4b, 0x00, 0x11, 0xcf, 0xcb, 0x0d, 0x61, 0xf7, 0x01, 0x81, 0xfb, 0x01, 0x0d, 0x8e,
+    0x05, 0x80, 0x0d, 0x24, 0x00, 0x81, 0xe7, 0x01, 0x81, 0x87, 0xa7, 0x10, 0xc0, 0x81, 0x9d, 0x01,
+    0x0a, 0x46, 0x00, 0x81, 0x08, 0x02, 0x81, 0x03, 0x02, 0xa7, 0x0d, 0x11, 0xa6, 0x04, 0x23, 0x10,
+    0xbe, 0x04, 0x23, 0x00, 0x14, 0x0d, 0x11, 0xc9, 0x0a, 0x0e, 0x41, 0xb7, 0x01, 0x81, 0xb9, 0xcb,
+    0x0d, 0xe3, 0x13, 0x02, 0x81, 0xfc, 0x01, 0x81, 0xfd, 0x01, 0x0a, 0x47, 0x00, 0x81, 0x0c, 0x02,
+    0x42, 0x0c, 0x11, 0xbb, 0x28, 0x0e, 0xf1, 0x10, 0xc1, 0x01, 0x81, 0xc3, 0x01, 0x81, 0x88, 0x01,
+    0x81, 0xbc, 0x01, 0x81, 0x89, 0x01, 0x81, 0xc4, 0x01, 0x8d, 0x18, 0x07, 0x8d, 0x19, 0x07, 0x81,
+    0xea, 0x03, 0x81, 0xb2, 0x03, 0x81, 0xa2, 0xce, 0x10, 0xf1, 0x42, 0x5f, 0x01, 0x81, 0x2c, 0x02,
+    0x8d, 0x1a, 0x07, 0x8d, 0x1b, 0x07, 0x81, 0xeb, 0x03, 0x81, 0xb3, 0x03, 0x81, 0xa3, 0x03, 0x81,
+    0x35, 0x02, 0x81, 0x60, 0x01, 0x81, 0x2d, 0x02, 0x8e, 0x1c, 0x07, 0x8e, 0x1d, 0x07, 0x81, 0xec,
+    0x03, 0x81, 0xb4, 0x03, 0x81, 0xa4, 0x03, 0x81, 0x36, 0x02, 0x81, 0x61, 0x01, 0x81, 0x2e, 0x02,
+    0x8e, 0x1e, 0x07, 0x8e, 0x1f, 0x07, 0x81, 0xed, 0x03, 0x81, 0xb5, 0x03, 0x81, 0xa5, 0x03, 0x81,
+    0x37, 0x02, 0x81, 0x62, 0x01, 0x81, 0x2f, 0x02, 0x81, 0x41, 0x02, 0x81, 0x05, 0x1f, 0x0c, 0xb8,
+    0x02, 0x31, 0x42, 0x02, 0x81, 0x17, 0x1f, 0x0c, 0x18, 0x00, 0x71, 0x43, 0x02, 0x81, 0x5d, 0x01,
+    0x81, 0xb3, 0x0c, 0x00, 0x02, 0xe6, 0x10, 0x11, 0xcf, 0xfe, 0x07, 0xfb, 0x04, 0x44, 0x02, 0x81,
+    0x5e, 0x01, 0x81, 0xb4, 0x00, 0x81, 0xb5, 0x00, 0x81, 0x86, 0x02, 0x81, 0x87, 0x02, 0x81, 0xd0,
+    0xa2, 0x03, 0x20, 0x80, 0xc8, 0x11, 0x00, 0x10, 0x80, 0xa8, 0x9a, 0x60, 0x00, 0x80, 0xc9, 0x05,
+    0x81, 0x06, 0x70, 0x07, 0xf0, 0x02, 0x81, 0x74, 0x01, 0x81, 0x75, 0x01, 0x81, 0x93, 0x04, 0x81,
+    0x94, 0x04, 0x81, 0x04, 0x03, 0x81, 0x05, 0xa4, 0x18, 0x00, 0xfa, 0x0d, 0xf1, 0x10, 0x70, 0x01,
+    0x81, 0x71, 0x01, 0x81, 0x72, 0x01, 0x81, 0x73, 0x01, 0x81, 0x06, 0x03, 0x81, 0x07, 0x03, 0x81,
+    0xb0, 0x03, 0x81, 0xb1, 0x03, 0x81, 0x10, 0x07, 0x81, 0x11, 0x07, 0x81, 0x63, 0xfa, 0x0a, 0x11,
+    0x62, 0x06, 0x00, 0x11, 0x61, 0x06, 0x00, 0x11, 0x56, 0x4e, 0x00, 0x11, 0x2e, 0x06, 0x00, 0x11,
+    0x20, 0x06, 0x00, 0x11, 0xc3, 0xa4, 0x00, 0x11, 0xeb, 0x1e, 0x00, 0x11, 0x0c, 0x06, 0x00, 0x11,
+    0x68, 0xaa, 0x00, 0x11, 0xfc, 0x06, 0x00, 0x11, 0x0d, 0x12, 0x00, 0xf0, 0x24, 0x88, 0x06, 0x81,
+    0x89, 0x06, 0x81, 0xc8, 0x06, 0x81, 0xc9, 0x06, 0x81, 0xd0, 0x02, 0x81, 0xd1, 0x02, 0x81, 0xd3,
+    0x02, 0x81, 0xd4, 0x02, 0x80, 0x07, 0x07, 0x80, 0x08, 0x07, 0x0d, 0x00, 0x00, 0x80, 0x0f, 0x07,
+    0x81, 0x7c, 0x00, 0x81, 0x7e, 0x00, 0x81, 0x84, 0x00, 0x81, 0x86, 0x00, 0x81, 0x88, 0x00, 0x0e,
+    0x98, 0x0c, 0xf0, 0x1e, 0x00, 0x0e, 0x01, 0x00, 0x81, 0x7d, 0x00, 0x0e, 0x02, 0x00, 0x81, 0x85,
+    0x00, 0x0e, 0x03, 0x00, 0x81, 0x80, 0x00, 0x81, 0x82, 0x00, 0x81, 0x92, 0x00, 0x0e, 0x04, 0x00,
+    0x81, 0x90, 0x00, 0x0e, 0x05, 0x00, 0x81, 0x8a, 0x00, 0x0e, 0x06, 0x00, 0x81, 0x81, 0x00, 0x0e,
+    0x07, 0x4c, 0xc2, 0xf3, 0x18, 0x10, 0x01, 0x00, 0x90, 0x1f, 0x03, 0x90, 0x20, 0x03, 0x90, 0x21,
+    0x03, 0x90, 0x22, 0x03, 0x90, 0x23, 0x03, 0x90, 0x24, 0x03, 0x90, 0x25, 0x03, 0x90, 0x26, 0x03,
+    0x80, 0x09, 0x07, 0x80, 0x0a, 0x07, 0x80, 0x0b, 0x07, 0x80, 0x0c, 0x07, 0xbe, 0x0d, 0x11, 0x63,
+    0x13, 0x10, 0x20, 0x61, 0x02, 0x25, 0x10, 0xf0, 0x3d, 0x43, 0x03, 0x81, 0x44, 0x03, 0x10, 0x21,
+    0x00, 0x81, 0x33, 0x03, 0x10, 0x22, 0x00, 0x81, 0x37, 0x03, 0x10, 0x23, 0x00, 0x81, 0x34, 0x03,
+    0x10, 0x24, 0x00, 0x81, 0x38, 0x03, 0x81, 0x45, 0x07, 0x81, 0x47, 0x07, 0x81, 0x46, 0x07, 0x81,
+    0x48, 0x07, 0x81, 0x4c, 0x07, 0x81, 0x4e, 0x07, 0x81, 0x4d, 0x07, 0x81, 0x4f, 0x07, 0x10, 0x25,
+    0x00, 0x81, 0x3b, 0x03, 0x10, 0x26, 0x00, 0x81, 0x3f, 0x03, 0x10, 0x27, 0x00, 0x81, 0x3c, 0x03,
+    0x10, 0x28, 0x00, 0x81, 0x40, 0x8c, 0x2f, 0xf1, 0x50, 0x89, 0xb4, 0x02, 0x14, 0x01, 0x00, 0x89,
+    0xa0, 0x02, 0x14, 0x02, 0x00, 0x89, 0x6c, 0x02, 0x14, 0x03, 0x00, 0x89, 0x8c, 0x02, 0x14, 0x04,
+    0x00, 0x89, 0xc4, 0x02, 0x14, 0x05, 0x00, 0x89, 0xaf, 0x02, 0x14, 0x06, 0x00, 0x89, 0x71, 0x02,
+    0x14, 0x07, 0x00, 0x89, 0x91, 0x02, 0x14, 0x08, 0x00, 0x89, 0xbf, 0x02, 0x14, 0x09, 0x00, 0x89,
+    0xaa, 0x02, 0x14, 0x0a, 0x00, 0x89, 0xb9, 0x02, 0x14, 0x0b, 0x00, 0x89, 0xa5, 0x02, 0x14, 0x0c,
+    0x00, 0x89, 0x79, 0x02, 0x14, 0x0d, 0x00, 0x89, 0x96, 0x02, 0x14, 0x0e, 0x00, 0x89, 0x7e, 0x02,
+    0x14, 0x0f, 0x00, 0x89, 0x9b, 0x02, 0x81, 0xf9, 0x5c, 0x01, 0x01, 0xb4, 0x0e, 0x21, 0x81, 0x53,
+    0x86, 0x01, 0x00, 0x76, 0xd1, 0x20, 0x00, 0x81, 0x4f, 0x28, 0xb1, 0x00, 0x81, 0xfd, 0x05, 0x81,
+    0xfe, 0x05, 0x10, 0x2f, 0x00, 0x81, 0xe5, 0x22, 0x21, 0x80, 0xca, 0x0a, 0x02, 0x11, 0x1e, 0x06,
+    0x00, 0x11, 0xcb, 0x06, 0x00, 0x11, 0x1f, 0x06, 0x00, 0x01, 0xa7, 0x21, 0x11, 0x80, 0xa7, 0x21,
+    0x02, 0xc7, 0xca, 0x11, 0x80, 0x9a, 0x09, 0x11, 0x80, 0x63, 0x1d, 0x0f, 0x06, 0x00, 0x18, 0x01,
+    0xe3, 0x21, 0x0f, 0x06, 0x00, 0x17, 0x02, 0xeb, 0x03, 0x01, 0xf4, 0x18, 0xf1, 0x7a, 0x00, 0x0d,
+    0x04, 0x00, 0x12, 0x83, 0x00, 0x12, 0x84, 0x00, 0x12, 0x86, 0x00, 0x12, 0x87, 0x00, 0x12, 0xaf,
+    0x00, 0x12, 0xb0, 0x00, 0x12, 0xb2, 0x00, 0x12, 0xb3, 0x00, 0x12, 0xc6, 0x01, 0x12, 0xc7, 0x01,
+    0x12, 0x8a, 0x02, 0x12, 0x8b, 0x02, 0x12, 0x8d, 0x02, 0x12, 0x8e, 0x02, 0x12, 0xac, 0x02, 0x12,
+    0xad, 0x02, 0x12, 0xaf, 0x02, 0x12, 0xb0, 0x02, 0x12, 0x48, 0x03, 0x12, 0x49, 0x03, 0x12, 0x4b,
+    0x03, 0x12, 0x4c, 0x03, 0x12, 0x4e, 0x03, 0x12, 0x4f, 0x03, 0x12, 0x51, 0x03, 0x12, 0x52, 0x03,
+    0x12, 0x54, 0x03, 0x12, 0x55, 0x03, 0x12, 0x57, 0x03, 0x12, 0x58, 0x03, 0x12, 0x71, 0x03, 0x12,
+    0x72, 0x03, 0x12, 0x74, 0x03, 0x12, 0x75, 0x03, 0x12, 0x77, 0x03, 0x12, 0x78, 0x03, 0x12, 0x7a,
+    0x03, 0x12, 0x7b, 0x03, 0x12, 0x7f, 0x03, 0x12, 0x80, 0x03, 0x12, 0x82, 0x03, 0x12, 0x83, 0x03,
+    0x12, 0xca, 0x03, 0x12, 0xcb, 0x03, 0x12, 0xb0, 0x09, 0x71, 0x12, 0xcd, 0x03, 0x12, 0xce, 0x03,
+    0x12, 0xa4, 0x09, 0x81, 0x12, 0xd0, 0x03, 0x12, 0xd1, 0x03, 0x12, 0xd2, 0x0c, 0x00, 0x71, 0xd3,
+    0x03, 0x12, 0xd4, 0x03, 0x12, 0xd5, 0x0c, 0x00, 0x61, 0xd6, 0x03, 0x12, 0xd7, 0x03, 0x12, 0xd6,
+    0x13, 0x71, 0x12, 0xd9, 0x03, 0x12, 0xda, 0x03, 0x12, 0xd0, 0x13, 0x71, 0x12, 0xed, 0x03, 0x12,
+    0xee, 0x03, 0x12, 0x64, 0x13, 0x71, 0x12, 0xf0, 0x03, 0x12, 0xf1, 0x03, 0x12, 0x5e, 0x13, 0x81,
+    0x12, 0xf3, 0x03, 0x12, 0xf4, 0x03, 0x12, 0xf5, 0x0c, 0x00, 0x61, 0xf6, 0x03, 0x12, 0xf7, 0x03,
+    0x12, 0x5e, 0x13, 0x71, 0x12, 0xf9, 0x03, 0x12, 0xfa, 0x03, 0x12, 0x58, 0x13, 0x71, 0x12, 0xfc,
+    0x03, 0x12, 0xfd, 0x03, 0x12, 0x52, 0x13, 0xf0, 0xa4, 0x12, 0x0c, 0x04, 0x12, 0x0d, 0x04, 0x12,
+    0x0f, 0x04, 0x12, 0x10, 0x04, 0x12, 0x12, 0x04, 0x12, 0x13, 0x04, 0x12, 0x15, 0x04, 0x12, 0x16,
+    0x04, 0x12, 0x18, 0x04, 0x12, 0x19, 0x04, 0x12, 0x1b, 0x04, 0x12, 0x1c, 0x04, 0x12, 0x34, 0x04,
+    0x12, 0x35, 0x04, 0x12, 0x37, 0x04, 0x12, 0x38, 0x04, 0x12, 0x3a, 0x04, 0x12, 0x3b, 0x04, 0x12,
+    0x3d, 0x04, 0x12, 0x3e, 0x04, 0x12, 0x41, 0x04, 0x12, 0x42, 0x04, 0x12, 0x44, 0x04, 0x12, 0x45,
+    0x04, 0x81, 0x92, 0x03, 0x81, 0x70, 0x00, 0x81, 0x93, 0x03, 0x81, 0x71, 0x00, 0x88, 0xb0, 0x02,
+    0x88, 0xb1, 0x02, 0x88, 0x9c, 0x02, 0x88, 0x9d, 0x02, 0x88, 0x68, 0x02, 0x88, 0x69, 0x02, 0x88,
+    0x88, 0x02, 0x88, 0x89, 0x02, 0x88, 0xc0, 0x02, 0x88, 0xc1, 0x02, 0x88, 0xab, 0x02, 0x88, 0xac,
+    0x02, 0x88, 0x6d, 0x02, 0x88, 0x6e, 0x02, 0x88, 0x8d, 0x02, 0x88, 0x8e, 0x02, 0x88, 0xbb, 0x02,
+    0x88, 0xbc, 0x02, 0x88, 0xa6, 0x02, 0x88, 0xa7, 0x02, 0x88, 0xb5, 0x02, 0x88, 0xb6, 0x02, 0x88,
+    0xa1, 0x02, 0x88, 0xa2, 0x02, 0x88, 0x75, 0x02, 0x88, 0x76, 0x02, 0x88, 0x92, 0x02, 0x88, 0x93,
+    0x02, 0x88, 0x7a, 0x02, 0x88, 0x7b, 0x02, 0x88, 0x97, 0x02, 0x88, 0x98, 0xcf, 0x01, 0x11, 0x8d,
+    0xb9, 0x6f, 0x11, 0x8d, 0x21, 0x14, 0x21, 0x8d, 0x16, 0x0c, 0x00, 0x10, 0x51, 0x8b, 0x02, 0x11,
+    0x8d, 0x91, 0x28, 0x21, 0x8d, 0xfa, 0x0c, 0x00, 0x10, 0x7f, 0x5f, 0x02, 0x11, 0x8d, 0x15, 0x26,
+    0x10, 0x8d, 0x0e, 0x87, 0x21, 0x00, 0x8d, 0x4b, 0x14, 0x11, 0x8d, 0xf9, 0x29, 0x21, 0x8d, 0x52,
+    0x24, 0x00, 0x01, 0xbb, 0x28, 0x21, 0x8d, 0xfb, 0x0c, 0x00, 0x01, 0x8f, 0x02, 0x11, 0x8d, 0x3f,
+    0x26, 0xd1, 0x92, 0xaf, 0x00, 0x0d, 0x0d, 0x00, 0x0d, 0x0e, 0x00, 0x0d, 0x0f, 0x00, 0x0d, 0x5f,
+    0x2a, 0x50, 0x81, 0xcd, 0x02, 0x10, 0xf3, 0xf3, 0x08, 0x11, 0x10, 0x24, 0x1d, 0x21, 0x08, 0x48,
+    0x06, 0x00, 0x11, 0x49, 0x06, 0x00, 0x11, 0x4a, 0x06, 0x00, 0x01, 0x5a, 0x1d, 0x21, 0x08, 0x4c,
+    0x06, 0x00, 0x11, 0x4d, 0x06, 0x00, 0x01, 0x9c, 0x17, 0x21, 0x08, 0x4f, 0x06, 0x00, 0x11, 0x58,
+    0x06, 0x00, 0x11, 0x5a, 0x06, 0x00, 0x11, 0x5c, 0x06, 0x00, 0x71, 0x5d, 0x04, 0x08, 0x5e, 0x04,
+    0x08, 0x5f, 0x0c, 0x00, 0x11, 0x61, 0x06, 0x00, 0x11, 0x63, 0x06, 0x00, 0x11, 0x65, 0x06, 0x00,
+    0x11, 0x66, 0x6c, 0x00, 0x10, 0x06, 0x39, 0x03, 0x20, 0x10, 0x07, 0x06, 0x00, 0xf1, 0x05, 0x08,
+    0x89, 0x04, 0x08, 0x8a, 0x04, 0x08, 0x8c, 0x04, 0x08, 0x8d, 0x04, 0x08, 0x8e, 0x04, 0x08, 0x8f,
+    0x04, 0x08, 0x90, 0x2a, 0x00, 0x00, 0x32, 0x4f, 0x91, 0x00, 0x08, 0x92, 0x04, 0x08, 0x93, 0x04,
+    0x08, 0x9b, 0x0c, 0x00, 0x11, 0x9c, 0x06, 0x00, 0x11, 0x9d, 0x06, 0x00, 0x11, 0x9e, 0x06, 0x00,
+    0x11, 0x9f, 0x06, 0x00, 0x01, 0xef, 0x09, 0x21, 0x08, 0xa1, 0x06, 0x00, 0x11, 0xa2, 0x06, 0x00,
+    0x11, 0xa7, 0x06, 0x00, 0xf0, 0x0a, 0xaa, 0x04, 0x08, 0xab, 0x04, 0x08, 0xaf, 0x04, 0x08, 0xb0,
+    0x04, 0x08, 0x06, 0x05, 0x08, 0x07, 0x05, 0x08, 0x2a, 0x05, 0x08, 0x2b, 0x05, 0x08, 0x07, 0x17,
+    0x01, 0x11, 0x08, 0x65, 0x09, 0x21, 0x08, 0x16, 0x06, 0x00, 0xf1, 0x04, 0x6a, 0x06, 0x08, 0x6b,
+    0x06, 0x08, 0x85, 0x06, 0x08, 0x86, 0x06, 0x08, 0x8e, 0x06, 0x08, 0x8f, 0x06, 0x08, 0x96, 0x18,
+    0x00, 0xf1, 0x0a, 0xb1, 0x06, 0x08, 0xb2, 0x06, 0x08, 0xd9, 0x06, 0x08, 0xda, 0x06, 0x08, 0xdb,
+    0x06, 0x08, 0xdc, 0x06, 0x08, 0xdd, 0x06, 0x08, 0xde, 0x06, 0x08, 0xf2, 0x1e, 0x00, 0x11, 0xf3,
+    0x06, 0x00, 0x00, 0xbb, 0xbc, 0x31, 0x00, 0x08, 0xf5, 0x06, 0x00, 0x01, 0x3a, 0x13, 0x11, 0x08,
+    0xa7, 0x01, 0x21, 0x08, 0xff, 0x06, 0x00, 0x00, 0xbb, 0xbc, 0xf1, 0x1e, 0x00, 0x08, 0x07, 0x07,
+    0x08, 0x08, 0x07, 0x08, 0x09, 0x07, 0x08, 0x0a, 0x07, 0x08, 0x0f, 0x07, 0x08, 0x10, 0x07, 0x08,
+    0x11, 0x07, 0x08, 0x12, 0x07, 0x08, 0x13, 0x07, 0x08, 0x14, 0x07, 0x08, 0x23, 0x07, 0x08, 0x24,
+    0x07, 0x08, 0x25, 0x07, 0x08, 0x26, 0x07, 0x08, 0x27, 0x30, 0x00, 0x11, 0x28, 0x06, 0x00, 0x11,
+    0x29, 0x06, 0x00, 0x11, 0x31, 0x06, 0x00, 0x11, 0x32, 0x06, 0x00, 0x11, 0x37, 0x06, 0x00, 0x11,
+    0x38, 0x06, 0x00, 0xf1, 0x07, 0x3b, 0x07, 0x08, 0x3c, 0x07, 0x08, 0x3d, 0x07, 0x08, 0x3e, 0x07,
+    0x08, 0x3f, 0x07, 0x08, 0x40, 0x07, 0x08, 0x41, 0x07, 0x08, 0x42, 0xbf, 0x04, 0x01, 0x8f, 0x1e,
+    0x11, 0x80, 0x65, 0x21, 0x11, 0x83, 0xcf, 0x0a, 0x01, 0x78, 0x25, 0xf0, 0x06, 0x00, 0x80, 0x35,
+    0x06, 0x0e, 0x38, 0x00, 0x0e, 0x39, 0x00, 0x14, 0x10, 0x00, 0x89, 0xb2, 0x00, 0x14, 0x11, 0x00,
+    0x89, 0x81, 0x24, 0x00, 0x71, 0x92, 0x82, 0x02, 0x88, 0x83, 0x02, 0x88, 0x81, 0x20, 0x0f, 0x01,
+    0x00, 0x02, 0x0a, 0x59, 0x07, 0x37, 0x02, 0x10, 0x20, 0x63, 0xc7, 0x01, 0x6a, 0x01, 0x00, 0x8c,
+    0xd9, 0x05, 0x0e, 0x00, 0x24, 0x10, 0x10, 0x8e, 0xc8, 0x03, 0x1c, 0x00, 0x03, 0x3f, 0x00, 0x01,
+    0x1c, 0x00, 0x11, 0x20, 0xef, 0x27, 0x05, 0x0e, 0x00, 0x01, 0x5b, 0x27, 0x07, 0x2a, 0x00, 0x02,
+    0x0f, 0x00, 0x04, 0x2a, 0x00, 0x06, 0x0e, 0x00, 0x15, 0x20, 0x0e, 0x00, 0x01, 0x34, 0x02, 0x05,
+    0x70, 0x00, 0x00, 0x0e, 0x00, 0x37, 0x20, 0x20, 0x20, 0x0e, 0x00, 0x06, 0x70, 0x00, 0x01, 0x64,
+    0x02, 0x05, 0x70, 0x00, 0x04, 0x0e, 0x00, 0x02, 0x0f, 0x00, 0x08, 0x54, 0xca, 0x00, 0xc3, 0x9c,
+    0x03, 0xb6, 0x00, 0x01, 0x59, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x54, 0x00, 0x01, 0x13, 0x00, 0x00,
+    0x24, 0x15, 0x01, 0x17, 0x00, 0x06, 0x75, 0x00, 0x07, 0x01, 0x00, 0xbc, 0x08, 0x2f, 0x00, 0x08,
+    0x30, 0x00, 0x08, 0x31, 0x00, 0x08, 0x32, 0x1b, 0x00, 0x24, 0x81, 0x89, 0x09, 0x00, 0x01, 0x98,
+    0x0f, 0x00, 0x09, 0x00, 0x14, 0x7f, 0x09, 0x00, 0x14, 0x87, 0x09, 0x00, 0x01, 0x8b, 0x2b, 0x00,
+    0x09, 0x00, 0x01, 0xa4, 0x0f, 0x00, 0x09, 0x00, 0x14, 0x8b, 0x09, 0x00, 0x13, 0x83, 0x09, 0x00,
+    0x41, 0x12, 0xe7, 0x01, 0x12, 0x88, 0x19, 0x51, 0x12, 0xe8, 0x01, 0x12, 0xe8, 0x09, 0x00, 0x31,
+    0xe9, 0x01, 0x12, 0x76, 0x25, 0x41, 0x12, 0xea, 0x01, 0x12, 0x9d, 0x19, 0x51, 0x12, 0xeb, 0x01,
+    0x12, 0xeb, 0x09, 0x00, 0x41, 0xec, 0x01, 0x12, 0xec, 0x09, 0x00, 0x31, 0xed, 0x01, 0x12, 0xb2,
+    0x19, 0x41, 0x12, 0xee, 0x01, 0x12, 0x79, 0x25, 0x41, 0x12, 0x0b, 0x02, 0x12, 0xec, 0x24, 0x41,
+    0x12, 0x0c, 0x02, 0x12, 0xef, 0x24, 0x41, 0x12, 0x0d, 0x02, 0x12, 0x46, 0x06, 0x41, 0x12, 0x0e,
+    0x02, 0x12, 0xf5, 0x24, 0x41, 0x12, 0x0f, 0x02, 0x12, 0xf8, 0x24, 0x41, 0x12, 0x10, 0x02, 0x12,
+    0xfb, 0x24, 0x41, 0x12, 0x11, 0x02, 0x12, 0xfe, 0x24, 0x41, 0x12, 0x12, 0x02, 0x12, 0x01, 0x25,
+    0x41, 0x12, 0x4f, 0x02, 0x12, 0x02, 0x24, 0x41, 0x12, 0x50, 0x02, 0x12, 0x05, 0x24, 0x41, 0x12,
+    0x51, 0x02, 0x12, 0x08, 0x24, 0x41, 0x12, 0x52, 0x02, 0x12, 0x91, 0x16, 0x41, 0x12, 0x53, 0x02,
+    0x12, 0x0e, 0x24, 0x41, 0x12, 0x54, 0x02, 0x12, 0x11, 0x24, 0x41, 0x12, 0x55, 0x02, 0x12, 0xa6,
+    0x16, 0x41, 0x12, 0x56, 0x02, 0x12, 0x17, 0x24, 0x41, 0x12, 0x57, 0x02, 0x12, 0x1a, 0x24, 0x41,
+    0x12, 0x58, 0x02, 0x12, 0xbb, 0x16, 0x41, 0x12, 0x59, 0x02, 0x12, 0x20, 0x24, 0x41, 0x12, 0x5a,
+    0x02, 0x12, 0xbe, 0x02, 0x41, 0x12, 0x5b, 0x02, 0x12, 0x16, 0x16, 0x41, 0x12, 0x5c, 0x02, 0x12,
+    0x29, 0x24, 0x41, 0x12, 0x5d, 0x02, 0x12, 0x2c, 0x24, 0x42, 0x12, 0x5e, 0x02, 0x12, 0x2b, 0x16,
+    0x10, 0x98, 0x66, 0x17, 0x00, 0x09, 0x00, 0x14, 0x9a, 0x69, 0x17, 0x10, 0x99, 0x75, 0x17, 0x00,
+    0x09, 0x00, 0x31, 0x9b, 0x04, 0x81, 0x3b, 0x04, 0x41, 0x81, 0x9c, 0x04, 0x81, 0x3e, 0x04, 0x41,
+    0x81, 0x9e, 0x04, 0x81, 0x3b, 0x04, 0x41, 0x81, 0x9d, 0x04, 0x81, 0x4a, 0x04, 0x41, 0x81, 0x9f,
+    0x04, 0x81, 0x47, 0x04, 0x41, 0x81, 0xcd, 0x02, 0x81, 0xb6, 0x21, 0x41, 0x81, 0xcb, 0x02, 0x81,
+    0xcb, 0x21, 0x00, 0xb6, 0x12, 0x01, 0xc2, 0x21, 0x41, 0x81, 0xcc, 0x02, 0x81, 0xd7, 0x21, 0x00,
+    0x72, 0x09, 0x01, 0xc2, 0x21, 0x41, 0x81, 0xcf, 0x02, 0x81, 0xd7, 0x21, 0x41, 0x81, 0xd2, 0x02,
+    0x81, 0xce, 0x21, 0x00, 0x90, 0x09, 0x01, 0xe3, 0x21, 0xb6, 0x88, 0x73, 0x02, 0x88, 0xba, 0x02,
+    0x88, 0x72, 0x02, 0x88, 0x74, 0x51, 0x03, 0xf4, 0x17, 0x81, 0xcf, 0x06, 0x81, 0xd0, 0x06, 0x81,
+    0xd1, 0x06, 0x81, 0xd2, 0x06, 0x81, 0xd3, 0x06, 0x81, 0xd4, 0x06, 0x81, 0xd5, 0x06, 0x81, 0xd6,
+    0x06, 0x81, 0xd7, 0x06, 0x81, 0xd8, 0x06, 0x81, 0xd9, 0x06, 0x81, 0xda, 0x06, 0x81, 0x8d, 0x05,
+    0x15, 0x14, 0x95, 0x09, 0x00, 0x01, 0x86, 0x04, 0x00, 0x09, 0x00, 0xf4, 0x16, 0x2a, 0x0e, 0x81,
+    0x2b, 0x0e, 0x81, 0x2c, 0x0e, 0x81, 0x2d, 0x0e, 0x81, 0x2e, 0x0e, 0x81, 0x2f, 0x0e, 0x81, 0x1e,
+    0x0e, 0x81, 0x1f, 0x0e, 0x81, 0x20, 0x0e, 0x81, 0x21, 0x0e, 0x81, 0x22, 0x0e, 0x81, 0x23, 0x0e,
+    0x81, 0x92, 0x2d, 0x00, 0x00, 0x94, 0xc5, 0x02, 0x55, 0x02, 0x04, 0x09, 0x00, 0xf0, 0x14, 0x2b,
+    0x06, 0x81, 0x2c, 0x06, 0x81, 0x2d, 0x06, 0x81, 0x2e, 0x06, 0x81, 0x2f, 0x06, 0x81, 0x30, 0x06,
+    0x81, 0x31, 0x06, 0x81, 0x32, 0x06, 0x81, 0x33, 0x06, 0x81, 0x34, 0x06, 0x81, 0x35, 0x06, 0x81,
+    0x36, 0x06, 0xee, 0x0d, 0x20, 0xa1, 0x06, 0xdc, 0x0d, 0xf0, 0x1a, 0xe2, 0x0d, 0x81, 0xe3, 0x0d,
+    0x81, 0xe4, 0x0d, 0x81, 0xe5, 0x0d, 0x81, 0xe6, 0x0d, 0x81, 0xe7, 0x0d, 0x81, 0x58, 0x00, 0x81,
+    0x59, 0x00, 0x81, 0x5a, 0x00, 0x81, 0x5b, 0x00, 0x81, 0x5c, 0x00, 0x81, 0x5d, 0x00, 0x81, 0x4c,
+    0x00, 0x81, 0x4d, 0x00, 0x05, 0x15, 0xf0, 0x5c, 0x4f, 0x00, 0x81, 0x50, 0x00, 0x81, 0x51, 0x00,
+    0x81, 0x03, 0x07, 0x81, 0x04, 0x07, 0x81, 0x05, 0x07, 0x81, 0x06, 0x07, 0x81, 0x07, 0x07, 0x81,
+    0x08, 0x07, 0x81, 0x36, 0x0e, 0x81, 0x37, 0x0e, 0x81, 0x38, 0x0e, 0x81, 0x39, 0x0e, 0x81, 0x3a,
+    0x0e, 0x81, 0x3b, 0x0e, 0x81, 0x13, 0x00, 0x81, 0x14, 0x00, 0x81, 0x15, 0x00, 0x81, 0x16, 0x00,
+    0x81, 0x17, 0x00, 0x81, 0x18, 0x00, 0x81, 0xee, 0x06, 0x81, 0xef, 0x06, 0x81, 0xf0, 0x06, 0x81,
+    0xf1, 0x06, 0x81, 0xf2, 0x06, 0x81, 0xf3, 0x06, 0x81, 0x4f, 0x01, 0x81, 0x50, 0x01, 0x81, 0x51,
+    0x01, 0x81, 0x52, 0x01, 0x81, 0x53, 0x01, 0x81, 0x54, 0x01, 0x81, 0xcc, 0x00, 0x81, 0xcd, 0x00,
+    0x81, 0xce, 0x00, 0xbc, 0x0c, 0x11, 0x88, 0x68, 0x0c, 0xa1, 0xcf, 0x00, 0x81, 0xd0, 0x00, 0x81,
+    0xd1, 0x00, 0x81, 0x8a, 0x91, 0x0d, 0xf0, 0x0b, 0x8c, 0x01, 0x81, 0x00, 0x0e, 0x81, 0x01, 0x0e,
+    0x81, 0x02, 0x0e, 0x81, 0x03, 0x0e, 0x81, 0x04, 0x0e, 0x81, 0x05, 0x0e, 0x81, 0x10, 0x06, 0x81,
+    0x11, 0x06, 0xcf, 0x0e, 0x11, 0x13, 0xa5, 0x0e, 0x20, 0x15, 0x06, 0x2a, 0x17, 0xe0, 0xed, 0x02,
+    0x81, 0xee, 0x02, 0x81, 0xef, 0x02, 0x81, 0xf0, 0x02, 0x81, 0xf1, 0x02, 0xcc, 0x0e, 0x11, 0xf3,
+    0xa2, 0x0e, 0x11, 0xf5, 0x78, 0x0e, 0x20, 0xf7, 0x05, 0x2f, 0x0c, 0xa1, 0x44, 0x02, 0x81, 0x45,
+    0x02, 0x81, 0xfd, 0x01, 0x81, 0xfe, 0x42, 0x0e, 0x80, 0x46, 0x02, 0x81, 0x47, 0x02, 0x81, 0x48,
+    0x02, 0x36, 0x0e, 0x20, 0x01, 0x02, 0x7c, 0x0d, 0xf0, 0x08, 0x6b, 0x01, 0x81, 0x6c, 0x01, 0x81,
+    0x6d, 0x01, 0x81, 0xfb, 0x00, 0x81, 0xfc, 0x00, 0x81, 0xfd, 0x00, 0x81, 0x6e, 0x01, 0x81, 0x6f,
+    0x01, 0x03, 0x0c, 0xf1, 0xa0, 0xfe, 0x00, 0x81, 0xff, 0x00, 0x81, 0x00, 0x01, 0x8b, 0x99, 0x00,
+    0x8b, 0x9a, 0x00, 0x8b, 0x9b, 0x00, 0x8b, 0x9c, 0x00, 0x8b, 0x9d, 0x00, 0x8b, 0x9e, 0x00, 0x8b,
+    0xcd, 0x0d, 0x8b, 0xce, 0x0d, 0x8b, 0xcf, 0x0d, 0x8b, 0xd0, 0x0d, 0x8b, 0xd1, 0x0d, 0x8b, 0xd2,
+    0x0d, 0x8b, 0x4b, 0x0d, 0x8b, 0x4c, 0x0d, 0x8b, 0x4d, 0x0d, 0x8b, 0x4e, 0x0d, 0x8b, 0x4f, 0x0d,
+    0x8b, 0x50, 0x0d, 0x8b, 0xa1, 0x05, 0x8b, 0xa2, 0x05, 0x8b, 0xa3, 0x05, 0x8b, 0xa4, 0x05, 0x8b,
+    0xa5, 0x05, 0x8b, 0xa6, 0x05, 0x8b, 0x2d, 0x0d, 0x8b, 0x2e, 0x0d, 0x8b, 0x2f, 0x0d, 0x8b, 0x30,
+    0x0d, 0x8b, 0x31, 0x0d, 0x8b, 0x32, 0x0d, 0x8b, 0x55, 0x05, 0x8b, 0x56, 0x05, 0x8b, 0x57, 0x05,
+    0x8b, 0x58, 0x05, 0x8b, 0x59, 0x05, 0x8b, 0x5a, 0x05, 0x8b, 0x92, 0x00, 0x8b, 0x93, 0x00, 0x8b,
+    0x94, 0x00, 0x8b, 0x95, 0x00, 0x8b, 0x96, 0x00, 0x8b, 0x97, 0x00, 0x81, 0xdb, 0x0d, 0x81, 0xdc,
+    0x0d, 0x81, 0xdd, 0x0d, 0x81, 0xde, 0x0d, 0x81, 0xdf, 0x0d, 0x81, 0xe0, 0x0d, 0x81, 0x0c, 0x00,
+    0x81, 0x0d, 0x00, 0x81, 0x0e, 0x00, 0x81, 0x0f, 0x00, 0x81, 0x10, 0x00, 0x81, 0x11, 0x00, 0x81,
+    0xe7, 0x06, 0x81, 0xe8, 0x44, 0x18, 0xf0, 0x26, 0xea, 0x06, 0x81, 0xeb, 0x06, 0x81, 0xec, 0x06,
+    0x81, 0x10, 0x01, 0x81, 0x11, 0x01, 0x81, 0x12, 0x01, 0x81, 0x13, 0x01, 0x81, 0x14, 0x01, 0x81,
+    0x15, 0x01, 0x81, 0xc5, 0x00, 0x81, 0xc6, 0x00, 0x81, 0xc7, 0x00, 0x81, 0x80, 0x01, 0x81, 0x81,
+    0x01, 0x81, 0x82, 0x01, 0x81, 0xc8, 0x00, 0x81, 0xc9, 0x00, 0x81, 0xca, 0x00, 0x68, 0x0f, 0x11,
+    0x84, 0xae, 0x0e, 0xf4, 0x8e, 0xf9, 0x0d, 0x81, 0xfa, 0x0d, 0x81, 0xfb, 0x0d, 0x81, 0xfc, 0x0d,
+    0x81, 0xfd, 0x0d, 0x81, 0xfe, 0x0d, 0x81, 0x09, 0x06, 0x81, 0x0a, 0x06, 0x81, 0x0b, 0x06, 0x81,
+    0x0c, 0x06, 0x81, 0x0d, 0x06, 0x81, 0x0e, 0x06, 0x81, 0xe5, 0x02, 0x81, 0xe6, 0x02, 0x81, 0xe7,
+    0x02, 0x81, 0xe8, 0x02, 0x81, 0xe9, 0x02, 0x81, 0xea, 0x02, 0x81, 0xeb, 0x05, 0x81, 0xec, 0x05,
+    0x81, 0xed, 0x05, 0x81, 0xee, 0x05, 0x81, 0xef, 0x05, 0x81, 0xf0, 0x05, 0x81, 0x19, 0x02, 0x81,
+    0x1a, 0x02, 0x81, 0x1b, 0x02, 0x81, 0x1c, 0x02, 0x81, 0x1d, 0x02, 0x81, 0x1e, 0x02, 0x81, 0x2c,
+    0x01, 0x81, 0x2d, 0x01, 0x81, 0x2e, 0x01, 0x81, 0x2f, 0x01, 0x81, 0x30, 0x01, 0x81, 0x31, 0x01,
+    0x81, 0x27, 0x02, 0x81, 0x28, 0x02, 0x81, 0x29, 0x02, 0x81, 0x2a, 0x02, 0x81, 0x2b, 0x02, 0x81,
+    0x2c, 0x02, 0x81, 0x3a, 0x01, 0x81, 0x3b, 0x01, 0x81, 0x3c, 0x01, 0x81, 0x3d, 0x01, 0x81, 0x3e,
+    0x01, 0x81, 0x3f, 0x01, 0x81, 0xc3, 0x06, 0x81, 0xc4, 0x06, 0x81, 0xc5, 0x06, 0x81, 0xc6, 0x06,
+    0x81, 0xc7, 0x2c, 0x0d, 0x20, 0xca, 0x06, 0x31, 0x19, 0xa4, 0xcc, 0x06, 0x81, 0xcd, 0x06, 0x81,
+    0xce, 0x06, 0x81, 0x93, 0x18, 0x03, 0x00, 0xaf, 0xc8, 0x01, 0x09, 0x00, 0xf4, 0x16, 0x24, 0x0e,
+    0x81, 0x25, 0x0e, 0x81, 0x26, 0x0e, 0x81, 0x27, 0x0e, 0x81, 0x28, 0x0e, 0x81, 0x29, 0x0e, 0x81,
+    0x18, 0x0e, 0x81, 0x19, 0x0e, 0x81, 0x1a, 0x0e, 0x81, 0x1b, 0x0e, 0x81, 0x1c, 0x0e, 0x81, 0x1d,
+    0x0e, 0x81, 0x8e, 0x2d, 0x00, 0x14, 0x8f, 0x09, 0x00, 0x11, 0x1f, 0xfd, 0x10, 0x11, 0x21, 0xd3,
+    0x10, 0x11, 0x23, 0xa9, 0x10, 0xf1, 0x2e, 0x25, 0x06, 0x81, 0x26, 0x06, 0x81, 0x27, 0x06, 0x81,
+    0x28, 0x06, 0x81, 0x29, 0x06, 0x81, 0x2a, 0x06, 0x81, 0x9d, 0x06, 0x81, 0x9e, 0x06, 0x81, 0x9f,
+    0x06, 0x81, 0xd4, 0x0d, 0x81, 0xd5, 0x0d, 0x81, 0xd6, 0x0d, 0x81, 0xd7, 0x0d, 0x81, 0xd8, 0x0d,
+    0x81, 0xd9, 0x0d, 0x81, 0x52, 0x00, 0x81, 0x53, 0x00, 0x81, 0x54, 0x00, 0x81, 0x55, 0x00, 0x81,
+    0x56, 0x00, 0x81, 0x57, 0x53, 0x18, 0xf2, 0x7d, 0x47, 0x00, 0x81, 0x48, 0x00, 0x81, 0x49, 0x00,
+    0x81, 0x4a, 0x00, 0x81, 0x4b, 0x00, 0x81, 0xfd, 0x06, 0x81, 0xfe, 0x06, 0x81, 0xff, 0x06, 0x81,
+    0x00, 0x07, 0x81, 0x01, 0x07, 0x81, 0x02, 0x07, 0x81, 0x30, 0x0e, 0x81, 0x31, 0x0e, 0x81, 0x32,
+    0x0e, 0x81, 0x33, 0x0e, 0x81, 0x34, 0x0e, 0x81, 0x35, 0x0e, 0x81, 0x05, 0x00, 0x81, 0x06, 0x00,
+    0x81, 0x07, 0x00, 0x81, 0x08, 0x00, 0x81, 0x09, 0x00, 0x81, 0x0a, 0x00, 0x81, 0xe0, 0x06, 0x81,
+    0xe1, 0x06, 0x81, 0xe2, 0x06, 0x81, 0xe3, 0x06, 0x81, 0xe4, 0x06, 0x81, 0xe5, 0x06, 0x81, 0xed,
+    0x00, 0x81, 0xee, 0x00, 0x81, 0xef, 0x00, 0x81, 0xf0, 0x00, 0x81, 0xf1, 0x00, 0x81, 0xf2, 0x00,
+    0x81, 0x48, 0x01, 0x81, 0x49, 0x01, 0x81, 0x4a, 0x01, 0x81, 0x4b, 0x01, 0x81, 0x4c, 0x01, 0x81,
+    0x4d, 0x01, 0x81, 0xf2, 0x0d, 0x81, 0xf3, 0x0d, 0x81, 0xf4, 0x0d, 0x81, 0xf5, 0x0d, 0x81, 0xf6,
+    0x0d, 0x81, 0xf7, 0x0d, 0xdc, 0x16, 0xf0, 0x0f, 0x81, 0x04, 0x06, 0x81, 0x05, 0x06, 0x81, 0x06,
+    0x06, 0x81, 0x07, 0x06, 0x81, 0xde, 0x02, 0x81, 0xdf, 0x02, 0x81, 0xe0, 0x02, 0x81, 0xe1, 0x02,
+    0x81, 0xe2, 0x02, 0x81, 0xe3, 0x02, 0xe4, 0x11, 0x20, 0xe5, 0x05, 0xba, 0x11, 0x20, 0xe7, 0x05,
+    0x90, 0x11, 0xf0, 0x35, 0xe9, 0x05, 0x81, 0xc9, 0x0c, 0x81, 0xca, 0x0c, 0x81, 0xcb, 0x0c, 0x81,
+    0xcc, 0x0c, 0x81, 0xcd, 0x0c, 0x81, 0xce, 0x0c, 0x81, 0xdb, 0x0c, 0x81, 0xdc, 0x0c, 0x81, 0xdd,
+    0x0c, 0x81, 0xde, 0x0c, 0x81, 0xdf, 0x0c, 0x81, 0xe0, 0x0c, 0x81, 0xcf, 0x0c, 0x81, 0xd0, 0x0c,
+    0x81, 0xd1, 0x0c, 0x81, 0xd2, 0x0c, 0x81, 0xd3, 0x0c, 0x81, 0xd4, 0x0c, 0x81, 0x35, 0x07, 0x81,
+    0x36, 0x07, 0x81, 0x37, 0x07, 0x81, 0x38, 0x07, 0xd2, 0x1a, 0xf2, 0x2f, 0x3a, 0x07, 0x81, 0x10,
+    0x08, 0x81, 0x11, 0x08, 0x81, 0x12, 0x08, 0x81, 0x13, 0x08, 0x81, 0x14, 0x08, 0x81, 0x15, 0x08,
+    0x81, 0x22, 0x08, 0x81, 0x23, 0x08, 0x81, 0x24, 0x08, 0x81, 0x25, 0x08, 0x81, 0x26, 0x08, 0x81,
+    0x27, 0x08, 0x81, 0x16, 0x08, 0x81, 0x17, 0x08, 0x81, 0x18, 0x08, 0x81, 0x19, 0x08, 0x81, 0x1a,
+    0x08, 0x81, 0x1b, 0x08, 0x81, 0x41, 0x07, 0x81, 0x42, 0x07, 0x4e, 0x17, 0x00, 0x70, 0x0e, 0xf4,
+    0x61, 0x46, 0x07, 0x81, 0xb1, 0x0c, 0x81, 0xb2, 0x0c, 0x81, 0xb3, 0x0c, 0x81, 0xb4, 0x0c, 0x81,
+    0xb5, 0x0c, 0x81, 0xb6, 0x0c, 0x81, 0xc3, 0x0c, 0x81, 0xc4, 0x0c, 0x81, 0xc5, 0x0c, 0x81, 0xc6,
+    0x0c, 0x81, 0xc7, 0x0c, 0x81, 0xc8, 0x0c, 0x81, 0xb7, 0x0c, 0x81, 0xb8, 0x0c, 0x81, 0xb9, 0x0c,
+    0x81, 0xba, 0x0c, 0x81, 0xbb, 0x0c, 0x81, 0xbc, 0x0c, 0x81, 0x2f, 0x07, 0x81, 0x30, 0x07, 0x81,
+    0x31, 0x07, 0x81, 0x32, 0x07, 0x81, 0x33, 0x07, 0x81, 0x34, 0x07, 0x81, 0xd5, 0x0c, 0x81, 0xd6,
+    0x0c, 0x81, 0xd7, 0x0c, 0x81, 0xd8, 0x0c, 0x81, 0xd9, 0x0c, 0x81, 0xda, 0x0c, 0x81, 0xbd, 0x0c,
+    0x81, 0xbe, 0x0c, 0x81, 0xbf, 0x0c, 0x81, 0xc0, 0x0c, 0x81, 0xc1, 0x0c, 0x81, 0xc2, 0x0c, 0x81,
+    0x37, 0x1c, 0x02, 0x14, 0xa3, 0x09, 0x00, 0x14, 0x39, 0x09, 0x00, 0x14, 0x38, 0x09, 0x00, 0x00,
+    0x0d, 0xc5, 0x01, 0x09, 0x00, 0x14, 0x3a, 0x09, 0x00, 0xf0, 0xff, 0x74, 0x45, 0x06, 0x81, 0x46,
+    0x06, 0x81, 0x47, 0x06, 0x81, 0x51, 0x06, 0x81, 0x52, 0x06, 0x81, 0x53, 0x06, 0x81, 0x48, 0x06,
+    0x81, 0x49, 0x06, 0x81, 0x4a, 0x06, 0x81, 0x54, 0x06, 0x81, 0x55, 0x06, 0x81, 0x56, 0x06, 0x8b,
+    0x85, 0x0b, 0x8b, 0x86, 0x0b, 0x8b, 0x87, 0x0b, 0x8b, 0x88, 0x0b, 0x8b, 0x89, 0x0b, 0x8b, 0x8a,
+    0x0b, 0x8b, 0x39, 0x0c, 0x8b, 0x3a, 0x0c, 0x8b, 0x3b, 0x0c, 0x8b, 0xfd, 0x0b, 0x8b, 0xfe, 0x0b,
+    0x8b, 0xff, 0x0b, 0x8b, 0xc7, 0x0b, 0x8b, 0xc8, 0x0b, 0x8b, 0xc9, 0x0b, 0x8b, 0x3c, 0x0c, 0x8b,
+    0x3d, 0x0c, 0x8b, 0x3e, 0x0c, 0x8b, 0x00, 0x0c, 0x8b, 0x01, 0x0c, 0x8b, 0x02, 0x0c, 0x8b, 0xca,
+    0x0b, 0x8b, 0xcb, 0x0b, 0x8b, 0xcc, 0x0b, 0x8b, 0x07, 0x0b, 0x8b, 0x08, 0x0b, 0x8b, 0x09, 0x0b,
+    0x8b, 0x0d, 0x0b, 0x8b, 0x0e, 0x0b, 0x8b, 0x0f, 0x0b, 0x8b, 0xef, 0x0a, 0x8b, 0xf0, 0x0a, 0x8b,
+    0xf1, 0x0a, 0x8b, 0xf5, 0x0a, 0x8b, 0xf6, 0x0a, 0x8b, 0xf7, 0x0a, 0x8b, 0x09, 0x0c, 0x8b, 0x0a,
+    0x0c, 0x8b, 0x0b, 0x0c, 0x8b, 0xd3, 0x0b, 0x8b, 0xd4, 0x0b, 0x8b, 0xd5, 0x0b, 0x8b, 0xdf, 0x0b,
+    0x8b, 0xe0, 0x0b, 0x8b, 0xe1, 0x0b, 0x8b, 0x97, 0x0b, 0x8b, 0x98, 0x0b, 0x8b, 0x99, 0x0b, 0x8b,
+    0x0a, 0x0b, 0x8b, 0x0b, 0x0b, 0x8b, 0x0c, 0x0b, 0x8b, 0x10, 0x0b, 0x8b, 0x11, 0x0b, 0x8b, 0x12,
+    0x0b, 0x8b, 0xf2, 0x0a, 0x8b, 0xf3, 0x0a, 0x8b, 0xf4, 0x0a, 0x8b, 0xf8, 0x0a, 0x8b, 0xf9, 0x0a,
+    0x8b, 0xfa, 0x0a, 0x8b, 0x0c, 0x0c, 0x8b, 0x0d, 0x0c, 0x8b, 0x0e, 0x0c, 0x8b, 0xd6, 0x0b, 0x8b,
+    0xd7, 0x0b, 0x8b, 0xd8, 0x0b, 0x8b, 0xe2, 0x0b, 0x8b, 0xe3, 0x0b, 0x8b, 0xe4, 0x0b, 0x8b, 0x9a,
+    0x0b, 0x8b, 0x9b, 0x0b, 0x8b, 0x9c, 0x0b, 0x8b, 0x1b, 0x0c, 0x8b, 0x1c, 0x0c, 0x8b, 0x1d, 0x0c,
+    0x8b, 0x15, 0x0c, 0x8b, 0x16, 0x0c, 0x8b, 0x17, 0x0c, 0x8b, 0xa9, 0x0b, 0x8b, 0xaa, 0x0b, 0x8b,
+    0xab, 0x0b, 0x8b, 0xa3, 0x0b, 0x8b, 0xa4, 0x0b, 0x8b, 0xa5, 0x0b, 0x8b, 0x1e, 0x0c, 0x8b, 0x1f,
+    0x0c, 0x8b, 0x20, 0x0c, 0x8b, 0x18, 0x0c, 0x8b, 0x19, 0x0c, 0x8b, 0x1a, 0x0c, 0x8b, 0xac, 0x0b,
+    0x8b, 0xad, 0x0b, 0x8b, 0xae, 0x0b, 0x8b, 0xa6, 0x0b, 0x8b, 0xa7, 0x0b, 0x8b, 0xa8, 0x0b, 0x81,
+    0xf8, 0x07, 0x81, 0xf9, 0x07, 0x81, 0xfa, 0x07, 0x81, 0xfb, 0x07, 0x81, 0xfc, 0x07, 0x81, 0xfd,
+    0x07, 0x81, 0x0a, 0x08, 0x81, 0x0b, 0x08, 0x81, 0x0c, 0x08, 0x81, 0x0d, 0x08, 0x81, 0x0e, 0x08,
+    0x81, 0x0f, 0x08, 0x81, 0xfe, 0x07, 0x81, 0xff, 0x07, 0x81, 0x00, 0x08, 0x81, 0x01, 0x08, 0x81,
+    0x02, 0x08, 0x81, 0x03, 0x08, 0x81, 0x4a, 0x02, 0x81, 0x4b, 0x02, 0x81, 0x4c, 0x02, 0x2a, 0x14,
+    0x20, 0x05, 0x02, 0x73, 0x13, 0x71, 0x4d, 0x02, 0x81, 0x4e, 0x02, 0x81, 0x4f, 0x64, 0x13, 0x53,
+    0x08, 0x02, 0x81, 0x09, 0x02, 0xd6, 0x11, 0xa1, 0x74, 0x01, 0x81, 0x02, 0x01, 0x81, 0x03, 0x01,
+    0x81, 0x04, 0x03, 0x12, 0xf1, 0x07, 0x76, 0x01, 0x81, 0x77, 0x01, 0x81, 0x05, 0x01, 0x81, 0x06,
+    0x01, 0x81, 0x07, 0x01, 0x81, 0x3c, 0x02, 0x81, 0x3d, 0x02, 0x81, 0x3e, 0x8b, 0x13, 0x10, 0xf7,
+    0x36, 0x14, 0x51, 0x81, 0x3f, 0x02, 0x81, 0x40, 0xb0, 0x12, 0x11, 0xf9, 0x9d, 0x13, 0xf4, 0x19,
+    0xfb, 0x01, 0x81, 0x64, 0x01, 0x81, 0x65, 0x01, 0x81, 0x66, 0x01, 0x81, 0xf4, 0x00, 0x81, 0xf5,
+    0x00, 0x81, 0xf6, 0x00, 0x81, 0x67, 0x01, 0x81, 0x68, 0x01, 0x81, 0x69, 0x01, 0x81, 0xf7, 0x00,
+    0x81, 0xf8, 0x00, 0x81, 0xf9, 0x00, 0x81, 0x3b, 0x13, 0x02, 0x14, 0xa5, 0x09, 0x00, 0x14, 0x3d,
+    0x09, 0x00, 0x14, 0x3c, 0x09, 0x00, 0x14, 0xa6, 0x09, 0x00, 0x14, 0x3e, 0x09, 0x00, 0xf3, 0x28,
+    0x4b, 0x06, 0x81, 0x4c, 0x06, 0x81, 0x4d, 0x06, 0x81, 0x57, 0x06, 0x81, 0x58, 0x06, 0x81, 0x59,
+    0x06, 0x81, 0x4e, 0x06, 0x81, 0x4f, 0x06, 0x81, 0x50, 0x06, 0x81, 0x5a, 0x06, 0x81, 0x5b, 0x06,
+    0x81, 0x5c, 0x06, 0x8b, 0x8b, 0x00, 0x8b, 0x8c, 0x00, 0x8b, 0x8d, 0x00, 0x8b, 0x8e, 0x00, 0x8b,
+    0x8f, 0x00, 0x8b, 0x90, 0x00, 0x8b, 0x43, 0xd2, 0xdd, 0x24, 0x8b, 0x44, 0x09, 0x00, 0x14, 0x2c,
+    0x09, 0x00, 0xf4, 0x5e, 0xc7, 0x0d, 0x8b, 0xc8, 0x0d, 0x8b, 0xc9, 0x0d, 0x8b, 0xca, 0x0d, 0x8b,
+    0xcb, 0x0d, 0x8b, 0xcc, 0x0d, 0x81, 0x3f, 0x0c, 0x81, 0x40, 0x0c, 0x81, 0x41, 0x0c, 0x81, 0x42,
+    0x0c, 0x81, 0x43, 0x0c, 0x81, 0x44, 0x0c, 0x81, 0x0f, 0x0c, 0x81, 0x10, 0x0c, 0x81, 0x11, 0x0c,
+    0x81, 0x12, 0x0c, 0x81, 0x13, 0x0c, 0x81, 0x14, 0x0c, 0x81, 0x21, 0x0c, 0x81, 0x22, 0x0c, 0x81,
+    0x23, 0x0c, 0x81, 0x24, 0x0c, 0x81, 0x25, 0x0c, 0x81, 0x26, 0x0c, 0x81, 0x53, 0x07, 0x81, 0x54,
+    0x07, 0x81, 0x55, 0x07, 0x81, 0x56, 0x07, 0x81, 0x57, 0x07, 0x81, 0x58, 0x07, 0x81, 0xb9, 0x0a,
+    0x81, 0xba, 0x0a, 0x81, 0xbb, 0x0a, 0x81, 0xbc, 0x0a, 0x81, 0xbd, 0x0a, 0x81, 0xbe, 0x0a, 0x81,
+    0xa9, 0xc6, 0x00, 0x14, 0xaa, 0x09, 0x00, 0xf0, 0xff, 0xff, 0xa7, 0x63, 0x0c, 0x81, 0x64, 0x0c,
+    0x81, 0x65, 0x0c, 0x81, 0x66, 0x0c, 0x81, 0x67, 0x0c, 0x81, 0x68, 0x0c, 0x81, 0x69, 0x0c, 0x81,
+    0x6a, 0x0c, 0x81, 0x6b, 0x0c, 0x81, 0x6c, 0x0c, 0x81, 0x6d, 0x0c, 0x81, 0x6e, 0x0c, 0x81, 0xb1,
+    0x09, 0x81, 0xb2, 0x09, 0x81, 0xb3, 0x09, 0x81, 0xb4, 0x09, 0x81, 0xb5, 0x09, 0x81, 0xb6, 0x09,
+    0x81, 0x7d, 0x07, 0x81, 0x7e, 0x07, 0x81, 0x7f, 0x07, 0x81, 0x8f, 0x07, 0x81, 0x90, 0x07, 0x81,
+    0x91, 0x07, 0x81, 0x80, 0x07, 0x81, 0x81, 0x07, 0x81, 0x82, 0x07, 0x81, 0x92, 0x07, 0x81, 0x93,
+    0x07, 0x81, 0x94, 0x07, 0x81, 0x65, 0x07, 0x81, 0x66, 0x07, 0x81, 0x67, 0x07, 0x81, 0x68, 0x07,
+    0x81, 0x69, 0x07, 0x81, 0x6a, 0x07, 0x81, 0x6b, 0x07, 0x81, 0x6c, 0x07, 0x81, 0x6d, 0x07, 0x81,
+    0x6e, 0x07, 0x81, 0x6f, 0x07, 0x81, 0x70, 0x07, 0x81, 0x81, 0x09, 0x81, 0x82, 0x09, 0x81, 0x83,
+    0x09, 0x81, 0x84, 0x09, 0x81, 0x85, 0x09, 0x81, 0x86, 0x09, 0x81, 0x83, 0x07, 0x81, 0x84, 0x07,
+    0x81, 0x85, 0x07, 0x81, 0x89, 0x07, 0x81, 0x8a, 0x07, 0x81, 0x8b, 0x07, 0x81, 0x86, 0x07, 0x81,
+    0x87, 0x07, 0x81, 0x88, 0x07, 0x81, 0x8c, 0x07, 0x81, 0x8d, 0x07, 0x81, 0x8e, 0x07, 0x81, 0x95,
+    0x07, 0x81, 0x96, 0x07, 0x81, 0x97, 0x07, 0x81, 0x98, 0x07, 0x81, 0x99, 0x07, 0x81, 0x9a, 0x07,
+    0x81, 0x03, 0x0c, 0x81, 0x04, 0x0c, 0x81, 0x05, 0x0c, 0x81, 0x06, 0x0c, 0x81, 0x07, 0x0c, 0x81,
+    0x08, 0x0c, 0x81, 0xd9, 0x0b, 0x81, 0xda, 0x0b, 0x81, 0xdb, 0x0b, 0x81, 0xe5, 0x0b, 0x81, 0xe6,
+    0x0b, 0x81, 0xe7, 0x0b, 0x81, 0xdc, 0x0b, 0x81, 0xdd, 0x0b, 0x81, 0xde, 0x0b, 0x81, 0xe8, 0x0b,
+    0x81, 0xe9, 0x0b, 0x81, 0xea, 0x0b, 0x81, 0x9b, 0x07, 0x81, 0x9c, 0x07, 0x81, 0x9d, 0x07, 0x81,
+    0x9e, 0x07, 0x81, 0x9f, 0x07, 0x81, 0xa0, 0x07, 0x81, 0xa1, 0x0a, 0x81, 0xa2, 0x0a, 0x81, 0xa3,
+    0x0a, 0x81, 0xa4, 0x0a, 0x81, 0xa5, 0x0a, 0x81, 0xa6, 0x0a, 0x81, 0xa7, 0x0a, 0x81, 0xa8, 0x0a,
+    0x81, 0xa9, 0x0a, 0x81, 0xaa, 0x0a, 0x81, 0xab, 0x0a, 0x81, 0xac, 0x0a, 0x81, 0xef, 0x01, 0x81,
+    0xf0, 0x01, 0x81, 0xf1, 0x01, 0x81, 0xf2, 0x01, 0x81, 0xf3, 0x01, 0x81, 0xf4, 0x01, 0x81, 0x97,
+    0x06, 0x81, 0x98, 0x06, 0x81, 0x99, 0x06, 0x81, 0x57, 0x0c, 0x81, 0x58, 0x0c, 0x81, 0x59, 0x0c,
+    0x81, 0x5a, 0x0c, 0x81, 0x5b, 0x0c, 0x81, 0x5c, 0x0c, 0x81, 0x5d, 0x0c, 0x81, 0x5e, 0x0c, 0x81,
+    0x5f, 0x0c, 0x81, 0x60, 0x0c, 0x81, 0x61, 0x0c, 0x81, 0x62, 0x0c, 0x81, 0xab, 0x09, 0x81, 0xac,
+    0x09, 0x81, 0xad, 0x09, 0x81, 0xae, 0x09, 0x81, 0xaf, 0x09, 0x81, 0xb0, 0x09, 0x81, 0xe3, 0x0a,
+    0x81, 0xe4, 0x0a, 0x81, 0xe5, 0x0a, 0x81, 0xe9, 0x0a, 0x81, 0xea, 0x0a, 0x81, 0xeb, 0x0a, 0x81,
+    0xe6, 0x0a, 0x81, 0xe7, 0x0a, 0x81, 0xe8, 0x0a, 0x81, 0xec, 0x0a, 0x81, 0xed, 0x0a, 0x81, 0xee,
+    0x0a, 0x81, 0x59, 0x07, 0x81, 0x5a, 0x07, 0x81, 0x5b, 0x07, 0x81, 0x5c, 0x07, 0x81, 0x5d, 0x07,
+    0x81, 0x5e, 0x07, 0x81, 0x5f, 0x07, 0x81, 0x60, 0x07, 0x81, 0x61, 0x07, 0x81, 0x62, 0x07, 0x81,
+    0x63, 0x07, 0x81, 0x64, 0x07, 0x81, 0x7b, 0x09, 0x81, 0x7c, 0x09, 0x81, 0x7d, 0x09, 0x81, 0x7e,
+    0x09, 0x81, 0x7f, 0x09, 0x81, 0x80, 0x09, 0x81, 0xe1, 0x0c, 0x81, 0xe2, 0x0c, 0x81, 0xe3, 0x0c,
+    0x81, 0xe7, 0x0c, 0x81, 0xe8, 0x0c, 0x81, 0xe9, 0x0c, 0x81, 0xe4, 0x0c, 0x81, 0xe5, 0x0c, 0x81,
+    0xe6, 0x0c, 0x81, 0xea, 0x0c, 0x81, 0xeb, 0x0c, 0x81, 0xec, 0x0c, 0x81, 0xcd, 0x0b, 0x81, 0xce,
+    0x0b, 0x81, 0xcf, 0x0b, 0x81, 0xd0, 0x0b, 0x81, 0xd1, 0x0b, 0x81, 0xd2, 0x0b, 0x81, 0x9d, 0x0b,
+    0x81, 0x9e, 0x0b, 0x81, 0x9f, 0x0b, 0x81, 0xa0, 0x0b, 0x81, 0xa1, 0x0b, 0x81, 0xa2, 0x0b, 0x81,
+    0xaf, 0x0b, 0x81, 0xb0, 0x0b, 0x81, 0xb1, 0x0b, 0x81, 0xb2, 0x0b, 0x81, 0xb3, 0x0b, 0x81, 0xb4,
+    0x0b, 0x81, 0xc5, 0x0a, 0x81, 0xc6, 0x0a, 0x81, 0xc7, 0x0a, 0x81, 0xc8, 0x0a, 0x81, 0xc9, 0x0a,
+    0x81, 0xca, 0x0a, 0x81, 0x63, 0x09, 0x81, 0x64, 0x09, 0x81, 0x65, 0x09, 0x81, 0x66, 0x09, 0x81,
+    0x67, 0x09, 0x81, 0x68, 0x09, 0x81, 0x1f, 0x0b, 0x81, 0x20, 0x0b, 0x81, 0x21, 0x0b, 0x81, 0x22,
+    0x0b, 0x81, 0x23, 0x0b, 0x81, 0x24, 0x0b, 0x81, 0x45, 0x0c, 0x81, 0x46, 0x0c, 0x81, 0x47, 0x0c,
+    0x81, 0x48, 0x0c, 0x81, 0x49, 0x0c, 0x81, 0x4a, 0x0c, 0x81, 0x6f, 0x0c, 0x81, 0x70, 0x0c, 0x81,
+    0x71, 0x0c, 0x81, 0x72, 0x0c, 0x81, 0x73, 0x0c, 0x81, 0x74, 0x0c, 0x81, 0x4b, 0x0c, 0x81, 0x4c,
+    0x0c, 0x81, 0x4d, 0x0c, 0x81, 0x4e, 0x0c, 0x81, 0x4f, 0x0c, 0x81, 0x50, 0x0c, 0x81, 0x51, 0x0c,
+    0x81, 0x52, 0x0c, 0x81, 0x53, 0x0c, 0x81, 0x54, 0x0c, 0x81, 0x55, 0x0c, 0x81, 0x56, 0x0c, 0xd9,
+    0x14, 0xa1, 0x48, 0x07, 0x81, 0x49, 0x07, 0x81, 0x4a, 0x07, 0x81, 0x4b, 0xdf, 0x14, 0xf1, 0x01,
+    0x71, 0x07, 0x81, 0x72, 0x07, 0x81, 0x73, 0x07, 0x81, 0x74, 0x07, 0x81, 0x75, 0x07, 0x81, 0x76,
+    0xee, 0x14, 0x10, 0x4e, 0xf1, 0x14, 0xf0, 0xe3, 0x81, 0x50, 0x07, 0x81, 0x51, 0x07, 0x81, 0x52,
+    0x07, 0x81, 0x79, 0x0b, 0x81, 0x7a, 0x0b, 0x81, 0x7b, 0x0b, 0x81, 0x7c, 0x0b, 0x81, 0x7d, 0x0b,
+    0x81, 0x7e, 0x0b, 0x81, 0x5d, 0x09, 0x81, 0x5e, 0x09, 0x81, 0x5f, 0x09, 0x81, 0x60, 0x09, 0x81,
+    0x61, 0x09, 0x81, 0x62, 0x09, 0x81, 0x9b, 0x0a, 0x81, 0x9c, 0x0a, 0x81, 0x9d, 0x0a, 0x81, 0x9e,
+    0x0a, 0x81, 0x9f, 0x0a, 0x81, 0xa0, 0x0a, 0x81, 0xc2, 0x08, 0x81, 0xc3, 0x08, 0x81, 0xc4, 0x08,
+    0x81, 0xc5, 0x08, 0x81, 0xc6, 0x08, 0x81, 0xc7, 0x08, 0x81, 0xb6, 0x08, 0x81, 0xb7, 0x08, 0x81,
+    0xb8, 0x08, 0x81, 0xb9, 0x08, 0x81, 0xba, 0x08, 0x81, 0xbb, 0x08, 0x81, 0x33, 0x0c, 0x81, 0x34,
+    0x0c, 0x81, 0x35, 0x0c, 0x81, 0x36, 0x0c, 0x81, 0x37, 0x0c, 0x81, 0x38, 0x0c, 0x81, 0xf7, 0x0b,
+    0x81, 0xf8, 0x0b, 0x81, 0xf9, 0x0b, 0x81, 0xfa, 0x0b, 0x81, 0xfb, 0x0b, 0x81, 0xfc, 0x0b, 0x81,
+    0xc1, 0x0b, 0x81, 0xc2, 0x0b, 0x81, 0xc3, 0x0b, 0x81, 0xc4, 0x0b, 0x81, 0xc5, 0x0b, 0x81, 0xc6,
+    0x0b, 0x81, 0x17, 0x01, 0x81, 0x18, 0x01, 0x81, 0x19, 0x01, 0x81, 0x1a, 0x01, 0x81, 0x1b, 0x01,
+    0x81, 0x1c, 0x01, 0x81, 0x13, 0x0b, 0x81, 0x14, 0x0b, 0x81, 0x15, 0x0b, 0x81, 0x19, 0x0b, 0x81,
+    0x1a, 0x0b, 0x81, 0x1b, 0x0b, 0x81, 0x16, 0x0b, 0x81, 0x17, 0x0b, 0x81, 0x18, 0x0b, 0x81, 0x1c,
+    0x0b, 0x81, 0x1d, 0x0b, 0x81, 0x1e, 0x0b, 0x81, 0xfb, 0x0a, 0x81, 0xfc, 0x0a, 0x81, 0xfd, 0x0a,
+    0x81, 0x01, 0x0b, 0x81, 0x02, 0x0b, 0x81, 0x03, 0x0b, 0x81, 0xfe, 0x0a, 0x81, 0xff, 0x0a, 0x81,
+    0x00, 0x0b, 0x81, 0x04, 0x0b, 0x81, 0x05, 0x0b, 0x81, 0x06, 0x20, 0x22, 0x50, 0x81, 0xd6, 0x08,
+    0x81, 0xd7, 0x45, 0x0f, 0x51, 0x81, 0xce, 0x08, 0x81, 0xcf, 0x09, 0x00, 0x41, 0xd8, 0x08, 0x81,
+    0xd9, 0x09, 0x00, 0x50, 0xd0, 0x08, 0x81, 0xd1, 0x08, 0xb6, 0x16, 0x11, 0x85, 0xb9, 0x16, 0x10,
+    0x87, 0xbc, 0x16, 0x02, 0x42, 0x0f, 0x41, 0x81, 0x6a, 0x00, 0x81, 0x66, 0x3b, 0x00, 0xb6, 0x16,
+    0x00, 0x6c, 0xd9, 0x51, 0x00, 0x81, 0x6c, 0x00, 0x81, 0x6c, 0x3b, 0x00, 0xc5, 0x16, 0x01, 0x27,
+    0x0f, 0x41, 0x81, 0x6e, 0x00, 0x81, 0x72, 0x3b, 0x52, 0x81, 0x71, 0x00, 0x81, 0x72, 0x46, 0x04,
+    0x21, 0x00, 0x81, 0x7e, 0x3b, 0x00, 0x09, 0x00, 0xf0, 0xff, 0x1f, 0x73, 0x00, 0x81, 0x17, 0x07,
+    0x81, 0x18, 0x07, 0x81, 0x19, 0x07, 0x81, 0x1a, 0x07, 0x81, 0x1b, 0x07, 0x81, 0x1c, 0x07, 0x81,
+    0x29, 0x07, 0x81, 0x2a, 0x07, 0x81, 0x2b, 0x07, 0x81, 0x2c, 0x07, 0x81, 0x2d, 0x07, 0x81, 0x2e,
+    0x07, 0x81, 0x1d, 0x07, 0x81, 0x1e, 0x07, 0x81, 0x1f, 0x07, 0x81, 0x20, 0x07, 0x81, 0x21, 0x07,
+    0x81, 0x22, 0x07, 0x81, 0x23, 0x07, 0x81, 0x24, 0x07, 0x81, 0x25, 0x07, 0x81, 0x26, 0x07, 0x81,
+    0x27, 0x07, 0x81, 0x28, 0x07, 0x81, 0x2c, 0x0a, 0x81, 0x2d, 0x0a, 0x81, 0x2e, 0x0a, 0x81, 0x2f,
+    0x0a, 0x81, 0x30, 0x0a, 0x81, 0x31, 0x0a, 0x81, 0x20, 0x0a, 0x81, 0x21, 0x0a, 0x81, 0x22, 0x0a,
+    0x81, 0x23, 0x0a, 0x81, 0x24, 0x0a, 0x81, 0x25, 0x0a, 0x81, 0x26, 0x0a, 0x81, 0x27, 0x0a, 0x81,
+    0x28, 0x0a, 0x81, 0x29, 0x0a, 0x81, 0x2a, 0x0a, 0x81, 0x2b, 0x0a, 0x81, 0x38, 0x0a, 0x81, 0x39,
+    0x0a, 0x81, 0x3a, 0x0a, 0x81, 0x3b, 0x0a, 0x81, 0x3c, 0x0a, 0x81, 0x3d, 0x0a, 0x81, 0x3e, 0x0a,
+    0x81, 0x3f, 0x0a, 0x81, 0x40, 0x0a, 0x81, 0x41, 0x0a, 0x81, 0x42, 0x0a, 0x81, 0x43, 0x0a, 0x81,
+    0x32, 0x0a, 0x81, 0x33, 0x0a, 0x81, 0x34, 0x0a, 0x81, 0x35, 0x0a, 0x81, 0x36, 0x0a, 0x81, 0x37,
+    0x0a, 0x81, 0x81, 0x0c, 0x81, 0x82, 0x0c, 0x81, 0x83, 0x0c, 0x81, 0x93, 0x0c, 0x81, 0x94, 0x0c,
+    0x81, 0x95, 0x0c, 0x81, 0x84, 0x0c, 0x81, 0x85, 0x0c, 0x81, 0x86, 0x0c, 0x81, 0x96, 0x0c, 0x81,
+    0x97, 0x0c, 0x81, 0x98, 0x0c, 0x81, 0x87, 0x0c, 0x81, 0x88, 0x0c, 0x81, 0x89, 0x0c, 0x81, 0x8d,
+    0x0c, 0x81, 0x8e, 0x0c, 0x81, 0x8f, 0x0c, 0x81, 0x8a, 0x0c, 0x81, 0x8b, 0x0c, 0x81, 0x8c, 0x0c,
+    0x81, 0x90, 0x0c, 0x81, 0x91, 0x0c, 0x81, 0x92, 0x0c, 0x81, 0x95, 0x0a, 0x81, 0x96, 0x0a, 0x81,
+    0x97, 0x0a, 0x81, 0x98, 0x0a, 0x81, 0x99, 0x0a, 0x81, 0x9a, 0x0a, 0x81, 0x04, 0x08, 0x81, 0x05,
+    0x08, 0x81, 0x06, 0x08, 0x81, 0x07, 0x08, 0x81, 0x08, 0x08, 0x81, 0x09, 0x08, 0x81, 0x9a, 0x06,
+    0x81, 0x9b, 0x06, 0x81, 0x9c, 0x06, 0x81, 0x3b, 0x35, 0x24, 0xf1, 0x8d, 0x81, 0x3d, 0x07, 0x81,
+    0x3e, 0x07, 0x81, 0x3f, 0x07, 0x81, 0x40, 0x07, 0x81, 0x94, 0x0d, 0x81, 0x95, 0x0d, 0x81, 0x96,
+    0x0d, 0x81, 0x86, 0x0d, 0x81, 0x87, 0x0d, 0x81, 0x88, 0x0d, 0x81, 0x97, 0x0d, 0x81, 0x98, 0x0d,
+    0x81, 0x99, 0x0d, 0x81, 0x89, 0x0d, 0x81, 0x8a, 0x0d, 0x81, 0x8b, 0x0d, 0x81, 0x7d, 0x0a, 0x81,
+    0x7e, 0x0a, 0x81, 0x7f, 0x0a, 0x81, 0x80, 0x0a, 0x81, 0x81, 0x0a, 0x81, 0x82, 0x0a, 0x81, 0x71,
+    0x0a, 0x81, 0x72, 0x0a, 0x81, 0x73, 0x0a, 0x81, 0x74, 0x0a, 0x81, 0x75, 0x0a, 0x81, 0x76, 0x0a,
+    0x81, 0x77, 0x0a, 0x81, 0x78, 0x0a, 0x81, 0x79, 0x0a, 0x81, 0x7a, 0x0a, 0x81, 0x7b, 0x0a, 0x81,
+    0x7c, 0x0a, 0x81, 0x89, 0x0a, 0x81, 0x8a, 0x0a, 0x81, 0x8b, 0x0a, 0x81, 0x8c, 0x0a, 0x81, 0x8d,
+    0x0a, 0x81, 0x8e, 0x0a, 0x81, 0x8f, 0x0a, 0x81, 0x90, 0x0a, 0x81, 0x91, 0x0a, 0x81, 0x92, 0x0a,
+    0x81, 0x93, 0x0a, 0x81, 0x94, 0x0a, 0x81, 0x83, 0x0a, 0x81, 0x84, 0x0a, 0x81, 0x85, 0x0a, 0x81,
+    0x86, 0x0a, 0x81, 0x87, 0x0a, 0x81, 0x88, 0x0a, 0x52, 0x11, 0x31, 0x08, 0x81, 0x8f, 0x37, 0x02,
+    0x41, 0xda, 0x08, 0x81, 0xdb, 0x09, 0x00, 0x41, 0x90, 0x08, 0x81, 0x91, 0x09, 0x00, 0xf1, 0xff,
+    0xff, 0xc7, 0xdc, 0x08, 0x81, 0xdd, 0x08, 0x81, 0x1c, 0x08, 0x81, 0x1d, 0x08, 0x81, 0x1e, 0x08,
+    0x81, 0x1f, 0x08, 0x81, 0x20, 0x08, 0x81, 0x21, 0x08, 0x81, 0x99, 0x09, 0x81, 0x9a, 0x09, 0x81,
+    0x9b, 0x09, 0x81, 0x9c, 0x09, 0x81, 0x9d, 0x09, 0x81, 0x9e, 0x09, 0x81, 0x9f, 0x09, 0x81, 0xa0,
+    0x09, 0x81, 0xa1, 0x09, 0x81, 0xa5, 0x09, 0x81, 0xa6, 0x09, 0x81, 0xa7, 0x09, 0x81, 0xa2, 0x09,
+    0x81, 0xa3, 0x09, 0x81, 0xa4, 0x09, 0x81, 0xa8, 0x09, 0x81, 0xa9, 0x09, 0x81, 0xaa, 0x09, 0x81,
+    0xc3, 0x09, 0x81, 0xc4, 0x09, 0x81, 0xc5, 0x09, 0x81, 0xc6, 0x09, 0x81, 0xc7, 0x09, 0x81, 0xc8,
+    0x09, 0x81, 0xb7, 0x09, 0x81, 0xb8, 0x09, 0x81, 0xb9, 0x09, 0x81, 0xbd, 0x09, 0x81, 0xbe, 0x09,
+    0x81, 0xbf, 0x09, 0x81, 0xba, 0x09, 0x81, 0xbb, 0x09, 0x81, 0xbc, 0x09, 0x81, 0xc0, 0x09, 0x81,
+    0xc1, 0x09, 0x81, 0xc2, 0x09, 0x81, 0x69, 0x09, 0x81, 0x6a, 0x09, 0x81, 0x6b, 0x09, 0x81, 0x6c,
+    0x09, 0x81, 0x6d, 0x09, 0x81, 0x6e, 0x09, 0x81, 0x6f, 0x09, 0x81, 0x70, 0x09, 0x81, 0x71, 0x09,
+    0x81, 0x75, 0x09, 0x81, 0x76, 0x09, 0x81, 0x77, 0x09, 0x81, 0x72, 0x09, 0x81, 0x73, 0x09, 0x81,
+    0x74, 0x09, 0x81, 0x78, 0x09, 0x81, 0x79, 0x09, 0x81, 0x7a, 0x09, 0x81, 0x93, 0x09, 0x81, 0x94,
+    0x09, 0x81, 0x95, 0x09, 0x81, 0x96, 0x09, 0x81, 0x97, 0x09, 0x81, 0x98, 0x09, 0x81, 0x87, 0x09,
+    0x81, 0x88, 0x09, 0x81, 0x89, 0x09, 0x81, 0x8d, 0x09, 0x81, 0x8e, 0x09, 0x81, 0x8f, 0x09, 0x81,
+    0x8a, 0x09, 0x81, 0x8b, 0x09, 0x81, 0x8c, 0x09, 0x81, 0x90, 0x09, 0x81, 0x91, 0x09, 0x81, 0x92,
+    0x09, 0x81, 0xad, 0x0a, 0x81, 0xae, 0x0a, 0x81, 0xaf, 0x0a, 0x81, 0xb3, 0x0a, 0x81, 0xb4, 0x0a,
+    0x81, 0xb5, 0x0a, 0x81, 0xb0, 0x0a, 0x81, 0xb1, 0x0a, 0x81, 0xb2, 0x0a, 0x81, 0xb6, 0x0a, 0x81,
+    0xb7, 0x0a, 0x81, 0xb8, 0x0a, 0x81, 0x8a, 0x05, 0x81, 0x8b, 0x05, 0x81, 0x8c, 0x05, 0x81, 0x7c,
+    0x05, 0x81, 0x7d, 0x05, 0x81, 0x7e, 0x05, 0x81, 0x8d, 0x05, 0x81, 0x8e, 0x05, 0x81, 0x8f, 0x05,
+    0x81, 0x7f, 0x05, 0x81, 0x80, 0x05, 0x81, 0x81, 0x05, 0x81, 0x45, 0x09, 0x81, 0x46, 0x09, 0x81,
+    0x47, 0x09, 0x81, 0x4b, 0x09, 0x81, 0x4c, 0x09, 0x81, 0x4d, 0x09, 0x81, 0x48, 0x09, 0x81, 0x49,
+    0x09, 0x81, 0x4a, 0x09, 0x81, 0x4e, 0x09, 0x81, 0x4f, 0x09, 0x81, 0x50, 0x09, 0x81, 0x27, 0x0c,
+    0x81, 0x28, 0x0c, 0x81, 0x29, 0x0c, 0x81, 0x2d, 0x0c, 0x81, 0x2e, 0x0c, 0x81, 0x2f, 0x0c, 0x81,
+    0x2a, 0x0c, 0x81, 0x2b, 0x0c, 0x81, 0x2c, 0x0c, 0x81, 0x30, 0x0c, 0x81, 0x31, 0x0c, 0x81, 0x32,
+    0x0c, 0x81, 0xeb, 0x0b, 0x81, 0xec, 0x0b, 0x81, 0xed, 0x0b, 0x81, 0xf1, 0x0b, 0x81, 0xf2, 0x0b,
+    0x81, 0xf3, 0x0b, 0x81, 0xee, 0x0b, 0x81, 0xef, 0x0b, 0x81, 0xf0, 0x0b, 0x81, 0xf4, 0x0b, 0x81,
+    0xf5, 0x0b, 0x81, 0xf6, 0x0b, 0x81, 0xb5, 0x0b, 0x81, 0xb6, 0x0b, 0x81, 0xb7, 0x0b, 0x81, 0xbb,
+    0x0b, 0x81, 0xbc, 0x0b, 0x81, 0xbd, 0x0b, 0x81, 0xb8, 0x0b, 0x81, 0xb9, 0x0b, 0x81, 0xba, 0x0b,
+    0x81, 0xbe, 0x0b, 0x81, 0xbf, 0x0b, 0x81, 0xc0, 0x0b, 0x81, 0x07, 0x0d, 0x81, 0x08, 0x0d, 0x81,
+    0x09, 0x0d, 0x81, 0x01, 0x0d, 0x81, 0x02, 0x0d, 0x81, 0x03, 0x0d, 0x81, 0x0a, 0x0d, 0x81, 0x0b,
+    0x0d, 0x81, 0x0c, 0x0d, 0x81, 0x04, 0x0d, 0x81, 0x05, 0x0d, 0x81, 0x06, 0x0d, 0x81, 0x67, 0x0d,
+    0x81, 0x68, 0x0d, 0x81, 0x69, 0x0d, 0x81, 0x61, 0x0d, 0x81, 0x62, 0x0d, 0x81, 0x63, 0x0d, 0x81,
+    0x6a, 0x0d, 0x81, 0x6b, 0x0d, 0x81, 0x6c, 0x0d, 0x81, 0x64, 0x0d, 0x81, 0x65, 0x0d, 0x81, 0x66,
+    0x0d, 0x81, 0x70, 0x08, 0x81, 0x71, 0x08, 0x81, 0x72, 0x08, 0x81, 0x73, 0x08, 0x81, 0x74, 0x08,
+    0x81, 0x75, 0x08, 0x81, 0x76, 0x08, 0x81, 0x77, 0x08, 0x81, 0x78, 0x08, 0x81, 0x79, 0x08, 0x81,
+    0x7a, 0x08, 0x81, 0x7b, 0x08, 0x81, 0x7c, 0x08, 0x81, 0x7d, 0x08, 0x81, 0x7e, 0x08, 0x81, 0x7f,
+    0x08, 0x81, 0x80, 0x08, 0x81, 0x81, 0x08, 0x81, 0x82, 0x08, 0x81, 0x83, 0x08, 0x81, 0x84, 0x08,
+    0x81, 0x85, 0x08, 0x81, 0x86, 0x08, 0x81, 0x87, 0x08, 0x81, 0xcb, 0x0a, 0x81, 0xcc, 0x0a, 0x81,
+    0xcd, 0x0a, 0x81, 0xdd, 0x0a, 0x81, 0xde, 0x0a, 0x81, 0xdf, 0x0a, 0x81, 0xce, 0x0a, 0x81, 0xcf,
+    0x0a, 0x81, 0xd0, 0x0a, 0x81, 0xe0, 0x0a, 0x81, 0xe1, 0x0a, 0x81, 0xe2, 0x0a, 0x81, 0xd1, 0x0a,
+    0x81, 0xd2, 0x0a, 0x81, 0xd3, 0x0a, 0x81, 0xd7, 0x0a, 0x81, 0xd8, 0x0a, 0x81, 0xd9, 0x0a, 0x81,
+    0xd4, 0x0a, 0x81, 0xd5, 0x0a, 0x81, 0xd6, 0x0a, 0x81, 0xda, 0x0a, 0x81, 0xdb, 0x0a, 0x81, 0xdc,
+    0x0a, 0x81, 0xc2, 0x07, 0x81, 0xc3, 0x07, 0x81, 0xc4, 0x07, 0x81, 0xc5, 0x07, 0x81, 0xc6, 0x07,
+    0x81, 0xc7, 0x07, 0x81, 0x74, 0x00, 0x81, 0x75, 0x00, 0x81, 0x76, 0x00, 0x81, 0xd4, 0x07, 0x81,
+    0xd5, 0x07, 0x81, 0xd6, 0x07, 0x81, 0x77, 0x00, 0x81, 0x78, 0x00, 0x81, 0x79, 0x00, 0x81, 0xd7,
+    0x07, 0x81, 0xd8, 0x07, 0x81, 0xd9, 0xd5, 0x15, 0x41, 0x7a, 0x00, 0x81, 0x7b, 0xce, 0x04, 0x10,
+    0x7d, 0xe1, 0x1b, 0x03, 0xda, 0x04, 0x14, 0x7c, 0x09, 0x00, 0xf1, 0xff, 0xff, 0x58, 0x7f, 0x00,
+    0x81, 0x0c, 0x09, 0x81, 0x0d, 0x09, 0x81, 0x0e, 0x09, 0x81, 0x1e, 0x09, 0x81, 0x1f, 0x09, 0x81,
+    0x20, 0x09, 0x81, 0x0f, 0x09, 0x81, 0x10, 0x09, 0x81, 0x11, 0x09, 0x81, 0x21, 0x09, 0x81, 0x22,
+    0x09, 0x81, 0x23, 0x09, 0x81, 0x4c, 0x08, 0x81, 0x4d, 0x08, 0x81, 0x4e, 0x08, 0x81, 0x5e, 0x08,
+    0x81, 0x5f, 0x08, 0x81, 0x60, 0x08, 0x81, 0x4f, 0x08, 0x81, 0x50, 0x08, 0x81, 0x51, 0x08, 0x81,
+    0x61, 0x08, 0x81, 0x62, 0x08, 0x81, 0x63, 0x08, 0x81, 0xa7, 0x07, 0x81, 0xa8, 0x07, 0x81, 0xa9,
+    0x07, 0x81, 0xad, 0x07, 0x81, 0xae, 0x07, 0x81, 0xaf, 0x07, 0x81, 0xaa, 0x07, 0x81, 0xab, 0x07,
+    0x81, 0xac, 0x07, 0x81, 0xb0, 0x07, 0x81, 0xb1, 0x07, 0x81, 0xb2, 0x07, 0x81, 0x64, 0x00, 0x81,
+    0x65, 0x00, 0x81, 0x66, 0x00, 0x81, 0x5e, 0x00, 0x81, 0x5f, 0x00, 0x81, 0x60, 0x00, 0x81, 0x67,
+    0x00, 0x81, 0x68, 0x00, 0x81, 0x69, 0x00, 0x81, 0x61, 0x00, 0x81, 0x62, 0x00, 0x81, 0x63, 0x00,
+    0x81, 0xa1, 0x07, 0x81, 0xa2, 0x07, 0x81, 0xa3, 0x07, 0x81, 0xb3, 0x07, 0x81, 0xb4, 0x07, 0x81,
+    0xb5, 0x07, 0x81, 0xa4, 0x07, 0x81, 0xa5, 0x07, 0x81, 0xa6, 0x07, 0x81, 0xb6, 0x07, 0x81, 0xb7,
+    0x07, 0x81, 0xb8, 0x07, 0x81, 0x49, 0x0b, 0x81, 0x4a, 0x0b, 0x81, 0x4b, 0x0b, 0x81, 0x4c, 0x0b,
+    0x81, 0x4d, 0x0b, 0x81, 0x4e, 0x0b, 0x81, 0x3d, 0x0b, 0x81, 0x3e, 0x0b, 0x81, 0x3f, 0x0b, 0x81,
+    0x43, 0x0b, 0x81, 0x44, 0x0b, 0x81, 0x45, 0x0b, 0x81, 0x40, 0x0b, 0x81, 0x41, 0x0b, 0x81, 0x42,
+    0x0b, 0x81, 0x46, 0x0b, 0x81, 0x47, 0x0b, 0x81, 0x48, 0x0b, 0x81, 0x6d, 0x0b, 0x81, 0x6e, 0x0b,
+    0x81, 0x6f, 0x0b, 0x81, 0x70, 0x0b, 0x81, 0x71, 0x0b, 0x81, 0x72, 0x0b, 0x81, 0x61, 0x0b, 0x81,
+    0x62, 0x0b, 0x81, 0x63, 0x0b, 0x81, 0x67, 0x0b, 0x81, 0x68, 0x0b, 0x81, 0x69, 0x0b, 0x81, 0x64,
+    0x0b, 0x81, 0x65, 0x0b, 0x81, 0x66, 0x0b, 0x81, 0x6a, 0x0b, 0x81, 0x6b, 0x0b, 0x81, 0x6c, 0x0b,
+    0x81, 0x92, 0x08, 0x81, 0x93, 0x08, 0x81, 0x94, 0x08, 0x81, 0xb0, 0x08, 0x81, 0xb1, 0x08, 0x81,
+    0xb2, 0x08, 0x81, 0x95, 0x08, 0x81, 0x96, 0x08, 0x81, 0x97, 0x08, 0x81, 0xb3, 0x08, 0x81, 0xb4,
+    0x08, 0x81, 0xb5, 0x08, 0x81, 0x98, 0x08, 0x81, 0x99, 0x08, 0x81, 0x9a, 0x08, 0x81, 0xaa, 0x08,
+    0x81, 0xab, 0x08, 0x81, 0xac, 0x08, 0x81, 0x9b, 0x08, 0x81, 0x9c, 0x08, 0x81, 0x9d, 0x08, 0x81,
+    0xad, 0x08, 0x81, 0xae, 0x08, 0x81, 0xaf, 0x08, 0x81, 0xa4, 0x08, 0x81, 0xa5, 0x08, 0x81, 0xa6,
+    0x08, 0x81, 0x9e, 0x08, 0x81, 0x9f, 0x08, 0x81, 0xa0, 0x08, 0x81, 0xa7, 0x08, 0x81, 0xa8, 0x08,
+    0x81, 0xa9, 0x08, 0x81, 0xa1, 0x08, 0x81, 0xa2, 0x08, 0x81, 0xa3, 0x08, 0x81, 0xb9, 0x07, 0x81,
+    0xba, 0x07, 0x81, 0xbb, 0x07, 0x81, 0xbc, 0x07, 0x81, 0xbd, 0x07, 0x81, 0xbe, 0x07, 0x81, 0xdd,
+    0x07, 0x81, 0xde, 0x07, 0x81, 0xdf, 0x07, 0x81, 0xe0, 0x07, 0x81, 0xe1, 0x07, 0x81, 0xe2, 0x07,
+    0x81, 0xbf, 0x07, 0x81, 0xc0, 0x07, 0x81, 0xc1, 0x07, 0x81, 0xe3, 0x07, 0x81, 0xe4, 0x07, 0x81,
+    0xe5, 0x07, 0x81, 0xc8, 0x07, 0x81, 0xc9, 0x07, 0x81, 0xca, 0x07, 0x81, 0xda, 0x07, 0x81, 0xdb,
+    0x07, 0x81, 0xdc, 0x07, 0x81, 0xcb, 0x07, 0x81, 0xcc, 0x07, 0x81, 0xcd, 0x07, 0x81, 0xe2, 0x08,
+    0x81, 0xe3, 0x08, 0x81, 0xe4, 0x08, 0x81, 0x00, 0x09, 0x81, 0x01, 0x09, 0x81, 0x02, 0x09, 0x81,
+    0xe5, 0x08, 0x81, 0xe6, 0x08, 0x81, 0xe7, 0x08, 0x81, 0x03, 0x09, 0x81, 0x04, 0x09, 0x81, 0x05,
+    0x09, 0x81, 0xe8, 0x08, 0x81, 0xe9, 0x08, 0x81, 0xea, 0x08, 0x81, 0xfa, 0x08, 0x81, 0xfb, 0x08,
+    0x81, 0xfc, 0x08, 0x81, 0xeb, 0x08, 0x81, 0xec, 0x08, 0x81, 0xed, 0x08, 0x81, 0xfd, 0x08, 0x81,
+    0xfe, 0x08, 0x81, 0xff, 0x08, 0x81, 0xf4, 0x08, 0x81, 0xf5, 0x08, 0x81, 0xf6, 0x08, 0x81, 0xee,
+    0x08, 0x81, 0xef, 0x08, 0x81, 0xf0, 0x08, 0x81, 0xf7, 0x08, 0x81, 0xf8, 0x08, 0x81, 0xf9, 0x08,
+    0x81, 0xf1, 0x08, 0x81, 0xf2, 0x08, 0x81, 0xf3, 0x08, 0x81, 0xbf, 0x0a, 0x81, 0xc0, 0x0a, 0x81,
+    0xc1, 0x0a, 0x81, 0xc2, 0x0a, 0x81, 0xc3, 0x0a, 0x81, 0xc4, 0x0a, 0x81, 0x0d, 0x03, 0x81, 0x0e,
+    0x03, 0x81, 0x0f, 0xd8, 0x1e, 0xf0, 0x43, 0x08, 0x03, 0x81, 0x09, 0x03, 0x81, 0x10, 0x03, 0x81,
+    0x11, 0x03, 0x81, 0x12, 0x03, 0x81, 0x0a, 0x03, 0x81, 0x0b, 0x03, 0x81, 0x0c, 0x03, 0x81, 0x12,
+    0x09, 0x81, 0x13, 0x09, 0x81, 0x14, 0x09, 0x81, 0x18, 0x09, 0x81, 0x19, 0x09, 0x81, 0x1a, 0x09,
+    0x81, 0x15, 0x09, 0x81, 0x16, 0x09, 0x81, 0x17, 0x09, 0x81, 0x1b, 0x09, 0x81, 0x1c, 0x09, 0x81,
+    0x1d, 0x09, 0x81, 0xb7, 0x00, 0x81, 0xb8, 0x00, 0x81, 0xb9, 0x00, 0x81, 0xb1, 0x00, 0x81, 0xb2,
+    0x00, 0x81, 0xb3, 0x00, 0x81, 0xba, 0x00, 0x81, 0xbb, 0xae, 0x29, 0x03, 0x8b, 0x1f, 0xf7, 0x9d,
+    0xb6, 0x00, 0x81, 0x52, 0x08, 0x81, 0x53, 0x08, 0x81, 0x54, 0x08, 0x81, 0x58, 0x08, 0x81, 0x59,
+    0x08, 0x81, 0x5a, 0x08, 0x81, 0x55, 0x08, 0x81, 0x56, 0x08, 0x81, 0x57, 0x08, 0x81, 0x5b, 0x08,
+    0x81, 0x5c, 0x08, 0x81, 0x5d, 0x08, 0x81, 0x88, 0x08, 0x81, 0x89, 0x08, 0x81, 0x8a, 0x08, 0x81,
+    0x06, 0x09, 0x81, 0x07, 0x09, 0x81, 0x08, 0x09, 0x81, 0x8b, 0x08, 0x81, 0x8c, 0x08, 0x81, 0x8d,
+    0x08, 0x81, 0x09, 0x09, 0x81, 0x0a, 0x09, 0x81, 0x0b, 0x09, 0x81, 0x7f, 0x0b, 0x81, 0x80, 0x0b,
+    0x81, 0x81, 0x0b, 0x81, 0x82, 0x0b, 0x81, 0x83, 0x0b, 0x81, 0x84, 0x0b, 0x81, 0x2f, 0x09, 0x81,
+    0x30, 0x09, 0x81, 0x31, 0x09, 0x81, 0x32, 0x09, 0x81, 0x33, 0x09, 0x81, 0x34, 0x09, 0x81, 0x35,
+    0x09, 0x81, 0x36, 0x09, 0x81, 0x37, 0x09, 0x81, 0x38, 0x09, 0x81, 0x39, 0x09, 0x81, 0x3a, 0x09,
+    0x81, 0x6a, 0x05, 0x81, 0x6b, 0x05, 0x81, 0x6c, 0x05, 0x81, 0x67, 0x05, 0x81, 0x68, 0x05, 0x81,
+    0x69, 0x05, 0x81, 0x78, 0x05, 0x81, 0x79, 0x05, 0x81, 0x7a, 0x05, 0x81, 0x75, 0x05, 0x81, 0x76,
+    0x05, 0x81, 0x77, 0x05, 0x81, 0xc8, 0x03, 0x81, 0xc9, 0x03, 0x81, 0xca, 0x8f, 0x2a, 0x77, 0xcb,
+    0x03, 0x81, 0xcc, 0x03, 0x81, 0xcd, 0x98, 0x2a, 0xf0, 0x64, 0x61, 0x04, 0x81, 0x62, 0x04, 0x81,
+    0x63, 0x04, 0x81, 0x53, 0x04, 0x81, 0x54, 0x04, 0x81, 0x55, 0x04, 0x81, 0x64, 0x04, 0x81, 0x65,
+    0x04, 0x81, 0x66, 0x04, 0x81, 0x56, 0x04, 0x81, 0x57, 0x04, 0x81, 0x58, 0x04, 0x81, 0x64, 0x03,
+    0x81, 0x65, 0x03, 0x81, 0x66, 0x03, 0x81, 0x56, 0x03, 0x81, 0x57, 0x03, 0x81, 0x58, 0x03, 0x81,
+    0x67, 0x03, 0x81, 0x68, 0x03, 0x81, 0x69, 0x03, 0x81, 0x59, 0x03, 0x81, 0x5a, 0x03, 0x81, 0x5b,
+    0x03, 0x81, 0x07, 0x04, 0x81, 0x08, 0x04, 0x81, 0x09, 0x04, 0x81, 0xf9, 0x03, 0x81, 0xfa, 0x03,
+    0x81, 0xfb, 0x03, 0x81, 0x0a, 0x04, 0x81, 0x0b, 0x04, 0x81, 0x0c, 0x04, 0x81, 0xfc, 0x03, 0x81,
+    0xfd, 0x03, 0x81, 0xfe, 0x03, 0x81, 0xaa, 0x04, 0x81, 0xab, 0x04, 0x81, 0xac, 0xe3, 0x16, 0x00,
+    0xd7, 0x16, 0xa0, 0x9e, 0x04, 0x81, 0xad, 0x04, 0x81, 0xae, 0x04, 0x81, 0xaf, 0xda, 0x16, 0xf1,
+    0xff, 0x6e, 0x81, 0xa0, 0x04, 0x81, 0xa1, 0x04, 0x81, 0x04, 0x05, 0x81, 0x05, 0x05, 0x81, 0x06,
+    0x05, 0x81, 0xf6, 0x04, 0x81, 0xf7, 0x04, 0x81, 0xf8, 0x04, 0x81, 0x07, 0x05, 0x81, 0x08, 0x05,
+    0x81, 0x09, 0x05, 0x81, 0xf9, 0x04, 0x81, 0xfa, 0x04, 0x81, 0xfb, 0x04, 0x81, 0x25, 0x0b, 0x81,
+    0x26, 0x0b, 0x81, 0x27, 0x0b, 0x81, 0x28, 0x0b, 0x81, 0x29, 0x0b, 0x81, 0x2a, 0x0b, 0x81, 0x2b,
+    0x0b, 0x81, 0x2c, 0x0b, 0x81, 0x2d, 0x0b, 0x81, 0x2e, 0x0b, 0x81, 0x2f, 0x0b, 0x81, 0x30, 0x0b,
+    0x81, 0xa6, 0x0d, 0x81, 0xa7, 0x0d, 0x81, 0xa8, 0x0d, 0x81, 0xa3, 0x0d, 0x81, 0xa4, 0x0d, 0x81,
+    0xa5, 0x0d, 0x81, 0xb4, 0x0d, 0x81, 0xb5, 0x0d, 0x81, 0xb6, 0x0d, 0x81, 0xb1, 0x0d, 0x81, 0xb2,
+    0x0d, 0x81, 0xb3, 0x0d, 0x81, 0xdd, 0x03, 0x81, 0xde, 0x03, 0x81, 0xdf, 0x03, 0x81, 0xcf, 0x03,
+    0x81, 0xd0, 0x03, 0x81, 0xd1, 0x03, 0x81, 0xe0, 0x03, 0x81, 0xe1, 0x03, 0x81, 0xe2, 0x03, 0x81,
+    0xd2, 0x03, 0x81, 0xd3, 0x03, 0x81, 0xd4, 0x03, 0x81, 0x76, 0x04, 0x81, 0x77, 0x04, 0x81, 0x78,
+    0x04, 0x81, 0x68, 0x04, 0x81, 0x69, 0x04, 0x81, 0x6a, 0x04, 0x81, 0x79, 0x04, 0x81, 0x7a, 0x04,
+    0x81, 0x7b, 0x04, 0x81, 0x6b, 0x04, 0x81, 0x6c, 0x04, 0x81, 0x6d, 0x04, 0x81, 0x82, 0x03, 0x81,
+    0x83, 0x03, 0x81, 0x84, 0x03, 0x81, 0x74, 0x03, 0x81, 0x75, 0x03, 0x81, 0x76, 0x03, 0x81, 0x85,
+    0x03, 0x81, 0x86, 0x03, 0x81, 0x87, 0x03, 0x81, 0x77, 0x03, 0x81, 0x78, 0x03, 0x81, 0x79, 0x03,
+    0x81, 0x25, 0x04, 0x81, 0x26, 0x04, 0x81, 0x27, 0x04, 0x81, 0x17, 0x04, 0x81, 0x18, 0x04, 0x81,
+    0x19, 0x04, 0x81, 0x28, 0x04, 0x81, 0x29, 0x04, 0x81, 0x2a, 0x04, 0x81, 0x1a, 0x04, 0x81, 0x1b,
+    0x04, 0x81, 0x1c, 0x04, 0x81, 0xc8, 0x04, 0x81, 0xc9, 0x04, 0x81, 0xca, 0x04, 0x81, 0xba, 0x04,
+    0x81, 0xbb, 0x04, 0x81, 0xbc, 0x04, 0x81, 0xcb, 0x04, 0x81, 0xcc, 0x04, 0x81, 0xcd, 0x04, 0x81,
+    0xbd, 0x04, 0x81, 0xbe, 0x04, 0x81, 0xbf, 0x04, 0x81, 0x22, 0x05, 0x81, 0x23, 0x05, 0x81, 0x24,
+    0x05, 0x81, 0x14, 0x05, 0x81, 0x15, 0x05, 0x81, 0x16, 0x05, 0x81, 0x25, 0x05, 0x81, 0x26, 0x05,
+    0x81, 0x27, 0x05, 0x81, 0x17, 0x05, 0x81, 0x18, 0x05, 0x81, 0x19, 0x05, 0x81, 0x57, 0x09, 0x81,
+    0x58, 0x09, 0x81, 0x59, 0x09, 0x81, 0x5a, 0x09, 0x81, 0x5b, 0x09, 0x81, 0x5c, 0x09, 0x81, 0x51,
+    0x09, 0x81, 0x52, 0x09, 0x81, 0x53, 0x09, 0x81, 0x54, 0x09, 0x81, 0x55, 0x09, 0x81, 0x56, 0x09,
+    0x81, 0xf2, 0x03, 0x81, 0xf3, 0x03, 0x81, 0xf4, 0x03, 0x81, 0xe4, 0x03, 0x81, 0xe5, 0x45, 0x2c,
+    0xa1, 0xf5, 0x03, 0x81, 0xf6, 0x03, 0x81, 0xf7, 0x03, 0x81, 0xe7, 0x39, 0x2c, 0xf1, 0x1c, 0xe9,
+    0x03, 0x81, 0x8b, 0x04, 0x81, 0x8c, 0x04, 0x81, 0x8d, 0x04, 0x81, 0x7d, 0x04, 0x81, 0x7e, 0x04,
+    0x81, 0x7f, 0x04, 0x81, 0x8e, 0x04, 0x81, 0x8f, 0x04, 0x81, 0x90, 0x04, 0x81, 0x80, 0x04, 0x81,
+    0x81, 0x04, 0x81, 0x82, 0x04, 0x81, 0xa0, 0x03, 0x81, 0xa1, 0x42, 0x23, 0x20, 0x92, 0x03, 0x7e,
+    0x1e, 0x11, 0x94, 0x36, 0x23, 0x11, 0xa4, 0x0c, 0x23, 0xf3, 0x4d, 0x95, 0x03, 0x81, 0x96, 0x03,
+    0x81, 0x97, 0x03, 0x81, 0x43, 0x04, 0x81, 0x44, 0x04, 0x81, 0x45, 0x04, 0x81, 0x35, 0x04, 0x81,
+    0x36, 0x04, 0x81, 0x37, 0x04, 0x81, 0x46, 0x04, 0x81, 0x47, 0x04, 0x81, 0x48, 0x04, 0x81, 0x38,
+    0x04, 0x81, 0x39, 0x04, 0x81, 0x3a, 0x04, 0x81, 0xe6, 0x04, 0x81, 0xe7, 0x04, 0x81, 0xe8, 0x04,
+    0x81, 0xd8, 0x04, 0x81, 0xd9, 0x04, 0x81, 0xda, 0x04, 0x81, 0xe9, 0x04, 0x81, 0xea, 0x04, 0x81,
+    0xeb, 0x04, 0x81, 0xdb, 0x04, 0x81, 0xdc, 0x04, 0x81, 0xdd, 0x04, 0x81, 0x40, 0x05, 0x81, 0x41,
+    0x05, 0x81, 0x42, 0x05, 0x81, 0x32, 0x05, 0x50, 0x2d, 0x74, 0x43, 0x05, 0x81, 0x44, 0x05, 0x81,
+    0x45, 0x59, 0x2d, 0xf3, 0x16, 0x37, 0x05, 0x81, 0x64, 0x08, 0x81, 0x65, 0x08, 0x81, 0x66, 0x08,
+    0x81, 0x6a, 0x08, 0x81, 0x6b, 0x08, 0x81, 0x6c, 0x08, 0x81, 0x67, 0x08, 0x81, 0x68, 0x08, 0x81,
+    0x69, 0x08, 0x81, 0x6d, 0x08, 0x81, 0x6e, 0x08, 0x81, 0x6f, 0x1e, 0x1b, 0x23, 0x81, 0x6e, 0x48,
+    0x23, 0x24, 0x81, 0x6d, 0x09, 0x00, 0x14, 0x72, 0x09, 0x00, 0x14, 0x71, 0x09, 0x00, 0x13, 0xaa,
+    0xb4, 0xea, 0x24, 0x81, 0xa9, 0x09, 0x00, 0x14, 0xae, 0x09, 0x00, 0x00, 0xba, 0x4a, 0x02, 0xbe,
+    0x0b, 0x04, 0x2d, 0x00, 0x01, 0x2f, 0x2d, 0x00, 0x09, 0x00, 0x14, 0x74, 0x09, 0x00, 0x14, 0x73,
+    0x09, 0x00, 0x14, 0xac, 0x2d, 0x00, 0x14, 0xab, 0x09, 0x00, 0x00, 0xea, 0x4a, 0x01, 0x09, 0x00,
+    0x14, 0xaf, 0x09, 0x00, 0x01, 0x46, 0x3a, 0x00, 0x09, 0x00, 0x04, 0xd3, 0xec, 0x11, 0x81, 0x52,
+    0x3a, 0x00, 0x09, 0x00, 0x01, 0x6d, 0x3a, 0x00, 0x09, 0x00, 0x14, 0x15, 0x2d, 0x00, 0x14, 0x12,
+    0x09, 0x00, 0x14, 0x16, 0x09, 0x00, 0x14, 0x13, 0x09, 0x00, 0x14, 0x75, 0x09, 0x00, 0x14, 0x72,
+    0x09, 0x00, 0x14, 0x76, 0x09, 0x00, 0xf1, 0x4b, 0x73, 0x0d, 0x81, 0xc3, 0x05, 0x81, 0xc4, 0x05,
+    0x81, 0xc5, 0x05, 0x81, 0xc6, 0x05, 0x81, 0xc7, 0x05, 0x81, 0xc8, 0x05, 0x81, 0x2e, 0x00, 0x81,
+    0x2f, 0x00, 0x81, 0x30, 0x00, 0x81, 0x31, 0x00, 0x81, 0x32, 0x00, 0x81, 0x33, 0x00, 0x81, 0x34,
+    0x00, 0x81, 0x35, 0x00, 0x81, 0x36, 0x00, 0x81, 0x37, 0x00, 0x81, 0x38, 0x00, 0x81, 0x39, 0x00,
+    0x81, 0x22, 0x00, 0x81, 0x23, 0x00, 0x81, 0x24, 0x00, 0x81, 0x25, 0x00, 0x81, 0x26, 0x00, 0x81,
+    0x27, 0x00, 0x81, 0x28, 0x00, 0x81, 0x29, 0x00, 0x81, 0x2a, 0x00, 0x81, 0x2b, 0x00, 0x81, 0x2c,
+    0x00, 0x81, 0xe0, 0x1f, 0x50, 0x8b, 0xde, 0x08, 0x8b, 0xdf, 0x5f, 0x01, 0x51, 0x8b, 0xe0, 0x08,
+    0x8b, 0xe1, 0x09, 0x00, 0x41, 0xd2, 0x08, 0x8b, 0xd3, 0x09, 0x00, 0xf4, 0x76, 0xd4, 0x08, 0x8b,
+    0xd5, 0x08, 0x8b, 0x3a, 0x00, 0x8b, 0x3b, 0x00, 0x8b, 0x3c, 0x00, 0x8b, 0x40, 0x00, 0x8b, 0x41,
+    0x00, 0x8b, 0x42, 0x00, 0x8b, 0x3d, 0x00, 0x8b, 0x3e, 0x00, 0x8b, 0x3f, 0x00, 0x8b, 0x43, 0x00,
+    0x8b, 0x44, 0x00, 0x8b, 0x45, 0x00, 0x8b, 0xc8, 0x08, 0x8b, 0xc9, 0x08, 0x8b, 0xca, 0x08, 0x8b,
+    0xcb, 0x08, 0x8b, 0xcc, 0x08, 0x8b, 0xcd, 0x08, 0x8b, 0xbc, 0x08, 0x8b, 0xbd, 0x08, 0x8b, 0xbe,
+    0x08, 0x8b, 0xbf, 0x08, 0x8b, 0xc0, 0x08, 0x8b, 0xc1, 0x08, 0x8b, 0x52, 0x0d, 0x8b, 0x53, 0x0d,
+    0x8b, 0x54, 0x0d, 0x8b, 0x55, 0x0d, 0x8b, 0x56, 0x0d, 0x8b, 0x57, 0x0d, 0x8b, 0x44, 0x0d, 0x8b,
+    0x45, 0x0d, 0x8b, 0x46, 0x0d, 0x8b, 0x47, 0x0d, 0x8b, 0x48, 0x0d, 0x8b, 0x49, 0x0d, 0x8b, 0x77,
+    0x07, 0x8b, 0x78, 0x07, 0x8b, 0x79, 0x07, 0x8b, 0x7a, 0x07, 0x8b, 0x7b, 0x07, 0x8b, 0x7c, 0x07,
+    0x8b, 0x24, 0x36, 0x12, 0x14, 0x25, 0x09, 0x00, 0x14, 0x2d, 0x09, 0x00, 0x14, 0x2e, 0x09, 0x00,
+    0x14, 0x26, 0x09, 0x00, 0x14, 0x2a, 0x09, 0x00, 0x14, 0x28, 0x09, 0x00, 0x14, 0x27, 0x09, 0x00,
+    0x14, 0x2b, 0x09, 0x00, 0x15, 0x29, 0x12, 0x00, 0x03, 0xa1, 0x01, 0x11, 0x8b, 0x39, 0x3b, 0x03,
+    0x0c, 0x00, 0x31, 0xc9, 0x05, 0x8b, 0x8b, 0x23, 0x41, 0x8b, 0xcf, 0x05, 0x8b, 0xb5, 0x25, 0x51,
+    0x8b, 0xcb, 0x05, 0x8b, 0xcc, 0x09, 0x00, 0x41, 0xd1, 0x05, 0x8b, 0xd2, 0x09, 0x00, 0x31, 0x13,
+    0x03, 0x8b, 0xe4, 0x3b, 0x41, 0x8b, 0x19, 0x03, 0x8b, 0xc9, 0x3b, 0x41, 0x8b, 0x15, 0x03, 0x8b,
+    0xea, 0x3b, 0x44, 0x8b, 0x1b, 0x03, 0x8b, 0x2d, 0x29, 0x24, 0x8b, 0xcd, 0x15, 0x2f, 0x14, 0xd3,
+    0x09, 0x00, 0x14, 0xce, 0x09, 0x00, 0x14, 0xd4, 0x09, 0x00, 0x01, 0x1a, 0x3c, 0x00, 0x09, 0x00,
+    0x04, 0x4b, 0x29, 0x24, 0x8b, 0x18, 0x09, 0x00, 0xf4, 0x4f, 0x1e, 0x03, 0x8b, 0x56, 0x01, 0x8b,
+    0x57, 0x01, 0x8b, 0x58, 0x01, 0x8b, 0x59, 0x01, 0x8b, 0x5a, 0x01, 0x8b, 0x5b, 0x01, 0x8b, 0x34,
+    0x08, 0x8b, 0x35, 0x08, 0x8b, 0x36, 0x08, 0x8b, 0x3a, 0x08, 0x8b, 0x3b, 0x08, 0x8b, 0x3c, 0x08,
+    0x8b, 0x37, 0x08, 0x8b, 0x38, 0x08, 0x8b, 0x39, 0x08, 0x8b, 0x3d, 0x08, 0x8b, 0x3e, 0x08, 0x8b,
+    0x3f, 0x08, 0x8b, 0xf2, 0x07, 0x8b, 0xf3, 0x07, 0x8b, 0xf4, 0x07, 0x8b, 0x28, 0x08, 0x8b, 0x29,
+    0x08, 0x8b, 0x2a, 0x08, 0x8b, 0xf5, 0x07, 0x8b, 0xf6, 0x07, 0x8b, 0xf7, 0x07, 0x8b, 0x2b, 0x08,
+    0x8b, 0x2c, 0x08, 0x8b, 0x2d, 0x08, 0x8b, 0x3b, 0x05, 0x01, 0x14, 0x3c, 0x09, 0x00, 0x14, 0xe1,
+    0x93, 0x00, 0x14, 0xe2, 0x09, 0x00, 0x14, 0x3d, 0x1b, 0x00, 0x14, 0x41, 0x09, 0x00, 0x14, 0x3f,
+    0x09, 0x00, 0x14, 0x3e, 0x09, 0x00, 0x14, 0x42, 0x09, 0x00, 0x16, 0x40, 0xc1, 0xf1, 0x51, 0x8b,
+    0xb7, 0x0d, 0x8b, 0xb8, 0x3c, 0x3b, 0x30, 0xbb, 0x0d, 0x8b, 0xc2, 0xb7, 0x61, 0x00, 0x8b, 0xb9,
+    0x0d, 0x8b, 0xba, 0x09, 0x00, 0xf1, 0x3d, 0xbd, 0x0d, 0x8b, 0xbe, 0x0d, 0x8b, 0x75, 0x0c, 0x8b,
+    0x76, 0x0c, 0x8b, 0x77, 0x0c, 0x8b, 0x7b, 0x0c, 0x8b, 0x7c, 0x0c, 0x8b, 0x7d, 0x0c, 0x8b, 0x78,
+    0x0c, 0x8b, 0x79, 0x0c, 0x8b, 0x7a, 0x0c, 0x8b, 0x7e, 0x0c, 0x8b, 0x7f, 0x0c, 0x8b, 0x80, 0x0c,
+    0x8b, 0xa8, 0x05, 0x8b, 0xa9, 0x05, 0x8b, 0xaa, 0x05, 0x8b, 0x9a, 0x05, 0x8b, 0x9b, 0x05, 0x8b,
+    0x9c, 0x05, 0x8b, 0xab, 0x05, 0x8b, 0xac, 0x05, 0x8b, 0xad, 0x05, 0x8b, 0x9d, 0x05, 0x8b, 0x9e,
+    0x05, 0x8b, 0x9f, 0x8c, 0x01, 0x41, 0xd5, 0x05, 0x8b, 0xd6, 0x09, 0x00, 0x41, 0xdb, 0x05, 0x8b,
+    0xdc, 0x09, 0x00, 0x41, 0xd7, 0x05, 0x8b, 0xd8, 0x09, 0x00, 0x41, 0xdd, 0x05, 0x8b, 0xde, 0x09,
+    0x00, 0x31, 0x1f, 0x03, 0x8b, 0x74, 0x54, 0x41, 0x8b, 0x25, 0x03, 0x8b, 0x49, 0x3d, 0x41, 0x8b,
+    0x21, 0x03, 0x8b, 0x6a, 0x3d, 0x41, 0x8b, 0x27, 0x03, 0x8b, 0x4f, 0x3d, 0x00, 0x0c, 0x00, 0x14,
+    0xd9, 0xf9, 0x00, 0x14, 0xdf, 0x09, 0x00, 0x14, 0xda, 0x09, 0x00, 0x14, 0xe0, 0x09, 0x00, 0x01,
+    0x9a, 0x3d, 0x01, 0x46, 0x02, 0x04, 0x09, 0x00, 0x01, 0xa6, 0x3d, 0x01, 0x7c, 0x02, 0xf0, 0x4b,
+    0x03, 0x8b, 0x2e, 0x08, 0x8b, 0x2f, 0x08, 0x8b, 0x30, 0x08, 0x8b, 0x40, 0x08, 0x8b, 0x41, 0x08,
+    0x8b, 0x42, 0x08, 0x8b, 0x31, 0x08, 0x8b, 0x32, 0x08, 0x8b, 0x33, 0x08, 0x8b, 0x43, 0x08, 0x8b,
+    0x44, 0x08, 0x8b, 0x45, 0x08, 0x8b, 0xec, 0x07, 0x8b, 0xed, 0x07, 0x8b, 0xee, 0x07, 0x8b, 0x46,
+    0x08, 0x8b, 0x47, 0x08, 0x8b, 0x48, 0x08, 0x8b, 0xef, 0x07, 0x8b, 0xf0, 0x07, 0x8b, 0xf1, 0x07,
+    0x8b, 0x49, 0x08, 0x8b, 0x4a, 0x08, 0x8b, 0x4b, 0x08, 0x8b, 0xd7, 0x02, 0x8b, 0xd8, 0x02, 0x8b,
+    0xd9, 0x02, 0x8b, 0xda, 0x02, 0x8b, 0xdb, 0x02, 0x8b, 0xdc, 0xeb, 0x1d, 0x51, 0x8b, 0xbf, 0x0d,
+    0x8b, 0xc0, 0x44, 0x01, 0x41, 0xc3, 0x0d, 0x8b, 0xc4, 0x09, 0x00, 0x30, 0xc1, 0x0d, 0x8b, 0x03,
+    0xb9, 0xf0, 0x7c, 0x00, 0x8b, 0xc5, 0x0d, 0x8b, 0xc6, 0x0d, 0x8b, 0xe6, 0x07, 0x8b, 0xe7, 0x07,
+    0x8b, 0xe8, 0x07, 0x8b, 0xe9, 0x07, 0x8b, 0xea, 0x07, 0x8b, 0xeb, 0x07, 0x8b, 0xf5, 0x0c, 0x8b,
+    0xf6, 0x0c, 0x8b, 0xf7, 0x0c, 0x8b, 0xee, 0x0c, 0x8b, 0xef, 0x0c, 0x8b, 0xf0, 0x0c, 0x8b, 0xf8,
+    0x0c, 0x8b, 0xf9, 0x0c, 0x8b, 0xfa, 0x0c, 0x8b, 0xf1, 0x0c, 0x8b, 0xf2, 0x0c, 0x8b, 0xf3, 0x0c,
+    0x8b, 0x49, 0x03, 0x8b, 0x4a, 0x03, 0x8b, 0x4b, 0x03, 0x8b, 0x42, 0x03, 0x8b, 0x43, 0x03, 0x8b,
+    0x44, 0x03, 0x8b, 0x4c, 0x03, 0x8b, 0x4d, 0x03, 0x8b, 0x4e, 0x03, 0x8b, 0x45, 0x03, 0x8b, 0x46,
+    0x03, 0x8b, 0x47, 0x03, 0x8b, 0x34, 0x0d, 0x8b, 0x35, 0x0d, 0x8b, 0x36, 0x0d, 0x8b, 0x26, 0x0d,
+    0x8b, 0x27, 0x0d, 0x8b, 0x28, 0x0d, 0x8b, 0x37, 0x0d, 0x8b, 0x38, 0x0d, 0x8b, 0x39, 0x0d, 0x8b,
+    0x29, 0x0d, 0x8b, 0x2a, 0x0d, 0x8b, 0x2b, 0x0d, 0x8b, 0x5b, 0x05, 0x8b, 0x5c, 0x05, 0x00, 0x32,
+    0xf0, 0x9b, 0x4f, 0x05, 0x8b, 0x50, 0x05, 0x8b, 0x51, 0x05, 0x8b, 0x5e, 0x05, 0x8b, 0x5f, 0x05,
+    0x8b, 0x60, 0x05, 0x8b, 0x52, 0x05, 0x8b, 0x53, 0x05, 0x8b, 0x54, 0x05, 0x8b, 0x4f, 0x0b, 0x8b,
+    0x50, 0x0b, 0x8b, 0x51, 0x0b, 0x8b, 0x52, 0x0b, 0x8b, 0x53, 0x0b, 0x8b, 0x54, 0x0b, 0x8b, 0x31,
+    0x0b, 0x8b, 0x32, 0x0b, 0x8b, 0x33, 0x0b, 0x8b, 0x37, 0x0b, 0x8b, 0x38, 0x0b, 0x8b, 0x39, 0x0b,
+    0x8b, 0x34, 0x0b, 0x8b, 0x35, 0x0b, 0x8b, 0x36, 0x0b, 0x8b, 0x3a, 0x0b, 0x8b, 0x3b, 0x0b, 0x8b,
+    0x3c, 0x0b, 0x8b, 0x73, 0x0b, 0x8b, 0x74, 0x0b, 0x8b, 0x75, 0x0b, 0x8b, 0x76, 0x0b, 0x8b, 0x77,
+    0x0b, 0x8b, 0x78, 0x0b, 0x8b, 0x55, 0x0b, 0x8b, 0x56, 0x0b, 0x8b, 0x57, 0x0b, 0x8b, 0x5b, 0x0b,
+    0x8b, 0x5c, 0x0b, 0x8b, 0x5d, 0x0b, 0x8b, 0x58, 0x0b, 0x8b, 0x59, 0x0b, 0x8b, 0x5a, 0x0b, 0x8b,
+    0x5e, 0x0b, 0x8b, 0x5f, 0x0b, 0x8b, 0x60, 0x0b, 0x8b, 0xbd, 0x05, 0x8b, 0xbe, 0x05, 0x8b, 0xbf,
+    0x05, 0x8b, 0xc0, 0x05, 0x8b, 0xc1, 0x05, 0x8b, 0xc2, 0x05, 0x8b, 0xb7, 0x05, 0x8b, 0xb8, 0x05,
+    0x8b, 0xb9, 0x05, 0x8b, 0xba, 0x05, 0x8b, 0xbb, 0x05, 0x8b, 0xbc, 0x05, 0xbd, 0x29, 0x20, 0x5e,
+    0x01, 0x44, 0x2a, 0x20, 0x60, 0x01, 0x1a, 0x2a, 0xf4, 0x19, 0x62, 0x01, 0x81, 0xe6, 0x00, 0x81,
+    0xe7, 0x00, 0x81, 0xe8, 0x00, 0x81, 0xe9, 0x00, 0x81, 0xea, 0x00, 0x81, 0xeb, 0x00, 0x81, 0x09,
+    0x01, 0x81, 0x0a, 0x01, 0x81, 0x0b, 0x01, 0x81, 0x0c, 0x01, 0x81, 0x0d, 0x01, 0x81, 0x0e, 0x01,
+    0x81, 0xdb, 0x4a, 0x16, 0x00, 0xc4, 0xdd, 0x01, 0x09, 0x00, 0xf1, 0x13, 0x20, 0x02, 0x81, 0x21,
+    0x02, 0x81, 0x22, 0x02, 0x81, 0x23, 0x02, 0x81, 0x24, 0x02, 0x81, 0x25, 0x02, 0x81, 0x33, 0x01,
+    0x81, 0x34, 0x01, 0x81, 0x35, 0x01, 0x81, 0x36, 0x01, 0x81, 0x37, 0x01, 0x81, 0x38, 0x49, 0x2b,
+    0xf0, 0x10, 0x13, 0x02, 0x81, 0x14, 0x02, 0x81, 0x15, 0x02, 0x81, 0x16, 0x02, 0x81, 0x17, 0x02,
+    0x81, 0x25, 0x01, 0x81, 0x26, 0x01, 0x81, 0x27, 0x01, 0x81, 0x28, 0x01, 0x81, 0x29, 0x01, 0x81,
+    0x2a, 0x9b, 0x2a, 0x00, 0x86, 0x2a, 0xf4, 0x10, 0x30, 0x02, 0x81, 0x31, 0x02, 0x81, 0x32, 0x02,
+    0x81, 0x33, 0x02, 0x81, 0x41, 0x01, 0x81, 0x42, 0x01, 0x81, 0x43, 0x01, 0x81, 0x44, 0x01, 0x81,
+    0x45, 0x01, 0x81, 0x46, 0x01, 0x81, 0xdd, 0x75, 0x00, 0x03, 0x4d, 0x51, 0xfb, 0xb8, 0x00, 0x81,
+    0x1e, 0x01, 0x81, 0x1f, 0x01, 0x81, 0x20, 0x01, 0x81, 0x21, 0x01, 0x81, 0x22, 0x01, 0x81, 0x23,
+    0x01, 0x81, 0x8d, 0x0d, 0x81, 0x8e, 0x0d, 0x81, 0x8f, 0x0d, 0x81, 0x90, 0x0d, 0x81, 0x91, 0x0d,
+    0x81, 0x92, 0x0d, 0x81, 0x83, 0x05, 0x81, 0x84, 0x05, 0x81, 0x85, 0x05, 0x81, 0x86, 0x05, 0x81,
+    0x87, 0x05, 0x81, 0x88, 0x05, 0x81, 0x1d, 0x0d, 0x81, 0x1e, 0x0d, 0x81, 0x1f, 0x0d, 0x81, 0x20,
+    0x0d, 0x81, 0x21, 0x0d, 0x81, 0x22, 0x0d, 0x81, 0x7d, 0x0d, 0x81, 0x7e, 0x0d, 0x81, 0x7f, 0x0d,
+    0x81, 0x80, 0x0d, 0x81, 0x81, 0x0d, 0x81, 0x82, 0x0d, 0x81, 0xc1, 0x03, 0x81, 0xc2, 0x03, 0x81,
+    0xc3, 0x03, 0x81, 0xc4, 0x03, 0x81, 0xc5, 0x03, 0x81, 0xc6, 0x03, 0x81, 0x5a, 0x04, 0x81, 0x5b,
+    0x04, 0x81, 0x5c, 0x04, 0x81, 0x5d, 0x04, 0x81, 0x5e, 0x04, 0x81, 0x5f, 0x04, 0x81, 0x5d, 0x03,
+    0x81, 0x5e, 0x03, 0x81, 0x5f, 0x03, 0x81, 0x60, 0x03, 0x81, 0x61, 0x03, 0x81, 0x62, 0x03, 0x81,
+    0x00, 0x04, 0x81, 0x01, 0x04, 0x81, 0x02, 0x04, 0x81, 0x03, 0x04, 0x81, 0x04, 0x04, 0x81, 0x05,
+    0x04, 0x81, 0xa3, 0x04, 0x81, 0xa4, 0x04, 0x81, 0xa5, 0x04, 0x81, 0xa6, 0x04, 0x81, 0xa7, 0x04,
+    0x81, 0xa8, 0x04, 0x81, 0xfd, 0x04, 0x81, 0xfe, 0x04, 0x81, 0xff, 0x04, 0x81, 0x00, 0x05, 0x81,
+    0x01, 0x05, 0x81, 0x02, 0x05, 0x36, 0x35, 0xf0, 0x4e, 0x81, 0xdb, 0x03, 0x81, 0x6f, 0x04, 0x81,
+    0x70, 0x04, 0x81, 0x71, 0x04, 0x81, 0x72, 0x04, 0x81, 0x73, 0x04, 0x81, 0x74, 0x04, 0x81, 0x7b,
+    0x03, 0x81, 0x7c, 0x03, 0x81, 0x7d, 0x03, 0x81, 0x7e, 0x03, 0x81, 0x7f, 0x03, 0x81, 0x80, 0x03,
+    0x81, 0x1e, 0x04, 0x81, 0x1f, 0x04, 0x81, 0x20, 0x04, 0x81, 0x21, 0x04, 0x81, 0x22, 0x04, 0x81,
+    0x23, 0x04, 0x81, 0xc1, 0x04, 0x81, 0xc2, 0x04, 0x81, 0xc3, 0x04, 0x81, 0xc4, 0x04, 0x81, 0xc5,
+    0x04, 0x81, 0xc6, 0x04, 0x81, 0x1b, 0x05, 0x81, 0x1c, 0x05, 0x81, 0x1d, 0x05, 0x81, 0x1e, 0x05,
+    0x81, 0x1f, 0x05, 0x81, 0x20, 0x05, 0x2a, 0x2c, 0x20, 0xec, 0x03, 0x00, 0x2c, 0xf0, 0x53, 0xee,
+    0x03, 0x81, 0xef, 0x03, 0x81, 0xf0, 0x03, 0x81, 0x84, 0x04, 0x81, 0x85, 0x04, 0x81, 0x86, 0x04,
+    0x81, 0x87, 0x04, 0x81, 0x88, 0x04, 0x81, 0x89, 0x04, 0x81, 0x99, 0x03, 0x81, 0x9a, 0x03, 0x81,
+    0x9b, 0x03, 0x81, 0x9c, 0x03, 0x81, 0x9d, 0x03, 0x81, 0x9e, 0x03, 0x81, 0x3c, 0x04, 0x81, 0x3d,
+    0x04, 0x81, 0x3e, 0x04, 0x81, 0x3f, 0x04, 0x81, 0x40, 0x04, 0x81, 0x41, 0x04, 0x81, 0xdf, 0x04,
+    0x81, 0xe0, 0x04, 0x81, 0xe1, 0x04, 0x81, 0xe2, 0x04, 0x81, 0xe3, 0x04, 0x81, 0xe4, 0x04, 0x81,
+    0x39, 0x05, 0x81, 0x3a, 0x05, 0x81, 0x3b, 0x05, 0x81, 0x3c, 0x05, 0x81, 0x3d, 0x05, 0x81, 0x3e,
+    0x05, 0xcd, 0x2e, 0x11, 0xba, 0xa3, 0x2e, 0x11, 0xbc, 0x79, 0x2e, 0xf1, 0x01, 0xbe, 0x06, 0x81,
+    0xb3, 0x06, 0x81, 0xb4, 0x06, 0x81, 0xb5, 0x06, 0x81, 0xb6, 0x06, 0x81, 0xb7, 0x06, 0x2f, 0x20,
+    0x35, 0x02, 0x9c, 0x2c, 0xf0, 0x32, 0x37, 0x02, 0x81, 0x38, 0x02, 0x81, 0x39, 0x02, 0x81, 0x3a,
+    0x02, 0x81, 0x69, 0x06, 0x81, 0x6a, 0x06, 0x81, 0x6b, 0x06, 0x81, 0x75, 0x06, 0x81, 0x76, 0x06,
+    0x81, 0x77, 0x06, 0x81, 0x6c, 0x06, 0x81, 0x6d, 0x06, 0x81, 0x6e, 0x06, 0x81, 0x78, 0x06, 0x81,
+    0x79, 0x06, 0x81, 0x7a, 0x06, 0x8b, 0x8b, 0x0b, 0x8b, 0x8c, 0x0b, 0x8b, 0x8d, 0x0b, 0x8b, 0x8e,
+    0x0b, 0x8b, 0x8f, 0x0b, 0x8b, 0x90, 0x0b, 0x69, 0x2c, 0xf4, 0x13, 0x88, 0x02, 0x81, 0x89, 0x02,
+    0x81, 0x9c, 0x02, 0x81, 0x9d, 0x02, 0x81, 0x9e, 0x02, 0x81, 0x8a, 0x02, 0x81, 0x8b, 0x02, 0x81,
+    0x8c, 0x02, 0x81, 0x9f, 0x02, 0x81, 0xa0, 0x02, 0x81, 0xa1, 0x02, 0x81, 0xa7, 0x37, 0x02, 0x00,
+    0x18, 0xe1, 0x01, 0x09, 0x00, 0xf0, 0x2b, 0x6f, 0x06, 0x81, 0x70, 0x06, 0x81, 0x71, 0x06, 0x81,
+    0x7b, 0x06, 0x81, 0x7c, 0x06, 0x81, 0x7d, 0x06, 0x81, 0x72, 0x06, 0x81, 0x73, 0x06, 0x81, 0x74,
+    0x06, 0x81, 0x7e, 0x06, 0x81, 0x7f, 0x06, 0x81, 0x80, 0x06, 0x81, 0xbe, 0x00, 0x81, 0xbf, 0x00,
+    0x81, 0xc0, 0x00, 0x81, 0x79, 0x01, 0x81, 0x7a, 0x01, 0x81, 0x7b, 0x01, 0x81, 0xc1, 0x00, 0x81,
+    0xc2, 0x58, 0x2c, 0xf0, 0xff, 0xe1, 0x81, 0x7c, 0x01, 0x81, 0x7d, 0x01, 0x81, 0x7e, 0x01, 0x81,
+    0x62, 0x0a, 0x81, 0x63, 0x0a, 0x81, 0x64, 0x0a, 0x81, 0x65, 0x0a, 0x81, 0x66, 0x0a, 0x81, 0x67,
+    0x0a, 0x81, 0x44, 0x0a, 0x81, 0x45, 0x0a, 0x81, 0x46, 0x0a, 0x81, 0x47, 0x0a, 0x81, 0x48, 0x0a,
+    0x81, 0x49, 0x0a, 0x81, 0x50, 0x0a, 0x81, 0x51, 0x0a, 0x81, 0x52, 0x0a, 0x81, 0x53, 0x0a, 0x81,
+    0x54, 0x0a, 0x81, 0x55, 0x0a, 0x81, 0x4a, 0x0a, 0x81, 0x4b, 0x0a, 0x81, 0x4c, 0x0a, 0x81, 0x4d,
+    0x0a, 0x81, 0x4e, 0x0a, 0x81, 0x4f, 0x0a, 0x81, 0x5c, 0x0a, 0x81, 0x5d, 0x0a, 0x81, 0x5e, 0x0a,
+    0x81, 0x5f, 0x0a, 0x81, 0x60, 0x0a, 0x81, 0x61, 0x0a, 0x81, 0x56, 0x0a, 0x81, 0x57, 0x0a, 0x81,
+    0x58, 0x0a, 0x81, 0x59, 0x0a, 0x81, 0x5a, 0x0a, 0x81, 0x5b, 0x0a, 0x81, 0x1a, 0x0a, 0x81, 0x1b,
+    0x0a, 0x81, 0x1c, 0x0a, 0x81, 0x1d, 0x0a, 0x81, 0x1e, 0x0a, 0x81, 0x1f, 0x0a, 0x81, 0xfc, 0x09,
+    0x81, 0xfd, 0x09, 0x81, 0xfe, 0x09, 0x81, 0xff, 0x09, 0x81, 0x00, 0x0a, 0x81, 0x01, 0x0a, 0x81,
+    0x08, 0x0a, 0x81, 0x09, 0x0a, 0x81, 0x0a, 0x0a, 0x81, 0x0b, 0x0a, 0x81, 0x0c, 0x0a, 0x81, 0x0d,
+    0x0a, 0x81, 0x02, 0x0a, 0x81, 0x03, 0x0a, 0x81, 0x04, 0x0a, 0x81, 0x05, 0x0a, 0x81, 0x06, 0x0a,
+    0x81, 0x07, 0x0a, 0x81, 0x14, 0x0a, 0x81, 0x15, 0x0a, 0x81, 0x16, 0x0a, 0x81, 0x17, 0x0a, 0x81,
+    0x18, 0x0a, 0x81, 0x19, 0x0a, 0x81, 0x0e, 0x0a, 0x81, 0x0f, 0x0a, 0x81, 0x10, 0x0a, 0x81, 0x11,
+    0x0a, 0x81, 0x12, 0x0a, 0x81, 0x13, 0x0a, 0x81, 0x99, 0x0c, 0x81, 0x9a, 0x0c, 0x81, 0x9b, 0x0c,
+    0x81, 0xab, 0x0c, 0x81, 0xac, 0x0c, 0x81, 0xad, 0x0c, 0x81, 0x9c, 0x0c, 0x81, 0x9d, 0x0c, 0x81,
+    0x9e, 0x0c, 0x81, 0xae, 0x0c, 0x81, 0xaf, 0x0c, 0x81, 0xb0, 0x0c, 0x81, 0x9f, 0x0c, 0x81, 0xa0,
+    0x0c, 0x81, 0xa1, 0x0c, 0x81, 0xa5, 0x0c, 0x81, 0xa6, 0x0c, 0x81, 0xa7, 0x0c, 0x81, 0xa2, 0x0c,
+    0x81, 0xa3, 0x0c, 0x81, 0xa4, 0x0c, 0x81, 0xa8, 0x0c, 0x81, 0xa9, 0x0c, 0x81, 0xaa, 0x0c, 0x81,
+    0xdb, 0x09, 0x81, 0xdc, 0x09, 0x81, 0xdd, 0x09, 0x81, 0xe4, 0x09, 0x81, 0xe5, 0x09, 0x81, 0xe6,
+    0x09, 0x81, 0xc9, 0x09, 0x81, 0xca, 0x09, 0x81, 0xcb, 0x09, 0x81, 0x68, 0x0a, 0x81, 0x69, 0x0a,
+    0x81, 0x6a, 0x0a, 0x81, 0xce, 0x07, 0x81, 0xcf, 0x07, 0x81, 0xd0, 0x07, 0x81, 0x6b, 0x0a, 0x81,
+    0x6c, 0x0a, 0x81, 0x6d, 0x0a, 0x81, 0x6e, 0x0a, 0x81, 0x6f, 0x0a, 0x81, 0x70, 0x0a, 0x81, 0xcf,
+    0x09, 0x81, 0xd0, 0x09, 0x81, 0xd1, 0x09, 0x81, 0xd2, 0x09, 0x81, 0xd3, 0x09, 0x81, 0xd4, 0x09,
+    0x81, 0xea, 0x09, 0x81, 0xeb, 0x09, 0x81, 0xec, 0x09, 0x81, 0xed, 0x09, 0x81, 0xee, 0x09, 0x81,
+    0xef, 0x09, 0x81, 0xd5, 0x09, 0x81, 0xd6, 0x09, 0x81, 0xd7, 0x09, 0x81, 0xd8, 0x09, 0x81, 0xd9,
+    0x09, 0x81, 0xda, 0x09, 0x81, 0xf6, 0x09, 0x81, 0xf7, 0x09, 0x81, 0xf8, 0x09, 0x81, 0xf9, 0x09,
+    0x81, 0xfa, 0x09, 0x81, 0xfb, 0x09, 0x81, 0xf0, 0x09, 0x81, 0xf1, 0x09, 0x81, 0xf2, 0x09, 0x81,
+    0xf3, 0x09, 0x81, 0xf4, 0x09, 0x81, 0xf5, 0x09, 0x81, 0xde, 0x09, 0x81, 0xdf, 0x09, 0x81, 0xe0,
+    0x09, 0x81, 0xe1, 0x09, 0x81, 0xe2, 0x09, 0x81, 0xe3, 0x09, 0x81, 0xcc, 0x09, 0x81, 0xcd, 0x09,
+    0x81, 0xce, 0x09, 0x81, 0xe7, 0x09, 0x81, 0xe8, 0x09, 0x81, 0xe9, 0x09, 0x81, 0xd1, 0x07, 0x81,
+    0xd2, 0x07, 0x81, 0xd3, 0x07, 0x6a, 0x37, 0xf1, 0x10, 0xfc, 0x02, 0x81, 0xfd, 0x02, 0x81, 0xfe,
+    0x02, 0x81, 0xff, 0x02, 0x81, 0x00, 0x03, 0x81, 0xd8, 0x00, 0x81, 0xd9, 0x00, 0x81, 0xda, 0x00,
+    0x81, 0xdb, 0x00, 0x81, 0xdc, 0x00, 0x81, 0xdd, 0x89, 0x30, 0x10, 0x0c, 0x2f, 0x30, 0x81, 0x81,
+    0x0e, 0x02, 0x81, 0x0f, 0x02, 0x81, 0x10, 0x4d, 0x2e, 0x13, 0xd2, 0x50, 0x2e, 0x00, 0x58, 0x3a,
+    0x23, 0xd6, 0x02, 0xc2, 0x2e, 0x11, 0xb2, 0xb4, 0x2f, 0x11, 0xb4, 0x8a, 0x2f, 0x23, 0x92, 0x04,
+    0xfb, 0x2e, 0x80, 0x95, 0x04, 0x81, 0x96, 0x04, 0x81, 0x97, 0x04, 0xa3, 0x31, 0x11, 0x40, 0x79,
+    0x31, 0xf0, 0x52, 0x42, 0x06, 0x81, 0x43, 0x06, 0x81, 0x44, 0x06, 0x81, 0x81, 0x06, 0x81, 0x82,
+    0x06, 0x81, 0x83, 0x06, 0x81, 0x5d, 0x06, 0x81, 0x5e, 0x06, 0x81, 0x5f, 0x06, 0x81, 0x84, 0x06,
+    0x81, 0x85, 0x06, 0x81, 0x86, 0x06, 0x81, 0x60, 0x06, 0x81, 0x61, 0x06, 0x81, 0x62, 0x06, 0x8b,
+    0x91, 0x0b, 0x8b, 0x92, 0x0b, 0x8b, 0x93, 0x0b, 0x8b, 0x94, 0x0b, 0x8b, 0x95, 0x0b, 0x8b, 0x96,
+    0x0b, 0x81, 0x95, 0x02, 0x81, 0x96, 0x02, 0x81, 0x97, 0x02, 0x81, 0xaa, 0x02, 0x81, 0xab, 0x02,
+    0x81, 0xac, 0x02, 0x81, 0x98, 0x02, 0x81, 0x99, 0x02, 0x81, 0x9a, 0x02, 0x81, 0xad, 0x02, 0x81,
+    0xae, 0x02, 0x81, 0xaf, 0x3f, 0x38, 0x03, 0x01, 0x2f, 0xf1, 0x1b, 0x63, 0x06, 0x81, 0x64, 0x06,
+    0x81, 0x65, 0x06, 0x81, 0x8a, 0x06, 0x81, 0x8b, 0x06, 0x81, 0x8c, 0x06, 0x81, 0x66, 0x06, 0x81,
+    0x67, 0x06, 0x81, 0x68, 0x06, 0x81, 0xdf, 0x00, 0x81, 0xe0, 0x00, 0x81, 0xe1, 0x00, 0x81, 0xe2,
+    0x00, 0x81, 0xe3, 0x00, 0x81, 0xe3, 0x36, 0x01, 0xe2, 0x0b, 0x04, 0x21, 0x3b, 0xe3, 0x16, 0x07,
+    0x81, 0x09, 0x07, 0x81, 0x0a, 0x07, 0x81, 0x0b, 0x07, 0x81, 0x0f, 0x07, 0xa0, 0x2f, 0xf4, 0x13,
+    0x0c, 0x07, 0x81, 0x0d, 0x07, 0x81, 0x0e, 0x07, 0x81, 0x12, 0x07, 0x81, 0x13, 0x07, 0x81, 0x14,
+    0x07, 0x81, 0xd2, 0x00, 0x81, 0xd3, 0x00, 0x81, 0xd4, 0x00, 0x81, 0xd5, 0x00, 0x81, 0xd6, 0x00,
+    0x81, 0xd7, 0x48, 0x00, 0x04, 0x42, 0x09, 0xf0, 0x1a, 0x81, 0x02, 0x00, 0x81, 0x8e, 0x02, 0x81,
+    0x8f, 0x02, 0x81, 0x90, 0x02, 0x81, 0xa3, 0x02, 0x81, 0xa4, 0x02, 0x81, 0xa5, 0x02, 0x81, 0x91,
+    0x02, 0x81, 0x92, 0x02, 0x81, 0x93, 0x02, 0x81, 0xa6, 0x02, 0x81, 0xa7, 0x02, 0x81, 0xa8, 0x02,
+    0x81, 0xca, 0x4c, 0x26, 0x00, 0x40, 0x26, 0x10, 0xcd, 0x4c, 0x26, 0x00, 0x37, 0x26, 0xf0, 0x02,
+    0x2e, 0x03, 0x81, 0x2f, 0x03, 0x81, 0x30, 0x03, 0x81, 0x31, 0x03, 0x81, 0x32, 0x03, 0x81, 0x33,
+    0x03, 0x19, 0x2f, 0xc1, 0x39, 0x03, 0x81, 0x3a, 0x03, 0x81, 0x3b, 0x03, 0x81, 0x3c, 0x03, 0x81,
+    0xcb, 0x45, 0x00, 0x63, 0x00, 0x01, 0x66, 0x50, 0x00, 0x09, 0x00, 0x14, 0x3c, 0x09, 0x00, 0x14,
+    0x3d, 0x09, 0x00, 0x01, 0x9f, 0x50, 0x00, 0x09, 0x00, 0x01, 0x90, 0x50, 0x00, 0x09, 0x00, 0x01,
+    0xab, 0x50, 0x00, 0x09, 0x00, 0x04, 0x53, 0x29, 0x11, 0x81, 0xb1, 0x50, 0x00, 0x09, 0x00, 0x04,
+    0xbf, 0x29, 0x41, 0x81, 0x00, 0x00, 0x08, 0x5a, 0x2d, 0x00, 0xb9, 0x28, 0x01, 0xc1, 0x40, 0x00,
+    0x09, 0x00, 0x01, 0xc4, 0x40, 0x00, 0x09, 0x00, 0x01, 0x69, 0x2d, 0x01, 0xd8, 0x2a, 0x04, 0x09,
+    0x00, 0x14, 0xf4, 0x09, 0x00, 0x01, 0x78, 0x2d, 0x01, 0xe1, 0x2a, 0x04, 0x09, 0x00, 0x01, 0xe2,
+    0x40, 0x00, 0x09, 0x00, 0x01, 0x87, 0x2d, 0x00, 0x09, 0x00, 0x31, 0xf9, 0x03, 0x08, 0xe5, 0x40,
+    0x11, 0x08, 0x8d, 0x2d, 0x00, 0x09, 0x00, 0x01, 0xc7, 0x2c, 0x00, 0x09, 0x00, 0x01, 0xa0, 0x2c,
+    0x00, 0x09, 0x00, 0x01, 0x9c, 0x2d, 0x01, 0x1d, 0x2b, 0x04, 0x09, 0x00, 0x04, 0x42, 0x57, 0x11,
+    0x08, 0xf7, 0x40, 0x00, 0x09, 0x00, 0x01, 0xfa, 0x40, 0x00, 0x09, 0x00, 0x01, 0xfd, 0x40, 0x00,
+    0x09, 0x00, 0x01, 0x00, 0x41, 0x00, 0x09, 0x00, 0x01, 0x03, 0x41, 0x00, 0x09, 0x00, 0x01, 0x06,
+    0x41, 0x01, 0x59, 0x2b, 0x04, 0x09, 0x00, 0x01, 0x0c, 0x41, 0x00, 0x09, 0x00, 0x01, 0x0f, 0x41,
+    0x00, 0x09, 0x00, 0x04, 0xd5, 0x3c, 0x11, 0x08, 0x15, 0x41, 0x00, 0x09, 0x00, 0x01, 0x18, 0x41,
+    0x00, 0x09, 0x00, 0x14, 0x0d, 0x09, 0x00, 0x01, 0x24, 0x41, 0x00, 0x09, 0x00, 0x02, 0xa8, 0x57,
+    0x44, 0x00, 0x00, 0x08, 0x10, 0x09, 0x00, 0x14, 0x11, 0x09, 0x00, 0x01, 0x32, 0x45, 0x00, 0x09,
+    0x00, 0x14, 0x13, 0x09, 0x00, 0x14, 0x14, 0x09, 0x00, 0x41, 0x15, 0x04, 0x08, 0x16, 0xba, 0x2a,
+    0x31, 0x17, 0x04, 0x08, 0xc5, 0x3f, 0x11, 0x08, 0xc5, 0x3f, 0x00, 0x09, 0x00, 0x01, 0x02, 0x3f,
+    0x00, 0x09, 0x00, 0x01, 0x05, 0x3f, 0x00, 0x09, 0x00, 0x01, 0x08, 0x3f, 0x00, 0x09, 0x00, 0x01,
+    0x0b, 0x3f, 0x00, 0x09, 0x00, 0x01, 0x0e, 0x3f, 0x00, 0x09, 0x00, 0x01, 0x11, 0x3f, 0x00, 0x09,
+    0x00, 0x14, 0x20, 0x09, 0x00, 0x14, 0x21, 0x09, 0x00, 0x14, 0x22, 0x09, 0x00, 0x14, 0x23, 0x09,
+    0x00, 0x01, 0xc6, 0x3e, 0x00, 0x09, 0x00, 0x01, 0xc9, 0x3e, 0x00, 0x09, 0x00, 0x01, 0xcc, 0x3e,
+    0x00, 0x09, 0x00, 0x01, 0xcf, 0x3e, 0x00, 0x09, 0x00, 0x14, 0x28, 0x09, 0x00, 0x14, 0x29, 0x09,
+    0x00, 0x01, 0xd2, 0x3e, 0x00, 0x09, 0x00, 0x01, 0xd5, 0x3e, 0x00, 0x09, 0x00, 0x01, 0xd8, 0x3e,
+    0x00, 0x09, 0x00, 0x01, 0xdb, 0x3e, 0x00, 0x09, 0x00, 0x14, 0x2e, 0x09, 0x00, 0x14, 0x2f, 0x09,
+    0x00, 0x01, 0xf0, 0x3e, 0x00, 0x09, 0x00, 0x14, 0x31, 0x09, 0x00, 0x01, 0xfc, 0x3e, 0x00, 0x09,
+    0x00, 0x01, 0xf9, 0x3e, 0x00, 0x09, 0x00, 0x14, 0x34, 0x09, 0x00, 0x14, 0x35, 0x09, 0x00, 0x14,
+    0x36, 0x09, 0x00, 0x14, 0x37, 0x09, 0x00, 0x13, 0x38, 0x09, 0x00, 0x11, 0x06, 0x61, 0x55, 0x00,
+    0x09, 0x00, 0x01, 0x64, 0x55, 0x00, 0x1b, 0x00, 0x41, 0x3c, 0x04, 0x08, 0x3d, 0x3b, 0x01, 0x41,
+    0x3e, 0x04, 0x08, 0x3f, 0x09, 0x00, 0x00, 0x74, 0xf8, 0x01, 0x1b, 0x00, 0x14, 0x41, 0x09, 0x00,
+    0x41, 0x42, 0x04, 0x08, 0x43, 0x1b, 0x00, 0x31, 0x44, 0x04, 0x08, 0x1c, 0x3a, 0x14, 0x08, 0xc2,
+    0x39, 0x24, 0x08, 0x47, 0x5a, 0x00, 0x04, 0x52, 0xf5, 0x14, 0x06, 0x87, 0xf8, 0x11, 0x06, 0xb5,
+    0x55, 0x00, 0x09, 0x00, 0x04, 0xbd, 0x03, 0x24, 0x06, 0xd8, 0x09, 0x00, 0x14, 0xd9, 0x09, 0x00,
+    0x14, 0xda, 0x09, 0x00, 0x14, 0xdb, 0x90, 0x00, 0x31, 0x50, 0x04, 0x08, 0x52, 0x4c, 0x51, 0x08,
+    0x52, 0x04, 0x08, 0x53, 0x09, 0x00, 0x40, 0x54, 0x04, 0x08, 0x55, 0x09, 0x00, 0x51, 0x06, 0xdc,
+    0x00, 0x08, 0x59, 0x09, 0x00, 0x41, 0xdd, 0x00, 0x08, 0x5b, 0x09, 0x00, 0x14, 0xde, 0x3f, 0x00,
+    0x00, 0x53, 0x5a, 0x01, 0x09, 0x00, 0x41, 0xe0, 0x00, 0x08, 0x60, 0x1b, 0x00, 0x41, 0xe1, 0x00,
+    0x08, 0x62, 0x09, 0x00, 0x41, 0xe2, 0x00, 0x08, 0x64, 0x09, 0x00, 0x01, 0x75, 0x3b, 0x00, 0x09,
+    0x00, 0x04, 0x95, 0x04, 0x00, 0x5d, 0x00, 0x14, 0x67, 0xc9, 0x00, 0x01, 0x74, 0x39, 0x41, 0x08,
+    0x69, 0x04, 0x08, 0x68, 0x39, 0x41, 0x08, 0x6b, 0x04, 0x08, 0x68, 0x39, 0x51, 0x08, 0x6d, 0x04,
+    0x08, 0x6e, 0x09, 0x00, 0x41, 0x6f, 0x04, 0x08, 0x70, 0x09, 0x00, 0x41, 0x71, 0x04, 0x08, 0x72,
+    0x09, 0x00, 0x41, 0x73, 0x04, 0x08, 0x74, 0x09, 0x00, 0x41, 0x75, 0x04, 0x08, 0x76, 0x09, 0x00,
+    0x41, 0x77, 0x04, 0x08, 0x78, 0x09, 0x00, 0x41, 0x79, 0x04, 0x08, 0x7a, 0x09, 0x00, 0x41, 0x7b,
+    0x04, 0x08, 0x7c, 0x09, 0x00, 0x41, 0x7d, 0x04, 0x08, 0x7e, 0x09, 0x00, 0x41, 0x7f, 0x04, 0x08,
+    0x80, 0x09, 0x00, 0x41, 0x81, 0x04, 0x08, 0x82, 0x09, 0x00, 0x41, 0x83, 0x04, 0x08, 0x84, 0x09,
+    0x00, 0x41, 0x85, 0x04, 0x08, 0x86, 0x09, 0x00, 0x40, 0x87, 0x04, 0x08, 0x88, 0x09, 0x00, 0x50,
+    0x80, 0x74, 0x06, 0x80, 0x73, 0x85, 0x08, 0x13, 0x06, 0xd2, 0xb0, 0x34, 0x00, 0x06, 0xe6, 0x09,
+    0x00, 0x14, 0xe7, 0xc3, 0x00, 0x14, 0x8b, 0x83, 0x01, 0x01, 0x3e, 0x3c, 0x00, 0x09, 0x00, 0x01,
+    0x41, 0x3c, 0x00, 0x09, 0x00, 0x04, 0x44, 0x3c, 0x11, 0x06, 0xf9, 0x56, 0x00, 0x09, 0x00, 0x01,
+    0xfc, 0x56, 0x00, 0x36, 0x00, 0x14, 0x94, 0xf9, 0x00, 0x14, 0x95, 0x09, 0x00, 0x14, 0x96, 0x09,
+    0x00, 0x31, 0x97, 0x04, 0x08, 0xd1, 0x2b, 0x41, 0x08, 0x99, 0x04, 0x08, 0xd1, 0x2b, 0x11, 0x06,
+    0x2c, 0x57, 0x00, 0x09, 0x00, 0x01, 0x2f, 0x57, 0x00, 0x09, 0x00, 0x01, 0x32, 0x57, 0x00, 0x09,
+    0x00, 0x01, 0x35, 0x57, 0x00, 0x09, 0x00, 0x03, 0x84, 0xb0, 0x34, 0x00, 0x06, 0xf2, 0x09, 0x00,
+    0x14, 0xf3, 0x09, 0x00, 0x01, 0x47, 0x57, 0x00, 0x51, 0x00, 0x41, 0xa3, 0x04, 0x08, 0xa4, 0x5a,
+    0x00, 0x41, 0xa5, 0x04, 0x08, 0xa6, 0x5a, 0x00, 0x01, 0x47, 0x31, 0x00, 0x12, 0x00, 0x41, 0xa8,
+    0x04, 0x08, 0xa9, 0x12, 0x00, 0x01, 0x29, 0x31, 0x00, 0x12, 0x00, 0x14, 0xac, 0x90, 0x00, 0x14,
+    0xad, 0x09, 0x00, 0x14, 0xae, 0xea, 0x00, 0x01, 0x86, 0x57, 0x00, 0x12, 0x00, 0x14, 0xb1, 0x1b,
+    0x00, 0x41, 0xb2, 0x04, 0x08, 0xb3, 0x5a, 0x00, 0x31, 0xb4, 0x04, 0x08, 0x52, 0x49, 0x13, 0x08,
+    0x55, 0x61, 0x34, 0x00, 0x08, 0xb7, 0x09, 0x00, 0x41, 0xb8, 0x04, 0x08, 0xb9, 0x1b, 0x00, 0x41,
+    0xba, 0x04, 0x08, 0xbb, 0x09, 0x00, 0x14, 0xbc, 0x1b, 0x00, 0x14, 0xbd, 0x09, 0x00, 0x41, 0xbe,
+    0x04, 0x08, 0xbf, 0x1b, 0x00, 0x41, 0xc0, 0x04, 0x08, 0xc1, 0x09, 0x00, 0x44, 0xc2, 0x04, 0x08,
+    0xc3, 0x1e, 0x00, 0x14, 0xc6, 0x09, 0x00, 0x11, 0xc7, 0x1b, 0x00, 0x13, 0xc8, 0x0f, 0x00, 0x00,
+    0x0c, 0x00, 0x14, 0xc9, 0x1b, 0x00, 0x14, 0xca, 0x09, 0x00, 0x04, 0xfa, 0x3a, 0x24, 0x08, 0xcc,
+    0x09, 0x00, 0x11, 0xcd, 0x36, 0x00, 0x41, 0xce, 0x04, 0x08, 0xcf, 0x09, 0x00, 0x41, 0xd0, 0x04,
+    0x08, 0xd1, 0x09, 0x00, 0x31, 0xd2, 0x04, 0x08, 0xb2, 0x49, 0x51, 0x08, 0xd4, 0x04, 0x08, 0xd5,
+    0x09, 0x00, 0x41, 0xd6, 0x04, 0x08, 0xd7, 0x09, 0x00, 0x41, 0xd8, 0x04, 0x08, 0xd9, 0x09, 0x00,
+    0x41, 0xda, 0x04, 0x08, 0xdb, 0x09, 0x00, 0x31, 0xdc, 0x04, 0x08, 0x24, 0x3b, 0x51, 0x08, 0xde,
+    0x04, 0x08, 0xdf, 0x09, 0x00, 0x41, 0xe0, 0x04, 0x08, 0xe1, 0x09, 0x00, 0x41, 0xe2, 0x04, 0x08,
+    0xe3, 0x09, 0x00, 0x41, 0xe4, 0x04, 0x08, 0xe5, 0x09, 0x00, 0x41, 0xe6, 0x04, 0x08, 0xe7, 0x09,
+    0x00, 0x41, 0xe8, 0x04, 0x08, 0xe9, 0x09, 0x00, 0x41, 0xea, 0x04, 0x08, 0xeb, 0x09, 0x00, 0x41,
+    0xec, 0x04, 0x08, 0xed, 0x09, 0x00, 0x41, 0xee, 0x04, 0x08, 0xef, 0x09, 0x00, 0x31, 0xf0, 0x04,
+    0x08, 0xe5, 0x49, 0x41, 0x08, 0xf2, 0x04, 0x08, 0x94, 0x32, 0x51, 0x08, 0xf4, 0x04, 0x08, 0xf5,
+    0x09, 0x00, 0x41, 0xf6, 0x04, 0x08, 0xf7, 0x09, 0x00, 0x41, 0xf8, 0x04, 0x08, 0xf9, 0x09, 0x00,
+    0x41, 0xfa, 0x04, 0x08, 0xfb, 0x09, 0x00, 0x41, 0xfc, 0x04, 0x08, 0xfd, 0x09, 0x00, 0x30, 0xfe,
+    0x04, 0x08, 0x4f, 0xd8, 0x61, 0x00, 0x08, 0x00, 0x05, 0x08, 0x01, 0x0b, 0x30, 0x41, 0x02, 0x05,
+    0x08, 0x03, 0x09, 0x00, 0x31, 0x04, 0x05, 0x08, 0xcb, 0x64, 0x24, 0x06, 0xf8, 0x2f, 0x01, 0x30,
+    0x08, 0x05, 0x08, 0xb0, 0xe8, 0x61, 0x00, 0x08, 0x0a, 0x05, 0x08, 0x0b, 0x09, 0x00, 0x41, 0x0c,
+    0x05, 0x08, 0x0d, 0x09, 0x00, 0x31, 0x0e, 0x05, 0x08, 0x02, 0x4b, 0x51, 0x08, 0x10, 0x05, 0x08,
+    0x11, 0x09, 0x00, 0x31, 0x12, 0x05, 0x08, 0xfc, 0x3b, 0x41, 0x08, 0x14, 0x05, 0x08, 0xf3, 0x3b,
+    0x41, 0x08, 0x16, 0x05, 0x08, 0xf0, 0x3b, 0x41, 0x08, 0x18, 0x05, 0x08, 0xea, 0x3b, 0x51, 0x08,
+    0x1a, 0x05, 0x08, 0x1b, 0x09, 0x00, 0x31, 0x1c, 0x05, 0x08, 0x34, 0x38, 0x41, 0x08, 0x1e, 0x05,
+    0x08, 0x21, 0x36, 0x41, 0x08, 0x20, 0x05, 0x08, 0x97, 0x3d, 0x51, 0x08, 0x22, 0x05, 0x08, 0x23,
+    0x09, 0x00, 0x41, 0x24, 0x05, 0x08, 0x25, 0x09, 0x00, 0x30, 0x26, 0x05, 0x08, 0x25, 0xd9, 0x61,
+    0x00, 0x08, 0x28, 0x05, 0x08, 0x29, 0xa2, 0x00, 0x01, 0xdb, 0x59, 0x00, 0x12, 0x00, 0x31, 0x2c,
+    0x05, 0x08, 0x35, 0x4b, 0x23, 0x08, 0x2e, 0xda, 0x10, 0x24, 0x08, 0x2f, 0x09, 0x00, 0x01, 0x5f,
+    0x51, 0x00, 0x09, 0x00, 0x14, 0x31, 0x09, 0x00, 0x14, 0x32, 0x09, 0x00, 0x14, 0x33, 0x09, 0x00,
+    0x41, 0x34, 0x05, 0x08, 0x35, 0x3f, 0x00, 0x14, 0x36, 0x12, 0x00, 0x14, 0x37, 0x09, 0x00, 0x41,
+    0x38, 0x05, 0x08, 0x39, 0x1b, 0x00, 0x41, 0x3a, 0x05, 0x08, 0x3b, 0x09, 0x00, 0x41, 0x3c, 0x05,
+    0x08, 0x3d, 0x09, 0x00, 0x41, 0x3e, 0x05, 0x08, 0x3f, 0x09, 0x00, 0x41, 0x40, 0x05, 0x08, 0x41,
+    0x09, 0x00, 0x41, 0x42, 0x05, 0x08, 0x43, 0x09, 0x00, 0x41, 0x44, 0x05, 0x08, 0x45, 0x09, 0x00,
+    0x14, 0x46, 0x48, 0x00, 0x31, 0x47, 0x05, 0x08, 0x2f, 0x51, 0x51, 0x08, 0x49, 0x05, 0x08, 0x4a,
+    0x09, 0x00, 0x30, 0x4b, 0x05, 0x08, 0x3e, 0xab, 0x51, 0x00, 0x08, 0x4d, 0x05, 0x08, 0x50, 0x51,
+    0x51, 0x08, 0x4f, 0x05, 0x08, 0x50, 0x09, 0x00, 0x41, 0x51, 0x05, 0x08, 0x52, 0x09, 0x00, 0x41,
+    0x53, 0x05, 0x08, 0x54, 0x09, 0x00, 0x31, 0x55, 0x05, 0x08, 0xbc, 0x42, 0x51, 0x08, 0x57, 0x05,
+    0x08, 0x58, 0x09, 0x00, 0x41, 0x59, 0x05, 0x08, 0x5a, 0x09, 0x00, 0x31, 0x5b, 0x05, 0x08, 0xbf,
+    0x42, 0x51, 0x08, 0x5d, 0x05, 0x08, 0x5e, 0x09, 0x00, 0x41, 0x5f, 0x05, 0x08, 0x60, 0x09, 0x00,
+    0x31, 0x61, 0x05, 0x08, 0x3a, 0x43, 0x41, 0x08, 0x63, 0x05, 0x08, 0x3d, 0x5e, 0x41, 0x08, 0x65,
+    0x05, 0x08, 0xe4, 0x4d, 0x41, 0x08, 0x67, 0x05, 0x08, 0x33, 0x39, 0x41, 0x08, 0x69, 0x05, 0x08,
+    0x1c, 0x43, 0x51, 0x08, 0x6b, 0x05, 0x08, 0x6c, 0x09, 0x00, 0x31, 0x6d, 0x05, 0x08, 0x98, 0x16,
+    0x41, 0x08, 0x6f, 0x05, 0x08, 0x59, 0x16, 0x41, 0x08, 0x71, 0x05, 0x08, 0x98, 0x16, 0x41, 0x08,
+    0x73, 0x05, 0x08, 0x59, 0x16, 0x41, 0x08, 0x75, 0x05, 0x08, 0x58, 0x43, 0x51, 0x08, 0x77, 0x05,
+    0x08, 0x78, 0x09, 0x00, 0x41, 0x79, 0x05, 0x08, 0x7a, 0x09, 0x00, 0x31, 0x7b, 0x05, 0x08, 0x5b,
+    0x43, 0x51, 0x08, 0x7d, 0x05, 0x08, 0x7e, 0x09, 0x00, 0x41, 0x7f, 0x05, 0x08, 0x80, 0x09, 0x00,
+    0x31, 0x81, 0x05, 0x08, 0xd6, 0x43, 0x51, 0x08, 0x83, 0x05, 0x08, 0x84, 0x09, 0x00, 0x14, 0x85,
+    0x20, 0x01, 0x41, 0x86, 0x05, 0x08, 0x87, 0x12, 0x00, 0x41, 0x88, 0x05, 0x08, 0x89, 0x09, 0x00,
+    0x41, 0x8a, 0x05, 0x08, 0x8b, 0x09, 0x00, 0x41, 0x8c, 0x05, 0x08, 0x8d, 0x09, 0x00, 0x41, 0x8e,
+    0x05, 0x08, 0x8f, 0x09, 0x00, 0x41, 0x90, 0x05, 0x08, 0x91, 0x09, 0x00, 0x41, 0x92, 0x05, 0x08,
+    0x93, 0x09, 0x00, 0x31, 0x94, 0x05, 0x08, 0x02, 0x4e, 0x41, 0x08, 0x96, 0x05, 0x08, 0x3f, 0x3e,
+    0x51, 0x08, 0x98, 0x05, 0x08, 0x99, 0x09, 0x00, 0x41, 0x9a, 0x05, 0x08, 0x9b, 0x09, 0x00, 0x41,
+    0x9c, 0x05, 0x08, 0x9d, 0x09, 0x00, 0x31, 0x9e, 0x05, 0x08, 0x6e, 0x13, 0x51, 0x08, 0xa0, 0x05,
+    0x08, 0xa1, 0x09, 0x00, 0x41, 0xa2, 0x05, 0x08, 0xa3, 0x09, 0x00, 0x41, 0xa4, 0x05, 0x08, 0xa5,
+    0x09, 0x00, 0x41, 0xa6, 0x05, 0x08, 0xa7, 0x09, 0x00, 0x41, 0xa8, 0x05, 0x08, 0xa9, 0x09, 0x00,
+    0x31, 0xaa, 0x05, 0x08, 0x0d, 0x43, 0x51, 0x08, 0xac, 0x05, 0x08, 0xad, 0x09, 0x00, 0x41, 0xae,
+    0x05, 0x08, 0xaf, 0x09, 0x00, 0x41, 0xb0, 0x05, 0x08, 0xb1, 0x09, 0x00, 0x31, 0xb2, 0x05, 0x08,
+    0xc9, 0x5f, 0x54, 0x08, 0xb4, 0x05, 0x08, 0xb5, 0xdb, 0x00, 0x01, 0x99, 0x50, 0x51, 0x08, 0xb7,
+    0x05, 0x08, 0xb8, 0x09, 0x00, 0x44, 0xb9, 0x05, 0x08, 0xba, 0x1b, 0x00, 0x14, 0xbb, 0x09, 0x00,
+    0x11, 0xbc, 0x1b, 0x00, 0x41, 0xbd, 0x05, 0x08, 0xbe, 0x09, 0x00, 0x41, 0xbf, 0x05, 0x08, 0xc0,
+    0x09, 0x00, 0x41, 0xc1, 0x05, 0x08, 0xc2, 0x09, 0x00, 0x30, 0xc3, 0x05, 0x08, 0x87, 0xb0, 0x61,
+    0x00, 0x08, 0xc5, 0x05, 0x08, 0xc6, 0x09, 0x00, 0x31, 0xc7, 0x05, 0x08, 0x76, 0x3b, 0x41, 0x08,
+    0xc9, 0x05, 0x08, 0xe4, 0x15, 0x41, 0x08, 0xcb, 0x05, 0x08, 0xdb, 0x15, 0x41, 0x08, 0xcd, 0x05,
+    0x08, 0x9c, 0x15, 0x41, 0x08, 0xcf, 0x05, 0x08, 0xf6, 0x15, 0x41, 0x08, 0xd1, 0x05, 0x08, 0xed,
+    0x15, 0x41, 0x08, 0xd3, 0x05, 0x08, 0xae, 0x15, 0x41, 0x08, 0xd5, 0x05, 0x08, 0x6a, 0x14, 0x41,
+    0x08, 0xd7, 0x05, 0x08, 0x61, 0x14, 0x41, 0x08, 0xd9, 0x05, 0x08, 0x22, 0x14, 0x41, 0x08, 0xdb,
+    0x05, 0x08, 0x7c, 0x14, 0x41, 0x08, 0xdd, 0x05, 0x08, 0x73, 0x14, 0x41, 0x08, 0xdf, 0x05, 0x08,
+    0x34, 0x14, 0x41, 0x08, 0xe1, 0x05, 0x08, 0x51, 0x15, 0x51, 0x08, 0xe3, 0x05, 0x08, 0xe4, 0x09,
+    0x00, 0x41, 0xe5, 0x05, 0x08, 0xe6, 0x09, 0x00, 0x41, 0xe7, 0x05, 0x08, 0xe8, 0x09, 0x00, 0x44,
+    0xe9, 0x05, 0x08, 0xea, 0xd8, 0x00, 0x11, 0xeb, 0x12, 0x00, 0x41, 0xec, 0x05, 0x08, 0xed, 0x09,
+    0x00, 0x41, 0xee, 0x05, 0x08, 0xef, 0x09, 0x00, 0x41, 0xf0, 0x05, 0x08, 0xf1, 0x09, 0x00, 0x41,
+    0xf2, 0x05, 0x08, 0xf3, 0x09, 0x00, 0x41, 0xf4, 0x05, 0x08, 0xf5, 0x09, 0x00, 0x41, 0xf6, 0x05,
+    0x08, 0xf7, 0x09, 0x00, 0x31, 0xf8, 0x05, 0x08, 0x74, 0x3a, 0x51, 0x08, 0xfa, 0x05, 0x08, 0xfb,
+    0x09, 0x00, 0x31, 0xfc, 0x05, 0x08, 0xb4, 0x4a, 0x51, 0x08, 0xfe, 0x05, 0x08, 0xff, 0x09, 0x00,
+    0x01, 0xd5, 0x4d, 0x00, 0x09, 0x00, 0x41, 0x01, 0x06, 0x08, 0x02, 0x45, 0x36, 0x41, 0x03, 0x06,
+    0x08, 0x04, 0x09, 0x00, 0x41, 0x05, 0x06, 0x08, 0x06, 0x8f, 0x07, 0x01, 0xfb, 0x5d, 0x00, 0x09,
+    0x00, 0x01, 0xfe, 0x5d, 0x00, 0x1b, 0x00, 0x31, 0x09, 0x06, 0x08, 0xb8, 0x47, 0x41, 0x08, 0x0b,
+    0x06, 0x08, 0x3f, 0x3c, 0x51, 0x08, 0x0d, 0x06, 0x08, 0x0e, 0x09, 0x00, 0x30, 0x0f, 0x06, 0x08,
+    0x27, 0x7a, 0x61, 0x00, 0x08, 0x11, 0x06, 0x08, 0x12, 0x09, 0x00, 0x44, 0x13, 0x06, 0x08, 0x14,
+    0x66, 0x00, 0x11, 0x15, 0x51, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x0f, 0x00, 0x31, 0x17, 0x06, 0x08,
+    0xdc, 0x49, 0x51, 0x08, 0x19, 0x06, 0x08, 0x1a, 0x09, 0x00, 0x41, 0x1b, 0x06, 0x08, 0x1c, 0x09,
+    0x00, 0x31, 0x1d, 0x06, 0x08, 0x89, 0x4e, 0x51, 0x08, 0x1f, 0x06, 0x08, 0x20, 0x09, 0x00, 0x41,
+    0x21, 0x06, 0x08, 0x22, 0x09, 0x00, 0x41, 0x23, 0x06, 0x08, 0x24, 0x09, 0x00, 0x41, 0x25, 0x06,
+    0x08, 0x26, 0x09, 0x00, 0x41, 0x27, 0x06, 0x08, 0x28, 0x09, 0x00, 0x41, 0x29, 0x06, 0x08, 0x2a,
+    0x09, 0x00, 0x41, 0x2b, 0x06, 0x08, 0x2c, 0x09, 0x00, 0x41, 0x2e, 0x06, 0x08, 0x2f, 0x09, 0x00,
+    0x41, 0x31, 0x06, 0x08, 0x32, 0x09, 0x00, 0x41, 0x34, 0x06, 0x08, 0x35, 0x09, 0x00, 0x31, 0x37,
+    0x06, 0x08, 0x27, 0x2d, 0x41, 0x08, 0x39, 0x06, 0x08, 0x1e, 0x2d, 0x41, 0x08, 0x3b, 0x06, 0x08,
+    0xf9, 0x2a, 0x51, 0x08, 0x3e, 0x06, 0x08, 0x3f, 0x09, 0x00, 0x41, 0x41, 0x06, 0x08, 0x42, 0x09,
+    0x00, 0x41, 0x44, 0x06, 0x08, 0x45, 0x09, 0x00, 0x41, 0x47, 0x06, 0x08, 0x48, 0x09, 0x00, 0x41,
+    0x49, 0x06, 0x08, 0x4a, 0x09, 0x00, 0x41, 0x4b, 0x06, 0x08, 0x4c, 0x09, 0x00, 0x41, 0x4d, 0x06,
+    0x08, 0x4e, 0x09, 0x00, 0x30, 0x4f, 0x06, 0x08, 0xe6, 0x75, 0x51, 0x00, 0x08, 0x51, 0x06, 0x08,
+    0x24, 0x39, 0x40, 0x08, 0x53, 0x06, 0x08, 0xac, 0x67, 0x61, 0x00, 0x08, 0x56, 0x06, 0x08, 0x57,
+    0x09, 0x00, 0x41, 0x59, 0x06, 0x08, 0x5a, 0x09, 0x00, 0x41, 0x5c, 0x06, 0x08, 0x5d, 0x09, 0x00,
+    0x30, 0x5f, 0x06, 0x08, 0x79, 0x64, 0x21, 0x00, 0x08, 0xb6, 0x3d, 0x00, 0x09, 0x00, 0x31, 0x62,
+    0x06, 0x08, 0xce, 0x3d, 0x51, 0x08, 0x64, 0x06, 0x08, 0x65, 0x09, 0x00, 0x41, 0x66, 0x06, 0x08,
+    0x67, 0x09, 0x00, 0x41, 0x68, 0x06, 0x08, 0x69, 0x4d, 0x01, 0x01, 0x87, 0x5f, 0x03, 0x30, 0x00,
+    0x00, 0x5e, 0x64, 0x01, 0x09, 0x00, 0x11, 0x6d, 0x24, 0x00, 0x41, 0x6e, 0x06, 0x08, 0x6f, 0x09,
+    0x00, 0x41, 0x70, 0x06, 0x08, 0x71, 0x09, 0x00, 0x31, 0x72, 0x06, 0x08, 0x63, 0x09, 0x00, 0x0c,
+    0x00, 0x11, 0x74, 0x12, 0x00, 0x41, 0x75, 0x06, 0x08, 0x76, 0x09, 0x00, 0x30, 0x77, 0x06, 0x08,
+    0xb9, 0xfa, 0x50, 0x00, 0x08, 0x7b, 0x06, 0x08, 0xb3, 0xfa, 0x61, 0x00, 0x08, 0x7d, 0x06, 0x08,
+    0x7e, 0x09, 0x00, 0x30, 0x7f, 0x06, 0x08, 0xb7, 0xf9, 0x10, 0x00, 0xc6, 0x25, 0x11, 0x82, 0x09,
+    0x00, 0x14, 0x83, 0x45, 0x00, 0x00, 0xc0, 0xf9, 0x01, 0x1c, 0x02, 0x01, 0x08, 0x60, 0x00, 0x12,
+    0x00, 0x07, 0x78, 0x47, 0x10, 0x08, 0xcf, 0xf9, 0x01, 0x09, 0x00, 0x11, 0x89, 0x36, 0x00, 0x41,
+    0x8a, 0x06, 0x08, 0x8b, 0x09, 0x00, 0x00, 0xd8, 0xf9, 0x01, 0x18, 0x00, 0x04, 0x86, 0x34, 0x11,
+    0x06, 0x41, 0x60, 0x00, 0x12, 0x00, 0x04, 0x50, 0x34, 0x14, 0x08, 0x50, 0x34, 0x14, 0x08, 0x6b,
+    0x34, 0x14, 0x08, 0x4a, 0x31, 0x00, 0x0c, 0x00, 0x04, 0x4d, 0x31, 0x11, 0x08, 0xbf, 0x34, 0x14,
+    0x06, 0x36, 0x38, 0x40, 0x08, 0x97, 0x06, 0x08, 0x08, 0xfa, 0x34, 0x00, 0x08, 0x99, 0x21, 0x00,
+    0x41, 0x9a, 0x06, 0x08, 0x9b, 0x12, 0x00, 0x44, 0x9c, 0x06, 0x08, 0x9d, 0x15, 0x00, 0x11, 0x9e,
+    0x12, 0x00, 0x30, 0x9f, 0x06, 0x08, 0x4a, 0xf4, 0x61, 0x00, 0x08, 0xa1, 0x06, 0x08, 0xa2, 0x09,
+    0x00, 0x31, 0xa3, 0x06, 0x08, 0x31, 0x2f, 0x41, 0x08, 0xa5, 0x06, 0x08, 0xfa, 0x2c, 0x41, 0x08,
+    0xa7, 0x06, 0x08, 0x1a, 0x13, 0x41, 0x08, 0xa9, 0x06, 0x08, 0x34, 0x2c, 0x41, 0x08, 0xab, 0x06,
+    0x08, 0x57, 0x4d, 0x41, 0x08, 0xad, 0x06, 0x08, 0x54, 0x4d, 0x41, 0x08, 0xaf, 0x06, 0x08, 0xe9,
+    0x4e, 0x13, 0x06, 0xf1, 0x37, 0x34, 0x00, 0x08, 0xb3, 0x69, 0x00, 0x00, 0x14, 0xf4, 0x01, 0x09,
+    0x00, 0x14, 0xb5, 0x09, 0x00, 0x41, 0xb6, 0x06, 0x08, 0xb7, 0x36, 0x00, 0x41, 0xb8, 0x06, 0x08,
+    0xb9, 0x09, 0x00, 0x41, 0xbc, 0x06, 0x08, 0xbd, 0x09, 0x00, 0x31, 0xbe, 0x06, 0x08, 0x61, 0x52,
+    0x51, 0x08, 0xc2, 0x06, 0x08, 0xc3, 0x09, 0x00, 0x41, 0xc4, 0x06, 0x08, 0xc5, 0x09, 0x00, 0x41,
+    0xc8, 0x06, 0x08, 0xc9, 0x09, 0x00, 0x41, 0xca, 0x06, 0x08, 0xcb, 0x09, 0x00, 0x41, 0xce, 0x06,
+    0x08, 0xcf, 0x09, 0x00, 0x41, 0xd0, 0x06, 0x08, 0xd1, 0x09, 0x00, 0x14, 0xd2, 0x63, 0x00, 0x41,
+    0xd5, 0x06, 0x08, 0xd6, 0x12, 0x00, 0x31, 0xd7, 0x06, 0x08, 0xdb, 0x68, 0x51, 0x08, 0xe5, 0x06,
+    0x08, 0xe6, 0x09, 0x00, 0x30, 0xeb, 0x06, 0x08, 0xb3, 0xf7, 0x61, 0x00, 0x08, 0xed, 0x06, 0x08,
+    0xee, 0x09, 0x00, 0x03, 0x77, 0x66, 0x61, 0x00, 0x08, 0xf0, 0x06, 0x08, 0xf1, 0xc6, 0x00, 0x01,
+    0xaf, 0x61, 0x00, 0x09, 0x00, 0x01, 0xb2, 0x61, 0x00, 0x09, 0x00, 0x01, 0xb5, 0x61, 0x00, 0x09,
+    0x00, 0x04, 0xef, 0x38, 0x11, 0x06, 0xbb, 0x61, 0x00, 0x36, 0x00, 0x31, 0xf8, 0x06, 0x08, 0x49,
+    0x4f, 0x11, 0x06, 0xc7, 0x61, 0x00, 0x12, 0x00, 0x31, 0xfb, 0x06, 0x08, 0x6d, 0x52, 0x51, 0x08,
+    0xfd, 0x06, 0x08, 0xfe, 0x1b, 0x00, 0x01, 0xdc, 0x61, 0x00, 0x09, 0x00, 0x01, 0xdf, 0x61, 0x00,
+    0x1b, 0x00, 0x41, 0x01, 0x07, 0x08, 0x02, 0x59, 0x3a, 0x30, 0x03, 0x07, 0x08, 0x53, 0xf7, 0x51,
+    0x00, 0x08, 0x05, 0x07, 0x08, 0xf5, 0x40, 0x24, 0x06, 0x0d, 0x2d, 0x00, 0x14, 0x0e, 0x2d, 0x00,
+    0x41, 0x0d, 0x07, 0x08, 0x0e, 0x24, 0x00, 0x41, 0x1d, 0x07, 0x08, 0x1e, 0x09, 0x00, 0x31, 0x1f,
+    0x07, 0x08, 0xc8, 0x40, 0x42, 0x08, 0x21, 0x07, 0x08, 0xd3, 0x49, 0x03, 0xfa, 0xb8, 0x21, 0x00,
+    0x06, 0x3f, 0x3f, 0x00, 0x09, 0x00, 0x02, 0xa5, 0xad, 0x31, 0x00, 0x00, 0x06, 0x2a, 0x62, 0x00,
+    0x09, 0x00, 0x01, 0x2d, 0x62, 0x00, 0x36, 0x00, 0x41, 0x2b, 0x07, 0x08, 0x2c, 0x3f, 0x00, 0x31,
+    0x2d, 0x07, 0x08, 0x16, 0x41, 0x41, 0x08, 0x2f, 0x07, 0x08, 0xeb, 0x49, 0x24, 0x06, 0x17, 0x2d,
+    0x00, 0x14, 0x18, 0x2d, 0x00, 0x41, 0x33, 0x07, 0x08, 0x34, 0x24, 0x00, 0x41, 0x35, 0x07, 0x08,
+    0x36, 0x24, 0x00, 0x01, 0x6f, 0x62, 0x00, 0x09, 0x00, 0x01, 0x72, 0x62, 0x00, 0x1b, 0x00, 0x41,
+    0x39, 0x07, 0x08, 0x3a, 0x1b, 0x00, 0x01, 0x7e, 0x62, 0x00, 0x09, 0x00, 0x01, 0x81, 0x62, 0x00,
+    0x09, 0x00, 0x01, 0x84, 0x62, 0x00, 0x09, 0x00, 0x01, 0x87, 0x62, 0x02, 0x2f, 0x00, 0x20, 0xee,
+    0x03, 0x6c, 0xe5, 0x10, 0x21, 0x06, 0xda, 0x0f, 0x01, 0x00, 0x11, 0xf1, 0x5c, 0x8a, 0xb2, 0x02,
+    0x89, 0xb3, 0x02, 0x8a, 0x9e, 0x02, 0x89, 0x9f, 0x02, 0x8a, 0x6a, 0x02, 0x89, 0x6b, 0x02, 0x8a,
+    0x8a, 0x02, 0x89, 0x8b, 0x02, 0x8a, 0xc2, 0x02, 0x89, 0xc3, 0x02, 0x8a, 0xad, 0x02, 0x89, 0xae,
+    0x02, 0x8a, 0x6f, 0x02, 0x89, 0x70, 0x02, 0x8a, 0x8f, 0x02, 0x89, 0x90, 0x02, 0x8a, 0xbd, 0x02,
+    0x89, 0xbe, 0x02, 0x8a, 0xa8, 0x02, 0x89, 0xa9, 0x02, 0x8a, 0xb7, 0x02, 0x89, 0xb8, 0x02, 0x8a,
+    0xa3, 0x02, 0x89, 0xa4, 0x02, 0x8a, 0x77, 0x02, 0x89, 0x78, 0x02, 0x8a, 0x94, 0x02, 0x89, 0x95,
+    0x02, 0x8a, 0x7c, 0x02, 0x89, 0x7d, 0x02, 0x8a, 0x99, 0x02, 0x89, 0x9a, 0x02, 0x8a, 0xb0, 0x00,
+    0x89, 0xb1, 0x00, 0x8a, 0x7f, 0x02, 0x89, 0x80, 0x45, 0x38, 0x00, 0xe5, 0x17, 0x20, 0x32, 0x05,
+    0xe8, 0x17, 0x02, 0xf3, 0x09, 0x26, 0x81, 0x1e, 0x51, 0x54, 0x09, 0x46, 0x1e, 0x05, 0x2f, 0x17,
+    0x26, 0xf1, 0x03, 0x8c, 0x20, 0x70, 0xf5, 0x03, 0x09, 0x00, 0x00, 0x09, 0x01, 0xda, 0x3a, 0x33,
+    0x0c, 0x01, 0x00, 0xac, 0x53, 0x02, 0x89, 0x35, 0x44, 0xb7, 0x03, 0x09, 0x09, 0x70, 0x1e, 0x02,
+    0x7c, 0x1e, 0x20, 0x04, 0x00, 0x51, 0x34, 0x10, 0x02, 0xd5, 0x4e, 0x00, 0xa2, 0x37, 0x04, 0x1f,
+    0x50, 0x03, 0x43, 0x36, 0x02, 0xc0, 0x37, 0x02, 0xba, 0x51, 0x08, 0x78, 0x00, 0x02, 0x7b, 0x34,
+    0x02, 0x61, 0x36, 0x20, 0x12, 0x00, 0xea, 0x37, 0x02, 0x67, 0x36, 0x02, 0xa2, 0x00, 0x02, 0xdc,
+    0x1e, 0x02, 0xa5, 0x34, 0x10, 0x0a, 0xbc, 0x67, 0x03, 0x02, 0x38, 0x02, 0xc6, 0x00, 0x01, 0xe8,
+    0x1e, 0x03, 0x30, 0x1f, 0x01, 0xaf, 0x12, 0xf1, 0x01, 0x0c, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0c,
+    0x04, 0x00, 0x0c, 0x05, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0xbc, 0x13, 0xf1, 0x04, 0x0c, 0x08, 0x00,
+    0x0c, 0x09, 0x00, 0x0c, 0x0a, 0x00, 0x0c, 0x0b, 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0d, 0x00, 0x0c,
+    0x2d, 0x69, 0x96, 0x0c, 0x0f, 0x00, 0x09, 0x0a, 0x00, 0x09, 0x0b, 0x00, 0x03, 0x19, 0x82, 0xc7,
+    0x03, 0x0c, 0x10, 0x00, 0x0c, 0x11, 0x00, 0xa7, 0x23, 0xa0, 0x0c, 0x12, 0x00, 0x0c, 0x13, 0x00,
+    0x81, 0xcd, 0x03, 0x1b, 0x88, 0x39, 0x00, 0x93, 0x22, 0xf1, 0x0d, 0x0c, 0x15, 0x00, 0x81, 0xd1,
+    0x03, 0x09, 0x0e, 0x00, 0x09, 0x0f, 0x00, 0x0c, 0x16, 0x00, 0x0c, 0x17, 0x00, 0x0c, 0x18, 0x00,
+    0x0c, 0x19, 0x00, 0x0c, 0x1a, 0x00, 0x0c, 0x09, 0x51, 0xf1, 0xac, 0x0c, 0x1c, 0x00, 0x0c, 0x1d,
+    0x00, 0x0c, 0x1e, 0x00, 0x0c, 0x1f, 0x00, 0x0c, 0x20, 0x00, 0x0c, 0x21, 0x00, 0x0c, 0x22, 0x00,
+    0x0c, 0x23, 0x00, 0x0c, 0x24, 0x00, 0x0c, 0x26, 0x00, 0x0c, 0x27, 0x00, 0x0c, 0x28, 0x00, 0x0c,
+    0x29, 0x00, 0x0c, 0x2a, 0x00, 0x0c, 0x2b, 0x00, 0x0c, 0x2c, 0x00, 0x0c, 0x2d, 0x00, 0x0c, 0x2e,
+    0x00, 0x0c, 0x2f, 0x00, 0x0c, 0x30, 0x00, 0x0c, 0x31, 0x00, 0x0c, 0x32, 0x00, 0x0c, 0x33, 0x00,
+    0x0c, 0x34, 0x00, 0x0c, 0x35, 0x00, 0x0c, 0x36, 0x00, 0x0c, 0x37, 0x00, 0x0c, 0x38, 0x00, 0x0c,
+    0x39, 0x00, 0x0c, 0x3a, 0x00, 0x0c, 0x3b, 0x00, 0x0c, 0x3c, 0x00, 0x0c, 0x3d, 0x00, 0x0c, 0x3e,
+    0x00, 0x0c, 0x3f, 0x00, 0x0c, 0x40, 0x00, 0x0c, 0x41, 0x00, 0x0c, 0x42, 0x00, 0x0c, 0x43, 0x00,
+    0x0c, 0x44, 0x00, 0x0c, 0x45, 0x00, 0x0c, 0x46, 0x00, 0x0c, 0x47, 0x00, 0x0c, 0x48, 0x00, 0x0c,
+    0x49, 0x00, 0x0c, 0x4a, 0x00, 0x0c, 0x4b, 0x00, 0x0c, 0x4c, 0x00, 0x0c, 0x4d, 0x00, 0x0c, 0x4e,
+    0x00, 0x0c, 0x4f, 0x00, 0x0c, 0x50, 0x00, 0x0c, 0x51, 0x00, 0x0c, 0x52, 0x00, 0x0c, 0x53, 0x00,
+    0x0c, 0x54, 0x00, 0x0c, 0x55, 0x00, 0x0c, 0x56, 0x00, 0x0c, 0x57, 0x00, 0x0c, 0x58, 0x00, 0x0c,
+    0x59, 0x00, 0x0c, 0x5a, 0x00, 0x0c, 0x1b, 0xbd, 0xf1, 0x5e, 0x0c, 0x5c, 0x00, 0x0c, 0x5d, 0x00,
+    0x0c, 0x5e, 0x00, 0x0c, 0x5f, 0x00, 0x0c, 0x60, 0x00, 0x0c, 0x61, 0x00, 0x0c, 0x62, 0x00, 0x0c,
+    0x63, 0x00, 0x0c, 0x64, 0x00, 0x0c, 0x65, 0x00, 0x0c, 0x66, 0x00, 0x0c, 0x67, 0x00, 0x0c, 0x68,
+    0x00, 0x0c, 0x69, 0x00, 0x0c, 0x6a, 0x00, 0x0c, 0x6b, 0x00, 0x0c, 0x6c, 0x00, 0x0c, 0x6d, 0x00,
+    0x0c, 0x6e, 0x00, 0x0c, 0x6f, 0x00, 0x0c, 0x70, 0x00, 0x0c, 0x71, 0x00, 0x0c, 0x72, 0x00, 0x0c,
+    0x73, 0x00, 0x0c, 0x74, 0x00, 0x0c, 0x75, 0x00, 0x0c, 0x76, 0x00, 0x0c, 0x77, 0x00, 0x0c, 0x78,
+    0x00, 0x0c, 0x79, 0x00, 0x0c, 0x7a, 0x00, 0x0c, 0x7b, 0x00, 0x0c, 0x7c, 0x00, 0x0c, 0x7d, 0x00,
+    0x0c, 0x7e, 0x00, 0x0c, 0x7f, 0x00, 0x0c, 0xf5, 0x42, 0x11, 0x0c, 0x1a, 0x15, 0x21, 0x0c, 0x82,
+    0x06, 0x00, 0xf0, 0x08, 0x83, 0x00, 0x0c, 0x84, 0x00, 0x0c, 0x85, 0x00, 0x0c, 0x86, 0x00, 0x0c,
+    0x87, 0x00, 0x0c, 0x88, 0x00, 0x0c, 0x89, 0x00, 0x0c, 0x8a, 0x00, 0x8e, 0x34, 0xf1, 0x00, 0x8c,
+    0x00, 0x0c, 0x8d, 0x00, 0x0c, 0x8e, 0x00, 0x0c, 0x8f, 0x00, 0x0c, 0x90, 0x00, 0x0c, 0xf7, 0x3c,
+    0xf1, 0x1a, 0x0c, 0x92, 0x00, 0x0c, 0x93, 0x00, 0x0c, 0x94, 0x00, 0x0c, 0x95, 0x00, 0x0c, 0x96,
+    0x00, 0x0c, 0x97, 0x00, 0x0c, 0x98, 0x00, 0x0c, 0x99, 0x00, 0x0c, 0x9a, 0x00, 0x0c, 0x9b, 0x00,
+    0x0c, 0x9c, 0x00, 0x0c, 0x9d, 0x00, 0x0b, 0x00, 0x00, 0x0c, 0x9f, 0xa2, 0xd5, 0x91, 0x00, 0x00,
+    0x0c, 0xa1, 0x00, 0x0c, 0xa2, 0x00, 0x0c, 0xa6, 0x4d, 0x11, 0x0c, 0x94, 0x4d, 0x41, 0x0c, 0xa5,
+    0x00, 0x0c, 0x7c, 0x68, 0x11, 0x0c, 0x46, 0x56, 0x00, 0x09, 0x00, 0xf1, 0x96, 0xa8, 0x00, 0x0c,
+    0xa9, 0x00, 0x0c, 0xaa, 0x00, 0x0c, 0xab, 0x00, 0x0c, 0xac, 0x00, 0x0c, 0xad, 0x00, 0x0c, 0xae,
+    0x00, 0x0c, 0xaf, 0x00, 0x0c, 0xb0, 0x00, 0x0c, 0xb1, 0x00, 0x0c, 0xb2, 0x00, 0x0c, 0xb3, 0x00,
+    0x0c, 0xb4, 0x00, 0x0c, 0xb5, 0x00, 0x0c, 0xb6, 0x00, 0x0c, 0xb7, 0x00, 0x0c, 0xb8, 0x00, 0x0c,
+    0xb9, 0x00, 0x0c, 0xba, 0x00, 0x0c, 0xbb, 0x00, 0x0c, 0xbc, 0x00, 0x0c, 0xbd, 0x00, 0x0c, 0xbe,
+    0x00, 0x0c, 0xbf, 0x00, 0x0c, 0xc0, 0x00, 0x0c, 0xc1, 0x00, 0x0c, 0xc2, 0x00, 0x0c, 0xc3, 0x00,
+    0x0c, 0xc4, 0x00, 0x0c, 0xc5, 0x00, 0x0c, 0xc6, 0x00, 0x0c, 0xc7, 0x00, 0x0c, 0xc8, 0x00, 0x0c,
+    0xc9, 0x00, 0x0c, 0xca, 0x00, 0x0c, 0xcb, 0x00, 0x0c, 0xcc, 0x00, 0x0c, 0xcd, 0x00, 0x0c, 0xce,
+    0x00, 0x0c, 0xcf, 0x00, 0x0c, 0xd0, 0x00, 0x0c, 0xd1, 0x00, 0x0c, 0xd2, 0x00, 0x0c, 0xd3, 0x00,
+    0x0c, 0xd4, 0x00, 0x0c, 0xd5, 0x00, 0x0c, 0xd6, 0x00, 0x0c, 0xd7, 0x00, 0x0c, 0xd8, 0x00, 0x0c,
+    0xd9, 0x00, 0x0c, 0xda, 0x00, 0x0c, 0xdb, 0x00, 0x0c, 0xdc, 0x00, 0x0c, 0xdd, 0x00, 0x0c, 0xde,
+    0x00, 0x0c, 0x37, 0x12, 0x03, 0xb4, 0x16, 0x20, 0xd7, 0x00, 0xa7, 0x17, 0x20, 0xc7, 0x00, 0x64,
+    0x39, 0x02, 0xe1, 0x3a, 0x20, 0xe5, 0x00, 0xed, 0x1c, 0x44, 0xdd, 0x00, 0x81, 0xde, 0x76, 0x39,
+    0x20, 0xd1, 0x00, 0x99, 0x16, 0x01, 0xd8, 0x16, 0x03, 0xcb, 0x17, 0x02, 0xea, 0x16, 0x02, 0xdd,
+    0x17, 0x20, 0xcb, 0x00, 0x2c, 0x3b, 0x02, 0xb7, 0x16, 0x02, 0x32, 0x3b, 0x01, 0xbd, 0x16, 0x21,
+    0x0c, 0xe0, 0x11, 0x01, 0xf1, 0xb1, 0xe1, 0x00, 0x0c, 0xe2, 0x00, 0x0c, 0xe3, 0x00, 0x0c, 0xe4,
+    0x00, 0x0c, 0xe5, 0x00, 0x0c, 0xe6, 0x00, 0x0c, 0xe7, 0x00, 0x0c, 0xe8, 0x00, 0x0c, 0xe9, 0x00,
+    0x0c, 0xea, 0x00, 0x0c, 0xeb, 0x00, 0x0c, 0xec, 0x00, 0x0c, 0xed, 0x00, 0x0c, 0xee, 0x00, 0x0c,
+    0xef, 0x00, 0x0c, 0xf0, 0x00, 0x0c, 0xf1, 0x00, 0x0c, 0xf2, 0x00, 0x0c, 0xf3, 0x00, 0x0c, 0xf4,
+    0x00, 0x0c, 0xf5, 0x00, 0x0c, 0xf6, 0x00, 0x0c, 0xf7, 0x00, 0x0c, 0xf8, 0x00, 0x0c, 0xf9, 0x00,
+    0x0c, 0xfa, 0x00, 0x0c, 0xfb, 0x00, 0x0c, 0xfc, 0x00, 0x0c, 0xfd, 0x00, 0x0c, 0xfe, 0x00, 0x0c,
+    0xff, 0x00, 0x0c, 0x00, 0x01, 0x0c, 0x01, 0x01, 0x0c, 0x02, 0x01, 0x0c, 0x03, 0x01, 0x0c, 0x04,
+    0x01, 0x0c, 0x05, 0x01, 0x0c, 0x06, 0x01, 0x0c, 0x07, 0x01, 0x0c, 0x08, 0x01, 0x0c, 0x09, 0x01,
+    0x0c, 0x0a, 0x01, 0x0c, 0x0b, 0x01, 0x0c, 0x0c, 0x01, 0x0c, 0x0d, 0x01, 0x0c, 0x0e, 0x01, 0x0c,
+    0x0f, 0x01, 0x0c, 0x10, 0x01, 0x0c, 0x11, 0x01, 0x0c, 0x12, 0x01, 0x0c, 0x13, 0x01, 0x0c, 0x14,
+    0x01, 0x0c, 0x15, 0x01, 0x0c, 0x16, 0x01, 0x0c, 0x17, 0x01, 0x0c, 0x18, 0x01, 0x0c, 0x19, 0x01,
+    0x0c, 0x1a, 0x01, 0x0c, 0x1b, 0x01, 0x0c, 0x1c, 0x01, 0x0c, 0x1d, 0x01, 0x0c, 0x1e, 0x01, 0x0c,
+    0x1f, 0x01, 0x0c, 0x20, 0x01, 0x0c, 0x22, 0x68, 0x11, 0x0c, 0x22, 0x68, 0x11, 0x0c, 0x22, 0x68,
+    0xf3, 0x27, 0x0c, 0x24, 0x01, 0x0c, 0x25, 0x01, 0x0c, 0x26, 0x01, 0x0c, 0x27, 0x01, 0x0c, 0x28,
+    0x01, 0x0c, 0x29, 0x01, 0x0c, 0x2b, 0x01, 0x0c, 0x2c, 0x01, 0x0c, 0x2d, 0x01, 0x0c, 0x2e, 0x01,
+    0x0c, 0x2f, 0x01, 0x0c, 0x30, 0x01, 0x0c, 0x31, 0x01, 0x0c, 0x32, 0x01, 0x0c, 0x33, 0x01, 0x0c,
+    0x34, 0x01, 0x0c, 0x35, 0x01, 0x0c, 0x36, 0x01, 0x31, 0x1b, 0x02, 0xb2, 0x1b, 0x02, 0x37, 0x18,
+    0x20, 0x6e, 0x06, 0x61, 0x1b, 0x02, 0xa3, 0x18, 0x02, 0x5e, 0x1b, 0x20, 0x68, 0x06, 0xdf, 0x1b,
+    0x02, 0x73, 0x1b, 0x02, 0xcd, 0x18, 0x11, 0x7a, 0x7c, 0x1b, 0x11, 0x80, 0xdf, 0x18, 0x02, 0xdf,
+    0x1b, 0x02, 0xfd, 0x1b, 0x02, 0x88, 0x1b, 0x02, 0xfa, 0x1b, 0x11, 0x74, 0x0c, 0x1c, 0xd0, 0x9f,
+    0x00, 0x81, 0xa0, 0x00, 0x8b, 0xb0, 0x06, 0x8b, 0xb1, 0x06, 0x81, 0xb2, 0x4b, 0x1c, 0x11, 0x0c,
+    0x6a, 0x68, 0x01, 0x7b, 0x3f, 0x03, 0xcc, 0x6c, 0xf3, 0x03, 0x8b, 0xc0, 0x06, 0x8b, 0xc1, 0x06,
+    0x81, 0xc2, 0x06, 0x81, 0xc3, 0x06, 0x0c, 0x39, 0x01, 0x0c, 0x3a, 0x01, 0x57, 0x1c, 0x02, 0xbe,
+    0x1e, 0x31, 0x0f, 0x01, 0x81, 0x69, 0x69, 0x50, 0x81, 0xeb, 0x02, 0x81, 0xa7, 0x2d, 0x6c, 0x00,
+    0x0c, 0x00, 0x05, 0x6e, 0x3e, 0x05, 0xed, 0x1c, 0x82, 0x9f, 0x03, 0x0c, 0x3b, 0x01, 0x0c, 0x3c,
+    0x01, 0xc4, 0x30, 0xf3, 0x09, 0x09, 0x23, 0x00, 0x09, 0x24, 0x00, 0x81, 0xa5, 0x00, 0x81, 0xa6,
+    0x00, 0x0c, 0x3d, 0x01, 0x0c, 0x3e, 0x01, 0x0c, 0x3f, 0x01, 0x0c, 0x40, 0x01, 0x04, 0x62, 0x20,
+    0x90, 0x03, 0x5c, 0x61, 0x07, 0xa3, 0x33, 0x41, 0x0c, 0x41, 0x01, 0x0c, 0x3d, 0x18, 0xa1, 0x0c,
+    0x43, 0x01, 0x0c, 0x44, 0x01, 0x0c, 0x45, 0x01, 0x0c, 0xca, 0x68, 0xf1, 0x28, 0x0c, 0x47, 0x01,
+    0x0c, 0x48, 0x01, 0x0b, 0x03, 0x00, 0x0c, 0x4a, 0x01, 0x0c, 0x4b, 0x01, 0x0c, 0x4c, 0x01, 0x0c,
+    0x4d, 0x01, 0x0c, 0x4e, 0x01, 0x0c, 0x4f, 0x01, 0x0c, 0x50, 0x01, 0x0c, 0x51, 0x01, 0x0c, 0x52,
+    0x01, 0x0c, 0x53, 0x01, 0x0c, 0x54, 0x01, 0x0c, 0x55, 0x01, 0x0c, 0x56, 0x01, 0x0c, 0x57, 0x01,
+    0x0c, 0x58, 0x01, 0x0c, 0xff, 0x46, 0xf1, 0x49, 0x0c, 0x5a, 0x01, 0x0c, 0x5b, 0x01, 0x0c, 0x5c,
+    0x01, 0x0c, 0x5d, 0x01, 0x0c, 0x5e, 0x01, 0x0c, 0x5f, 0x01, 0x0c, 0x60, 0x01, 0x0c, 0x61, 0x01,
+    0x0c, 0x62, 0x01, 0x0c, 0x63, 0x01, 0x0c, 0x64, 0x01, 0x0c, 0x65, 0x01, 0x0c, 0x66, 0x01, 0x0c,
+    0x67, 0x01, 0x0c, 0x68, 0x01, 0x0c, 0x69, 0x01, 0x0c, 0x6a, 0x01, 0x0c, 0x6b, 0x01, 0x0c, 0x6c,
+    0x01, 0x0c, 0x6d, 0x01, 0x0c, 0x6e, 0x01, 0x0c, 0x6f, 0x01, 0x0c, 0x70, 0x01, 0x0c, 0x71, 0x01,
+    0x0c, 0x72, 0x01, 0x0c, 0x73, 0x01, 0x0c, 0x74, 0x01, 0x0c, 0x75, 0x01, 0x0c, 0x76, 0x01, 0x0c,
+    0x7f, 0x68, 0xf1, 0x22, 0x0c, 0x78, 0x01, 0x0c, 0x79, 0x01, 0x0c, 0x7a, 0x01, 0x0c, 0x7b, 0x01,
+    0x0c, 0x7c, 0x01, 0x0c, 0x7d, 0x01, 0x0c, 0x7e, 0x01, 0x0c, 0x7f, 0x01, 0x0c, 0x80, 0x01, 0x0c,
+    0x81, 0x01, 0x0c, 0x82, 0x01, 0x0c, 0x83, 0x01, 0x0c, 0x84, 0x01, 0x0c, 0x85, 0x01, 0x0c, 0x86,
+    0x01, 0x0c, 0x87, 0x01, 0x0c, 0x5b, 0x68, 0x60, 0x0c, 0x89, 0x01, 0x0c, 0x8a, 0x01, 0x05, 0x39,
+    0xf1, 0x0f, 0x8c, 0x01, 0x0c, 0x8d, 0x01, 0x0c, 0x8e, 0x01, 0x0c, 0x8f, 0x01, 0x0c, 0x90, 0x01,
+    0x0c, 0x91, 0x01, 0x0c, 0x92, 0x01, 0x0c, 0x93, 0x01, 0x0c, 0x94, 0x01, 0x0c, 0x95, 0x01, 0x0c,
+    0x34, 0x68, 0xf3, 0x1b, 0x0c, 0x97, 0x01, 0x0c, 0x98, 0x01, 0x0c, 0x99, 0x01, 0x0c, 0x9a, 0x01,
+    0x0c, 0x9b, 0x01, 0x0c, 0x9c, 0x01, 0x0c, 0x9d, 0x01, 0x0c, 0x9e, 0x01, 0x0c, 0x9f, 0x01, 0x0c,
+    0xa0, 0x01, 0x0c, 0xa1, 0x01, 0x0c, 0xa2, 0x01, 0x0c, 0xa3, 0x01, 0x0c, 0xa4, 0x01, 0x3e, 0x32,
+    0x05, 0x71, 0x3b, 0x14, 0x0b, 0x20, 0x07, 0x02, 0x02, 0x07, 0x02, 0x0a, 0x1b, 0x05, 0xd6, 0x39,
+    0x06, 0xcd, 0x39, 0x07, 0xec, 0x3b, 0x08, 0x55, 0x3f, 0x5f, 0xec, 0x06, 0x81, 0xed, 0x06, 0x0d,
+    0x3f, 0x00, 0x0e, 0x42, 0x34, 0x5c, 0x77, 0x07, 0x81, 0x78, 0x07, 0x01, 0x21, 0x22, 0xec, 0x00,
+    0xe0, 0x3b, 0x00, 0xd4, 0x08, 0xf1, 0x03, 0x72, 0x00, 0x10, 0x33, 0x00, 0x10, 0x34, 0x00, 0x10,
+    0x35, 0x00, 0x10, 0x36, 0x00, 0x10, 0x37, 0x00, 0x10, 0x8b, 0x74, 0xf1, 0x05, 0x10, 0x39, 0x00,
+    0x10, 0x3a, 0x00, 0x10, 0x3b, 0x00, 0x10, 0x3c, 0x00, 0x10, 0x3d, 0x00, 0x10, 0x3e, 0x00, 0x10,
+    0x3f, 0x18, 0x00, 0xc1, 0x40, 0x00, 0x10, 0x41, 0x00, 0x10, 0x42, 0x00, 0x10, 0x43, 0x00, 0x10,
+    0xce, 0x4c, 0xf1, 0xff, 0x0d, 0x10, 0x45, 0x00, 0x10, 0x46, 0x00, 0x10, 0x47, 0x00, 0x10, 0x48,
+    0x00, 0x10, 0x49, 0x00, 0x10, 0x4a, 0x00, 0x10, 0x4b, 0x00, 0x10, 0x4c, 0x00, 0x10, 0x4d, 0x00,
+    0x10, 0x4e, 0x00, 0x10, 0x4f, 0x00, 0x10, 0x50, 0x00, 0x10, 0x51, 0x00, 0x10, 0x52, 0x00, 0x10,
+    0x53, 0x00, 0x10, 0x54, 0x00, 0x10, 0x55, 0x00, 0x10, 0x56, 0x00, 0x10, 0x57, 0x00, 0x10, 0x58,
+    0x00, 0x10, 0x59, 0x00, 0x10, 0x5a, 0x00, 0x10, 0x5b, 0x00, 0x10, 0x5c, 0x00, 0x10, 0x5d, 0x00,
+    0x10, 0x5e, 0x00, 0x10, 0x5f, 0x00, 0x10, 0x60, 0x00, 0x10, 0x61, 0x00, 0x10, 0x62, 0x00, 0x10,
+    0x63, 0x00, 0x10, 0x64, 0x00, 0x10, 0x65, 0x00, 0x10, 0x66, 0x00, 0x10, 0x67, 0x00, 0x10, 0x68,
+    0x00, 0x10, 0x69, 0x00, 0x10, 0x6a, 0x00, 0x10, 0x6b, 0x00, 0x10, 0x6c, 0x00, 0x10, 0x6d, 0x00,
+    0x10, 0x6e, 0x00, 0x10, 0x6f, 0x00, 0x10, 0x70, 0x00, 0x10, 0x71, 0x00, 0x10, 0x72, 0x00, 0x10,
+    0x73, 0x00, 0x10, 0x74, 0x00, 0x10, 0x75, 0x00, 0x10, 0x76, 0x00, 0x10, 0x77, 0x00, 0x10, 0x78,
+    0x00, 0x10, 0x79, 0x00, 0x10, 0x7a, 0x00, 0x10, 0x7b, 0x00, 0x10, 0x7c, 0x00, 0x10, 0x7d, 0x00,
+    0x10, 0x7e, 0x00, 0x10, 0x7f, 0x00, 0x10, 0x80, 0x00, 0x10, 0x81, 0x00, 0x10, 0x82, 0x00, 0x10,
+    0x83, 0x00, 0x10, 0x84, 0x00, 0x10, 0x85, 0x00, 0x10, 0x86, 0x00, 0x10, 0x87, 0x00, 0x10, 0x88,
+    0x00, 0x10, 0x89, 0x00, 0x10, 0x8a, 0x00, 0x10, 0x8b, 0x00, 0x10, 0x8c, 0x00, 0x10, 0x8d, 0x00,
+    0x10, 0x8e, 0x00, 0x10, 0x8f, 0x00, 0x10, 0x90, 0x00, 0x10, 0x91, 0x00, 0x10, 0x92, 0x00, 0x10,
+    0x93, 0x00, 0x10, 0x94, 0x00, 0x10, 0x95, 0x00, 0x10, 0x96, 0x00, 0x10, 0x97, 0x00, 0x10, 0x98,
+    0x00, 0x10, 0x99, 0x00, 0x10, 0x9a, 0x00, 0x10, 0x9b, 0x00, 0x10, 0x9c, 0x00, 0x10, 0x9d, 0x00,
+    0x10, 0x9e, 0x00, 0x10, 0x9f, 0x00, 0x10, 0xa0, 0x00, 0x10, 0xa1, 0x00, 0x10, 0xa2, 0x00, 0x10,
+    0x72, 0x06, 0x11, 0x10, 0x72, 0x06, 0xd1, 0x10, 0xa5, 0x00, 0x10, 0xa6, 0x00, 0x10, 0xa7, 0x00,
+    0x10, 0xa8, 0x00, 0x10, 0xeb, 0x6e, 0x11, 0x10, 0xeb, 0x6e, 0xd1, 0x10, 0xab, 0x00, 0x10, 0xac,
+    0x00, 0x10, 0xad, 0x00, 0x10, 0xae, 0x00, 0x10, 0xdf, 0x6e, 0xf1, 0xff, 0x0a, 0x10, 0xb0, 0x00,
+    0x10, 0xb1, 0x00, 0x10, 0xb2, 0x00, 0x10, 0xb3, 0x00, 0x10, 0xb4, 0x00, 0x10, 0xb5, 0x00, 0x10,
+    0xb6, 0x00, 0x10, 0xb7, 0x00, 0x10, 0xb8, 0x00, 0x10, 0xb9, 0x00, 0x10, 0xba, 0x00, 0x10, 0xbb,
+    0x00, 0x10, 0xbc, 0x00, 0x10, 0xbd, 0x00, 0x10, 0xbe, 0x00, 0x10, 0xbf, 0x00, 0x10, 0xc0, 0x00,
+    0x10, 0xc1, 0x00, 0x10, 0xc2, 0x00, 0x10, 0xc3, 0x00, 0x10, 0xc4, 0x00, 0x10, 0xc5, 0x00, 0x10,
+    0xc6, 0x00, 0x10, 0xc7, 0x00, 0x10, 0xc8, 0x00, 0x10, 0xc9, 0x00, 0x10, 0xca, 0x00, 0x10, 0xcb,
+    0x00, 0x10, 0xcc, 0x00, 0x10, 0xcd, 0x00, 0x10, 0xce, 0x00, 0x12, 0x6c, 0x00, 0x12, 0x6d, 0x00,
+    0x12, 0x6e, 0x00, 0x12, 0x6f, 0x00, 0x10, 0xcf, 0x00, 0x10, 0xd0, 0x00, 0x12, 0x71, 0x00, 0x12,
+    0x72, 0x00, 0x12, 0x73, 0x00, 0x12, 0x74, 0x00, 0x12, 0x75, 0x00, 0x12, 0x76, 0x00, 0x10, 0xd1,
+    0x00, 0x10, 0xd2, 0x00, 0x12, 0x78, 0x00, 0x12, 0x79, 0x00, 0x12, 0x7a, 0x00, 0x12, 0x7b, 0x00,
+    0x12, 0x7c, 0x00, 0x12, 0x7d, 0x00, 0x10, 0xd3, 0x00, 0x10, 0xd4, 0x00, 0x10, 0xd5, 0x00, 0x10,
+    0xd6, 0x00, 0x10, 0xd7, 0x00, 0x10, 0xd8, 0x00, 0x10, 0xd9, 0x00, 0x10, 0xda, 0x00, 0x10, 0xdb,
+    0x00, 0x10, 0xdc, 0x00, 0x10, 0xdd, 0x00, 0x10, 0xde, 0x00, 0x10, 0xdf, 0x00, 0x10, 0xe0, 0x00,
+    0x09, 0x2b, 0x00, 0x09, 0x2c, 0x00, 0x09, 0x2d, 0x00, 0x09, 0x2e, 0x00, 0x09, 0x2f, 0x00, 0x09,
+    0x30, 0x00, 0x12, 0xa1, 0x00, 0x12, 0xa2, 0x00, 0x12, 0xa3, 0x00, 0x12, 0xa4, 0x00, 0x10, 0xef,
+    0x00, 0x10, 0xf0, 0x00, 0x10, 0xf1, 0x00, 0x10, 0xf2, 0x00, 0x10, 0xf3, 0x00, 0x10, 0xf4, 0x00,
+    0x10, 0xf5, 0x00, 0x10, 0xf6, 0x00, 0x10, 0xf7, 0x00, 0x10, 0xf8, 0x00, 0x10, 0xf9, 0x00, 0x10,
+    0xfa, 0x00, 0x10, 0xfb, 0x00, 0x10, 0xfc, 0x00, 0x10, 0xfd, 0x00, 0x10, 0xfe, 0x00, 0x12, 0xb9,
+    0x00, 0x12, 0xba, 0x00, 0x12, 0xba, 0x6f, 0xf0, 0x06, 0x10, 0xff, 0x00, 0x10, 0x00, 0x01, 0x12,
+    0xbd, 0x00, 0x12, 0xbe, 0x00, 0x10, 0x01, 0x01, 0x10, 0x02, 0x01, 0x10, 0x03, 0x01, 0x89, 0x74,
+    0xf1, 0x5a, 0x05, 0x01, 0x10, 0x06, 0x01, 0x12, 0xc4, 0x00, 0x12, 0xc5, 0x00, 0x10, 0x07, 0x01,
+    0x10, 0x08, 0x01, 0x12, 0xc8, 0x00, 0x12, 0xc9, 0x00, 0x12, 0xca, 0x00, 0x12, 0xcb, 0x00, 0x12,
+    0xcc, 0x00, 0x12, 0xcd, 0x00, 0x10, 0x09, 0x01, 0x10, 0x0a, 0x01, 0x12, 0xd0, 0x00, 0x12, 0xd1,
+    0x00, 0x12, 0xd2, 0x00, 0x12, 0xd3, 0x00, 0x12, 0xd4, 0x00, 0x12, 0xd5, 0x00, 0x10, 0x0b, 0x01,
+    0x10, 0x0c, 0x01, 0x12, 0xd8, 0x00, 0x12, 0xd9, 0x00, 0x12, 0xda, 0x00, 0x12, 0xdb, 0x00, 0x10,
+    0x0d, 0x01, 0x10, 0x0e, 0x01, 0x12, 0xe0, 0x00, 0x12, 0xe1, 0x00, 0x12, 0xe2, 0x00, 0x12, 0xe3,
+    0x00, 0x12, 0xe4, 0x00, 0x12, 0xe5, 0x00, 0x10, 0x0f, 0x01, 0x10, 0x6a, 0x05, 0xf1, 0xc4, 0x10,
+    0x11, 0x01, 0x12, 0xe8, 0x00, 0x12, 0xe9, 0x00, 0x12, 0xea, 0x00, 0x12, 0xeb, 0x00, 0x12, 0xec,
+    0x00, 0x12, 0xed, 0x00, 0x10, 0x12, 0x01, 0x10, 0x13, 0x01, 0x12, 0xf0, 0x00, 0x12, 0xf1, 0x00,
+    0x12, 0xf2, 0x00, 0x12, 0xf3, 0x00, 0x12, 0xf4, 0x00, 0x12, 0xf5, 0x00, 0x10, 0x14, 0x01, 0x10,
+    0x15, 0x01, 0x12, 0xf8, 0x00, 0x12, 0xf9, 0x00, 0x10, 0x16, 0x01, 0x10, 0x17, 0x01, 0x10, 0x18,
+    0x01, 0x10, 0x19, 0x01, 0x10, 0x1a, 0x01, 0x10, 0x1b, 0x01, 0x12, 0xff, 0x00, 0x12, 0x00, 0x01,
+    0x12, 0x01, 0x01, 0x12, 0x02, 0x01, 0x12, 0x03, 0x01, 0x12, 0x04, 0x01, 0x12, 0x05, 0x01, 0x12,
+    0x06, 0x01, 0x10, 0x1c, 0x01, 0x10, 0x1d, 0x01, 0x10, 0x1e, 0x01, 0x10, 0x1f, 0x01, 0x12, 0x09,
+    0x01, 0x12, 0x0a, 0x01, 0x12, 0x0b, 0x01, 0x12, 0x0c, 0x01, 0x10, 0x20, 0x01, 0x10, 0x21, 0x01,
+    0x12, 0x0e, 0x01, 0x12, 0x0f, 0x01, 0x12, 0x10, 0x01, 0x12, 0x11, 0x01, 0x12, 0x12, 0x01, 0x12,
+    0x13, 0x01, 0x10, 0x22, 0x01, 0x10, 0x23, 0x01, 0x10, 0x24, 0x01, 0x10, 0x25, 0x01, 0x10, 0x26,
+    0x01, 0x10, 0x27, 0x01, 0x10, 0x28, 0x01, 0x10, 0x29, 0x01, 0x10, 0x2a, 0x01, 0x10, 0x2b, 0x01,
+    0x10, 0x2c, 0x01, 0x10, 0x2d, 0x01, 0x10, 0x2e, 0x01, 0x10, 0x2f, 0x01, 0x10, 0x30, 0x01, 0x10,
+    0x31, 0x01, 0x10, 0x32, 0x01, 0x10, 0x33, 0x01, 0x10, 0x34, 0x01, 0x10, 0x35, 0x01, 0x10, 0x36,
+    0x01, 0x10, 0x75, 0x06, 0x11, 0x10, 0xdf, 0x6e, 0xf0, 0x16, 0x10, 0x39, 0x01, 0x12, 0x2e, 0x01,
+    0x12, 0x2f, 0x01, 0x12, 0x30, 0x01, 0x12, 0x31, 0x01, 0x10, 0x3a, 0x01, 0x10, 0x3b, 0x01, 0x10,
+    0x3c, 0x01, 0x10, 0x3d, 0x01, 0x12, 0x34, 0x01, 0x12, 0x35, 0x01, 0x12, 0x36, 0x01, 0x12, 0x71,
+    0xc1, 0xf1, 0x1d, 0x01, 0x12, 0x39, 0x01, 0x12, 0x3a, 0x01, 0x12, 0x3b, 0x01, 0x12, 0x3c, 0x01,
+    0x12, 0x3d, 0x01, 0x10, 0x3e, 0x01, 0x10, 0x3f, 0x01, 0x10, 0x40, 0x01, 0x10, 0x41, 0x01, 0x10,
+    0x42, 0x01, 0x10, 0x43, 0x01, 0x10, 0x44, 0x01, 0x10, 0x45, 0x01, 0x10, 0x46, 0x01, 0x10, 0xf1,
+    0x6e, 0xf1, 0xd6, 0x10, 0x48, 0x01, 0x10, 0x49, 0x01, 0x10, 0x4a, 0x01, 0x10, 0x4b, 0x01, 0x10,
+    0x4c, 0x01, 0x10, 0x4d, 0x01, 0x10, 0x4e, 0x01, 0x12, 0x50, 0x01, 0x12, 0x51, 0x01, 0x12, 0x52,
+    0x01, 0x12, 0x53, 0x01, 0x12, 0x54, 0x01, 0x12, 0x55, 0x01, 0x12, 0x56, 0x01, 0x12, 0x57, 0x01,
+    0x12, 0x58, 0x01, 0x12, 0x59, 0x01, 0x10, 0x4f, 0x01, 0x10, 0x50, 0x01, 0x10, 0x51, 0x01, 0x10,
+    0x52, 0x01, 0x10, 0x53, 0x01, 0x10, 0x54, 0x01, 0x12, 0x5f, 0x01, 0x12, 0x60, 0x01, 0x10, 0x55,
+    0x01, 0x10, 0x56, 0x01, 0x12, 0x63, 0x01, 0x12, 0x64, 0x01, 0x10, 0x57, 0x01, 0x10, 0x58, 0x01,
+    0x12, 0x67, 0x01, 0x12, 0x68, 0x01, 0x10, 0x59, 0x01, 0x10, 0x5a, 0x01, 0x12, 0x6b, 0x01, 0x12,
+    0x6c, 0x01, 0x10, 0x5b, 0x01, 0x10, 0x5c, 0x01, 0x10, 0x5d, 0x01, 0x10, 0x5e, 0x01, 0x10, 0x5f,
+    0x01, 0x10, 0x60, 0x01, 0x10, 0x61, 0x01, 0x10, 0x62, 0x01, 0x10, 0x63, 0x01, 0x10, 0x64, 0x01,
+    0x10, 0x65, 0x01, 0x10, 0x66, 0x01, 0x10, 0x67, 0x01, 0x10, 0x68, 0x01, 0x10, 0x69, 0x01, 0x10,
+    0x6a, 0x01, 0x10, 0x6b, 0x01, 0x10, 0x6c, 0x01, 0x10, 0x6d, 0x01, 0x10, 0x6e, 0x01, 0x10, 0x6f,
+    0x01, 0x10, 0x70, 0x01, 0x10, 0x71, 0x01, 0x10, 0x72, 0x01, 0x10, 0x73, 0x01, 0x10, 0x74, 0x01,
+    0x10, 0x75, 0x01, 0x10, 0x76, 0x01, 0x10, 0x77, 0x01, 0x10, 0x78, 0x01, 0x10, 0x79, 0x01, 0x10,
+    0x7a, 0x01, 0x10, 0x7b, 0x01, 0x10, 0x7c, 0x01, 0x10, 0x7d, 0x01, 0x10, 0x7e, 0x01, 0x10, 0x7f,
+    0x01, 0x10, 0x80, 0x01, 0x10, 0x81, 0x01, 0x10, 0xbb, 0x6e, 0x11, 0x10, 0x43, 0x49, 0xf1, 0x49,
+    0x10, 0x84, 0x01, 0x10, 0x85, 0x01, 0x10, 0x86, 0x01, 0x10, 0x87, 0x01, 0x10, 0x88, 0x01, 0x10,
+    0x89, 0x01, 0x10, 0x8a, 0x01, 0x10, 0x8b, 0x01, 0x10, 0x8c, 0x01, 0x10, 0x8d, 0x01, 0x10, 0x8e,
+    0x01, 0x10, 0x8f, 0x01, 0x10, 0x90, 0x01, 0x10, 0x91, 0x01, 0x10, 0x92, 0x01, 0x10, 0x93, 0x01,
+    0x10, 0x94, 0x01, 0x10, 0x95, 0x01, 0x10, 0x96, 0x01, 0x10, 0x97, 0x01, 0x10, 0x98, 0x01, 0x10,
+    0x99, 0x01, 0x10, 0x9a, 0x01, 0x10, 0x9b, 0x01, 0x10, 0x9c, 0x01, 0x10, 0x9d, 0x01, 0x10, 0x9e,
+    0x01, 0x10, 0x9f, 0x01, 0x10, 0xa0, 0x01, 0x10, 0xd0, 0x5c, 0x21, 0x10, 0xa2, 0x06, 0x00, 0x11,
+    0xa3, 0x06, 0x00, 0xf1, 0x2a, 0xa4, 0x01, 0x10, 0xa5, 0x01, 0x10, 0xa6, 0x01, 0x10, 0xa7, 0x01,
+    0x10, 0xa8, 0x01, 0x10, 0xa9, 0x01, 0x10, 0xaa, 0x01, 0x10, 0xab, 0x01, 0x10, 0xac, 0x01, 0x10,
+    0xad, 0x01, 0x10, 0xae, 0x01, 0x10, 0xaf, 0x01, 0x10, 0xb0, 0x01, 0x10, 0xb1, 0x01, 0x10, 0xb2,
+    0x01, 0x10, 0xb3, 0x01, 0x10, 0xb4, 0x01, 0x10, 0xb5, 0x01, 0x10, 0xb6, 0x01, 0x10, 0x55, 0x6e,
+    0x10, 0x0a, 0x1c, 0xe4, 0x10, 0x00, 0xd3, 0xd6, 0x20, 0x00, 0x00, 0xfb, 0xb4, 0xf1, 0x30, 0x00,
+    0x00, 0x0a, 0x1d, 0x00, 0x10, 0xbc, 0x01, 0x10, 0xbd, 0x01, 0x10, 0xbe, 0x01, 0x10, 0xbf, 0x01,
+    0x10, 0xc0, 0x01, 0x10, 0xc1, 0x01, 0x10, 0xc2, 0x01, 0x10, 0xc3, 0x01, 0x10, 0xc4, 0x01, 0x10,
+    0xc5, 0x01, 0x10, 0xc6, 0x01, 0x10, 0xc7, 0x01, 0x10, 0xc8, 0x01, 0x10, 0xc9, 0x01, 0x10, 0xca,
+    0x01, 0x10, 0xcb, 0x01, 0x10, 0xcc, 0x01, 0x10, 0xcd, 0x01, 0x10, 0xce, 0x01, 0x10, 0x21, 0x63,
+    0x01, 0xa4, 0x91, 0x31, 0x00, 0x0a, 0x1f, 0x06, 0x00, 0x01, 0x72, 0x49, 0xf0, 0x77, 0x0a, 0x21,
+    0x00, 0x10, 0xd4, 0x01, 0x10, 0xd5, 0x01, 0x10, 0xd6, 0x01, 0x10, 0xd7, 0x01, 0x10, 0xd8, 0x01,
+    0x10, 0xd9, 0x01, 0x10, 0xda, 0x01, 0x10, 0xdb, 0x01, 0x10, 0xdc, 0x01, 0x10, 0xdd, 0x01, 0x10,
+    0xde, 0x01, 0x10, 0xdf, 0x01, 0x10, 0xe0, 0x01, 0x10, 0xe1, 0x01, 0x10, 0xe2, 0x01, 0x10, 0xe3,
+    0x01, 0x10, 0xe4, 0x01, 0x10, 0xe5, 0x01, 0x10, 0xe6, 0x01, 0x10, 0xe7, 0x01, 0x10, 0xe8, 0x01,
+    0x10, 0xe9, 0x01, 0x10, 0xea, 0x01, 0x10, 0xeb, 0x01, 0x10, 0xec, 0x01, 0x10, 0xed, 0x01, 0x10,
+    0xee, 0x01, 0x10, 0xef, 0x01, 0x10, 0xf0, 0x01, 0x10, 0xf1, 0x01, 0x10, 0xf2, 0x01, 0x10, 0xf3,
+    0x01, 0x10, 0xf4, 0x01, 0x10, 0xf5, 0x01, 0x10, 0xf6, 0x01, 0x10, 0xf7, 0x01, 0x10, 0xf8, 0x01,
+    0x10, 0xf9, 0x01, 0x10, 0xfa, 0x01, 0x10, 0xfb, 0x01, 0x10, 0xfc, 0x01, 0x10, 0xfd, 0x01, 0x10,
+    0xfe, 0x01, 0x10, 0xff, 0x3a, 0xa8, 0x11, 0x10, 0x01, 0x6e, 0x20, 0x09, 0x31, 0x96, 0x00, 0xf1,
+    0xff, 0xff, 0xff, 0x82, 0x09, 0x32, 0x00, 0x10, 0x0a, 0x02, 0x10, 0x0b, 0x02, 0x10, 0x0c, 0x02,
+    0x10, 0x0d, 0x02, 0x10, 0x0e, 0x02, 0x10, 0x0f, 0x02, 0x10, 0x10, 0x02, 0x10, 0x11, 0x02, 0x10,
+    0x12, 0x02, 0x10, 0x13, 0x02, 0x10, 0x14, 0x02, 0x10, 0x15, 0x02, 0x12, 0x6f, 0x02, 0x12, 0x70,
+    0x02, 0x12, 0x71, 0x02, 0x12, 0x72, 0x02, 0x12, 0x73, 0x02, 0x12, 0x74, 0x02, 0x12, 0x75, 0x02,
+    0x12, 0x76, 0x02, 0x10, 0x16, 0x02, 0x10, 0x17, 0x02, 0x10, 0x18, 0x02, 0x10, 0x19, 0x02, 0x10,
+    0x1a, 0x02, 0x10, 0x1b, 0x02, 0x10, 0x1c, 0x02, 0x10, 0x1d, 0x02, 0x10, 0x1e, 0x02, 0x10, 0x1f,
+    0x02, 0x10, 0x20, 0x02, 0x10, 0x21, 0x02, 0x10, 0x22, 0x02, 0x10, 0x23, 0x02, 0x10, 0x24, 0x02,
+    0x10, 0x25, 0x02, 0x10, 0x26, 0x02, 0x10, 0x27, 0x02, 0x12, 0x83, 0x02, 0x12, 0x84, 0x02, 0x12,
+    0x85, 0x02, 0x12, 0x86, 0x02, 0x12, 0x87, 0x02, 0x12, 0x88, 0x02, 0x10, 0x28, 0x02, 0x10, 0x29,
+    0x02, 0x12, 0x8f, 0x02, 0x12, 0x90, 0x02, 0x10, 0x2a, 0x02, 0x10, 0x2b, 0x02, 0x10, 0x2c, 0x02,
+    0x10, 0x2d, 0x02, 0x10, 0x2e, 0x02, 0x10, 0x2f, 0x02, 0x10, 0x30, 0x02, 0x10, 0x31, 0x02, 0x10,
+    0x32, 0x02, 0x10, 0x33, 0x02, 0x10, 0x34, 0x02, 0x10, 0x35, 0x02, 0x10, 0x36, 0x02, 0x10, 0x37,
+    0x02, 0x12, 0xa7, 0x02, 0x12, 0xa8, 0x02, 0x10, 0x38, 0x02, 0x10, 0x39, 0x02, 0x10, 0x3a, 0x02,
+    0x10, 0x3b, 0x02, 0x10, 0x3c, 0x02, 0x10, 0x3d, 0x02, 0x10, 0x3e, 0x02, 0x10, 0x3f, 0x02, 0x10,
+    0x40, 0x02, 0x10, 0x41, 0x02, 0x10, 0x42, 0x02, 0x10, 0x43, 0x02, 0x10, 0x44, 0x02, 0x10, 0x45,
+    0x02, 0x10, 0x46, 0x02, 0x10, 0x47, 0x02, 0x10, 0x48, 0x02, 0x10, 0x49, 0x02, 0x10, 0x4a, 0x02,
+    0x10, 0x4b, 0x02, 0x10, 0x4c, 0x02, 0x10, 0x4d, 0x02, 0x10, 0x4e, 0x02, 0x10, 0x4f, 0x02, 0x10,
+    0x50, 0x02, 0x10, 0x51, 0x02, 0x10, 0x52, 0x02, 0x10, 0x53, 0x02, 0x12, 0xd7, 0x02, 0x12, 0xd8,
+    0x02, 0x10, 0x54, 0x02, 0x10, 0x55, 0x02, 0x10, 0x56, 0x02, 0x10, 0x57, 0x02, 0x10, 0x58, 0x02,
+    0x10, 0x59, 0x02, 0x10, 0x5a, 0x02, 0x10, 0x5b, 0x02, 0x10, 0x5c, 0x02, 0x10, 0x5d, 0x02, 0x10,
+    0x5e, 0x02, 0x10, 0x5f, 0x02, 0x10, 0x60, 0x02, 0x10, 0x61, 0x02, 0x10, 0x62, 0x02, 0x10, 0x63,
+    0x02, 0x10, 0x64, 0x02, 0x10, 0x65, 0x02, 0x10, 0x66, 0x02, 0x10, 0x67, 0x02, 0x10, 0x68, 0x02,
+    0x10, 0x69, 0x02, 0x10, 0x6a, 0x02, 0x10, 0x6b, 0x02, 0x10, 0x6c, 0x02, 0x10, 0x6d, 0x02, 0x10,
+    0x6e, 0x02, 0x10, 0x6f, 0x02, 0x10, 0x70, 0x02, 0x10, 0x71, 0x02, 0x10, 0x72, 0x02, 0x10, 0x73,
+    0x02, 0x10, 0x74, 0x02, 0x10, 0x75, 0x02, 0x12, 0xfe, 0x02, 0x12, 0xff, 0x02, 0x10, 0x76, 0x02,
+    0x10, 0x77, 0x02, 0x10, 0x78, 0x02, 0x10, 0x79, 0x02, 0x10, 0x7a, 0x02, 0x10, 0x7b, 0x02, 0x10,
+    0x7c, 0x02, 0x10, 0x7d, 0x02, 0x10, 0x7e, 0x02, 0x10, 0x7f, 0x02, 0x10, 0x80, 0x02, 0x10, 0x81,
+    0x02, 0x12, 0x06, 0x03, 0x12, 0x07, 0x03, 0x10, 0x82, 0x02, 0x10, 0x83, 0x02, 0x10, 0x84, 0x02,
+    0x10, 0x85, 0x02, 0x10, 0x86, 0x02, 0x10, 0x87, 0x02, 0x10, 0x88, 0x02, 0x10, 0x89, 0x02, 0x10,
+    0x8a, 0x02, 0x10, 0x8b, 0x02, 0x10, 0x8c, 0x02, 0x10, 0x8d, 0x02, 0x10, 0x8e, 0x02, 0x10, 0x8f,
+    0x02, 0x10, 0x90, 0x02, 0x10, 0x91, 0x02, 0x10, 0x92, 0x02, 0x10, 0x93, 0x02, 0x10, 0x94, 0x02,
+    0x10, 0x95, 0x02, 0x10, 0x96, 0x02, 0x10, 0x97, 0x02, 0x10, 0x98, 0x02, 0x10, 0x99, 0x02, 0x10,
+    0x9a, 0x02, 0x10, 0x9b, 0x02, 0x10, 0x9c, 0x02, 0x10, 0x9d, 0x02, 0x10, 0x9e, 0x02, 0x10, 0x9f,
+    0x02, 0x10, 0xa0, 0x02, 0x10, 0xa1, 0x02, 0x10, 0xa2, 0x02, 0x10, 0xa3, 0x02, 0x10, 0xa4, 0x02,
+    0x10, 0xa5, 0x02, 0x10, 0xa6, 0x02, 0x10, 0xa7, 0x02, 0x10, 0xa8, 0x02, 0x10, 0xa9, 0x02, 0x10,
+    0xaa, 0x02, 0x10, 0xab, 0x02, 0x10, 0xac, 0x02, 0x10, 0xad, 0x02, 0x10, 0xae, 0x02, 0x10, 0xaf,
+    0x02, 0x10, 0xb0, 0x02, 0x10, 0xb1, 0x02, 0x10, 0xb2, 0x02, 0x10, 0xb3, 0x02, 0x10, 0xb4, 0x02,
+    0x10, 0xb5, 0x02, 0x10, 0xb6, 0x02, 0x10, 0xb7, 0x02, 0x10, 0xb8, 0x02, 0x10, 0xb9, 0x02, 0x10,
+    0xba, 0x02, 0x10, 0xbb, 0x02, 0x10, 0xbc, 0x02, 0x10, 0xbd, 0x02, 0x10, 0xbe, 0x02, 0x10, 0xbf,
+    0x02, 0x10, 0xc0, 0x02, 0x10, 0xc1, 0x02, 0x10, 0xc2, 0x02, 0x10, 0xc3, 0x02, 0x10, 0xc4, 0x02,
+    0x10, 0xc5, 0x02, 0x10, 0xc6, 0x02, 0x10, 0xc7, 0x02, 0x10, 0xc8, 0x02, 0x10, 0xc9, 0x02, 0x10,
+    0xca, 0x02, 0x10, 0xcb, 0x02, 0x10, 0xcc, 0x02, 0x10, 0xcd, 0x02, 0x10, 0xce, 0x02, 0x10, 0xcf,
+    0x02, 0x10, 0xd0, 0x02, 0x10, 0xd1, 0x02, 0x10, 0xd2, 0x02, 0x10, 0xd3, 0x02, 0x10, 0xd4, 0x02,
+    0x10, 0xd5, 0x02, 0x10, 0xd6, 0x02, 0x10, 0xd7, 0x02, 0x10, 0xd8, 0x02, 0x10, 0xd9, 0x02, 0x10,
+    0xda, 0x02, 0x10, 0xdb, 0x02, 0x10, 0xdc, 0x02, 0x10, 0xdd, 0x02, 0x10, 0xde, 0x02, 0x10, 0xdf,
+    0x02, 0x10, 0xe0, 0x02, 0x10, 0xe1, 0x02, 0x10, 0xe2, 0x02, 0x10, 0xe3, 0x02, 0x10, 0xe4, 0x02,
+    0x10, 0xe5, 0x02, 0x10, 0xe6, 0x02, 0x10, 0xe7, 0x02, 0x10, 0xe8, 0x02, 0x10, 0xe9, 0x02, 0x10,
+    0xea, 0x02, 0x10, 0xeb, 0x02, 0x10, 0xec, 0x02, 0x10, 0xed, 0x02, 0x10, 0xee, 0x02, 0x10, 0xef,
+    0x02, 0x10, 0xf0, 0x02, 0x10, 0xf1, 0x02, 0x12, 0x6e, 0x03, 0x12, 0x6f, 0x03, 0x10, 0xf2, 0x02,
+    0x10, 0xf3, 0x02, 0x10, 0xf4, 0x02, 0x10, 0xf5, 0x02, 0x10, 0xf6, 0x02, 0x10, 0xf7, 0x02, 0x10,
+    0xf8, 0x02, 0x10, 0xf9, 0x02, 0x10, 0xfa, 0x02, 0x10, 0xfb, 0x02, 0x10, 0xfc, 0x02, 0x10, 0xfd,
+    0x02, 0x10, 0xfe, 0x02, 0x10, 0xff, 0x02, 0x10, 0x00, 0x03, 0x10, 0x01, 0x03, 0x10, 0x02, 0x03,
+    0x10, 0x03, 0x03, 0x10, 0x04, 0x03, 0x10, 0x05, 0x03, 0x10, 0x06, 0x03, 0x10, 0x07, 0x03, 0x10,
+    0x08, 0x03, 0x10, 0x09, 0x03, 0x10, 0x0a, 0x03, 0x10, 0x0b, 0x03, 0x10, 0x0c, 0x03, 0x10, 0x0d,
+    0x03, 0x10, 0x0e, 0x03, 0x10, 0x0f, 0x03, 0x10, 0x10, 0x03, 0x10, 0x11, 0x03, 0x10, 0x12, 0x03,
+    0x10, 0x13, 0x03, 0x10, 0x14, 0x03, 0x10, 0x15, 0x03, 0x10, 0x16, 0x03, 0x10, 0x17, 0x03, 0x10,
+    0x18, 0x03, 0x10, 0x19, 0x03, 0x10, 0x1a, 0x03, 0x10, 0x1b, 0x03, 0x10, 0x1c, 0x03, 0x10, 0x1d,
+    0x03, 0x10, 0x68, 0x58, 0x11, 0x10, 0x3a, 0x6b, 0x11, 0x10, 0xe2, 0x2d, 0xf1, 0x16, 0x10, 0x21,
+    0x03, 0x10, 0x22, 0x03, 0x10, 0x23, 0x03, 0x10, 0x24, 0x03, 0x10, 0x25, 0x03, 0x10, 0x26, 0x03,
+    0x10, 0x27, 0x03, 0x10, 0x28, 0x03, 0x10, 0x29, 0x03, 0x10, 0x2a, 0x03, 0x10, 0x2b, 0x03, 0x10,
+    0x2c, 0x03, 0x10, 0x22, 0x6b, 0x21, 0x10, 0x2e, 0x06, 0x00, 0x11, 0x2f, 0x06, 0x00, 0xf1, 0xff,
+    0x0f, 0x30, 0x03, 0x10, 0x31, 0x03, 0x10, 0x32, 0x03, 0x10, 0x33, 0x03, 0x10, 0x34, 0x03, 0x10,
+    0x35, 0x03, 0x10, 0x36, 0x03, 0x10, 0x37, 0x03, 0x10, 0x38, 0x03, 0x10, 0x39, 0x03, 0x10, 0x3a,
+    0x03, 0x10, 0x3b, 0x03, 0x10, 0x3c, 0x03, 0x10, 0x3d, 0x03, 0x10, 0x3e, 0x03, 0x10, 0x3f, 0x03,
+    0x10, 0x40, 0x03, 0x10, 0x41, 0x03, 0x10, 0x42, 0x03, 0x10, 0x43, 0x03, 0x10, 0x44, 0x03, 0x10,
+    0x45, 0x03, 0x10, 0x46, 0x03, 0x10, 0x47, 0x03, 0x10, 0x48, 0x03, 0x10, 0x49, 0x03, 0x10, 0x4a,
+    0x03, 0x10, 0x4b, 0x03, 0x10, 0x4c, 0x03, 0x10, 0x4d, 0x03, 0x10, 0x4e, 0x03, 0x10, 0x4f, 0x03,
+    0x10, 0x50, 0x03, 0x10, 0x51, 0x03, 0x10, 0x52, 0x03, 0x10, 0x53, 0x03, 0x10, 0x54, 0x03, 0x10,
+    0x55, 0x03, 0x10, 0x56, 0x03, 0x10, 0x57, 0x03, 0x10, 0x58, 0x03, 0x10, 0x59, 0x03, 0x10, 0x5a,
+    0x03, 0x10, 0x5b, 0x03, 0x10, 0x5c, 0x03, 0x10, 0x5d, 0x03, 0x10, 0x5e, 0x03, 0x10, 0x5f, 0x03,
+    0x10, 0x60, 0x03, 0x10, 0x61, 0x03, 0x10, 0x62, 0x03, 0x10, 0x63, 0x03, 0x10, 0x64, 0x03, 0x10,
+    0x65, 0x03, 0x10, 0x66, 0x03, 0x10, 0x67, 0x03, 0x10, 0x68, 0x03, 0x10, 0x69, 0x03, 0x10, 0x6a,
+    0x03, 0x10, 0x6b, 0x03, 0x10, 0x6c, 0x03, 0x10, 0x6d, 0x03, 0x10, 0x6e, 0x03, 0x10, 0x6f, 0x03,
+    0x10, 0x70, 0x03, 0x10, 0x71, 0x03, 0x10, 0x72, 0x03, 0x10, 0x73, 0x03, 0x10, 0x74, 0x03, 0x10,
+    0x75, 0x03, 0x10, 0x76, 0x03, 0x10, 0x77, 0x03, 0x10, 0x78, 0x03, 0x10, 0x79, 0x03, 0x10, 0x7a,
+    0x03, 0x10, 0x7b, 0x03, 0x10, 0x7c, 0x03, 0x10, 0x7d, 0x03, 0x10, 0x7e, 0x03, 0x10, 0x7f, 0x03,
+    0x12, 0x31, 0x04, 0x12, 0x32, 0x04, 0x10, 0x80, 0x03, 0x10, 0x81, 0x03, 0x10, 0x82, 0x03, 0x10,
+    0x83, 0x03, 0x10, 0x84, 0x03, 0x10, 0x85, 0x03, 0x10, 0x86, 0x03, 0x10, 0x87, 0x03, 0x10, 0x88,
+    0x03, 0x10, 0x89, 0x03, 0x10, 0x8a, 0x03, 0x10, 0x8b, 0x03, 0x10, 0x8c, 0x03, 0x10, 0x93, 0x69,
+    0x21, 0x10, 0x8e, 0x06, 0x00, 0xd1, 0x8f, 0x03, 0x10, 0x90, 0x03, 0x10, 0x91, 0x03, 0x10, 0x92,
+    0x03, 0x10, 0x93, 0x12, 0x00, 0x01, 0x41, 0x6a, 0x21, 0x10, 0x95, 0x06, 0x00, 0x01, 0x3b, 0x6a,
+    0xf0, 0x1d, 0x10, 0x97, 0x03, 0x10, 0x98, 0x03, 0x10, 0x99, 0x03, 0x10, 0x9a, 0x03, 0x10, 0x9b,
+    0x03, 0x10, 0x9c, 0x03, 0x10, 0x9d, 0x03, 0x10, 0x9e, 0x03, 0x10, 0x9f, 0x03, 0x10, 0xa0, 0x03,
+    0x10, 0xa1, 0x03, 0x10, 0xa2, 0x03, 0x10, 0xa3, 0x03, 0x10, 0xa4, 0x03, 0x10, 0xa5, 0x30, 0x00,
+    0x81, 0x09, 0x33, 0x00, 0x10, 0xa6, 0x03, 0x10, 0xa7, 0x3c, 0x00, 0xf1, 0x10, 0xa8, 0x03, 0x10,
+    0xa9, 0x03, 0x10, 0xaa, 0x03, 0x10, 0xab, 0x03, 0x10, 0xac, 0x03, 0x10, 0xad, 0x03, 0x10, 0xae,
+    0x03, 0x10, 0xaf, 0x03, 0x10, 0xb0, 0x03, 0x10, 0xb1, 0x03, 0x10, 0xb2, 0x24, 0x00, 0x11, 0xb3,
+    0x06, 0x00, 0x11, 0xb4, 0x06, 0x00, 0x11, 0xb5, 0x06, 0x00, 0xf1, 0x03, 0xb6, 0x03, 0x10, 0xb7,
+    0x03, 0x10, 0xb8, 0x03, 0x10, 0xb9, 0x03, 0x10, 0xba, 0x03, 0x10, 0xbb, 0x03, 0x10, 0x9f, 0x69,
+    0xf1, 0x29, 0x10, 0xbd, 0x03, 0x10, 0xbe, 0x03, 0x10, 0xbf, 0x03, 0x10, 0xc0, 0x03, 0x10, 0xc1,
+    0x03, 0x10, 0xc2, 0x03, 0x10, 0xc3, 0x03, 0x10, 0xc4, 0x03, 0x10, 0xc5, 0x03, 0x10, 0xc6, 0x03,
+    0x10, 0xc7, 0x03, 0x10, 0xc8, 0x03, 0x10, 0xc9, 0x03, 0x10, 0xca, 0x03, 0x10, 0xcb, 0x03, 0x09,
+    0x34, 0x00, 0x09, 0x35, 0x00, 0x10, 0xd2, 0x03, 0x10, 0xd3, 0x3c, 0x00, 0xf1, 0x1b, 0xd4, 0x03,
+    0x10, 0xd5, 0x03, 0x10, 0xd6, 0x03, 0x10, 0xd7, 0x03, 0x10, 0xd8, 0x03, 0x10, 0xd9, 0x03, 0x10,
+    0xda, 0x03, 0x10, 0xdb, 0x03, 0x10, 0xdc, 0x03, 0x10, 0xdd, 0x03, 0x10, 0xde, 0x03, 0x10, 0xdf,
+    0x03, 0x10, 0xe0, 0x03, 0x10, 0xe1, 0x03, 0x10, 0x01, 0x68, 0x11, 0x10, 0x01, 0x68, 0x11, 0x10,
+    0x01, 0x68, 0x11, 0x10, 0x01, 0x68, 0xf0, 0x4b, 0x10, 0xe6, 0x03, 0x10, 0xe7, 0x03, 0x10, 0xe8,
+    0x03, 0x10, 0xe9, 0x03, 0x10, 0xea, 0x03, 0x10, 0xeb, 0x03, 0x10, 0xec, 0x03, 0x10, 0xed, 0x03,
+    0x10, 0xee, 0x03, 0x10, 0xef, 0x03, 0x10, 0xf0, 0x03, 0x10, 0xf1, 0x03, 0x10, 0xf2, 0x03, 0x10,
+    0xf3, 0x03, 0x10, 0xf4, 0x03, 0x10, 0xf5, 0x03, 0x10, 0xf6, 0x03, 0x10, 0xf7, 0x03, 0x10, 0xf8,
+    0x03, 0x10, 0xf9, 0x03, 0x10, 0xfa, 0x03, 0x10, 0xfb, 0x03, 0x10, 0xfc, 0x03, 0x10, 0xfd, 0x03,
+    0x10, 0xfe, 0x03, 0x10, 0xff, 0x03, 0x10, 0x00, 0x04, 0x10, 0x01, 0x04, 0x10, 0x02, 0x04, 0x10,
+    0x03, 0x04, 0x15, 0xc4, 0x31, 0x05, 0x04, 0x10, 0xa7, 0x26, 0x11, 0x10, 0xa4, 0x26, 0x11, 0x10,
+    0xa1, 0x26, 0x11, 0x10, 0x9e, 0x26, 0xf1, 0x46, 0x10, 0x0a, 0x04, 0x10, 0x0b, 0x04, 0x10, 0x0c,
+    0x04, 0x10, 0x0d, 0x04, 0x10, 0x0e, 0x04, 0x10, 0x0f, 0x04, 0x10, 0x10, 0x04, 0x10, 0x11, 0x04,
+    0x10, 0x12, 0x04, 0x10, 0x13, 0x04, 0x10, 0x14, 0x04, 0x10, 0x15, 0x04, 0x10, 0x16, 0x04, 0x10,
+    0x17, 0x04, 0x10, 0x18, 0x04, 0x10, 0x19, 0x04, 0x10, 0x1a, 0x04, 0x10, 0x1b, 0x04, 0x10, 0x1c,
+    0x04, 0x10, 0x1d, 0x04, 0x10, 0x1e, 0x04, 0x10, 0x1f, 0x04, 0x10, 0x20, 0x04, 0x10, 0x21, 0x04,
+    0x10, 0x22, 0x04, 0x10, 0x23, 0x04, 0x10, 0x24, 0x04, 0x10, 0x25, 0x04, 0x10, 0x05, 0x26, 0x11,
+    0x0a, 0x36, 0x87, 0xf1, 0x0a, 0x0a, 0x2b, 0x00, 0x10, 0x29, 0x04, 0x10, 0x2a, 0x04, 0x10, 0x2b,
+    0x04, 0x10, 0x2c, 0x04, 0x10, 0x2d, 0x04, 0x10, 0x2e, 0x04, 0x10, 0x2f, 0x04, 0x10, 0xcf, 0x25,
+    0x11, 0x0a, 0x64, 0x54, 0xf1, 0x34, 0x0a, 0x2d, 0x00, 0x10, 0x33, 0x04, 0x10, 0x34, 0x04, 0x10,
+    0x35, 0x04, 0x10, 0x36, 0x04, 0x10, 0x37, 0x04, 0x10, 0x38, 0x04, 0x10, 0x39, 0x04, 0x10, 0x3a,
+    0x04, 0x10, 0x3b, 0x04, 0x10, 0x3c, 0x04, 0x10, 0x3d, 0x04, 0x10, 0x3e, 0x04, 0x10, 0x3f, 0x04,
+    0x10, 0x40, 0x04, 0x10, 0x41, 0x04, 0x10, 0x42, 0x04, 0x10, 0x43, 0x04, 0x10, 0x44, 0x04, 0x10,
+    0x45, 0x04, 0x10, 0x46, 0x04, 0x10, 0x47, 0x04, 0x10, 0x2b, 0x54, 0xf1, 0x16, 0x09, 0x36, 0x00,
+    0x10, 0x4f, 0x04, 0x10, 0x50, 0x04, 0x10, 0x51, 0x04, 0x10, 0x52, 0x04, 0x10, 0x53, 0x04, 0x10,
+    0x54, 0x04, 0x10, 0x55, 0x04, 0x10, 0x56, 0x04, 0x10, 0x57, 0x04, 0x10, 0x58, 0x04, 0x10, 0x59,
+    0x04, 0x10, 0x1f, 0x54, 0x11, 0x10, 0x33, 0x25, 0x11, 0x10, 0x25, 0x54, 0x21, 0x10, 0x5d, 0x06,
+    0x00, 0xf1, 0x21, 0x5e, 0x04, 0x10, 0x5f, 0x04, 0x10, 0x60, 0x04, 0x10, 0x61, 0x04, 0x10, 0x62,
+    0x04, 0x10, 0x63, 0x04, 0x10, 0x64, 0x04, 0x10, 0x65, 0x04, 0x10, 0x66, 0x04, 0x10, 0x67, 0x04,
+    0x10, 0x68, 0x04, 0x10, 0x69, 0x04, 0x10, 0x6a, 0x04, 0x10, 0x6b, 0x04, 0x10, 0x6c, 0x04, 0x10,
+    0x6d, 0x04, 0x10, 0x09, 0x25, 0x81, 0x10, 0x6f, 0x04, 0x10, 0x70, 0x04, 0x10, 0x71, 0x7e, 0x00,
+    0x71, 0x37, 0x00, 0x10, 0x72, 0x04, 0x10, 0x73, 0x18, 0x00, 0x01, 0x0c, 0x25, 0xf6, 0x2a, 0x09,
+    0x38, 0x00, 0x10, 0x75, 0x04, 0x10, 0x76, 0x04, 0x10, 0x77, 0x04, 0x10, 0x78, 0x04, 0x06, 0xac,
+    0x00, 0x06, 0xad, 0x00, 0x8e, 0x30, 0x02, 0x8e, 0x31, 0x02, 0x8d, 0x32, 0x02, 0x8d, 0x33, 0x02,
+    0x09, 0x39, 0x00, 0x09, 0x3a, 0x00, 0x09, 0x3b, 0x00, 0x09, 0x3c, 0x00, 0x09, 0x3d, 0x00, 0x09,
+    0x3e, 0x00, 0x09, 0x3f, 0x00, 0x09, 0x40, 0x00, 0xfb, 0x29, 0x14, 0x15, 0xbc, 0x44, 0x02, 0x2d,
+    0x46, 0x17, 0x09, 0xe4, 0x3a, 0x05, 0x08, 0x3b, 0x04, 0xff, 0x3a, 0x00, 0x94, 0x11, 0xf3, 0xa1,
+    0xcb, 0x02, 0x81, 0x13, 0x03, 0x81, 0x14, 0x03, 0x09, 0x41, 0x00, 0x09, 0x42, 0x00, 0x10, 0x79,
+    0x04, 0x10, 0x7a, 0x04, 0x10, 0x7b, 0x04, 0x10, 0x7c, 0x04, 0x10, 0x7d, 0x04, 0x10, 0x7e, 0x04,
+    0x10, 0x7f, 0x04, 0x10, 0x80, 0x04, 0x10, 0x81, 0x04, 0x10, 0x82, 0x04, 0x10, 0x83, 0x04, 0x10,
+    0x84, 0x04, 0x10, 0x85, 0x04, 0x10, 0x86, 0x04, 0x10, 0x87, 0x04, 0x10, 0x88, 0x04, 0x10, 0x89,
+    0x04, 0x10, 0x8a, 0x04, 0x10, 0x8b, 0x04, 0x10, 0x8c, 0x04, 0x10, 0x8d, 0x04, 0x10, 0x8e, 0x04,
+    0x10, 0x8f, 0x04, 0x10, 0x90, 0x04, 0x10, 0x91, 0x04, 0x10, 0x92, 0x04, 0x10, 0x93, 0x04, 0x10,
+    0x94, 0x04, 0x10, 0x95, 0x04, 0x10, 0x96, 0x04, 0x10, 0x97, 0x04, 0x10, 0x98, 0x04, 0x10, 0x99,
+    0x04, 0x10, 0x9a, 0x04, 0x10, 0x9b, 0x04, 0x10, 0x9c, 0x04, 0x10, 0x9d, 0x04, 0x10, 0x9e, 0x04,
+    0x10, 0x9f, 0x04, 0x10, 0xa0, 0x04, 0x10, 0xa1, 0x04, 0x10, 0xa2, 0x04, 0x10, 0xa3, 0x04, 0x10,
+    0xa4, 0x04, 0x10, 0xa5, 0x04, 0x10, 0xa6, 0x04, 0x10, 0xa7, 0x04, 0x10, 0xa8, 0x04, 0x10, 0xa9,
+    0x04, 0x10, 0xaa, 0x04, 0x10, 0xab, 0x04, 0x10, 0xac, 0x04, 0x10, 0xad, 0x04, 0x10, 0xae, 0x04,
+    0xdc, 0x17, 0x02, 0xb0, 0x10, 0x02, 0xbc, 0x10, 0x02, 0xe8, 0x17, 0x02, 0xa0, 0x17, 0x02, 0xc2,
+    0x10, 0x02, 0xa0, 0x17, 0x02, 0xe0, 0x10, 0x02, 0x12, 0x18, 0x02, 0x2f, 0x56, 0x01, 0x64, 0x80,
+    0xf1, 0xd3, 0x10, 0xaf, 0x04, 0x10, 0xb0, 0x04, 0x10, 0xb1, 0x04, 0x10, 0xb2, 0x04, 0x10, 0xb3,
+    0x04, 0x10, 0xb4, 0x04, 0x10, 0xb5, 0x04, 0x10, 0xb6, 0x04, 0x10, 0xb7, 0x04, 0x10, 0xb8, 0x04,
+    0x10, 0xb9, 0x04, 0x10, 0xba, 0x04, 0x10, 0xbb, 0x04, 0x10, 0xbc, 0x04, 0x10, 0xbd, 0x04, 0x10,
+    0xbe, 0x04, 0x10, 0xbf, 0x04, 0x10, 0xc0, 0x04, 0x10, 0xc1, 0x04, 0x10, 0xc2, 0x04, 0x10, 0xc3,
+    0x04, 0x10, 0xc4, 0x04, 0x10, 0xc5, 0x04, 0x10, 0xc6, 0x04, 0x10, 0xc7, 0x04, 0x10, 0xc8, 0x04,
+    0x10, 0xc9, 0x04, 0x10, 0xca, 0x04, 0x10, 0xcb, 0x04, 0x10, 0xcc, 0x04, 0x10, 0xcd, 0x04, 0x10,
+    0xce, 0x04, 0x10, 0xcf, 0x04, 0x10, 0xd0, 0x04, 0x10, 0xd1, 0x04, 0x10, 0xd2, 0x04, 0x10, 0xd3,
+    0x04, 0x10, 0xd4, 0x04, 0x10, 0xd5, 0x04, 0x10, 0xd6, 0x04, 0x10, 0xd7, 0x04, 0x10, 0xd8, 0x04,
+    0x10, 0xd9, 0x04, 0x10, 0xda, 0x04, 0x10, 0xdb, 0x04, 0x10, 0xdc, 0x04, 0x10, 0xdd, 0x04, 0x10,
+    0xde, 0x04, 0x10, 0xdf, 0x04, 0x10, 0xe0, 0x04, 0x10, 0xe1, 0x04, 0x10, 0xe2, 0x04, 0x10, 0xe3,
+    0x04, 0x10, 0xe4, 0x04, 0x10, 0xe5, 0x04, 0x10, 0xe6, 0x04, 0x10, 0xe7, 0x04, 0x10, 0xe8, 0x04,
+    0x10, 0xe9, 0x04, 0x10, 0xea, 0x04, 0x10, 0xeb, 0x04, 0x10, 0xec, 0x04, 0x10, 0xed, 0x04, 0x10,
+    0xee, 0x04, 0x10, 0xef, 0x04, 0x10, 0xf0, 0x04, 0x8c, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x8c, 0x11,
+    0x00, 0x8c, 0x12, 0x00, 0x8c, 0x13, 0x00, 0x8c, 0x14, 0x00, 0x09, 0x47, 0x00, 0x09, 0x48, 0x00,
+    0x09, 0x49, 0x00, 0x09, 0xfe, 0x91, 0x30, 0x06, 0xd1, 0x00, 0xd0, 0x30, 0x11, 0x7d, 0xd3, 0x30,
+    0x02, 0xd0, 0x30, 0x11, 0x81, 0xd3, 0x30, 0x61, 0x82, 0x03, 0x81, 0x45, 0x03, 0x81, 0x13, 0x71,
+    0x30, 0x81, 0x4e, 0x03, 0x43, 0x14, 0x11, 0x69, 0x34, 0x14, 0x11, 0x6a, 0xef, 0x2c, 0x11, 0x61,
+    0xe9, 0x2c, 0x61, 0x62, 0x06, 0x81, 0x4a, 0x03, 0x81, 0x55, 0x71, 0x11, 0x81, 0x55, 0x71, 0x11,
+    0x81, 0x95, 0x70, 0x11, 0x81, 0xcf, 0x22, 0x21, 0x81, 0x5f, 0x06, 0x00, 0x01, 0xd2, 0x22, 0x11,
+    0x81, 0xc6, 0x22, 0x11, 0x81, 0xad, 0x70, 0x11, 0x81, 0xdb, 0x22, 0xf1, 0x0a, 0x81, 0x63, 0x05,
+    0x81, 0x21, 0x03, 0x81, 0x23, 0x03, 0x81, 0x22, 0x03, 0x81, 0x24, 0x03, 0x81, 0x25, 0x03, 0x81,
+    0x27, 0x03, 0x81, 0x26, 0x03, 0x81, 0x08, 0x35, 0x21, 0x81, 0x59, 0x06, 0x00, 0x20, 0x5a, 0x03,
+    0xe7, 0x49, 0x20, 0x5a, 0x06, 0xa8, 0x4f, 0x31, 0x16, 0x01, 0x10, 0x27, 0x25, 0x21, 0x10, 0xf6,
+    0x06, 0x00, 0x01, 0x2a, 0x25, 0x21, 0x10, 0xf8, 0x06, 0x00, 0x01, 0x2d, 0x25, 0x10, 0x10, 0xe7,
+    0xf4, 0x21, 0x00, 0x10, 0x30, 0x25, 0x21, 0x10, 0xfc, 0x06, 0x00, 0x01, 0x33, 0x25, 0x21, 0x10,
+    0xfe, 0x06, 0x00, 0x01, 0x36, 0x25, 0x00, 0x8a, 0xf4, 0x00, 0xf9, 0x5b, 0x01, 0x06, 0x00, 0x11,
+    0x02, 0x06, 0x00, 0x01, 0x3c, 0x25, 0x21, 0x10, 0x04, 0x06, 0x00, 0x01, 0x3f, 0x25, 0x11, 0x81,
+    0x8e, 0x71, 0x11, 0x81, 0xee, 0x71, 0x00, 0x15, 0x60, 0x11, 0x3c, 0x03, 0x60, 0x11, 0x3d, 0xee,
+    0x4e, 0x11, 0x2a, 0xf1, 0x4e, 0x11, 0x2b, 0xe2, 0x5f, 0x11, 0x18, 0xd0, 0x5f, 0x20, 0x19, 0x06,
+    0xa8, 0x12, 0x11, 0xe9, 0xab, 0x12, 0x11, 0xea, 0xe6, 0x16, 0x11, 0xe1, 0xe9, 0x16, 0x20, 0xe2,
+    0x00, 0xbd, 0x3a, 0x11, 0x99, 0xff, 0x6f, 0x20, 0x9a, 0x03, 0x7b, 0x15, 0x11, 0x71, 0x6c, 0x15,
+    0x20, 0x72, 0x06, 0x20, 0x3e, 0x11, 0xb9, 0x23, 0x3e, 0x20, 0xba, 0x00, 0x6e, 0x70, 0x11, 0x8d,
+    0x71, 0x70, 0x20, 0x8e, 0x03, 0xe4, 0x4f, 0x11, 0x3d, 0xe7, 0x4f, 0x11, 0x3e, 0x96, 0x46, 0x11,
+    0x1d, 0x99, 0x46, 0x20, 0x1e, 0x01, 0x5c, 0x13, 0x11, 0x49, 0x5f, 0x13, 0x20, 0x4a, 0x06, 0x90,
+    0x03, 0x11, 0x13, 0x92, 0x3e, 0x20, 0x14, 0x03, 0x9a, 0x4b, 0x41, 0x79, 0x01, 0x81, 0x78, 0x09,
+    0x31, 0x11, 0x05, 0xb6, 0x3e, 0x10, 0x06, 0xb9, 0x3e, 0xa1, 0x10, 0x08, 0x05, 0x10, 0x09, 0x05,
+    0x10, 0x0a, 0x05, 0x10, 0xf3, 0x25, 0x41, 0x10, 0x0c, 0x05, 0x10, 0xf3, 0x25, 0x21, 0x10, 0x0e,
+    0x06, 0x00, 0x01, 0xf6, 0x25, 0x21, 0x10, 0x10, 0x06, 0x00, 0x01, 0xf9, 0x25, 0x11, 0x10, 0xf8,
+    0x61, 0x11, 0x10, 0xfc, 0x25, 0x11, 0x10, 0xf8, 0x61, 0x11, 0x10, 0xff, 0x25, 0x00, 0xff, 0x00,
+    0x02, 0x75, 0x6c, 0xf1, 0x0f, 0x42, 0x06, 0x8b, 0x0b, 0x01, 0x8b, 0x0d, 0x01, 0x8b, 0x0c, 0x01,
+    0x8b, 0x0e, 0x01, 0x8b, 0x32, 0x06, 0x8b, 0x34, 0x06, 0x8b, 0x33, 0x06, 0x8b, 0x35, 0x06, 0x10,
+    0x16, 0x05, 0x10, 0x23, 0x26, 0x10, 0x10, 0xfb, 0xf8, 0x21, 0x00, 0x10, 0x26, 0x26, 0x21, 0x10,
+    0x1a, 0x06, 0x00, 0x01, 0x29, 0x26, 0x21, 0x10, 0x1c, 0x06, 0x00, 0x01, 0x2c, 0x26, 0xf1, 0x0d,
+    0x10, 0x1e, 0x05, 0x10, 0x1f, 0x05, 0x10, 0x20, 0x05, 0x10, 0x21, 0x05, 0x10, 0x22, 0x05, 0x10,
+    0x23, 0x05, 0x10, 0x24, 0x05, 0x10, 0x25, 0x05, 0x10, 0x26, 0x05, 0x10, 0x20, 0x26, 0x00, 0x24,
+    0x00, 0x11, 0x28, 0x2a, 0x00, 0x83, 0x29, 0x05, 0x10, 0x2a, 0x05, 0x10, 0x2b, 0x05, 0x96, 0x03,
+    0x08, 0xc6, 0x03, 0x01, 0xae, 0x03, 0x63, 0x10, 0x2c, 0x05, 0x10, 0x2d, 0x05, 0x84, 0x1b, 0x02,
+    0xd2, 0x03, 0x11, 0x73, 0x3f, 0x3d, 0x11, 0x74, 0x42, 0x3d, 0x11, 0x77, 0x36, 0x3d, 0x10, 0x78,
+    0xd0, 0x71, 0x00, 0xc0, 0x00, 0x01, 0xe3, 0x73, 0x30, 0x81, 0x4c, 0x03, 0x53, 0x2f, 0x11, 0x65,
+    0x56, 0x2f, 0x11, 0x66, 0x30, 0x4c, 0x10, 0x5d, 0x33, 0x4c, 0x20, 0x81, 0x5e, 0x2b, 0x1e, 0x11,
+    0x81, 0x25, 0x74, 0xf1, 0x0a, 0x81, 0x47, 0x03, 0x81, 0x19, 0x03, 0x81, 0x1b, 0x03, 0x81, 0x1a,
+    0x03, 0x81, 0x1c, 0x03, 0x81, 0x1d, 0x03, 0x81, 0x1f, 0x03, 0x81, 0x1e, 0x03, 0x81, 0xd5, 0x09,
+    0x11, 0x81, 0xef, 0x73, 0x00, 0xc2, 0x3e, 0x02, 0x81, 0x4c, 0x01, 0x42, 0x52, 0x11, 0x10, 0xb9,
+    0x26, 0x11, 0x10, 0xb6, 0x26, 0x11, 0x10, 0xb3, 0x26, 0x11, 0x10, 0xbd, 0x1c, 0x11, 0x10, 0xad,
+    0x26, 0x11, 0x10, 0xaa, 0x26, 0x10, 0x10, 0xb8, 0xd1, 0x21, 0x00, 0x10, 0xaa, 0x26, 0x11, 0x81,
+    0x58, 0x74, 0x11, 0x81, 0x58, 0x74, 0x00, 0x91, 0x54, 0x80, 0x38, 0x06, 0x81, 0x37, 0x06, 0x81,
+    0x39, 0x06, 0xf0, 0x18, 0x11, 0xe5, 0xf3, 0x18, 0x11, 0xe6, 0xf6, 0x18, 0x11, 0xdd, 0xf9, 0x18,
+    0x11, 0xde, 0x96, 0x5b, 0x11, 0x95, 0x1b, 0x3d, 0x20, 0x96, 0x03, 0x8b, 0x17, 0x11, 0x6d, 0x88,
+    0x17, 0x20, 0x6e, 0x06, 0x57, 0x40, 0x11, 0xb5, 0x51, 0x40, 0x20, 0xb6, 0x00, 0x2c, 0x3e, 0x11,
+    0x89, 0x02, 0x79, 0x20, 0x8a, 0x03, 0x48, 0x52, 0x11, 0x31, 0x4b, 0x52, 0x11, 0x32, 0xf2, 0x35,
+    0x11, 0x39, 0xf5, 0x35, 0x20, 0x3a, 0x01, 0xae, 0x15, 0x11, 0x45, 0xb1, 0x15, 0x20, 0x46, 0x06,
+    0xe2, 0x05, 0x11, 0x0f, 0xe5, 0x05, 0x20, 0x10, 0x03, 0xf5, 0x4d, 0x11, 0x75, 0xf8, 0x4d, 0xb0,
+    0x76, 0x01, 0x81, 0x01, 0x03, 0x81, 0x03, 0x03, 0x81, 0x02, 0x03, 0xf5, 0x5f, 0x11, 0x02, 0x13,
+    0x51, 0x11, 0x03, 0x16, 0x51, 0x20, 0x0e, 0x06, 0x6a, 0x54, 0x11, 0x0f, 0x6d, 0x54, 0x41, 0x06,
+    0x06, 0x81, 0x08, 0x25, 0x51, 0x41, 0x09, 0x06, 0x81, 0xab, 0xc6, 0x78, 0x11, 0xac, 0x1f, 0x60,
+    0x11, 0x25, 0xa1, 0x3e, 0x11, 0x26, 0x9b, 0x3e, 0x10, 0x31, 0x65, 0x79, 0x00, 0x71, 0x79, 0x11,
+    0x34, 0xa7, 0x3e, 0x11, 0x2b, 0xaa, 0x3e, 0x20, 0x2c, 0x04, 0x63, 0x31, 0x11, 0xb5, 0x66, 0x31,
+    0x20, 0xb6, 0x03, 0x97, 0x54, 0x11, 0xf4, 0x9a, 0x54, 0x10, 0xf5, 0x81, 0x5e, 0x30, 0x81, 0x00,
+    0x06, 0xeb, 0x71, 0x20, 0x01, 0x06, 0xa3, 0x54, 0x11, 0xf8, 0xa6, 0x54, 0x20, 0xf9, 0x05, 0x1d,
+    0x79, 0x41, 0xa9, 0x03, 0x81, 0xa8, 0x3e, 0x73, 0x11, 0x0a, 0x6b, 0x53, 0x11, 0x0b, 0x6e, 0x53,
+    0x11, 0xfa, 0x06, 0x6f, 0x10, 0xfb, 0x09, 0x6f, 0xb1, 0x10, 0x36, 0x05, 0x10, 0x37, 0x05, 0x81,
+    0x2b, 0x03, 0x81, 0x2c, 0x75, 0x6c, 0x10, 0x37, 0x78, 0x6c, 0xf1, 0x01, 0x81, 0x38, 0x03, 0x8b,
+    0x6e, 0x05, 0x8b, 0x70, 0x05, 0x8b, 0x6f, 0x05, 0x8b, 0x71, 0x05, 0x8b, 0x6f, 0x25, 0x21, 0x8b,
+    0xc9, 0x06, 0x00, 0x11, 0xac, 0x06, 0x00, 0x01, 0x08, 0x26, 0x10, 0x8b, 0x0d, 0xcb, 0x21, 0x00,
+    0x8b, 0x5c, 0x26, 0x21, 0x8b, 0xb2, 0x06, 0x00, 0x01, 0x05, 0x26, 0x21, 0x8b, 0xa2, 0x06, 0x00,
+    0x01, 0x59, 0x26, 0x21, 0x8b, 0x86, 0x06, 0x00, 0x01, 0xe3, 0x26, 0x11, 0x8b, 0xff, 0x25, 0x11,
+    0x8b, 0xfc, 0x25, 0x11, 0x8b, 0x14, 0x26, 0x21, 0x8b, 0xb9, 0x06, 0x00, 0x11, 0x8e, 0x06, 0x00,
+    0x01, 0xe3, 0x26, 0x21, 0x8b, 0x8c, 0x06, 0x00, 0x01, 0xf8, 0x26, 0x00, 0xc3, 0x40, 0x11, 0x0d,
+    0xc6, 0x40, 0x11, 0x0e, 0xbb, 0x3f, 0x11, 0x19, 0xbe, 0x3f, 0x41, 0x1a, 0x04, 0x81, 0x0f, 0xa6,
+    0x74, 0x10, 0x10, 0xa9, 0x74, 0x00, 0x69, 0x52, 0x11, 0xe1, 0x6c, 0x52, 0x11, 0xe2, 0x3d, 0x54,
+    0x11, 0xe9, 0x40, 0x54, 0x83, 0xea, 0x02, 0x10, 0x38, 0x05, 0x10, 0x39, 0x05, 0x45, 0x31, 0x11,
+    0x39, 0x36, 0x31, 0x10, 0x3a, 0x39, 0x31, 0x41, 0x10, 0x3a, 0x05, 0x10, 0xcf, 0x28, 0x41, 0x10,
+    0x3c, 0x05, 0x10, 0xcf, 0x28, 0x21, 0x10, 0x3e, 0x06, 0x00, 0x01, 0xd2, 0x28, 0x10, 0x10, 0x31,
+    0xd4, 0xf1, 0x05, 0x00, 0x8b, 0x07, 0x01, 0x8b, 0x09, 0x01, 0x8b, 0x08, 0x01, 0x8b, 0x0a, 0x01,
+    0x8b, 0xc2, 0x04, 0x8b, 0xc3, 0x04, 0x8b, 0x80, 0x2c, 0xc0, 0x8b, 0x2e, 0x06, 0x8b, 0x30, 0x06,
+    0x8b, 0x2f, 0x06, 0x8b, 0x31, 0x06, 0x47, 0x35, 0x11, 0xc1, 0x4a, 0x35, 0xf0, 0x17, 0xc2, 0x00,
+    0x81, 0xca, 0x05, 0x81, 0xcc, 0x05, 0x81, 0xcb, 0x05, 0x81, 0xcd, 0x05, 0x81, 0xb4, 0x05, 0x81,
+    0xb6, 0x05, 0x81, 0xb5, 0x05, 0x81, 0xb7, 0x05, 0x81, 0xbc, 0x05, 0x81, 0xbe, 0x05, 0x81, 0xbd,
+    0x05, 0x81, 0xbf, 0x05, 0xef, 0x41, 0x10, 0xc1, 0x81, 0x75, 0x00, 0xa5, 0x1f, 0xb3, 0x52, 0x05,
+    0x81, 0x54, 0x05, 0x81, 0x53, 0x05, 0x81, 0x55, 0x05, 0x6c, 0x37, 0x01, 0xde, 0x7b, 0x11, 0x81,
+    0x68, 0x04, 0x00, 0x40, 0x65, 0x20, 0xe4, 0x05, 0x2e, 0x65, 0x02, 0x32, 0x53, 0x11, 0xe8, 0x35,
+    0x53, 0x20, 0xe9, 0x05, 0x63, 0x37, 0x11, 0x02, 0x66, 0x37, 0x20, 0x03, 0x05, 0x57, 0x37, 0x41,
+    0xdd, 0x03, 0x81, 0xdc, 0x44, 0x41, 0x11, 0xcb, 0x55, 0x42, 0x41, 0xcc, 0x03, 0x81, 0xce, 0x4d,
+    0x41, 0x11, 0xd1, 0x50, 0x41, 0x20, 0xd2, 0x03, 0xd0, 0x3f, 0x11, 0xea, 0xca, 0x3f, 0x20, 0xeb,
+    0x04, 0x68, 0x41, 0x11, 0xe1, 0x62, 0x41, 0x41, 0xe2, 0x03, 0x81, 0xe3, 0x75, 0x40, 0x11, 0xe4,
+    0x78, 0x40, 0xf0, 0x08, 0xae, 0x05, 0x81, 0xb0, 0x05, 0x81, 0xaf, 0x05, 0x81, 0xb1, 0x05, 0x81,
+    0xa4, 0x05, 0x81, 0xa6, 0x05, 0x81, 0xa5, 0x05, 0x81, 0xa7, 0x05, 0x87, 0x40, 0x11, 0xe9, 0x8a,
+    0x40, 0x20, 0xea, 0x03, 0xfa, 0x7a, 0x11, 0x48, 0xfd, 0x7a, 0x02, 0x51, 0x75, 0x10, 0x4c, 0x54,
+    0x75, 0x00, 0x12, 0x7b, 0x11, 0x5f, 0x6d, 0x39, 0x10, 0x60, 0x70, 0x39, 0x00, 0xb7, 0x00, 0x01,
+    0xd9, 0x77, 0xf0, 0x09, 0x81, 0x54, 0x03, 0x81, 0xda, 0x05, 0x81, 0xdc, 0x05, 0x81, 0xdb, 0x05,
+    0x81, 0xdd, 0x05, 0x81, 0xde, 0x05, 0x81, 0xe0, 0x05, 0x81, 0xdf, 0x05, 0x2d, 0x66, 0x11, 0xfc,
+    0x2c, 0x38, 0x11, 0xfd, 0x2f, 0x38, 0xa1, 0x5a, 0x05, 0x81, 0x5c, 0x05, 0x81, 0x5b, 0x05, 0x81,
+    0x5d, 0xb0, 0x20, 0x11, 0xc5, 0x9b, 0x38, 0x01, 0x95, 0x1f, 0x00, 0x8f, 0x1f, 0x11, 0xc8, 0x39,
+    0x43, 0x11, 0xe4, 0x99, 0x40, 0x11, 0xe5, 0x9c, 0x40, 0x11, 0x12, 0xa0, 0x57, 0x11, 0x13, 0xa3,
+    0x57, 0xa1, 0x9e, 0x05, 0x81, 0xa0, 0x05, 0x81, 0x9f, 0x05, 0x81, 0xa1, 0x01, 0x39, 0x41, 0x8a,
+    0x05, 0x81, 0x89, 0xbb, 0x48, 0x41, 0x90, 0x05, 0x81, 0x92, 0xa9, 0x80, 0xf1, 0x01, 0x93, 0x05,
+    0x81, 0x56, 0x05, 0x81, 0x58, 0x05, 0x81, 0x57, 0x05, 0x81, 0x59, 0x05, 0x81, 0xd0, 0x6e, 0x76,
+    0x10, 0xd1, 0x71, 0x76, 0x21, 0x81, 0x66, 0xb1, 0x43, 0x11, 0x67, 0xb4, 0x43, 0x12, 0xf8, 0xbf,
+    0x59, 0xc1, 0x05, 0x81, 0xd0, 0x05, 0x81, 0xcf, 0x05, 0x81, 0xd1, 0x05, 0x81, 0xea, 0x71, 0x56,
+    0x11, 0xeb, 0x74, 0x56, 0xf0, 0x08, 0xd2, 0x05, 0x81, 0xd4, 0x05, 0x81, 0xd3, 0x05, 0x81, 0xd5,
+    0x05, 0x81, 0xd6, 0x05, 0x81, 0xd8, 0x05, 0x81, 0xd7, 0x05, 0x81, 0xd9, 0x05, 0xbb, 0x71, 0x10,
+    0xb9, 0xbe, 0x71, 0x00, 0xd8, 0x43, 0x10, 0xd3, 0xfe, 0x76, 0x00, 0xa9, 0x42, 0x11, 0xd6, 0xe4,
+    0x43, 0x11, 0xbd, 0xe7, 0x43, 0x20, 0xbe, 0x03, 0x20, 0x44, 0x11, 0x6c, 0x23, 0x44, 0x20, 0x6d,
+    0x05, 0x25, 0x39, 0x41, 0xaa, 0x04, 0x81, 0xa9, 0x7e, 0x43, 0x20, 0xa0, 0x04, 0x52, 0x77, 0x14,
+    0xa1, 0x49, 0x39, 0x11, 0xa6, 0x4c, 0x39, 0x11, 0xa7, 0x67, 0x42, 0x11, 0xce, 0x6a, 0x42, 0x11,
+    0xcf, 0x1e, 0x7e, 0x11, 0xb8, 0x21, 0x7e, 0x11, 0xb9, 0x9f, 0x43, 0x11, 0xb0, 0xa2, 0x43, 0x41,
+    0xb1, 0x04, 0x81, 0xb2, 0x88, 0x77, 0x10, 0xb3, 0x8b, 0x77, 0x00, 0x68, 0x44, 0x20, 0x7c, 0x05,
+    0x9f, 0x81, 0x20, 0x7d, 0x05, 0x09, 0x78, 0x20, 0x84, 0x05, 0x18, 0x3a, 0x11, 0x85, 0xb4, 0x49,
+    0x11, 0x80, 0xae, 0x49, 0x11, 0x81, 0xaa, 0x41, 0x11, 0x44, 0xa4, 0x41, 0xf1, 0x34, 0x45, 0x05,
+    0x10, 0x41, 0x05, 0x10, 0x42, 0x05, 0x10, 0x43, 0x05, 0x10, 0x44, 0x05, 0x10, 0x45, 0x05, 0x10,
+    0x46, 0x05, 0x10, 0x47, 0x05, 0x10, 0x48, 0x05, 0x10, 0x49, 0x05, 0x10, 0x4a, 0x05, 0x10, 0x4b,
+    0x05, 0x10, 0x4c, 0x05, 0x10, 0x4d, 0x05, 0x10, 0x4e, 0x05, 0x10, 0x4f, 0x05, 0x10, 0x50, 0x05,
+    0x10, 0x51, 0x05, 0x10, 0x52, 0x05, 0x10, 0x53, 0x05, 0x10, 0x54, 0x05, 0x10, 0x55, 0x05, 0x10,
+    0x56, 0x82, 0x57, 0x11, 0xf0, 0x85, 0x57, 0xf1, 0x03, 0xf1, 0x05, 0x10, 0x57, 0x05, 0x10, 0x58,
+    0x05, 0x10, 0x59, 0x05, 0x10, 0x5a, 0x05, 0x10, 0x5b, 0x05, 0x10, 0x84, 0x2b, 0x30, 0x10, 0x5d,
+    0x05, 0x64, 0x39, 0x11, 0x9d, 0x67, 0x39, 0x11, 0x9e, 0x88, 0x42, 0x11, 0xa5, 0x8b, 0x42, 0x10,
+    0xa6, 0x83, 0x1c, 0x00, 0xa6, 0x42, 0x00, 0x4e, 0x78, 0x10, 0x03, 0x33, 0x43, 0x11, 0x18, 0x2d,
+    0x43, 0x11, 0x19, 0x45, 0x78, 0x10, 0x10, 0x48, 0x78, 0x00, 0xea, 0x7e, 0x11, 0x12, 0x54, 0x43,
+    0x11, 0x13, 0x57, 0x43, 0x11, 0x1e, 0xdc, 0x39, 0x50, 0x1f, 0x05, 0x81, 0x21, 0x05, 0x72, 0x43,
+    0x11, 0x24, 0x75, 0x43, 0x20, 0x25, 0x05, 0x27, 0x78, 0x20, 0x1c, 0x05, 0x06, 0x3a, 0x11, 0x1d,
+    0x91, 0x39, 0x41, 0x40, 0x05, 0x81, 0x3f, 0x94, 0x42, 0x10, 0x13, 0x6b, 0x7f, 0x00, 0x77, 0x7f,
+    0x01, 0x67, 0x33, 0x21, 0x81, 0x55, 0x88, 0x02, 0x11, 0x56, 0x71, 0x65, 0x11, 0xb1, 0x62, 0x65,
+    0x02, 0x70, 0x0e, 0x01, 0x54, 0x09, 0x11, 0x10, 0x54, 0x09, 0x11, 0x10, 0x54, 0x09, 0x11, 0x10,
+    0x4e, 0x09, 0x11, 0x10, 0x4e, 0x09, 0x11, 0x10, 0x51, 0x6f, 0x11, 0x10, 0x66, 0x09, 0x21, 0x10,
+    0x65, 0xa8, 0x7e, 0x11, 0x30, 0xab, 0x7e, 0x11, 0x31, 0xe1, 0x43, 0x11, 0x28, 0xe4, 0x43, 0x41,
+    0x29, 0x05, 0x81, 0x2a, 0xa8, 0x78, 0x10, 0x2b, 0xab, 0x78, 0x00, 0xf4, 0x42, 0x11, 0x38, 0xf7,
+    0x42, 0x02, 0x2d, 0x3a, 0x11, 0x3c, 0x30, 0x3a, 0x11, 0x3d, 0x21, 0x43, 0x11, 0x34, 0x24, 0x43,
+    0xa1, 0x35, 0x05, 0x10, 0x66, 0x05, 0x10, 0x67, 0x05, 0x81, 0x2d, 0x02, 0x79, 0x10, 0x2e, 0x05,
+    0x79, 0x30, 0x81, 0xf4, 0x04, 0x5e, 0x45, 0x14, 0xf5, 0x61, 0x45, 0x20, 0xfa, 0x04, 0x5b, 0x45,
+    0x20, 0xfb, 0x04, 0x67, 0x45, 0x11, 0x0a, 0x6a, 0x45, 0x20, 0x0b, 0x05, 0x88, 0x45, 0x11, 0x06,
+    0x8b, 0x45, 0x20, 0x07, 0x05, 0x7e, 0x43, 0x11, 0xde, 0x81, 0x43, 0x02, 0xa5, 0x3a, 0x11, 0xe2,
+    0xa8, 0x3a, 0x11, 0xe3, 0xed, 0x78, 0x10, 0xf2, 0xf0, 0x78, 0x03, 0xc0, 0x7e, 0x11, 0xee, 0xc3,
+    0x7e, 0xe0, 0xef, 0x04, 0x81, 0x4e, 0x05, 0x81, 0x50, 0x05, 0x81, 0x4f, 0x05, 0x81, 0x51, 0x05,
+    0xee, 0x45, 0xf1, 0x15, 0xad, 0x04, 0x10, 0x68, 0x05, 0x10, 0x69, 0x05, 0x10, 0x6a, 0x05, 0x10,
+    0x6b, 0x05, 0x10, 0x6c, 0x05, 0x10, 0x6d, 0x05, 0x10, 0x6e, 0x05, 0x10, 0x6f, 0x05, 0x10, 0x70,
+    0x05, 0x10, 0x71, 0x05, 0x10, 0x72, 0x05, 0x10, 0x2a, 0x43, 0x11, 0x10, 0xe0, 0x2c, 0xf1, 0x3a,
+    0x10, 0x75, 0x05, 0x10, 0x76, 0x05, 0x10, 0x77, 0x05, 0x10, 0x78, 0x05, 0x10, 0x79, 0x05, 0x10,
+    0x7a, 0x05, 0x10, 0x7b, 0x05, 0x10, 0x7c, 0x05, 0x10, 0x7d, 0x05, 0x10, 0x7e, 0x05, 0x10, 0x7f,
+    0x05, 0x10, 0x80, 0x05, 0x10, 0x81, 0x05, 0x10, 0x82, 0x05, 0x10, 0x83, 0x05, 0x10, 0x84, 0x05,
+    0x10, 0x85, 0x05, 0x10, 0x86, 0x05, 0x10, 0x87, 0x05, 0x10, 0x88, 0x05, 0x10, 0x89, 0x05, 0x10,
+    0x8a, 0x05, 0x10, 0x8b, 0x05, 0x10, 0x8c, 0x05, 0x10, 0xc1, 0x05, 0x41, 0x10, 0x8e, 0x05, 0x10,
+    0xd6, 0x05, 0xf1, 0x07, 0x10, 0x90, 0x05, 0x10, 0x91, 0x05, 0x10, 0x92, 0x05, 0x10, 0x93, 0x05,
+    0x10, 0x94, 0x05, 0x10, 0x95, 0x05, 0x10, 0x96, 0x05, 0x10, 0xb0, 0x2c, 0x11, 0x10, 0x57, 0x84,
+    0x11, 0x10, 0xb3, 0x2c, 0x21, 0x10, 0x9a, 0x06, 0x00, 0x01, 0xb6, 0x2c, 0x11, 0x10, 0x5d, 0x06,
+    0x11, 0x10, 0x5d, 0x06, 0x21, 0x10, 0x9e, 0x06, 0x00, 0x01, 0xbc, 0x2c, 0x10, 0x10, 0xa2, 0xcf,
+    0x21, 0x00, 0x10, 0xbf, 0x2c, 0x11, 0x10, 0x69, 0x06, 0xf1, 0xb3, 0x10, 0xa3, 0x05, 0x10, 0xa4,
+    0x05, 0x10, 0xa5, 0x05, 0x10, 0xa6, 0x05, 0x10, 0xa7, 0x05, 0x10, 0xa8, 0x05, 0x10, 0xa9, 0x05,
+    0x10, 0xaa, 0x05, 0x10, 0xab, 0x05, 0x10, 0xac, 0x05, 0x10, 0xad, 0x05, 0x10, 0xae, 0x05, 0x10,
+    0xaf, 0x05, 0x10, 0xb0, 0x05, 0x10, 0xb1, 0x05, 0x10, 0xb2, 0x05, 0x10, 0xb3, 0x05, 0x10, 0xb4,
+    0x05, 0x10, 0xb5, 0x05, 0x10, 0xb6, 0x05, 0x10, 0xb7, 0x05, 0x10, 0xb8, 0x05, 0x10, 0xb9, 0x05,
+    0x10, 0xba, 0x05, 0x10, 0xbb, 0x05, 0x10, 0xbc, 0x05, 0x10, 0xbd, 0x05, 0x10, 0xbe, 0x05, 0x10,
+    0xbf, 0x05, 0x10, 0xc0, 0x05, 0x10, 0xc1, 0x05, 0x10, 0xc2, 0x05, 0x10, 0xc3, 0x05, 0x10, 0xc4,
+    0x05, 0x10, 0xc5, 0x05, 0x10, 0xc6, 0x05, 0x10, 0xc7, 0x05, 0x10, 0xc8, 0x05, 0x10, 0xc9, 0x05,
+    0x10, 0xca, 0x05, 0x10, 0xcb, 0x05, 0x10, 0xcc, 0x05, 0x10, 0xcd, 0x05, 0x10, 0xce, 0x05, 0x10,
+    0xcf, 0x05, 0x10, 0xd0, 0x05, 0x10, 0xd1, 0x05, 0x10, 0xd2, 0x05, 0x10, 0xd3, 0x05, 0x10, 0xd4,
+    0x05, 0x10, 0xd5, 0x05, 0x10, 0xd6, 0x05, 0x10, 0xd7, 0x05, 0x10, 0xd8, 0x05, 0x10, 0xd9, 0x05,
+    0x10, 0xda, 0x05, 0x10, 0xdb, 0x05, 0x10, 0xdc, 0x05, 0x10, 0xdd, 0x05, 0x10, 0xde, 0x05, 0x10,
+    0xdf, 0x05, 0x10, 0xe0, 0x05, 0x10, 0xe1, 0x05, 0x10, 0xe2, 0x05, 0x10, 0xe3, 0xc6, 0x00, 0x01,
+    0x56, 0x2c, 0x21, 0x10, 0xe5, 0x06, 0x00, 0x01, 0x59, 0x2c, 0xf3, 0x78, 0x10, 0xe7, 0x05, 0x10,
+    0xe8, 0x05, 0x10, 0xe9, 0x05, 0x10, 0xea, 0x05, 0x10, 0xeb, 0x05, 0x10, 0xec, 0x05, 0x10, 0xed,
+    0x05, 0x10, 0xee, 0x05, 0x10, 0xef, 0x05, 0x10, 0xf0, 0x05, 0x10, 0xf1, 0x05, 0x10, 0xf2, 0x05,
+    0x10, 0xf3, 0x05, 0x10, 0xf4, 0x05, 0x10, 0xf5, 0x05, 0x10, 0xf6, 0x05, 0x10, 0xf7, 0x05, 0x10,
+    0xf8, 0x05, 0x10, 0xf9, 0x05, 0x10, 0xfa, 0x05, 0x10, 0xfb, 0x05, 0x10, 0xfc, 0x05, 0x10, 0xfd,
+    0x05, 0x10, 0xfe, 0x05, 0x10, 0xff, 0x05, 0x10, 0x00, 0x06, 0x10, 0x01, 0x06, 0x10, 0x02, 0x06,
+    0x10, 0x03, 0x06, 0x10, 0x04, 0x06, 0x10, 0x05, 0x06, 0x10, 0x06, 0x06, 0x10, 0x07, 0x06, 0x10,
+    0x08, 0x06, 0x10, 0x09, 0x06, 0x10, 0x0a, 0x06, 0x10, 0x0b, 0x06, 0x10, 0x0c, 0x06, 0x10, 0x0d,
+    0x06, 0x10, 0x0e, 0x06, 0x10, 0x0f, 0x06, 0x10, 0x10, 0x06, 0x10, 0x11, 0x06, 0x10, 0x12, 0x06,
+    0x10, 0x13, 0x06, 0x74, 0x22, 0x11, 0xcf, 0x59, 0x22, 0x11, 0xd0, 0x5c, 0x22, 0x11, 0xd3, 0x35,
+    0x22, 0x11, 0xd4, 0xf5, 0x38, 0x11, 0xc7, 0x77, 0x22, 0x11, 0xc8, 0x7a, 0x22, 0x11, 0xcb, 0x53,
+    0x22, 0x10, 0xcc, 0x56, 0x22, 0xf1, 0x3e, 0x10, 0x14, 0x06, 0x10, 0x15, 0x06, 0x81, 0x99, 0x00,
+    0x81, 0x9a, 0x00, 0x10, 0x16, 0x06, 0x10, 0x17, 0x06, 0x10, 0x18, 0x06, 0x10, 0x19, 0x06, 0x10,
+    0x1a, 0x06, 0x10, 0x1b, 0x06, 0x10, 0x1c, 0x06, 0x10, 0x1d, 0x06, 0x10, 0x1e, 0x06, 0x10, 0x1f,
+    0x06, 0x10, 0x20, 0x06, 0x10, 0x21, 0x06, 0x10, 0x22, 0x06, 0x10, 0x23, 0x06, 0x10, 0x24, 0x06,
+    0x10, 0x25, 0x06, 0x10, 0x26, 0x06, 0x10, 0x27, 0x06, 0x8b, 0x20, 0x06, 0x8b, 0x22, 0x06, 0x8b,
+    0x21, 0x06, 0x8b, 0x23, 0xef, 0x6d, 0x11, 0x1e, 0xdd, 0x6d, 0xf0, 0x7f, 0x1f, 0x06, 0x8b, 0x26,
+    0x06, 0x8b, 0x27, 0x06, 0x8b, 0x24, 0x06, 0x8b, 0x25, 0x06, 0x8b, 0xf3, 0x00, 0x8b, 0xf5, 0x00,
+    0x8b, 0xf4, 0x00, 0x8b, 0xf6, 0x00, 0x8b, 0xef, 0x00, 0x8b, 0xf1, 0x00, 0x8b, 0xf0, 0x00, 0x8b,
+    0xf2, 0x00, 0x8b, 0xf3, 0x03, 0x8b, 0xf5, 0x03, 0x8b, 0xf4, 0x03, 0x8b, 0xf6, 0x03, 0x8b, 0xd7,
+    0x03, 0x8b, 0xd9, 0x03, 0x8b, 0xd8, 0x03, 0x8b, 0xda, 0x03, 0x8b, 0x8d, 0x04, 0x8b, 0x8e, 0x04,
+    0x8b, 0x96, 0x04, 0x8b, 0x97, 0x04, 0x10, 0x28, 0x06, 0x10, 0x29, 0x06, 0x8b, 0x91, 0x04, 0x8b,
+    0x92, 0x04, 0x8b, 0x89, 0x01, 0x8b, 0x8a, 0x01, 0x10, 0x2a, 0x06, 0x10, 0x2b, 0x06, 0x10, 0x2c,
+    0x06, 0x10, 0x2d, 0x06, 0x10, 0x2e, 0x06, 0x10, 0x2f, 0x06, 0x10, 0x30, 0x06, 0x10, 0x31, 0x06,
+    0x8b, 0xba, 0x04, 0x8b, 0xbb, 0x04, 0x8b, 0xf3, 0x02, 0x8b, 0xf4, 0x02, 0x10, 0x32, 0x06, 0x10,
+    0x33, 0x06, 0x8b, 0xbe, 0x04, 0x8b, 0xbf, 0x04, 0x10, 0x34, 0xfb, 0x0a, 0x11, 0x10, 0x95, 0x2c,
+    0x21, 0x10, 0x36, 0x06, 0x00, 0x01, 0xda, 0x59, 0xd1, 0x10, 0x38, 0x06, 0x10, 0x39, 0x06, 0x10,
+    0x3a, 0x06, 0x10, 0x3b, 0x06, 0x10, 0x98, 0x2c, 0xf4, 0xff, 0x5c, 0x8b, 0x81, 0x01, 0x8b, 0x83,
+    0x01, 0x8b, 0x82, 0x01, 0x8b, 0x84, 0x01, 0x8b, 0x7f, 0x01, 0x8b, 0x80, 0x01, 0x8b, 0x83, 0x03,
+    0x8b, 0x85, 0x03, 0x8b, 0x84, 0x03, 0x8b, 0x86, 0x03, 0x8b, 0x07, 0x04, 0x8b, 0x09, 0x04, 0x8b,
+    0x08, 0x04, 0x8b, 0x0a, 0x04, 0x10, 0x3d, 0x06, 0x10, 0x3e, 0x06, 0x10, 0x3f, 0x06, 0x10, 0x40,
+    0x06, 0x10, 0x41, 0x06, 0x10, 0x42, 0x06, 0x10, 0x43, 0x06, 0x10, 0x44, 0x06, 0x10, 0x45, 0x06,
+    0x10, 0x46, 0x06, 0x10, 0x47, 0x06, 0x10, 0x48, 0x06, 0x10, 0x49, 0x06, 0x10, 0x4a, 0x06, 0x10,
+    0x4b, 0x06, 0x10, 0x4c, 0x06, 0x10, 0x4d, 0x06, 0x10, 0x4e, 0x06, 0x10, 0x4f, 0x06, 0x10, 0x50,
+    0x06, 0x10, 0x51, 0x06, 0x10, 0x52, 0x06, 0x10, 0x53, 0x06, 0x10, 0x54, 0x06, 0x10, 0x55, 0x06,
+    0x10, 0x56, 0x06, 0x10, 0x57, 0x06, 0x10, 0x58, 0x06, 0x10, 0x59, 0x06, 0x10, 0x5a, 0x06, 0x10,
+    0x5b, 0x06, 0x10, 0x5c, 0x06, 0x10, 0x5d, 0x06, 0x10, 0x5e, 0x06, 0x10, 0x5f, 0x06, 0x10, 0x60,
+    0x06, 0x10, 0x61, 0x06, 0x10, 0x62, 0x06, 0x10, 0x63, 0x06, 0x10, 0x64, 0x06, 0x8b, 0x23, 0x04,
+    0x8b, 0x24, 0x04, 0x10, 0x65, 0x06, 0x10, 0x66, 0x06, 0x8b, 0x37, 0x04, 0x8b, 0x38, 0x04, 0x8b,
+    0x35, 0x04, 0x8b, 0x36, 0x04, 0x10, 0x67, 0x06, 0x10, 0x68, 0x06, 0x10, 0x69, 0x06, 0x10, 0x6a,
+    0x06, 0x10, 0x6b, 0x06, 0x10, 0x6c, 0x06, 0x10, 0x6d, 0x06, 0x10, 0x6e, 0x06, 0x10, 0x6f, 0x06,
+    0x10, 0x70, 0x06, 0x10, 0x71, 0x06, 0x10, 0x72, 0x06, 0x10, 0x73, 0x06, 0x10, 0x74, 0x06, 0x10,
+    0x75, 0x06, 0x10, 0x76, 0x06, 0x10, 0x77, 0x06, 0x10, 0x78, 0x06, 0x10, 0x79, 0x06, 0x10, 0x7a,
+    0x06, 0x10, 0x7b, 0x06, 0x10, 0x7c, 0x06, 0x10, 0x7d, 0x06, 0x10, 0x7e, 0x06, 0x10, 0x7f, 0x06,
+    0x10, 0x80, 0x06, 0x10, 0x81, 0x06, 0x10, 0x82, 0x06, 0x10, 0x83, 0x06, 0x10, 0x84, 0x06, 0x10,
+    0x85, 0x06, 0x10, 0x86, 0x06, 0x10, 0x87, 0x06, 0x10, 0x88, 0x06, 0x10, 0x89, 0x06, 0x10, 0x8a,
+    0x06, 0x10, 0x8b, 0x06, 0x10, 0x8c, 0x06, 0x10, 0x8d, 0x06, 0x10, 0x8e, 0x06, 0x10, 0x8f, 0x06,
+    0x10, 0x90, 0x06, 0x10, 0x91, 0x06, 0x10, 0x92, 0x06, 0x10, 0x93, 0x06, 0x10, 0x94, 0x06, 0x10,
+    0x95, 0x06, 0x10, 0x96, 0x06, 0x10, 0x97, 0x06, 0x10, 0x98, 0x06, 0x10, 0x99, 0x06, 0x10, 0x9a,
+    0x06, 0x10, 0x9b, 0x06, 0x10, 0x9c, 0x06, 0x10, 0x9d, 0x06, 0x10, 0x9e, 0x06, 0x8b, 0xd9, 0x00,
+    0x8b, 0xda, 0x00, 0x81, 0x6f, 0xa7, 0x85, 0x11, 0x72, 0xa7, 0x85, 0x41, 0x6d, 0x03, 0x81, 0x6c,
+    0xe4, 0x7e, 0x11, 0x67, 0x31, 0x4b, 0x10, 0x68, 0xbf, 0x85, 0xf2, 0x03, 0x10, 0x9f, 0x06, 0x10,
+    0xa0, 0x06, 0x81, 0x55, 0x01, 0x81, 0x56, 0x01, 0x10, 0xa1, 0x06, 0x10, 0xa2, 0x06, 0x95, 0x6b,
+    0x63, 0x10, 0xa3, 0x06, 0x10, 0xa4, 0x06, 0x4c, 0x42, 0x02, 0xaf, 0x3c, 0x02, 0x0f, 0x61, 0x01,
+    0x49, 0x7a, 0x20, 0x81, 0xbd, 0x22, 0x74, 0x00, 0x1f, 0x23, 0xa1, 0x92, 0x03, 0x81, 0x57, 0x01,
+    0x81, 0x58, 0x01, 0x81, 0x63, 0xaa, 0x59, 0x11, 0x64, 0xad, 0x59, 0x11, 0x4d, 0x4d, 0x59, 0x53,
+    0x17, 0x03, 0x81, 0x18, 0x03, 0x46, 0x3f, 0x02, 0x0c, 0x12, 0x11, 0x3d, 0xb8, 0x77, 0x10, 0x3e,
+    0xbb, 0x77, 0xc3, 0x8b, 0x72, 0x05, 0x8b, 0x74, 0x05, 0x8b, 0x73, 0x05, 0x8b, 0x75, 0x05, 0x68,
+    0x41, 0x20, 0x41, 0x03, 0x0b, 0x6b, 0x11, 0x42, 0x0e, 0x6b, 0x05, 0xcb, 0x59, 0x31, 0x15, 0x00,
+    0x10, 0xc2, 0x2c, 0x11, 0x10, 0xe2, 0x3f, 0x11, 0x10, 0xc5, 0x2c, 0x60, 0x8b, 0x11, 0x01, 0x8b,
+    0x12, 0x01, 0x78, 0x55, 0x11, 0x19, 0x7b, 0x55, 0x01, 0xc1, 0x2a, 0xf1, 0x0d, 0x10, 0xa9, 0x06,
+    0x10, 0xaa, 0x06, 0x10, 0xab, 0x06, 0x10, 0xac, 0x06, 0x10, 0xad, 0x06, 0x10, 0xae, 0x06, 0x10,
+    0xaf, 0x06, 0x10, 0xb0, 0x06, 0x10, 0xb1, 0x06, 0x10, 0xb4, 0x7b, 0x11, 0x10, 0xce, 0x2c, 0xa1,
+    0x10, 0xb4, 0x06, 0x10, 0xb5, 0x06, 0x10, 0xb6, 0x06, 0x10, 0xbf, 0x2c, 0x21, 0x10, 0xb8, 0x06,
+    0x00, 0x01, 0xc2, 0x2c, 0x21, 0x10, 0xba, 0x06, 0x00, 0x82, 0xbb, 0x06, 0x10, 0xbc, 0x06, 0x10,
+    0xbd, 0x06, 0x57, 0x55, 0xf6, 0x00, 0x10, 0xbe, 0x06, 0x10, 0xbf, 0x06, 0x81, 0x93, 0x00, 0x81,
+    0x94, 0x00, 0x81, 0x63, 0x03, 0x81, 0x4c, 0x11, 0x31, 0x88, 0x3c, 0x10, 0x32, 0x9f, 0x78, 0x53,
+    0x10, 0xc0, 0x06, 0x10, 0xc1, 0x87, 0x61, 0x62, 0x10, 0xc2, 0x06, 0x10, 0xc3, 0x06, 0xf1, 0x60,
+    0x90, 0x10, 0xc4, 0x06, 0x10, 0xc5, 0x06, 0x81, 0x47, 0x01, 0x39, 0x5e, 0x11, 0x3e, 0x9c, 0x6f,
+    0x02, 0xb9, 0x4d, 0x02, 0x5d, 0x24, 0x03, 0x4b, 0x5e, 0x01, 0x88, 0x5a, 0x50, 0x15, 0x03, 0x81,
+    0x16, 0x03, 0x81, 0x40, 0x22, 0x7c, 0x01, 0x3e, 0x13, 0xc0, 0x8b, 0x76, 0x05, 0x8b, 0x78, 0x05,
+    0x8b, 0x77, 0x05, 0x8b, 0x79, 0x05, 0x33, 0x5e, 0x41, 0xe5, 0x02, 0x81, 0xe4, 0x13, 0x60, 0x11,
+    0xeb, 0x93, 0x61, 0x10, 0xec, 0x96, 0x61, 0x21, 0x10, 0xc6, 0x6d, 0x0e, 0x11, 0x3c, 0xeb, 0x0e,
+    0x11, 0xc7, 0x0c, 0x00, 0x11, 0x3e, 0x0c, 0x00, 0x14, 0xc8, 0x3e, 0x01, 0x31, 0x14, 0x00, 0x10,
+    0x70, 0x2d, 0x60, 0x8b, 0x0f, 0x01, 0x8b, 0x10, 0x01, 0xd8, 0x40, 0x11, 0xc5, 0xde, 0x75, 0x10,
+    0xc6, 0xd1, 0x91, 0x00, 0x2b, 0x60, 0x10, 0x2c, 0x2e, 0x60, 0x00, 0x2a, 0x00, 0x11, 0xf5, 0xff,
+    0x09, 0x43, 0xf6, 0x02, 0x10, 0xca, 0x3c, 0x00, 0xf1, 0x0e, 0x10, 0xcb, 0x06, 0x10, 0xcc, 0x06,
+    0x10, 0xcd, 0x06, 0x10, 0xce, 0x06, 0x10, 0xcf, 0x06, 0x10, 0xd0, 0x06, 0x10, 0xd1, 0x06, 0x10,
+    0xd2, 0x06, 0x10, 0xd3, 0x06, 0x10, 0xd4, 0x29, 0x01, 0x14, 0xd5, 0x2a, 0x00, 0x01, 0xa6, 0x2d,
+    0x90, 0x10, 0xd7, 0x06, 0x10, 0xd8, 0x06, 0x10, 0xd9, 0x06, 0x58, 0x51, 0x80, 0x80, 0x00, 0x10,
+    0xda, 0x06, 0x10, 0xdb, 0x06, 0x91, 0x51, 0x73, 0x7a, 0x00, 0x10, 0xdc, 0x06, 0x10, 0xdd, 0xe6,
+    0x25, 0x62, 0x10, 0xde, 0x06, 0x10, 0xdf, 0x06, 0x54, 0x5b, 0x00, 0x30, 0x12, 0xf1, 0x5d, 0x1f,
+    0x01, 0x09, 0x55, 0x00, 0x09, 0x56, 0x00, 0x09, 0x57, 0x00, 0x09, 0x58, 0x00, 0x09, 0x59, 0x00,
+    0x09, 0x5a, 0x00, 0x09, 0x5b, 0x00, 0x09, 0x5c, 0x00, 0x09, 0x5d, 0x00, 0x09, 0x5e, 0x00, 0x09,
+    0x5f, 0x00, 0x09, 0x60, 0x00, 0x09, 0x61, 0x00, 0x09, 0x62, 0x00, 0x09, 0x63, 0x00, 0x09, 0x64,
+    0x00, 0x09, 0x65, 0x00, 0x09, 0x66, 0x00, 0x09, 0x67, 0x00, 0x09, 0x68, 0x00, 0x09, 0x69, 0x00,
+    0x09, 0x6a, 0x00, 0x09, 0x6b, 0x00, 0x09, 0x6c, 0x00, 0x09, 0x6d, 0x00, 0x09, 0x6e, 0x00, 0x09,
+    0x6f, 0x00, 0x09, 0x70, 0x00, 0x09, 0x71, 0x00, 0x09, 0x72, 0x00, 0x09, 0x73, 0x00, 0x09, 0x74,
+    0x00, 0x09, 0x75, 0x00, 0x09, 0x76, 0x00, 0x09, 0x77, 0x00, 0x09, 0x25, 0x92, 0x05, 0x01, 0x00,
+    0x10, 0x17, 0x4c, 0xe5, 0x11, 0x00, 0x8f, 0x8a, 0x00, 0x2f, 0x3e, 0x00, 0x2e, 0x11, 0x11, 0x38,
+    0xe2, 0x0e, 0x02, 0x15, 0x61, 0x02, 0x27, 0x61, 0x02, 0x52, 0x63, 0x20, 0x4e, 0x01, 0xdd, 0x01,
+    0x20, 0x54, 0x01, 0x27, 0x03, 0x02, 0x6a, 0x63, 0x02, 0xbf, 0x44, 0x20, 0x32, 0x01, 0x13, 0x45,
+    0x02, 0xc5, 0x44, 0x02, 0x19, 0x45, 0x02, 0xda, 0x59, 0x02, 0xfe, 0x2b, 0x53, 0x3c, 0x00, 0x81,
+    0x3d, 0x00, 0xf2, 0x59, 0x02, 0xfe, 0x2b, 0x50, 0x3e, 0x00, 0x81, 0x3f, 0x00, 0x08, 0x13, 0x23,
+    0x46, 0x03, 0x52, 0x14, 0x02, 0x88, 0x60, 0x11, 0x72, 0x70, 0x57, 0x01, 0x91, 0x57, 0xb1, 0x8b,
+    0x97, 0x04, 0x8b, 0x99, 0x04, 0x8b, 0x98, 0x04, 0x8b, 0x9a, 0x67, 0x05, 0x50, 0xbd, 0x04, 0x8b,
+    0xbc, 0x04, 0x61, 0x05, 0xf0, 0x08, 0x7d, 0x04, 0x8b, 0x7e, 0x04, 0x8b, 0x7f, 0x04, 0x8b, 0x80,
+    0x04, 0x8b, 0x79, 0x04, 0x8b, 0x7a, 0x04, 0x8b, 0x7b, 0x04, 0x8b, 0x7c, 0x04, 0x88, 0x02, 0x11,
+    0x65, 0xac, 0x0e, 0x11, 0x67, 0x8e, 0x02, 0x11, 0x66, 0xb2, 0x0e, 0x11, 0x68, 0xe6, 0x0d, 0x11,
+    0x6b, 0x72, 0x03, 0x11, 0x6d, 0xec, 0x0d, 0x11, 0x6c, 0x78, 0x03, 0x20, 0x6e, 0x03, 0xa9, 0x63,
+    0x14, 0x46, 0xac, 0x45, 0x02, 0xb8, 0x45, 0x02, 0x90, 0x5b, 0x11, 0x88, 0xab, 0x5b, 0x02, 0x05,
+    0x5c, 0x11, 0x12, 0xd7, 0x62, 0x02, 0xb7, 0x5b, 0x11, 0x8e, 0x1d, 0x5c, 0x01, 0x0e, 0x5c, 0x02,
+    0xe3, 0x78, 0x02, 0xa4, 0x2e, 0x01, 0xd8, 0x66, 0x11, 0x00, 0xce, 0x15, 0x12, 0x00, 0xef, 0x3d,
+    0x01, 0xf9, 0x11, 0x11, 0x00, 0x2d, 0x33, 0x22, 0x00, 0x12, 0xb2, 0x95, 0x01, 0xe0, 0x4c, 0x11,
+    0x12, 0x06, 0x00, 0x10, 0x0f, 0x85, 0x56, 0x21, 0x00, 0x12, 0x50, 0x49, 0x12, 0x12, 0x0c, 0x00,
+    0x01, 0x00, 0x7b, 0x11, 0x12, 0xf7, 0x7a, 0x02, 0x44, 0x4c, 0x11, 0x12, 0x9d, 0x2c, 0x00, 0x70,
+    0xdc, 0x00, 0x4e, 0x67, 0x01, 0x06, 0x00, 0x01, 0x75, 0x68, 0x11, 0x12, 0x79, 0x00, 0x11, 0x12,
+    0x50, 0x79, 0x11, 0x12, 0x28, 0x98, 0x12, 0x12, 0xb8, 0x95, 0x02, 0x0c, 0x00, 0x01, 0xf5, 0x6b,
+    0x11, 0x0f, 0x06, 0x00, 0x12, 0x12, 0xca, 0x95, 0x11, 0x18, 0x0c, 0x00, 0x01, 0x06, 0x00, 0x11,
+    0x0f, 0xd7, 0x1f, 0x12, 0x12, 0xdc, 0x95, 0x01, 0xd7, 0x1f, 0x11, 0x12, 0x12, 0x00, 0x11, 0x0f,
+    0x9b, 0x1f, 0x12, 0x12, 0xee, 0x95, 0x01, 0x9b, 0x1f, 0x11, 0x12, 0x1e, 0x00, 0x11, 0x0f, 0xcd,
+    0x2e, 0xd1, 0x12, 0x1d, 0x00, 0x12, 0x1e, 0x00, 0x0f, 0x25, 0x00, 0x0f, 0x26, 0x00, 0x12, 0xbf,
+    0x1f, 0x10, 0x0f, 0x1b, 0x9c, 0x21, 0x00, 0x12, 0x2a, 0x00, 0x11, 0x0f, 0x33, 0x18, 0x11, 0x12,
+    0x98, 0x82, 0x11, 0x0f, 0x1b, 0x18, 0x11, 0x12, 0x36, 0x00, 0x10, 0x0f, 0xa9, 0xd1, 0xf1, 0x0b,
+    0x00, 0x12, 0x23, 0x00, 0x12, 0x24, 0x00, 0x0f, 0x31, 0x00, 0x0f, 0x32, 0x00, 0x12, 0x25, 0x00,
+    0x12, 0x26, 0x00, 0x0f, 0x35, 0x00, 0x0f, 0x36, 0x00, 0x12, 0xca, 0x77, 0x11, 0x0f, 0x5b, 0x26,
+    0x11, 0x12, 0x4e, 0x00, 0x21, 0x0f, 0x3a, 0x0c, 0x00, 0x02, 0xd6, 0x77, 0x01, 0xc6, 0x03, 0x12,
+    0x12, 0x5a, 0x00, 0x11, 0x2b, 0x06, 0x00, 0x01, 0x5a, 0x00, 0x11, 0x0f, 0xd2, 0x03, 0x11, 0x12,
+    0xd5, 0x4c, 0x12, 0x12, 0x60, 0x00, 0x01, 0xf1, 0xd1, 0x11, 0x0f, 0x50, 0x6a, 0x11, 0x12, 0xbe,
+    0x77, 0x11, 0x12, 0xc5, 0x1f, 0x11, 0x12, 0x4f, 0x69, 0x11, 0x0f, 0x68, 0x97, 0x11, 0x12, 0xca,
+    0x77, 0x11, 0x12, 0xba, 0x75, 0x11, 0x12, 0x1c, 0xc8, 0x11, 0x0f, 0xa9, 0x26, 0x21, 0x12, 0x36,
+    0x06, 0x00, 0x00, 0xe6, 0xc4, 0x22, 0x00, 0x12, 0x8a, 0x00, 0x01, 0x96, 0x96, 0x12, 0x12, 0x8a,
+    0x00, 0x00, 0x85, 0xbc, 0x21, 0x00, 0x12, 0x8a, 0x00, 0x21, 0x0f, 0x46, 0x0c, 0x00, 0x01, 0xad,
+    0xaf, 0x11, 0x0f, 0x2d, 0xea, 0x11, 0x12, 0x8a, 0x00, 0x11, 0x0f, 0xe7, 0x15, 0x11, 0x12, 0x09,
+    0x27, 0x21, 0x0f, 0x4c, 0x0c, 0x00, 0xc1, 0x40, 0x00, 0x12, 0x41, 0x00, 0x0f, 0x4f, 0x00, 0x0f,
+    0x50, 0x00, 0x12, 0x7e, 0x00, 0x10, 0x0f, 0xf3, 0x9f, 0x21, 0x00, 0x12, 0x0d, 0xaa, 0x11, 0x0f,
+    0x4c, 0x9e, 0x11, 0x12, 0x7e, 0x00, 0x11, 0x0f, 0xdd, 0x79, 0x11, 0x12, 0x35, 0xf4, 0x11, 0x0f,
+    0x83, 0x9d, 0x11, 0x12, 0x66, 0x00, 0x10, 0x0f, 0x09, 0x9c, 0x21, 0x00, 0x12, 0x17, 0x7c, 0x21,
+    0x0f, 0x5c, 0x0c, 0x00, 0x01, 0x72, 0x00, 0x21, 0x0f, 0x5e, 0x0c, 0x00, 0x00, 0x7d, 0xaf, 0x31,
+    0x00, 0x0f, 0x60, 0x0c, 0x00, 0x02, 0x7e, 0x00, 0x02, 0x9d, 0xdd, 0x32, 0x00, 0x00, 0x12, 0x81,
+    0x00, 0x00, 0x04, 0x9b, 0x31, 0x00, 0x12, 0x4e, 0x06, 0x00, 0x11, 0x4f, 0x06, 0x00, 0x01, 0x0e,
+    0x9d, 0x21, 0x12, 0x51, 0x06, 0x00, 0x01, 0x8d, 0x00, 0x21, 0x0f, 0x68, 0x0c, 0x00, 0x01, 0x94,
+    0x98, 0x21, 0x0f, 0x6a, 0x0c, 0x00, 0x02, 0x99, 0x00, 0x11, 0x55, 0x06, 0x00, 0x02, 0x99, 0x00,
+    0x01, 0x76, 0x7a, 0x12, 0x12, 0x99, 0x00, 0x11, 0x59, 0x06, 0x00, 0x02, 0x99, 0x00, 0x01, 0x20,
+    0x2e, 0x12, 0x12, 0x99, 0x00, 0x01, 0x4c, 0x9b, 0x12, 0x12, 0x99, 0x00, 0x11, 0x5f, 0x4e, 0x00,
+    0x11, 0x73, 0x0c, 0x00, 0x01, 0x9f, 0x00, 0x21, 0x0f, 0x75, 0x0c, 0x00, 0x02, 0x11, 0x97, 0x11,
+    0x77, 0x0c, 0x00, 0x02, 0x17, 0x97, 0x11, 0x79, 0x0c, 0x00, 0x02, 0x1d, 0x97, 0x01, 0x92, 0x56,
+    0x12, 0x12, 0x23, 0x97, 0x11, 0x7d, 0x0c, 0x00, 0x02, 0x29, 0x97, 0x01, 0xea, 0x6a, 0x12, 0x12,
+    0x2f, 0x97, 0x32, 0x81, 0x00, 0x12, 0x32, 0x97, 0x05, 0xd2, 0x6a, 0x01, 0xc0, 0x00, 0x21, 0x0f,
+    0x85, 0x0c, 0x00, 0x02, 0x47, 0x97, 0x01, 0x11, 0x6b, 0x11, 0x12, 0xcc, 0x00, 0x11, 0x0f, 0xf6,
+    0x5b, 0x12, 0x12, 0x59, 0x97, 0x32, 0x8b, 0x00, 0x12, 0x44, 0x97, 0x02, 0xc4, 0x7a, 0x01, 0x87,
+    0x00, 0x21, 0x0f, 0x99, 0x0c, 0x00, 0x01, 0x04, 0x57, 0x11, 0x0f, 0xb6, 0x7f, 0x11, 0x12, 0x6f,
+    0x00, 0x14, 0x0f, 0xb7, 0x7b, 0x11, 0x12, 0x92, 0x2e, 0x11, 0x0f, 0x9d, 0xf5, 0x11, 0x12, 0x98,
+    0x2e, 0xf2, 0x0d, 0x0f, 0xa7, 0x00, 0x12, 0x82, 0x00, 0x06, 0x73, 0x00, 0x12, 0x85, 0x00, 0x06,
+    0x74, 0x00, 0x12, 0x88, 0x00, 0x12, 0x89, 0x00, 0x12, 0x8a, 0x00, 0x12, 0x8b, 0x00, 0x12, 0x32,
+    0x97, 0x01, 0x22, 0x74, 0xd1, 0x12, 0x93, 0x00, 0x12, 0x94, 0x00, 0x12, 0x95, 0x00, 0x12, 0x96,
+    0x00, 0x12, 0x0e, 0x97, 0x72, 0x12, 0x98, 0x00, 0x12, 0x99, 0x00, 0x12, 0x0e, 0x97, 0xc1, 0xc2,
+    0x00, 0x0f, 0xc3, 0x00, 0x0f, 0xc4, 0x00, 0x0f, 0xc5, 0x00, 0x0f, 0xfd, 0xf2, 0x84, 0x0f, 0xc7,
+    0x00, 0x0f, 0xc8, 0x00, 0x0f, 0xc9, 0x78, 0x00, 0x01, 0x2f, 0x97, 0x12, 0x12, 0x29, 0x97, 0x11,
+    0xce, 0x06, 0x00, 0x31, 0xd0, 0x00, 0x12, 0x87, 0x00, 0x11, 0x0f, 0x84, 0x40, 0xf1, 0x37, 0x12,
+    0xa6, 0x00, 0x12, 0xa7, 0x00, 0x0f, 0xda, 0x00, 0x0f, 0xdb, 0x00, 0x12, 0xa8, 0x00, 0x12, 0xa9,
+    0x00, 0x0f, 0xde, 0x00, 0x0f, 0xdf, 0x00, 0x12, 0xaa, 0x00, 0x12, 0xab, 0x00, 0x0f, 0xe2, 0x00,
+    0x0f, 0xe3, 0x00, 0x12, 0xac, 0x00, 0x12, 0xad, 0x00, 0x0f, 0xe6, 0x00, 0x0f, 0xe7, 0x00, 0x12,
+    0xae, 0x00, 0x06, 0x75, 0x00, 0x12, 0xb1, 0x00, 0x06, 0x76, 0x00, 0x12, 0xb4, 0x00, 0x12, 0xb5,
+    0x00, 0x12, 0xb6, 0x00, 0x12, 0x0b, 0x97, 0x12, 0x12, 0x0b, 0x97, 0x01, 0xe3, 0x3e, 0x12, 0x12,
+    0xff, 0x96, 0x31, 0xf8, 0x00, 0x12, 0xf6, 0x96, 0x11, 0x12, 0xf6, 0x96, 0x00, 0x09, 0x00, 0x01,
+    0xe3, 0x7c, 0x21, 0x12, 0xc2, 0x06, 0x00, 0x01, 0x5f, 0x74, 0x11, 0x0f, 0x95, 0x35, 0x11, 0x12,
+    0xbd, 0x00, 0xf1, 0x16, 0x12, 0xc7, 0x00, 0x12, 0xce, 0x00, 0x12, 0xcf, 0x00, 0x0f, 0x0d, 0x01,
+    0x0f, 0x0e, 0x01, 0x12, 0xd6, 0x00, 0x12, 0xd7, 0x00, 0x0f, 0x17, 0x01, 0x0f, 0x18, 0x01, 0x12,
+    0xdc, 0x00, 0x12, 0xdd, 0x00, 0x12, 0xde, 0x00, 0x12, 0xa1, 0x2e, 0x11, 0x12, 0xf4, 0x3f, 0x41,
+    0x0f, 0x28, 0x01, 0x12, 0xf4, 0x3f, 0xf1, 0x0a, 0x12, 0xee, 0x00, 0x12, 0xef, 0x00, 0x0f, 0x32,
+    0x01, 0x0f, 0x33, 0x01, 0x12, 0xf6, 0x00, 0x12, 0xf7, 0x00, 0x0f, 0x3c, 0x01, 0x0f, 0x3d, 0x01,
+    0x12, 0x95, 0x38, 0x14, 0x12, 0x92, 0x38, 0x11, 0x12, 0x53, 0x38, 0x11, 0x12, 0x0c, 0x37, 0x12,
+    0x12, 0x93, 0x96, 0x32, 0x45, 0x01, 0x12, 0x6c, 0x96, 0x13, 0x4f, 0x79, 0x33, 0x12, 0x12, 0x75,
+    0x96, 0x31, 0x51, 0x01, 0x12, 0x63, 0x34, 0x21, 0x0f, 0x57, 0x9f, 0x00, 0x02, 0x4e, 0x96, 0x14,
+    0x5f, 0x24, 0x00, 0x02, 0x57, 0x96, 0x11, 0x61, 0x1b, 0x00, 0x01, 0x30, 0x34, 0x11, 0x12, 0x12,
+    0x34, 0x11, 0x12, 0x0f, 0x34, 0x11, 0x12, 0xfa, 0x33, 0x11, 0x12, 0x36, 0x09, 0x41, 0x12, 0x1b,
+    0x01, 0x12, 0xe5, 0x33, 0x11, 0x12, 0xe2, 0x33, 0xf1, 0x16, 0x12, 0x1e, 0x01, 0x12, 0x1f, 0x01,
+    0x0f, 0x6c, 0x01, 0x0f, 0x6d, 0x01, 0x12, 0x20, 0x01, 0x12, 0x21, 0x01, 0x0f, 0x70, 0x01, 0x0f,
+    0x71, 0x01, 0x12, 0x22, 0x01, 0x12, 0x23, 0x01, 0x0f, 0x74, 0x01, 0x0f, 0x75, 0x01, 0x12, 0x66,
+    0x96, 0x11, 0x12, 0x66, 0x96, 0xf1, 0x0b, 0x12, 0x26, 0x01, 0x12, 0x27, 0x01, 0x12, 0x28, 0x01,
+    0x12, 0x29, 0x01, 0x12, 0x2a, 0x01, 0x12, 0x2b, 0x01, 0x12, 0x2c, 0x01, 0x12, 0x2d, 0x01, 0x12,
+    0x32, 0x81, 0x00, 0x14, 0x85, 0x90, 0x00, 0x11, 0x33, 0x0f, 0x00, 0x31, 0x87, 0x01, 0x12, 0x85,
+    0x45, 0x11, 0x12, 0x79, 0x45, 0xf1, 0x07, 0x12, 0x40, 0x01, 0x12, 0x41, 0x01, 0x12, 0x42, 0x01,
+    0x12, 0x43, 0x01, 0x12, 0x44, 0x01, 0x12, 0x45, 0x01, 0x0f, 0x9a, 0x01, 0x0f, 0x3d, 0x83, 0x12,
+    0x12, 0x21, 0x96, 0x11, 0x9d, 0x0c, 0x00, 0x02, 0x27, 0x96, 0x31, 0x9f, 0x01, 0x12, 0x2a, 0x96,
+    0x12, 0x12, 0x2a, 0x96, 0x01, 0xf8, 0x25, 0xf1, 0x0a, 0x12, 0x4a, 0x01, 0x12, 0x4b, 0x01, 0x0f,
+    0xa5, 0x01, 0x0f, 0xa6, 0x01, 0x12, 0x4c, 0x01, 0x12, 0x4d, 0x01, 0x12, 0x4e, 0x01, 0x12, 0x4f,
+    0x01, 0x12, 0xed, 0x73, 0x11, 0x12, 0xf5, 0x76, 0xb1, 0x12, 0x5c, 0x01, 0x12, 0x5d, 0x01, 0x0f,
+    0xb5, 0x01, 0x0f, 0xb6, 0x0f, 0x00, 0x02, 0xfd, 0x95, 0xf2, 0xa8, 0xb8, 0x01, 0x12, 0x61, 0x01,
+    0x12, 0x62, 0x01, 0x0f, 0xbd, 0x01, 0x0f, 0xbe, 0x01, 0x12, 0x65, 0x01, 0x12, 0x66, 0x01, 0x0f,
+    0xc3, 0x01, 0x0f, 0xc4, 0x01, 0x12, 0x69, 0x01, 0x12, 0x6a, 0x01, 0x0f, 0xc9, 0x01, 0x0f, 0xca,
+    0x01, 0x12, 0x6d, 0x01, 0x12, 0x6e, 0x01, 0x0f, 0xcf, 0x01, 0x0f, 0xd0, 0x01, 0x12, 0x6f, 0x01,
+    0x12, 0x70, 0x01, 0x0f, 0xd3, 0x01, 0x0f, 0xd4, 0x01, 0x12, 0x71, 0x01, 0x12, 0x72, 0x01, 0x0f,
+    0xd7, 0x01, 0x0f, 0xd8, 0x01, 0x12, 0x73, 0x01, 0x12, 0x74, 0x01, 0x12, 0x75, 0x01, 0x12, 0x76,
+    0x01, 0x12, 0x77, 0x01, 0x12, 0x78, 0x01, 0x0f, 0xdb, 0x01, 0x0f, 0xdc, 0x01, 0x12, 0x79, 0x01,
+    0x12, 0x7a, 0x01, 0x0f, 0xdf, 0x01, 0x0f, 0xe0, 0x01, 0x12, 0x7b, 0x01, 0x12, 0x7c, 0x01, 0x0f,
+    0xe3, 0x01, 0x0f, 0xe4, 0x01, 0x12, 0x7d, 0x01, 0x12, 0x7e, 0x01, 0x0f, 0xe7, 0x01, 0x0f, 0xe8,
+    0x01, 0x12, 0x7f, 0x01, 0x12, 0x80, 0x01, 0x0f, 0xeb, 0x01, 0x0f, 0xec, 0x01, 0x12, 0x81, 0x01,
+    0x12, 0x82, 0x01, 0x12, 0x83, 0x01, 0x12, 0x84, 0x01, 0x12, 0x85, 0x01, 0x12, 0x86, 0x01, 0x0f,
+    0xef, 0x01, 0x0f, 0xf0, 0x01, 0x12, 0x87, 0x01, 0x12, 0x88, 0x01, 0x12, 0x89, 0x01, 0x12, 0x8a,
+    0x01, 0x12, 0xe8, 0x95, 0x11, 0xf2, 0xc9, 0x00, 0x02, 0xee, 0x95, 0x11, 0xf4, 0x0c, 0x00, 0x02,
+    0xf4, 0x95, 0x11, 0xf6, 0x0c, 0x00, 0x02, 0xfa, 0x95, 0x11, 0xf8, 0x0c, 0x00, 0xf1, 0x09, 0x8f,
+    0x01, 0x12, 0x90, 0x01, 0x12, 0x91, 0x01, 0x12, 0x92, 0x01, 0x12, 0x93, 0x01, 0x12, 0x94, 0x01,
+    0x0f, 0xff, 0x01, 0x0f, 0x00, 0x02, 0x12, 0xd8, 0x84, 0x11, 0x12, 0xc0, 0x2d, 0xf1, 0x43, 0x12,
+    0x97, 0x01, 0x12, 0x98, 0x01, 0x12, 0x99, 0x01, 0x12, 0x9a, 0x01, 0x12, 0x9b, 0x01, 0x12, 0x9c,
+    0x01, 0x12, 0x9d, 0x01, 0x12, 0x9e, 0x01, 0x12, 0x9f, 0x01, 0x12, 0xa0, 0x01, 0x12, 0xa1, 0x01,
+    0x12, 0xa2, 0x01, 0x12, 0xa3, 0x01, 0x12, 0xa4, 0x01, 0x12, 0xa5, 0x01, 0x12, 0xa6, 0x01, 0x12,
+    0xa7, 0x01, 0x12, 0xa8, 0x01, 0x0f, 0x15, 0x02, 0x0f, 0x16, 0x02, 0x12, 0xa9, 0x01, 0x12, 0xaa,
+    0x01, 0x0f, 0x19, 0x02, 0x0f, 0x1a, 0x02, 0x12, 0xab, 0x01, 0x12, 0xac, 0x01, 0x12, 0xad, 0x01,
+    0x12, 0xcd, 0x95, 0x11, 0x12, 0xcd, 0x95, 0xe1, 0x12, 0xb0, 0x01, 0x12, 0xb1, 0x01, 0x12, 0xb2,
+    0x01, 0x0f, 0x23, 0x02, 0x0f, 0x24, 0x83, 0x6e, 0x01, 0xcd, 0x95, 0xf1, 0x25, 0x12, 0xb4, 0x01,
+    0x12, 0xb5, 0x01, 0x12, 0xb6, 0x01, 0x0f, 0x29, 0x02, 0x0f, 0x2a, 0x02, 0x12, 0xb7, 0x01, 0x12,
+    0xb8, 0x01, 0x12, 0xb9, 0x01, 0x12, 0xba, 0x01, 0x12, 0xbb, 0x01, 0x12, 0xbc, 0x01, 0x0f, 0x31,
+    0x02, 0x0f, 0x32, 0x02, 0x12, 0xbd, 0x01, 0x12, 0xbe, 0x01, 0x0f, 0x35, 0x02, 0x0f, 0x36, 0x02,
+    0x12, 0xdc, 0x95, 0x11, 0x12, 0xdc, 0x95, 0x11, 0x12, 0xe0, 0x85, 0x11, 0x12, 0x07, 0x7a, 0x11,
+    0x12, 0xe6, 0x85, 0x21, 0x12, 0xc4, 0x06, 0x00, 0xf1, 0x19, 0xc5, 0x01, 0x06, 0x77, 0x00, 0x12,
+    0xc8, 0x01, 0x12, 0xc9, 0x01, 0x12, 0xca, 0x01, 0x12, 0xcb, 0x01, 0x12, 0xcc, 0x01, 0x12, 0xcd,
+    0x01, 0x0f, 0x46, 0x02, 0x0f, 0x47, 0x02, 0x12, 0xce, 0x01, 0x12, 0xcf, 0x01, 0x0f, 0x4a, 0x02,
+    0x0f, 0x4b, 0x8a, 0x00, 0x11, 0xd0, 0x29, 0x01, 0xf1, 0x30, 0x4d, 0x02, 0x12, 0xd1, 0x01, 0x12,
+    0xd2, 0x01, 0x12, 0xd3, 0x01, 0x12, 0xd4, 0x01, 0x12, 0xd5, 0x01, 0x12, 0xd6, 0x01, 0x12, 0xd7,
+    0x01, 0x12, 0xd8, 0x01, 0x12, 0xd9, 0x01, 0x12, 0xda, 0x01, 0x12, 0xdb, 0x01, 0x12, 0xdc, 0x01,
+    0x12, 0xdd, 0x01, 0x12, 0xde, 0x01, 0x12, 0xdf, 0x01, 0x12, 0xe0, 0x01, 0x12, 0xe1, 0x01, 0x12,
+    0xe2, 0x01, 0x12, 0xe3, 0x01, 0x12, 0xe4, 0x01, 0x12, 0xd6, 0x95, 0x11, 0x12, 0xd6, 0x95, 0xf1,
+    0xff, 0x10, 0x0e, 0x08, 0x00, 0x0e, 0x09, 0x00, 0x0e, 0x0a, 0x00, 0x0e, 0x0b, 0x00, 0x0e, 0x0c,
+    0x00, 0x0e, 0x0d, 0x00, 0x0e, 0x0e, 0x00, 0x0e, 0x0f, 0x00, 0x12, 0xef, 0x01, 0x12, 0xf0, 0x01,
+    0x0f, 0x6e, 0x02, 0x0f, 0x6f, 0x02, 0x12, 0xf1, 0x01, 0x12, 0xf2, 0x01, 0x0f, 0x72, 0x02, 0x0f,
+    0x73, 0x02, 0x12, 0xf3, 0x01, 0x12, 0xf4, 0x01, 0x0f, 0x76, 0x02, 0x0f, 0x77, 0x02, 0x12, 0xf5,
+    0x01, 0x12, 0xf6, 0x01, 0x12, 0xf7, 0x01, 0x12, 0xf8, 0x01, 0x12, 0xf9, 0x01, 0x12, 0xfa, 0x01,
+    0x0f, 0x7a, 0x02, 0x0f, 0x7b, 0x02, 0x12, 0xfb, 0x01, 0x12, 0xfc, 0x01, 0x12, 0xfd, 0x01, 0x12,
+    0xfe, 0x01, 0x12, 0xff, 0x01, 0x12, 0x00, 0x02, 0x0f, 0x7e, 0x02, 0x0f, 0x7f, 0x02, 0x12, 0x01,
+    0x02, 0x12, 0x02, 0x02, 0x12, 0x03, 0x02, 0x12, 0x04, 0x02, 0x12, 0x05, 0x02, 0x12, 0x06, 0x02,
+    0x0f, 0x82, 0x02, 0x0f, 0x83, 0x02, 0x12, 0x07, 0x02, 0x12, 0x08, 0x02, 0x12, 0x09, 0x02, 0x12,
+    0x0a, 0x02, 0x0e, 0x10, 0x00, 0x0e, 0x11, 0x00, 0x0e, 0x12, 0x00, 0x0e, 0x13, 0x00, 0x0e, 0x14,
+    0x00, 0x0e, 0x15, 0x00, 0x0e, 0x16, 0x00, 0x0e, 0x17, 0x00, 0x12, 0x13, 0x02, 0x12, 0x14, 0x02,
+    0x0f, 0x8e, 0x02, 0x0f, 0x8f, 0x02, 0x12, 0x15, 0x02, 0x12, 0x16, 0x02, 0x0f, 0x92, 0x02, 0x0f,
+    0x93, 0x02, 0x12, 0x17, 0x02, 0x12, 0x18, 0x02, 0x0f, 0x96, 0x02, 0x0f, 0x97, 0x02, 0x12, 0x19,
+    0x02, 0x12, 0x1a, 0x02, 0x12, 0x1b, 0x02, 0x12, 0x1c, 0x02, 0x12, 0x1d, 0x02, 0x12, 0x1e, 0x02,
+    0x0f, 0x9a, 0x02, 0x0f, 0x9b, 0x02, 0x12, 0x1f, 0x02, 0x12, 0x20, 0x02, 0x12, 0x21, 0x02, 0x12,
+    0x22, 0x02, 0x12, 0x23, 0x02, 0x12, 0x24, 0x02, 0x0f, 0x9e, 0x02, 0x0f, 0x9f, 0x02, 0x12, 0x25,
+    0x02, 0x12, 0x26, 0x02, 0x12, 0x27, 0x02, 0x12, 0x28, 0x02, 0x12, 0x29, 0x02, 0x12, 0x2a, 0x02,
+    0x0f, 0xa2, 0x02, 0x0f, 0xa3, 0x02, 0x12, 0x2b, 0x02, 0x12, 0x2c, 0x02, 0x12, 0x2d, 0x02, 0x12,
+    0x91, 0x95, 0x12, 0x12, 0x91, 0x95, 0x11, 0xa5, 0x0c, 0x00, 0x02, 0x97, 0x95, 0xf1, 0xe5, 0xa7,
+    0x02, 0x12, 0x31, 0x02, 0x12, 0x32, 0x02, 0x0f, 0xaa, 0x02, 0x0f, 0xab, 0x02, 0x12, 0x33, 0x02,
+    0x12, 0x34, 0x02, 0x0f, 0xae, 0x02, 0x0f, 0xaf, 0x02, 0x12, 0x35, 0x02, 0x12, 0x36, 0x02, 0x0f,
+    0xb2, 0x02, 0x0f, 0xb3, 0x02, 0x12, 0x37, 0x02, 0x12, 0x38, 0x02, 0x12, 0x39, 0x02, 0x12, 0x3a,
+    0x02, 0x12, 0x3b, 0x02, 0x12, 0x3c, 0x02, 0x0f, 0xb6, 0x02, 0x0f, 0xb7, 0x02, 0x12, 0x3d, 0x02,
+    0x12, 0x3e, 0x02, 0x12, 0x3f, 0x02, 0x12, 0x40, 0x02, 0x12, 0x41, 0x02, 0x12, 0x42, 0x02, 0x0f,
+    0xba, 0x02, 0x0f, 0xbb, 0x02, 0x12, 0x43, 0x02, 0x12, 0x44, 0x02, 0x12, 0x45, 0x02, 0x12, 0x46,
+    0x02, 0x12, 0x47, 0x02, 0x12, 0x48, 0x02, 0x0f, 0xbe, 0x02, 0x0f, 0xbf, 0x02, 0x12, 0x49, 0x02,
+    0x12, 0x4a, 0x02, 0x12, 0x4b, 0x02, 0x12, 0x4c, 0x02, 0x12, 0x4d, 0x02, 0x12, 0x4e, 0x02, 0x0f,
+    0xc2, 0x02, 0x0f, 0xc3, 0x02, 0x0e, 0x18, 0x00, 0x0e, 0x19, 0x00, 0x0e, 0x1a, 0x00, 0x0e, 0x1b,
+    0x00, 0x0e, 0x1c, 0x00, 0x0e, 0x1d, 0x00, 0x0e, 0x1e, 0x00, 0x0e, 0x1f, 0x00, 0x0e, 0x20, 0x00,
+    0x0e, 0x21, 0x00, 0x0e, 0x22, 0x00, 0x0e, 0x23, 0x00, 0x0e, 0x24, 0x00, 0x0e, 0x25, 0x00, 0x0e,
+    0x26, 0x00, 0x0e, 0x27, 0x00, 0x12, 0x5f, 0x02, 0x12, 0x60, 0x02, 0x0f, 0xd6, 0x02, 0x0f, 0xd7,
+    0x02, 0x12, 0x61, 0x02, 0x12, 0x62, 0x02, 0x0f, 0xda, 0x02, 0x0f, 0xdb, 0x02, 0x12, 0x63, 0x02,
+    0x12, 0x64, 0x02, 0x12, 0x65, 0x02, 0x12, 0x66, 0x02, 0x12, 0x67, 0x02, 0x12, 0x68, 0x02, 0x0f,
+    0xde, 0x02, 0x0f, 0xdf, 0x02, 0x12, 0x69, 0x02, 0x12, 0x6a, 0x02, 0x12, 0x6b, 0x02, 0x12, 0x6c,
+    0x02, 0x12, 0x6d, 0xff, 0x00, 0x13, 0x6e, 0xea, 0x70, 0x21, 0x12, 0x77, 0x08, 0x01, 0x11, 0xeb,
+    0x15, 0x00, 0x11, 0x78, 0x0c, 0x00, 0xf1, 0x01, 0xed, 0x02, 0x12, 0x79, 0x02, 0x12, 0x7a, 0x02,
+    0x0f, 0xf0, 0x02, 0x0f, 0xf1, 0x02, 0x12, 0x7b, 0x15, 0x00, 0x14, 0xf3, 0x30, 0x00, 0x01, 0x4b,
+    0x8d, 0x51, 0x0f, 0xf5, 0x02, 0x12, 0x7d, 0x09, 0x00, 0x01, 0x55, 0x1d, 0x00, 0x18, 0x00, 0x11,
+    0x7e, 0x0f, 0x00, 0x31, 0xf9, 0x02, 0x12, 0xa6, 0x8c, 0x12, 0x12, 0x05, 0x39, 0x00, 0xce, 0x07,
+    0x01, 0x0f, 0x00, 0xf1, 0x31, 0x82, 0x02, 0x12, 0x89, 0x02, 0x06, 0x78, 0x00, 0x12, 0x8c, 0x02,
+    0x06, 0x79, 0x00, 0x12, 0x91, 0x02, 0x12, 0x92, 0x02, 0x12, 0x93, 0x02, 0x12, 0x94, 0x02, 0x12,
+    0x95, 0x02, 0x12, 0x96, 0x02, 0x12, 0x97, 0x02, 0x12, 0x98, 0x02, 0x12, 0x99, 0x02, 0x12, 0x9a,
+    0x02, 0x12, 0x9b, 0x02, 0x12, 0x9c, 0x02, 0x12, 0x9d, 0x02, 0x12, 0x9e, 0x02, 0x12, 0x9f, 0x02,
+    0x12, 0xa0, 0x02, 0x12, 0xa1, 0x45, 0x00, 0x11, 0xa2, 0x06, 0x00, 0xf1, 0x0a, 0xa3, 0x02, 0x12,
+    0xa4, 0x02, 0x0f, 0x1c, 0x03, 0x0f, 0x1d, 0x03, 0x12, 0xa5, 0x02, 0x12, 0xa6, 0x02, 0x0f, 0x20,
+    0x03, 0x0f, 0x21, 0x03, 0x12, 0xa9, 0x1e, 0x00, 0x11, 0xaa, 0x06, 0x00, 0xf1, 0x75, 0xab, 0x02,
+    0x06, 0x7a, 0x00, 0x12, 0xae, 0x02, 0x06, 0x7b, 0x00, 0x12, 0xb1, 0x02, 0x12, 0xb2, 0x02, 0x0f,
+    0x2e, 0x03, 0x0f, 0x2f, 0x03, 0x12, 0xb3, 0x02, 0x12, 0xb4, 0x02, 0x0f, 0x32, 0x03, 0x0f, 0x33,
+    0x03, 0x12, 0xb5, 0x02, 0x12, 0xb6, 0x02, 0x0f, 0x36, 0x03, 0x0f, 0x37, 0x03, 0x12, 0xb7, 0x02,
+    0x12, 0xb8, 0x02, 0x12, 0xb9, 0x02, 0x12, 0xba, 0x02, 0x12, 0xbb, 0x02, 0x12, 0xbc, 0x02, 0x12,
+    0xbd, 0x02, 0x12, 0xbe, 0x02, 0x12, 0xbf, 0x02, 0x12, 0xc0, 0x02, 0x12, 0xc1, 0x02, 0x12, 0xc2,
+    0x02, 0x12, 0xc3, 0x02, 0x12, 0xc4, 0x02, 0x12, 0xc5, 0x02, 0x12, 0xc6, 0x02, 0x12, 0xc7, 0x02,
+    0x12, 0xc8, 0x02, 0x12, 0xc9, 0x02, 0x12, 0xca, 0x02, 0x12, 0xcb, 0x02, 0x12, 0xcc, 0x02, 0x12,
+    0xcd, 0x02, 0x12, 0xce, 0x02, 0x12, 0xcf, 0x02, 0x12, 0xd0, 0x02, 0x12, 0xd1, 0x02, 0x12, 0xd2,
+    0x02, 0x12, 0x2c, 0x94, 0x21, 0x12, 0xd4, 0x06, 0x00, 0xf1, 0x5b, 0xd5, 0x02, 0x12, 0xd6, 0x02,
+    0x0f, 0x54, 0x03, 0x0f, 0x55, 0x03, 0x12, 0xd9, 0x02, 0x12, 0xda, 0x02, 0x0f, 0x5a, 0x03, 0x0f,
+    0x5b, 0x03, 0x12, 0xdb, 0x02, 0x12, 0xdc, 0x02, 0x12, 0xdd, 0x02, 0x12, 0xde, 0x02, 0x12, 0xdf,
+    0x02, 0x12, 0xe0, 0x02, 0x0f, 0x5e, 0x03, 0x0f, 0x5f, 0x03, 0x12, 0xe1, 0x02, 0x12, 0xe2, 0x02,
+    0x12, 0xe3, 0x02, 0x12, 0xe4, 0x02, 0x12, 0xe5, 0x02, 0x12, 0xe6, 0x02, 0x0f, 0x62, 0x03, 0x0f,
+    0x63, 0x03, 0x12, 0xe7, 0x02, 0x12, 0xe8, 0x02, 0x12, 0xe9, 0x02, 0x12, 0xea, 0x02, 0x12, 0xeb,
+    0x02, 0x12, 0xec, 0x02, 0x0f, 0x66, 0x03, 0x0f, 0x67, 0x03, 0x12, 0xed, 0x02, 0x12, 0xee, 0x02,
+    0x12, 0xef, 0x02, 0x12, 0xf0, 0x6f, 0x00, 0x11, 0xf1, 0x06, 0x00, 0xd0, 0xf2, 0x02, 0x12, 0xf3,
+    0x02, 0x12, 0xf4, 0x02, 0x0f, 0x6c, 0x03, 0x0f, 0x6d, 0x2a, 0x0d, 0x11, 0x12, 0x66, 0x0f, 0xe1,
+    0x12, 0xf6, 0x02, 0x12, 0xf7, 0x02, 0x12, 0xf8, 0x02, 0x0f, 0x72, 0x03, 0x0f, 0x73, 0x18, 0x00,
+    0x11, 0xf9, 0xbc, 0x01, 0x11, 0x75, 0x0c, 0x00, 0x02, 0x05, 0x94, 0x32, 0x77, 0x03, 0x12, 0x08,
+    0x94, 0x13, 0x79, 0xf7, 0x4b, 0x12, 0x12, 0x11, 0x94, 0x32, 0x7b, 0x03, 0x12, 0x14, 0x94, 0x11,
+    0x7d, 0x2d, 0x00, 0x02, 0x0e, 0x94, 0x01, 0x4d, 0x89, 0x12, 0x12, 0x14, 0x94, 0x11, 0x83, 0x0c,
+    0x00, 0x02, 0x1a, 0x94, 0x11, 0x85, 0x0c, 0x00, 0x02, 0x20, 0x94, 0x11, 0x87, 0x0c, 0x00, 0x02,
+    0x26, 0x94, 0x11, 0x89, 0x0c, 0x00, 0x02, 0x2c, 0x94, 0x11, 0x8b, 0x0c, 0x00, 0x02, 0x26, 0x94,
+    0x11, 0x8f, 0x0c, 0x00, 0x02, 0x2c, 0x94, 0x11, 0x91, 0x0c, 0x00, 0x01, 0x32, 0x94, 0x11, 0x12,
+    0x32, 0x94, 0x12, 0x12, 0x32, 0x94, 0x01, 0x21, 0x27, 0x11, 0x12, 0x44, 0x7b, 0x11, 0x12, 0x38,
+    0x94, 0x12, 0x12, 0x38, 0x94, 0x01, 0x2d, 0x27, 0x11, 0x12, 0x3e, 0x94, 0x11, 0x12, 0x3e, 0x94,
+    0x12, 0x12, 0x3e, 0x94, 0x11, 0x97, 0x0c, 0x00, 0x01, 0x44, 0x94, 0x11, 0x12, 0x60, 0x58, 0x12,
+    0x12, 0x44, 0x94, 0x11, 0x99, 0x0c, 0x00, 0x02, 0x4a, 0x94, 0x11, 0x9b, 0x0c, 0x00, 0x02, 0x50,
+    0x94, 0x11, 0x9d, 0x0c, 0x00, 0x01, 0x30, 0x58, 0x11, 0x12, 0x56, 0x94, 0x12, 0x12, 0x56, 0x94,
+    0x11, 0x9f, 0x0c, 0x00, 0x01, 0xcc, 0x81, 0x11, 0x12, 0x8d, 0x58, 0x11, 0x12, 0x5d, 0x58, 0x21,
+    0x0f, 0xa1, 0x0c, 0x00, 0x01, 0x34, 0x29, 0x11, 0x12, 0x34, 0x29, 0x11, 0x12, 0x5f, 0x1f, 0x21,
+    0x0f, 0xa3, 0x0c, 0x00, 0x11, 0x21, 0x06, 0x00, 0x01, 0x16, 0x57, 0x12, 0x12, 0x80, 0x94, 0x01,
+    0x9f, 0x27, 0x12, 0x12, 0x86, 0x94, 0x01, 0x9f, 0x27, 0x12, 0x12, 0x8c, 0x94, 0x11, 0xa9, 0x0c,
+    0x00, 0x01, 0x49, 0x57, 0x11, 0x12, 0x92, 0x94, 0x12, 0x12, 0x92, 0x94, 0x01, 0x68, 0x91, 0x11,
+    0x12, 0x19, 0x57, 0x11, 0x12, 0x98, 0x94, 0x12, 0x12, 0x98, 0x94, 0x11, 0xad, 0x0c, 0x00, 0x01,
+    0x65, 0x59, 0x11, 0x12, 0x7c, 0x29, 0x11, 0x12, 0x7c, 0x29, 0x21, 0x0f, 0xaf, 0x0c, 0x00, 0x01,
+    0x82, 0x29, 0x11, 0x12, 0xb0, 0x94, 0x12, 0x12, 0xb0, 0x94, 0x11, 0xb1, 0x0c, 0x00, 0x11, 0x32,
+    0x0c, 0x00, 0x01, 0xed, 0x27, 0x21, 0x12, 0x33, 0x0c, 0x00, 0x01, 0xed, 0x27, 0x21, 0x12, 0x34,
+    0x06, 0x00, 0x11, 0x35, 0x06, 0x00, 0x02, 0xea, 0x8a, 0x11, 0xb7, 0x0c, 0x00, 0x11, 0x37, 0x06,
+    0x00, 0x01, 0xc8, 0x94, 0x12, 0x12, 0xc8, 0x94, 0x11, 0xb9, 0x0c, 0x00, 0x01, 0xce, 0x94, 0x11,
+    0x12, 0xce, 0x94, 0x12, 0x12, 0xce, 0x94, 0x11, 0xbb, 0x0c, 0x00, 0x01, 0x09, 0x4f, 0x11, 0x12,
+    0xd4, 0x94, 0x11, 0x12, 0xd4, 0x94, 0x11, 0x12, 0x26, 0x8b, 0x11, 0x12, 0xd4, 0x94, 0x11, 0x12,
+    0xd4, 0x94, 0x11, 0x12, 0xd4, 0x94, 0x11, 0x12, 0xd4, 0x94, 0x11, 0x12, 0xd4, 0x94, 0x11, 0x12,
+    0xaf, 0x20, 0xf1, 0x16, 0x12, 0x47, 0x03, 0x06, 0x7c, 0x00, 0x12, 0x4a, 0x03, 0x06, 0x7d, 0x00,
+    0x12, 0x4d, 0x03, 0x06, 0x7e, 0x00, 0x12, 0x50, 0x03, 0x06, 0x7f, 0x00, 0x12, 0x53, 0x03, 0x06,
+    0x80, 0x00, 0x12, 0x56, 0x03, 0x06, 0x81, 0x00, 0x12, 0x49, 0x23, 0x21, 0x12, 0x5a, 0x06, 0x00,
+    0x11, 0x5b, 0x06, 0x00, 0x11, 0x5c, 0x06, 0x00, 0x11, 0x5d, 0x06, 0x00, 0x11, 0x5e, 0x06, 0x00,
+    0x11, 0x5f, 0x06, 0x00, 0x11, 0x60, 0x06, 0x00, 0x11, 0x61, 0x9c, 0x00, 0x11, 0xc1, 0x0c, 0x00,
+    0x11, 0x62, 0x06, 0x00, 0x11, 0x63, 0x06, 0x00, 0x01, 0x7a, 0x94, 0x11, 0x12, 0x7a, 0x94, 0x21,
+    0x12, 0x66, 0x06, 0x00, 0x11, 0x67, 0x06, 0x00, 0x01, 0x6e, 0x94, 0x11, 0x12, 0x6e, 0x94, 0xf2,
+    0x2b, 0x12, 0x6a, 0x03, 0x12, 0x6b, 0x03, 0x12, 0x6c, 0x03, 0x12, 0x6d, 0x03, 0x12, 0x70, 0x03,
+    0x06, 0x82, 0x00, 0x12, 0x73, 0x03, 0x06, 0x83, 0x00, 0x12, 0x76, 0x03, 0x06, 0x84, 0x00, 0x12,
+    0x79, 0x03, 0x06, 0x85, 0x00, 0x12, 0x7c, 0x03, 0x12, 0x7d, 0x03, 0x0f, 0xca, 0x03, 0x0f, 0xcb,
+    0x03, 0x12, 0x7e, 0x03, 0x06, 0x86, 0x00, 0x12, 0x81, 0x03, 0x06, 0x1a, 0x0d, 0x11, 0x84, 0x45,
+    0x00, 0xf1, 0x00, 0x85, 0x03, 0x12, 0x86, 0x03, 0x12, 0x87, 0x03, 0x12, 0x88, 0x03, 0x12, 0x89,
+    0x03, 0x12, 0xcc, 0x99, 0x12, 0x12, 0xf4, 0x02, 0xc1, 0x8c, 0x03, 0x12, 0x8d, 0x03, 0x0f, 0xd4,
+    0x03, 0x0f, 0xd5, 0x03, 0x12, 0x09, 0x2a, 0x12, 0x12, 0x00, 0x03, 0x01, 0xf6, 0x99, 0x12, 0x12,
+    0x00, 0x03, 0x11, 0x92, 0x06, 0x00, 0x02, 0xf4, 0x02, 0x01, 0x15, 0x2a, 0x12, 0x12, 0xe8, 0x02,
+    0x01, 0x15, 0x2a, 0x12, 0x12, 0xdc, 0x02, 0x11, 0x98, 0x06, 0x00, 0x02, 0xd0, 0x02, 0x11, 0x9a,
+    0x06, 0x00, 0x02, 0xd0, 0x02, 0x11, 0x9c, 0x06, 0x00, 0x02, 0xd0, 0x02, 0x11, 0x9e, 0x06, 0x00,
+    0x02, 0xc4, 0x02, 0x11, 0xa0, 0x06, 0x00, 0x02, 0xb8, 0x02, 0x11, 0xa2, 0x06, 0x00, 0x02, 0xac,
+    0x02, 0x11, 0xa4, 0x06, 0x00, 0x02, 0xa0, 0x02, 0xf2, 0x12, 0xa6, 0x03, 0x12, 0xa7, 0x03, 0x12,
+    0xa8, 0x03, 0x12, 0xa9, 0x03, 0x12, 0xaa, 0x03, 0x12, 0xab, 0x03, 0x0f, 0xf4, 0x03, 0x0f, 0xf5,
+    0x03, 0x12, 0xac, 0x03, 0x12, 0xad, 0x03, 0x12, 0xae, 0x03, 0x12, 0x67, 0x02, 0x32, 0xb0, 0x03,
+    0x12, 0x58, 0x02, 0x01, 0xd5, 0x1b, 0x12, 0x12, 0x58, 0x02, 0x01, 0x45, 0x2a, 0x12, 0x12, 0x58,
+    0x02, 0x11, 0xb6, 0x06, 0x00, 0x02, 0x4c, 0x02, 0x01, 0x64, 0x8f, 0x12, 0x12, 0x40, 0x02, 0x11,
+    0xba, 0x06, 0x00, 0x02, 0x34, 0x02, 0x01, 0x57, 0x2a, 0xd2, 0x12, 0xbd, 0x03, 0x12, 0xbe, 0x03,
+    0x12, 0xbf, 0x03, 0x12, 0xc0, 0x03, 0x12, 0xb0, 0x01, 0x02, 0x24, 0x93, 0x01, 0xf9, 0x4f, 0x12,
+    0x12, 0x2a, 0x93, 0x01, 0xf3, 0x4f, 0x11, 0x12, 0x30, 0x93, 0x11, 0x12, 0x30, 0x93, 0x11, 0x12,
+    0x30, 0x93, 0x11, 0x12, 0x30, 0x93, 0x21, 0x12, 0xc8, 0x06, 0x00, 0x10, 0xc9, 0x06, 0x00, 0xf1,
+    0x16, 0x06, 0x88, 0x00, 0x06, 0x89, 0x00, 0x06, 0x8a, 0x00, 0x06, 0x8b, 0x00, 0x06, 0x8c, 0x00,
+    0x06, 0x8d, 0x00, 0x06, 0x8e, 0x00, 0x06, 0x8f, 0x00, 0x06, 0x90, 0x00, 0x06, 0x91, 0x00, 0x06,
+    0x92, 0x00, 0x06, 0x93, 0x00, 0x12, 0x88, 0x92, 0x11, 0x12, 0x88, 0x92, 0x11, 0x12, 0x88, 0x92,
+    0x11, 0x12, 0x88, 0x92, 0x11, 0x12, 0x88, 0x92, 0x11, 0x12, 0x88, 0x92, 0x11, 0x12, 0x87, 0x2a,
+    0x11, 0x12, 0x87, 0x2a, 0x12, 0x12, 0x88, 0x92, 0x01, 0x65, 0x50, 0x11, 0x12, 0x8d, 0x2a, 0x11,
+    0x12, 0x8e, 0x92, 0x11, 0x12, 0x8e, 0x92, 0x11, 0x12, 0x8e, 0x92, 0x11, 0x12, 0x8e, 0x92, 0x11,
+    0x12, 0x8e, 0x92, 0x11, 0x12, 0x8e, 0x92, 0x11, 0x12, 0x8e, 0x92, 0xf2, 0x16, 0x06, 0x94, 0x00,
+    0x06, 0x95, 0x00, 0x06, 0x96, 0x00, 0x06, 0x97, 0x00, 0x06, 0x98, 0x00, 0x06, 0x99, 0x00, 0x06,
+    0x9a, 0x00, 0x06, 0x9b, 0x00, 0x06, 0x9c, 0x00, 0x06, 0x9d, 0x00, 0x06, 0x9e, 0x00, 0x06, 0x9f,
+    0x00, 0x12, 0x52, 0x92, 0x01, 0xb3, 0x50, 0x12, 0x12, 0x58, 0x92, 0x01, 0xb4, 0x9c, 0x11, 0x12,
+    0x67, 0x51, 0x11, 0x12, 0x64, 0x51, 0x12, 0x12, 0x5e, 0x92, 0x11, 0x17, 0x0c, 0x00, 0x01, 0x64,
+    0x51, 0x14, 0x12, 0x61, 0x51, 0x11, 0x12, 0xba, 0x2a, 0x11, 0x12, 0xba, 0x2a, 0x11, 0x12, 0xba,
+    0x2a, 0x11, 0x12, 0xba, 0x2a, 0x11, 0x12, 0x55, 0x51, 0xf2, 0x16, 0x12, 0x0b, 0x04, 0x81, 0xbd,
+    0x01, 0x06, 0xa0, 0x00, 0x12, 0x0e, 0x04, 0x06, 0xa1, 0x00, 0x12, 0x11, 0x04, 0x06, 0xa2, 0x00,
+    0x12, 0x14, 0x04, 0x06, 0xa3, 0x00, 0x12, 0x17, 0x04, 0x06, 0xa4, 0x00, 0x12, 0x1a, 0x04, 0x06,
+    0x7e, 0x0f, 0x01, 0xec, 0x50, 0x11, 0x12, 0xe9, 0x50, 0x11, 0x12, 0xe6, 0x50, 0x11, 0x12, 0xe3,
+    0x50, 0x11, 0x12, 0xe0, 0x50, 0x11, 0x12, 0xdd, 0x50, 0x11, 0x12, 0xda, 0x50, 0x11, 0x12, 0xd7,
+    0x50, 0x11, 0x12, 0xd4, 0x50, 0x11, 0x12, 0xcc, 0x2a, 0x11, 0x12, 0xce, 0x50, 0x11, 0x12, 0xcb,
+    0x50, 0x11, 0x12, 0xc8, 0x50, 0x11, 0x12, 0xc5, 0x50, 0x11, 0x12, 0xc2, 0x50, 0xf1, 0x3a, 0x12,
+    0x2c, 0x04, 0x12, 0x2d, 0x04, 0x12, 0x2e, 0x04, 0x12, 0x2f, 0x04, 0x12, 0x30, 0x04, 0x12, 0x33,
+    0x04, 0x06, 0xa6, 0x00, 0x12, 0x36, 0x04, 0x06, 0xa7, 0x00, 0x12, 0x39, 0x04, 0x06, 0xa8, 0x00,
+    0x12, 0x3c, 0x04, 0x06, 0xa9, 0x00, 0x12, 0x3f, 0x04, 0x12, 0x40, 0x04, 0x0f, 0x22, 0x04, 0x0f,
+    0x23, 0x04, 0x81, 0xb0, 0x02, 0x06, 0xaa, 0x00, 0x12, 0x43, 0x04, 0x06, 0xab, 0x00, 0x12, 0x46,
+    0x04, 0x12, 0x47, 0x04, 0x12, 0x48, 0x04, 0x12, 0xeb, 0x7e, 0x11, 0x12, 0xeb, 0x7e, 0x11, 0x12,
+    0xeb, 0x7e, 0x11, 0x12, 0xeb, 0x7e, 0x41, 0x0f, 0x29, 0x04, 0x12, 0xee, 0x7e, 0x11, 0x12, 0xee,
+    0x7e, 0xd1, 0x12, 0x4f, 0x04, 0x12, 0x50, 0x04, 0x0f, 0x2e, 0x04, 0x0f, 0x2f, 0x04, 0x12, 0x20,
+    0x50, 0x11, 0x0f, 0x13, 0x51, 0x21, 0x12, 0x52, 0x06, 0x00, 0x01, 0x29, 0x50, 0x21, 0x12, 0x54,
+    0x06, 0x00, 0x01, 0x2c, 0x50, 0x00, 0x09, 0x00, 0x11, 0x56, 0x0f, 0x00, 0xf1, 0x00, 0x57, 0x04,
+    0x12, 0x58, 0x04, 0x12, 0x59, 0x04, 0x0f, 0x36, 0x04, 0x0f, 0x37, 0x04, 0x12, 0x0b, 0x2b, 0x21,
+    0x0f, 0x39, 0x1b, 0x00, 0x01, 0x11, 0x2b, 0x21, 0x0f, 0x3b, 0x0c, 0x00, 0x01, 0x17, 0x2b, 0x11,
+    0x12, 0x17, 0x2b, 0x21, 0x12, 0x5e, 0x18, 0x00, 0x01, 0x16, 0x51, 0x11, 0x12, 0x48, 0x7f, 0x11,
+    0x12, 0x53, 0x50, 0x02, 0x83, 0x8d, 0x11, 0x81, 0x6e, 0x10, 0x11, 0x81, 0xce, 0xa6, 0x02, 0x59,
+    0x43, 0x11, 0x81, 0x70, 0x14, 0x01, 0x97, 0xa0, 0x00, 0x1a, 0x25, 0x00, 0x0c, 0x00, 0x00, 0xfd,
+    0x01, 0x00, 0x9f, 0x15, 0x00, 0x0c, 0x00, 0x01, 0x8f, 0x00, 0x11, 0x81, 0x38, 0xa3, 0x01, 0xc9,
+    0x26, 0x31, 0x00, 0x8b, 0x24, 0x12, 0x00, 0x11, 0xbc, 0x30, 0x58, 0x10, 0xbe, 0x36, 0x8d, 0x00,
+    0x72, 0x27, 0x11, 0xbb, 0x75, 0x27, 0x31, 0xb9, 0x00, 0x13, 0xf4, 0x14, 0x11, 0x8b, 0x4a, 0x13,
+    0x11, 0x13, 0xfa, 0x14, 0x12, 0x8b, 0x8b, 0xb3, 0x31, 0x00, 0x00, 0x13, 0xfd, 0x14, 0x21, 0x81,
+    0xc5, 0x06, 0x00, 0x01, 0x44, 0x10, 0x11, 0x13, 0x03, 0x15, 0x11, 0x81, 0x03, 0x15, 0x11, 0x13,
+    0x06, 0x00, 0x11, 0x81, 0x5b, 0x51, 0x11, 0x13, 0x0f, 0x15, 0x02, 0xcd, 0x17, 0x11, 0x13, 0x15,
+    0x15, 0x32, 0x81, 0x8d, 0x01, 0x4a, 0x61, 0x11, 0x81, 0xea, 0x0f, 0x51, 0x13, 0x0e, 0x00, 0x13,
+    0x0f, 0x53, 0x1c, 0x31, 0xd1, 0x00, 0x13, 0x1e, 0x15, 0x11, 0x8b, 0x18, 0xa5, 0x11, 0x13, 0x24,
+    0x15, 0x11, 0x13, 0x24, 0x15, 0x11, 0x13, 0xf1, 0x00, 0x11, 0x8b, 0xe8, 0xa4, 0x11, 0x8b, 0x1a,
+    0x10, 0x21, 0x8b, 0x51, 0x24, 0x00, 0x01, 0x2a, 0x15, 0x11, 0x81, 0xdd, 0x44, 0x00, 0xe5, 0x3e,
+    0x01, 0x54, 0x52, 0x11, 0x13, 0x45, 0x15, 0x80, 0x8b, 0x21, 0x00, 0x13, 0x16, 0x00, 0x13, 0x17,
+    0x7f, 0xa7, 0x81, 0x81, 0xfc, 0x00, 0x13, 0x18, 0x00, 0x13, 0x19, 0x69, 0x73, 0x80, 0xf9, 0x00,
+    0x13, 0x1a, 0x00, 0x13, 0x1b, 0x00, 0x16, 0x17, 0x80, 0x3b, 0x01, 0x13, 0x1c, 0x00, 0x13, 0x1d,
+    0x00, 0xd8, 0x73, 0x32, 0x75, 0x01, 0x13, 0x80, 0x94, 0x01, 0x36, 0xa5, 0x11, 0x13, 0x1e, 0x15,
+    0x11, 0x81, 0xb6, 0x50, 0x02, 0x98, 0x94, 0x00, 0x09, 0x00, 0x10, 0x1d, 0x1d, 0x2b, 0x03, 0x0c,
+    0x00, 0x31, 0x1a, 0x00, 0x13, 0x36, 0x15, 0x11, 0x81, 0x2a, 0xa5, 0x12, 0x13, 0xce, 0x97, 0x01,
+    0xa1, 0x10, 0x11, 0x13, 0x36, 0x15, 0x11, 0x81, 0x9e, 0xa6, 0x11, 0x13, 0x72, 0x87, 0x11, 0x81,
+    0x98, 0xa6, 0x12, 0x13, 0x6e, 0x01, 0x01, 0xb2, 0x3e, 0x11, 0x13, 0x0c, 0x8d, 0x11, 0x81, 0xce,
+    0xa6, 0x21, 0x13, 0x26, 0x0c, 0x00, 0x01, 0x92, 0xa6, 0xd1, 0x13, 0x27, 0x00, 0x13, 0x28, 0x00,
+    0x81, 0xa2, 0x00, 0x81, 0x9f, 0x00, 0x13, 0x42, 0x15, 0x11, 0x81, 0xd2, 0xa5, 0x11, 0x13, 0x7a,
+    0x01, 0x11, 0x81, 0x02, 0x10, 0x11, 0x13, 0x48, 0x15, 0x11, 0x81, 0x26, 0xa6, 0x51, 0x13, 0x2c,
+    0x00, 0x13, 0x2d, 0xdb, 0x27, 0x31, 0x04, 0x00, 0x13, 0x48, 0x15, 0x11, 0x81, 0x62, 0xa9, 0x60,
+    0x13, 0x2f, 0x00, 0x13, 0x30, 0x00, 0x46, 0x29, 0x71, 0xb4, 0x00, 0x13, 0x31, 0x00, 0x13, 0x32,
+    0x69, 0x67, 0x71, 0xae, 0x00, 0x13, 0x33, 0x00, 0x13, 0x34, 0x4f, 0x78, 0x31, 0x48, 0x00, 0x81,
+    0x06, 0xa8, 0x00, 0x33, 0x00, 0x22, 0x04, 0x01, 0xf6, 0x93, 0x00, 0x0c, 0x00, 0x31, 0x1c, 0x00,
+    0x13, 0x5a, 0x15, 0x11, 0x81, 0xe2, 0x11, 0x11, 0x13, 0x5a, 0x15, 0x11, 0x81, 0x76, 0x51, 0x11,
+    0x13, 0x60, 0x15, 0x11, 0x81, 0xc5, 0x10, 0x11, 0x13, 0x66, 0x15, 0x21, 0x81, 0x6c, 0x0c, 0x00,
+    0x41, 0x39, 0x00, 0x13, 0x3a, 0xef, 0x7a, 0x71, 0x02, 0x01, 0x13, 0x3b, 0x00, 0x13, 0x3c, 0x46,
+    0x2c, 0x31, 0x15, 0x00, 0x13, 0x66, 0x15, 0x11, 0x81, 0x74, 0xa6, 0x60, 0x13, 0x3e, 0x00, 0x13,
+    0x3f, 0x00, 0xb6, 0x88, 0x31, 0x93, 0x01, 0x13, 0xe4, 0x15, 0x11, 0x81, 0xf2, 0x10, 0x11, 0x13,
+    0x02, 0xac, 0x11, 0x81, 0x86, 0xa6, 0x11, 0x13, 0x66, 0x15, 0x02, 0xf1, 0x3e, 0x11, 0x13, 0x66,
+    0x15, 0x11, 0x81, 0x20, 0xa6, 0x11, 0x13, 0x66, 0x15, 0x11, 0x81, 0x7c, 0x11, 0x11, 0x13, 0x66,
+    0x15, 0x11, 0x81, 0xd6, 0xa7, 0x03, 0x9c, 0x70, 0xa1, 0x98, 0x00, 0x81, 0x97, 0x00, 0x13, 0x46,
+    0x00, 0x13, 0x47, 0x7e, 0x7c, 0x71, 0x4e, 0x00, 0x13, 0x48, 0x00, 0x13, 0x49, 0x93, 0x6a, 0x71,
+    0x63, 0x00, 0x13, 0x4a, 0x00, 0x13, 0x4b, 0x44, 0x6b, 0x70, 0x75, 0x00, 0x13, 0x4c, 0x00, 0x13,
+    0x4d, 0xe0, 0x86, 0x00, 0x54, 0x70, 0x02, 0xee, 0x78, 0x10, 0x86, 0xb9, 0x7a, 0x11, 0x13, 0x63,
+    0x15, 0x11, 0x81, 0xeb, 0x14, 0x51, 0x13, 0x4f, 0x00, 0x13, 0x50, 0x95, 0x3d, 0x71, 0x54, 0x00,
+    0x13, 0x51, 0x00, 0x13, 0x52, 0x63, 0x70, 0x71, 0x69, 0x00, 0x13, 0x53, 0x00, 0x13, 0x54, 0x4f,
+    0x87, 0x70, 0x7b, 0x00, 0x13, 0x55, 0x00, 0x13, 0x56, 0x2e, 0x87, 0x41, 0x81, 0x8d, 0x00, 0x13,
+    0x5d, 0x15, 0x11, 0x81, 0x5b, 0x80, 0x11, 0x13, 0x63, 0x15, 0x11, 0x81, 0x72, 0x12, 0x51, 0x13,
+    0x59, 0x00, 0x13, 0x5a, 0x20, 0x7d, 0x71, 0x5a, 0x00, 0x13, 0x5b, 0x00, 0x13, 0x5c, 0x0e, 0x19,
+    0x71, 0x6f, 0x00, 0x13, 0x5d, 0x00, 0x13, 0x5e, 0x94, 0x87, 0xa0, 0x81, 0x00, 0x13, 0x5f, 0x00,
+    0x13, 0x60, 0x00, 0x81, 0x96, 0xfc, 0x7f, 0x20, 0x81, 0x9b, 0x44, 0x1f, 0x11, 0x81, 0xd0, 0x14,
+    0x11, 0x81, 0x61, 0x8f, 0x00, 0xde, 0x7c, 0x10, 0x88, 0xa6, 0x89, 0x00, 0x0c, 0x00, 0x01, 0x10,
+    0xa7, 0x11, 0x13, 0x81, 0x15, 0x11, 0x81, 0x02, 0x01, 0x11, 0x13, 0x81, 0x15, 0x11, 0x81, 0xd1,
+    0x13, 0x11, 0x13, 0x81, 0x15, 0x11, 0x81, 0x94, 0xa7, 0x11, 0x13, 0x81, 0x15, 0x11, 0x81, 0xe9,
+    0x57, 0x11, 0x13, 0x81, 0x15, 0x02, 0xae, 0x2d, 0x11, 0x13, 0x81, 0x15, 0x11, 0x81, 0x23, 0x53,
+    0x00, 0x7d, 0x2b, 0x11, 0xe4, 0x3c, 0x42, 0x11, 0xe2, 0x43, 0x29, 0x11, 0xe0, 0x92, 0x2b, 0x31,
+    0xde, 0x00, 0x13, 0x9c, 0x15, 0x12, 0x8b, 0x72, 0x03, 0x01, 0x99, 0x15, 0x11, 0x8b, 0x59, 0x13,
+    0x11, 0x13, 0x99, 0x15, 0x11, 0x8b, 0x63, 0x04, 0x11, 0x13, 0x99, 0x15, 0x11, 0x8b, 0xbc, 0x13,
+    0x80, 0x13, 0x6b, 0x00, 0x13, 0x6c, 0x00, 0x8b, 0xa8, 0xb7, 0x99, 0xd1, 0x13, 0x6d, 0x00, 0x13,
+    0x6e, 0x00, 0x8b, 0x7e, 0x01, 0x8b, 0x7b, 0x01, 0x13, 0x80, 0x71, 0x11, 0x8b, 0x3a, 0x02, 0x11,
+    0x13, 0xb4, 0x15, 0x14, 0x8b, 0x82, 0x8f, 0x41, 0x13, 0x71, 0x00, 0x13, 0x95, 0x71, 0x11, 0x81,
+    0xec, 0x01, 0x11, 0x13, 0x65, 0x16, 0x11, 0x81, 0x42, 0x18, 0x11, 0x13, 0xf8, 0xac, 0x00, 0x09,
+    0x00, 0x01, 0x6e, 0x16, 0x11, 0x8b, 0x03, 0x18, 0x11, 0x13, 0x07, 0xad, 0x42, 0x8b, 0x2d, 0x00,
+    0x8b, 0x78, 0x00, 0x01, 0x0b, 0x16, 0x12, 0x8b, 0x9c, 0x00, 0x02, 0x96, 0x00, 0x01, 0xd8, 0x00,
+    0x12, 0x8b, 0xba, 0x00, 0x01, 0x14, 0x01, 0x11, 0x8b, 0x0e, 0x01, 0x11, 0x8b, 0x08, 0x01, 0x11,
+    0x8b, 0x02, 0x01, 0x11, 0x8b, 0x88, 0xad, 0x12, 0x8b, 0x96, 0x00, 0x01, 0xa0, 0xad, 0x11, 0x8b,
+    0x34, 0x72, 0x11, 0x8b, 0xf2, 0x01, 0x11, 0x8b, 0x56, 0x01, 0x11, 0x8b, 0x07, 0x17, 0x11, 0x8b,
+    0x07, 0x17, 0x11, 0x8b, 0x07, 0x17, 0x11, 0x8b, 0x07, 0x17, 0x50, 0x8b, 0x26, 0x00, 0x8b, 0x27,
+    0xf8, 0x04, 0xb1, 0x8b, 0x2b, 0x00, 0x8b, 0x28, 0x00, 0x8b, 0x29, 0x00, 0x8b, 0x2c, 0x90, 0x00,
+    0xc2, 0x74, 0x00, 0x8b, 0x75, 0x00, 0x8b, 0x76, 0x00, 0x8b, 0x77, 0x00, 0x8b, 0xe4, 0x00, 0x01,
+    0xdc, 0xad, 0x11, 0x8b, 0xde, 0x00, 0x11, 0x8b, 0xd8, 0x00, 0x11, 0x8b, 0x99, 0x1b, 0x11, 0x8b,
+    0x25, 0x17, 0x21, 0x8b, 0x8a, 0x06, 0x00, 0x01, 0xd3, 0x81, 0x11, 0x8b, 0xb0, 0x16, 0x11, 0x8b,
+    0xaa, 0x16, 0x21, 0x8b, 0x84, 0x06, 0x00, 0x01, 0x01, 0x17, 0x11, 0x8b, 0xc0, 0x03, 0x11, 0x8b,
+    0x08, 0x19, 0x11, 0x8b, 0x31, 0x05, 0x11, 0x8b, 0x42, 0x03, 0x02, 0x0b, 0x01, 0x11, 0x8b, 0x0e,
+    0x19, 0x11, 0x8b, 0x0e, 0x19, 0x02, 0x50, 0x01, 0x11, 0x8b, 0x08, 0x19, 0x11, 0x8b, 0xae, 0x03,
+    0x11, 0x8b, 0xea, 0x18, 0x11, 0x8b, 0xea, 0x18, 0x02, 0x7a, 0x01, 0x11, 0x8b, 0xae, 0x03, 0x11,
+    0x8b, 0xa8, 0x03, 0x02, 0xc4, 0x05, 0x03, 0x60, 0x99, 0x02, 0xb6, 0x04, 0x02, 0xe0, 0x04, 0x02,
+    0xb6, 0x04, 0x01, 0x3a, 0x1a, 0x11, 0x81, 0x28, 0x1a, 0x03, 0xfe, 0x97, 0x11, 0x1d, 0x06, 0x00,
+    0x02, 0xb0, 0x04, 0x02, 0xaa, 0x04, 0x02, 0xd4, 0x04, 0x02, 0xce, 0x04, 0x01, 0x80, 0x6e, 0x00,
+    0x5e, 0x8a, 0x40, 0x7d, 0x00, 0x81, 0x8c, 0x06, 0x03, 0x53, 0x81, 0x8e, 0x00, 0x81, 0x8f, 0x96,
+    0x73, 0x02, 0x8a, 0x73, 0x08, 0xba, 0x73, 0x51, 0x81, 0xa0, 0x00, 0x81, 0xa1, 0xd4, 0x04, 0x13,
+    0xa3, 0xbf, 0xaf, 0x03, 0xb2, 0xb0, 0x13, 0xa4, 0xa5, 0x42, 0x02, 0xdb, 0x42, 0x02, 0x08, 0xaf,
+    0x00, 0x17, 0x43, 0x10, 0x90, 0x05, 0x83, 0x21, 0x81, 0x92, 0x18, 0x03, 0x70, 0x9c, 0x00, 0x81,
+    0x9d, 0x00, 0x81, 0x9e, 0x10, 0x05, 0x00, 0xab, 0x1e, 0x11, 0x95, 0x30, 0x03, 0x20, 0x97, 0x00,
+    0xf6, 0x03, 0x01, 0x77, 0x22, 0x00, 0x39, 0x03, 0x02, 0x38, 0x04, 0x02, 0x32, 0x04, 0x01, 0xce,
+    0x19, 0x02, 0xf0, 0x06, 0x12, 0x81, 0x68, 0x04, 0x02, 0x62, 0x04, 0x01, 0x2f, 0x19, 0x11, 0x81,
+    0x29, 0x19, 0x11, 0x81, 0x23, 0x19, 0x11, 0x81, 0x23, 0x19, 0x12, 0x81, 0x5c, 0x04, 0x02, 0x56,
+    0x04, 0x01, 0x86, 0x19, 0x11, 0x81, 0x86, 0x19, 0x11, 0x81, 0xc2, 0x19, 0x02, 0xd3, 0x95, 0x11,
+    0x81, 0xb6, 0x19, 0x11, 0x81, 0xb0, 0x19, 0x12, 0x81, 0x2c, 0x04, 0x01, 0x8f, 0x19, 0x11, 0x81,
+    0x8f, 0x19, 0x11, 0x81, 0x8f, 0x19, 0x11, 0x81, 0xb3, 0x19, 0x11, 0x81, 0xb3, 0x19, 0x11, 0x81,
+    0x77, 0x19, 0x12, 0x81, 0x1a, 0x04, 0x01, 0x6b, 0x19, 0x11, 0x81, 0x6b, 0x19, 0x12, 0x81, 0x20,
+    0x04, 0x01, 0x83, 0x19, 0x00, 0x52, 0x57, 0x01, 0xb8, 0x17, 0x41, 0x80, 0x19, 0x01, 0x88, 0x80,
+    0x01, 0x11, 0x88, 0xd8, 0x1b, 0x03, 0x9e, 0x01, 0x11, 0x2a, 0x80, 0x49, 0x02, 0x6e, 0x01, 0x13,
+    0x28, 0x35, 0x49, 0x54, 0x00, 0x00, 0x00, 0x15, 0x02, 0x70, 0x81, 0x14, 0x4c, 0x8a, 0x00, 0x11,
+    0x57, 0xf5, 0x04, 0x01, 0x00, 0x03, 0x21, 0x81, 0x6b, 0x22, 0x75, 0x01, 0xe2, 0x02, 0x00, 0xab,
+    0x88, 0x10, 0x6f, 0x4a, 0x49, 0x00, 0x0c, 0x00, 0x01, 0x52, 0x02, 0x00, 0x5f, 0x49, 0x11, 0x1e,
+    0x16, 0x05, 0x31, 0x65, 0x00, 0x8a, 0xe6, 0x01, 0x11, 0x8a, 0xcc, 0x06, 0x22, 0x15, 0x03, 0xbe,
+    0x1d, 0x00, 0x2f, 0x01, 0x27, 0x81, 0x44, 0x0c, 0x00, 0x10, 0x46, 0x3b, 0x01, 0x01, 0x2b, 0x0a,
+    0x03, 0x08, 0x01, 0x02, 0xf1, 0x2e, 0x03, 0x0e, 0x01, 0x02, 0x84, 0x06, 0x01, 0xcc, 0x1b, 0x24,
+    0x15, 0x06, 0xcc, 0x42, 0x11, 0x55, 0xee, 0x6f, 0x10, 0x62, 0xe6, 0x01, 0x00, 0x1e, 0x00, 0x02,
+    0xee, 0xb0, 0x0f, 0x06, 0x00, 0x0b, 0x02, 0x0e, 0x04, 0x02, 0x0c, 0x00, 0x02, 0xc0, 0xa5, 0x01,
+    0x42, 0x09, 0x11, 0x81, 0x4e, 0x09, 0x11, 0x81, 0x48, 0x09, 0x11, 0x81, 0x48, 0x09, 0x21, 0x81,
+    0x57, 0x06, 0x00, 0x01, 0x4b, 0x09, 0x11, 0x81, 0x6c, 0x88, 0x03, 0x0f, 0x45, 0x01, 0xb2, 0x17,
+    0x02, 0x4a, 0x07, 0x02, 0x34, 0x4a, 0x03, 0x84, 0x1e, 0x08, 0xe3, 0x80, 0x02, 0x1b, 0x4b, 0x02,
+    0xa0, 0x4a, 0x02, 0x4e, 0x7f, 0x02, 0xae, 0x82, 0x02, 0xa8, 0x70, 0x11, 0x6d, 0xa5, 0x1e, 0x02,
+    0xcc, 0x1e, 0x02, 0x40, 0x05, 0x11, 0x29, 0x72, 0x6d, 0x11, 0x2a, 0x40, 0xa1, 0x20, 0x2d, 0x03,
+    0x37, 0x63, 0x11, 0x2e, 0x3a, 0x63, 0x11, 0x33, 0xaf, 0x69, 0x11, 0x34, 0xb2, 0x69, 0x40, 0x35,
+    0x00, 0x81, 0x3a, 0xc4, 0x69, 0x00, 0x30, 0x00, 0x02, 0x1a, 0x07, 0x02, 0xc3, 0x7f, 0x11, 0x60,
+    0xf9, 0x70, 0x11, 0x7f, 0xa2, 0x00, 0x11, 0x81, 0x06, 0x00, 0x01, 0x65, 0x59, 0x11, 0x81, 0x62,
+    0x59, 0x21, 0x81, 0x77, 0x06, 0x00, 0x11, 0x79, 0x06, 0x00, 0x01, 0xa1, 0x59, 0x11, 0x81, 0x9e,
+    0x59, 0x21, 0x81, 0x53, 0xe8, 0x20, 0x11, 0x55, 0x06, 0x00, 0x01, 0x8c, 0x50, 0x21, 0x81, 0x56,
+    0x06, 0x00, 0x11, 0x4f, 0x06, 0x00, 0x01, 0xfb, 0x89, 0x11, 0x81, 0xb6, 0x50, 0x11, 0x81, 0xb3,
+    0x50, 0x11, 0x81, 0x7b, 0x18, 0x02, 0x34, 0x08, 0x11, 0x81, 0xd2, 0xae, 0x11, 0x81, 0xcc, 0xae,
+    0x21, 0x81, 0x89, 0x4e, 0x00, 0x11, 0x8a, 0x06, 0x00, 0x01, 0xe0, 0x07, 0x11, 0x81, 0x31, 0x4e,
+    0x11, 0x81, 0xec, 0xaf, 0x11, 0x81, 0x34, 0x4e, 0x11, 0x81, 0x09, 0x4f, 0x11, 0x81, 0x0a, 0xb0,
+    0x11, 0x81, 0xdb, 0x4f, 0x11, 0x81, 0x7c, 0x11, 0x11, 0x81, 0x90, 0xa5, 0x11, 0x81, 0xb5, 0x11,
+    0x03, 0x5c, 0xa0, 0x01, 0x9c, 0xa5, 0x11, 0x81, 0x8e, 0x11, 0x11, 0x81, 0xb8, 0x11, 0x11, 0x81,
+    0xaf, 0x11, 0x11, 0x81, 0xc2, 0x89, 0x11, 0x81, 0xc2, 0x89, 0x21, 0x81, 0xc0, 0xf0, 0x6a, 0x11,
+    0xc2, 0xf0, 0x6a, 0x11, 0xc1, 0xf9, 0x6a, 0x11, 0xc3, 0xf9, 0x6a, 0x11, 0xa8, 0xe8, 0x2c, 0x11,
+    0xaa, 0x06, 0x00, 0x01, 0x64, 0x54, 0x03, 0x6e, 0x97, 0x10, 0x94, 0x65, 0xac, 0x00, 0x74, 0xac,
+    0x10, 0x9a, 0xd8, 0xa2, 0x21, 0x81, 0x99, 0x7d, 0xac, 0x31, 0x9b, 0x05, 0x81, 0xb4, 0x1b, 0x02,
+    0xbe, 0x08, 0x11, 0x81, 0x8b, 0x0b, 0x02, 0xca, 0xa7, 0x11, 0x81, 0x91, 0x0b, 0x11, 0x81, 0x8b,
+    0x0b, 0x11, 0x81, 0x88, 0x0b, 0x11, 0x81, 0x70, 0x8a, 0x02, 0x18, 0xa2, 0x21, 0x81, 0x50, 0x06,
+    0x00, 0x01, 0x8d, 0x5b, 0x11, 0x81, 0x46, 0x0b, 0x11, 0x81, 0x58, 0x0b, 0x11, 0x81, 0x46, 0x0b,
+    0x11, 0x81, 0x46, 0x0b, 0x11, 0x81, 0x3a, 0x0b, 0x11, 0x81, 0x4c, 0x0b, 0x11, 0x81, 0x40, 0x0b,
+    0x11, 0x81, 0x99, 0x5e, 0x11, 0x81, 0x8d, 0x5e, 0x11, 0x81, 0x9c, 0x5e, 0x11, 0x81, 0x90, 0x5e,
+    0x11, 0x81, 0x2c, 0x0d, 0x11, 0x81, 0x1a, 0x0d, 0x11, 0x81, 0x2c, 0x0d, 0x11, 0x81, 0x20, 0x0d,
+    0x11, 0x81, 0x2d, 0x1b, 0x11, 0x81, 0x52, 0x4a, 0x11, 0x81, 0xf0, 0x5e, 0x11, 0x81, 0xcc, 0x9f,
+    0x11, 0x81, 0xf3, 0x5e, 0x11, 0x81, 0xed, 0x5e, 0x11, 0x81, 0x44, 0x0d, 0x11, 0x81, 0x38, 0x0d,
+    0x11, 0x81, 0x44, 0x0d, 0x11, 0x81, 0x3b, 0x0d, 0x00, 0x32, 0xa9, 0x11, 0xd8, 0x35, 0xa9, 0x10,
+    0xd9, 0x32, 0xa9, 0x00, 0x78, 0x6d, 0x10, 0xd7, 0x72, 0x6d, 0xf0, 0x21, 0x0e, 0x28, 0x00, 0x0e,
+    0x29, 0x00, 0x0e, 0x2a, 0x00, 0x0e, 0x2b, 0x00, 0x0e, 0x2c, 0x00, 0x0e, 0x2d, 0x00, 0x0e, 0x2e,
+    0x00, 0x0e, 0x2f, 0x00, 0x0e, 0x30, 0x00, 0x0e, 0x31, 0x00, 0x0e, 0x32, 0x00, 0x0e, 0x33, 0x00,
+    0x0e, 0x34, 0x00, 0x0e, 0x35, 0x00, 0x0e, 0x36, 0x00, 0x0e, 0x37, 0x00, 0x89, 0x91, 0x20, 0xc7,
+    0x01, 0xb4, 0xa2, 0x11, 0xc9, 0xac, 0x92, 0x11, 0xc8, 0xbd, 0xa2, 0x20, 0xca, 0x01, 0xf1, 0x20,
+    0x20, 0x13, 0x02, 0x35, 0x83, 0x41, 0x15, 0x02, 0x81, 0x18, 0xfd, 0x20, 0x11, 0x1a, 0x09, 0x21,
+    0x11, 0x8f, 0x12, 0x85, 0x11, 0x91, 0xa6, 0x92, 0x13, 0x90, 0xa9, 0x92, 0x00, 0x85, 0x92, 0x11,
+    0x95, 0x15, 0x93, 0x11, 0x96, 0x03, 0x93, 0x20, 0xf3, 0x01, 0x30, 0x7c, 0x11, 0xf5, 0x30, 0x7c,
+    0x11, 0xf4, 0x39, 0x7c, 0x11, 0xf6, 0x39, 0x7c, 0x11, 0xf9, 0xbb, 0x7e, 0x11, 0xfa, 0xbe, 0x7e,
+    0x11, 0x57, 0x67, 0x9e, 0x71, 0x59, 0x02, 0x81, 0x55, 0x02, 0x81, 0x58, 0x70, 0x9e, 0x11, 0x5a,
+    0x73, 0x9e, 0x10, 0x5d, 0xa7, 0x9d, 0x21, 0x81, 0x5e, 0xb9, 0x9d, 0x11, 0x93, 0x00, 0x61, 0x11,
+    0x95, 0xf7, 0x60, 0x11, 0x94, 0x09, 0x61, 0x11, 0x96, 0x00, 0x61, 0x11, 0x99, 0xc9, 0x61, 0x11,
+    0x9a, 0xc3, 0x61, 0x10, 0xd3, 0x5f, 0xa3, 0x21, 0x81, 0xd5, 0x6e, 0xa3, 0x11, 0xd4, 0x77, 0xa3,
+    0x71, 0xd6, 0x01, 0x81, 0xd2, 0x01, 0x81, 0x1f, 0xec, 0x83, 0x11, 0x21, 0xec, 0x83, 0x11, 0x20,
+    0xf5, 0x83, 0x11, 0x22, 0xf5, 0x83, 0x11, 0x9b, 0xb2, 0x9e, 0x11, 0x9d, 0xc0, 0x93, 0x40, 0x9c,
+    0x01, 0x81, 0x98, 0xf2, 0x9d, 0x00, 0xb4, 0x93, 0x11, 0xa1, 0x07, 0x9e, 0x11, 0xa2, 0x0a, 0x9e,
+    0x11, 0xff, 0x4e, 0x7f, 0x11, 0x01, 0xa5, 0x85, 0x11, 0x00, 0x9d, 0x92, 0x20, 0x02, 0x02, 0xae,
+    0x85, 0x11, 0x05, 0xd0, 0x92, 0x11, 0x06, 0xcc, 0x7f, 0x11, 0x63, 0x55, 0x9e, 0x11, 0x65, 0x97,
+    0x90, 0x11, 0x64, 0x5e, 0x9e, 0x11, 0x66, 0xa0, 0x90, 0x71, 0x69, 0x02, 0x81, 0x67, 0x02, 0x81,
+    0x6a, 0xcb, 0xa0, 0x20, 0x9f, 0x02, 0xc6, 0xa2, 0x11, 0xa1, 0x89, 0x65, 0x11, 0xa0, 0x92, 0x65,
+    0x11, 0xa2, 0x92, 0x65, 0x11, 0xa5, 0xd2, 0x61, 0x11, 0xa6, 0xd5, 0x61, 0x01, 0x76, 0x4a, 0x11,
+    0x81, 0x76, 0x4a, 0x02, 0x10, 0x0b, 0x02, 0x67, 0x47, 0x00, 0x09, 0x00, 0x01, 0x7e, 0x5b, 0x11,
+    0x81, 0x6f, 0x5b, 0x11, 0x81, 0x7e, 0x5b, 0x11, 0x81, 0x72, 0x5b, 0x21, 0x81, 0xc4, 0x06, 0x00,
+    0x01, 0xab, 0x5b, 0x21, 0x81, 0xc5, 0x06, 0x00, 0x20, 0xc7, 0x04, 0x7d, 0x94, 0x11, 0xd7, 0xc3,
+    0x93, 0x11, 0xd9, 0xe1, 0x93, 0x11, 0xd8, 0x87, 0x93, 0x11, 0xda, 0xd3, 0x84, 0x11, 0x23, 0xd3,
+    0x84, 0x11, 0x25, 0xdc, 0x84, 0x11, 0x24, 0xdc, 0x84, 0x20, 0x26, 0x02, 0xb3, 0x94, 0x11, 0xa3,
+    0x4f, 0xa1, 0x11, 0xa5, 0xa7, 0x94, 0x11, 0xa4, 0xed, 0x93, 0x41, 0xa6, 0x01, 0x81, 0xad, 0x58,
+    0xa1, 0x10, 0xae, 0x5b, 0xa1, 0x00, 0xc4, 0x63, 0x11, 0x07, 0xc4, 0x63, 0x11, 0x09, 0xcd, 0x63,
+    0x11, 0x08, 0xcd, 0x63, 0x41, 0x0a, 0x02, 0x81, 0x11, 0xd3, 0x63, 0x11, 0x12, 0xd6, 0x63, 0x20,
+    0x6f, 0x02, 0x0d, 0xa1, 0x11, 0x71, 0x07, 0xa1, 0x11, 0x70, 0x16, 0xa1, 0x11, 0x72, 0x10, 0xa1,
+    0x40, 0x75, 0x02, 0x81, 0x73, 0xd6, 0xa4, 0x00, 0xeb, 0xa4, 0x11, 0xab, 0xad, 0x62, 0x20, 0xad,
+    0x02, 0x42, 0x9f, 0x11, 0xac, 0xb6, 0x62, 0x11, 0xae, 0x88, 0x63, 0x11, 0xb1, 0x76, 0x63, 0x71,
+    0xb2, 0x02, 0x81, 0xb0, 0x02, 0x81, 0xdb, 0x02, 0x04, 0x01, 0x4b, 0xc9, 0x11, 0x81, 0xed, 0x6a,
+    0x21, 0x81, 0xde, 0x06, 0x00, 0x07, 0x9b, 0x07, 0x01, 0xeb, 0x08, 0x00, 0xf0, 0x00, 0x21, 0x8b,
+    0x8c, 0x06, 0x00, 0x11, 0x87, 0x06, 0x00, 0x31, 0x88, 0x04, 0x8b, 0xbc, 0x10, 0x11, 0x8b, 0x44,
+    0xa3, 0x11, 0x8b, 0xc2, 0x10, 0x11, 0x8b, 0x4a, 0xa3, 0x11, 0x8b, 0x9c, 0x8c, 0x21, 0x8b, 0x85,
+    0x06, 0x00, 0x01, 0x81, 0x5e, 0x11, 0x8b, 0x7e, 0x5e, 0x21, 0x8b, 0x7b, 0x06, 0x00, 0x11, 0x7d,
+    0x06, 0x00, 0x01, 0xbd, 0x5e, 0x11, 0x8b, 0xba, 0x5e, 0x11, 0x8b, 0x4e, 0x8e, 0x11, 0x8b, 0x56,
+    0x5f, 0xd1, 0x8b, 0x8f, 0x04, 0x8b, 0x93, 0x04, 0x8b, 0x90, 0x04, 0x8b, 0x94, 0x04, 0x8b, 0xa0,
+    0xaa, 0x11, 0x8b, 0xad, 0x16, 0x11, 0x8b, 0xa6, 0x1d, 0x11, 0x8b, 0x5c, 0xb2, 0x11, 0x8b, 0x9a,
+    0x1d, 0x11, 0x8b, 0x07, 0x63, 0x11, 0x8b, 0x16, 0x63, 0x11, 0x8b, 0xf1, 0x4a, 0x00, 0x84, 0x24,
+    0x11, 0xc0, 0x8d, 0x24, 0x40, 0xc1, 0x04, 0x8b, 0x5c, 0xf3, 0x09, 0x20, 0x8b, 0x5d, 0xff, 0x09,
+    0xd1, 0x8b, 0x58, 0x00, 0x8b, 0x5b, 0x00, 0x8b, 0x59, 0x00, 0x8b, 0x5a, 0x00, 0x8b, 0xf5, 0x16,
+    0x11, 0x8b, 0xf4, 0xaa, 0x11, 0x8b, 0x8e, 0x0b, 0x11, 0x8b, 0x4f, 0x4a, 0x00, 0x62, 0xd9, 0x00,
+    0x6e, 0x0a, 0x01, 0x84, 0x00, 0x01, 0xd7, 0x5f, 0xf1, 0x22, 0x8b, 0x6f, 0x04, 0x8b, 0x70, 0x04,
+    0x8b, 0x73, 0x04, 0x8b, 0x74, 0x04, 0x8b, 0x71, 0x04, 0x8b, 0x72, 0x04, 0x8b, 0x75, 0x04, 0x8b,
+    0x76, 0x04, 0x8b, 0x67, 0x04, 0x8b, 0x68, 0x04, 0x8b, 0x6b, 0x04, 0x8b, 0x6c, 0x04, 0x8b, 0x69,
+    0x04, 0x8b, 0x6a, 0x04, 0x8b, 0x6d, 0x04, 0x8b, 0x6e, 0x04, 0x8b, 0x20, 0x1f, 0x11, 0x8b, 0x17,
+    0x1f, 0x11, 0x8b, 0x23, 0x1f, 0x11, 0x8b, 0x1d, 0x1f, 0x11, 0x8b, 0x54, 0x5e, 0x11, 0x8b, 0xff,
+    0x5b, 0x11, 0x8b, 0xa7, 0x5c, 0x11, 0x8b, 0x50, 0x1f, 0x11, 0x8b, 0xb2, 0x63, 0x11, 0x8b, 0xa6,
+    0x63, 0x11, 0x8b, 0xb5, 0x63, 0x11, 0x8b, 0xa9, 0x63, 0xf1, 0xff, 0x88, 0x8b, 0xe7, 0x01, 0x8b,
+    0xe8, 0x01, 0x8b, 0xeb, 0x01, 0x8b, 0xec, 0x01, 0x8b, 0xe9, 0x01, 0x8b, 0xea, 0x01, 0x8b, 0xed,
+    0x01, 0x8b, 0xee, 0x01, 0x8b, 0xdf, 0x01, 0x8b, 0xe0, 0x01, 0x8b, 0xe3, 0x01, 0x8b, 0xe4, 0x01,
+    0x8b, 0xe1, 0x01, 0x8b, 0xe2, 0x01, 0x8b, 0xe5, 0x01, 0x8b, 0xe6, 0x01, 0x8b, 0x33, 0x02, 0x8b,
+    0x34, 0x02, 0x8b, 0x37, 0x02, 0x8b, 0x38, 0x02, 0x8b, 0x35, 0x02, 0x8b, 0x36, 0x02, 0x8b, 0x39,
+    0x02, 0x8b, 0x3a, 0x02, 0x8b, 0x2b, 0x02, 0x8b, 0x2c, 0x02, 0x8b, 0x2f, 0x02, 0x8b, 0x30, 0x02,
+    0x8b, 0x2d, 0x02, 0x8b, 0x2e, 0x02, 0x8b, 0x31, 0x02, 0x8b, 0x32, 0x02, 0x8b, 0x1f, 0x04, 0x8b,
+    0x20, 0x04, 0x8b, 0x21, 0x04, 0x8b, 0x22, 0x04, 0x8b, 0x1b, 0x04, 0x8b, 0x1c, 0x04, 0x8b, 0x1d,
+    0x04, 0x8b, 0x1e, 0x04, 0x8b, 0xb7, 0x01, 0x8b, 0xb8, 0x01, 0x8b, 0xbb, 0x01, 0x8b, 0xbc, 0x01,
+    0x8b, 0xb9, 0x01, 0x8b, 0xba, 0x01, 0x8b, 0xbd, 0x01, 0x8b, 0xbe, 0x01, 0x8b, 0xaf, 0x01, 0x8b,
+    0xb0, 0x01, 0x8b, 0xb3, 0x01, 0x8b, 0xb4, 0x01, 0x8b, 0xb1, 0x01, 0x8b, 0xb2, 0x01, 0x8b, 0xb5,
+    0x01, 0x8b, 0xb6, 0x01, 0x8b, 0xc3, 0x01, 0x8b, 0xc4, 0x01, 0x8b, 0xc5, 0x01, 0x8b, 0xc6, 0x01,
+    0x8b, 0xbf, 0x01, 0x8b, 0xc0, 0x01, 0x8b, 0xc1, 0x01, 0x8b, 0xc2, 0x01, 0x8b, 0x43, 0x02, 0x8b,
+    0x44, 0x02, 0x8b, 0x47, 0x02, 0x8b, 0x48, 0x02, 0x8b, 0x45, 0x02, 0x8b, 0x46, 0x02, 0x8b, 0x49,
+    0x02, 0x8b, 0x4a, 0x02, 0x8b, 0x3b, 0x02, 0x8b, 0x3c, 0x02, 0x8b, 0x3f, 0x02, 0x8b, 0x40, 0x02,
+    0x8b, 0x3d, 0x02, 0x8b, 0x3e, 0x02, 0x8b, 0x41, 0x02, 0x8b, 0x42, 0x02, 0x8b, 0x4f, 0x02, 0x8b,
+    0x50, 0x02, 0x8b, 0x51, 0x02, 0x8b, 0x52, 0x02, 0x8b, 0x4b, 0x02, 0x8b, 0x4c, 0x02, 0x8b, 0x4d,
+    0x02, 0x8b, 0x4e, 0x02, 0x8b, 0x7f, 0x02, 0x8b, 0x80, 0x02, 0x8b, 0x83, 0x02, 0x8b, 0x84, 0x02,
+    0x8b, 0x81, 0x02, 0x8b, 0x82, 0x02, 0x8b, 0x85, 0x02, 0x8b, 0x86, 0x02, 0x8b, 0x77, 0x02, 0x8b,
+    0x78, 0x02, 0x8b, 0x7b, 0x02, 0x8b, 0x7c, 0x02, 0x8b, 0x79, 0x02, 0x8b, 0x7a, 0x02, 0x8b, 0x7d,
+    0x02, 0x8b, 0x7e, 0x02, 0x8b, 0x8b, 0x02, 0x8b, 0x8c, 0x02, 0x8b, 0x8d, 0x02, 0x8b, 0x8e, 0x02,
+    0x8b, 0x87, 0x02, 0x8b, 0x88, 0x02, 0x8b, 0x89, 0x02, 0x8b, 0x8a, 0x02, 0x8b, 0xbb, 0x02, 0x8b,
+    0xbc, 0x02, 0x8b, 0xbf, 0x02, 0x8b, 0xc0, 0x02, 0x8b, 0xbd, 0x02, 0x8b, 0xbe, 0x02, 0x8b, 0xc1,
+    0x02, 0x8b, 0xc2, 0x02, 0x8b, 0xb3, 0x02, 0x8b, 0xb4, 0x02, 0x8b, 0xb7, 0x02, 0x8b, 0xb8, 0x02,
+    0x8b, 0xb5, 0x02, 0x8b, 0xb6, 0x02, 0x8b, 0xb9, 0x02, 0x8b, 0xba, 0x02, 0x8b, 0xc7, 0x02, 0x8b,
+    0xc8, 0x02, 0x8b, 0xc9, 0x02, 0x8b, 0xca, 0x02, 0x8b, 0xc3, 0x02, 0x8b, 0xc4, 0x02, 0x8b, 0xc5,
+    0x02, 0x8b, 0x21, 0xae, 0x21, 0x8b, 0xd7, 0x06, 0x00, 0x11, 0xd9, 0x06, 0x00, 0x11, 0xd8, 0x06,
+    0x00, 0x11, 0xda, 0x06, 0x00, 0x01, 0xc5, 0x19, 0x21, 0x8b, 0xd5, 0x06, 0x00, 0x01, 0xcb, 0x19,
+    0x39, 0x8b, 0xd6, 0x02, 0xeb, 0x8a, 0x26, 0x6d, 0x01, 0x4c, 0x8a, 0xb3, 0x59, 0x01, 0x81, 0x5a,
+    0x01, 0x81, 0x5b, 0x01, 0x81, 0x5c, 0x01, 0x8e, 0x3b, 0x02, 0x5b, 0x0b, 0x01, 0xf5, 0xbb, 0x00,
+    0x63, 0x27, 0x13, 0x74, 0x14, 0xbb, 0x11, 0x81, 0x28, 0x63, 0x11, 0x81, 0x22, 0x63, 0x21, 0x81,
+    0x42, 0x06, 0x00, 0x11, 0x44, 0x06, 0x00, 0x01, 0x2b, 0x63, 0x11, 0x81, 0x22, 0x63, 0x11, 0x81,
+    0x31, 0x63, 0x11, 0x81, 0xb3, 0x3d, 0x12, 0x81, 0x0e, 0xa6, 0x01, 0x30, 0x51, 0x21, 0x81, 0x27,
+    0xda, 0x04, 0x01, 0xb6, 0x10, 0x21, 0x81, 0x28, 0x06, 0x00, 0x01, 0x5a, 0xb7, 0x11, 0x81, 0x9c,
+    0xb7, 0x02, 0xe2, 0x0e, 0x11, 0x81, 0xbd, 0x61, 0x11, 0x81, 0xba, 0x61, 0x06, 0xeb, 0x0b, 0x11,
+    0x84, 0xfd, 0x0b, 0x05, 0xb5, 0x0b, 0x05, 0x45, 0x88, 0x26, 0x4e, 0x01, 0xd6, 0x84, 0x1a, 0x6a,
+    0x18, 0x6d, 0x10, 0x3b, 0xb5, 0x0b, 0x00, 0x47, 0x28, 0x14, 0x43, 0x1b, 0x0c, 0x02, 0x07, 0x78,
+    0x01, 0x0c, 0xba, 0x02, 0x0e, 0xbb, 0x11, 0x81, 0x1a, 0x13, 0x11, 0x81, 0x14, 0x13, 0x21, 0x81,
+    0x3a, 0x06, 0x00, 0x11, 0x3c, 0x06, 0x00, 0x01, 0x0e, 0x13, 0x11, 0x81, 0x21, 0x64, 0x21, 0x81,
+    0x3e, 0x06, 0x00, 0x01, 0x27, 0x64, 0x11, 0x81, 0x7b, 0x4b, 0x11, 0x81, 0x6d, 0x14, 0x02, 0x64,
+    0x11, 0x11, 0x81, 0xd2, 0x21, 0x06, 0xab, 0x0c, 0x14, 0x7e, 0x5e, 0x7b, 0x02, 0x55, 0x7b, 0x16,
+    0x9b, 0x5d, 0x0c, 0x20, 0x8b, 0x89, 0xa1, 0x0d, 0x02, 0x18, 0x85, 0xf4, 0x01, 0x09, 0x02, 0x00,
+    0x09, 0x03, 0x00, 0x09, 0x04, 0x00, 0x09, 0x05, 0x00, 0x09, 0x06, 0x00, 0x09, 0x5c, 0x9f, 0x14,
+    0x09, 0xf4, 0x8f, 0x00, 0xad, 0x3a, 0x11, 0x94, 0x7b, 0x76, 0x11, 0x7c, 0xf8, 0x07, 0x11, 0x99,
+    0x7c, 0x38, 0x10, 0x88, 0x1e, 0x3c, 0x00, 0x0f, 0x00, 0x11, 0x9a, 0x85, 0x38, 0x10, 0x89, 0x27,
+    0x3c, 0x00, 0x0f, 0x00, 0x11, 0x9b, 0xa0, 0x75, 0x10, 0x8a, 0x33, 0x3c, 0x00, 0x0f, 0x00, 0x02,
+    0xd3, 0x38, 0x10, 0x82, 0x16, 0x2c, 0x00, 0x09, 0x00, 0x11, 0x58, 0xf2, 0x77, 0x10, 0x83, 0x1f,
+    0x2c, 0x00, 0x0f, 0x00, 0x10, 0x59, 0xfe, 0x77, 0x03, 0x67, 0x00, 0x00, 0x56, 0x0a, 0x36, 0x07,
+    0x81, 0x35, 0xdb, 0x9f, 0x00, 0x0e, 0x89, 0x01, 0xe3, 0x56, 0x03, 0x0f, 0x00, 0x10, 0x33, 0x93,
+    0x88, 0x06, 0x0f, 0x00, 0x10, 0x34, 0x9f, 0x88, 0x06, 0x0f, 0x00, 0x02, 0x21, 0x33, 0x13, 0x80,
+    0x4e, 0x00, 0x50, 0x81, 0x53, 0x03, 0x81, 0x51, 0xb4, 0x3c, 0x03, 0x0f, 0x00, 0x22, 0x54, 0x03,
+    0xbb, 0x3b, 0x03, 0x0f, 0x00, 0x91, 0xc8, 0x03, 0x81, 0x8c, 0x00, 0x06, 0x1f, 0x00, 0x06, 0x7e,
+    0x0c, 0xa2, 0x06, 0x21, 0x00, 0x06, 0x22, 0x00, 0x06, 0x23, 0x00, 0x06, 0x01, 0x0e, 0x20, 0xcb,
+    0x03, 0xe0, 0x01, 0x31, 0xcc, 0x03, 0x06, 0x0a, 0x0e, 0xf1, 0x01, 0x06, 0x26, 0x00, 0x06, 0x27,
+    0x00, 0x06, 0x28, 0x00, 0x06, 0x29, 0x00, 0x81, 0xce, 0x03, 0x09, 0xd4, 0x13, 0x03, 0x48, 0x00,
+    0x04, 0xd4, 0x77, 0x41, 0x09, 0x0d, 0x00, 0x81, 0xcb, 0x16, 0x00, 0x73, 0x38, 0x01, 0x76, 0x1a,
+    0x03, 0x21, 0x00, 0x13, 0x2c, 0xba, 0x3c, 0x03, 0x0f, 0x00, 0x34, 0x2d, 0x03, 0x81, 0x9b, 0x71,
+    0x00, 0x0f, 0x00, 0x10, 0x2e, 0x73, 0x0b, 0x06, 0x0f, 0x00, 0x10, 0x2a, 0x6d, 0x6f, 0x31, 0x10,
+    0x02, 0x00, 0x7d, 0x1b, 0x01, 0xda, 0x2b, 0x51, 0x29, 0x01, 0x10, 0x04, 0x00, 0x96, 0x3b, 0x10,
+    0x00, 0x53, 0x37, 0x11, 0x60, 0xb8, 0x2c, 0x01, 0x7a, 0x19, 0x00, 0x73, 0x02, 0x61, 0x48, 0x01,
+    0x10, 0x06, 0x00, 0x10, 0x04, 0x01, 0x00, 0x7f, 0x02, 0x62, 0x49, 0x01, 0x10, 0x08, 0x00, 0x10,
+    0x97, 0x14, 0x92, 0x30, 0x01, 0x81, 0x24, 0x01, 0x10, 0x0a, 0x00, 0x10, 0x8e, 0x14, 0x81, 0x31,
+    0x01, 0x81, 0x25, 0x01, 0x10, 0x0c, 0x00, 0x99, 0xb6, 0x10, 0x00, 0xd0, 0x81, 0x17, 0x25, 0x3b,
+    0x01, 0x10, 0x28, 0xe5, 0x81, 0x06, 0x0f, 0x00, 0x10, 0x16, 0xc2, 0x3a, 0x06, 0x0f, 0x00, 0x10,
+    0x17, 0x10, 0x8d, 0x05, 0x0f, 0x00, 0x11, 0x80, 0xec, 0xb5, 0x06, 0x1e, 0x00, 0x10, 0x3d, 0xb0,
+    0x34, 0x06, 0x0f, 0x00, 0x01, 0xc2, 0x34, 0x06, 0x0f, 0x00, 0x10, 0xa7, 0x24, 0x36, 0x06, 0x0f,
+    0x00, 0x01, 0x36, 0x36, 0x06, 0x0f, 0x00, 0x10, 0x9f, 0x36, 0x36, 0x06, 0x0f, 0x00, 0x01, 0x48,
+    0x36, 0x06, 0x0f, 0x00, 0x10, 0xa3, 0x48, 0x36, 0x06, 0x0f, 0x00, 0x01, 0x5a, 0x36, 0x06, 0x0f,
+    0x00, 0x10, 0xc3, 0x40, 0x6f, 0x06, 0x0f, 0x00, 0x10, 0xc4, 0x4c, 0x6f, 0x06, 0x0f, 0x00, 0x10,
+    0xb5, 0x6c, 0x36, 0x06, 0x0f, 0x00, 0x01, 0x7e, 0x36, 0x06, 0x0f, 0x00, 0x10, 0xad, 0x7e, 0x36,
+    0x06, 0x0f, 0x00, 0x01, 0x90, 0x36, 0x06, 0x0f, 0x00, 0x10, 0xb1, 0x90, 0x36, 0x06, 0x0f, 0x00,
+    0x01, 0xa2, 0x36, 0x06, 0x0f, 0x00, 0x13, 0x49, 0x7c, 0xad, 0x03, 0x0f, 0x00, 0x01, 0x3a, 0x38,
+    0x06, 0x0f, 0x00, 0x10, 0x51, 0x00, 0x39, 0x06, 0x0f, 0x00, 0x01, 0x12, 0x39, 0x06, 0x0f, 0x00,
+    0x10, 0x4d, 0xc2, 0x34, 0x06, 0x0f, 0x00, 0x01, 0xd4, 0x34, 0x06, 0x0f, 0x00, 0x10, 0x07, 0x28,
+    0x35, 0x06, 0x0f, 0x00, 0x01, 0x3a, 0x35, 0x05, 0x0f, 0x00, 0x00, 0x12, 0x00, 0x01, 0x84, 0x0c,
+    0x06, 0x0f, 0x00, 0x01, 0x8d, 0x0c, 0x06, 0x0f, 0x00, 0x01, 0x34, 0xbf, 0x06, 0x0f, 0x00, 0x01,
+    0x9e, 0x28, 0x06, 0x0f, 0x00, 0x0a, 0x33, 0x2d, 0x11, 0x81, 0xa3, 0x11, 0x06, 0x0f, 0x00, 0x01,
+    0xba, 0x0c, 0x06, 0x0f, 0x00, 0x01, 0xbd, 0x0c, 0x03, 0x0c, 0x00, 0x10, 0x16, 0x9e, 0x3a, 0x06,
+    0x0f, 0x00, 0x01, 0xb0, 0x3a, 0x06, 0x0f, 0x00, 0x10, 0x1e, 0xde, 0x70, 0x06, 0x0f, 0x00, 0x10,
+    0x1f, 0xea, 0x70, 0x06, 0x0f, 0x00, 0x10, 0x1a, 0x83, 0x7a, 0x06, 0x0f, 0x00, 0x34, 0x1b, 0x04,
+    0x81, 0x00, 0x6a, 0x03, 0x12, 0x00, 0x01, 0xf3, 0x64, 0x06, 0x0f, 0x00, 0x1a, 0xf2, 0x0f, 0x00,
+    0x01, 0x23, 0x65, 0x06, 0x0f, 0x00, 0x01, 0xc3, 0xb4, 0x06, 0x0f, 0x00, 0x01, 0x38, 0x65, 0x06,
+    0x0f, 0x00, 0x1a, 0xf0, 0x0f, 0x00, 0x01, 0x14, 0x40, 0x06, 0x0f, 0x00, 0x01, 0x1d, 0x40, 0x06,
+    0x0f, 0x00, 0x01, 0x26, 0x40, 0x06, 0x0f, 0x00, 0x01, 0x2f, 0x40, 0x06, 0x0f, 0x00, 0x01, 0x80,
+    0x65, 0x06, 0x0f, 0x00, 0x01, 0x1d, 0x98, 0x06, 0x0f, 0x00, 0x01, 0x0e, 0x40, 0x06, 0x0f, 0x00,
+    0x01, 0xcf, 0x97, 0x06, 0x0f, 0x00, 0x01, 0x8f, 0x43, 0x06, 0x0f, 0x00, 0x01, 0x98, 0x43, 0x06,
+    0x0f, 0x00, 0x01, 0x5e, 0x1d, 0x06, 0x0f, 0x00, 0x04, 0x99, 0x6a, 0x03, 0x0f, 0x00, 0x04, 0x9f,
+    0x6a, 0x03, 0x0f, 0x00, 0x01, 0xa7, 0x40, 0x06, 0x0f, 0x00, 0x01, 0xb0, 0x40, 0x06, 0x0f, 0x00,
+    0x01, 0xdd, 0x40, 0x06, 0x0f, 0x00, 0x01, 0xe6, 0x40, 0x06, 0x0f, 0x00, 0x01, 0xef, 0x40, 0x06,
+    0x0f, 0x00, 0x01, 0xf8, 0x40, 0x06, 0x0f, 0x00, 0x01, 0xe9, 0x40, 0x06, 0x0f, 0x00, 0x01, 0xf2,
+    0x40, 0x06, 0x0f, 0x00, 0x01, 0xfb, 0x40, 0x06, 0x0f, 0x00, 0x01, 0x04, 0x41, 0x06, 0x0f, 0x00,
+    0x01, 0x31, 0x41, 0x06, 0x0f, 0x00, 0x01, 0x3a, 0x41, 0x06, 0x0f, 0x00, 0x01, 0x8d, 0x0f, 0x06,
+    0x0f, 0x00, 0x01, 0x96, 0x0f, 0x06, 0x0f, 0x00, 0x01, 0x45, 0x67, 0x06, 0x0f, 0x00, 0x1a, 0xdc,
+    0x0f, 0x00, 0x0a, 0x7e, 0xa2, 0x2a, 0x81, 0xde, 0x0f, 0x00, 0x01, 0x42, 0x67, 0x06, 0x0f, 0x00,
+    0x1a, 0xea, 0x0f, 0x00, 0x01, 0x69, 0x67, 0x06, 0x0f, 0x00, 0x1a, 0xe8, 0x0f, 0x00, 0x0a, 0x08,
+    0xa3, 0x14, 0x81, 0x14, 0x68, 0x03, 0x0f, 0x00, 0x01, 0x1a, 0x68, 0x06, 0x0f, 0x00, 0x1a, 0xce,
+    0x0f, 0x00, 0x01, 0x02, 0x68, 0x06, 0x0f, 0x00, 0x1a, 0xda, 0x0f, 0x00, 0x01, 0x29, 0x68, 0x06,
+    0x0f, 0x00, 0x1a, 0xd8, 0x0f, 0x00, 0x02, 0x74, 0x1a, 0x05, 0x0f, 0x00, 0x07, 0x3e, 0xa3, 0x00,
+    0x0f, 0x00, 0x1a, 0xab, 0x2d, 0x00, 0x04, 0x73, 0x69, 0x02, 0x01, 0x00, 0x11, 0x06, 0xfd, 0x14,
+    0x06, 0x0f, 0x00, 0x0a, 0x63, 0x97, 0x17, 0x06, 0xe1, 0xa5, 0x05, 0x9c, 0x91, 0x03, 0x0f, 0x00,
+    0x04, 0xa2, 0x91, 0x03, 0x0f, 0x00, 0x1a, 0x8a, 0x0f, 0x00, 0x01, 0xf1, 0x60, 0x06, 0x0f, 0x00,
+    0x04, 0xfa, 0x60, 0x03, 0x0f, 0x00, 0x04, 0x00, 0x61, 0x03, 0x0f, 0x00, 0x04, 0x83, 0x95, 0x03,
+    0x0f, 0x00, 0x1a, 0x97, 0x0f, 0x00, 0x04, 0x09, 0x61, 0x03, 0x0f, 0x00, 0x07, 0x0f, 0x61, 0x00,
+    0x0f, 0x00, 0x04, 0x12, 0x61, 0x03, 0x0f, 0x00, 0x04, 0xd7, 0x95, 0x06, 0x12, 0x00, 0x01, 0x16,
+    0xbc, 0x06, 0x0f, 0x00, 0x01, 0x1f, 0xbc, 0x08, 0x01, 0x00, 0x14, 0x09, 0x4a, 0x99, 0x00, 0x1e,
+    0x00, 0x02, 0x16, 0xcb, 0x05, 0x0f, 0x00, 0x01, 0x82, 0x14, 0x06, 0x0f, 0x00, 0x31, 0x48, 0x00,
+    0x81, 0x71, 0x0a, 0x03, 0x0f, 0x00, 0x01, 0x41, 0x92, 0x06, 0x0f, 0x00, 0x01, 0xa9, 0x14, 0x06,
+    0x0f, 0x00, 0x13, 0x4d, 0x3f, 0x15, 0x03, 0x0f, 0x00, 0x07, 0xcf, 0x99, 0x00, 0x0f, 0x00, 0x13,
+    0x41, 0x0f, 0x15, 0x03, 0x0f, 0x00, 0x04, 0xe4, 0xa2, 0x03, 0x0f, 0x00, 0x13, 0x45, 0x75, 0x15,
+    0x09, 0x15, 0x00, 0x04, 0x77, 0x5f, 0x03, 0x0f, 0x00, 0x04, 0x74, 0x5f, 0x03, 0x0f, 0x00, 0x04,
+    0x7a, 0x5f, 0x03, 0x0f, 0x00, 0x04, 0x80, 0x5f, 0x11, 0x10, 0x23, 0x31, 0x05, 0x01, 0x00, 0x35,
+    0x10, 0x0f, 0x00, 0x3a, 0x9a, 0x77, 0x10, 0x11, 0x00, 0x10, 0x12, 0x00, 0x10, 0x76, 0xaa, 0x30,
+    0x06, 0x34, 0x00, 0x53, 0x34, 0x01, 0x78, 0xc0, 0x12, 0x10, 0x60, 0xc9, 0x0a, 0x01, 0x00, 0x11,
+    0x81, 0xab, 0xc0, 0x06, 0x0f, 0x00, 0x01, 0x35, 0x58, 0x00, 0x2d, 0x00, 0x91, 0x15, 0x00, 0x10,
+    0x16, 0x00, 0x10, 0x17, 0x00, 0x10, 0x6c, 0x15, 0x00, 0x76, 0x0b, 0x01, 0x99, 0x64, 0x05, 0x01,
+    0x00, 0x2a, 0x8b, 0x29, 0x0f, 0x00, 0x01, 0xc0, 0x64, 0x06, 0x0f, 0x00, 0x1a, 0x27, 0x0f, 0x00,
+    0x01, 0xc3, 0x64, 0x06, 0x0f, 0x00, 0x1a, 0x2d, 0x0f, 0x00, 0x01, 0xea, 0x64, 0x06, 0x0f, 0x00,
+    0x1a, 0x2b, 0x0f, 0x00, 0x01, 0xd8, 0x18, 0x06, 0x0f, 0x00, 0x01, 0xce, 0x2e, 0x06, 0x0f, 0x00,
+    0x04, 0x0b, 0x19, 0x03, 0x0f, 0x00, 0x01, 0x11, 0x19, 0x06, 0x0f, 0x00, 0x04, 0x29, 0x6e, 0x03,
+    0x0f, 0x00, 0x01, 0x2f, 0x6e, 0x03, 0x0c, 0x00, 0x31, 0x50, 0x04, 0x8b, 0x39, 0x15, 0x03, 0x0f,
+    0x00, 0x31, 0x51, 0x04, 0x8b, 0x4e, 0x15, 0x06, 0x12, 0x00, 0x04, 0x63, 0x6d, 0x03, 0x0f, 0x00,
+    0x04, 0x69, 0x6d, 0x03, 0x0f, 0x00, 0x01, 0x07, 0x99, 0x06, 0x0f, 0x00, 0x01, 0x1f, 0x99, 0x05,
+    0x01, 0x00, 0x1a, 0x10, 0xd2, 0xab, 0x11, 0x10, 0xb6, 0x16, 0x06, 0x2d, 0x00, 0x01, 0xf5, 0xc1,
+    0x06, 0x0f, 0x00, 0x01, 0xfe, 0xc1, 0x06, 0x0f, 0x00, 0x01, 0xee, 0x6c, 0x06, 0x0f, 0x00, 0x1a,
+    0xba, 0x0f, 0x00, 0x01, 0x3c, 0x9a, 0x06, 0x0f, 0x00, 0x01, 0x42, 0x9a, 0x06, 0x69, 0x00, 0x04,
+    0x9b, 0x1c, 0x03, 0x0f, 0x00, 0x01, 0xa8, 0x18, 0x06, 0x2d, 0x00, 0x1a, 0x6d, 0x69, 0x00, 0x01,
+    0xbe, 0xc2, 0x06, 0x0f, 0x00, 0x01, 0xd3, 0xc2, 0x06, 0x0f, 0x00, 0x01, 0xb0, 0x1c, 0x06, 0x0f,
+    0x00, 0x01, 0xb3, 0x22, 0x06, 0x0f, 0x00, 0x01, 0xbc, 0x22, 0x06, 0x0f, 0x00, 0x0a, 0xf6, 0xa8,
+    0x11, 0x8b, 0x8e, 0x6f, 0x05, 0x01, 0x00, 0x00, 0xec, 0xcc, 0x08, 0x0f, 0x00, 0x04, 0x24, 0x1e,
+    0x03, 0x0f, 0x00, 0x01, 0x5f, 0x19, 0x06, 0x0f, 0x00, 0x04, 0x97, 0x9c, 0x03, 0x4b, 0x00, 0x01,
+    0xd1, 0x9e, 0x06, 0x0f, 0x00, 0x1a, 0x92, 0x0f, 0x00, 0x1a, 0x8f, 0x0f, 0x00, 0x01, 0x04, 0x9f,
+    0x04, 0x0c, 0x00, 0x0a, 0x46, 0x02, 0x04, 0x86, 0x65, 0x06, 0x12, 0x00, 0x01, 0x69, 0xc0, 0x06,
+    0x0f, 0x00, 0x01, 0x72, 0xc0, 0x06, 0x0f, 0x00, 0x01, 0x93, 0xc0, 0x06, 0x0f, 0x00, 0x01, 0x9c,
+    0xc0, 0x06, 0x0f, 0x00, 0x01, 0x23, 0x19, 0x06, 0x0f, 0x00, 0x02, 0xe9, 0xca, 0x07, 0x01, 0x00,
+    0x14, 0x09, 0x2b, 0x9d, 0x00, 0x1c, 0x17, 0x01, 0x2c, 0x25, 0x03, 0x0f, 0x00, 0x20, 0xd1, 0x06,
+    0xd5, 0x9a, 0x10, 0xd5, 0xcf, 0x9a, 0x00, 0x0f, 0x00, 0x11, 0xd2, 0xe1, 0x9a, 0x10, 0xd6, 0xdb,
+    0x9a, 0x00, 0x0f, 0x00, 0x01, 0xe1, 0x67, 0x24, 0x81, 0x31, 0xbc, 0x37, 0x11, 0x30, 0x0f, 0x00,
+    0x01, 0xed, 0x67, 0x01, 0xc9, 0x06, 0x01, 0x14, 0x16, 0x01, 0x49, 0x69, 0x01, 0xc9, 0x06, 0x01,
+    0x0f, 0x00, 0x00, 0x19, 0xef, 0x01, 0x0f, 0x00, 0x10, 0x6c, 0xd2, 0x18, 0x06, 0x69, 0x00, 0x13,
+    0x6d, 0x00, 0x8e, 0x03, 0x0f, 0x00, 0x10, 0x68, 0xcf, 0x18, 0x06, 0x0f, 0x00, 0x13, 0x69, 0x08,
+    0x19, 0x03, 0x0f, 0x00, 0x22, 0x02, 0x04, 0xc3, 0x15, 0x03, 0x0f, 0x00, 0x10, 0x03, 0xe9, 0x7a,
+    0x06, 0x0f, 0x00, 0x47, 0x85, 0x07, 0x81, 0x83, 0xe5, 0x0b, 0x10, 0x86, 0xd8, 0x91, 0x06, 0x0f,
+    0x00, 0x11, 0x32, 0xaf, 0x81, 0x10, 0x36, 0xeb, 0x17, 0x00, 0x0f, 0x00, 0x11, 0x33, 0xbb, 0x81,
+    0x10, 0x37, 0xf4, 0x17, 0x00, 0x0f, 0x00, 0x11, 0xa8, 0xf2, 0x40, 0x10, 0xac, 0x72, 0x45, 0x00,
+    0x0f, 0x00, 0x11, 0xa9, 0xa1, 0xbe, 0x13, 0xad, 0xbc, 0xb8, 0x00, 0xa7, 0x98, 0x40, 0x26, 0x01,
+    0x81, 0x40, 0x4e, 0x7c, 0x01, 0xff, 0x00, 0x01, 0x36, 0x7c, 0x10, 0x41, 0x68, 0x46, 0x01, 0xe8,
+    0x05, 0x01, 0x9d, 0x38, 0x01, 0x12, 0xc6, 0x01, 0xe8, 0x05, 0x01, 0xaf, 0x38, 0x01, 0x1b, 0xc6,
+    0x00, 0x0f, 0x00, 0x20, 0x00, 0x07, 0xe4, 0x97, 0x10, 0x04, 0xde, 0x97, 0x00, 0x0f, 0x00, 0x20,
+    0x01, 0x07, 0xf0, 0x97, 0x41, 0x05, 0x07, 0x81, 0x03, 0x0f, 0x00, 0x11, 0xfe, 0xce, 0x77, 0x23,
+    0x02, 0x03, 0x91, 0x17, 0x11, 0xff, 0xda, 0x77, 0x31, 0x03, 0x03, 0x81, 0x22, 0x29, 0x00, 0xa7,
+    0x3a, 0x11, 0x63, 0x6c, 0x0f, 0x01, 0xdf, 0xc5, 0x00, 0xb0, 0x3a, 0x11, 0x64, 0x78, 0x0f, 0x11,
+    0x68, 0x0f, 0x00, 0x20, 0xf4, 0x02, 0xa3, 0xb3, 0x10, 0xf8, 0x26, 0xb5, 0x00, 0x0f, 0x00, 0x11,
+    0xf5, 0xaf, 0xb3, 0x14, 0xf9, 0x32, 0xb5, 0x10, 0xba, 0xc7, 0x44, 0x06, 0xff, 0x00, 0x10, 0xbb,
+    0xd0, 0x44, 0x06, 0x0f, 0x00, 0x10, 0xc4, 0xdc, 0x17, 0x06, 0x0f, 0x00, 0x10, 0xc5, 0xdf, 0x17,
+    0x06, 0x0f, 0x00, 0x31, 0xbe, 0x05, 0x81, 0xce, 0x6b, 0x03, 0x0f, 0x00, 0x10, 0xbf, 0x06, 0x18,
+    0x06, 0x0f, 0x00, 0x01, 0xec, 0x46, 0x06, 0x0f, 0x00, 0x10, 0x27, 0xec, 0x46, 0x06, 0x0f, 0x00,
+    0x32, 0x81, 0x04, 0x81, 0x97, 0xa0, 0x02, 0x0f, 0x00, 0x31, 0x82, 0x04, 0x81, 0xfe, 0x13, 0x03,
+    0x0f, 0x00, 0x10, 0x8b, 0x1b, 0x85, 0x06, 0x0f, 0x00, 0x10, 0x8c, 0x1e, 0x85, 0x06, 0x0f, 0x00,
+    0x10, 0x85, 0x00, 0x7c, 0x06, 0x0f, 0x00, 0x10, 0x86, 0x0c, 0x7c, 0x06, 0x0f, 0x00, 0x10, 0x2c,
+    0x8b, 0x41, 0x06, 0x0f, 0x00, 0x01, 0x9d, 0x41, 0x06, 0x0f, 0x00, 0x47, 0xac, 0x05, 0x81, 0xae,
+    0xa5, 0x00, 0x10, 0xad, 0x1e, 0x45, 0x06, 0x0f, 0x00, 0x31, 0xb6, 0x05, 0x81, 0xb9, 0x46, 0x03,
+    0x0f, 0x00, 0x31, 0xb7, 0x05, 0x81, 0xc2, 0x46, 0x03, 0x0f, 0x00, 0x31, 0xb0, 0x05, 0x81, 0x07,
+    0x47, 0x03, 0x0f, 0x00, 0x31, 0xb1, 0x05, 0x81, 0x10, 0x47, 0x03, 0x0f, 0x00, 0x34, 0x22, 0x04,
+    0x81, 0x97, 0x75, 0x00, 0x0f, 0x00, 0x34, 0x23, 0x04, 0x81, 0x9d, 0x75, 0x03, 0x12, 0x00, 0x01,
+    0xf1, 0x6c, 0x06, 0x0f, 0x00, 0x1a, 0xc3, 0x0f, 0x00, 0x1a, 0xb4, 0x0f, 0x00, 0x04, 0x66, 0x6d,
+    0x00, 0xf6, 0x06, 0x31, 0x35, 0x00, 0x06, 0x6d, 0x1a, 0x03, 0x0f, 0x00, 0x32, 0x37, 0x00, 0x06,
+    0x5a, 0xd2, 0x02, 0x2a, 0x00, 0x10, 0x69, 0x62, 0x4c, 0x11, 0x81, 0xa2, 0xbd, 0x00, 0x0f, 0x00,
+    0x43, 0x6a, 0x03, 0x81, 0x49, 0x98, 0x4c, 0x00, 0xcc, 0x03, 0x91, 0x47, 0x05, 0x8b, 0x41, 0x05,
+    0x8b, 0x43, 0x05, 0x8b, 0xb8, 0x6f, 0xa1, 0x8b, 0x48, 0x05, 0x8b, 0x42, 0x05, 0x8b, 0x44, 0x05,
+    0x8b, 0xc1, 0x6f, 0x47, 0x09, 0x12, 0x00, 0x09, 0x5f, 0x07, 0x41, 0x09, 0x14, 0x00, 0x09, 0x43,
+    0x23, 0x03, 0x0f, 0x00, 0x32, 0x16, 0x00, 0x09, 0x0d, 0xe3, 0x02, 0x5a, 0x00, 0x10, 0x6b, 0x91,
+    0x87, 0x06, 0x0f, 0x00, 0x31, 0x6c, 0x04, 0x81, 0x8c, 0x4f, 0x03, 0x0f, 0x00, 0x10, 0x75, 0xcd,
+    0x87, 0x06, 0x0f, 0x00, 0x10, 0x76, 0xd9, 0x87, 0x06, 0x0f, 0x00, 0x10, 0x6f, 0x22, 0x7e, 0x06,
+    0x0f, 0x00, 0x10, 0x70, 0x2e, 0x7e, 0x05, 0x0f, 0x00, 0x11, 0x80, 0x49, 0x23, 0x05, 0x01, 0x00,
+    0x41, 0x06, 0x39, 0x00, 0x09, 0xa7, 0x07, 0x11, 0x93, 0x48, 0xa0, 0x11, 0x06, 0xe1, 0x1e, 0x06,
+    0x1e, 0x00, 0x10, 0x3b, 0x8b, 0x9c, 0x00, 0x45, 0x00, 0x01, 0x5d, 0xa0, 0x11, 0x06, 0x2f, 0x1f,
+    0x08, 0x01, 0x00, 0x11, 0x81, 0x5b, 0xc5, 0x11, 0x81, 0x9e, 0x31, 0x01, 0x89, 0x01, 0x01, 0x0f,
+    0x00, 0x01, 0x6a, 0xc5, 0x00, 0x09, 0x00, 0x01, 0x61, 0xc5, 0x24, 0x81, 0x2a, 0x0f, 0x00, 0x11,
+    0x29, 0x0f, 0x00, 0x01, 0x70, 0xc5, 0x50, 0x06, 0x3d, 0x00, 0x06, 0x3e, 0x64, 0x3e, 0x03, 0x69,
+    0x00, 0x61, 0x3f, 0x00, 0x06, 0x40, 0x00, 0x81, 0x0b, 0xbe, 0x00, 0x24, 0x00, 0x20, 0x71, 0x03,
+    0xcd, 0x4d, 0x01, 0xfe, 0xbe, 0x00, 0x0f, 0x00, 0x52, 0x72, 0x03, 0x81, 0x4b, 0x03, 0xaf, 0x4a,
+    0x05, 0x01, 0x00, 0x1a, 0x09, 0x29, 0x07, 0x14, 0x09, 0xc0, 0x06, 0xa1, 0x09, 0x1c, 0x00, 0x09,
+    0x1d, 0x00, 0x09, 0x1e, 0x00, 0x09, 0x1e, 0x06, 0x7a, 0x09, 0x20, 0x00, 0x09, 0x21, 0x00, 0x09,
+    0x66, 0x68, 0x14, 0x81, 0xe4, 0x4b, 0x04, 0xa8, 0x00, 0x01, 0x10, 0x05, 0x13, 0x96, 0x55, 0x17,
+    0x02, 0x59, 0x00, 0x00, 0x64, 0x17, 0x01, 0x29, 0x22, 0x02, 0xeb, 0x68, 0x00, 0x05, 0x1f, 0x01,
+    0x32, 0x22, 0x02, 0xd5, 0x08, 0x00, 0xd8, 0x12, 0x01, 0x78, 0x36, 0x04, 0x24, 0x69, 0x30, 0x00,
+    0x8b, 0xfb, 0x4d, 0x16, 0x00, 0xea, 0x48, 0x01, 0x11, 0x1c, 0x20, 0x8b, 0xfc, 0x50, 0x16, 0x00,
+    0xfc, 0x48, 0x01, 0x14, 0x1c, 0x04, 0xd2, 0x69, 0x04, 0x2d, 0x00, 0x10, 0xbf, 0x0d, 0x17, 0x06,
+    0x0f, 0x00, 0x47, 0xc0, 0x04, 0x8b, 0xc2, 0x0f, 0x00, 0x31, 0x9b, 0x04, 0x8b, 0x3e, 0xa1, 0x03,
+    0x0f, 0x00, 0x33, 0xc6, 0x06, 0x8b, 0x42, 0xd5, 0x01, 0x0f, 0x00, 0x31, 0xc7, 0x06, 0x8b, 0x11,
+    0x6b, 0x08, 0x01, 0x00, 0x11, 0x09, 0xde, 0x24, 0xa4, 0x09, 0x27, 0x00, 0x09, 0x28, 0x00, 0x09,
+    0x29, 0x00, 0x09, 0x43, 0x26, 0x00, 0xab, 0x00, 0x02, 0x45, 0x24, 0x04, 0xda, 0x01, 0x12, 0x81,
+    0xa6, 0x20, 0x01, 0xc4, 0x20, 0x00, 0xef, 0x46, 0x01, 0x55, 0x4a, 0x03, 0x1b, 0x00, 0x10, 0x85,
+    0x0a, 0x81, 0x06, 0x0f, 0x00, 0x10, 0x77, 0x8a, 0x8b, 0x06, 0x0f, 0x00, 0x10, 0x78, 0x96, 0x8b,
+    0x06, 0x0f, 0x00, 0x01, 0x22, 0x47, 0x06, 0x0f, 0x00, 0x01, 0x2b, 0x47, 0x07, 0x75, 0x00, 0x00,
+    0x0e, 0x89, 0x06, 0x0f, 0x00, 0x22, 0x39, 0x04, 0x64, 0x14, 0x03, 0x0f, 0x00, 0x10, 0x15, 0xb9,
+    0x46, 0x06, 0x0f, 0x00, 0x01, 0xcb, 0x46, 0x05, 0x0f, 0x00, 0x00, 0x12, 0x00, 0x02, 0x43, 0x4d,
+    0x01, 0x29, 0xc1, 0x00, 0x0f, 0x00, 0x01, 0x18, 0xc0, 0x03, 0x0c, 0x00, 0x10, 0xeb, 0xa5, 0x45,
+    0x06, 0x0f, 0x00, 0x31, 0x9c, 0x05, 0x81, 0xd3, 0x44, 0x03, 0x0f, 0x00, 0x10, 0x9d, 0xcf, 0x48,
+    0x06, 0x0f, 0x00, 0x31, 0xa0, 0x05, 0x81, 0xd9, 0x44, 0x03, 0x0f, 0x00, 0x31, 0xa1, 0x05, 0x81,
+    0x4b, 0x4b, 0x03, 0x0f, 0x00, 0x10, 0xe3, 0x14, 0x49, 0x06, 0x0f, 0x00, 0x01, 0x26, 0x49, 0x06,
+    0x0f, 0x00, 0x10, 0x54, 0x3b, 0x8c, 0x06, 0x0f, 0x00, 0x10, 0x55, 0x47, 0x8c, 0x06, 0x0f, 0x00,
+    0x10, 0x44, 0xfe, 0x89, 0x06, 0x0f, 0x00, 0x10, 0x45, 0x0a, 0x8a, 0x06, 0x0f, 0x00, 0x10, 0x48,
+    0x2b, 0xc5, 0x06, 0x0f, 0x00, 0x22, 0x49, 0x04, 0x67, 0x1d, 0x03, 0x0f, 0x00, 0x10, 0xd3, 0xaa,
+    0x1c, 0x06, 0x0f, 0x00, 0x13, 0xd4, 0xe5, 0xc5, 0x03, 0x0f, 0x00, 0x22, 0x58, 0x04, 0x5e, 0x1d,
+    0x03, 0x0f, 0x00, 0x10, 0x59, 0x60, 0x82, 0x06, 0x0f, 0x00, 0x10, 0x5d, 0x63, 0x82, 0x06, 0x0f,
+    0x00, 0x22, 0x5e, 0x04, 0x6d, 0x1d, 0x03, 0x0f, 0x00, 0x25, 0x71, 0x05, 0xad, 0x89, 0x01, 0x39,
+    0x03, 0x15, 0x05, 0xc5, 0x89, 0x01, 0x56, 0x04, 0x00, 0x47, 0x49, 0x06, 0x0f, 0x00, 0x25, 0x6c,
+    0x05, 0x3d, 0x8a, 0x00, 0x0f, 0x00, 0x10, 0x61, 0x40, 0x8d, 0x06, 0x0f, 0x00, 0x10, 0x62, 0x43,
+    0x8d, 0x06, 0x0f, 0x00, 0x22, 0x0b, 0x05, 0x54, 0x4b, 0x03, 0x0f, 0x00, 0x10, 0x0c, 0x75, 0x48,
+    0x06, 0x0f, 0x00, 0x01, 0x7b, 0x48, 0x06, 0x0f, 0x00, 0x13, 0x10, 0x6b, 0xc7, 0x06, 0x12, 0x00,
+    0x11, 0x46, 0x40, 0x50, 0x01, 0xd8, 0x1b, 0x00, 0x0f, 0x00, 0x11, 0x47, 0xa1, 0x83, 0x02, 0x41,
+    0x16, 0x10, 0x62, 0x01, 0x20, 0x06, 0x2a, 0x00, 0x10, 0x94, 0xb7, 0x1e, 0x06, 0x0f, 0x00, 0x10,
+    0x95, 0xba, 0x1e, 0x06, 0x0f, 0x00, 0x10, 0x98, 0xd2, 0x1e, 0x06, 0x0f, 0x00, 0x10, 0x99, 0xd5,
+    0x1e, 0x06, 0x0f, 0x00, 0x10, 0xdf, 0xd3, 0x47, 0x06, 0x0f, 0x00, 0x01, 0xe5, 0x47, 0x06, 0x0f,
+    0x00, 0x10, 0x2c, 0x8d, 0x48, 0x06, 0x0f, 0x00, 0x10, 0x2d, 0x96, 0x48, 0x06, 0x0f, 0x00, 0x10,
+    0x3c, 0xc9, 0x82, 0x06, 0x0f, 0x00, 0x10, 0x3d, 0xd5, 0x82, 0x06, 0x0f, 0x00, 0x22, 0x40, 0x04,
+    0xeb, 0x17, 0x03, 0x0f, 0x00, 0x22, 0x41, 0x04, 0x00, 0x18, 0x03, 0x0f, 0x00, 0x10, 0xcf, 0x15,
+    0x4b, 0x06, 0x0f, 0x00, 0x01, 0x27, 0x4b, 0x06, 0x0f, 0x00, 0x10, 0xd9, 0xc3, 0x4b, 0x06, 0x0f,
+    0x00, 0x01, 0xd5, 0x4b, 0x05, 0x0f, 0x00, 0x06, 0x18, 0x00, 0x01, 0xc1, 0xbf, 0x41, 0x81, 0x64,
+    0x05, 0x81, 0x5e, 0x75, 0x03, 0x15, 0x00, 0x10, 0x65, 0x63, 0x4b, 0x06, 0x0f, 0x00, 0x01, 0x87,
+    0x4b, 0x06, 0x0f, 0x00, 0x31, 0x58, 0x05, 0x81, 0xc1, 0x75, 0x03, 0x0f, 0x00, 0x22, 0x5e, 0x05,
+    0xe3, 0x52, 0x03, 0x0f, 0x00, 0x22, 0x5f, 0x05, 0xe6, 0x52, 0x03, 0x0f, 0x00, 0x10, 0x19, 0xf2,
+    0x49, 0x06, 0x0f, 0x00, 0x01, 0x04, 0x4a, 0x06, 0x0f, 0x00, 0x10, 0xc7, 0xb5, 0x8d, 0x07, 0x8d,
+    0x00, 0x00, 0xc1, 0x8d, 0x06, 0x0f, 0x00, 0x10, 0x39, 0x92, 0x49, 0x06, 0x0f, 0x00, 0x01, 0xa4,
+    0x49, 0x06, 0x0f, 0x00, 0x10, 0xf1, 0xe1, 0xa3, 0x06, 0x0f, 0x00, 0x01, 0x4a, 0x4c, 0x06, 0x0f,
+    0x00, 0x01, 0x53, 0x4c, 0x06, 0x0f, 0x00, 0x01, 0x1c, 0x4d, 0x06, 0x0f, 0x00, 0x01, 0x25, 0x4d,
+    0x06, 0x0f, 0x00, 0x10, 0x8c, 0x29, 0x95, 0x06, 0x0f, 0x00, 0x10, 0x8d, 0x35, 0x95, 0x06, 0x0f,
+    0x00, 0x01, 0x98, 0x4c, 0x06, 0x0f, 0x00, 0x01, 0xa1, 0x4c, 0x06, 0x0f, 0x00, 0x10, 0x30, 0xe9,
+    0x4f, 0x06, 0x0f, 0x00, 0x01, 0xfb, 0x4f, 0x06, 0x0f, 0x00, 0x13, 0x4c, 0xe5, 0xc2, 0x03, 0x0f,
+    0x00, 0x10, 0x4d, 0xd6, 0xc8, 0x06, 0x0f, 0x00, 0x10, 0x34, 0xd3, 0x8d, 0x06, 0x0f, 0x00, 0x10,
+    0x35, 0xdf, 0x8d, 0x02, 0x0c, 0x00, 0x23, 0x80, 0x47, 0xdb, 0x00, 0x65, 0x80, 0x48, 0x02, 0x80,
+    0x49, 0x02, 0x05, 0x03, 0x74, 0x0d, 0x06, 0x00, 0x0d, 0x07, 0x00, 0x80, 0xf7, 0x7e, 0x74, 0x80,
+    0x0b, 0x04, 0x80, 0x0c, 0x04, 0x0d, 0xc0, 0x18, 0x56, 0x0d, 0x09, 0x00, 0x0d, 0x0a, 0xf7, 0xa8,
+    0x11, 0x80, 0x2a, 0x21, 0x11, 0x80, 0xda, 0xc4, 0x00, 0x09, 0x00, 0x64, 0x77, 0x03, 0x80, 0x78,
+    0x03, 0x0d, 0x1f, 0x00, 0x74, 0x0d, 0x12, 0x00, 0x0d, 0x13, 0x00, 0x80, 0xc7, 0x72, 0x74, 0x80,
+    0xfe, 0x00, 0x80, 0xff, 0x00, 0x0d, 0x75, 0x0f, 0x74, 0x0d, 0x15, 0x00, 0x0d, 0x16, 0x00, 0x80,
+    0xe6, 0x86, 0x74, 0x80, 0xde, 0x06, 0x80, 0xdf, 0x06, 0x0d, 0x2e, 0x08, 0x71, 0x0d, 0x18, 0x00,
+    0x0d, 0x19, 0x00, 0x80, 0xf1, 0x1a, 0x00, 0x1e, 0x00, 0x64, 0xdb, 0x02, 0x80, 0xdc, 0x02, 0x0d,
+    0x37, 0x0e, 0x71, 0x0d, 0x1b, 0x00, 0x0d, 0x1c, 0x00, 0x80, 0xf2, 0x22, 0x00, 0x1e, 0x00, 0x64,
+    0x56, 0x06, 0x80, 0x57, 0x06, 0x0d, 0x56, 0x0d, 0x42, 0x0d, 0x1e, 0x00, 0x0d, 0x44, 0x0d, 0xa4,
+    0x08, 0x3b, 0x04, 0x04, 0x23, 0x00, 0x04, 0x24, 0x00, 0x04, 0x3f, 0xb8, 0x71, 0x04, 0x26, 0x00,
+    0x04, 0x27, 0x00, 0x04, 0x6c, 0x40, 0x44, 0x04, 0x29, 0x00, 0x04, 0x52, 0x06, 0xc2, 0x04, 0x2b,
+    0x00, 0x04, 0x2c, 0x00, 0x04, 0x2d, 0x00, 0x08, 0x43, 0x07, 0x33, 0x00, 0x05, 0x01, 0x00, 0x11,
+    0x04, 0x85, 0x06, 0x03, 0x0c, 0x00, 0x01, 0x57, 0x2b, 0x05, 0x33, 0x00, 0x0c, 0x01, 0x00, 0x11,
+    0x08, 0xc0, 0x68, 0x02, 0xe7, 0x13, 0x01, 0x6b, 0x75, 0x55, 0x00, 0x04, 0x07, 0x00, 0x04, 0xd6,
+    0xaa, 0x61, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x04, 0x47, 0x18, 0x43, 0x04, 0x0c, 0x00, 0x04, 0xf8,
+    0x8d, 0x81, 0x00, 0x04, 0x0e, 0x00, 0x04, 0x0f, 0x00, 0x04, 0xb5, 0x10, 0x44, 0x04, 0x11, 0x00,
+    0x04, 0x37, 0xbb, 0x44, 0x04, 0x13, 0x00, 0x04, 0x2e, 0x01, 0x41, 0x04, 0x15, 0x00, 0x04, 0xcf,
+    0x41, 0x00, 0x0c, 0x00, 0x61, 0x17, 0x00, 0x04, 0x18, 0x00, 0x04, 0xd1, 0x07, 0x71, 0x04, 0x1a,
+    0x00, 0x04, 0x1b, 0x00, 0x04, 0xd8, 0x0e, 0x00, 0x5e, 0xde, 0x05, 0x9d, 0x00, 0x01, 0x54, 0x0e,
+    0x16, 0x04, 0x4b, 0x0e, 0x11, 0x81, 0x85, 0xc9, 0x00, 0xb5, 0xa6, 0x34, 0xce, 0x03, 0x0c, 0x56,
+    0x00, 0x00, 0xe1, 0x4f, 0x05, 0x50, 0x90, 0x11, 0x4d, 0xef, 0x11, 0x11, 0x44, 0xbe, 0x0c, 0x11,
+    0x47, 0xb5, 0x0c, 0x11, 0x48, 0xcd, 0x0c, 0x12, 0x56, 0x01, 0x27, 0x5b, 0x80, 0xb6, 0x03, 0x80,
+    0x67, 0x45, 0xba, 0x03, 0x68, 0x6c, 0x02, 0xb7, 0x68, 0x02, 0x18, 0x84, 0x11, 0x3d, 0xd3, 0x43,
+    0x01, 0xc1, 0xbe, 0x50, 0x8b, 0x22, 0x00, 0x8b, 0x23, 0x4c, 0x28, 0x23, 0x8b, 0x38, 0x00, 0x29,
+    0x00, 0x6e, 0x45, 0x14, 0xc4, 0x10, 0x58, 0x02, 0x36, 0x4a, 0x10, 0x3a, 0xb5, 0x07, 0x03, 0x7f,
+    0xa7, 0x02, 0x7c, 0x89, 0x02, 0x80, 0x6c, 0x01, 0xbc, 0x6c, 0x51, 0x8b, 0x4c, 0x01, 0x8b, 0x4d,
+    0x0f, 0x8d, 0x50, 0x5c, 0x01, 0x8b, 0x55, 0x01, 0x27, 0x8d, 0xf4, 0x01, 0x4f, 0x01, 0x8b, 0x50,
+    0x01, 0x81, 0x08, 0x01, 0x81, 0x09, 0x01, 0x8b, 0x1f, 0x00, 0x8b, 0x20, 0x88, 0xa4, 0x20, 0xfa,
+    0x00, 0x49, 0xa7, 0x02, 0x13, 0xa1, 0x02, 0x07, 0xa1, 0x02, 0x91, 0x89, 0x11, 0x39, 0xb7, 0x44,
+    0x02, 0x58, 0xb3, 0x02, 0x7f, 0xa1, 0x02, 0x00, 0x8a, 0x02, 0xf9, 0x68, 0x02, 0x2a, 0x1d, 0x01,
+    0xa3, 0x19, 0x03, 0xa0, 0x89, 0x20, 0x2a, 0x01, 0x2d, 0x1a, 0x02, 0x61, 0x89, 0x10, 0x24, 0xeb,
+    0x19, 0x03, 0xe2, 0x89, 0x02, 0x88, 0x28, 0x02, 0x4f, 0x28, 0x02, 0x4b, 0x8a, 0x11, 0x58, 0x5d,
+    0x1d, 0x02, 0x75, 0x1d, 0x02, 0xb4, 0x44, 0x02, 0x3c, 0x26, 0x02, 0x8b, 0x28, 0x02, 0x86, 0x94,
+    0x02, 0x9e, 0x94, 0x02, 0x6c, 0x1d, 0x02, 0xbe, 0x28, 0x02, 0x93, 0xa5, 0x02, 0xa2, 0xa5, 0x02,
+    0x9a, 0x6d, 0x02, 0x7a, 0x69, 0x02, 0xdf, 0x1c, 0x20, 0x6a, 0x01, 0x27, 0x47, 0x20, 0xfd, 0x00,
+    0x03, 0xa8, 0x44, 0x00, 0x01, 0x81, 0x01, 0xb4, 0x1d, 0x02, 0xf3, 0xa8, 0x02, 0xfa, 0xa1, 0x11,
+    0x94, 0x87, 0x23, 0x11, 0x91, 0x93, 0x23, 0x02, 0x48, 0x47, 0x02, 0x2a, 0x1d, 0x02, 0xf3, 0x6b,
+    0x20, 0x82, 0x01, 0x55, 0xa7, 0x02, 0xe9, 0xa6, 0x02, 0xf8, 0xa6, 0x02, 0xae, 0x26, 0x02, 0xfb,
+    0x27, 0x02, 0x71, 0x97, 0x02, 0x5c, 0x97, 0x02, 0xcd, 0x1c, 0x02, 0x02, 0x1e, 0x02, 0x6c, 0x29,
+    0x02, 0x35, 0x9d, 0x02, 0x8c, 0x97, 0x02, 0x95, 0x27, 0x02, 0x5c, 0xa6, 0x01, 0x3b, 0x9d, 0x03,
+    0x9b, 0x97, 0x02, 0x0f, 0x1d, 0x01, 0xc4, 0x46, 0x03, 0xba, 0x29, 0x11, 0x8b, 0xc9, 0x29, 0x02,
+    0x9c, 0x8a, 0x02, 0xec, 0x9d, 0x02, 0xe0, 0xa9, 0x02, 0x9a, 0x6a, 0x11, 0x70, 0x4d, 0x9d, 0x02,
+    0x26, 0x27, 0x02, 0xf3, 0x1d, 0x01, 0x0c, 0x47, 0x03, 0x90, 0x29, 0x02, 0xf6, 0x1d, 0x11, 0x43,
+    0x77, 0x02, 0x11, 0xc0, 0x30, 0x53, 0x02, 0x11, 0xa3, 0x20, 0x7f, 0x01, 0x2d, 0xa8, 0x02, 0x86,
+    0x27, 0x01, 0x71, 0xa6, 0x11, 0x8b, 0x55, 0x04, 0x62, 0x8b, 0x16, 0x01, 0x8b, 0x17, 0x01, 0xec,
+    0x48, 0x62, 0x8b, 0x05, 0x01, 0x8b, 0x06, 0x01, 0xf3, 0xc5, 0x02, 0x9d, 0xc4, 0xe0, 0x8b, 0x7c,
+    0x01, 0x8b, 0x7d, 0x01, 0x8b, 0x79, 0x01, 0x8b, 0x7a, 0x01, 0x8b, 0x34, 0xdd, 0x2a, 0x20, 0x8b,
+    0x31, 0xf5, 0x2a, 0x03, 0x8e, 0x4c, 0x11, 0x40, 0x93, 0x14, 0x02, 0x23, 0x91, 0x01, 0x9a, 0x4c,
+    0x20, 0x8b, 0x2e, 0x31, 0x2b, 0x00, 0x9d, 0x2b, 0x01, 0x8b, 0x28, 0x00, 0x04, 0x02, 0x11, 0x4a,
+    0xf6, 0xa5, 0x11, 0x41, 0x7b, 0x9f, 0x11, 0xda, 0xc3, 0x53, 0x91, 0xca, 0x06, 0x81, 0x5f, 0x02,
+    0x06, 0x03, 0x00, 0x81, 0xef, 0xaf, 0x00, 0x24, 0x00, 0x10, 0xc5, 0x2e, 0xd9, 0x02, 0x0c, 0x00,
+    0x30, 0x06, 0x04, 0x00, 0xe4, 0x9c, 0x11, 0x40, 0xb1, 0x9f, 0x71, 0x50, 0x07, 0x06, 0x05, 0x00,
+    0x81, 0x57, 0x2e, 0x74, 0x41, 0x06, 0x00, 0x06, 0x07, 0x85, 0x58, 0x16, 0xd7, 0xd3, 0x0a, 0x30,
+    0x06, 0x08, 0x00, 0x1b, 0xa2, 0x14, 0x94, 0x43, 0x86, 0x11, 0x3f, 0x2d, 0xa2, 0x61, 0x9a, 0x07,
+    0x06, 0x09, 0x00, 0x81, 0x03, 0x78, 0x09, 0x5a, 0x03, 0x43, 0xff, 0x05, 0x81, 0x58, 0x2a, 0x00,
+    0x31, 0x06, 0x0a, 0x00, 0xf9, 0x9e, 0x01, 0x18, 0x00, 0x49, 0x60, 0x02, 0x81, 0x21, 0x86, 0x03,
+    0xaf, 0x06, 0x0c, 0x00, 0x06, 0x0d, 0x00, 0x06, 0x0e, 0x00, 0x06, 0x35, 0xc0, 0x01, 0x12, 0x06,
+    0x70, 0x5b, 0x01, 0xcd, 0x77, 0x11, 0x81, 0xf0, 0x78, 0xa5, 0x06, 0x11, 0x00, 0x06, 0x12, 0x00,
+    0x06, 0x13, 0x00, 0x06, 0x06, 0x04, 0x01, 0xb0, 0x27, 0x03, 0x30, 0x00, 0x34, 0x15, 0x00, 0x06,
+    0x68, 0x04, 0x09, 0x48, 0x00, 0x01, 0x99, 0x05, 0x00, 0x93, 0xa2, 0x1f, 0x87, 0x49, 0xbe, 0x03,
+    0x0c, 0x30, 0x00, 0x20, 0x18, 0x00, 0x12, 0x53, 0x10, 0xdb, 0x83, 0x54, 0x60, 0x17, 0x03, 0x00,
+    0x17, 0x04, 0x00, 0x62, 0x54, 0x04, 0xc1, 0x95, 0x11, 0x8b, 0xaa, 0xd2, 0x0e, 0x01, 0x00, 0x11,
+    0x81, 0x74, 0x39, 0x0f, 0x18, 0x00, 0x00, 0x1f, 0x95, 0xbe, 0xbe, 0x04, 0x1f, 0x96, 0x18, 0x00,
+    0x04, 0x1f, 0x97, 0x18, 0x00, 0x04, 0x1f, 0x98, 0x18, 0x00, 0x04, 0x1f, 0x6c, 0x18, 0x00, 0x04,
+    0x1f, 0x69, 0x18, 0x00, 0x04, 0x1f, 0x6b, 0x18, 0x00, 0x04, 0x1f, 0x6a, 0x18, 0x00, 0x04, 0x1f,
+    0x6d, 0x35, 0x01, 0x0f, 0x11, 0x10, 0x38, 0xc6, 0x0f, 0x18, 0x00, 0x00, 0x01, 0x44, 0xc6, 0x0f,
+    0x18, 0x00, 0x00, 0x01, 0xec, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0xfe, 0xd5, 0x0f, 0x18, 0x00,
+    0x00, 0x01, 0xdd, 0x3f, 0x0f, 0x18, 0x00, 0x00, 0x01, 0xda, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01,
+    0xca, 0xca, 0x0f, 0x18, 0x00, 0x00, 0x1f, 0xd3, 0x18, 0x00, 0x04, 0x01, 0x38, 0xd5, 0x0f, 0x18,
+    0x00, 0x00, 0x01, 0x4a, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0x5c, 0xd5, 0x0f, 0x18, 0x00, 0x00,
+    0x01, 0x6e, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0x80, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0x92,
+    0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0xa4, 0xd5, 0x0f, 0x18, 0x00, 0x00, 0x01, 0xb6, 0xd5, 0x0f,
+    0x18, 0x00, 0x00, 0x04, 0xf7, 0x86, 0x0c, 0x18, 0x00, 0x07, 0x83, 0x12, 0x09, 0x18, 0x00, 0x04,
+    0xcd, 0x86, 0x0c, 0x18, 0x00, 0x07, 0xad, 0x09, 0x09, 0x18, 0x00, 0x01, 0x98, 0x2a, 0x0f, 0x18,
+    0x00, 0x00, 0x07, 0x52, 0x0d, 0x09, 0x18, 0x00, 0x07, 0x5b, 0x0d, 0x09, 0x18, 0x00, 0x01, 0xce,
+    0x2a, 0x0f, 0x18, 0x00, 0x00, 0x01, 0xe0, 0x2a, 0x0f, 0x18, 0x00, 0x00, 0x07, 0x1f, 0x0a, 0xf7,
+    0x07, 0x0f, 0xce, 0x04, 0x0f, 0xcf, 0x04, 0x0f, 0xd0, 0x04, 0x0f, 0xd1, 0x04, 0x0f, 0xd2, 0x04,
+    0x0f, 0xd3, 0x04, 0x0f, 0xd4, 0x04, 0x0f, 0xb5, 0x0d, 0x00, 0x24, 0x00, 0x01, 0x6f, 0x53, 0x0e,
+    0x01, 0x00, 0x11, 0x0f, 0xfe, 0x7f, 0x0f, 0x18, 0x00, 0x00, 0x07, 0xf7, 0x0a, 0x09, 0x18, 0x00,
+    0x07, 0x00, 0x0b, 0x09, 0x18, 0x00, 0x0a, 0x22, 0x1f, 0x06, 0x18, 0x00, 0x01, 0x9c, 0xba, 0x03,
+    0x0c, 0x00, 0x1c, 0x23, 0x10, 0x05, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x2a, 0x7e, 0x02, 0x01, 0x00,
+    0x2f, 0x8b, 0x5d, 0x60, 0x03, 0x03, 0x2f, 0x8f, 0x62, 0x90, 0x03, 0x04, 0x01, 0x5e, 0xcd, 0x0f,
+    0x18, 0x00, 0x00, 0x10, 0x8a, 0x41, 0x07, 0x03, 0x0c, 0x00, 0x10, 0x09, 0xfa, 0x28, 0x03, 0x0c,
+    0x00, 0x11, 0xd0, 0x7d, 0x2a, 0x11, 0xd4, 0x72, 0x29, 0x02, 0x6a, 0xcd, 0x01, 0xe0, 0xd8, 0x00,
+    0xcf, 0xae, 0x20, 0x19, 0x02, 0xe3, 0xcc, 0x20, 0xe9, 0x01, 0x40, 0x2b, 0x11, 0xeb, 0x59, 0x2a,
+    0x50, 0xbf, 0x01, 0x81, 0xea, 0x01, 0x49, 0x2b, 0x11, 0xf4, 0x25, 0x2b, 0x11, 0xed, 0x1c, 0x2b,
+    0x10, 0xf2, 0x7a, 0x2a, 0x00, 0x33, 0x00, 0x01, 0x22, 0xb3, 0x0c, 0x78, 0x00, 0x11, 0xad, 0x9b,
+    0x2a, 0x02, 0x06, 0xce, 0x01, 0xc2, 0xd8, 0x06, 0x1b, 0x00, 0x01, 0xab, 0xc8, 0x0c, 0x30, 0x00,
+    0x01, 0xc1, 0xb3, 0x0e, 0x01, 0x00, 0x00, 0x60, 0xb4, 0xd0, 0x01, 0x00, 0x08, 0x02, 0x00, 0x08,
+    0x03, 0x00, 0x85, 0x26, 0x00, 0x86, 0x27, 0x05, 0x80, 0xf1, 0x4c, 0x06, 0x01, 0x00, 0x08, 0x04,
+    0x00, 0x08, 0x05, 0x00, 0x08, 0x06, 0x00, 0x08, 0x07, 0x00, 0x85, 0xf6, 0x03, 0x86, 0xf7, 0x03,
+    0x06, 0x02, 0x00, 0x04, 0x01, 0x00, 0x08, 0x41, 0x01, 0x08, 0x42, 0x01, 0x08, 0x43, 0x01, 0x08,
+    0x44, 0x01, 0x85, 0x10, 0x00, 0x86, 0x11, 0x00, 0x06, 0x58, 0x00, 0x06, 0x59, 0x00, 0x08, 0x45,
+    0x01, 0x08, 0x46, 0x01, 0x08, 0x47, 0x01, 0x08, 0x48, 0x01, 0x85, 0x4b, 0x06, 0x86, 0x4c, 0x06,
+    0x06, 0x5a, 0x00, 0x06, 0x5b, 0x00, 0x08, 0x49, 0x01, 0x08, 0x4a, 0x01, 0x08, 0x4b, 0x01, 0x08,
+    0x4c, 0x01, 0x85, 0x5c, 0x00, 0x86, 0xf3, 0x32, 0xf1, 0x04, 0x06, 0x5c, 0x00, 0x08, 0x4d, 0x01,
+    0x08, 0x4e, 0x01, 0x08, 0x4f, 0x01, 0x08, 0x50, 0x01, 0x85, 0xf4, 0x06, 0x86, 0xc7, 0xb6, 0xf1,
+    0x05, 0x06, 0x5d, 0x00, 0x08, 0x51, 0x01, 0x08, 0x52, 0x01, 0x08, 0x53, 0x01, 0x08, 0x54, 0x01,
+    0x85, 0x79, 0x07, 0x86, 0x7a, 0x1d, 0x07, 0xf1, 0x03, 0x5e, 0x00, 0x08, 0x55, 0x01, 0x08, 0x56,
+    0x01, 0x08, 0x57, 0x01, 0x08, 0x58, 0x01, 0x85, 0xef, 0x00, 0x86, 0x5b, 0x34, 0xff, 0x27, 0x06,
+    0x5f, 0x00, 0x06, 0x60, 0x00, 0x06, 0x61, 0x00, 0x06, 0x62, 0x00, 0x06, 0x63, 0x00, 0x06, 0x64,
+    0x00, 0x06, 0x65, 0x00, 0x06, 0x66, 0x00, 0x06, 0x67, 0x00, 0x06, 0x68, 0x00, 0x06, 0x69, 0x00,
+    0x06, 0x6a, 0x00, 0x06, 0x6b, 0x00, 0x06, 0x6c, 0x00, 0x06, 0x6d, 0x00, 0x06, 0x6e, 0x00, 0x06,
+    0x6f, 0x00, 0x80, 0xcc, 0x05, 0x03, 0x00, 0x03, 0x1f, 0x20, 0x03, 0x00, 0x03, 0x50, 0x06, 0x70,
+    0x00, 0x06, 0x71, 0x01, 0x17, 0x11, 0x08, 0x69, 0x3b, 0x05, 0x01, 0x00, 0xf0, 0x65, 0x86, 0xcd,
+    0x05, 0x08, 0xdd, 0x03, 0x85, 0xce, 0x05, 0x08, 0xde, 0x03, 0x0c, 0xa5, 0x01, 0x0c, 0xa6, 0x01,
+    0x0c, 0xa7, 0x01, 0x0c, 0xa8, 0x01, 0x06, 0xae, 0x00, 0x06, 0xaf, 0x00, 0x06, 0xb0, 0x00, 0x06,
+    0xb1, 0x00, 0x06, 0xb2, 0x00, 0x06, 0xb3, 0x00, 0x06, 0xb4, 0x00, 0x06, 0xb5, 0x00, 0x06, 0xb6,
+    0x00, 0x06, 0xb7, 0x00, 0x06, 0xb8, 0x00, 0x06, 0xb9, 0x00, 0x06, 0xba, 0x00, 0x06, 0xbb, 0x00,
+    0x06, 0xbc, 0x00, 0x06, 0xbd, 0x00, 0x08, 0xdf, 0x03, 0x08, 0xe0, 0x03, 0x08, 0xe1, 0x03, 0x08,
+    0xe2, 0x03, 0x08, 0xe3, 0x03, 0x08, 0xe4, 0x03, 0x08, 0xe5, 0x03, 0x08, 0xe6, 0x03, 0x08, 0xe7,
+    0x03, 0x08, 0xe8, 0x03, 0x08, 0xe9, 0x03, 0x08, 0xea, 0x03, 0x08, 0xeb, 0x03, 0x08, 0xec, 0x03,
+    0x08, 0xed, 0x50, 0x13, 0x6e, 0x0c, 0xa9, 0x01, 0x80, 0x68, 0x07, 0x03, 0x00, 0xff, 0x3c, 0x0d,
+    0x0b, 0x00, 0x0d, 0x0c, 0x00, 0x06, 0xce, 0x00, 0x80, 0x0f, 0x02, 0x06, 0xcf, 0x00, 0x06, 0xd0,
+    0x00, 0x80, 0x34, 0x06, 0x80, 0xc5, 0x02, 0x82, 0x15, 0x03, 0x82, 0x16, 0x03, 0x82, 0x17, 0x03,
+    0x82, 0x18, 0x03, 0x0c, 0xaa, 0x01, 0x0c, 0xab, 0x01, 0x0c, 0xac, 0x01, 0x0c, 0xad, 0x01, 0x85,
+    0x16, 0x07, 0x86, 0x17, 0x07, 0x0c, 0xae, 0x01, 0x0c, 0xaf, 0x01, 0x0c, 0xb0, 0x01, 0x0c, 0xb1,
+    0x01, 0x0c, 0xb2, 0x01, 0x0c, 0xb3, 0x01, 0x85, 0x19, 0x03, 0x03, 0x00, 0x02, 0x2f, 0x87, 0x1a,
+    0x03, 0x00, 0x03, 0xb0, 0x08, 0x39, 0x04, 0x08, 0x3a, 0x04, 0x84, 0x08, 0x06, 0x80, 0x09, 0x6e,
+    0x05, 0xf1, 0x70, 0x02, 0x01, 0x00, 0x08, 0x44, 0x07, 0x08, 0x45, 0x07, 0x91, 0x7c, 0x01, 0x80,
+    0xcc, 0x02, 0x84, 0x0a, 0x06, 0x80, 0x0b, 0x06, 0x80, 0x59, 0x02, 0x83, 0x57, 0x02, 0x06, 0x20,
+    0x01, 0x0d, 0x20, 0x00, 0x08, 0x46, 0x07, 0x08, 0x47, 0x07, 0x08, 0x48, 0x07, 0x08, 0x49, 0x07,
+    0x06, 0x21, 0x01, 0x06, 0x22, 0x01, 0x06, 0x23, 0x01, 0x80, 0x70, 0x07, 0x08, 0x4a, 0x07, 0x08,
+    0x4b, 0x07, 0x08, 0x4c, 0x07, 0x08, 0x4d, 0x07, 0x08, 0x4e, 0x07, 0x08, 0x4f, 0x07, 0x08, 0x50,
+    0x07, 0x08, 0x51, 0x07, 0x88, 0xe8, 0x02, 0x88, 0xe7, 0x02, 0x88, 0xe6, 0x02, 0x06, 0x24, 0x01,
+    0x83, 0x3a, 0x02, 0x0d, 0x25, 0x00, 0x83, 0x04, 0x04, 0x0d, 0x26, 0x00, 0x06, 0x25, 0x01, 0x06,
+    0x26, 0x01, 0x06, 0x27, 0x01, 0x06, 0x28, 0x01, 0x80, 0x3d, 0x02, 0x0d, 0x27, 0x00, 0x80, 0x07,
+    0x04, 0x0d, 0xa5, 0x0d, 0x11, 0x80, 0xd4, 0xb5, 0x00, 0x09, 0x00, 0xf1, 0x1e, 0x26, 0x02, 0x80,
+    0xc6, 0x00, 0x08, 0x52, 0x07, 0x08, 0x53, 0x07, 0x80, 0xba, 0x00, 0x80, 0xd8, 0x06, 0x80, 0xc0,
+    0x00, 0x80, 0xdb, 0x06, 0x80, 0xbb, 0x00, 0x80, 0xd9, 0x06, 0x08, 0x54, 0x07, 0x08, 0x55, 0x07,
+    0x08, 0x08, 0x00, 0x08, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x08, 0x30, 0x09, 0xe0, 0x06, 0x1d, 0x00,
+    0x80, 0xc2, 0x00, 0x06, 0x1e, 0x00, 0x80, 0x5b, 0x02, 0x80, 0x52, 0x7c, 0x02, 0x21, 0x80, 0x2d,
+    0xf1, 0x7d, 0xf1, 0x33, 0x0c, 0x00, 0x80, 0xac, 0x01, 0x04, 0x02, 0x00, 0x08, 0x25, 0x00, 0x08,
+    0x26, 0x00, 0x08, 0x27, 0x00, 0x08, 0x28, 0x00, 0x08, 0x29, 0x00, 0x08, 0x2a, 0x00, 0x08, 0x2b,
+    0x00, 0x08, 0x2c, 0x00, 0x08, 0x2d, 0x00, 0x08, 0x2e, 0x00, 0x16, 0x00, 0x00, 0x16, 0x01, 0x00,
+    0x08, 0x33, 0x00, 0x08, 0x34, 0x00, 0x08, 0x35, 0x00, 0x08, 0x36, 0x00, 0x06, 0x2b, 0x00, 0x06,
+    0x2c, 0x00, 0x06, 0x2d, 0x00, 0x06, 0x1d, 0x33, 0x06, 0x78, 0x03, 0xf1, 0x18, 0x37, 0x00, 0x08,
+    0x38, 0x00, 0x08, 0x39, 0x00, 0x08, 0x3a, 0x00, 0x08, 0x3b, 0x00, 0x08, 0x3c, 0x00, 0x08, 0x3d,
+    0x00, 0x08, 0x3e, 0x00, 0x80, 0x55, 0x07, 0x80, 0x06, 0x06, 0x80, 0xfb, 0x05, 0x80, 0x00, 0x06,
+    0x06, 0x2f, 0x00, 0x06, 0x8d, 0x35, 0x31, 0x0c, 0x25, 0x00, 0x73, 0x42, 0x14, 0x00, 0x91, 0x8e,
+    0x07, 0x48, 0x00, 0xf4, 0x9c, 0xa2, 0x00, 0x08, 0xa3, 0x00, 0x08, 0xa4, 0x00, 0x08, 0xa5, 0x00,
+    0x08, 0xa6, 0x00, 0x08, 0xa7, 0x00, 0x08, 0xa8, 0x00, 0x08, 0xa9, 0x00, 0x08, 0xaa, 0x00, 0x08,
+    0xab, 0x00, 0x08, 0xac, 0x00, 0x08, 0xad, 0x00, 0x08, 0xae, 0x00, 0x08, 0xaf, 0x00, 0x08, 0xb0,
+    0x00, 0x08, 0xb1, 0x00, 0x08, 0xb2, 0x00, 0x08, 0xb3, 0x00, 0x08, 0xb4, 0x00, 0x08, 0xb5, 0x00,
+    0x08, 0xb6, 0x00, 0x08, 0xb7, 0x00, 0x08, 0xb8, 0x00, 0x08, 0xb9, 0x00, 0x08, 0xba, 0x00, 0x08,
+    0xbb, 0x00, 0x08, 0xbc, 0x00, 0x08, 0xbd, 0x00, 0x08, 0xbe, 0x00, 0x08, 0xbf, 0x00, 0x08, 0xc0,
+    0x00, 0x08, 0xc1, 0x00, 0x08, 0xc2, 0x00, 0x08, 0xc3, 0x00, 0x08, 0xc4, 0x00, 0x08, 0xc5, 0x00,
+    0x08, 0xc6, 0x00, 0x08, 0xc7, 0x00, 0x08, 0xc8, 0x00, 0x08, 0xc9, 0x00, 0x08, 0xca, 0x00, 0x08,
+    0xcb, 0x00, 0x08, 0xcc, 0x00, 0x08, 0xcd, 0x00, 0x08, 0xce, 0x00, 0x08, 0xcf, 0x00, 0x08, 0xd0,
+    0x00, 0x08, 0xd1, 0x00, 0x08, 0xd2, 0x00, 0x08, 0xd3, 0x00, 0x08, 0xd4, 0x00, 0x08, 0xd5, 0x00,
+    0x08, 0xd6, 0x00, 0x08, 0xd7, 0x00, 0x08, 0xd8, 0x00, 0x0c, 0x2a, 0x01, 0x08, 0xd9, 0x00, 0x08,
+    0xf4, 0x8c, 0xff, 0xd8, 0x08, 0xdb, 0x00, 0x08, 0xdc, 0x00, 0x08, 0xdd, 0x00, 0x08, 0xde, 0x00,
+    0x06, 0x41, 0x00, 0x06, 0x42, 0x00, 0x06, 0x43, 0x00, 0x06, 0x44, 0x00, 0x06, 0x45, 0x00, 0x06,
+    0x46, 0x00, 0x06, 0x47, 0x00, 0x06, 0x48, 0x00, 0x06, 0x49, 0x00, 0x06, 0x4a, 0x00, 0x06, 0x4b,
+    0x00, 0x06, 0x4c, 0x00, 0x06, 0x4d, 0x00, 0x06, 0x4e, 0x00, 0x06, 0x4f, 0x00, 0x06, 0x50, 0x00,
+    0x08, 0xdf, 0x00, 0x08, 0xe0, 0x00, 0x08, 0xe1, 0x00, 0x08, 0xe2, 0x00, 0x08, 0xe3, 0x00, 0x08,
+    0xe4, 0x00, 0x08, 0xe5, 0x00, 0x08, 0xe6, 0x00, 0x08, 0xe7, 0x00, 0x08, 0xe8, 0x00, 0x08, 0xe9,
+    0x00, 0x08, 0xea, 0x00, 0x08, 0xeb, 0x00, 0x08, 0xec, 0x00, 0x08, 0xed, 0x00, 0x08, 0xee, 0x00,
+    0x80, 0xd1, 0x05, 0x80, 0x23, 0x05, 0x80, 0x18, 0x01, 0x08, 0xef, 0x00, 0x08, 0xf0, 0x00, 0x08,
+    0xf1, 0x00, 0x08, 0xf2, 0x00, 0x08, 0xf3, 0x00, 0x80, 0xd2, 0x05, 0x80, 0x24, 0x05, 0x80, 0x2e,
+    0x06, 0x08, 0xf4, 0x00, 0x08, 0xf5, 0x00, 0x08, 0xf6, 0x00, 0x08, 0xf7, 0x00, 0x08, 0xf8, 0x00,
+    0x08, 0xf9, 0x00, 0x08, 0xfa, 0x00, 0x08, 0xfb, 0x00, 0x08, 0xfc, 0x00, 0x08, 0xfd, 0x00, 0x08,
+    0xfe, 0x00, 0x08, 0xff, 0x00, 0x08, 0x00, 0x01, 0x08, 0x01, 0x01, 0x08, 0x02, 0x01, 0x08, 0x03,
+    0x01, 0x08, 0x04, 0x01, 0x08, 0x05, 0x01, 0x08, 0x06, 0x01, 0x08, 0x07, 0x01, 0x08, 0x08, 0x01,
+    0x08, 0x09, 0x01, 0x08, 0x0a, 0x01, 0x08, 0x0b, 0x01, 0x08, 0x0c, 0x01, 0x08, 0x0d, 0x01, 0x08,
+    0x0e, 0x01, 0x08, 0x0f, 0x01, 0x08, 0x10, 0x01, 0x80, 0x9e, 0x00, 0x03, 0x00, 0x02, 0xf4, 0x7f,
+    0x08, 0x11, 0x01, 0x08, 0x12, 0x01, 0x08, 0x13, 0x01, 0x08, 0x14, 0x01, 0x08, 0x15, 0x01, 0x08,
+    0x16, 0x01, 0x08, 0x17, 0x01, 0x08, 0x18, 0x01, 0x08, 0x19, 0x01, 0x08, 0x1a, 0x01, 0x08, 0x1b,
+    0x01, 0x08, 0x1c, 0x01, 0x08, 0x1d, 0x01, 0x08, 0x1e, 0x01, 0x08, 0x1f, 0x01, 0x08, 0x20, 0x01,
+    0x08, 0x21, 0x01, 0x08, 0x22, 0x01, 0x08, 0x23, 0x01, 0x08, 0x24, 0x01, 0x08, 0x25, 0x01, 0x08,
+    0x26, 0x01, 0x08, 0x27, 0x01, 0x08, 0x28, 0x01, 0x08, 0x29, 0x01, 0x08, 0x2a, 0x01, 0x08, 0x2b,
+    0x01, 0x08, 0x2c, 0x01, 0x08, 0x2d, 0x01, 0x08, 0x2e, 0x01, 0x08, 0x2f, 0x01, 0x08, 0x30, 0x01,
+    0x08, 0x31, 0x01, 0x08, 0x32, 0x01, 0x08, 0x33, 0x01, 0x08, 0x34, 0x01, 0x08, 0x35, 0x01, 0x08,
+    0x36, 0x01, 0x08, 0x37, 0x01, 0x08, 0x38, 0x01, 0x08, 0x39, 0x01, 0x08, 0x3a, 0x01, 0x08, 0x3b,
+    0x01, 0x08, 0x3c, 0x01, 0x08, 0x3d, 0x01, 0x08, 0x3e, 0x01, 0x08, 0x3f, 0x01, 0x08, 0xb3, 0x91,
+    0x0f, 0x01, 0x00, 0x0b, 0x31, 0x08, 0x0d, 0x00, 0x82, 0xcf, 0x0f, 0x01, 0x00, 0x15, 0x47, 0x08,
+    0x0f, 0x00, 0x08, 0x40, 0x22, 0x0f, 0x01, 0x00, 0xff, 0x29, 0x17, 0x08, 0x2f, 0xbc, 0x11, 0x08,
+    0xe5, 0x11, 0x17, 0x08, 0x3b, 0x1b, 0x11, 0x08, 0x8f, 0x0d, 0x44, 0x08, 0x15, 0x00, 0x08, 0x80,
+    0x0d, 0x17, 0x08, 0x3b, 0x1b, 0x11, 0x08, 0xa1, 0x19, 0x17, 0x08, 0x1e, 0x1a, 0x11, 0x08, 0x0d,
+    0x13, 0x44, 0x08, 0x1b, 0x00, 0x08, 0xd5, 0x20, 0x00, 0x22, 0xf0, 0x05, 0x1e, 0x00, 0x01, 0x00,
+    0x12, 0x17, 0x08, 0x4b, 0x20, 0x11, 0x08, 0x48, 0x20, 0x47, 0x08, 0x21, 0x00, 0x08, 0x36, 0x1a,
+    0x14, 0x08, 0x63, 0xcb, 0x00, 0x0c, 0x00, 0x07, 0xf4, 0x12, 0x0f, 0x01, 0x00, 0xa4, 0xf7, 0x13,
+    0x08, 0x3f, 0x00, 0x08, 0x40, 0x00, 0x08, 0x41, 0x00, 0x08, 0x42, 0x00, 0x08, 0x43, 0x00, 0x08,
+    0x44, 0x00, 0x08, 0x45, 0x00, 0x08, 0x46, 0x00, 0x08, 0x47, 0x00, 0x08, 0x48, 0x00, 0x08, 0x49,
+    0x00, 0x08, 0xce, 0x24, 0x00, 0x30, 0x00, 0x07, 0xa1, 0x24, 0x41, 0x08, 0x4c, 0x00, 0x08, 0x83,
+    0x39, 0x11, 0x08, 0x1d, 0x39, 0x06, 0x18, 0x00, 0x61, 0x4f, 0x00, 0x08, 0x50, 0x00, 0x08, 0x28,
+    0x25, 0xf4, 0x01, 0x08, 0x52, 0x00, 0x08, 0x53, 0x00, 0x08, 0x54, 0x00, 0x08, 0x55, 0x00, 0x08,
+    0x56, 0x00, 0x08, 0x94, 0xcd, 0xa1, 0x08, 0x58, 0x00, 0x08, 0x59, 0x00, 0x08, 0x5a, 0x00, 0x08,
+    0xad, 0x39, 0x06, 0x3c, 0x00, 0xf1, 0x00, 0x5c, 0x00, 0x08, 0x5d, 0x00, 0x08, 0x5e, 0x00, 0x08,
+    0x5f, 0x00, 0x08, 0x60, 0x00, 0x08, 0x2f, 0x3c, 0xf1, 0x10, 0x08, 0x62, 0x00, 0x08, 0x63, 0x00,
+    0x08, 0x64, 0x00, 0x08, 0x65, 0x00, 0x08, 0x66, 0x00, 0x08, 0x67, 0x00, 0x08, 0x68, 0x00, 0x08,
+    0x69, 0x00, 0x08, 0x6a, 0x00, 0x08, 0x6b, 0x00, 0x08, 0x83, 0x39, 0x0f, 0x01, 0x00, 0xa4, 0x71,
+    0x08, 0x6d, 0x00, 0x08, 0x6e, 0x00, 0x08, 0x2e, 0x3d, 0x0f, 0x01, 0x00, 0xb9, 0xf1, 0x01, 0x08,
+    0x70, 0x00, 0x08, 0x71, 0x00, 0x08, 0x72, 0x00, 0x08, 0x73, 0x00, 0x08, 0x74, 0x00, 0x08, 0x55,
+    0x25, 0x1a, 0x08, 0x88, 0x25, 0x09, 0x30, 0x00, 0x04, 0x94, 0x25, 0xd4, 0x08, 0x78, 0x00, 0x08,
+    0x79, 0x00, 0x08, 0x7a, 0x00, 0x08, 0x7b, 0x00, 0x08, 0x66, 0xab, 0x0f, 0x01, 0x00, 0x17, 0x44,
+    0x08, 0x7d, 0x00, 0x08, 0xa5, 0xab, 0x00, 0x0f, 0x00, 0x31, 0x7f, 0x00, 0x08, 0x95, 0x54, 0xd1,
+    0x08, 0x81, 0x00, 0x08, 0x82, 0x00, 0x08, 0x83, 0x00, 0x08, 0x84, 0x00, 0x08, 0x00, 0x3e, 0x0f,
+    0x48, 0x00, 0x0c, 0xf1, 0x06, 0x86, 0x00, 0x08, 0x87, 0x00, 0x08, 0x88, 0x00, 0x08, 0x89, 0x00,
+    0x08, 0x8a, 0x00, 0x08, 0x8b, 0x00, 0x08, 0x8c, 0x00, 0x08, 0xef, 0xcf, 0x06, 0x24, 0x00, 0x94,
+    0x8e, 0x00, 0x08, 0x8f, 0x00, 0x08, 0x90, 0x00, 0x08, 0x45, 0xc0, 0x0f, 0x48, 0x00, 0x00, 0x61,
+    0x92, 0x00, 0x08, 0x93, 0x00, 0x08, 0xf4, 0xeb, 0x0f, 0x01, 0x00, 0x41, 0x71, 0x08, 0x95, 0x00,
+    0x08, 0x96, 0x00, 0x08, 0x34, 0x55, 0x11, 0x08, 0xb6, 0x1e, 0x0f, 0x01, 0x00, 0x3b, 0xa4, 0x08,
+    0x99, 0x00, 0x08, 0x9a, 0x00, 0x08, 0x9b, 0x00, 0x08, 0x88, 0xd0, 0x0f, 0x01, 0x00, 0xff, 0x20,
+    0x11, 0x08, 0x21, 0x20, 0x44, 0x08, 0x9e, 0x00, 0x08, 0xb4, 0xd1, 0x0f, 0x39, 0x00, 0x15, 0x01,
+    0xd8, 0xd1, 0x0f, 0x33, 0x00, 0x1b, 0x01, 0x98, 0x57, 0x0f, 0x01, 0x00, 0x47, 0xf1, 0x07, 0x08,
+    0x5a, 0x01, 0x08, 0x5b, 0x01, 0x08, 0x5c, 0x01, 0x08, 0x5d, 0x01, 0x08, 0x5e, 0x01, 0x08, 0x5f,
+    0x01, 0x08, 0x60, 0x01, 0x08, 0x24, 0x56, 0x0f, 0x48, 0x00, 0x1b, 0x31, 0x62, 0x01, 0x08, 0xfb,
+    0x45, 0x11, 0x08, 0x31, 0xeb, 0x00, 0x09, 0x00, 0x31, 0x65, 0x01, 0x08, 0xbd, 0x44, 0x0f, 0x01,
+    0x00, 0x4d, 0x11, 0x08, 0xb2, 0x25, 0x00, 0x09, 0x00, 0xf1, 0x12, 0x68, 0x01, 0x08, 0x69, 0x01,
+    0x08, 0x6a, 0x01, 0x08, 0x6b, 0x01, 0x08, 0x6c, 0x01, 0x08, 0x6d, 0x01, 0x08, 0x6e, 0x01, 0x08,
+    0x6f, 0x01, 0x08, 0x70, 0x01, 0x08, 0x71, 0x01, 0x08, 0x72, 0x01, 0x08, 0x8b, 0xeb, 0x0f, 0x01,
+    0x00, 0x32, 0x5f, 0x08, 0x74, 0x01, 0x08, 0x75, 0xde, 0x00, 0x51, 0x0f, 0x01, 0x00, 0x62, 0x17,
+    0x08, 0x03, 0x2c, 0x14, 0x08, 0x00, 0x2c, 0x0f, 0x01, 0x00, 0xaa, 0x11, 0x08, 0xe0, 0x45, 0x11,
+    0x08, 0x74, 0xed, 0x0f, 0x01, 0x00, 0x3b, 0x41, 0x08, 0x7a, 0x01, 0x08, 0xbf, 0xed, 0x0f, 0x01,
+    0x00, 0x74, 0x4a, 0x08, 0x7c, 0x01, 0x08, 0x4e, 0x2c, 0x0f, 0x30, 0x00, 0x0c, 0x3f, 0x7e, 0x01,
+    0x08, 0xc5, 0xd8, 0x04, 0x0f, 0x01, 0x00, 0xe6, 0x11, 0x08, 0x1d, 0x27, 0x0f, 0x01, 0x00, 0xf8,
+    0x15, 0x08, 0xfc, 0xa0, 0x0f, 0x33, 0x00, 0x17, 0x32, 0x82, 0x01, 0x08, 0x2f, 0xcb, 0x0f, 0x01,
+    0x00, 0x4c, 0x11, 0x08, 0xe7, 0x4a, 0x0c, 0x15, 0x00, 0xf1, 0x06, 0x85, 0x01, 0x08, 0x86, 0x01,
+    0x08, 0x87, 0x01, 0x08, 0x88, 0x01, 0x08, 0x89, 0x01, 0x08, 0x8a, 0x01, 0x08, 0x8b, 0x01, 0x08,
+    0x1f, 0x5b, 0x0f, 0x01, 0x00, 0x32, 0x41, 0x08, 0x8d, 0x01, 0x08, 0x55, 0x5b, 0x00, 0x0c, 0x00,
+    0x31, 0x8f, 0x01, 0x08, 0x17, 0x4e, 0x0f, 0x01, 0x00, 0xff, 0xaa, 0x11, 0x08, 0x0b, 0xf3, 0x0f,
+    0x01, 0x00, 0xff, 0xff, 0xe0, 0xf1, 0x07, 0x08, 0x92, 0x01, 0x08, 0x93, 0x01, 0x08, 0x94, 0x01,
+    0x08, 0x95, 0x01, 0x08, 0x96, 0x01, 0x08, 0x97, 0x01, 0x08, 0x98, 0x01, 0x08, 0xe7, 0xf5, 0x0f,
+    0x48, 0x00, 0x1b, 0x31, 0x9a, 0x01, 0x08, 0xa6, 0x61, 0x11, 0x08, 0x1d, 0xf6, 0x01, 0x26, 0x0d,
+    0x2f, 0x01, 0x08, 0xba, 0x1b, 0x01, 0x0f, 0x01, 0x00, 0x3e, 0x11, 0x08, 0x56, 0x1c, 0x01, 0x5f,
+    0x0d, 0xf1, 0x56, 0x01, 0x08, 0xa1, 0x01, 0x08, 0xa2, 0x01, 0x08, 0xa3, 0x01, 0x08, 0xa4, 0x01,
+    0x08, 0xa5, 0x01, 0x08, 0xa6, 0x01, 0x08, 0xa7, 0x01, 0x08, 0xa8, 0x01, 0x08, 0xa9, 0x01, 0x08,
+    0xaa, 0x01, 0x08, 0xab, 0x01, 0x08, 0xac, 0x01, 0x08, 0xad, 0x01, 0x08, 0xae, 0x01, 0x08, 0xaf,
+    0x01, 0x08, 0xb0, 0x01, 0x08, 0xb1, 0x01, 0x08, 0xb2, 0x01, 0x08, 0xb3, 0x01, 0x08, 0xb4, 0x01,
+    0x08, 0xb5, 0x01, 0x08, 0xb6, 0x01, 0x08, 0xb7, 0x01, 0x08, 0xb8, 0x01, 0x08, 0xb9, 0x01, 0x08,
+    0xba, 0x01, 0x08, 0xbb, 0x01, 0x08, 0xbc, 0x01, 0x08, 0xbd, 0x01, 0x08, 0xbe, 0x01, 0x08, 0xbf,
+    0x01, 0x08, 0xc0, 0x01, 0x08, 0xc1, 0x01, 0x08, 0x62, 0x60, 0xa1, 0x08, 0xc3, 0x01, 0x08, 0xc4,
+    0x01, 0x08, 0xc5, 0x01, 0x08, 0x41, 0xf6, 0x00, 0x12, 0x00, 0x31, 0xc7, 0x01, 0x08, 0xef, 0xe7,
+    0x0f, 0x01, 0x00, 0xb0, 0x11, 0x08, 0xac, 0xe8, 0x71, 0x08, 0xca, 0x01, 0x08, 0xcb, 0x01, 0x08,
+    0xbe, 0xe8, 0x0f, 0x2d, 0x00, 0x09, 0xf1, 0x00, 0xcd, 0x01, 0x08, 0xce, 0x01, 0x08, 0xcf, 0x01,
+    0x08, 0xd0, 0x01, 0x08, 0xd1, 0x01, 0x08, 0x36, 0x21, 0xf1, 0x37, 0x08, 0xd3, 0x01, 0x08, 0xd4,
+    0x01, 0x08, 0xd5, 0x01, 0x08, 0xd6, 0x01, 0x08, 0xd7, 0x01, 0x08, 0xd8, 0x01, 0x08, 0xd9, 0x01,
+    0x08, 0xda, 0x01, 0x08, 0xdb, 0x01, 0x08, 0xdc, 0x01, 0x08, 0xdd, 0x01, 0x08, 0xde, 0x01, 0x08,
+    0xdf, 0x01, 0x08, 0xe0, 0x01, 0x08, 0xe1, 0x01, 0x08, 0xe2, 0x01, 0x08, 0xe3, 0x01, 0x08, 0xe4,
+    0x01, 0x08, 0xe5, 0x01, 0x08, 0xe6, 0x01, 0x08, 0xe7, 0x01, 0x08, 0xe8, 0x01, 0x08, 0xe9, 0x01,
+    0x08, 0x94, 0xd1, 0xf1, 0x02, 0x08, 0xeb, 0x01, 0x08, 0xec, 0x01, 0x08, 0xed, 0x01, 0x08, 0xee,
+    0x01, 0x08, 0xef, 0x01, 0x08, 0xf0, 0x15, 0x00, 0xf1, 0x03, 0xf1, 0x01, 0x08, 0xf2, 0x01, 0x08,
+    0xf3, 0x01, 0x08, 0xf4, 0x01, 0x08, 0xf5, 0x01, 0x08, 0xf6, 0x01, 0x08, 0xe6, 0xf6, 0x11, 0x08,
+    0xe4, 0x62, 0x03, 0x99, 0x00, 0x01, 0xf2, 0xf6, 0x0c, 0xae, 0x00, 0x61, 0xfa, 0x01, 0x08, 0xfb,
+    0x01, 0x08, 0xfb, 0xf6, 0x00, 0x0f, 0x00, 0xf1, 0x03, 0xfd, 0x01, 0x08, 0xfe, 0x01, 0x08, 0xff,
+    0x01, 0x08, 0x00, 0x02, 0x08, 0x01, 0x02, 0x08, 0x02, 0x02, 0x08, 0xae, 0x21, 0xf3, 0x32, 0x08,
+    0x04, 0x02, 0x08, 0x05, 0x02, 0x08, 0x06, 0x02, 0x08, 0x07, 0x02, 0x08, 0x08, 0x02, 0x08, 0x09,
+    0x02, 0x08, 0x0a, 0x02, 0x08, 0x0b, 0x02, 0x08, 0x0c, 0x02, 0x08, 0x0d, 0x02, 0x08, 0x0e, 0x02,
+    0x08, 0x0f, 0x02, 0x08, 0x10, 0x02, 0x08, 0x11, 0x02, 0x08, 0x12, 0x02, 0x08, 0x13, 0x02, 0x08,
+    0x14, 0x02, 0x08, 0x15, 0x02, 0x08, 0x16, 0x02, 0x08, 0x17, 0x02, 0x08, 0x18, 0x02, 0x08, 0x19,
+    0xb4, 0x1b, 0xf1, 0x22, 0x08, 0x1a, 0x02, 0x08, 0x1b, 0x02, 0x08, 0x1c, 0x02, 0x08, 0x1d, 0x02,
+    0x08, 0x1e, 0x02, 0x08, 0x1f, 0x02, 0x08, 0x20, 0x02, 0x08, 0x21, 0x02, 0x08, 0x22, 0x02, 0x08,
+    0x23, 0x02, 0x08, 0x24, 0x02, 0x08, 0x25, 0x02, 0x08, 0x26, 0x02, 0x08, 0x27, 0x02, 0x08, 0x28,
+    0x02, 0x08, 0x29, 0x02, 0x08, 0x55, 0x31, 0xf1, 0x01, 0x08, 0x2b, 0x02, 0x08, 0x2c, 0x02, 0x08,
+    0x2d, 0x02, 0x08, 0x2e, 0x02, 0x08, 0x2f, 0x02, 0x08, 0x16, 0x61, 0x06, 0xc3, 0x00, 0xf1, 0x0c,
+    0x31, 0x02, 0x08, 0x32, 0x02, 0x08, 0x33, 0x02, 0x08, 0x34, 0x02, 0x08, 0x35, 0x02, 0x08, 0x36,
+    0x02, 0x08, 0x37, 0x02, 0x08, 0x38, 0x02, 0x08, 0x39, 0x02, 0x08, 0xb3, 0xf6, 0x00, 0x24, 0x00,
+    0x91, 0x3b, 0x02, 0x08, 0x3c, 0x02, 0x08, 0x3d, 0x02, 0x08, 0xad, 0xf6, 0x0c, 0x05, 0x01, 0xc1,
+    0x3f, 0x02, 0x08, 0x40, 0x02, 0x08, 0x41, 0x02, 0x08, 0x42, 0x02, 0x08, 0xb0, 0xf6, 0x0f, 0x01,
+    0x00, 0x05, 0xa1, 0x08, 0x44, 0x02, 0x08, 0x45, 0x02, 0x08, 0x46, 0x02, 0x08, 0x2e, 0x2b, 0xf1,
+    0x10, 0x08, 0x48, 0x02, 0x08, 0x49, 0x02, 0x08, 0x4a, 0x02, 0x08, 0x4b, 0x02, 0x08, 0x4c, 0x02,
+    0x08, 0x4d, 0x02, 0x08, 0x4e, 0x02, 0x08, 0x4f, 0x02, 0x08, 0x50, 0x02, 0x08, 0x51, 0x02, 0x08,
+    0x6c, 0x32, 0x03, 0x39, 0x00, 0x01, 0x5a, 0x32, 0x06, 0x0f, 0x00, 0x91, 0x54, 0x02, 0x08, 0x55,
+    0x02, 0x08, 0x56, 0x02, 0x08, 0xab, 0xd2, 0x11, 0x08, 0xd4, 0x1c, 0xd1, 0x08, 0x59, 0x02, 0x08,
+    0x5a, 0x02, 0x08, 0x5b, 0x02, 0x08, 0x5c, 0x02, 0x08, 0x8d, 0xd2, 0x00, 0x15, 0x00, 0xf1, 0x18,
+    0x5e, 0x02, 0x08, 0x5f, 0x02, 0x08, 0x60, 0x02, 0x08, 0x61, 0x02, 0x08, 0x62, 0x02, 0x08, 0x63,
+    0x02, 0x08, 0x64, 0x02, 0x08, 0x65, 0x02, 0x08, 0x66, 0x02, 0x08, 0x67, 0x02, 0x08, 0x68, 0x02,
+    0x08, 0x69, 0x02, 0x08, 0x6a, 0x02, 0x08, 0x95, 0xf6, 0x00, 0x30, 0x00, 0xfa, 0x0d, 0x6c, 0x02,
+    0x08, 0x6d, 0x02, 0x08, 0x6e, 0x02, 0x08, 0x6f, 0x02, 0x08, 0x70, 0x02, 0x08, 0x71, 0x02, 0x08,
+    0x72, 0x02, 0x08, 0x73, 0x02, 0x08, 0x74, 0x02, 0x08, 0x75, 0x84, 0x00, 0xf1, 0x12, 0x76, 0x02,
+    0x08, 0x77, 0x02, 0x08, 0x78, 0x02, 0x08, 0x79, 0x02, 0x08, 0x7a, 0x02, 0x08, 0x7b, 0x02, 0x08,
+    0x7c, 0x02, 0x08, 0x7d, 0x02, 0x08, 0x7e, 0x02, 0x08, 0x7f, 0x02, 0x08, 0x80, 0x02, 0x08, 0x16,
+    0x61, 0x06, 0x30, 0x00, 0x01, 0xd4, 0xed, 0x71, 0x08, 0x83, 0x02, 0x08, 0x84, 0x02, 0x08, 0xf4,
+    0xdc, 0xa1, 0x08, 0x86, 0x02, 0x08, 0x87, 0x02, 0x08, 0x88, 0x02, 0x08, 0x47, 0xf6, 0x11, 0x08,
+    0x47, 0xf6, 0x0f, 0x01, 0x00, 0x0e, 0xbf, 0x08, 0x8b, 0x02, 0x08, 0x8c, 0x02, 0x08, 0x8d, 0x02,
+    0x08, 0x8e, 0x30, 0x00, 0x12, 0x0f, 0x01, 0x00, 0x29, 0x51, 0x08, 0x8f, 0x02, 0x08, 0x90, 0x9c,
+    0x00, 0x74, 0x91, 0x02, 0x08, 0x92, 0x02, 0x08, 0x93, 0x26, 0x01, 0xa7, 0x94, 0x02, 0x08, 0x95,
+    0x02, 0x08, 0x96, 0x02, 0x08, 0x97, 0xa4, 0x01, 0x01, 0x2c, 0xd9, 0x06, 0x0f, 0x00, 0xf1, 0x07,
+    0x99, 0x02, 0x08, 0x9a, 0x02, 0x08, 0x9b, 0x02, 0x08, 0x9c, 0x02, 0x08, 0x9d, 0x02, 0x08, 0x9e,
+    0x02, 0x08, 0x9f, 0x02, 0x08, 0xa0, 0x4e, 0x00, 0xf1, 0x04, 0xa1, 0x02, 0x08, 0xa2, 0x02, 0x08,
+    0xa3, 0x02, 0x08, 0xa4, 0x02, 0x08, 0xa5, 0x02, 0x08, 0xa6, 0x02, 0x08, 0xa7, 0x18, 0x00, 0x61,
+    0xa8, 0x02, 0x08, 0xa9, 0x02, 0x08, 0xdf, 0x61, 0x0f, 0xa8, 0x00, 0x1b, 0xa4, 0xab, 0x02, 0x08,
+    0xac, 0x02, 0x08, 0xad, 0x02, 0x08, 0xae, 0xa2, 0x00, 0x44, 0xaf, 0x02, 0x08, 0xb0, 0x0c, 0x00,
+    0x7f, 0xb1, 0x02, 0x08, 0xb2, 0x02, 0x08, 0xb3, 0x57, 0x00, 0x0f, 0x41, 0x08, 0xb4, 0x02, 0x08,
+    0xa7, 0xea, 0x00, 0x0c, 0x00, 0xaf, 0xb6, 0x02, 0x08, 0xb7, 0x02, 0x08, 0xb8, 0x02, 0x08, 0xb9,
+    0x90, 0x00, 0x18, 0x41, 0x08, 0xba, 0x02, 0x08, 0x8d, 0xec, 0x0f, 0x1e, 0x00, 0x03, 0x91, 0xbc,
+    0x02, 0x08, 0xbd, 0x02, 0x08, 0xbe, 0x02, 0x08, 0xab, 0xec, 0x0f, 0x01, 0x00, 0xf8, 0x41, 0x08,
+    0xc0, 0x02, 0x08, 0xd9, 0xf7, 0x0f, 0x01, 0x00, 0xd1, 0x11, 0x08, 0x91, 0xf1, 0x0f, 0x01, 0x00,
+    0x9e, 0x41, 0x08, 0xc3, 0x02, 0x08, 0x77, 0xf9, 0x0f, 0x3c, 0x00, 0x21, 0x01, 0x7e, 0xf2, 0x0f,
+    0x1e, 0x00, 0x06, 0xf1, 0x03, 0xc6, 0x02, 0x08, 0xc7, 0x02, 0x08, 0xc8, 0x02, 0x08, 0xc9, 0x02,
+    0x08, 0xca, 0x02, 0x08, 0xcb, 0x02, 0x08, 0xd9, 0xd7, 0x0f, 0x01, 0x00, 0xff, 0xa7, 0x11, 0x08,
+    0xb3, 0xd9, 0x0f, 0x01, 0x00, 0x32, 0x41, 0x08, 0xce, 0x02, 0x08, 0x66, 0x9b, 0x0f, 0x42, 0x00,
+    0x27, 0x31, 0xd0, 0x02, 0x08, 0x1f, 0xda, 0x0f, 0x1e, 0x00, 0x03, 0x91, 0xd2, 0x02, 0x08, 0xd3,
+    0x02, 0x08, 0xd4, 0x02, 0x08, 0x02, 0x4e, 0x0f, 0x01, 0x00, 0xbc, 0xff, 0x0e, 0x08, 0xd6, 0x02,
+    0x08, 0xd7, 0x02, 0x08, 0xd8, 0x02, 0x08, 0xd9, 0x02, 0x08, 0xda, 0x02, 0x08, 0xdb, 0x02, 0x08,
+    0xdc, 0x02, 0x08, 0xdd, 0x02, 0x08, 0xde, 0x02, 0x08, 0xdf, 0xcc, 0x09, 0x01, 0xf1, 0x0c, 0xe0,
+    0x02, 0x08, 0xe1, 0x02, 0x08, 0xe2, 0x02, 0x08, 0xe3, 0x02, 0x08, 0xe4, 0x02, 0x08, 0xe5, 0x02,
+    0x08, 0xe6, 0x02, 0x08, 0xe7, 0x02, 0x08, 0xe8, 0x02, 0x08, 0x89, 0xfc, 0x0c, 0x30, 0x00, 0xf4,
+    0x0c, 0xea, 0x02, 0x08, 0xeb, 0x02, 0x08, 0xec, 0x02, 0x08, 0xed, 0x02, 0x08, 0xee, 0x02, 0x08,
+    0xef, 0x02, 0x08, 0xf0, 0x02, 0x08, 0xf1, 0x02, 0x08, 0xf2, 0x02, 0x08, 0x4f, 0x6a, 0x0f, 0x01,
+    0x00, 0xd7, 0x71, 0x08, 0xf4, 0x02, 0x08, 0xf5, 0x02, 0x08, 0xd7, 0x3f, 0x03, 0x12, 0x00, 0x04,
+    0x3c, 0x6b, 0x0f, 0x4e, 0x00, 0x21, 0x01, 0x30, 0x83, 0x47, 0x08, 0xf9, 0x02, 0x08, 0x51, 0x30,
+    0x0f, 0x01, 0x00, 0x4d, 0x11, 0x08, 0x5b, 0x58, 0x0c, 0x15, 0x00, 0xf4, 0x06, 0xfc, 0x02, 0x08,
+    0xfd, 0x02, 0x08, 0xfe, 0x02, 0x08, 0xff, 0x02, 0x08, 0x00, 0x03, 0x08, 0x01, 0x03, 0x08, 0x02,
+    0x03, 0x08, 0xa8, 0xc3, 0x0f, 0x5a, 0x00, 0x15, 0x34, 0x04, 0x03, 0x08, 0xf6, 0xc3, 0x0c, 0x1b,
+    0x00, 0x91, 0x06, 0x03, 0x08, 0x07, 0x03, 0x08, 0x08, 0x03, 0x08, 0x19, 0x6a, 0x00, 0x12, 0x00,
+    0x31, 0x0a, 0x03, 0x08, 0x13, 0x6a, 0x0f, 0x01, 0x00, 0xb0, 0x11, 0x08, 0xd6, 0x6a, 0x0f, 0x01,
+    0x00, 0x53, 0x12, 0x08, 0x7a, 0xe6, 0x0f, 0x01, 0x00, 0x64, 0xf2, 0x01, 0x08, 0x0e, 0x03, 0x08,
+    0x0f, 0x03, 0x08, 0x10, 0x03, 0x08, 0x11, 0x03, 0x08, 0x12, 0x03, 0x08, 0xf2, 0x64, 0x0f, 0x30,
+    0x00, 0x08, 0xfd, 0x0f, 0x14, 0x03, 0x08, 0x15, 0x03, 0x08, 0x16, 0x03, 0x08, 0x17, 0x03, 0x08,
+    0x18, 0x03, 0x08, 0x19, 0x03, 0x08, 0x1a, 0x03, 0x08, 0x1b, 0x03, 0x08, 0x1c, 0x03, 0x08, 0x1d,
+    0x03, 0x08, 0x0e, 0xed, 0xf4, 0x01, 0x08, 0x1f, 0x03, 0x08, 0x20, 0x03, 0x08, 0x21, 0x03, 0x08,
+    0x22, 0x03, 0x08, 0x23, 0x03, 0x08, 0x43, 0xc2, 0x77, 0x08, 0x25, 0x03, 0x08, 0x26, 0x03, 0x08,
+    0xde, 0x50, 0x0f, 0x01, 0x00, 0x29, 0x17, 0x08, 0x17, 0x51, 0x0f, 0x01, 0x00, 0x41, 0x17, 0x08,
+    0x68, 0x51, 0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0xd4, 0x17, 0x08, 0x49, 0x55, 0x0f, 0x01, 0x00,
+    0xcb, 0x47, 0x08, 0x2b, 0x03, 0x08, 0x14, 0xca, 0x0f, 0x01, 0x00, 0x2c, 0x11, 0x08, 0xf4, 0x70,
+    0x41, 0x08, 0x2e, 0x03, 0x08, 0xeb, 0x70, 0x0f, 0x01, 0x00, 0x53, 0x11, 0x08, 0x51, 0x71, 0x0c,
+    0x15, 0x00, 0xf1, 0x06, 0x31, 0x03, 0x08, 0x32, 0x03, 0x08, 0x33, 0x03, 0x08, 0x34, 0x03, 0x08,
+    0x35, 0x03, 0x08, 0x36, 0x03, 0x08, 0x37, 0x03, 0x08, 0x33, 0x71, 0x0f, 0x01, 0x00, 0x32, 0x41,
+    0x08, 0x39, 0x03, 0x08, 0x6f, 0x71, 0x11, 0x08, 0x6f, 0x71, 0x11, 0x08, 0x6f, 0x71, 0x0f, 0x01,
+    0x00, 0xff, 0xff, 0x74, 0x41, 0x08, 0x3d, 0x03, 0x08, 0xeb, 0x73, 0x0f, 0x01, 0x00, 0xff, 0x65,
+    0x41, 0x08, 0x3f, 0x03, 0x08, 0x5f, 0x75, 0x0f, 0x01, 0x00, 0x92, 0x71, 0x08, 0x41, 0x03, 0x08,
+    0x42, 0x03, 0x08, 0xfe, 0x75, 0x0f, 0x01, 0x00, 0x2f, 0x11, 0x08, 0x40, 0x76, 0x41, 0x08, 0x45,
+    0x03, 0x08, 0x3d, 0x76, 0x0f, 0x01, 0x00, 0x53, 0x14, 0x08, 0x4e, 0x4a, 0x09, 0x15, 0x00, 0x71,
+    0x48, 0x03, 0x08, 0x49, 0x03, 0x08, 0x4a, 0x90, 0x00, 0x94, 0x4b, 0x03, 0x08, 0x4c, 0x03, 0x08,
+    0x4d, 0x03, 0x08, 0x79, 0x4c, 0x0f, 0x5a, 0x00, 0x15, 0x31, 0x4f, 0x03, 0x08, 0x73, 0x5e, 0x0f,
+    0x1b, 0x00, 0x00, 0xa6, 0x51, 0x03, 0x08, 0x52, 0x03, 0x08, 0x53, 0x03, 0x08, 0x54, 0x21, 0x00,
+    0x11, 0x08, 0x37, 0x5e, 0x0f, 0x01, 0x00, 0xb0, 0x2f, 0x08, 0x56, 0xbf, 0x01, 0x58, 0x07, 0xb4,
+    0x5f, 0x0f, 0x01, 0x00, 0xff, 0x26, 0x41, 0x08, 0x58, 0x03, 0x08, 0x85, 0x79, 0x0f, 0x42, 0x00,
+    0x27, 0x07, 0x92, 0x54, 0x0f, 0x1e, 0x00, 0x00, 0x01, 0xd6, 0x79, 0x0f, 0x01, 0x00, 0x5f, 0x4a,
+    0x08, 0x5c, 0x03, 0x08, 0xe7, 0x5c, 0x0f, 0x30, 0x00, 0x0c, 0x31, 0x5e, 0x03, 0x08, 0x69, 0x7a,
+    0x0f, 0x01, 0x00, 0xff, 0xf5, 0x11, 0x08, 0x70, 0x7c, 0x0f, 0x01, 0x00, 0x47, 0x11, 0x08, 0xca,
+    0x7c, 0x00, 0x09, 0x00, 0x01, 0xc7, 0x7c, 0x0f, 0x01, 0x00, 0xff, 0xff, 0x74, 0x41, 0x08, 0x63,
+    0x03, 0x08, 0x49, 0x7f, 0x0f, 0x01, 0x00, 0xff, 0x65, 0x41, 0x08, 0x65, 0x03, 0x08, 0xbd, 0x80,
+    0x0f, 0x01, 0x00, 0xaa, 0x11, 0x08, 0x7a, 0x81, 0x0f, 0x30, 0x00, 0x18, 0x31, 0x68, 0x03, 0x08,
+    0xa1, 0x81, 0x0f, 0x01, 0x00, 0x74, 0x81, 0x08, 0x6a, 0x03, 0x08, 0x6b, 0x03, 0x08, 0x6c, 0x00,
+    0x0c, 0x01, 0x67, 0x85, 0x0f, 0x01, 0x00, 0xff, 0x1a, 0x2f, 0x08, 0x6e, 0xf0, 0x18, 0xff, 0xff,
+    0xff, 0x18, 0x44, 0x08, 0x6f, 0x03, 0x08, 0xde, 0x5c, 0x5f, 0x08, 0x71, 0x03, 0x08, 0x72, 0x39,
+    0x03, 0xff, 0xff, 0xcc, 0x47, 0x08, 0x73, 0x03, 0x08, 0xb3, 0x5d, 0x0f, 0x01, 0x00, 0xf8, 0x44,
+    0x08, 0x75, 0x03, 0x08, 0x05, 0x5a, 0x0f, 0x01, 0x00, 0x71, 0x71, 0x08, 0x77, 0x03, 0x08, 0x78,
+    0x03, 0x08, 0x28, 0x8e, 0x11, 0x08, 0xa3, 0xac, 0x0f, 0x2a, 0x00, 0x06, 0x1f, 0x7b, 0x1e, 0x00,
+    0x06, 0x41, 0x08, 0x7c, 0x03, 0x08, 0x97, 0x73, 0x11, 0x08, 0x8e, 0x73, 0x03, 0x15, 0x00, 0x01,
+    0x8b, 0x73, 0x0f, 0x30, 0x00, 0x03, 0x04, 0x31, 0x73, 0x0f, 0x01, 0x00, 0xad, 0x14, 0x08, 0xeb,
+    0x73, 0x0f, 0x01, 0x00, 0x2f, 0x27, 0x08, 0x82, 0x3b, 0x01, 0x01, 0x87, 0x8f, 0x0f, 0x30, 0x00,
+    0x0c, 0x01, 0xa2, 0x8c, 0x03, 0x0c, 0x00, 0x01, 0xab, 0x8f, 0x0f, 0x2d, 0x00, 0x09, 0x17, 0x86,
+    0x2d, 0x00, 0x01, 0xcc, 0x8f, 0x0f, 0x01, 0x00, 0x35, 0xa1, 0x08, 0x88, 0x03, 0x08, 0x89, 0x03,
+    0x08, 0x8a, 0x03, 0x08, 0x17, 0x8d, 0x0f, 0x2d, 0x00, 0x0c, 0x1f, 0x8c, 0xa4, 0x13, 0x19, 0x01,
+    0x65, 0xb7, 0x00, 0x09, 0x00, 0x01, 0x5f, 0x8d, 0x11, 0x08, 0x5f, 0x8d, 0x11, 0x08, 0x5f, 0x8d,
+    0x41, 0x08, 0x91, 0x03, 0x08, 0x5c, 0x8d, 0x11, 0x08, 0x5c, 0x8d, 0x00, 0x09, 0x00, 0x61, 0x94,
+    0x03, 0x08, 0x95, 0x03, 0x08, 0x59, 0x8d, 0x0f, 0x4e, 0x00, 0x03, 0x91, 0x97, 0x03, 0x08, 0x98,
+    0x03, 0x08, 0x99, 0x03, 0x08, 0x65, 0x8d, 0x11, 0x08, 0x65, 0x8d, 0x00, 0x09, 0x00, 0xf1, 0x06,
+    0x9c, 0x03, 0x08, 0x9d, 0x03, 0x08, 0x9e, 0x03, 0x08, 0x9f, 0x03, 0x08, 0xa0, 0x03, 0x08, 0xa1,
+    0x03, 0x08, 0xa2, 0x03, 0x08, 0x53, 0x8d, 0x06, 0x3c, 0x00, 0x31, 0xa4, 0x03, 0x08, 0x59, 0x8d,
+    0x0c, 0x54, 0x00, 0x91, 0xa6, 0x03, 0x08, 0xa7, 0x03, 0x08, 0xa8, 0x03, 0x08, 0xff, 0x8f, 0x06,
+    0x18, 0x00, 0x01, 0xb1, 0x68, 0x0f, 0x01, 0x00, 0x17, 0x11, 0x08, 0xd2, 0x68, 0x41, 0x08, 0xac,
+    0x03, 0x08, 0x17, 0x90, 0x0f, 0x24, 0x00, 0x03, 0x11, 0xae, 0x24, 0x00, 0x01, 0xb9, 0x8d, 0x09,
+    0x18, 0x00, 0x11, 0xb0, 0x18, 0x00, 0x01, 0xc8, 0x8d, 0x11, 0x08, 0xc8, 0x8d, 0x11, 0x08, 0xc8,
+    0x8d, 0x11, 0x08, 0xc8, 0x8d, 0x11, 0x08, 0xc8, 0x8d, 0x11, 0x08, 0xc8, 0x8d, 0x03, 0x30, 0x00,
+    0x01, 0xce, 0x8d, 0x11, 0x08, 0xce, 0x8d, 0x11, 0x08, 0xce, 0x8d, 0x11, 0x08, 0xce, 0x8d, 0x09,
+    0x54, 0x00, 0x31, 0xbb, 0x03, 0x08, 0xd7, 0x8d, 0x00, 0x0c, 0x00, 0x11, 0xbd, 0x24, 0x00, 0x11,
+    0xbe, 0x06, 0x00, 0x11, 0xbf, 0x06, 0x00, 0x1f, 0xc0, 0xa5, 0x00, 0x03, 0x11, 0x08, 0xf8, 0x8d,
+    0xf1, 0x01, 0x08, 0xc2, 0x03, 0x08, 0xc3, 0x03, 0x08, 0xc4, 0x03, 0x08, 0xc5, 0x03, 0x08, 0xc6,
+    0x03, 0x08, 0xdd, 0x8d, 0x00, 0x18, 0x00, 0x31, 0xc8, 0x03, 0x08, 0xdd, 0x8d, 0x00, 0x0c, 0x00,
+    0x4f, 0xca, 0x03, 0x08, 0xcb, 0x02, 0x04, 0x75, 0x27, 0x08, 0xcc, 0x1d, 0x01, 0x1f, 0xcd, 0x96,
+    0x00, 0x30, 0x5f, 0x08, 0xce, 0x03, 0x08, 0xcf, 0x2e, 0x02, 0x01, 0x1f, 0xd0, 0xf3, 0x00, 0x6f,
+    0x2f, 0x08, 0xd1, 0x77, 0x0a, 0xff, 0x54, 0x41, 0x08, 0xd2, 0x03, 0x08, 0x34, 0xbb, 0x0f, 0x01,
+    0x00, 0xff, 0x02, 0x2f, 0x08, 0xd4, 0x1a, 0x01, 0xde, 0x2f, 0x08, 0xd5, 0xf3, 0x00, 0x87, 0x2f,
+    0x08, 0xd6, 0x8f, 0x01, 0x93, 0x2f, 0x08, 0xd7, 0x35, 0x0a, 0xb5, 0x1f, 0xd8, 0x85, 0x05, 0xff,
+    0x54, 0x0f, 0x01, 0x00, 0x14, 0x2f, 0x08, 0xd9, 0x8f, 0x01, 0xff, 0x7b, 0x0f, 0x01, 0x00, 0xff,
+    0xb3, 0x2f, 0x08, 0xda, 0x54, 0x03, 0x3f, 0x2f, 0x08, 0xdb, 0xa8, 0x03, 0xff, 0xc9, 0x7f, 0x0f,
+    0x48, 0x04, 0x0f, 0x49, 0x04, 0x0f, 0xe1, 0x63, 0x01, 0x4d, 0x0f, 0x4b, 0x04, 0x0f, 0xc9, 0x63,
+    0x77, 0x0f, 0x4d, 0x04, 0x0f, 0x4e, 0x04, 0x0f, 0xc1, 0x6d, 0x06, 0x1b, 0x00, 0x31, 0x50, 0x04,
+    0x0f, 0xe3, 0x90, 0x00, 0x0c, 0x00, 0x34, 0x52, 0x04, 0x0f, 0x9b, 0x7b, 0x11, 0x0f, 0xe6, 0x90,
+    0x0f, 0x01, 0x00, 0x17, 0x14, 0x0f, 0x58, 0x9a, 0x0f, 0x1e, 0x00, 0x03, 0x91, 0x56, 0x04, 0x0f,
+    0x57, 0x04, 0x0f, 0x58, 0x04, 0x0f, 0x15, 0x8f, 0x0f, 0x24, 0x00, 0x03, 0x91, 0x5a, 0x04, 0x0f,
+    0x5b, 0x04, 0x0f, 0x5c, 0x04, 0x0f, 0x21, 0x8f, 0x0f, 0x01, 0x00, 0x3e, 0xa1, 0x0f, 0x5e, 0x04,
+    0x0f, 0x5f, 0x04, 0x0f, 0x60, 0x04, 0x0f, 0xa9, 0x8b, 0x0f, 0x01, 0x00, 0x1d, 0x4a, 0x09, 0x43,
+    0x00, 0x09, 0x6b, 0x7e, 0x0f, 0x33, 0x00, 0x0f, 0x01, 0xc2, 0x93, 0x0f, 0x01, 0x00, 0xff, 0x32,
+    0xa1, 0x0f, 0x6d, 0x04, 0x0f, 0x6e, 0x04, 0x0f, 0x6f, 0x04, 0x0f, 0x64, 0xec, 0x0f, 0x30, 0x00,
+    0x0f, 0xf1, 0x12, 0x71, 0x04, 0x0f, 0x72, 0x04, 0x0f, 0x73, 0x04, 0x0f, 0x74, 0x04, 0x0f, 0x75,
+    0x04, 0x0f, 0x76, 0x04, 0x0f, 0x77, 0x04, 0x0f, 0x78, 0x04, 0x0f, 0x79, 0x04, 0x0f, 0x7a, 0x04,
+    0x0f, 0x7b, 0x04, 0x0f, 0xb9, 0x8d, 0x0f, 0x01, 0x00, 0x59, 0x71, 0x0f, 0x7d, 0x04, 0x0f, 0x7e,
+    0x04, 0x0f, 0x83, 0x93, 0x00, 0x0f, 0x00, 0x31, 0x80, 0x04, 0x0f, 0x89, 0x93, 0x03, 0x0f, 0x00,
+    0x01, 0x89, 0x93, 0x09, 0x30, 0x00, 0x61, 0x83, 0x04, 0x0f, 0x84, 0x04, 0x0f, 0x7f, 0x8e, 0x00,
+    0x0f, 0x00, 0x37, 0x86, 0x04, 0x0f, 0x5a, 0x7a, 0x17, 0x0f, 0x57, 0x7a, 0x03, 0x12, 0x00, 0x64,
+    0x89, 0x04, 0x0f, 0x8a, 0x04, 0x0f, 0xee, 0xec, 0x0f, 0x01, 0x00, 0x6b, 0x11, 0x0f, 0x63, 0x8f,
+    0x11, 0x09, 0xb0, 0x96, 0x0f, 0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0x11, 0x47, 0x0f, 0x8f, 0x04,
+    0x0f, 0x4f, 0x82, 0x0f, 0x01, 0x00, 0xff, 0xb3, 0xf7, 0x0a, 0x0f, 0x91, 0x04, 0x0f, 0x92, 0x04,
+    0x0f, 0x93, 0x04, 0x0f, 0x94, 0x04, 0x0f, 0x95, 0x04, 0x0f, 0x96, 0x04, 0x0f, 0x97, 0x04, 0x0f,
+    0x98, 0x04, 0x09, 0x18, 0x63, 0x0f, 0x48, 0x00, 0x12, 0x31, 0xa1, 0x04, 0x0f, 0x70, 0x8e, 0x23,
+    0x0f, 0xa3, 0x22, 0x02, 0x47, 0x08, 0x56, 0x04, 0x08, 0x58, 0x7c, 0x0f, 0x4b, 0x00, 0x18, 0xf4,
+    0x0f, 0xa4, 0x04, 0x0f, 0xa5, 0x04, 0x0f, 0xa6, 0x04, 0x0f, 0xa7, 0x04, 0x0f, 0xa8, 0x04, 0x0f,
+    0xa9, 0x04, 0x0f, 0xaa, 0x04, 0x0f, 0xab, 0x04, 0x0f, 0xac, 0x04, 0x0f, 0xad, 0x04, 0x0f, 0x3c,
+    0xf3, 0x03, 0x2d, 0x00, 0xff, 0x1f, 0xaf, 0x04, 0x0f, 0xb0, 0x04, 0x0f, 0xb1, 0x04, 0x0f, 0xb2,
+    0x04, 0x0f, 0xb3, 0x04, 0x0f, 0xb4, 0x04, 0x0f, 0xb5, 0x04, 0x0f, 0xb6, 0x04, 0x0f, 0xb7, 0x04,
+    0x0f, 0xb8, 0x04, 0x0f, 0xb9, 0x04, 0x0f, 0xba, 0x04, 0x0f, 0xbb, 0x04, 0x0f, 0xbc, 0x04, 0x0f,
+    0xbd, 0x04, 0x0f, 0xbe, 0xbe, 0x02, 0x33, 0x11, 0x0f, 0x5a, 0xf3, 0x0f, 0x27, 0x00, 0x0f, 0x37,
+    0xc0, 0x04, 0x0f, 0x0d, 0x7f, 0x0f, 0x24, 0x00, 0x03, 0x91, 0xc2, 0x04, 0x0f, 0xc3, 0x04, 0x0f,
+    0xc4, 0x04, 0x0f, 0x81, 0x8f, 0x11, 0x0f, 0x78, 0x8f, 0x77, 0x0f, 0xc7, 0x04, 0x0f, 0xc8, 0x04,
+    0x0f, 0xb7, 0x7a, 0x0f, 0x01, 0x00, 0x20, 0x1a, 0x09, 0xab, 0x89, 0x0f, 0x01, 0x00, 0x1a, 0x17,
+    0x0f, 0xd6, 0x8b, 0x1a, 0x0f, 0xd3, 0x8b, 0x0f, 0x01, 0x00, 0xff, 0x68, 0x11, 0x09, 0x9c, 0x66,
+    0x0b, 0x01, 0x00, 0x4a, 0x0f, 0xd6, 0x04, 0x0f, 0x38, 0x8d, 0x0f, 0x01, 0x00, 0x05, 0x1a, 0x0f,
+    0x50, 0x8d, 0x0f, 0x01, 0x00, 0xd4, 0x1a, 0x0f, 0x73, 0x8e, 0x0f, 0x01, 0x00, 0xa4, 0x41, 0x0f,
+    0xda, 0x04, 0x09, 0x94, 0x68, 0x11, 0x0f, 0xc9, 0x8f, 0x11, 0x0f, 0x2f, 0xf7, 0x0f, 0x01, 0x00,
+    0x32, 0xfa, 0x07, 0x0f, 0xe0, 0x04, 0x0f, 0xe1, 0x04, 0x0f, 0xe2, 0x04, 0x0f, 0xe3, 0x04, 0x0f,
+    0xe4, 0x04, 0x0f, 0xe5, 0x04, 0x0f, 0xe6, 0x04, 0x0f, 0x02, 0x90, 0x0f, 0x48, 0x00, 0x12, 0x31,
+    0xe8, 0x04, 0x0f, 0x56, 0x90, 0x14, 0x0f, 0x4d, 0x90, 0x47, 0x08, 0xc4, 0x04, 0x08, 0x55, 0x94,
+    0x0f, 0x4b, 0x00, 0x18, 0x31, 0xeb, 0x04, 0x0f, 0x09, 0x83, 0xa4, 0x0f, 0xed, 0x04, 0x0f, 0xee,
+    0x04, 0x0f, 0xef, 0x04, 0x0f, 0x90, 0x92, 0x4a, 0x0f, 0xf1, 0x04, 0x0f, 0xd8, 0x92, 0x44, 0x0f,
+    0xf3, 0x04, 0x0f, 0x54, 0x92, 0xfc, 0x59, 0x0f, 0xf5, 0x04, 0x0f, 0xf6, 0x04, 0x0f, 0xf7, 0x04,
+    0x0f, 0xf8, 0x04, 0x0f, 0xf9, 0x04, 0x0f, 0xfa, 0x04, 0x0f, 0xfb, 0x04, 0x0f, 0xfc, 0x04, 0x0f,
+    0xfd, 0x04, 0x0f, 0xfe, 0x04, 0x0f, 0xff, 0x04, 0x0f, 0x00, 0x05, 0x0f, 0x01, 0x05, 0x0f, 0x02,
+    0x05, 0x0f, 0x03, 0x05, 0x0f, 0x04, 0x05, 0x0f, 0x05, 0x05, 0x0f, 0x06, 0x05, 0x0f, 0x07, 0x05,
+    0x0f, 0x08, 0x05, 0x0f, 0x09, 0x05, 0x0f, 0x0a, 0x05, 0x0f, 0x0b, 0x05, 0x0f, 0x0c, 0x05, 0x0f,
+    0x0d, 0x05, 0x0f, 0x0e, 0x05, 0x0f, 0x0f, 0x05, 0x0f, 0x10, 0x05, 0x0f, 0x11, 0x05, 0x09, 0x4f,
+    0x00, 0x09, 0x50, 0x00, 0x09, 0x51, 0x00, 0x0f, 0x1c, 0x05, 0x0f, 0x1d, 0x05, 0x0f, 0x1e, 0xbe,
+    0x74, 0xbf, 0x0f, 0x1f, 0x05, 0x0f, 0x20, 0x05, 0x0f, 0x21, 0x05, 0x0f, 0x22, 0xd9, 0x74, 0x03,
+    0x0f, 0x01, 0x00, 0x08, 0xb9, 0x0f, 0x23, 0x05, 0x0f, 0x24, 0x05, 0x0f, 0x25, 0x05, 0x0f, 0x26,
+    0x3c, 0x00, 0x41, 0x0f, 0x27, 0x05, 0x0f, 0xbe, 0x85, 0x0f, 0x01, 0x00, 0x62, 0x11, 0x0f, 0x43,
+    0xf8, 0x8f, 0x0f, 0x2a, 0x05, 0x0f, 0x2b, 0x05, 0x0f, 0x2c, 0x87, 0x00, 0x09, 0xf1, 0x4f, 0x0f,
+    0x2d, 0x05, 0x0f, 0x2e, 0x05, 0x0f, 0x2f, 0x05, 0x0f, 0x30, 0x05, 0x0f, 0x31, 0x05, 0x0f, 0x32,
+    0x05, 0x0f, 0x33, 0x05, 0x0f, 0x34, 0x05, 0x0f, 0x35, 0x05, 0x0f, 0x36, 0x05, 0x0f, 0x37, 0x05,
+    0x0f, 0x38, 0x05, 0x0f, 0x39, 0x05, 0x0f, 0x3a, 0x05, 0x0f, 0x3b, 0x05, 0x0f, 0x3c, 0x05, 0x0f,
+    0x3d, 0x05, 0x0f, 0x3e, 0x05, 0x0f, 0x3f, 0x05, 0x0f, 0x40, 0x05, 0x0f, 0x41, 0x05, 0x0f, 0x42,
+    0x05, 0x0f, 0x43, 0x05, 0x0f, 0x44, 0x05, 0x0f, 0x45, 0x05, 0x0f, 0x46, 0x05, 0x0f, 0x47, 0x05,
+    0x0f, 0x48, 0x05, 0x0f, 0x49, 0x05, 0x0f, 0x4a, 0x05, 0x0f, 0x4b, 0x05, 0x0f, 0x0e, 0x96, 0xf1,
+    0x19, 0x0f, 0x4d, 0x05, 0x0f, 0x4e, 0x05, 0x0f, 0x4f, 0x05, 0x0f, 0x50, 0x05, 0x0f, 0x51, 0x05,
+    0x0f, 0x52, 0x05, 0x0f, 0x53, 0x05, 0x0f, 0x54, 0x05, 0x0f, 0x55, 0x05, 0x0f, 0x56, 0x05, 0x0f,
+    0x57, 0x05, 0x0f, 0x58, 0x05, 0x0f, 0x59, 0x05, 0x0f, 0x31, 0x82, 0xf1, 0x1f, 0x0f, 0x5b, 0x05,
+    0x0f, 0x5c, 0x05, 0x0f, 0x5d, 0x05, 0x0f, 0x5e, 0x05, 0x0f, 0x5f, 0x05, 0x0f, 0x60, 0x05, 0x0f,
+    0x61, 0x05, 0x0f, 0x62, 0x05, 0x0f, 0x63, 0x05, 0x0f, 0x64, 0x05, 0x0f, 0x65, 0x05, 0x0f, 0x66,
+    0x05, 0x0f, 0x67, 0x05, 0x0f, 0x68, 0x05, 0x0f, 0x69, 0x05, 0x0f, 0xdd, 0xf7, 0x03, 0xc9, 0x00,
+    0x13, 0x6b, 0x0c, 0x00, 0xd1, 0x0f, 0x6c, 0x05, 0x0f, 0x6d, 0x05, 0x0f, 0x6e, 0x05, 0x0f, 0x6f,
+    0x05, 0x0f, 0xe3, 0xf7, 0x71, 0x0f, 0x71, 0x05, 0x0f, 0x72, 0x05, 0x0f, 0x80, 0x84, 0xf4, 0x01,
+    0x0f, 0x74, 0x05, 0x0f, 0x75, 0x05, 0x0f, 0x76, 0x05, 0x0f, 0x77, 0x05, 0x0f, 0x78, 0x05, 0x0f,
+    0x48, 0x86, 0xf7, 0x3d, 0x0f, 0x7a, 0x05, 0x0f, 0x7b, 0x05, 0x0f, 0x7c, 0x05, 0x0f, 0x7d, 0x05,
+    0x0f, 0x7e, 0x05, 0x0f, 0x7f, 0x05, 0x0f, 0x80, 0x05, 0x0f, 0x81, 0x05, 0x0f, 0x82, 0x05, 0x0f,
+    0x83, 0x05, 0x0f, 0x84, 0x05, 0x0f, 0x85, 0x05, 0x0f, 0x86, 0x05, 0x0f, 0x87, 0x05, 0x0f, 0x88,
+    0x05, 0x0f, 0x89, 0x05, 0x0f, 0x8a, 0x05, 0x0f, 0x8b, 0x05, 0x0f, 0x8c, 0x05, 0x0f, 0x8d, 0x05,
+    0x0f, 0x8e, 0x05, 0x0f, 0x8f, 0x05, 0x0f, 0x90, 0x05, 0x0f, 0x91, 0x05, 0x0f, 0x92, 0x05, 0x0f,
+    0xfb, 0x81, 0x71, 0x0f, 0x94, 0x05, 0x0f, 0x95, 0x05, 0x0f, 0x38, 0x84, 0x11, 0x09, 0x62, 0x8d,
+    0x11, 0x0a, 0x45, 0x8c, 0x06, 0x21, 0x00, 0x91, 0x99, 0x05, 0x0f, 0x9a, 0x05, 0x0f, 0x9b, 0x05,
+    0x0f, 0x0c, 0xcb, 0x06, 0x18, 0x00, 0x67, 0x9d, 0x05, 0x0f, 0x9e, 0x05, 0x0f, 0x33, 0x86, 0x11,
+    0x0f, 0x15, 0xcb, 0x0f, 0x01, 0x00, 0x35, 0x47, 0x0f, 0xa1, 0x05, 0x0f, 0x81, 0x86, 0x0f, 0x3c,
+    0x00, 0x1b, 0x01, 0xab, 0x86, 0x20, 0x0f, 0xa4, 0x06, 0x00, 0xa1, 0x0a, 0x36, 0x00, 0x0a, 0x37,
+    0x00, 0x0a, 0x38, 0x00, 0x0a, 0xbf, 0x87, 0x00, 0x18, 0x00, 0xf1, 0x0c, 0xa9, 0x05, 0x0f, 0xaa,
+    0x05, 0x0f, 0xab, 0x05, 0x08, 0x2d, 0x06, 0x0f, 0xac, 0x05, 0x08, 0x30, 0x06, 0x0f, 0xad, 0x05,
+    0x08, 0x33, 0x06, 0x0f, 0xae, 0x05, 0x08, 0x41, 0xc9, 0x0c, 0x4e, 0x00, 0xf1, 0x12, 0xaf, 0x05,
+    0x0f, 0xb0, 0x05, 0x0f, 0xb1, 0x05, 0x08, 0x3d, 0x06, 0x0f, 0xb2, 0x05, 0x08, 0x40, 0x06, 0x0f,
+    0xb3, 0x05, 0x08, 0x43, 0x06, 0x0f, 0xb4, 0x05, 0x08, 0x46, 0x06, 0x0f, 0xb5, 0x05, 0x0f, 0x64,
+    0xf8, 0x00, 0x2a, 0x00, 0xf1, 0x12, 0xb7, 0x05, 0x0f, 0xb8, 0x05, 0x0f, 0xb9, 0x05, 0x0f, 0xba,
+    0x05, 0x0f, 0xbb, 0x05, 0x08, 0x55, 0x06, 0x0f, 0xbc, 0x05, 0x08, 0x58, 0x06, 0x0f, 0xbd, 0x05,
+    0x08, 0x5b, 0x06, 0x0f, 0xbe, 0x05, 0x08, 0xa8, 0xd4, 0x0f, 0xc9, 0x00, 0x18, 0x1f, 0xbf, 0x02,
+    0x01, 0x0f, 0xd1, 0x0f, 0xc0, 0x05, 0x0f, 0xc1, 0x05, 0x0f, 0xc2, 0x05, 0x0f, 0xc3, 0x05, 0x0f,
+    0xa6, 0xf8, 0x0f, 0x01, 0x00, 0x2f, 0x2f, 0x0f, 0xc5, 0x48, 0x00, 0x06, 0x71, 0x0f, 0xc6, 0x05,
+    0x0f, 0xc7, 0x05, 0x0f, 0x8e, 0xd3, 0x81, 0x0f, 0xc9, 0x05, 0x0f, 0xca, 0x05, 0x0f, 0xcb, 0x0c,
+    0x00, 0xfa, 0x07, 0xcc, 0x05, 0x0f, 0xcd, 0x05, 0x08, 0x79, 0x06, 0x08, 0x7a, 0x06, 0x0f, 0xce,
+    0x05, 0x0f, 0xcf, 0x05, 0x0f, 0xd0, 0x05, 0x0f, 0xd1, 0x34, 0x02, 0xf7, 0x01, 0xd2, 0x05, 0x0f,
+    0xd3, 0x05, 0x0f, 0xd4, 0x05, 0x0f, 0xd5, 0x05, 0x0f, 0xd6, 0x05, 0x0f, 0xd7, 0x3d, 0x02, 0x01,
+    0x06, 0xf9, 0x01, 0x50, 0x07, 0x57, 0x05, 0x0f, 0xda, 0x05, 0x0f, 0xf7, 0x85, 0x0f, 0x01, 0x00,
+    0x0b, 0xba, 0x0f, 0xdc, 0x05, 0x0f, 0xdd, 0x05, 0x0f, 0xde, 0x05, 0x0f, 0xdf, 0x6c, 0x00, 0x4a,
+    0xe0, 0x05, 0x0f, 0xe1, 0x12, 0x00, 0x01, 0x3c, 0xf9, 0x71, 0x0f, 0xe3, 0x05, 0x0f, 0xe4, 0x05,
+    0x0f, 0xe3, 0xcc, 0x11, 0x0f, 0xe3, 0xcc, 0x21, 0x0f, 0xe7, 0x06, 0x00, 0xc4, 0xe8, 0x05, 0x0f,
+    0xe9, 0x05, 0x0f, 0xea, 0x05, 0x0f, 0xeb, 0x05, 0x0f, 0xe1, 0x8f, 0x0f, 0x84, 0x00, 0x15, 0xfa,
+    0x07, 0xed, 0x05, 0x0f, 0xee, 0x05, 0x0f, 0xef, 0x05, 0x0f, 0xf0, 0x05, 0x0f, 0xf1, 0x05, 0x0f,
+    0xf2, 0x05, 0x0f, 0xf3, 0x05, 0x0f, 0xf4, 0x7e, 0x00, 0xff, 0x07, 0xf5, 0x05, 0x0f, 0xf6, 0x05,
+    0x08, 0xba, 0x06, 0x08, 0xbb, 0x06, 0x0f, 0xf7, 0x05, 0x0f, 0xf8, 0x05, 0x08, 0xc0, 0x06, 0x08,
+    0xc1, 0x10, 0x02, 0x06, 0xff, 0x08, 0x0f, 0xf9, 0x05, 0x0f, 0xfa, 0x05, 0x08, 0xc6, 0x06, 0x08,
+    0xc7, 0x06, 0x0f, 0xfb, 0x05, 0x0f, 0xfc, 0x05, 0x08, 0xcc, 0x06, 0x08, 0xcd, 0x40, 0x02, 0x1b,
+    0x0f, 0x01, 0x00, 0xaa, 0x5f, 0x0f, 0xfd, 0x05, 0x0f, 0xfe, 0x89, 0x01, 0x1c, 0x01, 0x98, 0xfa,
+    0x0f, 0x01, 0x00, 0x7a, 0x74, 0x08, 0xd3, 0x06, 0x08, 0xd4, 0x06, 0x0f, 0x2b, 0xfb, 0x00, 0xa5,
+    0x00, 0x04, 0xdb, 0x81, 0x0f, 0x01, 0x00, 0x20, 0x11, 0x06, 0x16, 0xa9, 0x41, 0x06, 0x03, 0x01,
+    0x06, 0x1d, 0x8d, 0x0f, 0x01, 0x00, 0x53, 0x89, 0x08, 0xdf, 0x06, 0x08, 0xe0, 0x06, 0x08, 0xe1,
+    0xb7, 0x00, 0xff, 0x08, 0x08, 0xe2, 0x06, 0x08, 0xe3, 0x06, 0x08, 0xe4, 0x06, 0x0f, 0x02, 0x06,
+    0x08, 0xe7, 0x06, 0x08, 0xe8, 0x06, 0x08, 0xe9, 0x06, 0x08, 0xea, 0xe0, 0x04, 0x1c, 0x32, 0x03,
+    0x06, 0x0f, 0xc5, 0x86, 0x0f, 0x2d, 0x00, 0x11, 0x31, 0x05, 0x06, 0x0f, 0x54, 0xfc, 0x0f, 0x01,
+    0x00, 0x74, 0x1d, 0x09, 0x82, 0x94, 0x08, 0x01, 0x00, 0x27, 0x0f, 0x09, 0xf2, 0x01, 0x4a, 0x0a,
+    0x06, 0x0f, 0x0b, 0x3e, 0x01, 0x1f, 0xf7, 0xc9, 0x00, 0x57, 0x11, 0x0f, 0x65, 0xfd, 0x0f, 0x01,
+    0x00, 0xff, 0x17, 0x1a, 0x0a, 0xca, 0x91, 0x5f, 0x0f, 0x0e, 0x06, 0x0f, 0x0f, 0x41, 0x01, 0x0c,
+    0x11, 0x0f, 0xb5, 0xfe, 0x2f, 0x0f, 0x11, 0x68, 0x01, 0x27, 0x12, 0x0f, 0xc1, 0xcb, 0x0f, 0x01,
+    0x00, 0xa0, 0x44, 0x0f, 0x13, 0x06, 0x0f, 0xa2, 0xff, 0x0f, 0x01, 0x00, 0xb0, 0x21, 0x0f, 0x15,
+    0xcb, 0x01, 0x1f, 0x16, 0xd2, 0x00, 0x36, 0x8f, 0x08, 0x0b, 0x07, 0x08, 0x0c, 0x07, 0x0f, 0x17,
+    0x51, 0x00, 0x33, 0x21, 0x06, 0x0f, 0x00, 0x06, 0x4f, 0x10, 0x01, 0x06, 0x11, 0x00, 0x06, 0x58,
+    0x1f, 0x15, 0xe3, 0x82, 0x00, 0x81, 0x08, 0x16, 0x07, 0x08, 0x17, 0x07, 0x08, 0x18, 0xed, 0x7e,
+    0xaf, 0x19, 0x07, 0x08, 0x1a, 0x07, 0x08, 0x1b, 0x07, 0x08, 0x1c, 0xba, 0x87, 0x12, 0x08, 0x01,
+    0x00, 0x2f, 0x0f, 0x18, 0x88, 0x83, 0x10, 0x4f, 0x19, 0x06, 0x0f, 0x1a, 0x41, 0x01, 0x2a, 0x5f,
+    0x0f, 0x1b, 0x06, 0x0f, 0x1c, 0xa6, 0x02, 0x3c, 0x11, 0x09, 0xa8, 0xb3, 0x0f, 0x01, 0x00, 0x11,
+    0x2c, 0x0f, 0x1f, 0x7b, 0x00, 0x2f, 0x08, 0x2a, 0x29, 0x01, 0x15, 0x2f, 0x0f, 0x20, 0xb7, 0x00,
+    0x2d, 0x2f, 0x0f, 0x21, 0x42, 0x00, 0x09, 0x2f, 0x0f, 0x22, 0x1e, 0x06, 0xf6, 0x11, 0x0a, 0xdb,
+    0x95, 0x1a, 0x0a, 0xac, 0x97, 0x4a, 0x0f, 0x25, 0x06, 0x0f, 0x68, 0x9f, 0x0e, 0x01, 0x00, 0x11,
+    0x0f, 0x7a, 0x9f, 0x1a, 0x0f, 0xad, 0x9f, 0x0f, 0x01, 0x00, 0xd4, 0x1a, 0x0f, 0x94, 0xa0, 0x0f,
+    0x01, 0x00, 0xad, 0x7a, 0x0f, 0x2a, 0x06, 0x0f, 0x2b, 0x06, 0x0f, 0x3c, 0xa1, 0x0f, 0x01, 0x00,
+    0xff, 0xff, 0xcb, 0x1a, 0x0f, 0x18, 0xa4, 0x0f, 0x01, 0x00, 0x21, 0x21, 0x81, 0x23, 0xff, 0x9f,
+    0x11, 0x24, 0xd3, 0x06, 0x30, 0x80, 0x0e, 0x07, 0x03, 0x00, 0x20, 0x0d, 0x07, 0x5f, 0xda, 0x10,
+    0x5f, 0x96, 0xb8, 0x50, 0x80, 0xd3, 0x05, 0x80, 0xd4, 0x98, 0x0f, 0x41, 0x80, 0x25, 0x05, 0x80,
+    0x85, 0x16, 0x02, 0x9a, 0x91, 0x00, 0x12, 0x00, 0xf1, 0x3d, 0x54, 0x02, 0x80, 0x4a, 0x02, 0x80,
+    0x4b, 0x02, 0x80, 0x55, 0x02, 0x80, 0x4c, 0x02, 0x80, 0x4d, 0x02, 0x80, 0x56, 0x02, 0x80, 0x4e,
+    0x02, 0x80, 0x4f, 0x02, 0x80, 0x13, 0x04, 0x80, 0x0d, 0x04, 0x80, 0x0e, 0x04, 0x80, 0x14, 0x04,
+    0x80, 0x0f, 0x04, 0x80, 0x10, 0x04, 0x80, 0x15, 0x04, 0x80, 0x11, 0x04, 0x80, 0x12, 0x04, 0x80,
+    0xb6, 0x00, 0x80, 0x57, 0x01, 0x10, 0xf1, 0x04, 0x80, 0x56, 0x01, 0x80, 0xb7, 0x00, 0x10, 0xf2,
+    0x04, 0x80, 0xd5, 0x05, 0x80, 0xd7, 0x03, 0x00, 0x41, 0xd5, 0x05, 0x80, 0xd6, 0x6c, 0x00, 0x41,
+    0x29, 0x05, 0x80, 0x2b, 0x03, 0x00, 0x41, 0x29, 0x05, 0x80, 0x2a, 0x12, 0x00, 0xf0, 0x80, 0x8b,
+    0x03, 0x80, 0x79, 0x03, 0x80, 0x84, 0x03, 0x80, 0x8c, 0x03, 0x80, 0x7a, 0x03, 0x80, 0x85, 0x03,
+    0x80, 0x8d, 0x03, 0x80, 0x7b, 0x03, 0x80, 0x86, 0x03, 0x80, 0x0a, 0x01, 0x80, 0x00, 0x01, 0x80,
+    0x05, 0x01, 0x80, 0x0b, 0x01, 0x80, 0x01, 0x01, 0x80, 0x06, 0x01, 0x80, 0x0c, 0x01, 0x80, 0x02,
+    0x01, 0x80, 0x07, 0x01, 0x80, 0xe6, 0x06, 0x80, 0xe0, 0x06, 0x80, 0xe3, 0x06, 0x80, 0xe7, 0x06,
+    0x80, 0xe1, 0x06, 0x80, 0xe4, 0x06, 0x80, 0xe8, 0x06, 0x80, 0xe2, 0x06, 0x80, 0xe5, 0x06, 0x80,
+    0xe3, 0x02, 0x80, 0xdd, 0x02, 0x80, 0xe0, 0x02, 0x80, 0xe4, 0x02, 0x80, 0xde, 0x02, 0x80, 0xe1,
+    0x02, 0x80, 0xe5, 0x02, 0x80, 0xdf, 0x02, 0x80, 0xe2, 0x02, 0x80, 0x5e, 0x06, 0x80, 0x58, 0x06,
+    0x80, 0x5b, 0x06, 0x80, 0x5f, 0x06, 0x80, 0x59, 0x06, 0x80, 0x5c, 0x06, 0x80, 0x60, 0x06, 0x80,
+    0x5a, 0x06, 0x80, 0x5d, 0x06, 0x80, 0x65, 0x02, 0x80, 0x66, 0x02, 0x80, 0x67, 0x02, 0x5c, 0xb6,
+    0x11, 0xd3, 0x03, 0x00, 0x41, 0xe5, 0x01, 0x81, 0xe6, 0x03, 0x00, 0x11, 0xee, 0xef, 0xb6, 0x70,
+    0xef, 0x01, 0x81, 0xe2, 0x01, 0x81, 0xe3, 0x03, 0x00, 0x51, 0x83, 0x3b, 0x02, 0x83, 0x3c, 0x03,
+    0x00, 0x40, 0x05, 0x04, 0x83, 0x06, 0x03, 0x00, 0x51, 0x80, 0x3e, 0x02, 0x80, 0x3f, 0x03, 0x00,
+    0x40, 0x08, 0x04, 0x80, 0x09, 0x03, 0x00, 0x04, 0x85, 0x01, 0x20, 0xe3, 0x03, 0xec, 0xe7, 0x20,
+    0xe3, 0x03, 0xec, 0xe7, 0x11, 0xe4, 0x0c, 0x00, 0x20, 0xdd, 0x03, 0x5c, 0xea, 0x22, 0xde, 0x03,
+    0x7b, 0xbf, 0x03, 0x01, 0x00, 0x0f, 0xc2, 0x85, 0x13, 0x0f, 0x01, 0x00, 0x1f, 0x3f, 0x50, 0x20,
+    0x04, 0x5b, 0x00, 0x02, 0x22, 0x30, 0x90, 0x73, 0x00, 0x13, 0x38, 0x08, 0x00, 0x13, 0xa0, 0x08,
+    0x00, 0x05, 0x49, 0x84, 0x1f, 0x45, 0xd3, 0x6f, 0x73, 0x13, 0x40, 0x98, 0x00, 0x13, 0x48, 0x08,
+    0x00, 0x13, 0x50, 0x08, 0x00, 0x13, 0x58, 0x08, 0x00, 0x08, 0x01, 0x00, 0x31, 0x0e, 0x82, 0xcc,
+    0xc6, 0xbf, 0x00, 0x17, 0x62, 0x00, 0xc7, 0x20, 0x51, 0x08, 0x13, 0x04, 0x00, 0x08, 0xae, 0xb9,
+    0x06, 0x1c, 0x00, 0x00, 0x7a, 0x97, 0x00, 0xc6, 0x9f, 0x53, 0x54, 0x13, 0x04, 0x00, 0x54, 0x1c,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x65, 0x85, 0x80, 0x02, 0x80, 0x02, 0x80, 0x98, 0x12, 0x04, 0x00,
+    0x71, 0xbd, 0x31, 0xf0, 0x12, 0x04, 0x14, 0x00, 0xf2, 0x03, 0x7f, 0x10, 0x00, 0x00, 0x31, 0x37,
+    0x00, 0x00, 0x9e, 0x37, 0x00, 0x00, 0xd2, 0x37, 0x00, 0x00, 0xeb, 0x37, 0x60, 0xbf, 0x50, 0x87,
+    0x3f, 0x00, 0x00, 0x90, 0x30, 0xbe, 0xf0, 0x25, 0x57, 0x00, 0x00, 0x1a, 0x57, 0x00, 0x00, 0x3e,
+    0x57, 0x00, 0x00, 0x58, 0x57, 0x00, 0x00, 0xb4, 0x57, 0x00, 0x00, 0xd0, 0x57, 0x00, 0x00, 0x67,
+    0x5b, 0x00, 0x00, 0x88, 0x5b, 0x00, 0x00, 0xe1, 0x60, 0x00, 0x00, 0x02, 0x61, 0x00, 0x00, 0x67,
+    0x65, 0x00, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x42, 0x84, 0x00, 0x00, 0xc1, 0xbe, 0xbf, 0xd0, 0x10,
+    0x00, 0x00, 0xb0, 0x2b, 0x00, 0x00, 0x2c, 0x3d, 0x00, 0x00, 0xe4, 0x33, 0x41, 0x99, 0xf1, 0x0a,
+    0x00, 0x00, 0x5f, 0x0d, 0x00, 0x00, 0x52, 0x53, 0x44, 0x53, 0x2b, 0x19, 0x80, 0xca, 0x20, 0xc5,
+    0x11, 0x47, 0xa7, 0x72, 0x58, 0xba, 0xb8, 0xec, 0x38, 0x80, 0xa4, 0xf7, 0x14, 0x4d, 0x3a, 0x5c,
+    0x74, 0x65, 0x73, 0x74, 0x5f, 0x72, 0x65, 0x70, 0x6f, 0x5c, 0x77, 0x69, 0x6e, 0x5f, 0x64, 0x72,
+    0x69, 0x76, 0x65, 0x72, 0x5c, 0x78, 0x36, 0x34, 0x5c, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65,
+    0x17, 0x00, 0xa0, 0x2e, 0x70, 0x64, 0x62, 0x00, 0x00, 0x47, 0x43, 0x54, 0x4c, 0x68, 0x00, 0xb1,
+    0x80, 0x62, 0x00, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x24, 0x6d, 0xd4, 0xc0, 0x40, 0x80, 0x72,
+    0x00, 0x00, 0xb2, 0xa9, 0x04, 0x14, 0x00, 0xa7, 0x24, 0x30, 0x30, 0x00, 0xc0, 0x72, 0x00, 0x00,
+    0xc0, 0x04, 0x14, 0x00, 0x21, 0x32, 0x31, 0x94, 0x00, 0x24, 0x80, 0x0c, 0x14, 0x00, 0x60, 0x73,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0xd0, 0xd5, 0x02, 0x10, 0x00, 0x60, 0x78, 0x00, 0x00, 0x90, 0x00,
+    0x00, 0xd8, 0x8a, 0x71, 0x2e, 0x69, 0x64, 0x61, 0x74, 0x61, 0x24, 0xa1, 0x18, 0x14, 0x30, 0x14,
+    0x00, 0x91, 0x30, 0x30, 0x63, 0x66, 0x67, 0x00, 0x00, 0x60, 0x90, 0x9c, 0x8e, 0x81, 0x00, 0x2e,
+    0x43, 0x52, 0x54, 0x24, 0x58, 0x43, 0x56, 0xbf, 0x1a, 0x68, 0x14, 0x00, 0x01, 0xec, 0xbe, 0x19,
+    0x70, 0x14, 0x00, 0x11, 0x49, 0x28, 0x00, 0x1a, 0x78, 0x14, 0x00, 0x01, 0x28, 0x00, 0x19, 0x80,
+    0x14, 0x00, 0x11, 0x50, 0x28, 0x00, 0x1a, 0x88, 0x14, 0x00, 0x01, 0x28, 0x00, 0x19, 0x90, 0x14,
+    0x00, 0x11, 0x54, 0x28, 0x00, 0x1a, 0x98, 0x14, 0x00, 0x01, 0x28, 0x00, 0x40, 0xa0, 0x90, 0x00,
+    0x00, 0x59, 0x83, 0xf0, 0x03, 0x2e, 0x67, 0x66, 0x69, 0x64, 0x73, 0x00, 0x00, 0x20, 0x91, 0x00,
+    0x00, 0x60, 0x81, 0x03, 0x00, 0x2e, 0x72, 0xd4, 0x00, 0x70, 0x00, 0x00, 0x80, 0x12, 0x04, 0x00,
+    0x88, 0x20, 0x00, 0x01, 0x10, 0x00, 0x60, 0x24, 0x76, 0x6f, 0x6c, 0x74, 0x6d, 0xed, 0xbd, 0x00,
+    0x5c, 0x02, 0x00, 0x22, 0x6e, 0x03, 0x18, 0x00, 0x50, 0x7a, 0x7a, 0x7a, 0x64, 0x62, 0x47, 0xa6,
+    0xa2, 0xa8, 0x15, 0x04, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x2e, 0x78, 0x40, 0x00, 0x50, 0xa0, 0x1d,
+    0x04, 0x00, 0xe4, 0x40, 0x00, 0x01, 0x10, 0x00, 0x00, 0x35, 0x01, 0x50, 0x00, 0x00, 0x00, 0x20,
+    0x04, 0x3b, 0x01, 0x22, 0x00, 0x2e, 0x23, 0x00, 0x64, 0x00, 0x90, 0x20, 0x04, 0x00, 0xb0, 0x10,
+    0x00, 0x80, 0x24, 0x72, 0x00, 0x40, 0x21, 0x04, 0x00, 0x48, 0x5c, 0x00, 0x21, 0x62, 0x73, 0x12,
+    0xc2, 0xa3, 0x00, 0x30, 0x04, 0x00, 0x88, 0x05, 0x00, 0x00, 0x2e, 0x70, 0x31, 0x00, 0x30, 0x40,
+    0x04, 0x00, 0x33, 0x88, 0x03, 0x78, 0x01, 0x01, 0xd6, 0xac, 0x1a, 0x14, 0x14, 0x00, 0x01, 0xdb,
+    0xac, 0x38, 0x28, 0x40, 0x04, 0xa0, 0x01, 0x01, 0x95, 0xa6, 0x40, 0x58, 0x40, 0x04, 0x00, 0x3d,
+    0xbf, 0x03, 0x14, 0x00, 0x07, 0x1b, 0xa4, 0x0f, 0x01, 0x00, 0x13, 0xf3, 0x0f, 0x01, 0x05, 0x02,
+    0x00, 0x05, 0x34, 0x01, 0x00, 0x01, 0x15, 0x09, 0x00, 0x15, 0xe4, 0x05, 0x00, 0x15, 0x74, 0x04,
+    0x00, 0x15, 0x64, 0x03, 0x00, 0x15, 0x34, 0x02, 0x00, 0x15, 0xf0, 0x20, 0x00, 0xf3, 0x12, 0x74,
+    0x01, 0x00, 0x01, 0x06, 0x02, 0x00, 0x06, 0x32, 0x02, 0x30, 0x01, 0x0f, 0x06, 0x00, 0x0f, 0x64,
+    0x08, 0x00, 0x0f, 0x34, 0x06, 0x00, 0x0f, 0x32, 0x0b, 0x70, 0x01, 0x0a, 0x04, 0x00, 0x0a, 0x64,
+    0x44, 0x00, 0xf4, 0x01, 0x13, 0x08, 0x00, 0x13, 0x74, 0x04, 0x00, 0x0f, 0x64, 0x03, 0x00, 0x0b,
+    0x54, 0x02, 0x00, 0x07, 0x14, 0x00, 0x93, 0xf4, 0x04, 0x00, 0x0f, 0xe4, 0x03, 0x00, 0x0b, 0x74,
+    0x14, 0x00, 0xfb, 0x61, 0x12, 0x08, 0x00, 0x12, 0x54, 0x0c, 0x00, 0x12, 0x34, 0x0b, 0x00, 0x12,
+    0x52, 0x0e, 0xc0, 0x0c, 0x70, 0x0b, 0x60, 0x01, 0x1b, 0x0a, 0x00, 0x1b, 0x74, 0x0b, 0x00, 0x1b,
+    0x64, 0x0a, 0x00, 0x1b, 0x34, 0x08, 0x00, 0x1b, 0x32, 0x14, 0xf0, 0x12, 0xe0, 0x10, 0x50, 0x01,
+    0x04, 0x01, 0x00, 0x04, 0x42, 0x00, 0x00, 0x01, 0x18, 0x0b, 0x00, 0x18, 0x64, 0x09, 0x00, 0x18,
+    0x54, 0x08, 0x00, 0x18, 0x34, 0x07, 0x00, 0x18, 0xf0, 0x16, 0xe0, 0x14, 0xd0, 0x12, 0xc0, 0x10,
+    0x70, 0x00, 0x00, 0x01, 0x14, 0x0a, 0x00, 0x14, 0x34, 0x0e, 0x00, 0x14, 0x52, 0x10, 0xf0, 0x0e,
+    0xe0, 0x0c, 0xd0, 0x0a, 0xc0, 0x08, 0x70, 0x07, 0x60, 0x06, 0x50, 0x01, 0x17, 0x0a, 0x00, 0x17,
+    0x34, 0x0e, 0x00, 0x17, 0x18, 0x00, 0x80, 0x19, 0x18, 0x02, 0x00, 0x09, 0xf2, 0x02, 0x30, 0x39,
+    0x01, 0x01, 0xb5, 0xc3, 0x00, 0x45, 0xa3, 0xf3, 0x19, 0x2f, 0x11, 0x00, 0x2f, 0x01, 0x1a, 0x00,
+    0x28, 0x02, 0x27, 0x02, 0x26, 0x02, 0x25, 0x02, 0x24, 0x02, 0x22, 0x02, 0x20, 0x02, 0x1e, 0x02,
+    0x1c, 0x12, 0x18, 0x02, 0x16, 0x02, 0x13, 0x02, 0x12, 0x02, 0x10, 0x02, 0x0d, 0x52, 0x00, 0x00,
+    0x34, 0x50, 0x25, 0xf0, 0x0a, 0x19, 0x00, 0x1f, 0x00, 0x00, 0xf8, 0x0c, 0x00, 0x00, 0xe8, 0x0a,
+    0x00, 0x00, 0xd8, 0x09, 0x00, 0x00, 0xc8, 0x08, 0x00, 0x00, 0xb8, 0x07, 0x00, 0x00, 0xc4, 0xe1,
+    0x00, 0x78, 0x93, 0x00, 0x2f, 0x2c, 0xa0, 0x78, 0x03, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x01,
+    0x1a, 0x45, 0x03, 0xf8, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xe0,
+    0x00, 0xf0, 0x00, 0x0a, 0x4c, 0x00, 0x71, 0x02, 0x00, 0x00, 0x32, 0x00, 0x0a, 0x04, 0x5c, 0xc2,
+    0x06, 0x10, 0x00, 0x06, 0x20, 0x00, 0x28, 0x01, 0x00, 0x30, 0x00, 0x80, 0x02, 0x06, 0x04, 0x00,
+    0x02, 0x16, 0x00, 0x06, 0x90, 0x01, 0xf0, 0x04, 0x02, 0x14, 0x0a, 0x00, 0x02, 0x06, 0x9a, 0x06,
+    0x14, 0x64, 0x0a, 0x00, 0x14, 0x54, 0x09, 0x00, 0x14, 0x34, 0x08, 0x08, 0x01, 0x41, 0x70, 0x02,
+    0x0a, 0x06, 0x24, 0x00, 0xf0, 0x05, 0x0a, 0x34, 0x06, 0x00, 0x0a, 0x32, 0x06, 0x70, 0x1a, 0x04,
+    0x05, 0x00, 0x01, 0x06, 0x07, 0x06, 0x14, 0x06, 0x00, 0x06, 0x50, 0x01, 0xf3, 0x02, 0xa8, 0x55,
+    0x00, 0x00, 0xa8, 0x17, 0x04, 0x00, 0x60, 0xad, 0x17, 0x04, 0x00, 0x02, 0x3a, 0x00, 0x02, 0x68,
+    0x01, 0x01, 0x08, 0x00, 0xf0, 0x08, 0x62, 0x00, 0x00, 0x02, 0x07, 0x04, 0x00, 0x01, 0x06, 0x3d,
+    0x06, 0x07, 0x01, 0x13, 0x00, 0x02, 0x09, 0x04, 0x00, 0x02, 0x06, 0x45, 0x06, 0x34, 0x01, 0x02,
+    0x18, 0x00, 0xf6, 0x11, 0x44, 0x06, 0x07, 0x01, 0x11, 0x00, 0x02, 0x23, 0x10, 0x00, 0x0a, 0x16,
+    0x00, 0x06, 0x23, 0x68, 0x02, 0x00, 0x1c, 0x64, 0x0e, 0x00, 0x1c, 0x54, 0x0d, 0x00, 0x1c, 0x34,
+    0x0c, 0x00, 0x1c, 0x52, 0x9e, 0x01, 0x01, 0xa0, 0x00, 0xf2, 0x04, 0x16, 0x00, 0x06, 0x14, 0x64,
+    0x08, 0x00, 0x14, 0x54, 0x07, 0x00, 0x14, 0x34, 0x06, 0x00, 0x14, 0x32, 0x10, 0x70, 0x48, 0x00,
+    0x11, 0x3a, 0x48, 0x00, 0xf0, 0x0d, 0x1a, 0x19, 0x0c, 0x00, 0x03, 0x16, 0x00, 0x06, 0x19, 0x74,
+    0x0b, 0x00, 0x19, 0x64, 0x0a, 0x00, 0x19, 0x54, 0x09, 0x00, 0x19, 0x34, 0x08, 0x00, 0x19, 0x52,
+    0x15, 0xe0, 0xa8, 0x00, 0xa2, 0x50, 0x18, 0x04, 0x00, 0x60, 0x55, 0x18, 0x04, 0x00, 0x02, 0x08,
+    0x6a, 0x10, 0x1a, 0x3c, 0x00, 0x21, 0x16, 0x00, 0x3c, 0x00, 0x00, 0x20, 0x00, 0x10, 0x70, 0x20,
+    0x00, 0x10, 0x75, 0x20, 0x00, 0x50, 0xa2, 0x00, 0x02, 0x1f, 0x0d, 0xf7, 0x98, 0xf2, 0x02, 0x06,
+    0x1f, 0x74, 0x24, 0x00, 0x1f, 0x64, 0x23, 0x00, 0x1f, 0x34, 0x22, 0x00, 0x1f, 0x01, 0x1e, 0x00,
+    0x4e, 0x02, 0x51, 0x00, 0x00, 0x1a, 0x04, 0x03, 0x3c, 0x00, 0x04, 0x04, 0x01, 0x10, 0xac, 0x3c,
+    0x00, 0x10, 0xb1, 0x3c, 0x00, 0xf7, 0x04, 0x48, 0x00, 0x02, 0x0d, 0x06, 0x00, 0x02, 0x06, 0xdc,
+    0x06, 0x0d, 0x34, 0x12, 0x00, 0x0d, 0xf2, 0x06, 0x70, 0x02, 0x2c, 0x00, 0x22, 0x02, 0x05, 0x74,
+    0x00, 0x00, 0xe8, 0x02, 0x0c, 0x80, 0x00, 0x10, 0xf0, 0x44, 0x00, 0x10, 0xf5, 0x44, 0x00, 0x51,
+    0xac, 0x00, 0x02, 0x0f, 0x08, 0x1c, 0x00, 0x35, 0x0f, 0x74, 0x03, 0x18, 0x03, 0x31, 0x02, 0x13,
+    0x09, 0x04, 0x01, 0xf5, 0x0c, 0x13, 0x64, 0x1f, 0x00, 0x13, 0x34, 0x1e, 0x00, 0x13, 0x01, 0x1c,
+    0x00, 0x0c, 0x70, 0x00, 0x00, 0x1a, 0x0f, 0x08, 0x00, 0x02, 0x06, 0x67, 0x06, 0x0f, 0x64, 0x07,
+    0x50, 0x03, 0x00, 0x50, 0x00, 0xf1, 0x08, 0x40, 0x19, 0x04, 0x00, 0x68, 0x49, 0x19, 0x04, 0x00,
+    0x4f, 0x19, 0x04, 0x00, 0x02, 0x0e, 0x14, 0x42, 0x00, 0x00, 0x04, 0x4d, 0x03, 0x02, 0x08, 0x8c,
+    0xf0, 0x0d, 0x1a, 0x25, 0x0d, 0x00, 0x0c, 0x16, 0x00, 0x06, 0x25, 0x34, 0x1b, 0x00, 0x25, 0x01,
+    0x12, 0x00, 0x1a, 0xf0, 0x18, 0xe0, 0x16, 0xd0, 0x14, 0xc0, 0x12, 0x70, 0x11, 0x60, 0xe0, 0x00,
+    0x00, 0x40, 0x00, 0x60, 0x80, 0x19, 0x04, 0x00, 0x60, 0x85, 0x3c, 0x00, 0x02, 0x43, 0xad, 0x22,
+    0x02, 0x21, 0x34, 0x00, 0xf0, 0x07, 0x21, 0x34, 0x1a, 0x00, 0x21, 0x01, 0x12, 0x00, 0x15, 0xf0,
+    0x13, 0xe0, 0x11, 0xd0, 0x0f, 0xc0, 0x0d, 0x70, 0x0c, 0x60, 0x0b, 0x50, 0xf4, 0x01, 0x00, 0x1c,
+    0x02, 0x30, 0x05, 0x06, 0x0a, 0x1c, 0x02, 0x00, 0xfc, 0x01, 0x00, 0xec, 0x03, 0x43, 0x52, 0x02,
+    0x30, 0x12, 0x0c, 0x02, 0x00, 0x54, 0x00, 0xa0, 0xd4, 0x19, 0x04, 0x00, 0x28, 0xdd, 0x19, 0x04,
+    0x00, 0xe4, 0x58, 0x00, 0x91, 0x0a, 0x7c, 0x3d, 0x00, 0x00, 0x40, 0x02, 0x24, 0x02, 0xf0, 0x00,
+    0x00, 0xdc, 0x00, 0x08, 0xc4, 0x00, 0x87, 0x02, 0x12, 0x0a, 0x00, 0x05, 0x06, 0x29, 0x06, 0xe4,
+    0x03, 0x10, 0xe0, 0xe4, 0x03, 0x00, 0x30, 0x02, 0xf1, 0x0b, 0x06, 0x06, 0x81, 0x06, 0x23, 0x78,
+    0x04, 0x00, 0x1c, 0x68, 0x05, 0x00, 0x18, 0x64, 0x12, 0x00, 0x18, 0x54, 0x11, 0x00, 0x18, 0x34,
+    0x10, 0x00, 0x18, 0xb2, 0xa2, 0x01, 0xd0, 0x70, 0x02, 0x13, 0x0a, 0x00, 0x01, 0x06, 0x09, 0x06,
+    0x13, 0xe4, 0x04, 0x00, 0x44, 0x01, 0x22, 0x0b, 0x64, 0x34, 0x04, 0x31, 0x02, 0x15, 0x0a, 0x24,
+    0x02, 0xf0, 0x01, 0x15, 0x74, 0x0a, 0x00, 0x15, 0x64, 0x09, 0x00, 0x15, 0x34, 0x08, 0x00, 0x15,
+    0x52, 0x11, 0xe0, 0x0c, 0x03, 0x00, 0xf0, 0x01, 0x01, 0x0c, 0x03, 0x00, 0xb0, 0x01, 0x21, 0x06,
+    0x07, 0xb0, 0x01, 0x31, 0x1a, 0x1b, 0x07, 0x18, 0x00, 0xa2, 0x1b, 0xc2, 0x17, 0xe0, 0x15, 0x70,
+    0x14, 0x60, 0x13, 0x30, 0xc8, 0x00, 0xf0, 0x04, 0x9c, 0x1a, 0x04, 0x00, 0x78, 0xa9, 0x1a, 0x04,
+    0x00, 0xac, 0x1a, 0x04, 0x00, 0xbd, 0x1a, 0x04, 0x00, 0x04, 0x08, 0x1b, 0x96, 0x80, 0x02, 0xb4,
+    0x1a, 0x04, 0x00, 0x02, 0x11, 0x80, 0xd3, 0x07, 0x50, 0x35, 0x02, 0x04, 0x62, 0x02, 0x7d, 0xba,
+    0x20, 0x1a, 0x0a, 0xf8, 0x02, 0x60, 0x03, 0x06, 0x0a, 0xb2, 0x06, 0x50, 0x3c, 0x00, 0xf1, 0x00,
+    0xd8, 0x1a, 0x04, 0x00, 0x69, 0xe2, 0x1a, 0x04, 0x00, 0xe4, 0x1a, 0x04, 0x00, 0xf0, 0x02, 0x0d,
+    0xa0, 0xf0, 0x09, 0x02, 0x17, 0x0b, 0x00, 0x02, 0x06, 0x2b, 0x06, 0x17, 0x64, 0x3a, 0x00, 0x17,
+    0x54, 0x39, 0x00, 0x17, 0x34, 0x38, 0x00, 0x17, 0x01, 0x36, 0x00, 0x98, 0x04, 0x00, 0x35, 0xcf,
+    0x01, 0x9c, 0x00, 0x30, 0x92, 0x02, 0x30, 0x40, 0x00, 0x60, 0x18, 0x1b, 0x04, 0x00, 0x28, 0x21,
+    0x05, 0x00, 0x10, 0x1b, 0x44, 0x01, 0x20, 0x28, 0x62, 0xfa, 0x05, 0x21, 0x64, 0x02, 0x08, 0x8a,
+    0xf0, 0x05, 0x1a, 0x19, 0x0a, 0x00, 0x09, 0x06, 0x59, 0x06, 0x19, 0x34, 0x18, 0x00, 0x19, 0xf2,
+    0x12, 0xf0, 0x10, 0xe0, 0x0e, 0xd0, 0x34, 0x01, 0x01, 0x00, 0x03, 0x40, 0x1b, 0x04, 0x00, 0x38,
+    0xb4, 0x00, 0x50, 0x5d, 0x1b, 0x04, 0x00, 0x73, 0x3c, 0x00, 0x40, 0x00, 0x00, 0x02, 0x65, 0x08,
+    0x00, 0x20, 0x17, 0x10, 0x6c, 0x06, 0x10, 0xe0, 0x85, 0x08, 0xa1, 0x3d, 0x05, 0x08, 0x72, 0x02,
+    0x59, 0x04, 0x00, 0x72, 0x02, 0xc4, 0xc8, 0xc0, 0x02, 0x0b, 0x05, 0x00, 0x03, 0x06, 0x04, 0x06,
+    0x0b, 0x42, 0x07, 0x50, 0xad, 0x92, 0x01, 0x6c, 0x02, 0x01, 0xa8, 0x01, 0x82, 0x0a, 0x00, 0x0f,
+    0x34, 0x09, 0x00, 0x0f, 0x52, 0x6c, 0x02, 0x10, 0xac, 0x5c, 0x00, 0xf6, 0x0b, 0xb9, 0x1b, 0x04,
+    0x00, 0xc2, 0x1b, 0x04, 0x00, 0xd8, 0x1b, 0x04, 0x00, 0x06, 0x08, 0x0c, 0x98, 0x40, 0x00, 0x00,
+    0x80, 0x40, 0x02, 0x00, 0x02, 0x04, 0xca, 0x65, 0x00, 0x10, 0x40, 0xe6, 0x08, 0xb4, 0xfd, 0x02,
+    0x06, 0x55, 0x02, 0x02, 0x24, 0x04, 0x24, 0x02, 0x02, 0x1c, 0x01, 0x36, 0x32, 0x06, 0x50, 0x6c,
+    0x04, 0x11, 0x07, 0x6c, 0x04, 0x06, 0x14, 0x02, 0x00, 0x28, 0x06, 0x11, 0x07, 0x14, 0x02, 0x10,
+    0x12, 0x24, 0x00, 0xa1, 0x06, 0x0f, 0x06, 0x0a, 0x34, 0x08, 0x00, 0x0a, 0x52, 0x06, 0x7c, 0x00,
+    0xb0, 0x28, 0x1c, 0x04, 0x00, 0x28, 0x31, 0x1c, 0x04, 0x00, 0x38, 0x1c, 0x10, 0x01, 0x20, 0xf4,
+    0x61, 0x10, 0x01, 0x21, 0x60, 0x02, 0x36, 0xc6, 0x22, 0x12, 0x10, 0x54, 0x00, 0x71, 0x10, 0x34,
+    0x0b, 0x00, 0x10, 0x72, 0x0c, 0x30, 0x00, 0x10, 0x58, 0x30, 0x00, 0x51, 0x61, 0x1c, 0x04, 0x00,
+    0x68, 0x30, 0x00, 0x10, 0x10, 0x40, 0x01, 0x36, 0x02, 0x58, 0x02, 0x9c, 0x03, 0x30, 0x74, 0x01,
+    0x00, 0x8c, 0x00, 0x00, 0x74, 0x01, 0x04, 0xf8, 0x04, 0x31, 0x02, 0x18, 0x0c, 0xa4, 0x04, 0xd2,
+    0x18, 0x64, 0x0a, 0x00, 0x18, 0x54, 0x09, 0x00, 0x18, 0x34, 0x08, 0x00, 0x18, 0x5c, 0x06, 0x32,
+    0x70, 0x02, 0x18, 0xa8, 0x00, 0x01, 0x58, 0x06, 0x20, 0x34, 0x06, 0x18, 0x00, 0x25, 0x70, 0x02,
+    0x8c, 0x04, 0xf0, 0x03, 0x09, 0x00, 0x19, 0x64, 0x08, 0x00, 0x19, 0x54, 0x07, 0x00, 0x19, 0x34,
+    0x06, 0x00, 0x19, 0x32, 0x15, 0xe0, 0x4c, 0x00, 0x00, 0x5c, 0x00, 0x0f, 0x4c, 0x00, 0x02, 0x21,
+    0x14, 0x0c, 0x64, 0x03, 0x01, 0x88, 0x06, 0x1a, 0x32, 0x70, 0x06, 0x06, 0x10, 0x01, 0x16, 0x09,
+    0x24, 0x03, 0x12, 0x10, 0x14, 0x00, 0x40, 0x10, 0x64, 0x09, 0x00, 0x5c, 0xea, 0x20, 0x10, 0x32,
+    0x12, 0x04, 0x11, 0x00, 0x62, 0xc4, 0x0f, 0x08, 0x00, 0x09, 0x93, 0x02, 0x01, 0x03, 0x00, 0x02,
+    0x06, 0x09, 0x06, 0x01, 0xb9, 0x06, 0x30, 0x02, 0x0b, 0x08, 0x67, 0x90, 0xc0, 0x06, 0x0b, 0x52,
+    0x07, 0x00, 0x06, 0x10, 0x05, 0x20, 0x04, 0x80, 0x02, 0x8b, 0x08, 0x02, 0x24, 0x06, 0x61, 0x06,
+    0x03, 0x06, 0x06, 0x12, 0x02, 0xab, 0x94, 0x02, 0x1c, 0x03, 0x11, 0x02, 0x1c, 0x03, 0x04, 0x01,
+    0x00, 0x00, 0xc5, 0x03, 0x00, 0x01, 0x00, 0x1a, 0xc0, 0x81, 0xb8, 0x05, 0x70, 0x00, 0x1b, 0xd0,
+    0x18, 0x00, 0x00, 0x07, 0x02, 0x00, 0x01, 0x00, 0x31, 0xff, 0xff, 0xff, 0x30, 0xc6, 0x00, 0x4c,
+    0x92, 0x00, 0xf0, 0x0a, 0x0c, 0x01, 0x00, 0x1f, 0xb8, 0x28, 0x00, 0x00, 0x1a, 0x04, 0x53, 0xb4,
+    0x09, 0x80, 0x00, 0x11, 0x40, 0x0f, 0xd2, 0x0a, 0x01, 0x00, 0x00, 0xca, 0x0b, 0x7d, 0x60, 0x1e,
+    0x04, 0x00, 0xf8, 0x1d, 0x04, 0x88, 0x00, 0x04, 0x01, 0x00, 0x1f, 0xe0, 0x68, 0x00, 0x14, 0x0f,
+    0x01, 0x00, 0xff, 0x72, 0x50, 0xf8, 0x03, 0x08, 0x01, 0x75, 0x08, 0x8e, 0x01, 0x76, 0x7e, 0x46,
+    0x00, 0x00, 0xe0, 0x3f, 0xf0, 0x0d, 0x0f, 0x63, 0x70, 0x11, 0x5e, 0x32, 0xa2, 0xdf, 0x2d, 0x99,
+    0xa7, 0xa5, 0x0f, 0x01, 0x00, 0x06, 0x0c, 0x54, 0x00, 0x2a, 0x48, 0x92, 0x60, 0x0e, 0xff, 0x07,
+    0x2e, 0x3f, 0x41, 0x56, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x40, 0x73, 0x74,
+    0x64, 0x65, 0x78, 0x74, 0x40, 0x40, 0x28, 0x00, 0x03, 0xb0, 0x6c, 0x6f, 0x67, 0x69, 0x63, 0x5f,
+    0x65, 0x72, 0x72, 0x6f, 0x72, 0x2a, 0x00, 0x00, 0x27, 0x00, 0x0f, 0x28, 0x00, 0x03, 0x5a, 0x65,
+    0x6e, 0x67, 0x74, 0x68, 0x29, 0x00, 0x0f, 0x28, 0x00, 0x00, 0xf5, 0x0b, 0x55, 0x3f, 0x24, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x40, 0x24, 0x24,
+    0x42, 0x59, 0x30, 0x41, 0x40, 0x45, 0x5e, 0x00, 0x0f, 0x01, 0x00, 0xaf, 0x62, 0x38, 0x10, 0x00,
+    0x00, 0xa5, 0x10, 0x40, 0x0d, 0x90, 0x98, 0x11, 0x00, 0x00, 0xfe, 0x12, 0x00, 0x00, 0xb0, 0x47,
+    0xcc, 0xf1, 0x07, 0x13, 0x00, 0x00, 0xd6, 0x14, 0x00, 0x00, 0xc8, 0x15, 0x04, 0x00, 0x1c, 0x16,
+    0x00, 0x00, 0xbc, 0x16, 0x00, 0x00, 0xd0, 0x15, 0x04, 0x08, 0x00, 0xf0, 0x17, 0xcd, 0x17, 0x00,
+    0x00, 0xd8, 0x15, 0x04, 0x00, 0xd0, 0x17, 0x00, 0x00, 0x6a, 0x1b, 0x00, 0x00, 0xe8, 0x15, 0x04,
+    0x00, 0x6c, 0x1b, 0x00, 0x00, 0xe7, 0x21, 0x00, 0x00, 0xf4, 0x15, 0x04, 0x00, 0xe8, 0x21, 0x00,
+    0x00, 0x23, 0x24, 0x14, 0x1b, 0xf1, 0x0a, 0x04, 0x00, 0x24, 0x24, 0x00, 0x00, 0x5b, 0x26, 0x00,
+    0x00, 0x1c, 0x16, 0x04, 0x00, 0x5c, 0x26, 0x00, 0x00, 0x64, 0x29, 0x00, 0x00, 0x30, 0x16, 0x04,
+    0x08, 0x00, 0xf1, 0x34, 0xca, 0x29, 0x00, 0x00, 0x48, 0x16, 0x04, 0x00, 0xcc, 0x29, 0x00, 0x00,
+    0xfb, 0x2b, 0x00, 0x00, 0x50, 0x16, 0x04, 0x00, 0xfc, 0x2b, 0x00, 0x00, 0xdb, 0x2e, 0x00, 0x00,
+    0x6c, 0x16, 0x04, 0x00, 0xdc, 0x2e, 0x00, 0x00, 0xd8, 0x36, 0x00, 0x00, 0x84, 0x16, 0x04, 0x00,
+    0x44, 0x37, 0x00, 0x00, 0x57, 0x38, 0x00, 0x00, 0x9c, 0x16, 0x04, 0x00, 0x10, 0x3c, 0x00, 0x00,
+    0x89, 0x3c, 0x00, 0x00, 0xb0, 0x16, 0x04, 0x08, 0x00, 0x71, 0xee, 0x3c, 0x00, 0x00, 0xe0, 0x16,
+    0x04, 0x08, 0x00, 0x71, 0x1b, 0x3d, 0x00, 0x00, 0x2c, 0x17, 0x04, 0x08, 0x00, 0x71, 0x29, 0x3d,
+    0x00, 0x00, 0x3c, 0x17, 0x04, 0x08, 0x00, 0xf3, 0x0a, 0x2b, 0x3d, 0x00, 0x00, 0x4c, 0x17, 0x04,
+    0x00, 0x58, 0x3d, 0x00, 0x00, 0x72, 0x3d, 0x00, 0x00, 0x5c, 0x17, 0x04, 0x00, 0xa0, 0x3d, 0x00,
+    0x00, 0xc6, 0x0c, 0x00, 0xb0, 0xd4, 0x3d, 0x00, 0x00, 0x78, 0x3f, 0x00, 0x00, 0x68, 0x17, 0x04,
+    0xf4, 0x02, 0xe0, 0x00, 0x03, 0x40, 0x00, 0x00, 0xb8, 0x17, 0x04, 0x00, 0x38, 0x40, 0x00, 0x00,
+    0x95, 0x68, 0x07, 0x30, 0x17, 0x04, 0x00, 0x70, 0x07, 0x50, 0xd4, 0x40, 0x00, 0x00, 0x90, 0x30,
+    0x00, 0x52, 0x40, 0x00, 0x00, 0x35, 0x41, 0x18, 0x00, 0x40, 0x38, 0x41, 0x00, 0x00, 0x62, 0x0f,
+    0x40, 0xb0, 0x17, 0x04, 0x00, 0x1a, 0x0f, 0x22, 0x6a, 0x41, 0x3c, 0x00, 0x53, 0x6c, 0x41, 0x00,
+    0x00, 0x8f, 0x0c, 0x00, 0x40, 0x90, 0x41, 0x00, 0x00, 0x21, 0x0a, 0x00, 0x30, 0x00, 0x00, 0x08,
+    0x00, 0x22, 0x24, 0x42, 0x30, 0x00, 0x53, 0x4c, 0x42, 0x00, 0x00, 0x5b, 0x0c, 0x00, 0xf0, 0x06,
+    0x6c, 0x42, 0x00, 0x00, 0x89, 0x43, 0x00, 0x00, 0xcc, 0x17, 0x04, 0x00, 0xac, 0x43, 0x00, 0x00,
+    0x50, 0x44, 0x00, 0x00, 0xd8, 0x54, 0x00, 0x52, 0x44, 0x00, 0x00, 0x6e, 0x44, 0xa8, 0x00, 0xf0,
+    0x0f, 0xa4, 0x44, 0x00, 0x00, 0x02, 0x45, 0x00, 0x00, 0x20, 0x18, 0x04, 0x00, 0x04, 0x45, 0x00,
+    0x00, 0x75, 0x45, 0x00, 0x00, 0xc0, 0x17, 0x04, 0x00, 0x7c, 0x45, 0x00, 0x00, 0xd2, 0x45, 0xb6,
+    0x96, 0x82, 0x04, 0x00, 0xd4, 0x45, 0x00, 0x00, 0xf6, 0x45, 0x78, 0x00, 0xb1, 0xf8, 0x45, 0x00,
+    0x00, 0x24, 0x48, 0x00, 0x00, 0xe4, 0x17, 0x04, 0x08, 0x00, 0x50, 0x02, 0x49, 0x00, 0x00, 0x2c,
+    0x3c, 0x00, 0xf1, 0x07, 0x49, 0x00, 0x00, 0x1f, 0x4a, 0x00, 0x00, 0xb4, 0x18, 0x04, 0x00, 0x20,
+    0x4a, 0x00, 0x00, 0x50, 0x4a, 0x00, 0x00, 0x98, 0x18, 0x04, 0x08, 0x00, 0x71, 0x31, 0x4b, 0x00,
+    0x00, 0x78, 0x18, 0x04, 0xc8, 0x0c, 0x50, 0x5d, 0x4b, 0x00, 0x00, 0xc4, 0x38, 0x0b, 0xf1, 0x13,
+    0x4b, 0x00, 0x00, 0xbf, 0x4b, 0x00, 0x00, 0x5c, 0x18, 0x04, 0x00, 0xc0, 0x4b, 0x00, 0x00, 0xbd,
+    0x4d, 0x00, 0x00, 0x58, 0x19, 0x04, 0x00, 0xc0, 0x4d, 0x00, 0x00, 0x14, 0x52, 0x00, 0x00, 0x8c,
+    0x19, 0x04, 0x08, 0x00, 0x70, 0x06, 0x53, 0x00, 0x00, 0xf8, 0x18, 0x04, 0xb5, 0x95, 0xf1, 0x05,
+    0x00, 0xb5, 0x53, 0x00, 0x00, 0x0c, 0x19, 0x04, 0x00, 0xb8, 0x53, 0x00, 0x00, 0x9c, 0x54, 0x00,
+    0x00, 0x24, 0x19, 0x04, 0x08, 0x00, 0x90, 0x43, 0x55, 0x00, 0x00, 0xd0, 0x18, 0x04, 0x00, 0x44,
+    0xdc, 0x0c, 0x61, 0x55, 0x00, 0x00, 0xdc, 0x18, 0x04, 0x08, 0x00, 0x10, 0xeb, 0xe8, 0x08, 0x40,
+    0x19, 0x04, 0x00, 0xec, 0x84, 0x09, 0x61, 0x56, 0x00, 0x00, 0x74, 0x1a, 0x04, 0x08, 0x00, 0xe2,
+    0x8c, 0x56, 0x00, 0x00, 0x50, 0x1a, 0x04, 0x00, 0xa8, 0x56, 0x00, 0x00, 0xe0, 0x56, 0x08, 0x01,
+    0x00, 0x08, 0x00, 0x00, 0xb4, 0xcf, 0xa2, 0xe8, 0x19, 0x04, 0x00, 0x84, 0x57, 0x00, 0x00, 0xf8,
+    0x57, 0x5c, 0x01, 0x00, 0x45, 0x12, 0x22, 0x26, 0x58, 0x24, 0x00, 0xf0, 0x12, 0x30, 0x58, 0x00,
+    0x00, 0x55, 0x58, 0x00, 0x00, 0x68, 0x1a, 0x04, 0x00, 0x64, 0x58, 0x00, 0x00, 0xa5, 0x58, 0x00,
+    0x00, 0xbc, 0x19, 0x04, 0x00, 0xa8, 0x58, 0x00, 0x00, 0xc0, 0x58, 0x00, 0x00, 0xc4, 0xc0, 0x00,
+    0xa1, 0x58, 0x00, 0x00, 0x54, 0x59, 0x00, 0x00, 0x38, 0x1a, 0x04, 0x08, 0x00, 0x50, 0xed, 0x5a,
+    0x00, 0x00, 0x14, 0x37, 0x0a, 0xf2, 0x02, 0x5a, 0x00, 0x00, 0x63, 0x5c, 0x00, 0x00, 0xfc, 0x19,
+    0x04, 0x00, 0x80, 0x5c, 0x00, 0x00, 0x3b, 0x5d, 0xd8, 0x00, 0xb1, 0x40, 0x5d, 0x00, 0x00, 0x60,
+    0x5e, 0x00, 0x00, 0x80, 0x1a, 0x04, 0x08, 0x00, 0x22, 0x7d, 0x5e, 0x6c, 0x00, 0xb1, 0x80, 0x5e,
+    0x00, 0x00, 0x40, 0x5f, 0x00, 0x00, 0xe8, 0x1a, 0x04, 0x08, 0x00, 0x20, 0xcc, 0x5f, 0xfc, 0xb8,
+    0x11, 0x04, 0x08, 0x00, 0xf0, 0x05, 0x3b, 0x60, 0x00, 0x00, 0x40, 0x1c, 0x04, 0x00, 0x3c, 0x60,
+    0x00, 0x00, 0xf3, 0x61, 0x00, 0x00, 0x30, 0x1b, 0x04, 0x00, 0x45, 0x09, 0x00, 0x19, 0x09, 0x00,
+    0x5c, 0x01, 0x00, 0x08, 0x00, 0x13, 0x27, 0x0c, 0x00, 0x00, 0x6d, 0x0a, 0x22, 0x4d, 0x62, 0x54,
+    0x00, 0x53, 0x50, 0x62, 0x00, 0x00, 0x6c, 0x0c, 0x00, 0x62, 0x70, 0x62, 0x00, 0x00, 0xba, 0x62,
+    0xe4, 0x00, 0x62, 0xc0, 0x62, 0x00, 0x00, 0x0e, 0x63, 0xfc, 0x00, 0x62, 0x10, 0x63, 0x00, 0x00,
+    0x30, 0x63, 0x3c, 0x00, 0x63, 0x40, 0x63, 0x00, 0x00, 0x6b, 0x63, 0x30, 0x00, 0xf2, 0x0e, 0x63,
+    0x00, 0x00, 0xb3, 0x63, 0x00, 0x00, 0xec, 0x1b, 0x04, 0x00, 0xc0, 0x63, 0x00, 0x00, 0x14, 0x64,
+    0x00, 0x00, 0xfc, 0x1b, 0x04, 0x00, 0x20, 0x64, 0x00, 0x00, 0x5f, 0x64, 0x18, 0x00, 0xf2, 0x0f,
+    0x60, 0x64, 0x00, 0x00, 0x01, 0x65, 0x00, 0x00, 0x04, 0x1b, 0x04, 0x00, 0x10, 0x65, 0x00, 0x00,
+    0xe1, 0x65, 0x00, 0x00, 0x90, 0x1b, 0x04, 0x00, 0xe4, 0x65, 0x00, 0x00, 0x67, 0x66, 0x4c, 0x02,
+    0x62, 0x68, 0x66, 0x00, 0x00, 0xa9, 0x66, 0x54, 0x00, 0x10, 0xac, 0x14, 0x00, 0x12, 0x67, 0x84,
+    0x00, 0x00, 0x08, 0x00, 0xf1, 0x04, 0xe2, 0x67, 0x00, 0x00, 0xf0, 0x1c, 0x04, 0x00, 0xe4, 0x67,
+    0x00, 0x00, 0xc8, 0x68, 0x00, 0x00, 0x20, 0x1d, 0x04, 0x08, 0x00, 0x71, 0x7c, 0x69, 0x00, 0x00,
+    0x0c, 0x1d, 0x04, 0x08, 0x00, 0x22, 0xb6, 0x69, 0x3c, 0x00, 0x62, 0xb8, 0x69, 0x00, 0x00, 0x78,
+    0x6a, 0xb4, 0x00, 0x00, 0x08, 0x00, 0xa2, 0x6d, 0x6b, 0x00, 0x00, 0xd4, 0x1c, 0x04, 0x00, 0xc8,
+    0x6b, 0xe6, 0xd3, 0x00, 0x0c, 0x00, 0xf2, 0x03, 0x8c, 0x6c, 0x00, 0x00, 0x3d, 0x6d, 0x00, 0x00,
+    0xb8, 0x1c, 0x04, 0x00, 0x40, 0x6d, 0x00, 0x00, 0xb2, 0x6d, 0x6c, 0x00, 0xf2, 0x03, 0xb4, 0x6d,
+    0x00, 0x00, 0x19, 0x6e, 0x00, 0x00, 0x6c, 0x1c, 0x04, 0x00, 0x1c, 0x6e, 0x00, 0x00, 0x62, 0x6e,
+    0x48, 0x00, 0xf0, 0x18, 0x64, 0x6e, 0x00, 0x00, 0x5d, 0x6f, 0x00, 0x00, 0xa4, 0x1c, 0x04, 0x00,
+    0x60, 0x6f, 0x00, 0x00, 0xa3, 0x6f, 0x00, 0x00, 0x78, 0x1c, 0x04, 0x00, 0xa4, 0x6f, 0x00, 0x00,
+    0xd2, 0x70, 0x00, 0x00, 0x88, 0x1c, 0x04, 0x00, 0xe0, 0x70, 0x00, 0x81, 0xa0, 0x01, 0x84, 0x00,
+    0xf0, 0x06, 0x20, 0x71, 0x00, 0x00, 0x3e, 0x71, 0x00, 0x00, 0x38, 0x1d, 0x04, 0x00, 0x60, 0x71,
+    0x00, 0x00, 0xfc, 0x71, 0x00, 0x00, 0x80, 0xb4, 0x08, 0xd2, 0x72, 0x00, 0x00, 0x1e, 0x72, 0x00,
+    0x00, 0x90, 0x1d, 0x04, 0x00, 0x20, 0x72, 0xa8, 0x13, 0x00, 0x0c, 0x00, 0x50, 0x90, 0x72, 0x00,
+    0x00, 0x95, 0xb4, 0x13, 0xe1, 0x1d, 0x04, 0x00, 0xb0, 0x72, 0x00, 0x00, 0xb6, 0x72, 0x00, 0x00,
+    0x48, 0x1d, 0x04, 0xb4, 0x13, 0x50, 0xc7, 0x73, 0x00, 0x00, 0x50, 0x3c, 0x00, 0xf0, 0x05, 0x74,
+    0x00, 0x00, 0x43, 0x74, 0x00, 0x00, 0x58, 0x1d, 0x04, 0x00, 0x80, 0x74, 0x00, 0x00, 0xa6, 0x74,
+    0x00, 0x00, 0x68, 0x24, 0x00, 0x52, 0x74, 0x00, 0x00, 0x6a, 0x77, 0x24, 0x00, 0x00, 0xad, 0x0c,
+    0x71, 0x2a, 0x84, 0x00, 0x00, 0xc4, 0x1a, 0x04, 0x88, 0x14, 0x20, 0xa9, 0x84, 0x8a, 0xc4, 0x11,
+    0x04, 0x90, 0x14, 0x6f, 0xdf, 0x84, 0x00, 0x00, 0xe0, 0x1b, 0x34, 0x31, 0x67, 0x00, 0xac, 0x12,
+    0x04, 0x01, 0x00, 0x10, 0xbc, 0x0c, 0x00, 0x01, 0x96, 0x0a, 0x0e, 0x01, 0x00, 0x00, 0xc0, 0x12,
+    0x00, 0x01, 0x00, 0x13, 0x72, 0x08, 0x00, 0x13, 0x8a, 0x08, 0x00, 0x13, 0x9e, 0x08, 0x00, 0x17,
+    0xac, 0x48, 0x00, 0x00, 0x01, 0x00, 0xf9, 0x2a, 0xdc, 0x05, 0x4d, 0x6d, 0x47, 0x65, 0x74, 0x56,
+    0x69, 0x72, 0x74, 0x75, 0x61, 0x6c, 0x46, 0x6f, 0x72, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x61,
+    0x6c, 0x00, 0xc1, 0x00, 0x45, 0x78, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x50, 0x6f,
+    0x6f, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x54, 0x61, 0x67, 0x00, 0xee, 0x00, 0x45, 0x78, 0x46, 0x72,
+    0x65, 0x14, 0x00, 0xf7, 0x00, 0x86, 0x04, 0x4b, 0x65, 0x42, 0x75, 0x67, 0x43, 0x68, 0x65, 0x63,
+    0x6b, 0x00, 0x00, 0x87, 0x0e, 0x00, 0xf1, 0x00, 0x45, 0x78, 0x00, 0x00, 0x6e, 0x74, 0x6f, 0x73,
+    0x6b, 0x72, 0x6e, 0x6c, 0x2e, 0x65, 0x78, 0x3a, 0xd6, 0x0f, 0x01, 0x00, 0xff, 0x23, 0x30, 0x90,
+    0x00, 0x00, 0x23, 0xd4, 0xf1, 0x2f, 0x30, 0xa0, 0x38, 0xa0, 0x40, 0xa0, 0x48, 0xa0, 0x50, 0xa0,
+    0x20, 0xa1, 0x28, 0xa1, 0x30, 0xa1, 0x38, 0xa1, 0x40, 0xa1, 0x48, 0xa1, 0x80, 0xa1, 0x90, 0xa1,
+    0xc0, 0xa1, 0xc8, 0xa1, 0xd0, 0xa1, 0xd8, 0xa1, 0xe0, 0xa1, 0xe8, 0xa1, 0xf0, 0xa1, 0xf8, 0xa1,
+    0x00, 0xa2, 0x08, 0xa2, 0x10, 0xa2, 0x18, 0xa2, 0x20, 0xa2, 0x28, 0xa2, 0x30, 0xa2, 0x38, 0xa2,
+    0x40, 0xa2, 0x48, 0xa2, 0x5d, 0xa8, 0x01, 0xb8, 0x17, 0x84, 0x58, 0xa1, 0x70, 0xa1, 0x78, 0xa1,
+    0x80, 0xa1, 0x20, 0x00, 0x00, 0x74, 0x15, 0x00, 0x20, 0x15, 0x8f, 0x20, 0xa0, 0x90, 0xa0, 0xb8,
+    0xa0, 0xe0, 0xa0, 0x60, 0x96, 0x4d, 0x0f, 0x01, 0x00, 0xff, 0x1e, 0x10, 0xd0, 0xc3, 0xac, 0xf7,
+    0x3b, 0x02, 0x02, 0x00, 0x30, 0x82, 0x0f, 0xc3, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d,
+    0x01, 0x07, 0x02, 0xa0, 0x82, 0x0f, 0xb4, 0x30, 0x82, 0x0f, 0xb0, 0x02, 0x01, 0x01, 0x31, 0x0f,
+    0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x30,
+    0x82, 0x0a, 0x94, 0x06, 0x0a, 0x2b, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x04, 0xa0,
+    0x82, 0x0a, 0x84, 0x30, 0x82, 0x0a, 0x80, 0x30, 0x82, 0x0a, 0x49, 0x18, 0x00, 0xf6, 0x1f, 0x0f,
+    0x30, 0x82, 0x0a, 0x39, 0x03, 0x01, 0x00, 0xa0, 0x82, 0x0a, 0x32, 0xa1, 0x82, 0x0a, 0x2e, 0x04,
+    0x10, 0xa6, 0xb5, 0x86, 0xd5, 0xb4, 0xa1, 0x24, 0x66, 0xae, 0x05, 0xa2, 0x17, 0xda, 0x8e, 0x60,
+    0xd6, 0x04, 0x82, 0x0a, 0x18, 0x31, 0x82, 0x0a, 0x14, 0x30, 0x82, 0x0a, 0x10, 0x39, 0x00, 0x91,
+    0x03, 0x02, 0x31, 0x82, 0x0a, 0x00, 0x04, 0x82, 0x09, 0x64, 0xcf, 0xf0, 0x11, 0xdf, 0x14, 0xaf,
+    0x31, 0xbf, 0x14, 0x7d, 0x97, 0xc8, 0x3c, 0x37, 0x07, 0x17, 0xcd, 0x7c, 0x17, 0x74, 0x78, 0xa9,
+    0x0b, 0xa4, 0x47, 0x7b, 0xa0, 0xfb, 0x01, 0x7d, 0xc4, 0x62, 0x92, 0xb3, 0x7a, 0x34, 0xbe, 0xf0,
+    0x11, 0x8f, 0x05, 0x70, 0x28, 0xe0, 0x1c, 0x20, 0x1d, 0x59, 0x5b, 0xb9, 0xf0, 0xb9, 0x51, 0x56,
+    0x21, 0x0f, 0xe1, 0x69, 0x1e, 0x46, 0x94, 0xec, 0xb9, 0x25, 0x80, 0xab, 0x29, 0x7a, 0xa0, 0xf5,
+    0x0e, 0x81, 0x02, 0xf0, 0xc5, 0x02, 0x9d, 0xcd, 0x5d, 0x22, 0x2e, 0x9e, 0xf4, 0xd5, 0xdb, 0xb6,
+    0xbf, 0x0e, 0x8b, 0x74, 0x97, 0xed, 0xed, 0x5d, 0x33, 0x41, 0x7c, 0x1c, 0x1d, 0xd0, 0x6b, 0xca,
+    0x6d, 0x41, 0x69, 0x62, 0x5c, 0x00, 0x24, 0x00, 0x00, 0x59, 0xcb, 0x2c, 0x72, 0x87, 0x6f, 0xce,
+    0x40, 0xbd, 0x71, 0xd2, 0x69, 0xc1, 0x5a, 0xc5, 0x0f, 0xed, 0xb5, 0xe5, 0xf7, 0xdd, 0x42, 0x8c,
+    0xee, 0x59, 0x21, 0x58, 0xee, 0xa0, 0x6f, 0x36, 0x8a, 0x00, 0x34, 0x00, 0x00, 0x28, 0x60, 0x4f,
+    0x5a, 0xac, 0xce, 0xfc, 0x36, 0xcc, 0x92, 0xfe, 0x4a, 0x93, 0x8c, 0xfa, 0xc0, 0x28, 0xdd, 0x86,
+    0xad, 0xb2, 0x8f, 0xe2, 0xed, 0x0e, 0x60, 0xfb, 0x04, 0x0e, 0x00, 0x3d, 0x66, 0x00, 0x44, 0x00,
+    0x00, 0xf2, 0x08, 0x88, 0x0d, 0x0f, 0xe8, 0x12, 0xf4, 0x46, 0xc6, 0x4a, 0xd5, 0x36, 0xe0, 0x35,
+    0xf9, 0x50, 0x4c, 0xb1, 0xef, 0x5e, 0xbd, 0x76, 0x14, 0xa3, 0x81, 0xbb, 0x29, 0x9d, 0xcd, 0xb6,
+    0x03, 0x00, 0x54, 0x00, 0x00, 0x3f, 0xd0, 0x47, 0xb9, 0x94, 0x29, 0xc5, 0xeb, 0xac, 0x89, 0x6b,
+    0x0c, 0x0a, 0xd8, 0x20, 0x54, 0xe7, 0xdf, 0x63, 0x9a, 0xd5, 0x47, 0xb1, 0x31, 0xc8, 0xa5, 0x11,
+    0x32, 0x5a, 0x82, 0x11, 0x63, 0x00, 0x64, 0x00, 0x00, 0xba, 0xab, 0xcf, 0xcc, 0x18, 0x9c, 0x1c,
+    0xdd, 0x64, 0xc4, 0xb3, 0xd9, 0xc2, 0xb2, 0xd3, 0x77, 0xb5, 0x7d, 0x93, 0xc3, 0x61, 0x0a, 0x76,
+    0x16, 0x69, 0x6d, 0xf7, 0x50, 0xed, 0x2f, 0x55, 0x68, 0x7c, 0x06, 0xf0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x65, 0xc6, 0xfb, 0xc8, 0x8d, 0x79, 0x25, 0x6a, 0x87, 0x5f, 0xfd, 0xb6,
+    0x31, 0x15, 0xae, 0x08, 0xf2, 0xcb, 0x6e, 0x89, 0x4f, 0x9f, 0x49, 0xa9, 0x47, 0x12, 0x8d, 0x61,
+    0x38, 0x85, 0x30, 0x78, 0x7a, 0x00, 0x7a, 0x00, 0x00, 0x67, 0x20, 0xca, 0x63, 0xc0, 0x3f, 0xa5,
+    0x6d, 0xd2, 0x6b, 0x17, 0xf5, 0x98, 0xb2, 0xd3, 0xa5, 0x5b, 0xee, 0x23, 0xb2, 0x96, 0x40, 0xca,
+    0xb1, 0x9a, 0x08, 0x92, 0xb4, 0xbb, 0xe5, 0x38, 0x20, 0x00, 0x8a, 0x00, 0x00, 0x5e, 0xfc, 0xd0,
+    0x06, 0xdf, 0x89, 0xcd, 0x37, 0xd4, 0x86, 0x9e, 0x28, 0xd3, 0xfa, 0x31, 0x97, 0xc4, 0xeb, 0x72,
+    0xee, 0xce, 0xc0, 0x91, 0x0e, 0xa4, 0xbe, 0x63, 0xb7, 0xe5, 0x38, 0x5d, 0xea, 0x00, 0x9a, 0x00,
+    0x00, 0xaa, 0x19, 0x19, 0x73, 0x13, 0x27, 0xee, 0x95, 0xc0, 0xa4, 0x1b, 0xa8, 0x2a, 0xda, 0xb7,
+    0xea, 0xab, 0x62, 0xf5, 0x83, 0x87, 0xc8, 0x77, 0x06, 0x38, 0x77, 0xa4, 0x6d, 0x94, 0x7e, 0x59,
+    0xd0, 0x00, 0xaa, 0x00, 0x00, 0x4f, 0xe2, 0x36, 0x46, 0xf2, 0x7f, 0x06, 0x7a, 0x07, 0x1b, 0x57,
+    0xa2, 0x6b, 0x54, 0x7e, 0x7a, 0x7d, 0xc5, 0xfd, 0x31, 0xf3, 0x44, 0xd7, 0x57, 0x8e, 0xb8, 0x0f,
+    0x39, 0x61, 0x2f, 0xc0, 0x4a, 0x00, 0xba, 0x00, 0x00, 0x66, 0x61, 0x25, 0xfb, 0x8a, 0x3e, 0x5a,
+    0x21, 0x45, 0x28, 0x52, 0x24, 0xb8, 0xbb, 0x53, 0x0d, 0xd2, 0x4b, 0xf4, 0x07, 0x5b, 0xab, 0x78,
+    0x7d, 0x7b, 0x94, 0xe6, 0x7b, 0x76, 0x44, 0x1e, 0xe1, 0x00, 0xca, 0x00, 0x00, 0x5c, 0x05, 0x20,
+    0xcf, 0x37, 0xa6, 0x19, 0xc7, 0xfd, 0x24, 0x95, 0x2b, 0x2b, 0x08, 0x44, 0xcf, 0x96, 0x51, 0xd6,
+    0x0d, 0xd0, 0xc7, 0x14, 0xa4, 0x3c, 0x6a, 0xf3, 0xda, 0xab, 0x87, 0x23, 0x27, 0x00, 0xda, 0x00,
+    0x00, 0x7c, 0xab, 0x1c, 0x8d, 0xcc, 0xdb, 0x7c, 0x8d, 0xee, 0xe4, 0xbd, 0xb1, 0xfb, 0x6e, 0x7e,
+    0x88, 0xfd, 0xef, 0xe7, 0xfc, 0x8f, 0x83, 0x57, 0x30, 0xf6, 0xfb, 0xdd, 0x1d, 0xcb, 0xfc, 0xee,
+    0x40, 0x00, 0xea, 0x00, 0x00, 0x44, 0x41, 0xab, 0x85, 0x4e, 0x5e, 0x22, 0x9f, 0x2a, 0x96, 0xff,
+    0xf2, 0xe1, 0xb9, 0xe5, 0x43, 0xe5, 0xb1, 0x88, 0x2f, 0x53, 0x9a, 0x87, 0x26, 0x50, 0x43, 0x71,
+    0xf3, 0xe9, 0x51, 0x58, 0x60, 0x00, 0xfa, 0x00, 0x00, 0xa9, 0x69, 0x3d, 0x37, 0x57, 0xb9, 0x3b,
+    0xfd, 0x62, 0xf3, 0xeb, 0x68, 0x0b, 0x5a, 0x28, 0x02, 0xac, 0x25, 0x3b, 0x5f, 0x1f, 0xa4, 0x8a,
+    0xc0, 0xaf, 0x8d, 0x33, 0x8e, 0x54, 0x83, 0xb4, 0xf5, 0x00, 0x0a, 0x01, 0x00, 0xec, 0xd8, 0xe1,
+    0xea, 0x61, 0x29, 0x79, 0x4c, 0xc1, 0x03, 0x2a, 0x4b, 0x9c, 0xec, 0xb7, 0x7d, 0x23, 0x68, 0x04,
+    0x2b, 0xf6, 0x41, 0x7a, 0xf7, 0xc9, 0x50, 0x69, 0xe4, 0xf1, 0xf6, 0xd7, 0x8a, 0x00, 0x1a, 0x01,
+    0x00, 0x03, 0xef, 0x27, 0xb4, 0xb0, 0x89, 0x16, 0x32, 0x4c, 0x90, 0xb4, 0xec, 0x88, 0x96, 0x4e,
+    0x41, 0x7c, 0x7f, 0x53, 0xb1, 0x07, 0x10, 0x4f, 0x59, 0x32, 0xf7, 0xf5, 0xc7, 0x67, 0x86, 0xea,
+    0xac, 0x00, 0x2a, 0x01, 0x00, 0x16, 0xde, 0x2d, 0x01, 0x3e, 0x38, 0x36, 0x8a, 0x1d, 0xe0, 0xe9,
+    0xf5, 0xb2, 0x86, 0xc9, 0xb0, 0x8a, 0x7d, 0xb2, 0xce, 0xf4, 0xef, 0x5b, 0xe9, 0x0e, 0x30, 0xc4,
+    0x34, 0x5f, 0xc6, 0xf4, 0x95, 0x00, 0x3a, 0x01, 0x00, 0x36, 0x4a, 0xe2, 0x3e, 0x79, 0xde, 0x2b,
+    0x52, 0x66, 0x2e, 0x89, 0x00, 0x78, 0xdf, 0x3a, 0x00, 0x04, 0xad, 0x16, 0x11, 0xd0, 0x22, 0x3d,
+    0xd1, 0x63, 0x52, 0x77, 0x41, 0x26, 0xd2, 0xe4, 0xe9, 0x00, 0x4a, 0x01, 0x00, 0xdd, 0x08, 0xec,
+    0xb0, 0x7d, 0x0a, 0xfb, 0x0c, 0xd0, 0xca, 0x89, 0xde, 0x5f, 0x95, 0xc4, 0xdd, 0xf0, 0x89, 0x8f,
+    0x28, 0xc1, 0x5d, 0x65, 0x5d, 0x03, 0x63, 0x58, 0xd5, 0xc1, 0x91, 0x0a, 0xb0, 0x00, 0x5a, 0x01,
+    0x00, 0x5d, 0x3f, 0xa4, 0x9a, 0x91, 0xa2, 0x35, 0x98, 0x8d, 0x55, 0x76, 0xe2, 0x63, 0x2c, 0xc1,
+    0x4a, 0x45, 0xfe, 0xd4, 0x45, 0x74, 0x44, 0x1b, 0x68, 0x25, 0xcf, 0x80, 0xf2, 0xae, 0x4e, 0x97,
+    0x90, 0x00, 0x6a, 0x01, 0x00, 0x98, 0x5a, 0xd7, 0x13, 0x3b, 0x3a, 0xf5, 0x8e, 0x32, 0x32, 0xe0,
+    0xf7, 0x30, 0x2b, 0x68, 0xcb, 0xfc, 0xc9, 0x8e, 0x8c, 0x00, 0x79, 0x50, 0x52, 0xd9, 0x8a, 0xf5,
+    0x65, 0xe3, 0x71, 0x58, 0x34, 0x00, 0x7a, 0x01, 0x00, 0x37, 0x1b, 0x05, 0x03, 0xaa, 0x5b, 0x36,
+    0x69, 0x08, 0x47, 0x6b, 0xf3, 0xb8, 0x8b, 0xb6, 0xc3, 0xb6, 0x2e, 0xe5, 0x4f, 0xff, 0x4e, 0x06,
+    0x7f, 0x43, 0x2e, 0x98, 0x91, 0x0c, 0x7b, 0x35, 0x16, 0x00, 0x8a, 0x01, 0x00, 0xe8, 0xae, 0x06,
+    0x89, 0x96, 0xc7, 0x06, 0x62, 0x6e, 0x8e, 0xa8, 0x57, 0x71, 0x3c, 0xad, 0x7c, 0xc7, 0xee, 0x9e,
+    0xa4, 0x4b, 0x25, 0xd7, 0x08, 0x62, 0x21, 0x8d, 0xda, 0xa0, 0x0a, 0x12, 0x5a, 0x00, 0x9a, 0x01,
+    0x00, 0x75, 0x5e, 0x15, 0xbc, 0x97, 0xf3, 0xdc, 0x26, 0xf8, 0x32, 0xdf, 0x8e, 0x1c, 0xfa, 0x9b,
+    0xd6, 0x99, 0x58, 0xff, 0xb3, 0xc4, 0x49, 0xa5, 0x3e, 0x4e, 0x6e, 0x57, 0x62, 0x96, 0x95, 0xfa,
+    0xd1, 0x00, 0xaa, 0x01, 0x00, 0xd7, 0x64, 0xe3, 0xfd, 0xba, 0xed, 0xa9, 0x23, 0x3e, 0x5a, 0x4e,
+    0x2a, 0x84, 0x23, 0xda, 0x31, 0xc2, 0x1a, 0x59, 0xe5, 0xb2, 0xac, 0x31, 0x67, 0x2e, 0x81, 0x17,
+    0x06, 0x04, 0xd1, 0x1e, 0xd8, 0x00, 0xba, 0x01, 0x00, 0xa7, 0x6b, 0x99, 0x5e, 0x53, 0x48, 0x1b,
+    0x0e, 0xdb, 0xf5, 0x64, 0xde, 0x64, 0xd2, 0x07, 0x47, 0xe3, 0x79, 0x2c, 0x19, 0x9f, 0xfa, 0x77,
+    0x02, 0xe7, 0x29, 0x1b, 0xd1, 0xd8, 0x3a, 0xce, 0x5c, 0x00, 0xca, 0x01, 0x00, 0xcf, 0x63, 0x68,
+    0x00, 0x0f, 0x29, 0xf7, 0xc6, 0x5c, 0x08, 0x89, 0xdc, 0x76, 0x8d, 0x46, 0xf2, 0x50, 0x06, 0x39,
+    0x16, 0xd7, 0x60, 0x03, 0x65, 0x78, 0xc1, 0x52, 0x7a, 0xef, 0x6d, 0x94, 0x0b, 0x00, 0xda, 0x01,
+    0x00, 0x88, 0xf5, 0xb5, 0xbb, 0x20, 0x3b, 0x42, 0x5c, 0x19, 0x66, 0x7c, 0x29, 0x61, 0xe4, 0xbd,
+    0x7d, 0x87, 0x7d, 0x7a, 0x94, 0x23, 0x06, 0x7e, 0x75, 0x9f, 0x72, 0xf8, 0x25, 0x3e, 0x72, 0x77,
+    0x4e, 0x00, 0xea, 0x01, 0x00, 0xb5, 0x6c, 0xa9, 0x0a, 0x5e, 0x5f, 0x4d, 0xfc, 0x3c, 0xed, 0x21,
+    0xc2, 0x95, 0x67, 0x06, 0xec, 0xd2, 0xd4, 0x76, 0x55, 0xb0, 0x09, 0x72, 0x1f, 0x30, 0x51, 0x18,
+    0xb8, 0x6b, 0x60, 0x08, 0x5d, 0x00, 0xfa, 0x01, 0x00, 0xbd, 0x96, 0x71, 0x42, 0xaf, 0x37, 0x5c,
+    0xf8, 0xef, 0x5c, 0x75, 0x7c, 0xa0, 0xaa, 0x31, 0x8d, 0x6c, 0x9c, 0xf9, 0xe0, 0xb6, 0xe9, 0xca,
+    0x30, 0xff, 0x83, 0xc5, 0x5a, 0x85, 0xe5, 0xcc, 0xa9, 0x00, 0x0a, 0x02, 0x00, 0xf5, 0xe7, 0xec,
+    0x63, 0x8e, 0xf6, 0xff, 0x20, 0x86, 0x83, 0xc1, 0x11, 0x5d, 0x93, 0xd9, 0x5d, 0x3c, 0xab, 0x0f,
+    0xeb, 0x9d, 0xb5, 0x04, 0x51, 0x19, 0xc0, 0xec, 0xd9, 0x74, 0xfd, 0x91, 0x91, 0x00, 0x1a, 0x02,
+    0x00, 0x04, 0xc3, 0x24, 0xfb, 0xf9, 0x01, 0x52, 0x56, 0x7b, 0xe8, 0xf0, 0x4d, 0xda, 0x05, 0x9c,
+    0x3c, 0x75, 0xbb, 0xec, 0x17, 0xaa, 0x0e, 0x90, 0xbf, 0x0f, 0x39, 0xdd, 0xd2, 0xf5, 0xe1, 0x92,
+    0x61, 0x00, 0x2a, 0x02, 0x00, 0x19, 0x30, 0xee, 0xd3, 0x15, 0x21, 0xad, 0x4d, 0x54, 0x4f, 0x96,
+    0xab, 0xde, 0xa6, 0x8b, 0x83, 0xba, 0x0c, 0x31, 0x09, 0xf7, 0x09, 0xf0, 0xc2, 0xe0, 0xd9, 0x88,
+    0xeb, 0xe9, 0x12, 0x88, 0x29, 0x00, 0x3a, 0x02, 0x00, 0x07, 0xd1, 0x35, 0x2d, 0xe4, 0x8d, 0x1f,
+    0xa9, 0x5d, 0xf8, 0x72, 0xdb, 0x13, 0x17, 0xb1, 0x60, 0x29, 0x38, 0x4a, 0x3f, 0xed, 0xaf, 0xa0,
+    0x17, 0xaf, 0xf9, 0xf3, 0x2f, 0x47, 0x9e, 0xa2, 0x4d, 0x00, 0x4a, 0x02, 0x00, 0xb4, 0x97, 0x21,
+    0x69, 0x87, 0xbb, 0x65, 0xb0, 0x61, 0xed, 0xed, 0xac, 0x18, 0x89, 0xbc, 0x3a, 0xdd, 0x73, 0xb7,
+    0xc4, 0x72, 0x2c, 0x00, 0x7d, 0xbb, 0xfe, 0xd3, 0x0b, 0x57, 0x36, 0xd2, 0x21, 0x00, 0x5a, 0x02,
+    0x00, 0xa0, 0x0f, 0x66, 0x06, 0x18, 0x81, 0xe4, 0x32, 0xe3, 0x2c, 0xdc, 0x00, 0x28, 0x2a, 0x9c,
+    0x5a, 0xdc, 0x16, 0xce, 0x10, 0x88, 0x71, 0xe3, 0x41, 0x2d, 0xd9, 0xf7, 0xbb, 0xe3, 0x93, 0x1a,
+    0x31, 0x00, 0x6a, 0x02, 0x00, 0x25, 0x04, 0x1e, 0xf9, 0x66, 0xb0, 0x3c, 0xe6, 0xbe, 0x98, 0x63,
+    0x8e, 0x33, 0xe4, 0x8e, 0x6b, 0x40, 0x20, 0xdb, 0x9b, 0xe2, 0x86, 0x82, 0xdb, 0xc4, 0xed, 0x8e,
+    0x5e, 0xa0, 0xd6, 0x9d, 0x4e, 0x00, 0x7a, 0x02, 0x00, 0x92, 0xf8, 0xda, 0x64, 0x20, 0xbf, 0xf4,
+    0x5e, 0xd0, 0x25, 0xd4, 0xfe, 0x08, 0x1e, 0x86, 0xa6, 0xd8, 0x65, 0xa7, 0x6b, 0x6a, 0x3a, 0x5c,
+    0x58, 0x22, 0x2c, 0x4d, 0xd7, 0xd7, 0x8f, 0x19, 0x87, 0x00, 0x8a, 0x02, 0x00, 0x56, 0x4a, 0xc6,
+    0x9f, 0x6a, 0xd6, 0xf8, 0x3b, 0xa6, 0xf0, 0xd9, 0xf0, 0x03, 0x64, 0x33, 0x91, 0x8c, 0xdb, 0x75,
+    0xea, 0x49, 0xa9, 0x22, 0x19, 0x39, 0xf4, 0x84, 0x7a, 0x1f, 0x7b, 0x64, 0x28, 0x00, 0x9a, 0x02,
+    0x00, 0x20, 0x5c, 0x34, 0xf3, 0xcc, 0xab, 0x4d, 0x37, 0x2c, 0x96, 0x8e, 0x20, 0xa0, 0xb6, 0xa8,
+    0x61, 0xb4, 0x85, 0xee, 0x95, 0x43, 0xd4, 0xb6, 0x00, 0xe3, 0xf5, 0x7f, 0xf8, 0x51, 0xb2, 0xae,
+    0x1b, 0x00, 0xaa, 0x02, 0x00, 0x35, 0x37, 0x5c, 0xe0, 0x59, 0xf4, 0x38, 0x91, 0x8a, 0x75, 0x47,
+    0x6f, 0xa1, 0xa5, 0x02, 0xe5, 0x33, 0x51, 0xc6, 0xf3, 0xe3, 0xe3, 0xfe, 0x2d, 0x82, 0xf3, 0x71,
+    0x67, 0x4b, 0x75, 0x90, 0xa5, 0x00, 0xba, 0x02, 0x00, 0x6d, 0xdf, 0x66, 0xc3, 0x1d, 0x3f, 0x2f,
+    0x96, 0x11, 0x3e, 0x2e, 0xf2, 0x96, 0xfe, 0x8f, 0xa4, 0xc6, 0xae, 0xb2, 0xa6, 0xd4, 0x0b, 0xd3,
+    0x8f, 0xd9, 0x21, 0xdd, 0x5c, 0x0d, 0xfe, 0x84, 0xe3, 0x00, 0xca, 0x02, 0x00, 0x24, 0xcd, 0x5a,
+    0x22, 0x68, 0xee, 0x70, 0x83, 0x03, 0x42, 0xc2, 0x2d, 0x9b, 0x3d, 0xe9, 0x22, 0x83, 0x2b, 0x69,
+    0xdd, 0x25, 0xe7, 0x0b, 0xa8, 0xf0, 0x48, 0xbe, 0xa8, 0x45, 0x91, 0xd7, 0x7e, 0x00, 0xda, 0x02,
+    0x00, 0x2b, 0x93, 0x70, 0xfa, 0xd5, 0x44, 0x2a, 0x05, 0xad, 0xde, 0x6a, 0x5d, 0xa0, 0x08, 0xcf,
+    0x9a, 0x08, 0x78, 0x71, 0x9e, 0xfb, 0xec, 0x32, 0xa6, 0xfe, 0x29, 0x73, 0x58, 0x69, 0x31, 0xd9,
+    0xd6, 0x00, 0xea, 0x02, 0x00, 0xa8, 0x02, 0xea, 0x27, 0x96, 0x5c, 0x5c, 0x1c, 0xcf, 0x78, 0xe4,
+    0xa8, 0x5d, 0x9b, 0xb3, 0x14, 0x10, 0x78, 0x0b, 0x29, 0x96, 0x22, 0xec, 0xd5, 0xb2, 0x08, 0x9b,
+    0xe9, 0x84, 0x5b, 0x0b, 0x9e, 0x00, 0xfa, 0x02, 0x00, 0xe9, 0x11, 0x57, 0x62, 0x9b, 0x3e, 0xd4,
+    0x69, 0x34, 0xcb, 0x10, 0x68, 0xbd, 0x66, 0xb2, 0x95, 0xba, 0xb5, 0xa5, 0xde, 0x6c, 0x85, 0x6d,
+    0x68, 0x22, 0xf9, 0x5d, 0x2b, 0x71, 0xc5, 0x27, 0x0b, 0x00, 0x0a, 0x03, 0x00, 0x65, 0x44, 0x8e,
+    0x3b, 0x03, 0xf4, 0xc0, 0x4c, 0x54, 0xb1, 0xb4, 0x95, 0xce, 0x20, 0xcd, 0x56, 0xfe, 0x76, 0x4d,
+    0x3c, 0x52, 0x90, 0xae, 0x3c, 0x7c, 0xb2, 0xf3, 0x55, 0x84, 0x59, 0xef, 0x94, 0x00, 0x1a, 0x03,
+    0x00, 0xa5, 0x85, 0x96, 0xf5, 0x96, 0x03, 0x81, 0x6e, 0x43, 0xbf, 0x21, 0x0d, 0x4b, 0x96, 0x84,
+    0xd2, 0x9f, 0xfd, 0x97, 0x2f, 0xe1, 0xaa, 0xfd, 0x6d, 0xda, 0x35, 0xeb, 0x20, 0xeb, 0xc5, 0xae,
+    0x1a, 0x00, 0x2a, 0x03, 0x00, 0x77, 0xdd, 0x3e, 0x24, 0x24, 0x12, 0x8f, 0xda, 0x5f, 0x1e, 0x89,
+    0x4d, 0x30, 0x0a, 0x41, 0x04, 0x1c, 0x08, 0xac, 0x3f, 0xeb, 0x8d, 0x86, 0x66, 0xa8, 0x8a, 0x86,
+    0xff, 0xd9, 0x36, 0x6e, 0x5f, 0x00, 0x3a, 0x03, 0x00, 0xe5, 0xa9, 0x15, 0x24, 0xcc, 0x59, 0xda,
+    0xaa, 0xd0, 0x1a, 0x00, 0x65, 0x91, 0x10, 0xba, 0xf9, 0xcd, 0xe7, 0x0f, 0x91, 0x07, 0xd2, 0x08,
+    0xdf, 0x24, 0x7d, 0xfe, 0x5a, 0xc9, 0x5f, 0x62, 0x28, 0x00, 0x4a, 0x03, 0x00, 0x25, 0x74, 0x93,
+    0x07, 0xfb, 0x7e, 0x81, 0x0f, 0x9e, 0x93, 0x53, 0x12, 0xce, 0x3c, 0xa2, 0x6d, 0xeb, 0xf1, 0xcd,
+    0x9f, 0x43, 0x55, 0x37, 0xda, 0x5d, 0xbb, 0x6c, 0x86, 0xfb, 0xfa, 0xe1, 0x4b, 0x00, 0x5a, 0x03,
+    0x00, 0x52, 0x30, 0x80, 0x2d, 0x43, 0xab, 0x83, 0x16, 0xf9, 0x67, 0x8c, 0x90, 0x94, 0x7a, 0x4c,
+    0xd9, 0x8a, 0xca, 0xae, 0x01, 0xb4, 0x50, 0xa9, 0x5c, 0x97, 0xe2, 0x47, 0x4a, 0x7c, 0x6f, 0xd7,
+    0x12, 0x00, 0x6a, 0x03, 0x00, 0x96, 0x0c, 0x59, 0xa4, 0x2a, 0x8f, 0xf0, 0x78, 0x70, 0x95, 0xe5,
+    0xb5, 0x29, 0x73, 0xbe, 0x30, 0x59, 0xe2, 0x2b, 0xfc, 0x93, 0xa9, 0x62, 0x48, 0xd5, 0x89, 0x12,
+    0x11, 0xc5, 0xae, 0xcd, 0x1c, 0x00, 0x7a, 0x03, 0x00, 0xa8, 0xdc, 0x18, 0x0c, 0x17, 0xf1, 0x4d,
+    0x4d, 0x8f, 0x05, 0x36, 0x97, 0xb8, 0x2b, 0x6d, 0x9f, 0xba, 0x3d, 0x14, 0x87, 0xa3, 0x2c, 0x45,
+    0x7c, 0x83, 0xc2, 0x18, 0xdf, 0x9b, 0xf2, 0xbf, 0x88, 0x00, 0x8a, 0x03, 0x00, 0xf1, 0x2d, 0x01,
+    0x63, 0x7e, 0x1d, 0xa2, 0x9c, 0x59, 0x21, 0x3f, 0x10, 0xe1, 0xd0, 0x3a, 0xf3, 0xc4, 0x3d, 0x1f,
+    0xb4, 0x63, 0x4a, 0x16, 0xdd, 0x9e, 0x23, 0x32, 0x61, 0xe3, 0x48, 0xeb, 0xa6, 0x00, 0x9a, 0x03,
+    0x00, 0xc0, 0xde, 0x50, 0x88, 0xb3, 0x98, 0x1c, 0xdc, 0x1f, 0x98, 0x6d, 0x16, 0x5a, 0x9a, 0x24,
+    0x97, 0x0c, 0x2e, 0x8a, 0x7a, 0x74, 0x03, 0x4e, 0x8e, 0x8a, 0x80, 0x2a, 0x2f, 0xbe, 0xa5, 0xf5,
+    0xc1, 0x00, 0xaa, 0x03, 0x00, 0x74, 0x91, 0x74, 0x9e, 0x10, 0xa9, 0x29, 0x01, 0x07, 0x75, 0x6e,
+    0x5d, 0x24, 0x3e, 0x36, 0x2e, 0x37, 0x2b, 0xa9, 0x73, 0xa1, 0xc3, 0xdc, 0x73, 0x7e, 0x78, 0x5f,
+    0x45, 0x28, 0x11, 0x69, 0x92, 0x00, 0xba, 0x03, 0x00, 0x66, 0x42, 0x92, 0x8a, 0x8a, 0x3b, 0x4b,
+    0x22, 0x05, 0x25, 0x79, 0x6a, 0x05, 0x98, 0xbd, 0xa3, 0x77, 0xc3, 0x75, 0xa4, 0x35, 0x38, 0x7a,
+    0x54, 0x90, 0xde, 0xa2, 0x07, 0x6e, 0xa3, 0x7a, 0x4c, 0x00, 0xca, 0x03, 0x00, 0x32, 0xac, 0x5b,
+    0x41, 0xe0, 0x23, 0x40, 0x78, 0xbc, 0x26, 0xb0, 0x2d, 0xd5, 0x6f, 0xfe, 0x48, 0xe4, 0x88, 0x02,
+    0xfc, 0x36, 0x3f, 0xe8, 0x6f, 0x09, 0x3c, 0xf0, 0x86, 0x75, 0x51, 0x49, 0x11, 0x00, 0xda, 0x03,
+    0x00, 0x3e, 0x42, 0xd9, 0x2f, 0xdc, 0x67, 0x2f, 0xef, 0x7c, 0x26, 0xa2, 0xc6, 0x52, 0xdd, 0x7b,
+    0x82, 0xf9, 0xae, 0xb1, 0x1b, 0xc3, 0x17, 0x8b, 0x1c, 0xc9, 0xea, 0x38, 0x14, 0x42, 0x27, 0x00,
+    0x28, 0x00, 0xea, 0x03, 0x00, 0x26, 0x40, 0xeb, 0xb9, 0x04, 0xfe, 0x13, 0x4a, 0xd2, 0x9b, 0x5b,
+    0x21, 0x85, 0x3d, 0x39, 0x3b, 0xa5, 0xf8, 0xca, 0xd0, 0xf3, 0xdc, 0xc5, 0x3f, 0xb2, 0xb7, 0xd9,
+    0x6e, 0xa5, 0x8c, 0x1d, 0xe7, 0x00, 0xfa, 0x03, 0x00, 0x83, 0xbd, 0x35, 0xcb, 0x04, 0x2f, 0x0f,
+    0xd3, 0x05, 0xfe, 0xef, 0xd9, 0x6b, 0xd8, 0xbf, 0x18, 0x13, 0x17, 0xca, 0x00, 0x96, 0xf3, 0x88,
+    0xfa, 0xf9, 0x40, 0x46, 0x35, 0x51, 0xf5, 0xf6, 0x19, 0x00, 0x0a, 0x04, 0x00, 0xf5, 0xba, 0x05,
+    0x5f, 0xdb, 0x07, 0xa0, 0x3d, 0x75, 0x12, 0x8d, 0x61, 0x9d, 0x26, 0xb3, 0x13, 0x2c, 0xbf, 0x6b,
+    0x94, 0x34, 0x60, 0x9f, 0x99, 0x2c, 0x0c, 0x2a, 0x36, 0x14, 0x47, 0x4a, 0x10, 0x00, 0x0c, 0x04,
+    0x00, 0x0e, 0xb6, 0x3d, 0xb1, 0x9b, 0x25, 0x28, 0x5d, 0x5a, 0xbb, 0xa5, 0x34, 0x12, 0x6d, 0x74,
+    0x33, 0x6e, 0xba, 0x02, 0x4e, 0xe0, 0x49, 0xea, 0x3a, 0x34, 0x2d, 0x0d, 0x50, 0xa0, 0x03, 0xcf,
+    0x22, 0x63, 0xfd, 0xff, 0x37, 0xaf, 0xad, 0x3c, 0xe8, 0x63, 0x2b, 0x67, 0x81, 0x35, 0xd2, 0x61,
+    0x70, 0x28, 0x34, 0xde, 0x6a, 0xc3, 0x8a, 0xfd, 0xb9, 0xc6, 0x80, 0xde, 0xfd, 0x33, 0xd2, 0x1e,
+    0x21, 0xe9, 0x25, 0xba, 0xaf, 0x00, 0x14, 0x04, 0x00, 0xe7, 0x8a, 0x8f, 0xc5, 0x9b, 0xa9, 0x90,
+    0x65, 0x09, 0x28, 0xd2, 0xe5, 0x44, 0x8f, 0x4f, 0x27, 0x8a, 0x50, 0x47, 0x0a, 0x49, 0xd5, 0x61,
+    0xa7, 0x8c, 0x6f, 0x96, 0xa7, 0x89, 0x36, 0x55, 0x84, 0x00, 0x16, 0xf0, 0x0e, 0x0f, 0x2b, 0x30,
+    0x31, 0x76, 0x0a, 0xf0, 0x36, 0x04, 0x20, 0x95, 0x48, 0xbc, 0x9d, 0x9d, 0x33, 0x84, 0x5d, 0xaf,
+    0xc1, 0xc9, 0x56, 0xe8, 0x6c, 0x25, 0x5a, 0x28, 0x1b, 0x78, 0x33, 0xd7, 0x0d, 0x8e, 0x29, 0xcc,
+    0x7f, 0x6a, 0xba, 0x9d, 0xb8, 0x39, 0xaa, 0xa0, 0x82, 0x03, 0x10, 0x30, 0x82, 0x03, 0x0c, 0x30,
+    0x82, 0x01, 0xf4, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x10, 0x10, 0xdc, 0xe6, 0x12, 0x45, 0x0a,
+    0x1a, 0x93, 0x4b, 0xc6, 0x5e, 0x88, 0x99, 0x98, 0x9c, 0x0d, 0x54, 0x00, 0x03, 0xe4, 0x0a, 0xf1,
+    0x3a, 0x01, 0x05, 0x05, 0x00, 0x30, 0x2f, 0x31, 0x2d, 0x30, 0x2b, 0x06, 0x03, 0x55, 0x04, 0x03,
+    0x13, 0x24, 0x57, 0x44, 0x4b, 0x54, 0x65, 0x73, 0x74, 0x43, 0x65, 0x72, 0x74, 0x20, 0x64, 0x72,
+    0x69, 0x63, 0x73, 0x2c, 0x31, 0x33, 0x33, 0x31, 0x33, 0x34, 0x32, 0x36, 0x30, 0x39, 0x38, 0x35,
+    0x36, 0x34, 0x33, 0x37, 0x38, 0x35, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x32, 0x31, 0x31, 0x32, 0x30,
+    0x31, 0x33, 0x35, 0x34, 0x35, 0x38, 0x5a, 0x17, 0x0d, 0x33, 0x0f, 0x00, 0x02, 0x01, 0x00, 0x1f,
+    0x5a, 0x51, 0x00, 0x1f, 0x38, 0x82, 0x01, 0x22, 0x95, 0x00, 0xf0, 0xff, 0x1b, 0x01, 0x05, 0x00,
+    0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xc1, 0x7e,
+    0x94, 0x74, 0x7c, 0xd7, 0xe7, 0x98, 0x3e, 0x47, 0x78, 0xf7, 0x9d, 0xcd, 0xd5, 0x01, 0x10, 0x09,
+    0xba, 0x16, 0xbf, 0x2e, 0xb8, 0xc0, 0x12, 0x15, 0x30, 0x15, 0x58, 0xb3, 0x7e, 0xee, 0x9b, 0x59,
+    0x1f, 0x41, 0xb4, 0x12, 0xfc, 0x9b, 0x9d, 0xb2, 0x59, 0xd1, 0x76, 0xc1, 0xfc, 0xaf, 0x68, 0xf6,
+    0xf4, 0xcc, 0x96, 0x8d, 0xd2, 0x37, 0x71, 0x3b, 0x06, 0x32, 0x3c, 0xf2, 0xfe, 0x1d, 0xcf, 0x8f,
+    0xa5, 0xf6, 0x1a, 0x2a, 0xbf, 0x9c, 0x7c, 0xbd, 0x97, 0xca, 0x24, 0x41, 0x1a, 0x17, 0x18, 0x38,
+    0xe5, 0xa4, 0x5a, 0x53, 0x82, 0x2e, 0x9f, 0x5c, 0xa7, 0xb3, 0x66, 0x30, 0x21, 0x48, 0x17, 0x79,
+    0xe3, 0x72, 0xab, 0xde, 0x3e, 0xba, 0xfb, 0x33, 0xf0, 0x5d, 0xd8, 0x86, 0x44, 0xcc, 0xe6, 0x94,
+    0x06, 0x50, 0x8f, 0x5a, 0x2d, 0x1e, 0x5c, 0xda, 0xaa, 0xef, 0x80, 0xb9, 0x16, 0x51, 0xec, 0xae,
+    0xd6, 0xfd, 0x48, 0xd6, 0x80, 0xd9, 0xf0, 0x58, 0xb2, 0xb4, 0x39, 0x28, 0x03, 0xef, 0xdd, 0xca,
+    0x68, 0x74, 0x5d, 0xc7, 0x2b, 0xa8, 0x19, 0x9c, 0x22, 0x9c, 0x72, 0xce, 0x09, 0xb1, 0xa8, 0x63,
+    0x6a, 0xbb, 0xec, 0xb0, 0x26, 0x44, 0xc9, 0xc1, 0xb9, 0xa0, 0x7b, 0x25, 0x28, 0xa9, 0x60, 0xe3,
+    0x54, 0x29, 0x49, 0x03, 0x9e, 0x0d, 0x60, 0xbf, 0x38, 0x0f, 0xc9, 0x62, 0x6d, 0x19, 0x4c, 0x45,
+    0x21, 0x08, 0xec, 0xaa, 0xb0, 0x7b, 0x06, 0xa1, 0x13, 0x9f, 0x68, 0x38, 0x53, 0xd9, 0x4c, 0x1b,
+    0xcb, 0xd5, 0xd9, 0x7d, 0x64, 0x1c, 0x27, 0xd9, 0x30, 0xbe, 0xb8, 0xa3, 0xf5, 0xcf, 0x7e, 0xc3,
+    0xbb, 0x82, 0xca, 0x38, 0xca, 0x66, 0xe6, 0x84, 0x6f, 0x31, 0x9b, 0x5b, 0x3e, 0x95, 0x34, 0x23,
+    0x03, 0xca, 0x23, 0x4a, 0x59, 0xd3, 0x2f, 0x1f, 0x80, 0xb0, 0x9b, 0x81, 0xf9, 0x89, 0x02, 0x03,
+    0x01, 0x00, 0x01, 0xa3, 0x24, 0x30, 0x22, 0x30, 0x0b, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x04, 0x04,
+    0x03, 0x02, 0x04, 0x30, 0x30, 0x13, 0x0d, 0x00, 0xfb, 0x00, 0x25, 0x04, 0x0c, 0x30, 0x0a, 0x06,
+    0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x03, 0xdd, 0x01, 0x10, 0x03, 0x3f, 0x01, 0xff,
+    0xfe, 0x44, 0xa2, 0x35, 0x5f, 0x19, 0x5c, 0x5a, 0xfd, 0xb7, 0xa7, 0x10, 0xe6, 0x73, 0x9b, 0xf0,
+    0x96, 0x95, 0x93, 0xa4, 0x92, 0xed, 0x7e, 0x02, 0xd6, 0x71, 0xc8, 0x03, 0x16, 0x66, 0x9c, 0x23,
+    0xdd, 0x5e, 0xb2, 0xba, 0xa2, 0x0d, 0x17, 0xbd, 0x7e, 0x83, 0xda, 0xcc, 0x66, 0x3c, 0x7b, 0xdc,
+    0x2d, 0xa6, 0xa0, 0x3e, 0xa8, 0x92, 0xe0, 0x21, 0x23, 0xad, 0xca, 0xa4, 0x6a, 0xff, 0x67, 0x2f,
+    0x9a, 0x14, 0xdd, 0x85, 0x8b, 0x43, 0x02, 0xfc, 0xb0, 0x5e, 0xb7, 0x18, 0xa1, 0x80, 0x86, 0x6a,
+    0xa2, 0xe2, 0x9a, 0x17, 0x7b, 0xca, 0x24, 0xe0, 0x51, 0xe5, 0x76, 0x86, 0x9f, 0xba, 0xc1, 0xa3,
+    0x39, 0x56, 0x00, 0x9e, 0xb7, 0xa7, 0xbd, 0x11, 0xe2, 0x51, 0x4f, 0x99, 0x0e, 0x35, 0x02, 0x6e,
+    0xe2, 0x07, 0x67, 0xc0, 0xcd, 0x74, 0xe7, 0x4b, 0xa8, 0x97, 0x0d, 0xb4, 0x19, 0x77, 0x23, 0x04,
+    0x86, 0x5b, 0xec, 0xc1, 0xc9, 0x4a, 0x15, 0xec, 0xeb, 0x99, 0x80, 0x54, 0x58, 0x9e, 0x7d, 0x98,
+    0x07, 0x36, 0xd3, 0x7e, 0x2c, 0x5c, 0x1b, 0xb4, 0xc8, 0x5b, 0xf7, 0xdf, 0xd4, 0xd4, 0x73, 0xe9,
+    0xd9, 0x9e, 0x96, 0x7c, 0x1b, 0xc8, 0x58, 0x9e, 0xa5, 0x3c, 0x83, 0x41, 0xe7, 0x32, 0x35, 0xdb,
+    0x4d, 0xc6, 0x84, 0x50, 0x79, 0x60, 0x95, 0x43, 0xc3, 0x01, 0x43, 0x66, 0xc3, 0xd1, 0xb7, 0x46,
+    0x1f, 0x77, 0x47, 0xb6, 0xd8, 0x97, 0x6f, 0x32, 0x04, 0x5b, 0x85, 0xaa, 0x31, 0x15, 0x63, 0xe1,
+    0xf2, 0x6f, 0x67, 0xce, 0x42, 0x40, 0xfb, 0xf1, 0x36, 0xa6, 0x6a, 0x80, 0xe3, 0x66, 0xb6, 0x86,
+    0x60, 0x3c, 0xe4, 0x6a, 0x50, 0x92, 0x7e, 0x41, 0x3e, 0xdd, 0xaa, 0x10, 0x6a, 0xe2, 0x16, 0x10,
+    0x59, 0x30, 0x68, 0xbb, 0x39, 0x9d, 0xd0, 0x7a, 0x5b, 0xa3, 0xf4, 0xd9, 0xc9, 0x04, 0xc8, 0x87,
+    0x6d, 0x31, 0x82, 0x01, 0xec, 0x30, 0x82, 0x01, 0xe8, 0x02, 0x01, 0x01, 0x30, 0x43, 0x9e, 0x02,
+    0x1e, 0x0f, 0x41, 0x03, 0x03, 0x07, 0x95, 0x03, 0x37, 0xa0, 0x7c, 0x30, 0xba, 0x0d, 0x85, 0x01,
+    0x0c, 0x31, 0x02, 0x30, 0x00, 0x30, 0x19, 0x87, 0x01, 0x48, 0x09, 0x03, 0x31, 0x0c, 0x2a, 0x0e,
+    0x27, 0x30, 0x1c, 0x0e, 0x00, 0x48, 0x0b, 0x31, 0x0e, 0x30, 0x1e, 0x00, 0x36, 0x15, 0x30, 0x2f,
+    0x39, 0x00, 0xfb, 0x16, 0x04, 0x31, 0x22, 0x04, 0x20, 0x35, 0xfe, 0x43, 0xd3, 0x7d, 0x62, 0x66,
+    0xe9, 0xf6, 0x3c, 0x7a, 0x09, 0xec, 0x70, 0x77, 0x81, 0x6b, 0x51, 0x23, 0xe1, 0xd1, 0x49, 0x80,
+    0x27, 0xd4, 0xcf, 0x8e, 0x1e, 0x3c, 0x06, 0x0e, 0xdc, 0x39, 0x03, 0xf0, 0xf6, 0x04, 0x82, 0x01,
+    0x00, 0x71, 0x64, 0x8e, 0x4b, 0xfc, 0x84, 0xc8, 0x96, 0x41, 0xfc, 0x8d, 0xa9, 0xdb, 0xe6, 0x23,
+    0x2b, 0xe4, 0x49, 0x6f, 0x49, 0xe2, 0x3a, 0x56, 0x1a, 0x7c, 0x90, 0x5e, 0x9c, 0x89, 0x6b, 0xab,
+    0x78, 0xea, 0xf3, 0xc0, 0xef, 0x3a, 0xcf, 0xf5, 0x2a, 0x19, 0xa0, 0xd4, 0x64, 0x5a, 0xaa, 0x5d,
+    0x98, 0x3a, 0x5c, 0x3c, 0x9b, 0x25, 0xc0, 0xaa, 0x89, 0xb4, 0xca, 0xa0, 0xf7, 0xcd, 0x4b, 0xca,
+    0xb6, 0xd9, 0xc7, 0x5d, 0xf0, 0x66, 0x0e, 0xfe, 0x07, 0xea, 0x0b, 0x3a, 0xf3, 0x23, 0x98, 0x05,
+    0xe7, 0xbc, 0xde, 0xa2, 0xe8, 0x41, 0x02, 0x37, 0xde, 0xdb, 0x1a, 0x34, 0xdc, 0x38, 0xed, 0xa4,
+    0x46, 0x2b, 0x42, 0x59, 0x73, 0x41, 0x29, 0xd2, 0xd9, 0x43, 0xc5, 0x40, 0x11, 0x54, 0x52, 0x63,
+    0x5a, 0xe3, 0x89, 0xb0, 0x24, 0xb6, 0x20, 0xef, 0x68, 0x2f, 0xb6, 0x8c, 0xd3, 0x55, 0x28, 0xf1,
+    0x80, 0x7b, 0xf3, 0xa4, 0xea, 0x06, 0x76, 0x04, 0xb7, 0x3e, 0xd7, 0x07, 0xd7, 0xb3, 0x10, 0x0c,
+    0x82, 0xcb, 0x96, 0xb0, 0xea, 0x2c, 0xc7, 0x8c, 0xec, 0xef, 0x97, 0x7d, 0x60, 0x15, 0x78, 0x1c,
+    0x05, 0x5f, 0x9f, 0x56, 0x9f, 0x56, 0xc6, 0xe8, 0x6e, 0xb3, 0xe4, 0x40, 0x0a, 0xcd, 0xb8, 0x5d,
+    0x75, 0x1a, 0xa1, 0xc7, 0x78, 0xbc, 0xfc, 0xea, 0xcc, 0xa0, 0x17, 0x44, 0xef, 0x5c, 0x51, 0x75,
+    0x67, 0xfb, 0x4d, 0xfc, 0x47, 0x15, 0x79, 0xbb, 0x36, 0x79, 0xdc, 0x36, 0x66, 0x57, 0x62, 0x91,
+    0x32, 0xaf, 0xb3, 0x2e, 0xd6, 0x95, 0x05, 0xd2, 0x5b, 0xba, 0x26, 0xd0, 0x4a, 0x94, 0x40, 0xa1,
+    0xe2, 0x6d, 0x3c, 0xfb, 0x00, 0xfa, 0xe1, 0x31, 0x99, 0x32, 0x4c, 0xaa, 0x0e, 0x78, 0x38, 0x1b,
+    0x1f, 0xbb, 0x0c, 0xe2, 0x35, 0xc0, 0x8d, 0x8d, 0x71, 0x18, 0x2c, 0x6a, 0x13, 0xe5, 0x4e, 0x8c,
+    0x33, 0x00,
+  };
+}
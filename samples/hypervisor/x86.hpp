@@ -216,7 +216,7 @@ namespace hh::x86
         uint64_t os_fxsave_fxrstor_support : 1;
         uint64_t os_xmm_exception_support : 1;
         uint64_t usermode_instruction_prevention : 1;
-        uint64_t reserved_1 : 1;
+        uint64_t linear_addresses_57_bit : 1;
         uint64_t vmx_enable : 1;
         uint64_t smx_enable : 1;
         uint64_t reserved_2 : 1;
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <x86intrin.h>
+#include <cpuid.h>
+
+// <cpuid.h> defines __cpuid as a macro with the GCC argument order.
+#undef __cpuid
+
+// Host stand-in for the MSVC <intrin.h>. Privileged intrinsics are only declared so hypervisor
+// headers compile, tests never execute them.
+
+extern "C"
+{
+  unsigned __int64 __readcr0();
+  unsigned __int64 __readcr2();
+  unsigned __int64 __readcr3();
+  unsigned __int64 __readcr4();
+  unsigned __int64 __readcr8();
+  void __writecr0(unsigned __int64 value);
+  void __writecr2(unsigned __int64 value);
+  void __writecr3(unsigned __int64 value);
+  void __writecr4(unsigned __int64 value);
+  void __writecr8(unsigned __int64 value);
+  unsigned __int64 __readmsr(unsigned long msr);
+  void __writemsr(unsigned long msr, unsigned __int64 value);
+  unsigned __int64 __readgsqword(unsigned long offset);
+  void __writegsqword(unsigned long offset, unsigned __int64 value);
+  void __invlpg(void* address);
+  void __halt();
+  void __int2c();
+  unsigned char __vmx_vmread(size_t field, size_t* value);
+  unsigned char __vmx_vmwrite(size_t field, size_t value);
+  unsigned char __vmx_vmlaunch();
+  unsigned char __vmx_vmresume();
+  unsigned char __vmx_on(unsigned __int64* vmxon_region);
+  void __vmx_off();
+  unsigned char __vmx_vmclear(unsigned __int64* vmcs);
+  unsigned char __vmx_vmptrld(unsigned __int64* vmcs);
+  unsigned char __inbyte(unsigned short port);
+  void __outbyte(unsigned short port, unsigned char value);
+}
+
+inline void __debugbreak() noexcept { __builtin_trap(); }
+
+inline void __cpuid(int info[4], int leaf) noexcept
+{
+  __cpuid_count(leaf, 0, info[0], info[1], info[2], info[3]);
+}
+
+inline void __stosq(unsigned __int64* destination, unsigned __int64 value, size_t count) noexcept
+{
+  for (size_t j = 0; j < count; j++)
+  {
+    destination[j] = value;
+  }
+}
+
+inline unsigned char _BitScanForward(unsigned long* index, unsigned long mask) noexcept
+{
+  // MSVC leaves index undefined for zero mask, zero keeps GCC from warning about it.
+  if (!mask)
+  {
+    *index = 0;
+    return 0;
+  }
+
+  *index = __builtin_ctzl(mask);
+  return 1;
+}
+
+inline unsigned char _BitScanForward64(unsigned long* index, unsigned __int64 mask) noexcept
+{
+  if (!mask)
+  {
+    *index = 0;
+    return 0;
+  }
+
+  *index = __builtin_ctzll(mask);
+  return 1;
+}
+
+inline unsigned char _BitScanReverse64(unsigned long* index, unsigned __int64 mask) noexcept
+{
+  if (!mask)
+  {
+    *index = 0;
+    return 0;
+  }
+
+  *index = 63 - __builtin_clzll(mask);
+  return 1;
+}
+
+inline unsigned char _interlockedbittestandset(volatile long* base, long bit) noexcept
+{
+  return (__atomic_fetch_or(base, 1l << bit, __ATOMIC_SEQ_CST) >> bit) & 1;
+}
+
+inline long _InterlockedExchange(volatile long* target, long value) noexcept
+{
+  return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+
+inline long _InterlockedCompareExchange(volatile long* destination, long exchange, long comparand) noexcept
+{
+  __atomic_compare_exchange_n(destination, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return comparand;
+}
+
+inline long _InterlockedIncrement(volatile long* addend) noexcept
+{
+  return __atomic_add_fetch(addend, 1, __ATOMIC_SEQ_CST);
+}
+
+inline long _InterlockedDecrement(volatile long* addend) noexcept
+{
+  return __atomic_sub_fetch(addend, 1, __ATOMIC_SEQ_CST);
+}
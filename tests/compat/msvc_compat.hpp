@@ -0,0 +1,15 @@
+#pragma once
+
+// Forced into every test translation unit. Maps the few MSVC extensions used by hypervisor headers.
+// Sources compiled by tests are additionally rewritten by hh_import_sources, see CMakeLists.txt.
+
+// std::exception constructed from a message is rewritten to std::runtime_error.
+#include <stdexcept>
+
+#define __int64 long long
+#define abstract
+#define __declspec(specifier) __declspec_##specifier
+#define __declspec_align(alignment) __attribute__((aligned(alignment)))
+#define __declspec_noreturn __attribute__((noreturn))
+#define __declspec_noinline __attribute__((noinline))
+#define __forceinline inline __attribute__((always_inline))
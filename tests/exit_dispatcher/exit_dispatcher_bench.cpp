@@ -0,0 +1,282 @@
+#include <vector>
+#include "test_support.hpp"
+#include "vmexit_handler.hpp"
+
+// Cost per dispatch of exit_dispatcher against the table of pointers to virtual members
+// that vmexit_handler used before, with the handler set of kernel_hook_assistant and empty handlers.
+
+using namespace hh;
+using namespace hh::hv_event_handlers;
+using vmx::exit_reason;
+
+namespace
+{
+  constexpr size_t exit_reasons_count = 66;
+
+  uint64_t stub_calls = 0;
+  void (*captured_dispatch)(vmexit_handler*, uint64_t, common::guest_regs*, vcpu*) = nullptr;
+}
+
+// Definitions from vmexit_handler.cpp and exception_interceptor.cpp that can't be linked on the host.
+namespace hh::hv_event_handlers
+{
+  vmexit_handler::vmexit_handler(dispatch_routine routine) noexcept : dispatch_{ routine }
+  {
+    captured_dispatch = routine;
+  }
+
+  void vmexit_handler::handler_stub(common::guest_regs* regs, vcpu* cpu_obj) noexcept
+  {
+    stub_calls++;
+  }
+}
+
+namespace hh
+{
+  exception_interceptor::exception_interceptor() noexcept : interceptions_{}, interceptions_count_{}
+  {}
+}
+
+namespace
+{
+  // Every handler counts its own exit reason, so both dispatchers can be checked against the expected counts.
+  struct exit_counters
+  {
+    uint64_t counts[exit_reasons_count] = {};
+
+    void hit(common::guest_regs* regs, exit_reason reason) noexcept
+    {
+      counts[static_cast<uint16_t>(reason)]++;
+      regs->rax++;
+    }
+  };
+
+#define HH_BENCH_HANDLERS(X)                                                \
+  X(xsetbv, execute_xsetbv)                                                 \
+  X(init, init_signal)                                                      \
+  X(pending_virt_nmi, nmi_window)                                           \
+  X(exception_nmi, exception_or_nmi)                                        \
+  X(triple_fault, triple_fault)                                             \
+  X(sipi, startup_ipi)                                                      \
+  X(vmclear, execute_vmclear)                                               \
+  X(vmlaunch, execute_vmlaunch)                                             \
+  X(vmptrld, execute_vmptrld)                                               \
+  X(vmptrst, execute_vmptrst)                                               \
+  X(vmread, execute_vmread)                                                 \
+  X(vmresume, execute_vmresume)                                             \
+  X(vmwrite, execute_vmwrite)                                               \
+  X(vmxoff, execute_vmxoff)                                                 \
+  X(vmxon, execute_vmxon)                                                   \
+  X(cr_access, mov_cr)                                                      \
+  X(msr_read, execute_rdmsr)                                                \
+  X(msr_write, execute_wrmsr)                                               \
+  X(cpuid, execute_cpuid)                                                   \
+  X(io_instruction, execute_io_instruction)                                 \
+  X(ept_violation, ept_violation)                                           \
+  X(ept_misconfig, ept_misconfiguration)                                    \
+  X(vmcall, execute_vmcall)                                                 \
+  X(monitor_trap_flag, monitor_trap_flag)                                   \
+  X(hlt, execute_hlt)                                                       \
+  X(invlpg, execute_invlpg)                                                 \
+  X(vmx_preemption_timer_expired, vmx_preemption_timer_expired)
+
+  // Handler set of kernel_hook_assistant dispatched by exit_dispatcher.
+  class composed_handler final : public exit_dispatcher<composed_handler>
+  {
+    friend class exit_dispatcher<composed_handler>;
+
+  public:
+    exit_counters counters;
+
+  private:
+#define HH_COMPOSED_HANDLER(name, reason)                                   \
+    __declspec(noinline) void handle_##name(common::guest_regs* regs, vcpu* cpu_obj) { counters.hit(regs, exit_reason::reason); }
+    HH_BENCH_HANDLERS(HH_COMPOSED_HANDLER)
+#undef HH_COMPOSED_HANDLER
+  };
+
+  // vmexit_handler before exit_dispatcher: virtual handlers called through a table of member pointers.
+  class legacy_handler
+  {
+  protected:
+    using vm_handler = void(legacy_handler::*)(common::guest_regs* regs, vcpu* cpu_obj);
+
+    vm_handler handlers_[exit_reasons_count];
+
+  public:
+    exit_counters counters;
+
+    legacy_handler() noexcept
+    {
+      for (auto& handler : handlers_)
+      {
+        handler = &legacy_handler::handle_stub;
+      }
+
+#define HH_LEGACY_SLOT(name, reason) handlers_[static_cast<uint16_t>(exit_reason::reason)] = &legacy_handler::handle_##name;
+      HH_BENCH_HANDLERS(HH_LEGACY_SLOT)
+#undef HH_LEGACY_SLOT
+    }
+
+    virtual ~legacy_handler() = default;
+
+    void dispatch(uint64_t reason, common::guest_regs* regs, vcpu* cpu_obj)
+    {
+      const vm_handler handler = handlers_[reason];
+      (this->*handler)(regs, cpu_obj);
+    }
+
+    void handle_stub(common::guest_regs* regs, vcpu* cpu_obj) { stub_calls++; }
+
+#define HH_LEGACY_VIRTUAL(name, reason) virtual void handle_##name(common::guest_regs* regs, vcpu* cpu_obj) { handle_stub(regs, cpu_obj); }
+    HH_BENCH_HANDLERS(HH_LEGACY_VIRTUAL)
+#undef HH_LEGACY_VIRTUAL
+  };
+
+  class legacy_kernel_hook_assistant final : public legacy_handler
+  {
+  public:
+#define HH_LEGACY_OVERRIDE(name, reason)                                    \
+    __declspec(noinline) void handle_##name(common::guest_regs* regs, vcpu* cpu_obj) override { counters.hit(regs, exit_reason::reason); }
+    HH_BENCH_HANDLERS(HH_LEGACY_OVERRIDE)
+#undef HH_LEGACY_OVERRIDE
+  };
+
+  struct exit_weight
+  {
+    exit_reason reason;
+    uint32_t weight;
+  };
+
+  // Reasons go in random order, so branch prediction sees the same mix as on a busy guest.
+  std::vector<uint16_t> make_sequence(std::initializer_list<exit_weight> mix)
+  {
+    std::vector<uint16_t> weighted;
+
+    for (const auto& [reason, weight] : mix)
+    {
+      weighted.insert(weighted.end(), weight, static_cast<uint16_t>(reason));
+    }
+
+    std::vector<uint16_t> sequence(4096);
+    uint64_t seed = 0x9e3779b97f4a7c15;
+
+    for (auto& reason : sequence)
+    {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+      reason = weighted[(seed >> 33) % weighted.size()];
+    }
+
+    return sequence;
+  }
+
+  // Pointers are hidden from the optimizer, like the handler and the dispatch routine read from globals in production.
+  template <typename T>
+  T* opaque(T* pointer) noexcept
+  {
+    asm volatile("" : "+r"(pointer));
+    return pointer;
+  }
+
+  void bench_mix(const char* name, const std::vector<uint16_t>& sequence)
+  {
+    composed_handler composed;
+    legacy_kernel_hook_assistant legacy;
+    common::guest_regs regs = {};
+    auto dispatch = opaque(captured_dispatch);
+    vmexit_handler* composed_base = opaque(static_cast<vmexit_handler*>(&composed));
+    legacy_handler* legacy_base = opaque(static_cast<legacy_handler*>(&legacy));
+
+    const uint64_t stub_calls_before = stub_calls;
+
+    for (const uint16_t reason : sequence)
+    {
+      dispatch(composed_base, reason, &regs, nullptr);
+      legacy_base->dispatch(reason, &regs, nullptr);
+    }
+
+    uint64_t expected[exit_reasons_count] = {};
+
+    for (const uint16_t reason : sequence)
+    {
+      expected[reason]++;
+    }
+
+    for (size_t j = 0; j < exit_reasons_count; j++)
+    {
+      CHECK(composed.counters.counts[j] == expected[j]);
+      CHECK(legacy.counters.counts[j] == expected[j]);
+    }
+
+    CHECK(stub_calls == stub_calls_before);
+
+    const double composed_ns = test::measure([&]
+    {
+      for (const uint16_t reason : sequence)
+      {
+        dispatch(composed_base, reason, &regs, nullptr);
+      }
+    }) / sequence.size();
+
+    const double legacy_ns = test::measure([&]
+    {
+      for (const uint16_t reason : sequence)
+      {
+        legacy_base->dispatch(reason, &regs, nullptr);
+      }
+    }) / sequence.size();
+
+    test::keep(regs.rax);
+
+    std::printf("  %-10s exit_dispatcher %5.2f ns, member pointer table %5.2f ns per dispatch\n", name, composed_ns, legacy_ns);
+  }
+
+  // Reasons without a handler reach handler_stub through both dispatchers.
+  void test_unhandled_reasons()
+  {
+    composed_handler composed;
+    legacy_kernel_hook_assistant legacy;
+    common::guest_regs regs = {};
+
+    const uint64_t stub_calls_before = stub_calls;
+    const uint16_t unhandled[] =
+    {
+      static_cast<uint16_t>(exit_reason::execute_rdtsc), static_cast<uint16_t>(exit_reason::execute_wbinvd),
+      35, 38, 42 // reserved
+    };
+
+    for (const uint16_t reason : unhandled)
+    {
+      captured_dispatch(&composed, reason, &regs, nullptr);
+      legacy.dispatch(reason, &regs, nullptr);
+    }
+
+    CHECK(stub_calls - stub_calls_before == 2 * std::size(unhandled));
+    CHECK(regs.rax == 0);
+  }
+}
+
+int main()
+{
+  CHECK(captured_dispatch == nullptr);
+  test_unhandled_reasons();
+  CHECK(captured_dispatch != nullptr);
+
+  bench_mix("hot", make_sequence({
+    { exit_reason::ept_violation, 1 }, { exit_reason::monitor_trap_flag, 1 }, { exit_reason::execute_cpuid, 1 },
+    { exit_reason::execute_vmcall, 1 }, { exit_reason::mov_cr, 1 } }));
+
+  bench_mix("cold", make_sequence({
+    { exit_reason::execute_rdmsr, 1 }, { exit_reason::execute_wrmsr, 1 }, { exit_reason::execute_xsetbv, 1 },
+    { exit_reason::vmx_preemption_timer_expired, 1 }, { exit_reason::execute_hlt, 1 }, { exit_reason::execute_invlpg, 1 },
+    { exit_reason::execute_io_instruction, 1 } }));
+
+  // EPT hooks produce an EPT violation and an MTF exit per hooked page access.
+  bench_mix("hooked", make_sequence({
+    { exit_reason::ept_violation, 30 }, { exit_reason::monitor_trap_flag, 30 }, { exit_reason::execute_cpuid, 10 },
+    { exit_reason::mov_cr, 8 }, { exit_reason::execute_rdmsr, 6 }, { exit_reason::execute_wrmsr, 6 },
+    { exit_reason::execute_vmcall, 3 }, { exit_reason::vmx_preemption_timer_expired, 3 }, { exit_reason::execute_xsetbv, 2 },
+    { exit_reason::execute_hlt, 1 }, { exit_reason::execute_invlpg, 1 } }));
+
+  return test::finish("exit_dispatcher_bench");
+}
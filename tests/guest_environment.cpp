@@ -0,0 +1,141 @@
+#include "guest_environment.hpp"
+#include <stdexcept>
+#include "common.hpp"
+#include "globals.hpp"
+#include "per_cpu_data.hpp"
+#include "vcpu.hpp"
+
+namespace
+{
+  hh::test::guest_environment* current_environment = nullptr;
+
+  // Only the address of the vcpu is used, its methods needed by the imported sources are defined below.
+  alignas(hh::vcpu) uint8_t vcpu_storage[sizeof(hh::vcpu)];
+  hh::vcpu* const test_vcpu = reinterpret_cast<hh::vcpu*>(vcpu_storage);
+}
+
+namespace hh::test
+{
+  guest_environment::guest_environment() : translations{ std::make_unique<pt::translation_cache>(*test_vcpu) }
+  {
+    current_environment = this;
+    globals::pt_handler = &handler;
+  }
+
+  guest_environment::~guest_environment()
+  {
+    globals::pt_handler = nullptr;
+    current_environment = nullptr;
+  }
+
+  guest_environment& guest_environment::current() noexcept
+  {
+    return *current_environment;
+  }
+}
+
+// Definitions from common.cpp, vcpu.cpp, per_cpu_data.cpp and pt_handler.cpp that can't be linked on the host.
+namespace hh
+{
+  namespace common
+  {
+    void* memcpy_128bit(void* dest, const void* src, size_t len) noexcept
+    {
+      const auto* s = static_cast<const __m128i*>(src);
+      auto d = static_cast<__m128i*>(dest);
+
+      while (len--)
+      {
+        _mm_storeu_si128(d++, _mm_lddqu_si128(s++));
+      }
+
+      return dest;
+    }
+
+    void* physical_address_to_virtual_address(uint64_t physical_address)
+    {
+      return reinterpret_cast<void*>(physical_address);
+    }
+
+    uint32_t try_walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+      uint64_t& physical_address, uint64_t& page_size, guest_walk_path& path) noexcept
+    {
+      const uint32_t levels = guest_cr4.flags.linear_addresses_57_bit ? 5 : 4;
+
+      path.count = 0;
+
+      return pt::walk_page_tables(guest_cr3.flags.page_frame_number << page_shift, levels, virtual_address,
+        [](uint64_t table_address, uint64_t index) -> const volatile uint64_t*
+        {
+          return static_cast<const volatile uint64_t*>(physical_address_to_virtual_address(table_address)) + index;
+        },
+        [&path](const volatile uint64_t* entry, uint64_t value)
+        {
+          path.entries[path.count] = entry;
+          path.values[path.count] = value;
+          path.count++;
+        },
+        physical_address, page_size);
+    }
+
+    uint64_t walk_guest_page_tables(x86::cr3_t guest_cr3, x86::cr4_t guest_cr4, uint64_t virtual_address,
+      uint64_t& page_size, guest_walk_path& path)
+    {
+      uint64_t physical_address;
+
+      if (const uint32_t missing_level = try_walk_guest_page_tables(guest_cr3, guest_cr4, virtual_address, physical_address, page_size, path))
+      {
+        throw std::runtime_error{ pt::not_present_messages[missing_level - 1] };
+      }
+
+      return physical_address;
+    }
+  }
+
+  x86::cr3_t vcpu::guest_cr3() const noexcept
+  {
+    return test::guest_environment::current().cr3;
+  }
+
+  x86::cr4_t vcpu::guest_cr4() const noexcept
+  {
+    return test::guest_environment::current().cr4;
+  }
+
+  pt::translation_cache& vcpu::translations() noexcept
+  {
+    return *test::guest_environment::current().translations;
+  }
+
+  vcpu* per_cpu_data::get_vcpu() noexcept
+  {
+    return test_vcpu;
+  }
+
+  namespace pt
+  {
+    pt_handler::pt_handler() : host_pt_table_{}, pml4_index_for_host_guest_mappings_{}, windows_per_cpu_{}
+    {}
+
+    pt_handler::~pt_handler() noexcept
+    {}
+
+    bool pt_handler::is_identity_mapped(uint64_t physical_address) const noexcept
+    {
+      const test::guest_environment& environment = test::guest_environment::current();
+      return physical_address < environment.pinned_begin || physical_address >= environment.pinned_end;
+    }
+
+    // Frame stays accessible through its host address, only the pins are counted.
+    void* pt_handler::pin_guest_frame(uint64_t page_frame_number)
+    {
+      test::guest_environment::current().pinned_frames++;
+      return common::physical_address_to_virtual_address(page_frame_number << common::page_shift);
+    }
+
+    void pt_handler::unpin_guest_frame(const void* host_address) noexcept
+    {
+      test::guest_environment::current().pinned_frames--;
+    }
+  }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "x86.hpp"
+#include "pt_handler.hpp"
+#include "translation_cache.hpp"
+
+// Hypervisor functions that guest memory access depends on, for tests that import guest_memory.cpp
+// and translation_cache.cpp. Host addresses serve as guest physical addresses, like the identity
+// mapping of root mode does in the hypervisor, so guest page tables can be built in host memory.
+namespace hh::test
+{
+  class guest_environment : non_relocatable
+  {
+  public:
+    x86::cr3_t cr3 = {};
+    x86::cr4_t cr4 = {};
+
+    // Host range whose frames play the part of memory above the identity mapping. Such frames are pinned by pt_handler.
+    uint64_t pinned_begin = 0;
+    uint64_t pinned_end = 0;
+    int64_t pinned_frames = 0;
+
+    pt::pt_handler handler;
+    std::unique_ptr<pt::translation_cache> translations;
+
+    // Only one environment may exist at a time.
+    guest_environment();
+    ~guest_environment();
+
+    static guest_environment& current() noexcept;
+  };
+}
@@ -0,0 +1,403 @@
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <vector>
+#include "test_support.hpp"
+#include "guest_environment.hpp"
+#include "guest_memory.hpp"
+#include "common.hpp"
+
+// pt::guest_memory over synthetic 4-level guest page tables built in host memory.
+// Also compares it with the per byte access through a list of pages that map_guest_address used before.
+
+using namespace hh;
+
+namespace
+{
+  constexpr uint64_t page_size = common::page_size;
+  constexpr uint64_t present = 1ull << 0;
+  constexpr uint64_t writable = 1ull << 1;
+  constexpr uint64_t large_page = 1ull << 7;
+
+  // PML4 index 0x1f0, the same region Windows uses for its kernel.
+  constexpr uint64_t guest_base = 0xfffff80000000000;
+
+  // Guest pages 0-63 are physically contiguous, 64-127 are scattered, 128-131 lie above the host identity
+  // mapping and 132 isn't present. PML2 entry 1 maps a 2MB page.
+  constexpr uint32_t contiguous_first = 0;
+  constexpr uint32_t scattered_first = 64;
+  constexpr uint32_t pinned_first = 128;
+  constexpr uint32_t pinned_count = 4;
+  constexpr uint32_t not_present_page = 132;
+  constexpr uint64_t large_page_base = guest_base + common::size_2mb;
+
+  uint64_t physical(const void* host_address) noexcept
+  {
+    return reinterpret_cast<uint64_t>(host_address);
+  }
+}
+
+namespace
+{
+  struct guest_address_space
+  {
+    struct free_deleter
+    {
+      void operator()(void* pointer) const noexcept { std::free(pointer); }
+    };
+
+    std::vector<std::unique_ptr<void, free_deleter>> allocations;
+    x86::cr3_t cr3 = {};
+    uint64_t* pml1 = nullptr;
+    std::vector<uint8_t*> pages;
+    uint8_t* large = nullptr;
+    uint8_t* pinned_pool = nullptr;
+
+    void* allocate_pages(size_t size, size_t alignment = page_size)
+    {
+      void* result = std::aligned_alloc(alignment, size);
+      std::memset(result, 0, size);
+      allocations.emplace_back(result);
+
+      return result;
+    }
+
+    guest_address_space()
+    {
+      auto pml4 = static_cast<uint64_t*>(allocate_pages(page_size));
+      auto pml3 = static_cast<uint64_t*>(allocate_pages(page_size));
+      auto pml2 = static_cast<uint64_t*>(allocate_pages(page_size));
+      pml1 = static_cast<uint64_t*>(allocate_pages(page_size));
+
+      pml4[(guest_base >> 39) & 0x1ff] = physical(pml3) | present | writable;
+      pml3[(guest_base >> 30) & 0x1ff] = physical(pml2) | present | writable;
+      pml2[(guest_base >> 21) & 0x1ff] = physical(pml1) | present | writable;
+
+      large = static_cast<uint8_t*>(allocate_pages(common::size_2mb, common::size_2mb));
+      pml2[(large_page_base >> 21) & 0x1ff] = physical(large) | present | writable | large_page;
+
+      auto contiguous = static_cast<uint8_t*>(allocate_pages(scattered_first * page_size));
+      pinned_pool = static_cast<uint8_t*>(allocate_pages(pinned_count * page_size));
+
+      for (uint32_t j = 0; j < scattered_first; j++)
+      {
+        pages.push_back(contiguous + j * page_size);
+      }
+
+      // Every scattered page gets a separate allocation with a gap, so neighbours never merge.
+      for (uint32_t j = scattered_first; j < pinned_first; j++)
+      {
+        pages.push_back(static_cast<uint8_t*>(allocate_pages(2 * page_size)) + ((j & 1) ? page_size : 0));
+      }
+
+      for (uint32_t j = 0; j < pinned_count; j++)
+      {
+        pages.push_back(pinned_pool + j * page_size);
+      }
+
+      for (uint32_t j = 0; j < pages.size(); j++)
+      {
+        pml1[j] = physical(pages[j]) | present | writable;
+      }
+
+      cr3.flags.page_frame_number = physical(pml4) >> common::page_shift;
+
+      uint64_t seed = 0x2545f4914f6cdd1d;
+
+      for (uint8_t* page : pages)
+      {
+        for (uint64_t j = 0; j < page_size; j++)
+        {
+          seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+          page[j] = static_cast<uint8_t>(seed >> 56);
+        }
+      }
+
+      for (uint64_t j = 0; j < common::size_2mb; j++)
+      {
+        large[j] = static_cast<uint8_t>(j * 7 + (j >> 12));
+      }
+    }
+
+    // Expected content of guest virtual range, read through the host pointers directly.
+    std::vector<uint8_t> expected(uint64_t guest_address, size_t size) const
+    {
+      std::vector<uint8_t> result(size);
+
+      for (size_t j = 0; j < size; j++)
+      {
+        const uint64_t address = guest_address + j;
+
+        if (address >= large_page_base)
+        {
+          result[j] = large[address - large_page_base];
+        }
+        else
+        {
+          result[j] = pages[(address - guest_base) / page_size][address % page_size];
+        }
+      }
+
+      return result;
+    }
+  };
+
+  // Guest memory access before guest_memory: every page is translated by a full walk and kept
+  // in a list, bytes are copied one by one and a page change looks the page up from the list head.
+  // Host mapping PTE updates and INVLPG it also did aren't reproduced, so it is cheaper here than it was.
+  class list_descriptor
+  {
+  private:
+    std::list<void*> memory_region_;
+    std::list<void*>::iterator prev_it_;
+    uint32_t prev_index_ = -1;
+    uint32_t initial_page_offset_ = {};
+
+  public:
+    list_descriptor(x86::cr3_t guest_cr3, uint64_t virtual_address, size_t region_size)
+    {
+      initial_page_offset_ = virtual_address & common::page_4kb_offset_mask;
+
+      const size_t number_of_entries = (initial_page_offset_ + region_size + page_size - 1) / page_size;
+
+      for (size_t j = 0; j < number_of_entries; j++)
+      {
+        uint64_t size;
+        common::guest_walk_path path;
+        const uint64_t physical_address = common::walk_guest_page_tables(guest_cr3, test::guest_environment::current().cr4,
+          (virtual_address & ~common::page_4kb_offset_mask) + j * page_size, size, path);
+
+        memory_region_.push_back(common::physical_address_to_virtual_address(physical_address));
+      }
+    }
+
+    uint8_t& operator[](uint64_t offset) noexcept
+    {
+      offset += initial_page_offset_;
+
+      if (const uint32_t new_index = static_cast<uint32_t>(offset / page_size); prev_index_ != new_index)
+      {
+        prev_index_ = new_index;
+        prev_it_ = std::next(memory_region_.begin(), prev_index_);
+      }
+
+      return static_cast<uint8_t*>(*prev_it_)[offset % page_size];
+    }
+
+    void memcpy(void* destination, uint64_t offset, size_t count) noexcept
+    {
+      for (size_t j = 0; j < count; j++)
+      {
+        static_cast<uint8_t*>(destination)[j] = (*this)[offset + j];
+      }
+    }
+  };
+
+  bool throws(const guest_address_space& space, uint64_t guest_address, size_t size)
+  {
+    try
+    {
+      pt::guest_memory memory{ space.cr3, guest_address, size };
+    }
+    catch (const std::exception&)
+    {
+      return true;
+    }
+
+    return false;
+  }
+
+  void check_region(const guest_address_space& space, uint64_t guest_address, size_t size, uint32_t expected_spans)
+  {
+    const std::vector<uint8_t> expected = space.expected(guest_address, size);
+    pt::guest_memory memory{ space.cr3, guest_address, size };
+
+    CHECK(memory.size() == size);
+    CHECK(memory.spans_count() == expected_spans);
+
+    std::vector<uint8_t> buffer(size);
+    memory.read(buffer.data(), 0, size);
+    CHECK(buffer == expected);
+
+    uint64_t seed = guest_address ^ size;
+
+    for (uint32_t j = 0; j < 500; j++)
+    {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+
+      const size_t offset = (seed >> 33) % size;
+      const size_t count = (seed >> 13) % (size - offset + 1);
+
+      std::vector<uint8_t> chunk(count);
+      memory.read(chunk.data(), offset, count);
+      CHECK(std::memcmp(chunk.data(), expected.data() + offset, count) == 0);
+      CHECK(memory.compare(offset, expected.data() + offset, count) == 0);
+
+      if (count != 0)
+      {
+        // Sign of the result must match memcmp for a difference at any position.
+        std::vector<uint8_t> changed(expected.begin() + offset, expected.begin() + offset + count);
+        const size_t position = (seed >> 7) % count;
+        changed[position] ^= 0x80;
+
+        const int result = memory.compare(offset, changed.data(), count);
+        const int reference = std::memcmp(expected.data() + offset, changed.data(), count);
+        CHECK((result < 0) == (reference < 0) && (result > 0) == (reference > 0));
+      }
+
+      // Patterns taken from the region itself, so they often cross span boundaries.
+      const size_t pattern_size = 1 + (seed >> 3) % 24;
+
+      if (offset + pattern_size <= size)
+      {
+        const size_t from = (seed >> 40) % (offset + 1);
+        const void* found = memmem(expected.data() + from, size - from, expected.data() + offset, pattern_size);
+        const size_t reference = found ? static_cast<const uint8_t*>(found) - expected.data() : pt::guest_memory::npos;
+
+        CHECK(memory.find(expected.data() + offset, pattern_size, from) == reference);
+      }
+    }
+
+    const uint8_t missing[] = { 0xde, 0xad, 0xbe, 0xef, 0x01, 0x23, 0x45, 0x67, 0x89 };
+    CHECK(memory.find(missing, sizeof(missing)) == (memmem(expected.data(), size, missing, sizeof(missing)) ?
+      static_cast<const uint8_t*>(memmem(expected.data(), size, missing, sizeof(missing))) - expected.data() : pt::guest_memory::npos));
+    CHECK(memory.find(missing, 0) == pt::guest_memory::npos);
+    CHECK(memory.find(missing, size + 1) == pt::guest_memory::npos);
+
+    bool out_of_range = false;
+
+    try
+    {
+      memory.read<uint64_t>(size - 4);
+    }
+    catch (const std::exception&)
+    {
+      out_of_range = true;
+    }
+
+    CHECK(out_of_range);
+  }
+
+  void test_regions(const guest_address_space& space)
+  {
+    // Contiguous pages are merged into one span, also across the start offset in the middle of a page.
+    check_region(space, guest_base + 100, 64 * page_size - 100, 1);
+
+    // Every scattered page is a span of its own.
+    check_region(space, guest_base + scattered_first * page_size + 3000, 40 * page_size, 41);
+
+    // Contiguous tail followed by scattered pages.
+    check_region(space, guest_base + (scattered_first - 2) * page_size, 6 * page_size, 5);
+
+    // 2MB page is consumed in one step.
+    check_region(space, large_page_base + 12345, common::size_2mb - 12345, 1);
+
+    // Frames above the identity mapping are pinned one page at a time and unpinned by the destructor.
+    check_region(space, guest_base + (pinned_first - 1) * page_size + 10, (pinned_count + 1) * page_size - 20, pinned_count + 1);
+    CHECK(test::guest_environment::current().pinned_frames == 0);
+
+    {
+      pt::guest_memory memory{ space.cr3, guest_base + pinned_first * page_size, pinned_count * page_size };
+
+      CHECK(test::guest_environment::current().pinned_frames == pinned_count);
+      CHECK(memory.span_at(0).pinned && memory.span_at(0).host_address == space.pages[pinned_first]);
+    }
+
+    CHECK(test::guest_environment::current().pinned_frames == 0);
+
+    // Pins taken before a failed translation are released.
+    CHECK(throws(space, guest_base + pinned_first * page_size, (not_present_page - pinned_first + 1) * page_size));
+    CHECK(test::guest_environment::current().pinned_frames == 0);
+
+    CHECK(throws(space, guest_base, 0));
+    CHECK(throws(space, guest_base + scattered_first * page_size, (pt::guest_memory::max_spans + 1) * page_size));
+    CHECK(!throws(space, guest_base + scattered_first * page_size, pt::guest_memory::max_spans * page_size));
+  }
+
+  // Writes are visible through the host pointers and a guest page remapped later is seen by the next accessor.
+  void test_writes_and_remap(guest_address_space& space)
+  {
+    const uint64_t address = guest_base + (scattered_first + 10) * page_size - 8;
+
+    {
+      pt::guest_memory memory{ space.cr3, address, 32 };
+
+      memory.write<uint64_t>(4, 0x1122334455667788);
+      memory.fill(12, 0xab, 20);
+
+      CHECK(memory.read<uint64_t>(4) == 0x1122334455667788);
+      CHECK(memory.read<uint32_t>(28) == 0xabababab);
+    }
+
+    const std::vector<uint8_t> written = space.expected(address, 32);
+    uint64_t value;
+    std::memcpy(&value, written.data() + 4, sizeof(value));
+
+    CHECK(value == 0x1122334455667788);
+    CHECK(written[31] == 0xab && written[12] == 0xab);
+
+    const uint32_t page = scattered_first + 10;
+    uint8_t* previous = space.pages[page];
+
+    space.pages[page] = space.pages[page + 1];
+    space.pml1[page] = physical(space.pages[page]) | present | writable;
+
+    const std::vector<uint8_t> expected = space.expected(guest_base + page * page_size, page_size);
+    pt::guest_memory memory{ space.cr3, guest_base + page * page_size, page_size };
+
+    CHECK(memory.compare(0, expected.data(), page_size) == 0);
+
+    space.pages[page] = previous;
+    space.pml1[page] = physical(previous) | present | writable;
+  }
+
+  void bench_region(const guest_address_space& space, const char* name, uint64_t guest_address, size_t size)
+  {
+    std::vector<uint8_t> buffer(size);
+
+    const double accessor_ns = test::measure([&]
+    {
+      pt::guest_memory memory{ space.cr3, guest_address, size };
+      memory.read(buffer.data(), 0, size);
+      test::keep(buffer[0]);
+    });
+
+    const double list_ns = test::measure([&]
+    {
+      list_descriptor memory{ space.cr3, guest_address, size };
+      memory.memcpy(buffer.data(), 0, size);
+      test::keep(buffer[0]);
+    });
+
+    const uint8_t pattern[] = { 0x4d, 0x5a, 0x90, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+    const double find_ns = test::measure([&]
+    {
+      pt::guest_memory memory{ space.cr3, guest_address, size };
+      test::keep(memory.find(pattern, sizeof(pattern)));
+    });
+
+    std::printf("  %-12s %6zu bytes: guest_memory map and read %8.0f ns, page list %8.0f ns (%.1fx), find %6.0f MB/s\n",
+      name, size, accessor_ns, list_ns, list_ns / accessor_ns, size / find_ns * 1e3);
+  }
+}
+
+int main()
+{
+  test::guest_environment environment;
+  guest_address_space space;
+
+  environment.pinned_begin = physical(space.pinned_pool);
+  environment.pinned_end = physical(space.pinned_pool + pinned_count * page_size);
+
+  test_regions(space);
+  test_writes_and_remap(space);
+
+  bench_region(space, "contiguous", guest_base, 16 * page_size);
+  bench_region(space, "scattered", guest_base + scattered_first * page_size, 16 * page_size);
+  bench_region(space, "large page", large_page_base, 16 * page_size);
+  bench_region(space, "small", guest_base + 200, 64);
+
+  return test::finish("guest_memory_test");
+}
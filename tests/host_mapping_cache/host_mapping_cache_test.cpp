@@ -0,0 +1,275 @@
+#include <list>
+#include <vector>
+#include "test_support.hpp"
+#include "host_mapping_cache.hpp"
+
+// LRU and pin logic of pt::host_mapping_cache checked against a straightforward model.
+
+using namespace hh;
+
+namespace
+{
+  constexpr uint32_t windows_count = 8;
+  constexpr uint64_t unused_frame = ~0ull;
+
+  std::vector<const void*> invalidated;
+}
+
+extern "C" void __invlpg(void* address)
+{
+  invalidated.push_back(address);
+}
+
+namespace
+{
+  // Unpinned windows ordered from the most recently unpinned, the victim is the last one.
+  struct cache_model
+  {
+    uint64_t frames[windows_count];
+    uint32_t pins[windows_count] = {};
+    std::list<uint32_t> lru;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    cache_model()
+    {
+      for (uint32_t j = 0; j < windows_count; j++)
+      {
+        frames[j] = unused_frame;
+        lru.push_front(j);
+      }
+    }
+
+    // Returns the window or windows_count if every window is pinned, sets remapped if the window gets a new frame.
+    uint32_t pin(uint64_t page_frame_number, bool& remapped)
+    {
+      remapped = false;
+
+      for (uint32_t j = 0; j < windows_count; j++)
+      {
+        if (frames[j] == page_frame_number)
+        {
+          hits++;
+
+          if (pins[j]++ == 0)
+          {
+            lru.remove(j);
+          }
+
+          return j;
+        }
+      }
+
+      misses++;
+
+      if (lru.empty())
+      {
+        return windows_count;
+      }
+
+      const uint32_t victim = lru.back();
+      lru.pop_back();
+
+      frames[victim] = page_frame_number;
+      pins[victim] = 1;
+      remapped = true;
+
+      return victim;
+    }
+
+    void unpin(uint32_t window)
+    {
+      if (--pins[window] == 0)
+      {
+        lru.push_front(window);
+      }
+    }
+  };
+
+  struct test_cache
+  {
+    alignas(common::page_size) uint8_t windows[windows_count][common::page_size];
+    pt::pte_64 entries[windows_count];
+    pt::host_mapping_cache cache;
+
+    test_cache()
+    {
+      cache.initialize(entries, windows[0], windows_count);
+    }
+
+    uint32_t window_of(const void* host_address) const noexcept
+    {
+      return static_cast<uint32_t>((static_cast<const uint8_t*>(host_address) - windows[0]) / common::page_size);
+    }
+  };
+
+  bool pin_throws(test_cache& cache, uint64_t page_frame_number)
+  {
+    try
+    {
+      cache.cache.pin(page_frame_number);
+    }
+    catch (const std::exception&)
+    {
+      return true;
+    }
+
+    return false;
+  }
+
+  void test_basic()
+  {
+    auto cache = std::make_unique<test_cache>();
+
+    for (const auto& entry : cache->entries)
+    {
+      CHECK(!entry.present);
+    }
+
+    invalidated.clear();
+
+    // Windows are used in order, a miss writes the PTE and invalidates the window.
+    void* first = cache->cache.pin(0x1234);
+
+    CHECK(first == cache->windows[0]);
+    CHECK(cache->entries[0].present && cache->entries[0].write && cache->entries[0].page_frame_number == 0x1234);
+    CHECK(invalidated.size() == 1 && invalidated[0] == first);
+
+    // Pin of a mapped frame is a hit without INVLPG, any address inside the window unpins it.
+    CHECK(cache->cache.pin(0x1234) == first);
+    CHECK(invalidated.size() == 1);
+
+    cache->cache.unpin(static_cast<uint8_t*>(first) + 0xfff);
+    cache->cache.unpin(first);
+
+    // Unpinned frame keeps its window until it is the least recently used one.
+    for (uint64_t frame = 0x2000; frame < 0x2000 + windows_count - 1; frame++)
+    {
+      cache->cache.unpin(cache->cache.pin(frame));
+    }
+
+    invalidated.clear();
+
+    CHECK(cache->cache.pin(0x1234) == first);
+    CHECK(invalidated.empty());
+    CHECK(cache->cache.hits() == 2 && cache->cache.misses() == windows_count);
+
+    // 0x1234 is pinned, so the oldest of the others is recycled.
+    void* recycled = cache->cache.pin(0x3000);
+
+    CHECK(recycled == cache->windows[1]);
+    CHECK(cache->entries[1].page_frame_number == 0x3000);
+    CHECK(invalidated.size() == 1 && invalidated[0] == recycled);
+
+    // Frame mapped by the recycled window is gone, pin maps it again.
+    cache->cache.unpin(recycled);
+    CHECK(cache->cache.pin(0x2000) != recycled);
+  }
+
+  void test_all_pinned()
+  {
+    auto cache = std::make_unique<test_cache>();
+    std::vector<void*> pinned;
+
+    for (uint64_t frame = 0; frame < windows_count; frame++)
+    {
+      pinned.push_back(cache->cache.pin(frame * windows_count));
+    }
+
+    // Every frame falls into the same bucket.
+    for (uint64_t frame = 0; frame < windows_count; frame++)
+    {
+      CHECK(cache->cache.pin(frame * windows_count) == pinned[frame]);
+      cache->cache.unpin(pinned[frame]);
+    }
+
+    const uint64_t misses = cache->cache.misses();
+
+    CHECK(pin_throws(*cache, 0x777));
+    CHECK(cache->cache.misses() == misses + 1);
+
+    // Failed pin changes nothing.
+    for (uint64_t frame = 0; frame < windows_count; frame++)
+    {
+      CHECK(cache->entries[frame].page_frame_number == frame * windows_count);
+      CHECK(cache->cache.pin(frame * windows_count) == pinned[frame]);
+      cache->cache.unpin(pinned[frame]);
+    }
+
+    cache->cache.unpin(pinned[5]);
+
+    CHECK(cache->cache.pin(0x777) == pinned[5]);
+    CHECK(pin_throws(*cache, 0x778));
+  }
+
+  // Random pins and unpins of frames that often share buckets, compared with the model after every step.
+  void test_against_model()
+  {
+    auto cache = std::make_unique<test_cache>();
+    cache_model model;
+    std::vector<std::pair<void*, uint32_t>> held;
+    uint64_t seed = 0x853c49e6748fea9b;
+
+    for (uint32_t step = 0; step < 200000; step++)
+    {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+
+      const bool do_pin = held.empty() || ((seed >> 60) < 8 && held.size() < 2 * windows_count);
+
+      if (do_pin)
+      {
+        const uint64_t k = (seed >> 33) % (3 * windows_count);
+        const uint64_t frame = 0x100000 + (k & 1 ? k * windows_count : k);
+
+        bool remapped;
+        const uint32_t expected = model.pin(frame, remapped);
+        invalidated.clear();
+
+        if (expected == windows_count)
+        {
+          CHECK(pin_throws(*cache, frame));
+        }
+        else
+        {
+          void* host_address = cache->cache.pin(frame);
+
+          CHECK(host_address == cache->windows[expected]);
+          CHECK(cache->entries[expected].present && cache->entries[expected].page_frame_number == frame);
+          CHECK(invalidated.size() == (remapped ? 1u : 0u));
+
+          held.emplace_back(host_address, expected);
+        }
+      }
+      else
+      {
+        const size_t index = (seed >> 33) % held.size();
+        const auto [host_address, window] = held[index];
+
+        cache->cache.unpin(static_cast<uint8_t*>(host_address) + (seed >> 20) % common::page_size);
+        model.unpin(window);
+
+        held[index] = held.back();
+        held.pop_back();
+      }
+
+      CHECK(cache->cache.hits() == model.hits && cache->cache.misses() == model.misses);
+    }
+
+    for (uint32_t j = 0; j < windows_count; j++)
+    {
+      CHECK(model.frames[j] == unused_frame || cache->entries[j].page_frame_number == model.frames[j]);
+    }
+
+    std::printf("  model run: %llu hits, %llu misses\n", static_cast<unsigned long long>(model.hits),
+      static_cast<unsigned long long>(model.misses));
+  }
+}
+
+int main()
+{
+  test_basic();
+  test_all_pinned();
+  test_against_model();
+
+  return test::finish("host_mapping_cache_test");
+}
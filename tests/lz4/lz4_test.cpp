@@ -0,0 +1,216 @@
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "test_support.hpp"
+#include "lz4.hpp"
+#include "win_driver_image.hpp"
+
+// Round trip of blocks produced by win_driver/pack_win_driver.py, malformed blocks and decoding throughput.
+
+using namespace hh;
+
+namespace
+{
+  constexpr size_t guard_size = 64;
+  constexpr uint8_t guard_value = 0xcd;
+
+  std::vector<uint8_t> read_file(const std::string& path)
+  {
+    std::ifstream file{ path, std::ios::binary };
+    return { std::istreambuf_iterator<char>{ file }, {} };
+  }
+
+  // Destination with guard bytes behind the capacity, so writes past the end are detected.
+  struct guarded_buffer
+  {
+    std::vector<uint8_t> storage;
+    size_t capacity;
+
+    explicit guarded_buffer(size_t capacity) : storage(capacity + guard_size, guard_value), capacity{ capacity }
+    {}
+
+    uint8_t* data() noexcept { return storage.data(); }
+
+    bool guard_intact() const noexcept
+    {
+      for (size_t j = capacity; j < storage.size(); j++)
+      {
+        if (storage[j] != guard_value)
+          return false;
+      }
+
+      return true;
+    }
+  };
+
+  // Malformed block must be rejected or decoded to at most capacity bytes, never written past it.
+  void check_rejected_or_bounded(const std::vector<uint8_t>& block, size_t block_size, size_t capacity)
+  {
+    guarded_buffer output{ capacity };
+
+    try
+    {
+      CHECK(lz4::decompress(block.data(), block_size, output.data(), capacity) <= capacity);
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    CHECK(output.guard_intact());
+  }
+
+  bool throws(const std::vector<uint8_t>& block, size_t capacity)
+  {
+    guarded_buffer output{ capacity };
+    bool thrown = false;
+
+    try
+    {
+      lz4::decompress(block.data(), block.size(), output.data(), capacity);
+    }
+    catch (const std::exception&)
+    {
+      thrown = true;
+    }
+
+    CHECK(output.guard_intact());
+    return thrown;
+  }
+
+  void test_fixture(const std::string& directory, const std::string& name)
+  {
+    const std::vector<uint8_t> raw = read_file(directory + "/" + name + ".bin");
+    const std::vector<uint8_t> block = read_file(directory + "/" + name + ".lz4");
+
+    CHECK(!block.empty());
+
+    // Exact capacity, then capacity with slack for the wild copies.
+    for (const size_t capacity : { raw.size(), raw.size() + 4096 })
+    {
+      guarded_buffer output{ capacity };
+      const size_t written = lz4::decompress(block.data(), block.size(), output.data(), capacity);
+
+      CHECK(written == raw.size());
+      CHECK(std::memcmp(output.data(), raw.data(), raw.size()) == 0);
+      CHECK(output.guard_intact());
+    }
+
+    if (!raw.empty())
+    {
+      CHECK(throws(block, raw.size() - 1));
+    }
+
+    // Every prefix of a block is either rejected or decodes to a prefix of the data.
+    const size_t stride = block.size() / 509 + 1;
+
+    for (size_t cut = 0; cut < block.size(); cut += stride)
+    {
+      check_rejected_or_bounded(block, cut, raw.size());
+    }
+
+    uint64_t seed = 0x1234567 + raw.size();
+
+    for (uint32_t j = 0; j < 2000 && !block.empty(); j++)
+    {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+
+      std::vector<uint8_t> corrupted = block;
+      corrupted[(seed >> 33) % corrupted.size()] ^= 1 << ((seed >> 20) & 7);
+
+      check_rejected_or_bounded(corrupted, corrupted.size(), raw.size());
+    }
+
+    if (raw.size() >= 4096)
+    {
+      std::vector<uint8_t> output(raw.size());
+      const double nanoseconds = test::measure([&]
+      {
+        test::keep(lz4::decompress(block.data(), block.size(), output.data(), output.size()));
+      });
+
+      std::printf("  %-18s %7zu -> %7zu bytes, %8.0f MB/s\n", name.c_str(), raw.size(), block.size(), raw.size() / nanoseconds * 1e3);
+    }
+  }
+
+  void test_malformed_blocks()
+  {
+    // 4 literals "abcd", then a match with offset 0.
+    CHECK(throws({ 0x40, 'a', 'b', 'c', 'd', 0x00, 0x00 }, 64));
+
+    // Match reaches before the start of the output.
+    CHECK(throws({ 0x40, 'a', 'b', 'c', 'd', 0x05, 0x00 }, 64));
+
+    // Offset is cut in half.
+    CHECK(throws({ 0x40, 'a', 'b', 'c', 'd', 0x04 }, 64));
+
+    // Literals length claims more bytes than the block has.
+    CHECK(throws({ 0x50, 'a', 'b', 'c', 'd' }, 64));
+
+    // Length continuation bytes end with the block.
+    CHECK(throws({ 0xf0, 0xff, 0xff }, 1024));
+
+    // Match of 4 + 15 + 200 bytes doesn't fit into the destination.
+    CHECK(throws({ 0x4f, 'a', 'b', 'c', 'd', 0x04, 0x00, 200, 0x10, 'e' }, 64));
+
+    // Well formed block, overlapping match with offset 1 fills 19 bytes.
+    const std::vector<uint8_t> run = { 0x1f, 'x', 0x01, 0x00, 0x00, 0x10, 'y' };
+    guarded_buffer output{ 21 };
+
+    CHECK(lz4::decompress(run.data(), run.size(), output.data(), 21) == 21);
+    CHECK(std::string(reinterpret_cast<const char*>(output.data()), 21) == std::string(20, 'x') + "y");
+    CHECK(output.guard_intact());
+  }
+
+  // The image embedded into the hypervisor must decode to a PE file of the declared size.
+  void test_embedded_win_driver()
+  {
+    std::vector<uint8_t> image(win_driver::win_driver_image_size);
+    const size_t written = lz4::decompress(win_driver::win_driver_image_compressed, sizeof(win_driver::win_driver_image_compressed),
+      image.data(), image.size());
+
+    CHECK(written == image.size());
+    CHECK(image.size() > 0x40 && image[0] == 'M' && image[1] == 'Z');
+
+    uint32_t nt_headers_offset;
+    std::memcpy(&nt_headers_offset, image.data() + 0x3c, sizeof(nt_headers_offset));
+
+    CHECK(nt_headers_offset + 4 <= image.size() && std::memcmp(image.data() + nt_headers_offset, "PE\0\0", 4) == 0);
+
+    const double nanoseconds = test::measure([&]
+    {
+      test::keep(lz4::decompress(win_driver::win_driver_image_compressed, sizeof(win_driver::win_driver_image_compressed),
+        image.data(), image.size()));
+    });
+
+    std::printf("  %-18s %7zu -> %7zu bytes, %8.0f MB/s, %.1f us per boot\n", "win_driver_image", image.size(),
+      sizeof(win_driver::win_driver_image_compressed), image.size() / nanoseconds * 1e3, nanoseconds / 1e3);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc != 2)
+  {
+    std::printf("usage: lz4_test <fixtures directory>\n");
+    return 2;
+  }
+
+  std::ifstream list{ std::string{ argv[1] } + "/fixtures.txt" };
+  std::string name;
+  uint32_t fixtures_count = 0;
+
+  while (std::getline(list, name))
+  {
+    test_fixture(argv[1], name);
+    fixtures_count++;
+  }
+
+  CHECK(fixtures_count != 0);
+
+  test_malformed_blocks();
+  test_embedded_win_driver();
+
+  return test::finish("lz4_test");
+}
@@ -0,0 +1,96 @@
+"""Writes LZ4 test fixtures compressed by the packer of the embedded win driver image.
+
+usage: make_fixtures.py <pack_win_driver.py> <output directory>
+
+Every fixture is a pair <name>.bin and <name>.lz4, fixtures.txt lists the names.
+Inputs are generated from a fixed seed, so the fixtures are the same on every run.
+"""
+
+import importlib.util
+import os
+import sys
+
+
+class Generator:
+    """Linear congruential generator, Python's random isn't needed for test data."""
+
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self):
+        self.state = (self.state * 6364136223846793005 + 1442695040888963407) & 0xffffffffffffffff
+        return self.state >> 33
+
+    def bytes(self, count):
+        return bytes(self.next() & 0xff for _ in range(count))
+
+
+def text(generator, size):
+    words = [b'hypervisor', b'guest', b'page', b'table', b'entry', b'exit', b'vmcs', b'ept', b'the', b'of',
+             b'a', b'processor', b'memory', b'type', b'cache', b'translation', b'is', b'to', b'and', b'root']
+    output = bytearray()
+
+    while len(output) < size:
+        output += words[generator.next() % len(words)] + b' '
+
+    return bytes(output[:size])
+
+
+def structured(generator, size):
+    """Mix of incompressible runs, short repeats and copies of earlier data, like a driver image."""
+    output = bytearray()
+
+    while len(output) < size:
+        kind = generator.next() % 4
+
+        if kind == 0:
+            output += generator.bytes(1 + generator.next() % 64)
+        elif kind == 1:
+            output += bytes([generator.next() & 0xff]) * (1 + generator.next() % 300)
+        elif output:
+            start = generator.next() % len(output)
+            output += output[start:start + 4 + generator.next() % 200]
+
+    return bytes(output[:size])
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    spec = importlib.util.spec_from_file_location('pack_win_driver', sys.argv[1])
+    packer = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(packer)
+
+    generator = Generator(0x5eed)
+
+    fixtures = {
+        'empty': b'',
+        'tiny': b'abc',
+        'below_match_limit': b'abcdabcdabc',
+        'zeros': bytes(100000),
+        'period_3': b'xyz' * 20000,
+        'period_11': b'0123456789a' * 6000,
+        'text': text(generator, 131072),
+        'random': generator.bytes(65536),
+        'structured': structured(generator, 262144),
+    }
+
+    os.makedirs(sys.argv[2], exist_ok=True)
+
+    for name, data in fixtures.items():
+        with open(os.path.join(sys.argv[2], name + '.bin'), 'wb') as raw_file:
+            raw_file.write(data)
+
+        with open(os.path.join(sys.argv[2], name + '.lz4'), 'wb') as block_file:
+            block_file.write(packer.compress(data))
+
+    with open(os.path.join(sys.argv[2], 'fixtures.txt'), 'w', newline='\n') as list_file:
+        list_file.write('\n'.join(fixtures) + '\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,253 @@
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test_support.hpp"
+#include "mtrr.hpp"
+
+// Checks mtrr::resolver against a naive per page evaluation written straight from Vol3A[11.11]
+// on MTRR dumps of real firmware configurations.
+
+using namespace hh;
+using ept::memory_type;
+
+namespace
+{
+  constexpr uint64_t page_size = 0x1000;
+  constexpr uint64_t checked_limit = 64ull << 30;
+  constexpr uint64_t pages_count = checked_limit / page_size;
+
+  constexpr uint64_t def_type_enable = 1ull << 11;
+  constexpr uint64_t def_type_fixed_enable = 1ull << 10;
+  constexpr uint64_t phys_mask_valid = 1ull << 11;
+  constexpr uint64_t phys_address_mask = 0x000ffffffffff000;
+
+  struct mtrr_dump
+  {
+    std::string name;
+    uint64_t def_type = 0;
+    uint64_t fixed[mtrr::resolver::fixed_msrs_count] = {};
+    std::vector<std::pair<uint64_t, uint64_t>> variable;
+  };
+
+  // Lines are "<MSR name> <value>", '#' starts a comment.
+  bool load_dump(const std::string& path, mtrr_dump& dump)
+  {
+    static const char* fixed_names[mtrr::resolver::fixed_msrs_count] =
+    {
+      "IA32_MTRR_FIX64K_00000", "IA32_MTRR_FIX16K_80000", "IA32_MTRR_FIX16K_A0000",
+      "IA32_MTRR_FIX4K_C0000", "IA32_MTRR_FIX4K_C8000", "IA32_MTRR_FIX4K_D0000", "IA32_MTRR_FIX4K_D8000",
+      "IA32_MTRR_FIX4K_E0000", "IA32_MTRR_FIX4K_E8000", "IA32_MTRR_FIX4K_F0000", "IA32_MTRR_FIX4K_F8000"
+    };
+
+    std::ifstream file{ path };
+
+    if (!file)
+      return false;
+
+    dump.name = path.substr(path.find_last_of('/') + 1);
+
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+      std::istringstream fields{ line.substr(0, line.find('#')) };
+      std::string msr;
+      uint64_t value;
+
+      if (!(fields >> msr >> std::hex >> value))
+        continue;
+
+      if (msr == "IA32_MTRR_DEF_TYPE")
+      {
+        dump.def_type = value;
+        continue;
+      }
+
+      if (msr.rfind("IA32_MTRR_PHYSBASE", 0) == 0 || msr.rfind("IA32_MTRR_PHYSMASK", 0) == 0)
+      {
+        const size_t index = std::stoul(msr.substr(18));
+
+        if (dump.variable.size() <= index)
+          dump.variable.resize(index + 1);
+
+        (msr[14] == 'B' ? dump.variable[index].first : dump.variable[index].second) = value;
+        continue;
+      }
+
+      bool known = false;
+
+      for (uint32_t j = 0; j < mtrr::resolver::fixed_msrs_count; j++)
+      {
+        if (msr == fixed_names[j])
+        {
+          dump.fixed[j] = value;
+          known = true;
+        }
+      }
+
+      CHECK(known);
+    }
+
+    return true;
+  }
+
+  // Vol3A[11.11.4.1] for a single 4KB page. Overlaps left undefined by the SDM are expected to be UC.
+  memory_type oracle(const mtrr_dump& dump, uint64_t address)
+  {
+    if (!(dump.def_type & def_type_enable))
+      return memory_type::uncacheable;
+
+    if ((dump.def_type & def_type_fixed_enable) && address < 0x100000)
+    {
+      uint32_t msr;
+      uint32_t byte;
+
+      if (address < 0x80000)
+      {
+        msr = 0;
+        byte = static_cast<uint32_t>(address / 0x10000);
+      }
+      else if (address < 0xc0000)
+      {
+        msr = 1 + static_cast<uint32_t>((address - 0x80000) / 0x20000);
+        byte = static_cast<uint32_t>((address - 0x80000) % 0x20000 / 0x4000);
+      }
+      else
+      {
+        msr = 3 + static_cast<uint32_t>((address - 0xc0000) / 0x8000);
+        byte = static_cast<uint32_t>((address - 0xc0000) % 0x8000 / 0x1000);
+      }
+
+      return static_cast<memory_type>((dump.fixed[msr] >> byte * 8) & 0xff);
+    }
+
+    bool matched[256] = {};
+    uint32_t distinct = 0;
+    memory_type single = {};
+
+    for (const auto& [base, mask] : dump.variable)
+    {
+      if (!(mask & phys_mask_valid))
+        continue;
+
+      if ((address & mask & phys_address_mask) != (base & mask & phys_address_mask))
+        continue;
+
+      const auto type = static_cast<memory_type>(base & 0xff);
+
+      if (!matched[base & 0xff])
+      {
+        matched[base & 0xff] = true;
+        distinct++;
+        single = type;
+      }
+    }
+
+    if (distinct == 0)
+      return static_cast<memory_type>(dump.def_type & 0xff);
+
+    if (distinct == 1)
+      return single;
+
+    if (matched[static_cast<uint8_t>(memory_type::uncacheable)])
+      return memory_type::uncacheable;
+
+    if (distinct == 2 && matched[static_cast<uint8_t>(memory_type::write_through)] && matched[static_cast<uint8_t>(memory_type::write_back)])
+      return memory_type::write_through;
+
+    return memory_type::uncacheable;
+  }
+
+  void test_dump(const mtrr_dump& dump)
+  {
+    mtrr::resolver resolver;
+    resolver.set_def_type(dump.def_type);
+
+    for (uint32_t j = 0; j < mtrr::resolver::fixed_msrs_count; j++)
+    {
+      resolver.set_fixed_msr(j, dump.fixed[j]);
+    }
+
+    for (const auto& [base, mask] : dump.variable)
+    {
+      resolver.add_variable_msrs(base, mask);
+    }
+
+    std::vector<memory_type> expected(pages_count);
+    uint64_t page_mismatches = 0;
+
+    for (uint64_t page = 0; page < pages_count; page++)
+    {
+      expected[page] = oracle(dump, page * page_size);
+
+      if (resolver.get_memory_type(page * page_size) != expected[page] && page_mismatches++ < 8)
+      {
+        std::printf("  %s: page 0x%llx is %u, expected %u\n", dump.name.c_str(), static_cast<unsigned long long>(page * page_size),
+          static_cast<uint32_t>(resolver.get_memory_type(page * page_size)), static_cast<uint32_t>(expected[page]));
+      }
+    }
+
+    CHECK(page_mismatches == 0);
+
+    // Region starting at page P is uniform if it ends before the first page with a different type.
+    std::vector<uint64_t> next_change(pages_count);
+    next_change[pages_count - 1] = pages_count;
+
+    for (uint64_t page = pages_count - 1; page-- != 0;)
+    {
+      next_change[page] = expected[page] == expected[page + 1] ? next_change[page + 1] : page + 1;
+    }
+
+    uint64_t region_mismatches = 0;
+    uint64_t uniform_2mb = 0;
+    uint64_t uniform_1gb = 0;
+
+    for (uint64_t size = page_size; size <= checked_limit; size *= 2)
+    {
+      const uint64_t region_pages = size / page_size;
+
+      for (uint64_t first_page = 0; first_page < pages_count; first_page += region_pages)
+      {
+        const bool expected_uniform = next_change[first_page] >= first_page + region_pages;
+        memory_type type;
+        const bool uniform = resolver.get_uniform_memory_type(first_page * page_size, size, type);
+
+        if ((uniform != expected_uniform || (uniform && type != expected[first_page])) && region_mismatches++ < 8)
+        {
+          std::printf("  %s: region 0x%llx + 0x%llx is %s %u, expected %s %u\n", dump.name.c_str(),
+            static_cast<unsigned long long>(first_page * page_size), static_cast<unsigned long long>(size),
+            uniform ? "uniform" : "mixed", static_cast<uint32_t>(type),
+            expected_uniform ? "uniform" : "mixed", static_cast<uint32_t>(expected[first_page]));
+        }
+
+        uniform_2mb += size == 2ull << 20 && uniform;
+        uniform_1gb += size == 1ull << 30 && uniform;
+      }
+    }
+
+    CHECK(region_mismatches == 0);
+
+    std::printf("  %-14s uniform 2MB regions %llu of %llu, uniform 1GB regions %llu of %llu\n", dump.name.c_str(),
+      static_cast<unsigned long long>(uniform_2mb), static_cast<unsigned long long>(checked_limit >> 21),
+      static_cast<unsigned long long>(uniform_1gb), static_cast<unsigned long long>(checked_limit >> 30));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::printf("usage: mtrr_test <dump>...\n");
+    return 2;
+  }
+
+  for (int j = 1; j < argc; j++)
+  {
+    mtrr_dump dump;
+    CHECK(load_dump(argv[j], dump));
+    test_dump(dump);
+  }
+
+  return test::finish("mtrr_test");
+}
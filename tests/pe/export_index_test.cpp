@@ -0,0 +1,410 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+#include "test_support.hpp"
+#include "guest_environment.hpp"
+#include "guest_memory.hpp"
+#include "pe.hpp"
+
+// portable_executable::export_index over a synthetic ntoskrnl export directory in guest memory,
+// checked against the linear case insensitive scan it replaced. Also times import resolution both ways.
+
+using namespace hh;
+using namespace hh::portable_executable;
+
+namespace
+{
+  constexpr uint64_t page_size = common::page_size;
+  constexpr uint64_t present = 1ull << 0;
+  constexpr uint64_t writable = 1ull << 1;
+
+  constexpr uint64_t kernel_base = 0xfffff80000000000;
+  constexpr uint32_t nt_headers_rva = 0x80;
+  constexpr uint32_t export_directory_rva = 0x1000;
+  constexpr uint32_t functions_rva = 0x100000;
+  constexpr const char* forwarded_name = "HalForwardedRoutine";
+
+  struct free_deleter
+  {
+    void operator()(void* pointer) const noexcept { std::free(pointer); }
+  };
+
+  // 4-level guest page tables in host memory, see guest_environment.hpp.
+  class guest_page_tables
+  {
+  private:
+    std::vector<std::unique_ptr<void, free_deleter>> allocations_;
+    uint64_t* pml4_;
+
+    uint64_t* next_table(uint64_t* table, uint64_t index)
+    {
+      if (!(table[index] & present))
+      {
+        table[index] = reinterpret_cast<uint64_t>(allocate(page_size)) | present | writable;
+      }
+
+      return reinterpret_cast<uint64_t*>(table[index] & 0x000ffffffffff000);
+    }
+
+  public:
+    guest_page_tables() : pml4_{ static_cast<uint64_t*>(allocate(page_size)) }
+    {}
+
+    void* allocate(size_t size)
+    {
+      size = (size + page_size - 1) & ~(page_size - 1);
+
+      void* result = std::aligned_alloc(page_size, size);
+      std::memset(result, 0, size);
+      allocations_.emplace_back(result);
+
+      return result;
+    }
+
+    void map(uint64_t guest_address, const void* host_page)
+    {
+      uint64_t* table = pml4_;
+
+      for (uint32_t shift = 39; shift != 12; shift -= 9)
+      {
+        table = next_table(table, (guest_address >> shift) & 0x1ff);
+      }
+
+      table[(guest_address >> 12) & 0x1ff] = reinterpret_cast<uint64_t>(host_page) | present | writable;
+    }
+
+    x86::cr3_t cr3() const noexcept
+    {
+      x86::cr3_t result = {};
+      result.flags.page_frame_number = reinterpret_cast<uint64_t>(pml4_) >> common::page_shift;
+
+      return result;
+    }
+  };
+
+  // Export names in the style of ntoskrnl, sorted case sensitively as the linker emits them.
+  std::vector<std::string> make_export_names()
+  {
+    static const char* prefixes[] = { "Ex", "Io", "Ke", "Mm", "Ob", "Ps", "Rtl", "Se", "Zw", "Nt", "Cm", "Po", "Wmi", "Hal", "Kd", "Fs" };
+    static const char* verbs[] = { "Allocate", "Free", "Query", "Set", "Create", "Open", "Close", "Acquire", "Release", "Initialize",
+      "Get", "Map", "Unmap", "Register", "Unregister", "Wait", "Insert", "Remove", "Lock", "Unlock" };
+    static const char* objects[] = { "Pool", "Thread", "Process", "Event", "Mutex", "Section", "File", "Key", "Irp", "Device",
+      "Timer", "Spinlock", "Resource", "Memory", "Object" };
+
+    std::vector<std::string> names;
+
+    for (const char* prefix : prefixes)
+    {
+      for (const char* verb : verbs)
+      {
+        for (const char* object : objects)
+        {
+          names.push_back(std::string{ prefix } + verb + object);
+        }
+      }
+    }
+
+    // Two exports that differ only in case, the first in AddressOfNames must win.
+    names.push_back("KeQueryTickCount");
+    names.push_back("KEQueryTickCount");
+    names.push_back("_stricmp");
+    names.push_back(forwarded_name);
+
+    std::sort(names.begin(), names.end());
+
+    return names;
+  }
+
+  // Headers and export directory of a module mapped at kernel_base.
+  struct synthetic_module
+  {
+    std::vector<std::string> names;
+    std::vector<uint32_t> function_rvas;
+    uint32_t directory_size = 0;
+
+    synthetic_module(guest_page_tables& tables, const std::vector<std::string>& export_names) : names{ export_names }
+    {
+      const auto count = static_cast<uint32_t>(names.size());
+      uint32_t names_size = 0;
+
+      for (const auto& name : names)
+      {
+        names_size += static_cast<uint32_t>(name.size()) + 1;
+      }
+
+      const uint32_t functions_table = sizeof(IMAGE_EXPORT_DIRECTORY);
+      const uint32_t name_table = functions_table + count * sizeof(uint32_t);
+      const uint32_t ordinal_table = name_table + count * sizeof(uint32_t);
+      const uint32_t strings = ordinal_table + count * sizeof(uint16_t);
+      const uint32_t forwarder = strings + names_size;
+
+      directory_size = forwarder + 16;
+
+      const uint32_t image_size = export_directory_rva + directory_size;
+      auto image = static_cast<uint8_t*>(tables.allocate(image_size));
+
+      for (uint32_t offset = 0; offset < image_size; offset += page_size)
+      {
+        tables.map(kernel_base + offset, image + offset);
+      }
+
+      auto dos_header = reinterpret_cast<IMAGE_DOS_HEADER*>(image);
+      dos_header->e_magic = IMAGE_DOS_SIGNATURE;
+      dos_header->e_lfanew = nt_headers_rva;
+
+      auto nt_headers = reinterpret_cast<IMAGE_NT_HEADERS64*>(image + nt_headers_rva);
+      nt_headers->Signature = IMAGE_NT_SIGNATURE;
+      nt_headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT] = { export_directory_rva, directory_size };
+
+      uint8_t* directory = image + export_directory_rva;
+      auto export_directory = reinterpret_cast<IMAGE_EXPORT_DIRECTORY*>(directory);
+      export_directory->NumberOfFunctions = count;
+      export_directory->NumberOfNames = count;
+      export_directory->AddressOfFunctions = export_directory_rva + functions_table;
+      export_directory->AddressOfNames = export_directory_rva + name_table;
+      export_directory->AddressOfNameOrdinals = export_directory_rva + ordinal_table;
+
+      std::memcpy(directory + forwarder, "HAL.HalRoutine", 15);
+
+      uint32_t string_offset = strings;
+
+      for (uint32_t j = 0; j < count; j++)
+      {
+        // Ordinals are a permutation, so names and functions aren't in the same order.
+        const auto ordinal = static_cast<uint16_t>((j * 7919ull) % count);
+        const uint32_t function_rva = names[j] == forwarded_name ? export_directory_rva + forwarder : functions_rva + ordinal * 0x10;
+
+        reinterpret_cast<uint32_t*>(directory + name_table)[j] = export_directory_rva + string_offset;
+        reinterpret_cast<uint16_t*>(directory + ordinal_table)[j] = ordinal;
+        reinterpret_cast<uint32_t*>(directory + functions_table)[ordinal] = function_rva;
+
+        std::memcpy(directory + string_offset, names[j].c_str(), names[j].size() + 1);
+        string_offset += static_cast<uint32_t>(names[j].size()) + 1;
+      }
+
+      function_rvas.resize(count);
+
+      for (uint32_t j = 0; j < count; j++)
+      {
+        function_rvas[j] = reinterpret_cast<uint32_t*>(directory + functions_table)[reinterpret_cast<uint16_t*>(directory + ordinal_table)[j]];
+      }
+    }
+  };
+
+  bool iequals(const std::string_view& lhs, const std::string_view& rhs)
+  {
+    auto to_lower{ std::ranges::views::transform(::tolower) };
+    return std::ranges::equal(lhs | to_lower, rhs | to_lower);
+  }
+
+  // get_kernel_module_export before export_index: headers and the whole export directory are copied
+  // from guest memory on every call and names are scanned linearly. Guest memory is read through
+  // guest_memory here, the old per byte mapping was slower still.
+  uint64_t linear_kernel_module_export(uint64_t kernel_module_base, std::string_view function_name)
+  {
+    const x86::cr3_t guest_cr3 = test::guest_environment::current().cr3;
+
+    const auto dos_header = pt::guest_memory{ guest_cr3, kernel_module_base, sizeof(IMAGE_DOS_HEADER) }.read<IMAGE_DOS_HEADER>(0);
+
+    if (dos_header.e_magic != IMAGE_DOS_SIGNATURE)
+      return 0;
+
+    const auto nt_headers = pt::guest_memory{ guest_cr3, kernel_module_base + dos_header.e_lfanew, sizeof(IMAGE_NT_HEADERS64) }
+      .read<IMAGE_NT_HEADERS64>(0);
+
+    if (nt_headers.Signature != IMAGE_NT_SIGNATURE)
+      return 0;
+
+    const auto export_base = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].VirtualAddress;
+    const auto export_base_size = nt_headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT].Size;
+
+    if (!export_base || !export_base_size)
+      return 0;
+
+    std::unique_ptr<uint8_t[]> export_data{ new uint8_t[export_base_size] };
+    pt::guest_memory{ guest_cr3, kernel_module_base + export_base, export_base_size }.read(export_data.get(), 0, export_base_size);
+
+    const auto export_directory = reinterpret_cast<const IMAGE_EXPORT_DIRECTORY*>(export_data.get());
+    const auto delta = reinterpret_cast<uint64_t>(export_data.get()) - export_base;
+    const auto name_table = reinterpret_cast<const uint32_t*>(export_directory->AddressOfNames + delta);
+    const auto ordinal_table = reinterpret_cast<const uint16_t*>(export_directory->AddressOfNameOrdinals + delta);
+    const auto function_table = reinterpret_cast<const uint32_t*>(export_directory->AddressOfFunctions + delta);
+
+    for (auto i = 0u; i < export_directory->NumberOfNames; ++i)
+    {
+      const std::string current_function_name = std::string{ reinterpret_cast<const char*>(name_table[i] + delta) };
+
+      if (iequals(current_function_name, function_name))
+      {
+        const auto function_address = kernel_module_base + function_table[ordinal_table[i]];
+
+        if (function_address >= kernel_module_base + export_base && function_address <= kernel_module_base + export_base + export_base_size)
+          return 0;
+
+        return function_address;
+      }
+    }
+
+    return 0;
+  }
+
+  std::string with_case(std::string name, bool upper)
+  {
+    for (char& c : name)
+    {
+      c = static_cast<char>(upper ? std::toupper(c) : std::tolower(c));
+    }
+
+    return name;
+  }
+
+  void test_lookup(const synthetic_module& module)
+  {
+    const export_index index{ kernel_base };
+
+    CHECK(!index.empty());
+
+    for (size_t j = 0; j < module.names.size(); j++)
+    {
+      const std::string& name = module.names[j];
+      const uint64_t expected = name == forwarded_name ? 0 : kernel_base + module.function_rvas[j];
+      const uint64_t found = index.find(name);
+
+      // Exact name of the second case duplicate resolves to the first one, like the linear scan.
+      if (name != "KeQueryTickCount")
+      {
+        CHECK(found == linear_kernel_module_export(kernel_base, name));
+      }
+
+      CHECK(name == forwarded_name ? found == 0 : found != 0);
+      CHECK(name == "KeQueryTickCount" || found == expected);
+
+      for (const bool upper : { false, true })
+      {
+        const std::string changed = with_case(name, upper);
+        CHECK(index.find(changed) == linear_kernel_module_export(kernel_base, changed));
+      }
+    }
+
+    const auto first_duplicate = std::find(module.names.begin(), module.names.end(), "KEQueryTickCount") - module.names.begin();
+    CHECK(index.find("kequerytickcount") == kernel_base + module.function_rvas[first_duplicate]);
+    CHECK(index.find("KeQueryTickCount") == kernel_base + module.function_rvas[first_duplicate]);
+
+    for (const char* missing : { "", "A", "Zz", "ExAllocatePoo", "ExAllocatePoolX", "zzzzzzzz", "\x7f" })
+    {
+      CHECK(index.find(missing) == 0);
+      CHECK(linear_kernel_module_export(kernel_base, missing) == 0);
+    }
+
+    CHECK(get_kernel_module_export(kernel_base, "iogetdeviceobject") == linear_kernel_module_export(kernel_base, "IoGetDeviceObject"));
+    CHECK(get_kernel_module_export(0, "IoGetDeviceObject") == 0);
+    CHECK(export_index{ kernel_base + page_size }.empty());
+  }
+
+  vec_imports make_imports(const synthetic_module& module, std::vector<uint64_t>& thunks, uint32_t count)
+  {
+    import_info import{ "ntoskrnl.exe", {} };
+    thunks.assign(count, 0);
+
+    for (uint32_t j = 0; j < count; j++)
+    {
+      std::string name = module.names[(j * 104729ull) % module.names.size()];
+
+      if (name == forwarded_name)
+      {
+        name = module.names[0];
+      }
+
+      import.function_datas.push_back({ name, &thunks[j] });
+    }
+
+    return { import };
+  }
+
+  void test_resolve_imports(const synthetic_module& module)
+  {
+    std::vector<uint64_t> thunks;
+    vec_imports imports = make_imports(module, thunks, 64);
+
+    resolve_imports(kernel_base, imports);
+
+    for (const auto& function : imports[0].function_datas)
+    {
+      CHECK(*function.address != 0 && *function.address == linear_kernel_module_export(kernel_base, function.name));
+    }
+
+    bool thrown = false;
+    imports[0].function_datas.push_back({ "MissingRoutine", &thunks[0] });
+
+    try
+    {
+      resolve_imports(kernel_base, imports);
+    }
+    catch (const std::exception&)
+    {
+      thrown = true;
+    }
+
+    CHECK(thrown);
+
+    thrown = false;
+    imports[0].function_datas.pop_back();
+    imports[0].module_name = "hal.dll";
+
+    try
+    {
+      resolve_imports(kernel_base, imports);
+    }
+    catch (const std::exception&)
+    {
+      thrown = true;
+    }
+
+    CHECK(thrown);
+  }
+
+  void bench_resolve_imports(const synthetic_module& module)
+  {
+    for (const uint32_t imports_count : { 16u, 64u, 256u })
+    {
+      std::vector<uint64_t> thunks;
+      const vec_imports imports = make_imports(module, thunks, imports_count);
+
+      const double index_ns = test::measure([&]
+      {
+        resolve_imports(kernel_base, imports);
+      });
+
+      const double linear_ns = test::measure([&]
+      {
+        for (const auto& function : imports[0].function_datas)
+        {
+          *function.address = linear_kernel_module_export(kernel_base, function.name);
+        }
+      });
+
+      std::printf("  %3u imports of %zu exports (%u bytes directory): export_index %8.1f us, linear scan %9.1f us (%.0fx)\n",
+        imports_count, module.names.size(), module.directory_size, index_ns / 1e3, linear_ns / 1e3, linear_ns / index_ns);
+    }
+  }
+}
+
+int main()
+{
+  test::guest_environment environment;
+  guest_page_tables tables;
+  const synthetic_module module{ tables, make_export_names() };
+
+  environment.cr3 = tables.cr3();
+
+  test_lookup(module);
+  test_resolve_imports(module);
+  bench_resolve_imports(module);
+
+  return test::finish("export_index_test");
+}
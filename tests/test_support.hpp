@@ -0,0 +1,55 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+// Checks and timing shared by host tests. A failed check is reported and counted,
+// the test keeps running so one run shows every failure.
+
+#define CHECK(expression)                                                               \
+  do                                                                                    \
+  {                                                                                     \
+    if (!(expression))                                                                  \
+    {                                                                                   \
+      std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #expression);        \
+      hh::test::failures++;                                                             \
+    }                                                                                   \
+  } while (0)
+
+namespace hh::test
+{
+  inline uint32_t failures = 0;
+
+  // Keeps the compiler from dropping computations whose results are otherwise unused.
+  template <typename T>
+  inline void keep(const T& value) noexcept
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  // Calls body repeatedly for at least min_seconds and returns nanoseconds per call.
+  template <typename Body>
+  double measure(Body&& body, double min_seconds = 0.2)
+  {
+    using clock = std::chrono::steady_clock;
+
+    const clock::time_point start = clock::now();
+    uint64_t calls = 0;
+    double elapsed;
+
+    do
+    {
+      body();
+      calls++;
+      elapsed = std::chrono::duration<double>(clock::now() - start).count();
+    } while (elapsed < min_seconds);
+
+    return elapsed * 1e9 / calls;
+  }
+
+  inline int finish(const char* name) noexcept
+  {
+    std::printf("%s: %s, %u failed checks\n", name, failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+  }
+}
@@ -0,0 +1,140 @@
+"""Packs win_driver.sys into an LZ4 compressed C++ array for the hypervisor.
+
+usage: pack_win_driver.py <win_driver.sys> <win_driver_image.hpp>
+
+The output is a single LZ4 block (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+decoded by hh::lz4::decompress in initialize_memory_for_win_driver.
+"""
+
+import sys
+
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MATCH_FIND_LIMIT = 12
+MAX_OFFSET = 0xffff
+MAX_CHAIN_LENGTH = 64
+BYTES_PER_LINE = 16
+
+
+def write_length(output, length):
+    while length >= 0xff:
+        output.append(0xff)
+        length -= 0xff
+
+    output.append(length)
+
+
+def write_sequence(output, literals, offset, match_length):
+    literals_length = len(literals)
+    token = min(literals_length, 0xf) << 4
+
+    if offset:
+        token |= min(match_length - MIN_MATCH, 0xf)
+
+    output.append(token)
+
+    if literals_length >= 0xf:
+        write_length(output, literals_length - 0xf)
+
+    output += literals
+
+    if offset:
+        output += offset.to_bytes(2, 'little')
+
+        if match_length - MIN_MATCH >= 0xf:
+            write_length(output, match_length - MIN_MATCH - 0xf)
+
+
+def compress(data):
+    """Greedy LZ4 block compressor with hash chains, ratio is close to lz4 -9."""
+    size = len(data)
+    output = bytearray()
+    head = {}
+    chain = [-1] * size
+    match_limit = size - LAST_LITERALS
+    position = 0
+    anchor = 0
+
+    def insert(at):
+        key = data[at:at + MIN_MATCH]
+        chain[at] = head.get(key, -1)
+        head[key] = at
+
+    while position < size - MATCH_FIND_LIMIT:
+        best_length = 0
+        best_offset = 0
+        candidate = head.get(data[position:position + MIN_MATCH], -1)
+        attempts = MAX_CHAIN_LENGTH
+
+        while candidate >= 0 and position - candidate <= MAX_OFFSET and attempts:
+            # A candidate may beat the best match only if it matches at the best length too.
+            if position + best_length < match_limit and data[candidate + best_length] == data[position + best_length]:
+                length = 0
+
+                while position + length < match_limit and data[candidate + length] == data[position + length]:
+                    length += 1
+
+                if length > best_length:
+                    best_length = length
+                    best_offset = position - candidate
+
+            candidate = chain[candidate]
+            attempts -= 1
+
+        if best_length < MIN_MATCH:
+            insert(position)
+            position += 1
+            continue
+
+        write_sequence(output, data[anchor:position], best_offset, best_length)
+
+        for j in range(position, min(position + best_length, size - MIN_MATCH + 1)):
+            insert(j)
+
+        position += best_length
+        anchor = position
+
+    write_sequence(output, data[anchor:], 0, 0)
+
+    return bytes(output)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    with open(sys.argv[1], 'rb') as image_file:
+        image = image_file.read()
+
+    compressed = compress(image)
+
+    lines = []
+
+    for j in range(0, len(compressed), BYTES_PER_LINE):
+        lines.append('    ' + ', '.join(f'0x{byte:02x}' for byte in compressed[j:j + BYTES_PER_LINE]) + ',')
+
+    with open(sys.argv[2], 'w', newline='\n') as header:
+        header.write('#pragma once\n'
+                     '#include <cstdint>\n'
+                     '\n'
+                     '// Generated by win_driver/pack_win_driver.py, don\'t edit it by hand.\n'
+                     '\n'
+                     'namespace hh::win_driver\n'
+                     '{\n'
+                     '  // Our win driver that is mapped on patchguard initialization, LZ4 block compressed.\n'
+                     f'  inline constexpr uint32_t win_driver_image_size = {len(image)};\n'
+                     '\n'
+                     '  inline constexpr uint8_t win_driver_image_compressed[] =\n'
+                     '  {\n'
+                     + '\n'.join(lines) + '\n'
+                     '  };\n'
+                     '}\n')
+
+    print(f'{sys.argv[1]}: {len(image)} -> {len(compressed)} bytes')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -6,6 +6,7 @@
 #include "printf.hpp"
 #include <exception>
 #include "pt.hpp"
+#include "../../samples/hypervisor/page_walk.hpp"
 
 namespace hh::common
 {
@@ -139,68 +140,27 @@ namespace hh::common
 
   uint64_t get_physical_address_for_virtual_address_by_cr3(x86::cr3_t guest_cr3, void* virtual_address_guest)
   {
-    virtual_address va_parts = { .all = reinterpret_cast<uint64_t>(virtual_address_guest) };
-    uint64_t final_ptr;
-
-    do
-    {
-      const auto pml4 = reinterpret_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(guest_cr3.flags.page_frame_number << page_shift));
-
-      if (!pml4[va_parts.pml4_index].fields.present)
-      {
-        PRINT(("address = 0x%llx\n", virtual_address_guest));
-        throw std::exception{ __FUNCTION__": ""PML4 isn't present." };
-      }
-
-      const auto pml3 = reinterpret_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml4[va_parts.pml4_index].fields.page_frame_number << page_shift));
-
-      if (!pml3[va_parts.pdpt_index].fields.present)
+    // Paging mode is global, so CR4 of the current processor tells whether translation starts from PML5.
+    const uint32_t levels = x86::read<x86::cr4_t>().flags.linear_addresses_57_bit ? 5 : 4;
+    uint64_t physical_address;
+    uint64_t page_size;
+
+    const uint32_t missing_level = pt::walk_page_tables(guest_cr3.flags.page_frame_number << page_shift, levels,
+      reinterpret_cast<uint64_t>(virtual_address_guest),
+      [](uint64_t table_address, uint64_t index) -> const volatile uint64_t*
       {
-        throw std::exception{ __FUNCTION__": ""PML3 isn't present." };
-      }
+        return reinterpret_cast<const volatile uint64_t*>(physical_address_to_virtual_address(table_address)) + index;
+      },
+      [](const volatile uint64_t*, uint64_t) {},
+      physical_address, page_size);
 
-      if (pml3[va_parts.pdpt_index].fields.large_page)
-      {
-        final_ptr = physical_address_to_virtual_address(pml3[va_parts.pdpt_index].pdpt_large.page_frame_number << page_shift_1gb);
-
-        final_ptr += va_parts.all & page_1gb_offset_mask;
-
-        break;
-      }
-
-      const auto pml2 = reinterpret_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml3[va_parts.pdpt_index].fields.page_frame_number << page_shift));
-
-      if (!pml2[va_parts.pd_index].pd.present)
-      {
-        throw std::exception{ __FUNCTION__": ""PML2 isn't present." };
-      }
-
-      if (pml2[va_parts.pd_index].pd.large_page)
-      {
-        final_ptr = physical_address_to_virtual_address(pml2[va_parts.pd_index].pd_large.page_frame_number << page_shift_2mb);
-
-        final_ptr += va_parts.all & page_2mb_offset_mask;
-
-        break;
-      }
-
-      const auto pml1 = reinterpret_cast<pt::page_entry*>
-        (physical_address_to_virtual_address(pml2[va_parts.pd_index].fields.page_frame_number << page_shift));
-
-      if (!pml1[va_parts.pt_index].fields.present)
-      {
-        throw std::exception{ __FUNCTION__": ""PML1 isn't present." };
-      }
-
-      final_ptr = physical_address_to_virtual_address(pml1[va_parts.pt_index].fields.page_frame_number << page_shift);
-      final_ptr += va_parts.page_offset;
-
-    } while (false);
+    if (missing_level)
+    {
+      PRINT(("address = 0x%llx\n", virtual_address_guest));
+      throw std::exception{ pt::not_present_messages[missing_level - 1] };
+    }
 
-    return final_ptr;
+    return physical_address_to_virtual_address(physical_address);
   }
 
   void print_formatted(const char* text, ...) noexcept
@@ -28,6 +28,8 @@ namespace hh::common
   inline constexpr uint64_t page_1gb_offset_mask = (~0ull) >> (64 - page_shift_1gb);
   inline constexpr uint64_t page_2mb_offset_mask = (~0ull) >> (64 - page_shift_2mb);
   inline constexpr uint64_t page_4kb_offset_mask = (~0ull) >> (64 - page_shift);
+  inline constexpr uint32_t paging_index_bits = 9;
+  inline constexpr uint64_t paging_index_mask = (1ull << paging_index_bits) - 1;
 
   union virtual_address
   {
@@ -38,7 +40,10 @@ namespace hh::common
       uint64_t pd_index : 9;
       uint64_t pdpt_index : 9;
       uint64_t pml4_index : 9;
-      uint64_t unused : 16;
+
+      // Used only with 5-level paging.
+      uint64_t pml5_index : 9;
+      uint64_t unused : 7;
     };
 
     uint64_t all;
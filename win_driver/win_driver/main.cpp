@@ -8,6 +8,8 @@
 #include "common.hpp"
 #include "hooking.hpp"
 #include "hook_functions.hpp"
+#include "../../samples/hypervisor/exit_statistics.hpp"
+#include "../../samples/hypervisor/flight_record.hpp"
 
 using namespace hh;
 
@@ -21,6 +23,128 @@ void install_hooks(void* ntoskrnl_base)
   __vmcall(vmcall_number::notify_all_to_invalidate_ept);
 }
 
+// Upper bound of the bucket where the given fraction of exits is reached.
+uint64_t latency_percentile(const statistics::latency_histogram& histogram, uint64_t percent)
+{
+  const uint64_t threshold = (histogram.count * percent + 99) / 100;
+  uint64_t accumulated = 0;
+
+  for (uint32_t j = 0; j < statistics::latency_buckets_count; j++)
+  {
+    accumulated += histogram.buckets[j];
+
+    if (accumulated >= threshold)
+    {
+      return 2ull << j;
+    }
+  }
+
+  return histogram.max_ticks;
+}
+
+void print_latency_histogram(const char* kind, uint64_t index, const statistics::latency_histogram& histogram)
+{
+  if (histogram.count == 0)
+  {
+    return;
+  }
+
+  PRINT(("  %a 0x%llx: count = %llu, avg = %llu, p50 <= %llu, p99 <= %llu, max = %llu ticks\n",
+    kind, index, histogram.count, histogram.total_ticks / histogram.count,
+    latency_percentile(histogram, 50), latency_percentile(histogram, 99), histogram.max_ticks));
+}
+
+void print_exit_statistics()
+{
+  auto exit_statistics = std::make_unique<statistics::exit_statistics>();
+
+  // Hypervisor refuses the request when processor index is out of range.
+  for (uint64_t cpu_index = 0;
+    __vmcall(vmcall_number::get_exit_statistics, cpu_index, reinterpret_cast<uint64_t>(exit_statistics.get()),
+      sizeof(statistics::exit_statistics)) == status::hv_success; cpu_index++)
+  {
+    PRINT(("VMEXIT latency statistics for processor #%llu:\n", cpu_index));
+
+    for (uint32_t j = 0; j < statistics::exit_reasons_count; j++)
+    {
+      print_latency_histogram("exit reason", j, exit_statistics->by_reason[j]);
+    }
+
+    for (uint32_t j = 0; j < statistics::vmcall_numbers_count; j++)
+    {
+      print_latency_histogram("vmcall", j, exit_statistics->by_vmcall[j]);
+    }
+
+    print_latency_histogram("ept shootdowns", 0, exit_statistics->shootdowns);
+
+    const statistics::translation_cache_statistics& translations = exit_statistics->translations;
+    const uint64_t lookups = translations.hits + translations.misses;
+
+    PRINT(("  translation cache: hits = %llu, misses = %llu, hit rate = %llu%%, stale = %llu, invalidations = %llu
+",
+      translations.hits, translations.misses, lookups ? translations.hits * 100 / lookups : 0,
+      translations.stale_entries, translations.invalidations));
+  }
+}
+
+void print_flight_records()
+{
+  constexpr uint32_t printed_records_count = 8;
+  constexpr size_t buffer_size = sizeof(diagnostics::flight_recorder_drain_header)
+    + diagnostics::flight_recorder_capacity * sizeof(diagnostics::flight_record);
+
+  auto buffer = std::make_unique<uint8_t[]>(buffer_size);
+  auto header = reinterpret_cast<diagnostics::flight_recorder_drain_header*>(buffer.get());
+  auto records = reinterpret_cast<diagnostics::flight_record*>(header + 1);
+
+  for (uint64_t cpu_index = 0;
+    __vmcall(vmcall_number::drain_flight_recorder, cpu_index, reinterpret_cast<uint64_t>(buffer.get()), buffer_size) == status::hv_success;
+    cpu_index++)
+  {
+    PRINT(("Drained %llu VMEXIT records of processor #%llu, %llu records lost\n", header->records_count, cpu_index, header->records_lost));
+
+    const uint64_t first = header->records_count > printed_records_count ? header->records_count - printed_records_count : 0;
+
+    for (uint64_t j = first; j < header->records_count; j++)
+    {
+      PRINT(("  tsc = %llx, reason = 0x%x, qualification = %llx, rip = %llx, gpa = %llx\n",
+        records[j].tsc, records[j].exit_reason, records[j].exit_qualification, records[j].guest_rip, records[j].guest_physical_address));
+    }
+  }
+}
+
+// Average TSC ticks of CPUID leaf 0 round trip with the given VMEXIT fast path mask.
+uint64_t measure_cpuid_round_trip(uint32_t fast_path_mask)
+{
+  constexpr uint32_t iterations = 10000;
+  int cpu_info[4];
+
+  __vmcall(vmcall_number::set_fast_path_mask, fast_path_mask);
+  __cpuid(cpu_info, 0);
+
+  const uint64_t start_tsc = __rdtsc();
+
+  for (uint32_t j = 0; j < iterations; j++)
+  {
+    __cpuid(cpu_info, 0);
+  }
+
+  return (__rdtsc() - start_tsc) / iterations;
+}
+
+void print_fast_path_latency()
+{
+  constexpr uint32_t all_fast_paths = ~0u;
+
+  const uint64_t fast_path_ticks = measure_cpuid_round_trip(all_fast_paths);
+  const uint64_t regular_path_ticks = measure_cpuid_round_trip(0);
+
+  __vmcall(vmcall_number::set_fast_path_mask, all_fast_paths);
+
+  PRINT(("CPUID round trip: %llu ticks through the VMEXIT fast path, %llu ticks through handlers_dispatcher\n",
+    fast_path_ticks, regular_path_ticks));
+}
+
 extern "C" NTSTATUS DriverEntry()
 {
   // construct global, static variables
@@ -36,6 +160,9 @@ extern "C" NTSTATUS DriverEntry()
     globals::hook_builder = new hook::hook_builder;
 
     install_hooks(reinterpret_cast<void*>(ntoskrnl_base));
+    print_fast_path_latency();
+    print_exit_statistics();
+    print_flight_records();
   }
   catch(std::exception& e)
   {
@@ -23,6 +23,10 @@ namespace hh
     get_win_driver_pool_size,
     get_physical_address_for_virtual,
     notify_all_to_invalidate_ept,
+    panic,
+    get_exit_statistics,
+    drain_flight_recorder,
+    set_fast_path_mask,
   };
 
   extern "C" status __vmcall(vmcall_number vmcall_number, uint64_t arg1 = 0, uint64_t arg2 = 0, uint64_t arg3 = 0);